@@ -0,0 +1,134 @@
+#include "Engine/Core/Buffer/BitStream.hpp"
+
+namespace enigma::core
+{
+    //===========================================================================================
+    // BitWriter
+    //===========================================================================================
+
+    BitWriter::BitWriter(ByteBuffer& buffer)
+        : m_buffer(buffer)
+    {
+    }
+
+    BitWriter::~BitWriter()
+    {
+        Flush();
+    }
+
+    void BitWriter::WriteBits(uint64_t value, uint32_t bitCount)
+    {
+        if (bitCount == 0)
+            return;
+        if (bitCount < 64)
+            value &= (uint64_t(1) << bitCount) - 1;
+        m_bitsWritten += bitCount;
+
+        const uint32_t space = 64 - m_pendingBits;
+        if (bitCount < space)
+        {
+            m_accumulator |= value << m_pendingBits;
+            m_pendingBits += bitCount;
+            return;
+        }
+
+        // Fill the accumulator, emit it, and keep the bits that did not fit
+        m_accumulator |= value << m_pendingBits;
+        emitWord();
+        const uint32_t remaining = bitCount - space;
+        m_accumulator = remaining > 0 ? value >> space : 0;
+        m_pendingBits = remaining;
+    }
+
+    void BitWriter::WriteBool(bool value)
+    {
+        WriteBits(value ? 1 : 0, 1);
+    }
+
+    void BitWriter::Flush()
+    {
+        if (m_pendingBits == 0)
+            return;
+
+        const uint32_t bytes = (m_pendingBits + 7) / 8;
+        byte_t*        out   = m_buffer.ReserveAndGetWritePtr(bytes);
+        for (uint32_t index = 0; index < bytes; ++index)
+        {
+            out[index] = static_cast<byte_t>(m_accumulator >> (index * 8));
+        }
+        m_buffer.CommitReservedWrite(bytes);
+        m_accumulator = 0;
+        m_pendingBits = 0;
+    }
+
+    void BitWriter::emitWord()
+    {
+        uint64_t word = ToByteOrder(m_accumulator, ByteOrder::Little);
+        m_buffer.WriteRawBytes(&word, sizeof(word));
+    }
+
+    //===========================================================================================
+    // BitReader
+    //===========================================================================================
+
+    BitReader::BitReader(const byte_t* data, size_t size)
+        : m_data(data)
+        , m_size(size)
+    {
+    }
+
+    BitReader::BitReader(const ByteBufferView& view)
+        : BitReader(view.ReadData(), view.ReadableBytes())
+    {
+    }
+
+    uint64_t BitReader::ReadBits(uint32_t bitCount)
+    {
+        if (bitCount == 0)
+            return 0;
+        if (bitCount > GetRemainingBits())
+            throw BufferUnderflowException(m_bitPosition / 8, m_size, (bitCount + 7) / 8);
+
+        const uint64_t mask       = bitCount < 64 ? (uint64_t(1) << bitCount) - 1 : ~uint64_t(0);
+        size_t         byteIndex  = m_bitPosition >> 3;
+        uint32_t       bitOffset  = static_cast<uint32_t>(m_bitPosition & 7);
+
+        // Fast path: one unaligned 64-bit load covers the whole field
+        if (byteIndex + sizeof(uint64_t) <= m_size && bitCount + bitOffset <= 64)
+        {
+            uint64_t word;
+            std::memcpy(&word, m_data + byteIndex, sizeof(word));
+            word = ToByteOrder(word, ByteOrder::Little);
+            m_bitPosition += bitCount;
+            return (word >> bitOffset) & mask;
+        }
+
+        uint64_t result = 0;
+        uint32_t filled = 0;
+        while (filled < bitCount)
+        {
+            byteIndex          = m_bitPosition >> 3;
+            bitOffset          = static_cast<uint32_t>(m_bitPosition & 7);
+            uint32_t take      = 8 - bitOffset;
+            if (take > bitCount - filled)
+                take = bitCount - filled;
+            uint64_t bits = (static_cast<uint64_t>(m_data[byteIndex]) >> bitOffset) & ((1u << take) - 1);
+            result |= bits << filled;
+            filled += take;
+            m_bitPosition += take;
+        }
+        return result;
+    }
+
+    bool BitReader::ReadBool()
+    {
+        return ReadBits(1) != 0;
+    }
+
+    void BitReader::AlignToByte()
+    {
+        m_bitPosition = (m_bitPosition + 7) & ~static_cast<size_t>(7);
+        if (m_bitPosition > m_size * 8)
+            m_bitPosition = m_size * 8;
+    }
+} // namespace enigma::core
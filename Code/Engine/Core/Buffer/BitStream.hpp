@@ -0,0 +1,71 @@
+#pragma once
+//-----------------------------------------------------------------------------------------------
+// BitStream.hpp
+//
+// Bit-level packing on top of ByteBuffer / ByteBufferView.
+//
+// Bits are written least-significant first into a 64-bit accumulator that is flushed to the
+// buffer as little-endian bytes, independent of the buffer's ByteOrder. The final partial byte
+// is zero-padded by Flush(). A field written with N bits is read back with the same N.
+//
+// Usage:
+//   BitWriter writer(buffer);
+//   writer.WriteBits(blockId, 12);
+//   writer.WriteBool(isLit);
+//   writer.Flush();
+//
+//   BitReader reader(buffer.AsView());
+//   uint32_t blockId = static_cast<uint32_t>(reader.ReadBits(12));
+//   buffer.Skip(reader.GetConsumedBytes());
+//-----------------------------------------------------------------------------------------------
+
+#include "Engine/Core/Buffer/ByteBuffer.hpp"
+
+#include <cstdint>
+
+namespace enigma::core
+{
+    class BitWriter
+    {
+    public:
+        explicit BitWriter(ByteBuffer& buffer);
+        ~BitWriter(); // Flushes pending bits
+
+        BitWriter(const BitWriter&)            = delete;
+        BitWriter& operator=(const BitWriter&) = delete;
+
+        void WriteBits(uint64_t value, uint32_t bitCount); // bitCount in [0, 64], upper bits of value ignored
+        void WriteBool(bool value);
+        void Flush();                                      // Pads to a byte boundary and appends pending bytes
+
+        size_t GetBitsWritten() const { return m_bitsWritten; }
+
+    private:
+        void emitWord();
+
+        ByteBuffer& m_buffer;
+        uint64_t    m_accumulator = 0;
+        uint32_t    m_pendingBits = 0;
+        size_t      m_bitsWritten = 0;
+    };
+
+    class BitReader
+    {
+    public:
+        BitReader(const byte_t* data, size_t size);
+        explicit BitReader(const ByteBufferView& view); // Starts at the view's read cursor
+
+        uint64_t ReadBits(uint32_t bitCount);              // bitCount in [0, 64]
+        bool     ReadBool();
+        void     AlignToByte();                            // Skips the padding of a partial byte
+
+        size_t GetBitPosition()   const { return m_bitPosition; }
+        size_t GetConsumedBytes() const { return (m_bitPosition + 7) / 8; }
+        size_t GetRemainingBits() const { return m_size * 8 - m_bitPosition; }
+
+    private:
+        const byte_t* m_data        = nullptr;
+        size_t        m_size        = 0;
+        size_t        m_bitPosition = 0;
+    };
+} // namespace enigma::core
@@ -0,0 +1,117 @@
+#include "Engine/Core/Buffer/BufferEncoding.hpp"
+
+#include <cstring>
+
+#if defined(__SSSE3__) || defined(__AVX__)
+#include <tmmintrin.h>
+#define ENIGMA_BUFFER_SWAP_SSSE3 1
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define ENIGMA_BUFFER_SWAP_SSE2 1
+#endif
+
+namespace enigma::core::detail
+{
+    namespace
+    {
+        template <typename T>
+        void SwapScalar(byte_t* destination, const byte_t* source, size_t count)
+        {
+            for (size_t index = 0; index < count; ++index)
+            {
+                T value;
+                std::memcpy(&value, source + index * sizeof(T), sizeof(T));
+                value = ByteSwap(value);
+                std::memcpy(destination + index * sizeof(T), &value, sizeof(T));
+            }
+        }
+
+#if defined(ENIGMA_BUFFER_SWAP_SSSE3)
+        // One pshufb per 16 bytes reverses every element in the register
+        template <typename T>
+        size_t SwapVector(byte_t* destination, const byte_t* source, size_t count)
+        {
+            __m128i mask;
+            if constexpr (sizeof(T) == 2) mask = _mm_setr_epi8(1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15, 14);
+            else if constexpr (sizeof(T) == 4) mask = _mm_setr_epi8(3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12);
+            else mask = _mm_setr_epi8(7, 6, 5, 4, 3, 2, 1, 0, 15, 14, 13, 12, 11, 10, 9, 8);
+
+            const size_t perBlock = 16 / sizeof(T);
+            const size_t blocks   = count / perBlock;
+            for (size_t block = 0; block < blocks; ++block)
+            {
+                __m128i data = _mm_loadu_si128(reinterpret_cast<const __m128i*>(source + block * 16));
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(destination + block * 16), _mm_shuffle_epi8(data, mask));
+            }
+            return blocks * perBlock;
+        }
+#elif defined(ENIGMA_BUFFER_SWAP_SSE2)
+        // SSE2 has no byte shuffle: swap bytes inside 16-bit lanes, then reorder the lanes
+        template <typename T>
+        size_t SwapVector(byte_t* destination, const byte_t* source, size_t count)
+        {
+            const size_t perBlock = 16 / sizeof(T);
+            const size_t blocks   = count / perBlock;
+            for (size_t block = 0; block < blocks; ++block)
+            {
+                __m128i data = _mm_loadu_si128(reinterpret_cast<const __m128i*>(source + block * 16));
+                data         = _mm_or_si128(_mm_slli_epi16(data, 8), _mm_srli_epi16(data, 8));
+                if constexpr (sizeof(T) == 4)
+                {
+                    data = _mm_shufflehi_epi16(_mm_shufflelo_epi16(data, _MM_SHUFFLE(2, 3, 0, 1)), _MM_SHUFFLE(2, 3, 0, 1));
+                }
+                else if constexpr (sizeof(T) == 8)
+                {
+                    data = _mm_shufflehi_epi16(_mm_shufflelo_epi16(data, _MM_SHUFFLE(0, 1, 2, 3)), _MM_SHUFFLE(0, 1, 2, 3));
+                }
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(destination + block * 16), data);
+            }
+            return blocks * perBlock;
+        }
+#else
+        template <typename T>
+        size_t SwapVector(byte_t*, const byte_t*, size_t)
+        {
+            return 0;
+        }
+#endif
+
+        template <typename T>
+        void SwapElements(byte_t* destination, const byte_t* source, size_t count)
+        {
+            size_t done = SwapVector<T>(destination, source, count);
+            SwapScalar<T>(destination + done * sizeof(T), source + done * sizeof(T), count - done);
+        }
+    }
+
+    void CopyElements(void* destination, const void* source, size_t count, size_t elementSize, bool swap)
+    {
+        auto*       out = static_cast<byte_t*>(destination);
+        const auto* in  = static_cast<const byte_t*>(source);
+        if (!swap || elementSize == 1)
+        {
+            std::memcpy(out, in, count * elementSize);
+            return;
+        }
+
+        switch (elementSize)
+        {
+        case 2: SwapElements<uint16_t>(out, in, count);
+            break;
+        case 4: SwapElements<uint32_t>(out, in, count);
+            break;
+        case 8: SwapElements<uint64_t>(out, in, count);
+            break;
+        default:
+            // Generic fallback for unusual element sizes
+            for (size_t index = 0; index < count; ++index)
+            {
+                for (size_t byte = 0; byte < elementSize; ++byte)
+                {
+                    out[index * elementSize + byte] = in[index * elementSize + elementSize - 1 - byte];
+                }
+            }
+            break;
+        }
+    }
+} // namespace enigma::core::detail
@@ -0,0 +1,107 @@
+#pragma once
+//-----------------------------------------------------------------------------------------------
+// BufferEncoding.hpp
+//
+// Encoding helpers shared by ByteBuffer, ByteBufferView and BitWriter/BitReader:
+//   - LEB128 varints (7 payload bits per byte, high bit = continuation)
+//   - ZigZag mapping so small negative numbers stay short as varints
+//   - Bulk element copies with optional byte swap (SSSE3 / SSE2 when available)
+//-----------------------------------------------------------------------------------------------
+
+#include "Engine/Core/Buffer/Endian.hpp"
+
+#include <cstddef>
+#include <cstdint>
+
+namespace enigma::core
+{
+    using byte_t = uint8_t;
+
+    constexpr size_t kMaxVarInt32Bytes = 5;
+    constexpr size_t kMaxVarInt64Bytes = 10;
+
+    enum class VarIntDecodeStatus : uint8_t
+    {
+        Ok,
+        Truncated, // Ran out of bytes before the terminating byte
+        Overlong // More bytes than the target width allows, or value out of range
+    };
+
+    namespace detail
+    {
+        constexpr uint32_t ZigZagEncode32(int32_t value)
+        {
+            return (static_cast<uint32_t>(value) << 1) ^ static_cast<uint32_t>(value >> 31);
+        }
+
+        constexpr int32_t ZigZagDecode32(uint32_t value)
+        {
+            return static_cast<int32_t>((value >> 1) ^ (~(value & 1) + 1));
+        }
+
+        constexpr uint64_t ZigZagEncode64(int64_t value)
+        {
+            return (static_cast<uint64_t>(value) << 1) ^ static_cast<uint64_t>(value >> 63);
+        }
+
+        constexpr int64_t ZigZagDecode64(uint64_t value)
+        {
+            return static_cast<int64_t>((value >> 1) ^ (~(value & 1) + 1));
+        }
+
+        // Writes at most kMaxVarInt64Bytes bytes, returns the encoded length
+        inline size_t EncodeVarUInt(uint64_t value, byte_t* out)
+        {
+            size_t length = 0;
+            while (value >= 0x80)
+            {
+                out[length++] = static_cast<byte_t>(value | 0x80);
+                value >>= 7;
+            }
+            out[length++] = static_cast<byte_t>(value);
+            return length;
+        }
+
+        constexpr size_t GetVarUIntSize(uint64_t value)
+        {
+            size_t length = 1;
+            while (value >= 0x80)
+            {
+                value >>= 7;
+                ++length;
+            }
+            return length;
+        }
+
+        // Decodes a varint of at most maxBytes bytes whose value must not exceed maxValue
+        inline VarIntDecodeStatus DecodeVarUInt(const byte_t* data, size_t available, size_t maxBytes, uint64_t maxValue,
+                                                uint64_t& outValue, size_t& outLength)
+        {
+            uint64_t result = 0;
+            for (size_t index = 0; index < maxBytes; ++index)
+            {
+                if (index >= available)
+                {
+                    return VarIntDecodeStatus::Truncated;
+                }
+                byte_t current = data[index];
+                result |= static_cast<uint64_t>(current & 0x7F) << (7 * index);
+                if ((current & 0x80) == 0)
+                {
+                    // The last byte of a 10-byte varint may only carry the top bit of a uint64
+                    if (result > maxValue || (index == kMaxVarInt64Bytes - 1 && current > 1))
+                    {
+                        return VarIntDecodeStatus::Overlong;
+                    }
+                    outValue  = result;
+                    outLength = index + 1;
+                    return VarIntDecodeStatus::Ok;
+                }
+            }
+            return VarIntDecodeStatus::Overlong;
+        }
+
+        // Copies count elements of elementSize bytes, reversing each element's bytes when swap is set
+        void CopyElements(void* destination, const void* source, size_t count, size_t elementSize, bool swap);
+    } // namespace detail
+} // namespace enigma::core
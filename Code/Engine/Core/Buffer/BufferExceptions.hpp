@@ -7,6 +7,7 @@
 // | Exception Type              | Base Class            | Error Macro       | Description                    |
 // |-----------------------------|-----------------------|-------------------|--------------------------------|
 // | BufferUnderflowException    | std::out_of_range     | ERROR_RECOVERABLE | ByteBuffer read beyond end     |
+// | BufferFormatException       | std::runtime_error    | ERROR_RECOVERABLE | Malformed encoded data         |
 // | FileIOException             | std::runtime_error    | ERROR_RECOVERABLE | File read/write failure        |
 //
 // Usage Pattern (Exception + Error Macro two-phase):
@@ -60,6 +61,29 @@ namespace enigma::core
         }
     };
 
+    //-------------------------------------------------------------------------------------------
+    // BufferFormatException
+    // Thrown when encoded data is structurally invalid (e.g. an overlong varint).
+    //
+    // Carries the cursor position where decoding failed.
+    //
+    // Mapping: ERROR_RECOVERABLE (reject the message, caller decides recovery)
+    //-------------------------------------------------------------------------------------------
+    class BufferFormatException : public std::runtime_error
+    {
+    public:
+        BufferFormatException(size_t cursor, const std::string& reason)
+            : std::runtime_error("BufferFormat error at cursor " + std::to_string(cursor) + ": " + reason)
+            , m_cursor(cursor)
+        {
+        }
+
+        size_t GetCursor() const { return m_cursor; }
+
+    private:
+        size_t m_cursor;
+    };
+
     //-------------------------------------------------------------------------------------------
     // FileIOException
     // Thrown when a file read or write operation fails.
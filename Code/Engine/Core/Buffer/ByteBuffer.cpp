@@ -1,6 +1,7 @@
 #include "Engine/Core/Buffer/ByteBuffer.hpp"
 
 #include <algorithm>
+#include <limits>
 
 namespace enigma::core
 {
@@ -95,6 +96,57 @@ namespace enigma::core
     float    ByteBuffer::ReadFloat()         { return readFloating<float>(); }
     double   ByteBuffer::ReadDouble()        { return readFloating<double>(); }
 
+    //===========================================================================================
+    // Variable-Length Integers
+    //===========================================================================================
+
+    void ByteBuffer::WriteVarUnsignedInt(uint32_t value)
+    {
+        WriteVarUnsignedLong(value);
+    }
+
+    void ByteBuffer::WriteVarUnsignedLong(uint64_t value)
+    {
+        if (value < 0x80)
+        {
+            m_data.push_back(static_cast<byte_t>(value));
+            return;
+        }
+        byte_t encoded[kMaxVarInt64Bytes];
+        size_t length = detail::EncodeVarUInt(value, encoded);
+        m_data.insert(m_data.end(), encoded, encoded + length);
+    }
+
+    void ByteBuffer::WriteVarInt(int32_t value)
+    {
+        WriteVarUnsignedLong(detail::ZigZagEncode32(value));
+    }
+
+    void ByteBuffer::WriteVarLong(int64_t value)
+    {
+        WriteVarUnsignedLong(detail::ZigZagEncode64(value));
+    }
+
+    uint32_t ByteBuffer::ReadVarUnsignedInt()
+    {
+        return static_cast<uint32_t>(readVarUInt(kMaxVarInt32Bytes, std::numeric_limits<uint32_t>::max()));
+    }
+
+    uint64_t ByteBuffer::ReadVarUnsignedLong()
+    {
+        return readVarUInt(kMaxVarInt64Bytes, std::numeric_limits<uint64_t>::max());
+    }
+
+    int32_t ByteBuffer::ReadVarInt()
+    {
+        return detail::ZigZagDecode32(ReadVarUnsignedInt());
+    }
+
+    int64_t ByteBuffer::ReadVarLong()
+    {
+        return detail::ZigZagDecode64(ReadVarUnsignedLong());
+    }
+
     //===========================================================================================
     // String Operations
     //===========================================================================================
@@ -179,6 +231,25 @@ namespace enigma::core
         m_readCursor += count;
     }
 
+    //===========================================================================================
+    // In-Place Encoding
+    //===========================================================================================
+
+    byte_t* ByteBuffer::ReserveAndGetWritePtr(size_t maxBytes)
+    {
+        m_reservedOffset = m_data.size();
+        return appendUninitialized(maxBytes);
+    }
+
+    void ByteBuffer::CommitReservedWrite(size_t usedBytes)
+    {
+        if (m_reservedOffset == kNoReservation)
+            return;
+        if (m_reservedOffset + usedBytes < m_data.size())
+            m_data.resize(m_reservedOffset + usedBytes);
+        m_reservedOffset = kNoReservation;
+    }
+
     //===========================================================================================
     // Cursor & State
     //===========================================================================================
@@ -204,7 +275,8 @@ namespace enigma::core
     void ByteBuffer::Clear()
     {
         m_data.clear();
-        m_readCursor = 0;
+        m_readCursor     = 0;
+        m_reservedOffset = kNoReservation;
     }
 
     void ByteBuffer::Compact()
@@ -268,10 +340,18 @@ namespace enigma::core
     {
         ByteArray result = std::move(m_data);
         m_data.clear();
-        m_readCursor = 0;
+        m_readCursor     = 0;
+        m_reservedOffset = kNoReservation;
         return result;
     }
 
+    ByteBufferView ByteBuffer::AsView() const
+    {
+        ByteBufferView view(m_data.data(), m_data.size(), m_byteOrder);
+        view.Seek(m_readCursor);
+        return view;
+    }
+
     //===========================================================================================
     // Internal
     //===========================================================================================
@@ -281,4 +361,33 @@ namespace enigma::core
         if (m_readCursor + bytes > m_data.size())
             throw BufferUnderflowException(m_readCursor, m_data.size(), bytes);
     }
+
+    byte_t* ByteBuffer::appendUninitialized(size_t bytes)
+    {
+        // ByteArray's allocator default-initializes, so this grows without zero-filling the tail
+        size_t offset = m_data.size();
+        m_data.resize(offset + bytes);
+        return m_data.data() + offset;
+    }
+
+    bool ByteBuffer::needsByteSwap() const
+    {
+        return ResolveByteOrder(m_byteOrder) != NativeByteOrder();
+    }
+
+    uint64_t ByteBuffer::readVarUInt(size_t maxBytes, uint64_t maxValue)
+    {
+        uint64_t value  = 0;
+        size_t   length = 0;
+        switch (detail::DecodeVarUInt(m_data.data() + m_readCursor, m_data.size() - m_readCursor, maxBytes, maxValue, value, length))
+        {
+        case VarIntDecodeStatus::Ok:
+            m_readCursor += length;
+            return value;
+        case VarIntDecodeStatus::Truncated:
+            throw BufferUnderflowException(m_readCursor, m_data.size(), m_data.size() - m_readCursor + 1);
+        default:
+            throw BufferFormatException(m_readCursor, "varint exceeds " + std::to_string(maxBytes) + " bytes");
+        }
+    }
 } // namespace enigma::core
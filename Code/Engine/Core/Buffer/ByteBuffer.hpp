@@ -6,24 +6,69 @@
 // Write cursor is implicit (m_data.size()), read cursor is explicit (m_readCursor).
 // All multi-byte operations respect the configured ByteOrder.
 //
+// Bulk paths: WriteArray/ReadArrayInto copy whole arrays with one memcpy (or one vectorized
+// byte-swap pass) instead of per-element writes; ReserveAndGetWritePtr lets encoders write in
+// place; AsView() exposes the readable bytes as a non-owning ByteBufferView.
+//
 // Move-only: copy disabled, use Clone() for explicit deep copy.
 //-----------------------------------------------------------------------------------------------
 
 #include "Engine/Core/Buffer/Endian.hpp"
+#include "Engine/Core/Buffer/BufferEncoding.hpp"
 #include "Engine/Core/Buffer/BufferExceptions.hpp"
+#include "Engine/Core/Buffer/ByteBufferView.hpp"
 
 #include <cstdint>
 #include <cstring>
+#include <memory>
+#include <new>
 #include <optional>
 #include <string>
 #include <string_view>
 #include <type_traits>
+#include <utility>
 #include <vector>
 
 namespace enigma::core
 {
+    // Allocator whose value-less construct() default-initializes instead of value-initializing,
+    // so resize() on a vector of trivial elements grows without zero-filling the new tail.
+    // Every other construct() forwards to the wrapped allocator unchanged.
+    template<typename T, typename Base = std::allocator<T>>
+    class DefaultInitAllocator : public Base
+    {
+        using BaseTraits = std::allocator_traits<Base>;
+
+    public:
+        template<typename U>
+        struct rebind
+        {
+            using other = DefaultInitAllocator<U, typename BaseTraits::template rebind_alloc<U>>;
+        };
+
+        DefaultInitAllocator() noexcept = default;
+
+        template<typename U, typename OtherBase>
+        DefaultInitAllocator(const DefaultInitAllocator<U, OtherBase>& other) noexcept
+            : Base(static_cast<const OtherBase&>(other))
+        {
+        }
+
+        template<typename U>
+        void construct(U* ptr) noexcept(std::is_nothrow_default_constructible_v<U>)
+        {
+            ::new (static_cast<void*>(ptr)) U;
+        }
+
+        template<typename U, typename... Args>
+        void construct(U* ptr, Args&&... args)
+        {
+            BaseTraits::construct(static_cast<Base&>(*this), ptr, std::forward<Args>(args)...);
+        }
+    };
+
     using byte_t    = uint8_t;
-    using ByteArray = std::vector<byte_t>;
+    using ByteArray = std::vector<byte_t, DefaultInitAllocator<byte_t>>; // resize() leaves new bytes uninitialized
 
     // Forward declaration for BufferSerializable traits
     template<typename T, typename = void>
@@ -70,6 +115,16 @@ namespace enigma::core
         float    ReadFloat();
         double   ReadDouble();
 
+        //=== Variable-Length Integers (LEB128, signed variants ZigZag-mapped) ===
+        void     WriteVarUnsignedInt(uint32_t value);
+        void     WriteVarUnsignedLong(uint64_t value);
+        void     WriteVarInt(int32_t value);
+        void     WriteVarLong(int64_t value);
+        uint32_t ReadVarUnsignedInt();
+        uint64_t ReadVarUnsignedLong();
+        int32_t  ReadVarInt();
+        int64_t  ReadVarLong();
+
         //=== String Operations ===
         void        WriteString(std::string_view str);              // uint32 length + UTF-8
         void        WriteShortString(std::string_view str);         // uint16 length + UTF-8
@@ -88,6 +143,16 @@ namespace enigma::core
         template<typename T> void WriteRaw(const T& value);
         template<typename T> T    ReadRaw();
 
+        //=== Bulk Arrays (memcpy when ByteOrder matches native, vectorized byte swap otherwise) ===
+        template<typename T> void WriteArray(const T* values, size_t count);
+        template<typename T> void ReadArrayInto(T* dest, size_t count);
+
+        //=== In-Place Encoding ===
+        // Appends maxBytes writable bytes and returns a pointer to them. The pointer is invalidated
+        // by the next write. CommitReservedWrite(used) trims the unused tail of the reservation.
+        byte_t* ReserveAndGetWritePtr(size_t maxBytes);
+        void    CommitReservedWrite(size_t usedBytes);
+
         //=== Generic Traits Interface (semi-primitive types) ===
         template<typename T> void Write(const T& value);
         template<typename T> T    Read();
@@ -118,13 +183,20 @@ namespace enigma::core
         const byte_t*    Data()      const;
         const ByteArray& GetBuffer() const;
         ByteArray        Release();
+        ByteBufferView   AsView()    const;     // Readable bytes, invalidated by writes
 
     private:
         ByteArray m_data;
         size_t    m_readCursor = 0;
         ByteOrder m_byteOrder;
+        size_t    m_reservedOffset = kNoReservation;
 
-        void ensureReadable(size_t bytes) const;
+        static constexpr size_t kNoReservation = static_cast<size_t>(-1);
+
+        void     ensureReadable(size_t bytes) const;
+        byte_t*  appendUninitialized(size_t bytes);
+        bool     needsByteSwap() const;
+        uint64_t readVarUInt(size_t maxBytes, uint64_t maxValue);
 
         template<typename T> void writeIntegral(T value);
         template<typename T> void writeFloating(T value);
@@ -155,6 +227,26 @@ namespace enigma::core
         return value;
     }
 
+    template<typename T>
+    void ByteBuffer::WriteArray(const T* values, size_t count)
+    {
+        static_assert(std::is_arithmetic_v<T>, "WriteArray only supports arithmetic types");
+        if (count == 0)
+            return;
+        detail::CopyElements(appendUninitialized(count * sizeof(T)), values, count, sizeof(T), needsByteSwap());
+    }
+
+    template<typename T>
+    void ByteBuffer::ReadArrayInto(T* dest, size_t count)
+    {
+        static_assert(std::is_arithmetic_v<T>, "ReadArrayInto only supports arithmetic types");
+        if (count > m_data.size() / sizeof(T))
+            throw BufferUnderflowException(m_readCursor, m_data.size(), count * sizeof(T));
+        ensureReadable(count * sizeof(T));
+        detail::CopyElements(dest, m_data.data() + m_readCursor, count, sizeof(T), needsByteSwap());
+        m_readCursor += count * sizeof(T);
+    }
+
     template<typename T>
     void ByteBuffer::Write(const T& value)
     {
@@ -0,0 +1,219 @@
+#include "Engine/Core/Buffer/ByteBufferView.hpp"
+
+#include <limits>
+
+namespace enigma::core
+{
+    ByteBufferView::ByteBufferView(const byte_t* data, size_t size, ByteOrder order)
+        : m_data(data)
+        , m_size(size)
+        , m_byteOrder(order)
+    {
+    }
+
+    //===========================================================================================
+    // Primitive Reads
+    //===========================================================================================
+
+    bool ByteBufferView::ReadBool()
+    {
+        ensureReadable(1);
+        return m_data[m_readCursor++] != 0;
+    }
+
+    byte_t ByteBufferView::ReadByte()
+    {
+        ensureReadable(1);
+        return m_data[m_readCursor++];
+    }
+
+    int8_t ByteBufferView::ReadSignedByte()
+    {
+        ensureReadable(1);
+        return static_cast<int8_t>(m_data[m_readCursor++]);
+    }
+
+    int16_t  ByteBufferView::ReadShort()         { return readIntegral<int16_t>(); }
+    uint16_t ByteBufferView::ReadUnsignedShort() { return readIntegral<uint16_t>(); }
+    int32_t  ByteBufferView::ReadInt()           { return readIntegral<int32_t>(); }
+    uint32_t ByteBufferView::ReadUnsignedInt()   { return readIntegral<uint32_t>(); }
+    int64_t  ByteBufferView::ReadLong()          { return readIntegral<int64_t>(); }
+    uint64_t ByteBufferView::ReadUnsignedLong()  { return readIntegral<uint64_t>(); }
+    float    ByteBufferView::ReadFloat()         { return readIntegral<float>(); }
+    double   ByteBufferView::ReadDouble()        { return readIntegral<double>(); }
+
+    //===========================================================================================
+    // Variable-Length Integers
+    //===========================================================================================
+
+    uint32_t ByteBufferView::ReadVarUnsignedInt()
+    {
+        return static_cast<uint32_t>(readVarUInt(kMaxVarInt32Bytes, std::numeric_limits<uint32_t>::max()));
+    }
+
+    uint64_t ByteBufferView::ReadVarUnsignedLong()
+    {
+        return readVarUInt(kMaxVarInt64Bytes, std::numeric_limits<uint64_t>::max());
+    }
+
+    int32_t ByteBufferView::ReadVarInt()
+    {
+        return detail::ZigZagDecode32(ReadVarUnsignedInt());
+    }
+
+    int64_t ByteBufferView::ReadVarLong()
+    {
+        return detail::ZigZagDecode64(ReadVarUnsignedLong());
+    }
+
+    //===========================================================================================
+    // String Operations
+    //===========================================================================================
+
+    std::string ByteBufferView::ReadString()
+    {
+        return std::string(ReadStringView());
+    }
+
+    std::string ByteBufferView::ReadShortString()
+    {
+        uint16_t length = ReadUnsignedShort();
+        ensureReadable(length);
+        std::string result(reinterpret_cast<const char*>(m_data + m_readCursor), length);
+        m_readCursor += length;
+        return result;
+    }
+
+    std::string ByteBufferView::ReadNullTerminatedString()
+    {
+        const void* terminator = std::memchr(m_data + m_readCursor, 0, m_size - m_readCursor);
+        if (!terminator)
+            throw BufferUnderflowException(m_size, m_size, 1);
+
+        size_t      length = static_cast<const byte_t*>(terminator) - (m_data + m_readCursor);
+        std::string result(reinterpret_cast<const char*>(m_data + m_readCursor), length);
+        m_readCursor += length + 1;
+        return result;
+    }
+
+    std::string_view ByteBufferView::ReadStringView()
+    {
+        uint32_t length = ReadUnsignedInt();
+        ensureReadable(length);
+        std::string_view result(reinterpret_cast<const char*>(m_data + m_readCursor), length);
+        m_readCursor += length;
+        return result;
+    }
+
+    //===========================================================================================
+    // Raw Bytes
+    //===========================================================================================
+
+    void ByteBufferView::ReadRawBytesInto(void* dest, size_t count)
+    {
+        ensureReadable(count);
+        std::memcpy(dest, m_data + m_readCursor, count);
+        m_readCursor += count;
+    }
+
+    ByteBufferView ByteBufferView::ReadSlice(size_t count)
+    {
+        ensureReadable(count);
+        ByteBufferView slice(m_data + m_readCursor, count, m_byteOrder);
+        m_readCursor += count;
+        return slice;
+    }
+
+    //===========================================================================================
+    // Cursor & State
+    //===========================================================================================
+
+    void ByteBufferView::Skip(size_t bytes)
+    {
+        ensureReadable(bytes);
+        m_readCursor += bytes;
+    }
+
+    void ByteBufferView::Rewind()
+    {
+        m_readCursor = 0;
+    }
+
+    void ByteBufferView::Seek(size_t position)
+    {
+        if (position > m_size)
+            throw BufferUnderflowException(position, m_size, 0);
+        m_readCursor = position;
+    }
+
+    size_t ByteBufferView::ReadableBytes() const
+    {
+        return m_size - m_readCursor;
+    }
+
+    size_t ByteBufferView::Size() const
+    {
+        return m_size;
+    }
+
+    size_t ByteBufferView::GetReadCursor() const
+    {
+        return m_readCursor;
+    }
+
+    bool ByteBufferView::HasRemaining() const
+    {
+        return m_readCursor < m_size;
+    }
+
+    bool ByteBufferView::HasRemaining(size_t n) const
+    {
+        return (m_readCursor + n) <= m_size;
+    }
+
+    ByteOrder ByteBufferView::GetByteOrder() const
+    {
+        return m_byteOrder;
+    }
+
+    void ByteBufferView::SetByteOrder(ByteOrder order)
+    {
+        m_byteOrder = order;
+    }
+
+    const byte_t* ByteBufferView::Data() const
+    {
+        return m_data;
+    }
+
+    const byte_t* ByteBufferView::ReadData() const
+    {
+        return m_data + m_readCursor;
+    }
+
+    //===========================================================================================
+    // Internal
+    //===========================================================================================
+
+    void ByteBufferView::ensureReadable(size_t bytes) const
+    {
+        if (bytes > m_size - m_readCursor)
+            throw BufferUnderflowException(m_readCursor, m_size, bytes);
+    }
+
+    uint64_t ByteBufferView::readVarUInt(size_t maxBytes, uint64_t maxValue)
+    {
+        uint64_t value  = 0;
+        size_t   length = 0;
+        switch (detail::DecodeVarUInt(m_data + m_readCursor, m_size - m_readCursor, maxBytes, maxValue, value, length))
+        {
+        case VarIntDecodeStatus::Ok:
+            m_readCursor += length;
+            return value;
+        case VarIntDecodeStatus::Truncated:
+            throw BufferUnderflowException(m_readCursor, m_size, m_size - m_readCursor + 1);
+        default:
+            throw BufferFormatException(m_readCursor, "varint exceeds " + std::to_string(maxBytes) + " bytes");
+        }
+    }
+} // namespace enigma::core
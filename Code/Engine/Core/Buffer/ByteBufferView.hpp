@@ -0,0 +1,143 @@
+#pragma once
+//-----------------------------------------------------------------------------------------------
+// ByteBufferView.hpp
+//
+// Non-owning, read-only counterpart of ByteBuffer. Reads straight from memory owned elsewhere
+// (memory-mapped files, network receive rings, another ByteBuffer) without copying it.
+// Mirrors ByteBuffer's read API, byte order handling and exceptions.
+//
+// The viewed memory must outlive the view and must not change while it is being read.
+//-----------------------------------------------------------------------------------------------
+
+#include "Engine/Core/Buffer/BufferEncoding.hpp"
+#include "Engine/Core/Buffer/BufferExceptions.hpp"
+#include "Engine/Core/Buffer/Endian.hpp"
+
+#include <cstdint>
+#include <cstring>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+namespace enigma::core
+{
+    class ByteBufferView
+    {
+    public:
+        ByteBufferView() = default;
+        ByteBufferView(const byte_t* data, size_t size, ByteOrder order = ByteOrder::Big);
+
+        //=== Primitive Type Reads (from m_readCursor, advances cursor) ===
+        bool     ReadBool();
+        byte_t   ReadByte();
+        int8_t   ReadSignedByte();
+        int16_t  ReadShort();
+        uint16_t ReadUnsignedShort();
+        int32_t  ReadInt();
+        uint32_t ReadUnsignedInt();
+        int64_t  ReadLong();
+        uint64_t ReadUnsignedLong();
+        float    ReadFloat();
+        double   ReadDouble();
+
+        //=== Variable-Length Integers (LEB128, signed variants ZigZag-mapped) ===
+        uint32_t ReadVarUnsignedInt();
+        uint64_t ReadVarUnsignedLong();
+        int32_t  ReadVarInt();
+        int64_t  ReadVarLong();
+
+        //=== String Operations ===
+        std::string      ReadString();              // uint32 length + UTF-8
+        std::string      ReadShortString();         // uint16 length + UTF-8
+        std::string      ReadNullTerminatedString();// content + 0x00
+        std::string_view ReadStringView();          // uint32 length + UTF-8, points into the view
+
+        //=== Raw Bytes ===
+        void           ReadRawBytesInto(void* dest, size_t count);
+        ByteBufferView ReadSlice(size_t count);     // Sub-view over the next count bytes
+
+        //=== Raw Trivially-Copyable / Bulk Arrays ===
+        template<typename T> T    ReadRaw();
+        template<typename T> void ReadArrayInto(T* dest, size_t count);
+
+        //=== Peek (preview without advancing cursor) ===
+        template<typename T>
+        [[nodiscard]] std::optional<T> Peek() const;
+
+        //=== Cursor & State ===
+        void   Skip(size_t bytes);
+        void   Rewind();
+        void   Seek(size_t position);
+        size_t ReadableBytes()  const;
+        size_t Size()           const;
+        size_t GetReadCursor()  const;
+        bool   HasRemaining()   const;
+        bool   HasRemaining(size_t n) const;
+        ByteOrder GetByteOrder() const;
+        void   SetByteOrder(ByteOrder order);
+
+        //=== Data Access ===
+        const byte_t* Data()      const;            // Start of the view
+        const byte_t* ReadData()  const;            // Current read position
+
+    private:
+        const byte_t* m_data       = nullptr;
+        size_t        m_size       = 0;
+        size_t        m_readCursor = 0;
+        ByteOrder     m_byteOrder  = ByteOrder::Big;
+
+        void     ensureReadable(size_t bytes) const;
+        uint64_t readVarUInt(size_t maxBytes, uint64_t maxValue);
+
+        template<typename T> T readIntegral();
+    };
+
+    //===========================================================================================
+    // Template implementations (must be in header)
+    //===========================================================================================
+
+    template<typename T>
+    T ByteBufferView::ReadRaw()
+    {
+        static_assert(std::is_trivially_copyable_v<T>, "ReadRaw requires trivially copyable type");
+        ensureReadable(sizeof(T));
+        T value;
+        std::memcpy(&value, m_data + m_readCursor, sizeof(T));
+        m_readCursor += sizeof(T);
+        return value;
+    }
+
+    template<typename T>
+    void ByteBufferView::ReadArrayInto(T* dest, size_t count)
+    {
+        static_assert(std::is_arithmetic_v<T>, "ReadArrayInto only supports arithmetic types");
+        if (count > m_size / sizeof(T))
+            throw BufferUnderflowException(m_readCursor, m_size, count * sizeof(T));
+        ensureReadable(count * sizeof(T));
+        detail::CopyElements(dest, m_data + m_readCursor, count, sizeof(T), ResolveByteOrder(m_byteOrder) != NativeByteOrder());
+        m_readCursor += count * sizeof(T);
+    }
+
+    template<typename T>
+    std::optional<T> ByteBufferView::Peek() const
+    {
+        if (m_readCursor + sizeof(T) > m_size)
+            return std::nullopt;
+
+        T value;
+        std::memcpy(&value, m_data + m_readCursor, sizeof(T));
+        value = ToByteOrder(value, m_byteOrder);
+        return value;
+    }
+
+    template<typename T>
+    T ByteBufferView::readIntegral()
+    {
+        ensureReadable(sizeof(T));
+        T value;
+        std::memcpy(&value, m_data + m_readCursor, sizeof(T));
+        m_readCursor += sizeof(T);
+        return ToByteOrder(value, m_byteOrder);
+    }
+} // namespace enigma::core
@@ -8,3 +8,10 @@
 #if defined(_DEBUG) && !defined(ENGINE_DEBUG_RENDER)
 #define ENGINE_DEBUG_RENDER
 #endif
+
+// Instrumentation zones (ENGINE_PROFILE_SCOPE, see Core/Profiler/Profiler.hpp).
+// Recording is still off until Profiler::SetRecording(true); define ENGINE_DISABLE_PROFILING
+// to compile the macros out entirely.
+#if !defined(ENGINE_DISABLE_PROFILING) && !defined(ENGINE_PROFILING)
+#define ENGINE_PROFILING
+#endif
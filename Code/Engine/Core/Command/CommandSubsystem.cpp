@@ -1,4 +1,5 @@
 #include "CommandSubsystem.hpp"
+#include "../Profiler/Profiler.hpp"
 #include <algorithm>
 #include <sstream>
 #include <cctype>
@@ -285,6 +286,13 @@ namespace enigma::core
             [this](const CommandArgs& args) { return ExecuteClear(args); },
             "Clear command history",
             "clear_history");
+
+        // Profiler capture command
+        RegisterCommand(
+            "profile",
+            [this](const CommandArgs& args) { return ExecuteProfile(args); },
+            "Control profiler capture and export a Chrome trace",
+            "profile <start|stop|clear|dump> [path]");
     }
 
     CommandResult CommandSubsystem::ExecuteHelp(const CommandArgs& args)
@@ -362,6 +370,44 @@ namespace enigma::core
         return CommandResult::Success("Command history cleared.");
     }
 
+    CommandResult CommandSubsystem::ExecuteProfile(const CommandArgs& args)
+    {
+        const std::string action = ToLower(args.GetPositional<std::string>(0, "dump"));
+
+        if (action == "start")
+        {
+            Profiler::Clear();
+            Profiler::SetRecording(true);
+            return CommandResult::Success("Profiler recording started.");
+        }
+        if (action == "stop")
+        {
+            Profiler::SetRecording(false);
+            return CommandResult::Success("Profiler recording stopped.");
+        }
+        if (action == "clear")
+        {
+            Profiler::Clear();
+            return CommandResult::Success("Profiler buffers cleared.");
+        }
+        if (action == "dump")
+        {
+            const std::string path = args.GetPositional<std::string>(1, ".enigma/logs/profile.json");
+            if (!Profiler::ExportChromeTrace(path))
+            {
+                return CommandResult::Error("Failed to write profiler trace: " + path);
+            }
+
+            ProfilerStats     stats = Profiler::GetStats();
+            std::stringstream ss;
+            ss << "Profiler trace written to " << path << " (" << stats.recordedEvents - stats.droppedEvents
+                << " events, " << stats.threadCount << " threads, " << stats.droppedEvents << " dropped)";
+            return CommandResult::Success(ss.str());
+        }
+
+        return CommandResult::Error("Unknown profile action: " + action, "Usage: profile <start|stop|clear|dump> [path]");
+    }
+
     // ============================================================================
     // Utility functions
     // ============================================================================
@@ -137,6 +137,7 @@ namespace enigma::core
         CommandResult ExecuteHelp(const CommandArgs& args);
         CommandResult ExecuteHistory(const CommandArgs& args);
         CommandResult ExecuteClear(const CommandArgs& args);
+        CommandResult ExecuteProfile(const CommandArgs& args);
 
         // String utility for case-insensitive comparison
         std::string ToLower(const std::string& str) const;
@@ -5,6 +5,7 @@
 #include "../Resource/ResourceSubsystem.hpp"
 #include "Logger/LoggerSubsystem.hpp"
 #include "Console/ConsoleSubsystem.hpp"
+#include "Profiler/Profiler.hpp"
 enigma::core::Engine* g_theEngine = nullptr;
 
 namespace enigma::core
@@ -61,6 +62,7 @@ namespace enigma::core
 
     void Engine::BeginFrame()
     {
+        ENGINE_PROFILE_FRAME();
         m_subsystemManager->BeginFrameAllSubsystems();
     }
 
@@ -5,24 +5,27 @@
 // Part of Event System
 // ============================================================================
 
+#include <atomic>
 #include <cstddef>
 #include <type_traits>
 
 namespace enigma::event
 {
-    /// Event type ID generator (compile-time unique IDs)
+    /// Event type ID generator (dense, process-unique IDs starting at 0)
+    /// IDs index EventBus listener tables directly; generation is thread-safe so
+    /// worker threads may be the first to touch an event type
     class EventTypeIdGenerator
     {
     public:
         template <typename T>
         static size_t GetId()
         {
-            static const size_t id = s_nextId++;
+            static const size_t id = s_nextId.fetch_add(1, std::memory_order_relaxed);
             return id;
         }
 
     private:
-        static inline size_t s_nextId = 0;
+        static inline std::atomic<size_t> s_nextId{0};
     };
 
     /// Event base class
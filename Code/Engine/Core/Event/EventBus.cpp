@@ -14,63 +14,232 @@ namespace enigma::event
     DEFINE_LOG_CATEGORY(LogEvent);
 
     EventBus::EventBus()
+        : m_ownerThread(std::this_thread::get_id())
     {
+        for (auto& slot : m_listeners)
+        {
+            slot.store(nullptr, std::memory_order_relaxed);
+        }
         LogInfo(LogEvent, "EventBus::Create Event bus created");
     }
 
     EventBus::~EventBus()
     {
-        if (!m_shutdown)
+        if (!IsShutdown())
         {
             Shutdown();
         }
+        DestroyDeferred();
+
+        // No Post can still be running once the owner destroys the bus
+        for (const ListenerList* list : m_retiredLists)
+        {
+            delete list;
+        }
+    }
+
+    ListenerHandle EventBus::AddListenerImpl(size_t typeId, ListenerCallback&& callback,
+                                             EventPriority priority, bool receiveCancelled)
+    {
+        if (typeId >= MAX_EVENT_TYPES)
+        {
+            LogError(LogEvent, "EventBus::AddListener Event type id %zu exceeds MAX_EVENT_TYPES (%zu)", typeId, MAX_EVENT_TYPES);
+            return INVALID_LISTENER_HANDLE;
+        }
+
+        std::lock_guard<std::mutex> lock(m_writeMutex);
+        if (IsShutdown())
+            return INVALID_LISTENER_HANDLE;
+
+        const ListenerList* current = m_listeners[typeId].load(std::memory_order_relaxed);
+        auto*               updated = current ? new ListenerList(*current) : new ListenerList();
+
+        // Insert after every listener of equal or higher priority (stable order, no re-sort)
+        auto position = std::upper_bound(updated->begin(), updated->end(), priority,
+                                         [](EventPriority value, const ListenerWrapper& w)
+                                         {
+                                             return static_cast<uint8_t>(value) < static_cast<uint8_t>(w.priority);
+                                         });
+
+        const ListenerHandle handle = m_nextHandle++;
+        updated->insert(position, ListenerWrapper{std::move(callback), handle, priority, receiveCancelled});
+        m_handleTypes.emplace(handle, typeId);
+
+        PublishLocked(typeId, updated);
+        return handle;
     }
 
     bool EventBus::RemoveListener(ListenerHandle handle)
     {
-        if (m_shutdown)
+        if (IsShutdown())
             return false;
 
-        for (auto& pair : m_listeners)
+        std::lock_guard<std::mutex> lock(m_writeMutex);
+
+        auto typeIt = m_handleTypes.find(handle);
+        if (typeIt == m_handleTypes.end())
         {
-            ListenerList& listeners = pair.second;
-            auto          it        = std::find_if(listeners.begin(), listeners.end(),
-                                   [handle](const ListenerWrapper& w) { return w.handle == handle; });
+            LogWarn(LogEvent, "EventBus::RemoveListener Handle %llu not found", handle);
+            return false;
+        }
+
+        const size_t        typeId  = typeIt->second;
+        const ListenerList* current = m_listeners[typeId].load(std::memory_order_relaxed);
+        m_handleTypes.erase(typeIt);
 
-            if (it != listeners.end())
+        ListenerList* updated = nullptr;
+        if (current && current->size() > 1)
+        {
+            updated = new ListenerList();
+            updated->reserve(current->size() - 1);
+            for (const ListenerWrapper& wrapper : *current)
             {
-                listeners.erase(it);
-                LogDebug(LogEvent, "EventBus::RemoveListener Removed listener handle %llu", handle);
-                return true;
+                if (wrapper.handle != handle)
+                    updated->push_back(wrapper);
             }
         }
 
-        LogWarn(LogEvent, "EventBus::RemoveListener Handle %llu not found", handle);
-        return false;
+        PublishLocked(typeId, updated);
+        LogDebug(LogEvent, "EventBus::RemoveListener Removed listener handle %llu", handle);
+        return true;
+    }
+
+    size_t EventBus::DispatchDeferred(size_t maxEvents)
+    {
+        ASSERT_OR_DIE(std::this_thread::get_id() == m_ownerThread,
+                      "EventBus::DispatchDeferred called off the owning thread");
+
+        ReclaimRetired();
+
+        // Move everything published so far behind the undelivered remainder
+        DeferredEvent* stack = m_deferredHead.exchange(nullptr, std::memory_order_acquire);
+        DeferredEvent* batchHead = nullptr;
+        DeferredEvent* batchTail = stack;
+        while (stack)
+        {
+            DeferredEvent* next = stack->next;
+            stack->next         = batchHead;
+            batchHead           = stack;
+            stack               = next;
+        }
+        if (batchHead)
+        {
+            if (m_drainTail)
+                m_drainTail->next = batchHead;
+            else
+                m_drainHead = batchHead;
+            m_drainTail = batchTail;
+        }
+
+        size_t dispatched = 0;
+        while (m_drainHead && dispatched < maxEvents)
+        {
+            std::unique_ptr<DeferredEvent> node(m_drainHead);
+            m_drainHead = node->next;
+            if (!m_drainHead)
+                m_drainTail = nullptr;
+            m_deferredCount.fetch_sub(1, std::memory_order_relaxed);
+
+            node->Dispatch(*this);
+            ++dispatched;
+        }
+        return dispatched;
     }
 
     void EventBus::Clear()
     {
-        m_listeners.clear();
+        std::lock_guard<std::mutex> lock(m_writeMutex);
+        for (size_t typeId = 0; typeId < MAX_EVENT_TYPES; ++typeId)
+        {
+            if (m_listeners[typeId].load(std::memory_order_relaxed))
+                PublishLocked(typeId, nullptr);
+        }
+        m_handleTypes.clear();
         LogInfo(LogEvent, "EventBus::Clear All listeners cleared");
     }
 
     void EventBus::Shutdown()
     {
-        if (m_shutdown)
+        if (m_shutdown.exchange(true, std::memory_order_acq_rel))
             return;
 
-        m_shutdown = true;
         Clear();
+        DestroyDeferred();
         LogInfo(LogEvent, "EventBus::Shutdown Event bus shutdown complete");
     }
 
-    void EventBus::SortListeners(ListenerList& listeners)
+    void EventBus::ClearListenersImpl(size_t typeId)
     {
-        std::stable_sort(listeners.begin(), listeners.end(),
-                         [](const ListenerWrapper& a, const ListenerWrapper& b)
-                         {
-                             return static_cast<uint8_t>(a.priority) < static_cast<uint8_t>(b.priority);
-                         });
+        if (typeId >= MAX_EVENT_TYPES)
+            return;
+
+        std::lock_guard<std::mutex> lock(m_writeMutex);
+        for (auto it = m_handleTypes.begin(); it != m_handleTypes.end();)
+        {
+            it = it->second == typeId ? m_handleTypes.erase(it) : std::next(it);
+        }
+        PublishLocked(typeId, nullptr);
+    }
+
+    void EventBus::PublishLocked(size_t typeId, ListenerList* list)
+    {
+        const ListenerList* previous = m_listeners[typeId].exchange(list, std::memory_order_acq_rel);
+        if (previous)
+            m_retiredLists.push_back(previous);
+        ReclaimRetiredLocked();
+    }
+
+    void EventBus::ReclaimRetiredLocked()
+    {
+        // Only Post on the owning thread reads lists; outside of any Post it holds
+        // no list pointer and every later load observes the replacement
+        if (m_retiredLists.empty() || std::this_thread::get_id() != m_ownerThread || m_dispatchDepth != 0)
+            return;
+
+        for (const ListenerList* list : m_retiredLists)
+        {
+            delete list;
+        }
+        m_retiredLists.clear();
+    }
+
+    void EventBus::ReclaimRetired()
+    {
+        std::lock_guard<std::mutex> lock(m_writeMutex);
+        ReclaimRetiredLocked();
+    }
+
+    void EventBus::ReportTypeIdOverflow(size_t typeId, const char* eventName) const
+    {
+        LogError(LogEvent, "EventBus::Post Event '%s' has type id %zu, exceeds MAX_EVENT_TYPES (%zu); it is never delivered",
+                 eventName ? eventName : "<unnamed>", typeId, MAX_EVENT_TYPES);
+    }
+
+    void EventBus::PushDeferred(DeferredEvent* node)
+    {
+        m_deferredCount.fetch_add(1, std::memory_order_relaxed);
+        node->next = m_deferredHead.load(std::memory_order_relaxed);
+        while (!m_deferredHead.compare_exchange_weak(node->next, node,
+                                                     std::memory_order_release,
+                                                     std::memory_order_relaxed))
+        {
+        }
+    }
+
+    void EventBus::DestroyDeferred()
+    {
+        DeferredEvent* stack = m_deferredHead.exchange(nullptr, std::memory_order_acquire);
+        for (DeferredEvent* list : {m_drainHead, stack})
+        {
+            while (list)
+            {
+                DeferredEvent* next = list->next;
+                delete list;
+                list = next;
+                m_deferredCount.fetch_sub(1, std::memory_order_relaxed);
+            }
+        }
+        m_drainHead = nullptr;
+        m_drainTail = nullptr;
     }
 } // namespace enigma::event
@@ -8,7 +8,13 @@
 #include "Event.hpp"
 #include "EventPriority.hpp"
 #include "EventCommon.hpp"
-#include <functional>
+#include "InlineDelegate.hpp"
+#include "Engine/Core/ErrorWarningAssert.hpp"
+#include <array>
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <thread>
 #include <vector>
 #include <unordered_map>
 #include <algorithm>
@@ -20,6 +26,22 @@ namespace enigma::event
     using ListenerHandle = uint64_t;
 
     /// Event bus - type-safe event dispatching with priority
+    ///
+    /// Dispatch path:
+    /// - Listener lists live in a flat table indexed by the dense event type ID
+    /// - Callbacks are InlineDelegates (no std::function, no per-listener heap block)
+    /// - Lists are copy-on-write: Add/RemoveListener publish a new immutable list,
+    ///   so Post never takes a lock and listeners may be added from any thread or
+    ///   from inside a callback. Replaced lists are freed by the owning thread
+    ///   once it is outside every Post (next registration or DispatchDeferred)
+    ///
+    /// Threading:
+    /// - Post/DispatchDeferred run on the owning thread (the constructing thread);
+    ///   asserted, since the dispatch depth that guards list reclamation is not atomic.
+    ///   Worker threads use Enqueue instead
+    /// - AddListener/RemoveListener/ClearListeners are thread-safe
+    /// - Enqueue is thread-safe (multi-producer); queued events are delivered in
+    ///   FIFO order per producer by DispatchDeferred on the owning thread
     class EventBus
     {
     public:
@@ -68,6 +90,20 @@ namespace enigma::event
         template <typename TEvent>
         bool Post(TEvent&& event);
 
+        /// Queue an event for DispatchDeferred (safe from any thread)
+        /// @return false if the bus is shutdown
+        template <typename TEvent>
+        bool Enqueue(TEvent&& event);
+
+        /// Deliver queued events on the owning thread
+        /// Events enqueued while draining wait for the next call
+        /// @param maxEvents Upper bound for this call, the rest stays queued
+        /// @return Number of events delivered
+        size_t DispatchDeferred(size_t maxEvents = SIZE_MAX);
+
+        /// Approximate number of queued events
+        size_t GetDeferredCount() const { return m_deferredCount.load(std::memory_order_relaxed); }
+
         // ========================================================================
         // Management
         // ========================================================================
@@ -83,24 +119,87 @@ namespace enigma::event
         void Shutdown();
 
         /// Check if shutdown
-        bool IsShutdown() const { return m_shutdown; }
+        bool IsShutdown() const { return m_shutdown.load(std::memory_order_acquire); }
 
     private:
+        using ListenerCallback = InlineDelegate<void(Event&)>;
+
         struct ListenerWrapper
         {
-            ListenerHandle              handle;
-            std::function<void(Event&)> callback;
-            EventPriority               priority;
-            bool                        receiveCancelled;
+            ListenerCallback callback;
+            ListenerHandle   handle;
+            EventPriority    priority;
+            bool             receiveCancelled;
         };
 
+        /// Immutable once published to m_listeners
         using ListenerList = std::vector<ListenerWrapper>;
 
-        void SortListeners(ListenerList& listeners);
+        /// Intrusive node of the deferred MPSC queue
+        struct DeferredEvent
+        {
+            DeferredEvent* next = nullptr;
+
+            virtual ~DeferredEvent()              = default;
+            virtual void Dispatch(EventBus& bus) = 0;
+        };
+
+        template <typename TEvent>
+        struct DeferredEventOf final : DeferredEvent
+        {
+            TEvent event;
+
+            template <typename U>
+            explicit DeferredEventOf(U&& e)
+                : event(std::forward<U>(e))
+            {
+            }
+
+            void Dispatch(EventBus& bus) override { bus.Post(event); }
+        };
+
+        /// Tracks Post nesting on the owning thread (retired lists stay alive while > 0)
+        struct DispatchScope
+        {
+            uint32_t& depth;
+
+            explicit DispatchScope(uint32_t& dispatchDepth)
+                : depth(dispatchDepth)
+            {
+                ++depth;
+            }
 
-        std::unordered_map<size_t, ListenerList> m_listeners;
-        ListenerHandle                           m_nextHandle = 1;
-        bool                                     m_shutdown   = false;
+            ~DispatchScope() { --depth; }
+        };
+
+        ListenerHandle AddListenerImpl(size_t typeId, ListenerCallback&& callback,
+                                       EventPriority priority, bool receiveCancelled);
+        void ClearListenersImpl(size_t typeId);
+        void PublishLocked(size_t typeId, ListenerList* list);
+        void ReclaimRetiredLocked();
+        void ReclaimRetired();
+        void PushDeferred(DeferredEvent* node);
+        void DestroyDeferred();
+        void ReportTypeIdOverflow(size_t typeId, const char* eventName) const;
+
+        // Flat listener table: one atomic list pointer per event type ID
+        std::array<std::atomic<const ListenerList*>, MAX_EVENT_TYPES> m_listeners;
+        std::atomic<bool>                                           m_shutdown{false};
+        std::thread::id                                             m_ownerThread;
+        uint32_t                                                    m_dispatchDepth = 0; // Owning thread only
+
+        // Writer state (guarded by m_writeMutex)
+        std::mutex                                 m_writeMutex;
+        std::vector<const ListenerList*>           m_retiredLists;
+        std::unordered_map<ListenerHandle, size_t> m_handleTypes;
+        ListenerHandle                             m_nextHandle = 1;
+
+        // Deferred queue: producers push onto m_deferredHead (LIFO), the owning
+        // thread moves batches into the FIFO m_drainHead..m_drainTail
+        std::atomic<DeferredEvent*> m_deferredHead{nullptr};
+        std::atomic<size_t>         m_deferredCount{0};
+        DeferredEvent*              m_drainHead = nullptr;
+        DeferredEvent*              m_drainTail = nullptr;
     };
 
     // ============================================================================
@@ -115,25 +214,16 @@ namespace enigma::event
         static_assert(std::is_base_of_v<Event, TEvent>,
                       "TEvent must derive from Event");
 
-        if (m_shutdown)
+        if (IsShutdown())
             return INVALID_LISTENER_HANDLE;
 
         const size_t typeId = EventTypeIdGenerator::GetId<TEvent>();
 
-        ListenerWrapper wrapper;
-        wrapper.handle   = m_nextHandle++;
-        wrapper.callback = [cb = std::forward<F>(callback)](Event& e)
+        ListenerCallback wrapped([cb = std::forward<F>(callback)](Event& e) mutable
         {
             cb(static_cast<TEvent&>(e));
-        };
-        wrapper.priority         = priority;
-        wrapper.receiveCancelled = receiveCancelled;
-
-        auto& listeners = m_listeners[typeId];
-        listeners.push_back(std::move(wrapper));
-        SortListeners(listeners);
-
-        return wrapper.handle;
+        });
+        return AddListenerImpl(typeId, std::move(wrapped), priority, receiveCancelled);
     }
 
     template <typename TEvent, typename T, typename Method>
@@ -160,18 +250,33 @@ namespace enigma::event
         static_assert(std::is_base_of_v<Event, TEvent>,
                       "TEvent must derive from Event");
 
-        if (m_shutdown)
+        ASSERT_OR_DIE(std::this_thread::get_id() == m_ownerThread,
+                      "EventBus::Post called off the owning thread, use Enqueue from worker threads");
+
+        if (m_shutdown.load(std::memory_order_relaxed))
             return false;
 
         const size_t typeId = EventTypeIdGenerator::GetId<TEvent>();
+        if (typeId >= MAX_EVENT_TYPES)
+        {
+            // No listener can exist for this type (AddListener rejects it too); report once per type
+            static bool s_overflowReported = false;
+            if (!s_overflowReported)
+            {
+                s_overflowReported = true;
+                ReportTypeIdOverflow(typeId, event.GetEventName());
+            }
+            return false;
+        }
 
-        auto it = m_listeners.find(typeId);
-        if (it == m_listeners.end())
+        DispatchScope       scope(m_dispatchDepth);
+        const ListenerList* listeners = m_listeners[typeId].load(std::memory_order_acquire);
+        if (listeners == nullptr)
             return false;
 
         bool cancelled = false;
 
-        for (const auto& wrapper : it->second)
+        for (const auto& wrapper : *listeners)
         {
             // Check cancellation for ICancellableEvent
             if constexpr (std::is_base_of_v<ICancellableEvent, TEvent>)
@@ -196,10 +301,23 @@ namespace enigma::event
         return Post(static_cast<TEvent&>(event));
     }
 
+    template <typename TEvent>
+    bool EventBus::Enqueue(TEvent&& event)
+    {
+        using EventType = std::decay_t<TEvent>;
+        static_assert(std::is_base_of_v<Event, EventType>,
+                      "TEvent must derive from Event");
+
+        if (IsShutdown())
+            return false;
+
+        PushDeferred(new DeferredEventOf<EventType>(std::forward<TEvent>(event)));
+        return true;
+    }
+
     template <typename TEvent>
     void EventBus::ClearListeners()
     {
-        const size_t typeId = EventTypeIdGenerator::GetId<TEvent>();
-        m_listeners.erase(typeId);
+        ClearListenersImpl(EventTypeIdGenerator::GetId<TEvent>());
     }
 } // namespace enigma::event
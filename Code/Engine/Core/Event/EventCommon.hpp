@@ -6,6 +6,7 @@
 // ============================================================================
 
 #include "Engine/Core/LogCategory/LogCategory.hpp"
+#include <cstddef>
 #include <cstdint>
 
 // ========================================================================
@@ -30,4 +31,10 @@ namespace enigma::event
 
     // Maximum event recursion depth (prevent infinite loops)
     constexpr uint32_t MAX_EVENT_RECURSION_DEPTH = 16;
+
+    // Capacity of the per-bus listener table indexed by dense event type ID
+    constexpr size_t MAX_EVENT_TYPES = 512;
+
+    // Deferred events drained per EventSubsystem::BeginFrame (0 = unlimited)
+    constexpr uint32_t DEFAULT_DEFERRED_EVENTS_PER_FRAME = 0;
 } // namespace enigma::event
@@ -44,6 +44,21 @@ namespace enigma::event
         LogInfo(LogEvent, "EventSubsystem::Startup ModBus, GameBus, and StringBus created");
     }
 
+    void EventSubsystem::BeginFrame()
+    {
+        const size_t maxEvents = m_config.maxDeferredEventsPerFrame == 0
+                                     ? SIZE_MAX
+                                     : static_cast<size_t>(m_config.maxDeferredEventsPerFrame);
+        if (m_modBus)
+        {
+            m_modBus->DispatchDeferred(maxEvents);
+        }
+        if (m_gameBus)
+        {
+            m_gameBus->DispatchDeferred(maxEvents);
+        }
+    }
+
     void EventSubsystem::Shutdown()
     {
         LogInfo(LogEvent, "EventSubsystem::Shutdown Shutting down event subsystem...");
@@ -22,6 +22,9 @@ namespace enigma::event
     {
         // Reserved for future configuration options
         uint32_t initialListenerCapacity = DEFAULT_LISTENER_CAPACITY;
+
+        // Deferred (cross-thread) events delivered per bus each BeginFrame, 0 = all queued
+        uint32_t maxDeferredEventsPerFrame = DEFAULT_DEFERRED_EVENTS_PER_FRAME;
     };
 
     //-----------------------------------------------------------------------------------------------
@@ -48,6 +51,9 @@ namespace enigma::event
     //   
     //   // Type-safe events
     //   eventSubsystem->GetModBus().Post(MyEvent{});
+    //
+    //   // From a worker thread: delivered on the main thread in BeginFrame()
+    //   eventSubsystem->EnqueueToGameBus(ChunkMeshedEvent{...});
     //   
     //   // String-based events (console commands, input)
     //   eventSubsystem->GetStringBus().Subscribe("KeyPressed", OnKeyPressed);
@@ -68,6 +74,7 @@ namespace enigma::event
         // EngineSubsystem Interface
         void Startup() override;
         void Shutdown() override;
+        void BeginFrame() override; // Drains deferred events queued by worker threads
 
         //-------------------------------------------------------------------------------------------
         // Type-Safe Event Bus Access
@@ -107,6 +114,13 @@ namespace enigma::event
             return m_gameBus->Post(std::forward<TEvent>(event));
         }
 
+        /// Queue event for GameBus from any thread; delivered in the next BeginFrame
+        template <typename TEvent>
+        bool EnqueueToGameBus(TEvent&& event)
+        {
+            return m_gameBus && m_gameBus->Enqueue(std::forward<TEvent>(event));
+        }
+
         //-------------------------------------------------------------------------------------------
         // Convenience Methods - String Events (Legacy EventSystem compatibility)
         //-------------------------------------------------------------------------------------------
@@ -0,0 +1,220 @@
+#pragma once
+
+// ============================================================================
+// InlineDelegate.hpp - Small-buffer callable wrapper
+// Part of Event System
+// Stores callables up to Capacity bytes inline (no heap allocation) and
+// dispatches through a static ops table instead of std::function
+// ============================================================================
+
+#include <cstddef>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace enigma::event
+{
+    /// Default inline capacity: enough for a lambda capturing a few pointers
+    /// or a (instance, member function pointer) pair. Keeps an EventBus
+    /// listener entry within one 64-byte cache line
+    constexpr size_t INLINE_DELEGATE_CAPACITY = 32;
+
+    /// Copyable callable wrapper with small-buffer storage
+    /// Callables larger than Capacity (or aligned beyond a pointer) fall back to a heap copy
+    /// @tparam Signature Function signature (e.g., void(Event&))
+    template <typename Signature, size_t Capacity = INLINE_DELEGATE_CAPACITY>
+    class InlineDelegate;
+
+    template <typename R, typename... Args, size_t Capacity>
+    class InlineDelegate<R(Args...), Capacity>
+    {
+    public:
+        /// True when F is stored inline without allocation
+        template <typename F>
+        static constexpr bool FitsInline = sizeof(F) <= Capacity &&
+            alignof(F) <= alignof(void*) &&
+            std::is_nothrow_move_constructible_v<F>;
+
+        InlineDelegate() = default;
+
+        template <typename F, typename = std::enable_if_t<!std::is_same_v<std::decay_t<F>, InlineDelegate>>>
+        InlineDelegate(F&& func)
+        {
+            Bind(std::forward<F>(func));
+        }
+
+        ~InlineDelegate()
+        {
+            Unbind();
+        }
+
+        InlineDelegate(const InlineDelegate& other)
+        {
+            if (other.m_ops)
+            {
+                other.m_ops->copy(m_storage, other.m_storage);
+                m_ops    = other.m_ops;
+                m_invoke = other.m_invoke;
+            }
+        }
+
+        InlineDelegate(InlineDelegate&& other) noexcept
+        {
+            if (other.m_ops)
+            {
+                other.m_ops->move(m_storage, other.m_storage);
+                m_ops          = other.m_ops;
+                m_invoke       = other.m_invoke;
+                other.m_ops    = nullptr;
+                other.m_invoke = nullptr;
+            }
+        }
+
+        InlineDelegate& operator=(const InlineDelegate& other)
+        {
+            if (this != &other)
+            {
+                InlineDelegate copy(other);
+                *this = std::move(copy);
+            }
+            return *this;
+        }
+
+        InlineDelegate& operator=(InlineDelegate&& other) noexcept
+        {
+            if (this != &other)
+            {
+                Unbind();
+                if (other.m_ops)
+                {
+                    other.m_ops->move(m_storage, other.m_storage);
+                    m_ops          = other.m_ops;
+                    m_invoke       = other.m_invoke;
+                    other.m_ops    = nullptr;
+                    other.m_invoke = nullptr;
+                }
+            }
+            return *this;
+        }
+
+        // ========================================================================
+        // Binding Methods
+        // ========================================================================
+
+        /// Bind a callable (lambda, function pointer, functor)
+        template <typename F>
+        void Bind(F&& func)
+        {
+            using Callable = std::decay_t<F>;
+            Unbind();
+            if constexpr (FitsInline<Callable>)
+            {
+                ::new(static_cast<void*>(m_storage)) Callable(std::forward<F>(func));
+                m_ops    = &InlineOps<Callable>::kOps;
+                m_invoke = &InlineOps<Callable>::Invoke;
+            }
+            else
+            {
+                *reinterpret_cast<Callable**>(m_storage) = new Callable(std::forward<F>(func));
+                m_ops    = &HeapOps<Callable>::kOps;
+                m_invoke = &HeapOps<Callable>::Invoke;
+            }
+        }
+
+        /// Unbind the current callback
+        void Unbind()
+        {
+            if (m_ops)
+            {
+                m_ops->destroy(m_storage);
+                m_ops    = nullptr;
+                m_invoke = nullptr;
+            }
+        }
+
+        // ========================================================================
+        // Query / Execution
+        // ========================================================================
+
+        bool IsBound() const { return m_ops != nullptr; }
+
+        explicit operator bool() const { return IsBound(); }
+
+        /// Invoke the bound callable (must be bound)
+        R operator()(Args... args) const
+        {
+            return m_invoke(const_cast<unsigned char*>(m_storage), std::forward<Args>(args)...);
+        }
+
+    private:
+        using InvokeFn = R (*)(void* storage, Args&&... args);
+
+        /// Lifetime management; invoke is cached in m_invoke to save an indirection per call
+        struct Ops
+        {
+            void (*copy)(void* dst, const void* src);
+            void (*move)(void* dst, void* src) noexcept;
+            void (*destroy)(void* storage) noexcept;
+        };
+
+        template <typename F>
+        struct InlineOps
+        {
+            static R Invoke(void* storage, Args&&... args)
+            {
+                return (*static_cast<F*>(storage))(std::forward<Args>(args)...);
+            }
+
+            static void Copy(void* dst, const void* src)
+            {
+                ::new(dst) F(*static_cast<const F*>(src));
+            }
+
+            static void Move(void* dst, void* src) noexcept
+            {
+                ::new(dst) F(std::move(*static_cast<F*>(src)));
+                static_cast<F*>(src)->~F();
+            }
+
+            static void Destroy(void* storage) noexcept
+            {
+                static_cast<F*>(storage)->~F();
+            }
+
+            static constexpr Ops kOps = {&Copy, &Move, &Destroy};
+        };
+
+        template <typename F>
+        struct HeapOps
+        {
+            static F*& Pointer(void* storage) { return *static_cast<F**>(storage); }
+
+            static R Invoke(void* storage, Args&&... args)
+            {
+                return (*Pointer(storage))(std::forward<Args>(args)...);
+            }
+
+            static void Copy(void* dst, const void* src)
+            {
+                *static_cast<F**>(dst) = new F(**static_cast<F* const*>(src));
+            }
+
+            static void Move(void* dst, void* src) noexcept
+            {
+                Pointer(dst) = Pointer(src);
+                Pointer(src) = nullptr;
+            }
+
+            static void Destroy(void* storage) noexcept
+            {
+                delete Pointer(storage);
+            }
+
+            static constexpr Ops kOps = {&Copy, &Move, &Destroy};
+        };
+
+        alignas(void*) unsigned char m_storage[Capacity < sizeof(void*) ? sizeof(void*) : Capacity];
+        InvokeFn                     m_invoke = nullptr;
+        const Ops*                   m_ops    = nullptr;
+    };
+} // namespace enigma::event
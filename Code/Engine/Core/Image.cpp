@@ -65,6 +65,11 @@ const  void* Image::GetRawData() const
     return m_rgbaTexels.data();
 }
 
+void* Image::GetRawData()
+{
+    return m_rgbaTexels.data();
+}
+
 Rgba8 Image::GetTexelColor(const IntVec2& texelCoords) const
 {
     return m_rgbaTexels[texelCoords.y * m_dimensions.x + texelCoords.x];
@@ -0,0 +1,49 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+
+namespace enigma::core
+{
+    /**
+     * @brief Read-only memory mapping of a whole file
+     *
+     * Lets loaders decode straight from the OS page cache instead of copying the
+     * file into a heap buffer first. The mapping stays valid until Close() or
+     * destruction; empty files cannot be mapped and fail Open().
+     *
+     * Windows uses CreateFileMapping/MapViewOfFile, other platforms mmap.
+     */
+    class MappedFile
+    {
+    public:
+        MappedFile() = default;
+        ~MappedFile();
+
+        MappedFile(const MappedFile&)            = delete;
+        MappedFile& operator=(const MappedFile&) = delete;
+        MappedFile(MappedFile&& other) noexcept;
+        MappedFile& operator=(MappedFile&& other) noexcept;
+
+        /// Maps the file read-only, closing any previous mapping. False if missing, empty or unmappable
+        bool Open(const std::filesystem::path& path);
+        void Close();
+
+        bool           IsOpen() const { return m_data != nullptr; }
+        const uint8_t* GetData() const { return m_data; }
+        size_t         GetSize() const { return m_size; }
+
+        /// Asks the OS to fault the mapped pages in ahead of the first access
+        void Prefetch() const;
+
+        /// Starts asynchronous readahead of a file into the page cache without keeping it mapped
+        static bool PrefetchFile(const std::filesystem::path& path);
+
+        /// Drops a file's clean pages from the page cache (cold-cache benchmarks); best effort
+        static bool EvictFromPageCache(const std::filesystem::path& path);
+
+    private:
+        const uint8_t* m_data = nullptr;
+        size_t         m_size = 0;
+    };
+}
@@ -0,0 +1,391 @@
+#include "Profiler.hpp"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+namespace enigma::core
+{
+    std::atomic<bool>     Profiler::s_recording{false};
+    std::atomic<uint64_t> Profiler::s_frameIndex{0};
+
+    namespace
+    {
+        // ========================================================================
+        // Per-thread ring buffer
+        // ========================================================================
+
+        /// Written only by its owning thread; head is published with release so the
+        /// exporter can read every slot below it. Old slots are overwritten when the
+        /// ring wraps, and the exporter drops any slot that may have been rewritten
+        /// while it was copying.
+        struct ThreadBuffer
+        {
+            std::vector<ProfileEvent> events;
+            uint64_t                  mask = 0;
+            std::atomic<uint64_t>     head{0}; // Total events written
+            std::atomic<uint64_t>     clearedAt{0}; // head value at the last Clear()
+            uint32_t                  threadIndex = 0;
+            std::string               threadName; // Guarded by ProfilerRegistry::mutex
+        };
+
+        struct ProfilerRegistry
+        {
+            std::mutex                                mutex;
+            std::vector<std::unique_ptr<ThreadBuffer>> buffers;
+            std::vector<std::string>                  names;
+            std::unordered_map<std::string, uint32_t> nameIds;
+            size_t                                    threadCapacity = Profiler::DEFAULT_THREAD_CAPACITY;
+        };
+
+        /// Intentionally leaked: worker threads may still record during static destruction
+        ProfilerRegistry& GetRegistry()
+        {
+            static ProfilerRegistry* registry = new ProfilerRegistry();
+            return *registry;
+        }
+
+        thread_local ThreadBuffer* t_threadBuffer = nullptr;
+        thread_local std::string   t_pendingThreadName;
+
+        ThreadBuffer* CreateThreadBuffer()
+        {
+            ProfilerRegistry& registry = GetRegistry();
+            auto              buffer   = std::make_unique<ThreadBuffer>();
+
+            std::lock_guard<std::mutex> lock(registry.mutex);
+            buffer->events.resize(registry.threadCapacity);
+            buffer->mask        = registry.threadCapacity - 1;
+            buffer->threadIndex = static_cast<uint32_t>(registry.buffers.size()) + 1;
+            buffer->threadName  = t_pendingThreadName.empty()
+                                     ? "Thread " + std::to_string(buffer->threadIndex)
+                                     : t_pendingThreadName;
+            registry.buffers.push_back(std::move(buffer));
+            return registry.buffers.back().get();
+        }
+
+        void PushEvent(ProfileEventType type, uint32_t nameId, uint64_t timestampNs, uint64_t payload)
+        {
+            ThreadBuffer* buffer = t_threadBuffer;
+            if (buffer == nullptr)
+            {
+                buffer         = CreateThreadBuffer();
+                t_threadBuffer = buffer;
+            }
+
+            const uint64_t index = buffer->head.load(std::memory_order_relaxed);
+            ProfileEvent&  event = buffer->events[index & buffer->mask];
+            event.timestampNs    = timestampNs;
+            event.payload        = payload;
+            event.nameId         = nameId;
+            event.type           = type;
+            buffer->head.store(index + 1, std::memory_order_release);
+        }
+
+        /// Copy the live window of a buffer, discarding slots overwritten during the copy
+        std::vector<ProfileEvent> SnapshotBuffer(const ThreadBuffer& buffer)
+        {
+            const uint64_t capacity  = buffer.mask + 1;
+            const uint64_t clearedAt = buffer.clearedAt.load(std::memory_order_acquire);
+            const uint64_t end       = buffer.head.load(std::memory_order_acquire);
+            const uint64_t begin     = (std::max)(clearedAt, end > capacity ? end - capacity : 0);
+
+            std::vector<ProfileEvent> copied;
+            copied.reserve(static_cast<size_t>(end - begin));
+            for (uint64_t i = begin; i < end; ++i)
+            {
+                copied.push_back(buffer.events[i & buffer.mask]);
+            }
+
+            const uint64_t after     = buffer.head.load(std::memory_order_acquire);
+            const uint64_t safeBegin = (std::max)(begin, after > capacity ? after - capacity : 0);
+            if (safeBegin > begin)
+            {
+                const uint64_t torn = (std::min)(safeBegin, end) - begin;
+                copied.erase(copied.begin(), copied.begin() + static_cast<std::ptrdiff_t>(torn));
+            }
+
+            return copied;
+        }
+
+        void AppendJsonString(std::string& out, const std::string& value)
+        {
+            out += '"';
+            for (char c : value)
+            {
+                switch (c)
+                {
+                case '"': out += "\\\"";
+                    break;
+                case '\\': out += "\\\\";
+                    break;
+                case '\n': out += "\\n";
+                    break;
+                case '\t': out += "\\t";
+                    break;
+                default:
+                    if (static_cast<unsigned char>(c) < 0x20)
+                    {
+                        char escaped[8];
+                        std::snprintf(escaped, sizeof(escaped), "\\u%04x", static_cast<unsigned>(c));
+                        out += escaped;
+                    }
+                    else
+                    {
+                        out += c;
+                    }
+                }
+            }
+            out += '"';
+        }
+
+        void AppendMicroseconds(std::string& out, uint64_t nanoseconds)
+        {
+            char text[32];
+            std::snprintf(text, sizeof(text), "%.3f", static_cast<double>(nanoseconds) / 1000.0);
+            out += text;
+        }
+
+        double BitsToDouble(uint64_t bits)
+        {
+            double value;
+            std::memcpy(&value, &bits, sizeof(value));
+            return value;
+        }
+
+        uint64_t DoubleToBits(double value)
+        {
+            uint64_t bits;
+            std::memcpy(&bits, &value, sizeof(bits));
+            return bits;
+        }
+    }
+
+    // ============================================================================
+    // Recording control
+    // ============================================================================
+
+    void Profiler::SetRecording(bool recording)
+    {
+        s_recording.store(recording, std::memory_order_relaxed);
+    }
+
+    void Profiler::Clear()
+    {
+        ProfilerRegistry&           registry = GetRegistry();
+        std::lock_guard<std::mutex> lock(registry.mutex);
+        for (auto& buffer : registry.buffers)
+        {
+            buffer->clearedAt.store(buffer->head.load(std::memory_order_acquire), std::memory_order_release);
+        }
+    }
+
+    void Profiler::SetThreadCapacity(size_t eventCount)
+    {
+        size_t capacity = 64;
+        while (capacity < eventCount)
+        {
+            capacity <<= 1;
+        }
+
+        ProfilerRegistry&           registry = GetRegistry();
+        std::lock_guard<std::mutex> lock(registry.mutex);
+        registry.threadCapacity = capacity;
+    }
+
+    // ============================================================================
+    // Event recording
+    // ============================================================================
+
+    uint32_t Profiler::InternName(const char* name)
+    {
+        return InternName(std::string(name != nullptr ? name : ""));
+    }
+
+    uint32_t Profiler::InternName(const std::string& name)
+    {
+        ProfilerRegistry&           registry = GetRegistry();
+        std::lock_guard<std::mutex> lock(registry.mutex);
+
+        auto it = registry.nameIds.find(name);
+        if (it != registry.nameIds.end())
+        {
+            return it->second;
+        }
+
+        const uint32_t id = static_cast<uint32_t>(registry.names.size());
+        registry.names.push_back(name);
+        registry.nameIds.emplace(name, id);
+        return id;
+    }
+
+    void Profiler::SetThreadName(const std::string& name)
+    {
+        t_pendingThreadName = name;
+        if (t_threadBuffer != nullptr)
+        {
+            ProfilerRegistry&           registry = GetRegistry();
+            std::lock_guard<std::mutex> lock(registry.mutex);
+            t_threadBuffer->threadName = name;
+        }
+    }
+
+    void Profiler::RecordZone(uint32_t nameId, uint64_t beginNs, uint64_t endNs)
+    {
+        PushEvent(ProfileEventType::Zone, nameId, beginNs, endNs - beginNs);
+    }
+
+    void Profiler::RecordCounter(uint32_t nameId, double value)
+    {
+        PushEvent(ProfileEventType::Counter, nameId, NowNs(), DoubleToBits(value));
+    }
+
+    void Profiler::RecordFrame()
+    {
+        const uint64_t frameIndex = s_frameIndex.fetch_add(1, std::memory_order_relaxed);
+        PushEvent(ProfileEventType::Frame, 0, NowNs(), frameIndex);
+    }
+
+    void Profiler::RecordFlowBegin(uint32_t nameId, uint64_t flowId)
+    {
+        PushEvent(ProfileEventType::FlowBegin, nameId, NowNs(), flowId);
+    }
+
+    void Profiler::RecordFlowEnd(uint32_t nameId, uint64_t flowId)
+    {
+        PushEvent(ProfileEventType::FlowEnd, nameId, NowNs(), flowId);
+    }
+
+    // ============================================================================
+    // Export
+    // ============================================================================
+
+    std::string Profiler::BuildChromeTrace()
+    {
+        ProfilerRegistry&           registry = GetRegistry();
+        std::lock_guard<std::mutex> lock(registry.mutex);
+
+        struct ThreadSnapshot
+        {
+            uint32_t                  threadIndex;
+            std::string               threadName;
+            std::vector<ProfileEvent> events;
+        };
+
+        std::vector<ThreadSnapshot> snapshots;
+        snapshots.reserve(registry.buffers.size());
+        uint64_t originNs = UINT64_MAX;
+        for (const auto& buffer : registry.buffers)
+        {
+            ThreadSnapshot snapshot{buffer->threadIndex, buffer->threadName, SnapshotBuffer(*buffer)};
+            for (const ProfileEvent& event : snapshot.events)
+            {
+                originNs = (std::min)(originNs, event.timestampNs);
+            }
+            snapshots.push_back(std::move(snapshot));
+        }
+        if (originNs == UINT64_MAX)
+        {
+            originNs = 0;
+        }
+
+        std::string out;
+        out.reserve(256 + registry.buffers.size() * 128);
+        out += "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n";
+        out += "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":1,\"tid\":0,\"args\":{\"name\":\"Enigma Engine\"}}";
+
+        for (const ThreadSnapshot& snapshot : snapshots)
+        {
+            const std::string tid = std::to_string(snapshot.threadIndex);
+
+            out += ",\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" + tid + ",\"args\":{\"name\":";
+            AppendJsonString(out, snapshot.threadName);
+            out += "}}";
+
+            for (const ProfileEvent& event : snapshot.events)
+            {
+                const std::string& name = event.nameId < registry.names.size() ? registry.names[event.nameId] : std::string();
+
+                out += ",\n{\"name\":";
+                switch (event.type)
+                {
+                case ProfileEventType::Zone:
+                    AppendJsonString(out, name);
+                    out += ",\"cat\":\"engine\",\"ph\":\"X\",\"dur\":";
+                    AppendMicroseconds(out, event.payload);
+                    break;
+                case ProfileEventType::Counter:
+                    AppendJsonString(out, name);
+                    out += ",\"ph\":\"C\",\"args\":{\"value\":";
+                    {
+                        char value[32];
+                        std::snprintf(value, sizeof(value), "%.17g", BitsToDouble(event.payload));
+                        out += value;
+                    }
+                    out += "}";
+                    break;
+                case ProfileEventType::Frame:
+                    out += "\"Frame\",\"cat\":\"frame\",\"ph\":\"i\",\"s\":\"g\",\"args\":{\"frame\":" + std::to_string(event.payload) + "}";
+                    break;
+                case ProfileEventType::FlowBegin:
+                case ProfileEventType::FlowEnd:
+                    AppendJsonString(out, name);
+                    out += ",\"cat\":\"flow\",\"id\":" + std::to_string(event.payload);
+                    out += event.type == ProfileEventType::FlowBegin ? ",\"ph\":\"s\"" : ",\"ph\":\"f\",\"bp\":\"e\"";
+                    break;
+                }
+                out += ",\"ts\":";
+                AppendMicroseconds(out, event.timestampNs - originNs);
+                out += ",\"pid\":1,\"tid\":" + tid + "}";
+            }
+        }
+
+        out += "\n]}\n";
+        return out;
+    }
+
+    bool Profiler::ExportChromeTrace(const std::string& path)
+    {
+        const std::string trace = BuildChromeTrace();
+
+        std::error_code             error;
+        const std::filesystem::path filePath(path);
+        if (filePath.has_parent_path())
+        {
+            std::filesystem::create_directories(filePath.parent_path(), error);
+        }
+
+        std::ofstream file(filePath, std::ios::binary | std::ios::trunc);
+        if (!file)
+        {
+            return false;
+        }
+        file.write(trace.data(), static_cast<std::streamsize>(trace.size()));
+        return static_cast<bool>(file);
+    }
+
+    ProfilerStats Profiler::GetStats()
+    {
+        ProfilerRegistry&           registry = GetRegistry();
+        std::lock_guard<std::mutex> lock(registry.mutex);
+
+        ProfilerStats stats;
+        stats.threadCount = registry.buffers.size();
+        stats.nameCount   = registry.names.size();
+        for (const auto& buffer : registry.buffers)
+        {
+            const uint64_t capacity = buffer->mask + 1;
+            const uint64_t head     = buffer->head.load(std::memory_order_acquire);
+            const uint64_t recorded = head - buffer->clearedAt.load(std::memory_order_acquire);
+            stats.recordedEvents += recorded;
+            stats.droppedEvents += recorded > capacity ? recorded - capacity : 0;
+        }
+        return stats;
+    }
+}
@@ -0,0 +1,197 @@
+#pragma once
+
+// ============================================================================
+// Profiler.hpp - Scoped CPU zones, counters, frame markers and task flows
+// Part of Core
+// ============================================================================
+
+#include "Engine/Core/BuildPreferences.hpp"
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace enigma::core
+{
+    /// Kind of a recorded profiler event
+    enum class ProfileEventType : uint8_t
+    {
+        Zone = 0, // Complete slice: timestamp = begin, payload = duration (ns)
+        Counter, // payload = double value bits
+        Frame, // payload = frame index
+        FlowBegin, // payload = flow id (e.g. TaskHandle::id at submit)
+        FlowEnd // payload = flow id (e.g. TaskHandle::id at execution)
+    };
+
+    /// One fixed-size record in a per-thread buffer
+    struct ProfileEvent
+    {
+        uint64_t         timestampNs = 0; // steady_clock nanoseconds; export rebases to the first event
+        uint64_t         payload     = 0;
+        uint32_t         nameId      = 0; // Index into the interned name table
+        ProfileEventType type        = ProfileEventType::Zone;
+    };
+
+    /// Aggregate figures for diagnostics and tests
+    struct ProfilerStats
+    {
+        size_t   threadCount    = 0;
+        size_t   nameCount      = 0;
+        uint64_t recordedEvents = 0; // Events written since the last Clear()
+        uint64_t droppedEvents  = 0; // Events overwritten before export (ring wrapped)
+    };
+
+    /// Engine-wide instrumentation profiler
+    ///
+    /// Recording path:
+    /// - Every thread writes into its own ring buffer (single producer, no locks)
+    /// - Names are interned once per call site through a function-local static,
+    ///   so hot paths only store a 32-bit id
+    /// - Zones are stored as one complete event (begin + duration) when the scope closes
+    /// - When recording is off a scope costs one relaxed atomic load
+    /// - Defining ENGINE_DISABLE_PROFILING compiles every macro out
+    ///
+    /// Export:
+    /// - ExportChromeTrace() snapshots all buffers and writes Chrome trace_event JSON
+    ///   (open in chrome://tracing or https://ui.perfetto.dev)
+    /// - The "profile" command drives the same calls from the console
+    class Profiler
+    {
+    public:
+        static constexpr size_t DEFAULT_THREAD_CAPACITY = 1u << 15; // Events per thread (power of two)
+
+        // ========================================================================
+        // Recording control
+        // ========================================================================
+
+        static void SetRecording(bool recording);
+        static bool IsRecording() { return s_recording.load(std::memory_order_relaxed); }
+
+        /// Discard everything recorded so far (buffers and names stay registered)
+        static void Clear();
+
+        /// Capacity used for buffers created after this call; rounded up to a power of two
+        static void SetThreadCapacity(size_t eventCount);
+
+        // ========================================================================
+        // Event recording (normally reached through the ENGINE_PROFILE_* macros)
+        // ========================================================================
+
+        /// Return a stable id for name; the same string always yields the same id
+        static uint32_t InternName(const char* name);
+        static uint32_t InternName(const std::string& name);
+
+        /// Label the calling thread in exported traces
+        static void SetThreadName(const std::string& name);
+
+        static void RecordZone(uint32_t nameId, uint64_t beginNs, uint64_t endNs);
+        static void RecordCounter(uint32_t nameId, double value);
+        static void RecordFrame();
+        static void RecordFlowBegin(uint32_t nameId, uint64_t flowId);
+        static void RecordFlowEnd(uint32_t nameId, uint64_t flowId);
+
+        static uint64_t NowNs()
+        {
+            return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                std::chrono::steady_clock::now().time_since_epoch()).count());
+        }
+
+        // ========================================================================
+        // Export
+        // ========================================================================
+
+        /// Build the Chrome trace_event JSON for everything currently buffered
+        static std::string BuildChromeTrace();
+
+        /// Write BuildChromeTrace() to path; returns false if the file cannot be written
+        static bool ExportChromeTrace(const std::string& path);
+
+        static ProfilerStats GetStats();
+        static uint64_t      GetFrameIndex() { return s_frameIndex.load(std::memory_order_relaxed); }
+
+    private:
+        static std::atomic<bool>     s_recording;
+        static std::atomic<uint64_t> s_frameIndex;
+    };
+
+    /// RAII zone: records [construction, destruction) when recording was on at construction
+    class ProfileScope
+    {
+    public:
+        explicit ProfileScope(uint32_t nameId)
+            : m_nameId(nameId)
+              , m_active(Profiler::IsRecording())
+        {
+            if (m_active)
+            {
+                m_beginNs = Profiler::NowNs();
+            }
+        }
+
+        ~ProfileScope()
+        {
+            if (m_active)
+            {
+                Profiler::RecordZone(m_nameId, m_beginNs, Profiler::NowNs());
+            }
+        }
+
+        ProfileScope(const ProfileScope&)            = delete;
+        ProfileScope& operator=(const ProfileScope&) = delete;
+
+    private:
+        uint32_t m_nameId  = 0;
+        bool     m_active  = false;
+        uint64_t m_beginNs = 0;
+    };
+}
+
+// ============================================================================
+// Instrumentation macros
+// ============================================================================
+
+#define ENGINE_PROFILE_CONCAT_INNER(a, b) a##b
+#define ENGINE_PROFILE_CONCAT(a, b) ENGINE_PROFILE_CONCAT_INNER(a, b)
+
+#if defined(ENGINE_PROFILING)
+
+/// Time the enclosing scope under a string-literal name
+#define ENGINE_PROFILE_SCOPE(name) \
+    static const uint32_t ENGINE_PROFILE_CONCAT(s_profileNameId_, __LINE__) = ::enigma::core::Profiler::InternName(name); \
+    ::enigma::core::ProfileScope ENGINE_PROFILE_CONCAT(profileScope_, __LINE__)(ENGINE_PROFILE_CONCAT(s_profileNameId_, __LINE__))
+
+/// Mark the start of a new frame
+#define ENGINE_PROFILE_FRAME() \
+    do { if (::enigma::core::Profiler::IsRecording()) ::enigma::core::Profiler::RecordFrame(); } while (0)
+
+/// Sample a named numeric counter
+#define ENGINE_PROFILE_COUNTER(name, value) \
+    do { if (::enigma::core::Profiler::IsRecording()) { \
+        static const uint32_t s_profileCounterId = ::enigma::core::Profiler::InternName(name); \
+        ::enigma::core::Profiler::RecordCounter(s_profileCounterId, static_cast<double>(value)); } } while (0)
+
+/// Start / finish an arrow between two zones (possibly on different threads) sharing flowId
+#define ENGINE_PROFILE_FLOW_BEGIN(name, flowId) \
+    do { if (::enigma::core::Profiler::IsRecording()) { \
+        static const uint32_t s_profileFlowId = ::enigma::core::Profiler::InternName(name); \
+        ::enigma::core::Profiler::RecordFlowBegin(s_profileFlowId, static_cast<uint64_t>(flowId)); } } while (0)
+
+#define ENGINE_PROFILE_FLOW_END(name, flowId) \
+    do { if (::enigma::core::Profiler::IsRecording()) { \
+        static const uint32_t s_profileFlowId = ::enigma::core::Profiler::InternName(name); \
+        ::enigma::core::Profiler::RecordFlowEnd(s_profileFlowId, static_cast<uint64_t>(flowId)); } } while (0)
+
+/// Label the calling thread in exported traces
+#define ENGINE_PROFILE_THREAD_NAME(name) ::enigma::core::Profiler::SetThreadName(name)
+
+#else
+
+#define ENGINE_PROFILE_SCOPE(name) ((void)0)
+#define ENGINE_PROFILE_FRAME() ((void)0)
+#define ENGINE_PROFILE_COUNTER(name, value) ((void)0)
+#define ENGINE_PROFILE_FLOW_BEGIN(name, flowId) ((void)0)
+#define ENGINE_PROFILE_FLOW_END(name, flowId) ((void)0)
+#define ENGINE_PROFILE_THREAD_NAME(name) ((void)0)
+
+#endif
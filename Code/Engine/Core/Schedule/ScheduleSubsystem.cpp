@@ -4,7 +4,9 @@
 #include "Engine/Core/ErrorWarningAssert.hpp"
 #include "Engine/Core/Yaml.hpp"
 #include "Engine/Core/Logger/LoggerAPI.hpp"
+#include "Engine/Core/Profiler/Profiler.hpp"
 #include <algorithm>
+#include <exception>
 
 using namespace enigma::core;
 DEFINE_LOG_CATEGORY(LogSchedule)
@@ -31,6 +33,21 @@ namespace
         return totalPending;
     }
 
+    int countPendingTasksForPriority(
+        const std::map<std::string, std::map<TaskPriority, std::deque<RunnableTask*>>>& pendingTasksByType,
+        const std::string& typeStr,
+        TaskPriority priority)
+    {
+        const auto typeIt = pendingTasksByType.find(typeStr);
+        if (typeIt == pendingTasksByType.end())
+        {
+            return 0;
+        }
+
+        const auto priorityIt = typeIt->second.find(priority);
+        return priorityIt != typeIt->second.end() ? static_cast<int>(priorityIt->second.size()) : 0;
+    }
+
     int countPendingTasksTotal(
         const std::map<std::string, std::map<TaskPriority, std::deque<RunnableTask*>>>& pendingTasksByType)
     {
@@ -66,11 +83,7 @@ namespace
 
                 if (taskQueue.empty())
                 {
-                    priorityIt = priorityMap.erase(priorityIt);
-                    if (priorityIt == priorityMap.end())
-                    {
-                        break;
-                    }
+                    priorityMap.erase(priorityIt);
                 }
 
                 if (priorityMap.empty())
@@ -115,6 +128,9 @@ void ScheduleConfig::LoadFromYaml(const YamlConfiguration& yaml)
 
         task_types.push_back(def);
     }
+
+    telemetry_enabled              = yaml.GetBoolean("telemetry.enabled", true);
+    telemetry_log_interval_seconds = yaml.GetFloat("telemetry.log_interval_seconds", 0.0f);
 }
 
 //-----------------------------------------------------------------------------------------------
@@ -188,6 +204,10 @@ void ScheduleSubsystem::Startup()
             (int)m_typeRegistry.GetAllTypes().size(),
             m_typeRegistry.GetTotalThreadCount());
 
+    m_telemetry.SetEnabled(m_config.telemetry_enabled);
+    m_telemetry.Reset(ScheduleTelemetry::NowNs());
+    m_telemetryLogIntervalSeconds = m_config.telemetry_log_interval_seconds;
+
     CreateWorkerThreads();
     g_theSchedule = this;
     LogInfo(LogSchedule, "Startup complete");
@@ -206,6 +226,7 @@ void ScheduleSubsystem::Shutdown()
     {
         cvPair.second.notify_all();
     }
+    m_taskFinishedCondition.notify_all();
 
     DestroyWorkerThreads();
 
@@ -240,8 +261,29 @@ void ScheduleSubsystem::Shutdown()
     LogInfo(LogSchedule, "Shutdown complete");
 }
 
+//-----------------------------------------------------------------------------------------------
+// Update: Periodic telemetry dump (schedule.yml telemetry.log_interval_seconds)
+//-----------------------------------------------------------------------------------------------
+void ScheduleSubsystem::Update(float deltaTime)
+{
+    if (m_telemetryLogIntervalSeconds <= 0.0f)
+    {
+        return;
+    }
+
+    m_telemetryLogElapsedSeconds += deltaTime;
+    if (m_telemetryLogElapsedSeconds < m_telemetryLogIntervalSeconds)
+    {
+        return;
+    }
+
+    m_telemetryLogElapsedSeconds = 0.0f;
+    LogInfo(LogSchedule, "%s", GetTelemetrySnapshot().ToString().c_str());
+}
+
 TaskHandle ScheduleSubsystem::SubmitTask(RunnableTask* task, const TaskSubmissionOptions& options)
 {
+    ENGINE_PROFILE_SCOPE("ScheduleSubsystem::SubmitTask");
     if (!task)
     {
         LogError(LogSchedule,
@@ -251,7 +293,8 @@ TaskHandle ScheduleSubsystem::SubmitTask(RunnableTask* task, const TaskSubmissio
 
     std::string taskType = task->GetType();
     TaskHandle  resolvedHandle;
-    bool        shouldNotify = false;
+    bool        shouldNotify        = false;
+    bool        shouldNotifyWaiters = false;
 
     {
         std::lock_guard<std::mutex> lock(m_queueMutex);
@@ -287,6 +330,7 @@ TaskHandle ScheduleSubsystem::SubmitTask(RunnableTask* task, const TaskSubmissio
         controlBlock.version                = options.version;
         controlBlock.keyedPolicy            = options.keyedPolicy;
         controlBlock.policyDecision         = decision.policyDecision;
+        controlBlock.priority               = options.priority;
 
         if (decision.supersededHandle.has_value())
         {
@@ -301,11 +345,21 @@ TaskHandle ScheduleSubsystem::SubmitTask(RunnableTask* task, const TaskSubmissio
             }
         }
 
+        std::deque<RunnableTask*>& pendingQueue = m_pendingTasksByType[taskType][options.priority];
+        pendingQueue.push_back(task);
+
+        if (m_telemetry.IsEnabled())
+        {
+            controlBlock.submitTimeNs = ScheduleTelemetry::NowNs();
+            controlBlock.telemetry    = m_telemetry.GetQueue(taskType, options.priority);
+            m_telemetry.RecordSubmit(controlBlock.telemetry, static_cast<uint32_t>(pendingQueue.size()));
+        }
+
         m_taskControlBlocks[resolvedHandle] = controlBlock;
         m_taskHandleByPointer[task]         = resolvedHandle;
-
-        m_pendingTasksByType[taskType][options.priority].push_back(task);
-        shouldNotify = true;
+        shouldNotify        = true;
+        shouldNotifyWaiters = m_assistingWaiterCount > 0;
+        ENGINE_PROFILE_FLOW_BEGIN("Task", resolvedHandle.id);
 
         LogInfo(LogSchedule,
                 "SubmitTask: Added task type='%s' priority=%d handle=(%llu,%u) pending=%d",
@@ -320,13 +374,17 @@ TaskHandle ScheduleSubsystem::SubmitTask(RunnableTask* task, const TaskSubmissio
     {
         m_typeConditionVariables[taskType].notify_one();
     }
+    if (shouldNotifyWaiters)
+    {
+        m_taskFinishedCondition.notify_all();
+    }
 
     return resolvedHandle;
 }
 
 bool ScheduleSubsystem::RequestTaskCancellation(const TaskHandle& handle)
 {
-    std::lock_guard<std::mutex> lock(m_queueMutex);
+    std::unique_lock<std::mutex> lock(m_queueMutex);
 
     TaskControlBlock* controlBlock = findTaskControlBlock(handle);
     if (controlBlock == nullptr)
@@ -349,6 +407,11 @@ bool ScheduleSubsystem::RequestTaskCancellation(const TaskHandle& handle)
 
     if (controlBlock->state == TaskState::Queued && removePendingTaskByPointer(m_pendingTasksByType, controlBlock->task))
     {
+        const std::string& taskType = controlBlock->task->GetType();
+        m_telemetry.RecordCancelledWhileQueued(
+            controlBlock->telemetry,
+            static_cast<uint32_t>(countPendingTasksForPriority(m_pendingTasksByType, taskType, controlBlock->priority)));
+
         controlBlock->state        = TaskState::Cancelled;
         controlBlock->wasCancelled = true;
         controlBlock->task->SetState(TaskState::Cancelled);
@@ -359,6 +422,13 @@ bool ScheduleSubsystem::RequestTaskCancellation(const TaskHandle& handle)
         }
 
         m_completedTaskRecords.push_back(controlBlock->ToCompletionRecord());
+
+        const bool shouldNotifyWaiters = m_assistingWaiterCount > 0;
+        lock.unlock();
+        if (shouldNotifyWaiters)
+        {
+            m_taskFinishedCondition.notify_all();
+        }
         return firstRequest;
     }
 
@@ -401,6 +471,85 @@ TaskResultDrainView ScheduleSubsystem::DrainCompletedTaskRecords()
     return drainView;
 }
 
+//-----------------------------------------------------------------------------------------------
+// WaitOrExecute: Work-assisting wait
+//
+// 1. Queued    -> claim the task (remove from its pending deque) and run it on this thread
+// 2. Executing -> run other pending tasks of the same type until the handle is terminal
+// 3. Nothing to help with -> sleep on m_taskFinishedCondition (woken by completion/submission)
+// The budget is only checked between tasks; an assisted task always runs to completion.
+//-----------------------------------------------------------------------------------------------
+TaskWaitResult ScheduleSubsystem::WaitOrExecute(const TaskHandle& handle, std::chrono::microseconds budget)
+{
+    ENGINE_PROFILE_SCOPE("ScheduleSubsystem::WaitOrExecute");
+
+    using Clock = std::chrono::steady_clock;
+    const Clock::time_point deadline = Clock::now() + budget;
+
+    TaskWaitResult               result;
+    std::unique_lock<std::mutex> lock(m_queueMutex);
+
+    TaskControlBlock* controlBlock = findTaskControlBlock(handle);
+    if (controlBlock == nullptr || controlBlock->task == nullptr)
+    {
+        throw InvalidTaskHandleException("ScheduleSubsystem::WaitOrExecute: Invalid task handle");
+    }
+
+    const std::string taskType = controlBlock->task->GetType();
+
+    if (controlBlock->state == TaskState::Queued && !IsShuttingDown() &&
+        removePendingTaskByPointer(m_pendingTasksByType, controlBlock->task))
+    {
+        RunnableTask* task = controlBlock->task;
+        beginTaskExecution(task, static_cast<uint32_t>(countPendingTasksForPriority(m_pendingTasksByType, taskType, controlBlock->priority)));
+
+        lock.unlock();
+        executeClaimedTask(task);
+        lock.lock();
+
+        result.executedInline = true;
+    }
+
+    // Control blocks are only erased by DrainCompletedTaskRecords, so a missing one means
+    // another thread drained the terminal record while we were unlocked
+    auto isFinished = [this, &handle, &result]()
+    {
+        const TaskControlBlock* current = findTaskControlBlock(handle);
+        if (current == nullptr)
+        {
+            result.finalState = TaskState::Completed;
+            return true;
+        }
+
+        result.finalState = current->state;
+        return current->IsTerminal();
+    };
+
+    while (!isFinished() && Clock::now() < deadline)
+    {
+        RunnableTask* otherTask = IsShuttingDown() ? nullptr : GetNextTaskForType(taskType);
+        if (otherTask != nullptr)
+        {
+            lock.unlock();
+            executeClaimedTask(otherTask);
+            lock.lock();
+
+            result.assistedTasks++;
+            continue;
+        }
+
+        m_assistingWaiterCount++;
+        m_taskFinishedCondition.wait_until(lock, deadline, [this, &isFinished, &taskType]()
+        {
+            return isFinished() || (!IsShuttingDown() && HasPendingTaskOfType(taskType));
+        });
+        m_assistingWaiterCount--;
+    }
+
+    result.completed = isFinished();
+    return result;
+}
+
 RunnableTask* ScheduleSubsystem::GetNextTaskForType(const std::string& typeStr)
 {
     // IMPORTANT: Caller must already hold m_queueMutex lock!
@@ -421,6 +570,7 @@ RunnableTask* ScheduleSubsystem::GetNextTaskForType(const std::string& typeStr)
     {
         RunnableTask* task = highIt->second.front();
         highIt->second.pop_front();
+        const uint32_t remainingDepth = static_cast<uint32_t>(highIt->second.size());
 
         // Clean up empty deque
         if (highIt->second.empty())
@@ -431,17 +581,7 @@ RunnableTask* ScheduleSubsystem::GetNextTaskForType(const std::string& typeStr)
                 m_pendingTasksByType.erase(typeIt);
         }
 
-        m_executingTasks.push_back(task);
-        if (TaskControlBlock* controlBlock = findTaskControlBlock(task))
-        {
-            controlBlock->state = TaskState::Executing;
-            task->SetState(TaskState::Executing);
-
-            if (m_keyedTaskPolicyTracker.IsTrackingTask(controlBlock->handle))
-            {
-                m_keyedTaskPolicyTracker.MarkTaskExecuting(controlBlock->handle);
-            }
-        }
+        beginTaskExecution(task, remainingDepth);
         return task;
     }
 
@@ -451,6 +591,7 @@ RunnableTask* ScheduleSubsystem::GetNextTaskForType(const std::string& typeStr)
     {
         RunnableTask* task = normalIt->second.front();
         normalIt->second.pop_front();
+        const uint32_t remainingDepth = static_cast<uint32_t>(normalIt->second.size());
 
         // Clean up empty deque
         if (normalIt->second.empty())
@@ -461,17 +602,7 @@ RunnableTask* ScheduleSubsystem::GetNextTaskForType(const std::string& typeStr)
                 m_pendingTasksByType.erase(typeIt);
         }
 
-        m_executingTasks.push_back(task);
-        if (TaskControlBlock* controlBlock = findTaskControlBlock(task))
-        {
-            controlBlock->state = TaskState::Executing;
-            task->SetState(TaskState::Executing);
-
-            if (m_keyedTaskPolicyTracker.IsTrackingTask(controlBlock->handle))
-            {
-                m_keyedTaskPolicyTracker.MarkTaskExecuting(controlBlock->handle);
-            }
-        }
+        beginTaskExecution(task, remainingDepth);
         return task;
     }
 
@@ -480,8 +611,9 @@ RunnableTask* ScheduleSubsystem::GetNextTaskForType(const std::string& typeStr)
 
 void ScheduleSubsystem::OnTaskCompleted(RunnableTask* task)
 {
-    std::string taskType     = task->GetType();
-    bool        shouldNotify = false;
+    std::string taskType            = task->GetType();
+    bool        shouldNotify        = false;
+    bool        shouldNotifyWaiters = false;
 
     {
         std::lock_guard<std::mutex> lock(m_queueMutex);
@@ -507,6 +639,12 @@ void ScheduleSubsystem::OnTaskCompleted(RunnableTask* task)
             controlBlock->wasCancelled = finalState == TaskState::Cancelled;
             task->SetState(finalState);
 
+            if (controlBlock->telemetry != nullptr && controlBlock->startTimeNs != 0)
+            {
+                controlBlock->finishTimeNs = ScheduleTelemetry::NowNs();
+                m_telemetry.RecordFinish(controlBlock->telemetry, controlBlock->finishTimeNs - controlBlock->startTimeNs, finalState);
+            }
+
             if (m_keyedTaskPolicyTracker.IsTrackingTask(controlBlock->handle))
             {
                 const TaskFreshnessEvaluation freshness = m_keyedTaskPolicyTracker.EvaluateCompletion(controlBlock->handle);
@@ -534,7 +672,8 @@ void ScheduleSubsystem::OnTaskCompleted(RunnableTask* task)
         }
 
         // Plan 1: Check if there are more tasks of the SAME type pending
-        shouldNotify = HasPendingTaskOfType(taskType);
+        shouldNotify        = HasPendingTaskOfType(taskType);
+        shouldNotifyWaiters = m_assistingWaiterCount > 0;
     }
     // Release lock before notifying (best practice)
 
@@ -543,6 +682,10 @@ void ScheduleSubsystem::OnTaskCompleted(RunnableTask* task)
         // Notify only workers of the matching type (Plan 1: Per-Type Condition Variables)
         m_typeConditionVariables[taskType].notify_one();
     }
+    if (shouldNotifyWaiters)
+    {
+        m_taskFinishedCondition.notify_all();
+    }
 }
 
 void ScheduleSubsystem::CreateWorkerThreads()
@@ -683,6 +826,118 @@ bool ScheduleSubsystem::HasExecutingTasks(const std::string& taskType) const
     return false;
 }
 
+//-----------------------------------------------------------------------------------------------
+// Telemetry
+//-----------------------------------------------------------------------------------------------
+ScheduleTelemetrySnapshot ScheduleSubsystem::GetTelemetrySnapshot() const
+{
+    ScheduleTelemetrySnapshot snapshot;
+    {
+        std::scoped_lock lock(m_queueMutex);
+        m_telemetry.FillQueueSnapshots(snapshot, ScheduleTelemetry::NowNs());
+    }
+
+    // Worker counters are relaxed atomics owned by each worker, no lock needed
+    snapshot.workers.reserve(m_workerThreads.size());
+    for (const TaskWorkerThread* worker : m_workerThreads)
+    {
+        ScheduleWorkerSnapshot workerSnapshot;
+        workerSnapshot.workerId      = worker->GetWorkerID();
+        workerSnapshot.taskType      = worker->GetAssignedType();
+        workerSnapshot.tasksExecuted = worker->GetTasksExecuted();
+        workerSnapshot.busyNs        = worker->GetBusyNs();
+        workerSnapshot.idleNs        = worker->GetIdleNs();
+        const uint64_t totalNs       = workerSnapshot.busyNs + workerSnapshot.idleNs;
+        workerSnapshot.utilization   = totalNs > 0 ? static_cast<double>(workerSnapshot.busyNs) / static_cast<double>(totalNs) : 0.0;
+        snapshot.workers.push_back(std::move(workerSnapshot));
+    }
+    return snapshot;
+}
+
+void ScheduleSubsystem::ResetTelemetry()
+{
+    {
+        std::scoped_lock lock(m_queueMutex);
+        m_telemetry.Reset(ScheduleTelemetry::NowNs());
+    }
+    for (TaskWorkerThread* worker : m_workerThreads)
+    {
+        worker->ResetTelemetry();
+    }
+}
+
+void ScheduleSubsystem::SetTelemetryEnabled(bool enabled)
+{
+    std::scoped_lock lock(m_queueMutex);
+    m_telemetry.SetEnabled(enabled);
+}
+
+bool ScheduleSubsystem::IsTelemetryEnabled() const
+{
+    std::scoped_lock lock(m_queueMutex);
+    return m_telemetry.IsEnabled();
+}
+
+void ScheduleSubsystem::beginTaskExecution(RunnableTask* task, uint32_t remainingQueueDepth)
+{
+    m_executingTasks.push_back(task);
+
+    TaskControlBlock* controlBlock = findTaskControlBlock(task);
+    if (controlBlock == nullptr)
+    {
+        return;
+    }
+
+    controlBlock->state = TaskState::Executing;
+    task->SetState(TaskState::Executing);
+
+    if (m_keyedTaskPolicyTracker.IsTrackingTask(controlBlock->handle))
+    {
+        m_keyedTaskPolicyTracker.MarkTaskExecuting(controlBlock->handle);
+    }
+
+    if (controlBlock->telemetry != nullptr)
+    {
+        controlBlock->startTimeNs = ScheduleTelemetry::NowNs();
+        m_telemetry.RecordStart(controlBlock->telemetry, controlBlock->startTimeNs - controlBlock->submitTimeNs, remainingQueueDepth);
+    }
+}
+
+// Mirrors TaskWorkerThread::threadMain's execute step for tasks run by WaitOrExecute callers
+void ScheduleSubsystem::executeClaimedTask(RunnableTask* task)
+{
+    if (task->IsCancellationRequested())
+    {
+        task->SetState(TaskState::Cancelled);
+        OnTaskCompleted(task);
+        return;
+    }
+
+    try
+    {
+        ENGINE_PROFILE_SCOPE("ScheduleSubsystem::ExecuteInline");
+        ENGINE_PROFILE_FLOW_END("Task", task->GetHandle().id);
+        task->Execute();
+    }
+    catch (const std::exception& exception)
+    {
+        task->SetState(TaskState::Failed);
+        LogError(LogSchedule,
+                 "Inline task type='%s' failed with exception: %s",
+                 task->GetType().c_str(),
+                 exception.what());
+    }
+    catch (...)
+    {
+        task->SetState(TaskState::Failed);
+        LogError(LogSchedule,
+                 "Inline task type='%s' failed with unknown exception",
+                 task->GetType().c_str());
+    }
+
+    OnTaskCompleted(task);
+}
+
 TaskHandle ScheduleSubsystem::allocateTaskHandle()
 {
     TaskHandle handle;
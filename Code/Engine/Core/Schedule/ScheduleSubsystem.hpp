@@ -4,10 +4,12 @@
 #include "TaskTypeRegistry.hpp"
 #include "TaskControlBlock.hpp"
 #include "RunnableTask.hpp"
+#include "ScheduleTelemetry.hpp"
 #include <vector>
 #include <mutex>
 #include <condition_variable>
 #include <atomic>
+#include <chrono>
 #include <string>
 #include <map> // For per-type condition variables and priority queues
 #include <deque> // For task queues
@@ -55,6 +57,9 @@ namespace enigma::core
     //     - type: FileIO
     //       threads: 2
     //       description: File I/O operations
+    //   telemetry:
+    //     enabled: true              # Latency histograms + throughput counters (default on)
+    //     log_interval_seconds: 0    # > 0: periodic LogInfo dump of the telemetry snapshot
     //
     // LOADING:
     // - LoadFromYaml(YamlConfiguration&): Parse YAML and populate task_types
@@ -64,6 +69,8 @@ namespace enigma::core
     struct ScheduleConfig
     {
         std::vector<TaskTypeDefinition> task_types; // Task type definitions from YAML
+        bool                            telemetry_enabled              = true;
+        float                           telemetry_log_interval_seconds = 0.0f; // 0 disables the periodic dump
 
         // Load configuration from YAML object
         void LoadFromYaml(const YamlConfiguration& yaml);
@@ -109,6 +116,7 @@ namespace enigma::core
         // EngineSubsystem Interface
         void Startup() override;
         void Shutdown() override;
+        void Update(float deltaTime) override; // Periodic telemetry log dump only
 
         //-------------------------------------------------------------------------------------------
         // Modern Task Management API
@@ -124,6 +132,16 @@ namespace enigma::core
         // Modern completion drain API.
         TaskResultDrainView DrainCompletedTaskRecords();
 
+        // Work-assisting wait: block the caller until the task reaches a terminal state or the
+        // budget runs out, doing useful work instead of yielding.
+        // - Still queued: the caller claims it and executes it inline.
+        // - Already executing: the caller drains other pending tasks of the same type, and sleeps
+        //   on a completion signal when there is nothing to help with.
+        // An assisted task is never interrupted, so the call can overrun the budget by up to one
+        // task's run time. Do not use for task types that block on the calling thread.
+        // Throws InvalidTaskHandleException for unknown (or already drained) handles.
+        TaskWaitResult WaitOrExecute(const TaskHandle& handle, std::chrono::microseconds budget);
+
         // Get the type registry (for manual type registration in Phase 1)
         TaskTypeRegistry& GetTypeRegistry() { return m_typeRegistry; }
 
@@ -166,6 +184,17 @@ namespace enigma::core
         // Shutdown support: Check whether a task of the specified type is being executed
         bool HasExecutingTasks(const std::string& taskType) const;
 
+        //-------------------------------------------------------------------------------------------
+        // Telemetry API
+        // Per type/priority queue-wait and run-time histograms, throughput and queue depth,
+        // plus per-worker busy/idle time. Recorded under m_queueMutex (no extra locking).
+        //-------------------------------------------------------------------------------------------
+        ScheduleTelemetrySnapshot GetTelemetrySnapshot() const;
+        void                      ResetTelemetry();
+        void                      SetTelemetryEnabled(bool enabled);
+        bool                      IsTelemetryEnabled() const;
+        void                      SetTelemetryLogInterval(float seconds) { m_telemetryLogIntervalSeconds = seconds; }
+
     private:
         //-------------------------------------------------------------------------------------------
         // Internal Helpers
@@ -177,6 +206,14 @@ namespace enigma::core
         // Destroy all worker threads (called during Shutdown)
         void DestroyWorkerThreads();
 
+        // Queued -> Executing transition shared by every dequeue path
+        // PRECONDITION: Caller must hold m_queueMutex
+        void beginTaskExecution(RunnableTask* task, uint32_t remainingQueueDepth);
+
+        // Run a task claimed by a non-worker caller (WaitOrExecute) and report its completion
+        // PRECONDITION: Caller must NOT hold m_queueMutex
+        void executeClaimedTask(RunnableTask* task);
+
         TaskHandle allocateTaskHandle();
         TaskControlBlock* findTaskControlBlock(const TaskHandle& handle);
         const TaskControlBlock* findTaskControlBlock(const TaskHandle& handle) const;
@@ -211,10 +248,19 @@ namespace enigma::core
         mutable std::mutex                             m_queueMutex; // Protects all three queues
         std::map<std::string, std::condition_variable> m_typeConditionVariables; // One CV per task type
         std::atomic<bool>                              m_isShuttingDown{false}; // Shutdown flag (atomic for lock-free read)
+        std::condition_variable                        m_taskFinishedCondition; // Wakes WaitOrExecute callers
+        uint32_t                                       m_assistingWaiterCount = 0; // WaitOrExecute callers asleep on the CV
 
         //-------------------------------------------------------------------------------------------
         // Worker Thread Pool
         //-------------------------------------------------------------------------------------------
         std::vector<TaskWorkerThread*> m_workerThreads; // All worker threads (indexed by ID)
+
+        //-------------------------------------------------------------------------------------------
+        // Telemetry (protected by m_queueMutex)
+        //-------------------------------------------------------------------------------------------
+        ScheduleTelemetry m_telemetry;
+        float             m_telemetryLogIntervalSeconds = 0.0f;
+        float             m_telemetryLogElapsedSeconds  = 0.0f;
     };
 }
@@ -97,6 +97,18 @@ namespace enigma::core
         TaskPolicyDecision      policyDecision = TaskPolicyDecision::Executed;
     };
 
+    //-----------------------------------------------------------------------------------------------
+    // TaskWaitResult
+    // Outcome of ScheduleSubsystem::WaitOrExecute.
+    //-----------------------------------------------------------------------------------------------
+    struct TaskWaitResult
+    {
+        TaskState finalState     = TaskState::Queued; // Last observed state of the awaited task
+        bool      completed      = false; // Awaited task reached a terminal state within the budget
+        bool      executedInline = false; // Awaited task was claimed and executed by the caller
+        uint32_t  assistedTasks  = 0; // Other same-type tasks the caller executed while waiting
+    };
+
     struct TaskResultDrainView
     {
         std::vector<TaskCompletionRecord> records;
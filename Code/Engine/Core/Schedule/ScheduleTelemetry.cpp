@@ -0,0 +1,293 @@
+#include "ScheduleTelemetry.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+namespace enigma::core
+{
+    namespace
+    {
+        uint32_t HighestBitIndex(uint64_t value)
+        {
+#if defined(_MSC_VER)
+            unsigned long index = 0;
+            _BitScanReverse64(&index, value);
+            return static_cast<uint32_t>(index);
+#else
+            return 63U - static_cast<uint32_t>(__builtin_clzll(value));
+#endif
+        }
+
+        const char* GetPriorityName(TaskPriority priority)
+        {
+            return priority == TaskPriority::High ? "High" : "Normal";
+        }
+    }
+
+    //-----------------------------------------------------------------------------------------------
+    // LatencyHistogram
+    //-----------------------------------------------------------------------------------------------
+    uint32_t LatencyHistogram::GetBucketIndex(uint64_t valueUs)
+    {
+        if (valueUs < SUB_BUCKET_COUNT)
+        {
+            return static_cast<uint32_t>(valueUs);
+        }
+
+        const uint32_t exponent = HighestBitIndex(valueUs);
+        if (exponent > MAX_EXPONENT)
+        {
+            return BUCKET_COUNT - 1;
+        }
+
+        const uint32_t group    = exponent - SUB_BUCKET_BITS + 1;
+        const uint32_t subIndex = static_cast<uint32_t>(valueUs >> (exponent - SUB_BUCKET_BITS)) & (SUB_BUCKET_COUNT - 1);
+        return group * SUB_BUCKET_COUNT + subIndex;
+    }
+
+    uint64_t LatencyHistogram::GetBucketLowerBound(uint32_t bucketIndex)
+    {
+        if (bucketIndex < SUB_BUCKET_COUNT)
+        {
+            return bucketIndex;
+        }
+
+        const uint32_t group    = bucketIndex / SUB_BUCKET_COUNT;
+        const uint32_t subIndex = bucketIndex % SUB_BUCKET_COUNT;
+        return static_cast<uint64_t>(SUB_BUCKET_COUNT + subIndex) << (group - 1);
+    }
+
+    uint64_t LatencyHistogram::GetBucketWidth(uint32_t bucketIndex)
+    {
+        return bucketIndex < SUB_BUCKET_COUNT ? 1ULL : 1ULL << (bucketIndex / SUB_BUCKET_COUNT - 1);
+    }
+
+    void LatencyHistogram::Record(uint64_t valueUs)
+    {
+        ++m_buckets[GetBucketIndex(valueUs)];
+        ++m_count;
+        m_sum += valueUs;
+        m_max = (std::max)(m_max, valueUs);
+    }
+
+    void LatencyHistogram::Merge(const LatencyHistogram& other)
+    {
+        for (uint32_t i = 0; i < BUCKET_COUNT; ++i)
+        {
+            m_buckets[i] += other.m_buckets[i];
+        }
+        m_count += other.m_count;
+        m_sum += other.m_sum;
+        m_max = (std::max)(m_max, other.m_max);
+    }
+
+    void LatencyHistogram::Reset()
+    {
+        m_buckets.fill(0);
+        m_count = 0;
+        m_sum   = 0;
+        m_max   = 0;
+    }
+
+    uint64_t LatencyHistogram::GetValueAtPercentile(double percentile) const
+    {
+        if (m_count == 0)
+        {
+            return 0;
+        }
+
+        const double   clamped = std::clamp(percentile, 0.0, 100.0);
+        const uint64_t rank    = (std::max)(static_cast<uint64_t>(clamped / 100.0 * static_cast<double>(m_count) + 0.5), uint64_t{1});
+        if (rank >= m_count)
+        {
+            return m_max;
+        }
+
+        uint64_t seen = 0;
+        for (uint32_t i = 0; i < BUCKET_COUNT; ++i)
+        {
+            seen += m_buckets[i];
+            if (seen >= rank)
+            {
+                const uint64_t midpoint = GetBucketLowerBound(i) + GetBucketWidth(i) / 2;
+                return (std::min)(midpoint, m_max);
+            }
+        }
+        return m_max;
+    }
+
+    //-----------------------------------------------------------------------------------------------
+    // ScheduleQueueTelemetry / summaries
+    //-----------------------------------------------------------------------------------------------
+    void ScheduleQueueTelemetry::Reset()
+    {
+        queueWaitUs.Reset();
+        runTimeUs.Reset();
+        submitted     = 0;
+        started       = 0;
+        completed     = 0;
+        cancelled     = 0;
+        failed        = 0;
+        maxQueueDepth = queueDepth; // Depth is live state, keep it across resets
+    }
+
+    ScheduleLatencySummary ScheduleLatencySummary::FromHistogram(const LatencyHistogram& histogram)
+    {
+        ScheduleLatencySummary summary;
+        summary.count  = histogram.GetCount();
+        summary.meanUs = histogram.GetMean();
+        summary.p50Us  = histogram.GetValueAtPercentile(50.0);
+        summary.p90Us  = histogram.GetValueAtPercentile(90.0);
+        summary.p99Us  = histogram.GetValueAtPercentile(99.0);
+        summary.maxUs  = histogram.GetMax();
+        return summary;
+    }
+
+    std::string ScheduleTelemetrySnapshot::ToString() const
+    {
+        std::string text;
+        char        line[320];
+
+        std::snprintf(line, sizeof(line), "Schedule telemetry over %.1fs%s\n", windowSeconds, enabled ? "" : " (disabled)");
+        text += line;
+        for (const ScheduleQueueSnapshot& queue : queues)
+        {
+            std::snprintf(line, sizeof(line),
+                          "  %-12s %-6s depth %4u (max %4u) done %8llu (%.1f/s) cancel %llu fail %llu | wait p50 %llu p99 %llu max %llu us | run p50 %llu p99 %llu max %llu us\n",
+                          queue.taskType.c_str(), GetPriorityName(queue.priority),
+                          queue.queueDepth, queue.maxQueueDepth,
+                          static_cast<unsigned long long>(queue.completed), queue.throughputPerSecond,
+                          static_cast<unsigned long long>(queue.cancelled), static_cast<unsigned long long>(queue.failed),
+                          static_cast<unsigned long long>(queue.queueWait.p50Us), static_cast<unsigned long long>(queue.queueWait.p99Us),
+                          static_cast<unsigned long long>(queue.queueWait.maxUs),
+                          static_cast<unsigned long long>(queue.runTime.p50Us), static_cast<unsigned long long>(queue.runTime.p99Us),
+                          static_cast<unsigned long long>(queue.runTime.maxUs));
+            text += line;
+        }
+        for (const ScheduleWorkerSnapshot& worker : workers)
+        {
+            std::snprintf(line, sizeof(line), "  worker #%-3d %-12s tasks %8llu busy %.1f%% (idle %.1f ms)\n",
+                          worker.workerId, worker.taskType.c_str(), static_cast<unsigned long long>(worker.tasksExecuted),
+                          worker.utilization * 100.0, static_cast<double>(worker.idleNs) / 1.0e6);
+            text += line;
+        }
+        return text;
+    }
+
+    //-----------------------------------------------------------------------------------------------
+    // ScheduleTelemetry
+    //-----------------------------------------------------------------------------------------------
+    uint64_t ScheduleTelemetry::NowNs()
+    {
+        return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count());
+    }
+
+    ScheduleQueueTelemetry* ScheduleTelemetry::GetQueue(const std::string& taskType, TaskPriority priority)
+    {
+        const size_t index = (std::min)(static_cast<size_t>(priority), PRIORITY_COUNT - 1);
+        return &m_queues[taskType][index];
+    }
+
+    void ScheduleTelemetry::RecordSubmit(ScheduleQueueTelemetry* queue, uint32_t queueDepth)
+    {
+        if (!m_enabled || queue == nullptr)
+        {
+            return;
+        }
+        ++queue->submitted;
+        queue->queueDepth    = queueDepth;
+        queue->maxQueueDepth = (std::max)(queue->maxQueueDepth, queueDepth);
+    }
+
+    void ScheduleTelemetry::RecordStart(ScheduleQueueTelemetry* queue, uint64_t queueWaitNs, uint32_t queueDepth)
+    {
+        if (!m_enabled || queue == nullptr)
+        {
+            return;
+        }
+        ++queue->started;
+        queue->queueDepth = queueDepth;
+        queue->queueWaitUs.Record(queueWaitNs / 1000);
+    }
+
+    void ScheduleTelemetry::RecordFinish(ScheduleQueueTelemetry* queue, uint64_t runNs, TaskState finalState)
+    {
+        if (!m_enabled || queue == nullptr)
+        {
+            return;
+        }
+        queue->runTimeUs.Record(runNs / 1000);
+        switch (finalState)
+        {
+        case TaskState::Cancelled:
+            ++queue->cancelled;
+            break;
+        case TaskState::Failed:
+            ++queue->failed;
+            break;
+        default:
+            ++queue->completed;
+            break;
+        }
+    }
+
+    void ScheduleTelemetry::RecordCancelledWhileQueued(ScheduleQueueTelemetry* queue, uint32_t queueDepth)
+    {
+        if (!m_enabled || queue == nullptr)
+        {
+            return;
+        }
+        ++queue->cancelled;
+        queue->queueDepth = queueDepth;
+    }
+
+    void ScheduleTelemetry::Reset(uint64_t nowNs)
+    {
+        m_windowStartNs = nowNs;
+        for (auto& typePair : m_queues)
+        {
+            for (ScheduleQueueTelemetry& queue : typePair.second)
+            {
+                queue.Reset();
+            }
+        }
+    }
+
+    void ScheduleTelemetry::FillQueueSnapshots(ScheduleTelemetrySnapshot& snapshot, uint64_t nowNs) const
+    {
+        snapshot.enabled       = m_enabled;
+        snapshot.windowSeconds = nowNs > m_windowStartNs ? static_cast<double>(nowNs - m_windowStartNs) / 1.0e9 : 0.0;
+
+        for (const auto& typePair : m_queues)
+        {
+            for (size_t index = 0; index < PRIORITY_COUNT; ++index)
+            {
+                const ScheduleQueueTelemetry& queue = typePair.second[index];
+                if (queue.submitted == 0 && queue.started == 0 && queue.queueDepth == 0)
+                {
+                    continue;
+                }
+
+                ScheduleQueueSnapshot entry;
+                entry.taskType            = typePair.first;
+                entry.priority            = static_cast<TaskPriority>(index);
+                entry.submitted           = queue.submitted;
+                entry.completed           = queue.completed;
+                entry.cancelled           = queue.cancelled;
+                entry.failed              = queue.failed;
+                entry.queueDepth          = queue.queueDepth;
+                entry.maxQueueDepth       = queue.maxQueueDepth;
+                entry.throughputPerSecond = snapshot.windowSeconds > 0.0 ? static_cast<double>(queue.completed) / snapshot.windowSeconds : 0.0;
+                entry.queueWait           = ScheduleLatencySummary::FromHistogram(queue.queueWaitUs);
+                entry.runTime             = ScheduleLatencySummary::FromHistogram(queue.runTimeUs);
+                snapshot.queues.push_back(std::move(entry));
+            }
+        }
+    }
+}
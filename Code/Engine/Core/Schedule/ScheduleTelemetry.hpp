@@ -0,0 +1,160 @@
+#pragma once
+
+#include "ScheduleTaskTypes.hpp"
+
+#include <array>
+#include <cstdint>
+#include <map>
+#include <string>
+#include <vector>
+
+namespace enigma::core
+{
+    //-----------------------------------------------------------------------------------------------
+    // LatencyHistogram
+    // HDR-style log-linear histogram of microsecond latencies.
+    //
+    // Values below 16us get one bucket each; above that every power of two is split into
+    // 16 linear sub-buckets, so any recorded value is reported within 1/16 (6.25%) of its
+    // true value. Range tops out at 2^40us (~12 days); larger values land in the last bucket.
+    // Fixed storage (no allocation after construction), O(1) Record().
+    //-----------------------------------------------------------------------------------------------
+    class LatencyHistogram
+    {
+    public:
+        static constexpr uint32_t SUB_BUCKET_BITS  = 4;
+        static constexpr uint32_t SUB_BUCKET_COUNT = 1U << SUB_BUCKET_BITS;
+        static constexpr uint32_t MAX_EXPONENT     = 39;
+        static constexpr uint32_t BUCKET_COUNT     = (MAX_EXPONENT - SUB_BUCKET_BITS + 2) * SUB_BUCKET_COUNT;
+
+        void Record(uint64_t valueUs);
+        void Merge(const LatencyHistogram& other);
+        void Reset();
+
+        uint64_t GetCount() const { return m_count; }
+        uint64_t GetSum() const { return m_sum; }
+        uint64_t GetMax() const { return m_max; }
+        double   GetMean() const { return m_count > 0 ? static_cast<double>(m_sum) / static_cast<double>(m_count) : 0.0; }
+
+        // Representative value (bucket midpoint, capped at max) at the given percentile in [0, 100]
+        uint64_t GetValueAtPercentile(double percentile) const;
+
+        static uint32_t GetBucketIndex(uint64_t valueUs);
+        static uint64_t GetBucketLowerBound(uint32_t bucketIndex);
+        static uint64_t GetBucketWidth(uint32_t bucketIndex);
+
+    private:
+        std::array<uint64_t, BUCKET_COUNT> m_buckets{};
+        uint64_t                           m_count = 0;
+        uint64_t                           m_sum   = 0;
+        uint64_t                           m_max   = 0;
+    };
+
+    //-----------------------------------------------------------------------------------------------
+    // Live counters for one (task type, priority) queue. Owned by ScheduleTelemetry.
+    //-----------------------------------------------------------------------------------------------
+    struct ScheduleQueueTelemetry
+    {
+        LatencyHistogram queueWaitUs; // Submit -> start
+        LatencyHistogram runTimeUs; // Start -> finish
+        uint64_t         submitted     = 0;
+        uint64_t         started       = 0;
+        uint64_t         completed     = 0;
+        uint64_t         cancelled     = 0; // Includes tasks cancelled while still queued
+        uint64_t         failed        = 0;
+        uint32_t         queueDepth    = 0;
+        uint32_t         maxQueueDepth = 0;
+
+        void Reset();
+    };
+
+    //-----------------------------------------------------------------------------------------------
+    // Snapshot types (plain copies, safe to keep and format off the scheduler lock)
+    //-----------------------------------------------------------------------------------------------
+    struct ScheduleLatencySummary
+    {
+        uint64_t count  = 0;
+        double   meanUs = 0.0;
+        uint64_t p50Us  = 0;
+        uint64_t p90Us  = 0;
+        uint64_t p99Us  = 0;
+        uint64_t maxUs  = 0;
+
+        static ScheduleLatencySummary FromHistogram(const LatencyHistogram& histogram);
+    };
+
+    struct ScheduleQueueSnapshot
+    {
+        std::string            taskType;
+        TaskPriority           priority            = TaskPriority::Normal;
+        uint64_t               submitted           = 0;
+        uint64_t               completed           = 0;
+        uint64_t               cancelled           = 0;
+        uint64_t               failed              = 0;
+        uint32_t               queueDepth          = 0;
+        uint32_t               maxQueueDepth       = 0;
+        double                 throughputPerSecond = 0.0; // Completed tasks over the snapshot window
+        ScheduleLatencySummary queueWait;
+        ScheduleLatencySummary runTime;
+    };
+
+    struct ScheduleWorkerSnapshot
+    {
+        int         workerId = -1;
+        std::string taskType;
+        uint64_t    tasksExecuted = 0;
+        uint64_t    busyNs        = 0; // Executing tasks
+        uint64_t    idleNs        = 0; // Blocked on the type's condition variable
+        double      utilization   = 0.0; // busy / (busy + idle)
+    };
+
+    struct ScheduleTelemetrySnapshot
+    {
+        bool                                enabled       = false;
+        double                              windowSeconds = 0.0; // Time since the last reset
+        std::vector<ScheduleQueueSnapshot>  queues; // Sorted by type, then priority
+        std::vector<ScheduleWorkerSnapshot> workers;
+
+        // Multi-line human-readable table (used by the periodic log dump)
+        std::string ToString() const;
+    };
+
+    //-----------------------------------------------------------------------------------------------
+    // ScheduleTelemetry
+    // Aggregates queue-wait/run-time histograms and throughput counters per type and priority.
+    //
+    // THREAD SAFETY:
+    // - Not internally synchronized. ScheduleSubsystem calls every Record*/Reset/FillSnapshot
+    //   while already holding m_queueMutex, so telemetry adds no extra lock.
+    // - Queue entries are never erased, so the pointers handed out by GetQueue() stay valid
+    //   for the lifetime of the subsystem and TaskControlBlock can cache them.
+    //-----------------------------------------------------------------------------------------------
+    class ScheduleTelemetry
+    {
+    public:
+        void SetEnabled(bool enabled) { m_enabled = enabled; }
+        bool IsEnabled() const { return m_enabled; }
+
+        ScheduleQueueTelemetry* GetQueue(const std::string& taskType, TaskPriority priority);
+
+        void RecordSubmit(ScheduleQueueTelemetry* queue, uint32_t queueDepth);
+        void RecordStart(ScheduleQueueTelemetry* queue, uint64_t queueWaitNs, uint32_t queueDepth);
+        void RecordFinish(ScheduleQueueTelemetry* queue, uint64_t runNs, TaskState finalState);
+        void RecordCancelledWhileQueued(ScheduleQueueTelemetry* queue, uint32_t queueDepth);
+
+        void Reset(uint64_t nowNs);
+        void FillQueueSnapshots(ScheduleTelemetrySnapshot& snapshot, uint64_t nowNs) const;
+
+        uint64_t GetWindowStartNs() const { return m_windowStartNs; }
+
+        // Monotonic timestamp used for TaskControlBlock submit/start/finish times
+        static uint64_t NowNs();
+
+    private:
+        static constexpr size_t PRIORITY_COUNT = 2; // TaskPriority::Normal, TaskPriority::High
+
+        bool                                                                      m_enabled       = true;
+        uint64_t                                                                  m_windowStartNs = 0;
+        std::map<std::string, std::array<ScheduleQueueTelemetry, PRIORITY_COUNT>> m_queues;
+    };
+}
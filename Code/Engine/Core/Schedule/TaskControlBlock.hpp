@@ -2,11 +2,16 @@
 
 #include "ScheduleTaskTypes.hpp"
 
+#include <cstdint>
+
 namespace enigma::core
 {
+    struct ScheduleQueueTelemetry;
+
     //-----------------------------------------------------------------------------------------------
     // TaskControlBlock
     // Internal scheduler metadata for one submitted task.
+    // Timestamps come from ScheduleTelemetry::NowNs() (0 = not reached / telemetry disabled).
     //-----------------------------------------------------------------------------------------------
     struct TaskControlBlock
     {
@@ -21,6 +26,11 @@ namespace enigma::core
         std::optional<uint64_t> version;
         KeyedTaskPolicy         keyedPolicy           = KeyedTaskPolicy::AllowDuplicates;
         TaskPolicyDecision      policyDecision        = TaskPolicyDecision::Executed;
+        TaskPriority            priority              = TaskPriority::Normal;
+        uint64_t                submitTimeNs          = 0;
+        uint64_t                startTimeNs           = 0;
+        uint64_t                finishTimeNs          = 0;
+        ScheduleQueueTelemetry* telemetry             = nullptr; // Cached (type, priority) counters
 
         bool IsTerminal() const
         {
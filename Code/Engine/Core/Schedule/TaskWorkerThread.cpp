@@ -2,6 +2,8 @@
 #include "ScheduleSubsystem.hpp"
 #include "Engine/Core/ErrorWarningAssert.hpp"
 #include "Engine/Core/Logger/LoggerAPI.hpp"
+#include "Engine/Core/Profiler/Profiler.hpp"
+#include "ScheduleTelemetry.hpp"
 #include <exception>
 
 namespace enigma::core
@@ -26,6 +28,13 @@ namespace enigma::core
         m_thread = nullptr;
     }
 
+    void TaskWorkerThread::ResetTelemetry()
+    {
+        m_busyNs.store(0, std::memory_order_relaxed);
+        m_idleNs.store(0, std::memory_order_relaxed);
+        m_tasksExecuted.store(0, std::memory_order_relaxed);
+    }
+
     //-----------------------------------------------------------------------------------------------
     // threadMain: Worker thread's main execution loop (PHASE 2: Condition Variable Optimization)
     //
@@ -69,11 +78,13 @@ namespace enigma::core
         LogDebug(LogSchedule,
                  "Worker #%d (type='%s') started (Phase 2: CV optimization)",
                  m_workerID, m_assignedType.c_str());
+        ENGINE_PROFILE_THREAD_NAME("Worker #" + std::to_string(m_workerID) + " (" + m_assignedType + ")");
 
         // Main worker loop: run until shutdown signal
         while (!m_system->IsShuttingDown())
         {
-            RunnableTask* task = nullptr;
+            RunnableTask*  task        = nullptr;
+            const uint64_t idleStartNs = ScheduleTelemetry::NowNs();
 
             // PHASE 2: Use condition variable for efficient waiting
             {
@@ -101,9 +112,14 @@ namespace enigma::core
             }
             // Mutex automatically released here (unique_lock destructor)
 
+            const uint64_t busyStartNs = ScheduleTelemetry::NowNs();
+            m_idleNs.fetch_add(busyStartNs - idleStartNs, std::memory_order_relaxed);
+
             // Execute task outside critical section (allows parallel execution)
             if (task)
             {
+                m_tasksExecuted.fetch_add(1, std::memory_order_relaxed);
+
                 LogDebug(LogSchedule,
                          "Worker #%d executing task of type='%s'",
                          m_workerID, task->GetType().c_str());
@@ -121,6 +137,8 @@ namespace enigma::core
 
                 try
                 {
+                    ENGINE_PROFILE_SCOPE("TaskWorker::Execute");
+                    ENGINE_PROFILE_FLOW_END("Task", task->GetHandle().id);
                     task->Execute(); // This may take time (file I/O, computation, etc.)
                 }
                 catch (const std::exception& exception)
@@ -141,6 +159,8 @@ namespace enigma::core
                              task->GetType().c_str());
                 }
 
+                m_busyNs.fetch_add(ScheduleTelemetry::NowNs() - busyStartNs, std::memory_order_relaxed);
+
                 // Hand terminal resolution back to the scheduler for completion recording.
                 m_system->OnTaskCompleted(task);
 
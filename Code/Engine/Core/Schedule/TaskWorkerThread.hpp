@@ -1,4 +1,6 @@
 #pragma once
+#include <atomic>
+#include <cstdint>
 #include <thread>
 #include <string>
 
@@ -25,6 +27,12 @@ namespace enigma::core
         int GetWorkerID() const { return m_workerID; }
         const std::string& GetAssignedType() const { return m_assignedType; }
 
+        // Telemetry counters (relaxed atomics, written only by this worker)
+        uint64_t GetBusyNs() const { return m_busyNs.load(std::memory_order_relaxed); }
+        uint64_t GetIdleNs() const { return m_idleNs.load(std::memory_order_relaxed); }
+        uint64_t GetTasksExecuted() const { return m_tasksExecuted.load(std::memory_order_relaxed); }
+        void     ResetTelemetry();
+
     private:
         // Thread entry point
         void threadMain();
@@ -34,5 +42,9 @@ namespace enigma::core
         std::string m_assignedType;          // Task type handled (string)
         ScheduleSubsystem* m_system;         // Scheduling system pointer
         std::thread* m_thread;               // Underlying thread object
+
+        std::atomic<uint64_t> m_busyNs{0};        // Time spent executing tasks
+        std::atomic<uint64_t> m_idleNs{0};        // Time spent waiting for work
+        std::atomic<uint64_t> m_tasksExecuted{0}; // Tasks taken from the queue (incl. cancelled)
     };
 }
@@ -1,6 +1,13 @@
 ﻿#include "SubsystemManager.hpp"
 #include "ErrorWarningAssert.hpp"
 #include <algorithm>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <set>
+#include <thread>
 #include <unordered_set>
 
 namespace enigma::core
@@ -16,6 +23,11 @@ namespace enigma::core
     {
         m_engineConfig = YamlConfiguration::LoadFromFile(configPath);
         m_moduleConfig = YamlConfiguration::LoadFromFile(modulePath);
+
+        if (m_engineConfig.Contains("engine.parallelStartup"))
+        {
+            m_parallelStartup = m_engineConfig.GetBoolean("engine.parallelStartup", true);
+        }
     }
 
     EngineSubsystem* SubsystemManager::GetSubsystem(const std::string& name) const
@@ -69,26 +81,276 @@ namespace enigma::core
     void SubsystemManager::StartupAllSubsystems()
     {
         // Phase 2: Main startup after all Initialize phases
+        const auto startTime = std::chrono::steady_clock::now();
+        m_startupReport      = SubsystemStartupReport();
+
+        if (m_parallelStartup)
+        {
+            StartupInParallel(startTime);
+        }
+        else
+        {
+            StartupSerially(startTime);
+        }
+
+        m_startupReport.wallMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - startTime).count();
+        DebuggerPrintf("[SubsystemManager] Started %zu subsystems in %.1f ms (%.1f ms serial, %u worker threads)\n",
+                       m_startupReport.subsystems.size(), m_startupReport.wallMs, m_startupReport.summedMs,
+                       m_startupReport.workerThreads);
+
+        // Collect subsystems that require game loop
+        m_gameLoopSubsystems.clear();
         for (auto* subsystem : m_startupOrder)
         {
-            const char* name  = subsystem->GetSubsystemName();
-            auto&       entry = m_subsystemsByName[name];
+            if (subsystem->RequiresGameLoop())
+            {
+                m_gameLoopSubsystems.push_back(subsystem);
+            }
+        }
+    }
 
+    void SubsystemManager::StartupSubsystem(EngineSubsystem* subsystem, std::chrono::steady_clock::time_point startTime,
+                                            bool offMainThread, SubsystemStartupTiming& outTiming)
+    {
+        const auto begin = std::chrono::steady_clock::now();
+        subsystem->Startup();
+        const auto end = std::chrono::steady_clock::now();
+
+        outTiming.name          = subsystem->GetSubsystemName();
+        outTiming.startMs       = std::chrono::duration<double, std::milli>(begin - startTime).count();
+        outTiming.durationMs    = std::chrono::duration<double, std::milli>(end - begin).count();
+        outTiming.offMainThread = offMainThread;
+    }
+
+    void SubsystemManager::StartupSerially(std::chrono::steady_clock::time_point startTime)
+    {
+        for (auto* subsystem : m_startupOrder)
+        {
+            auto& entry = m_subsystemsByName[subsystem->GetSubsystemName()];
             if (!entry->isStarted)
             {
-                subsystem->Startup();
+                SubsystemStartupTiming timing;
+                StartupSubsystem(subsystem, startTime, false, timing);
                 entry->isStarted = true;
+                m_startupReport.summedMs += timing.durationMs;
+                m_startupReport.subsystems.push_back(std::move(timing));
             }
         }
+    }
 
-        // Collect subsystems that require game loop
-        m_gameLoopSubsystems.clear();
-        for (auto* subsystem : m_startupOrder)
+    struct SubsystemManager::StartupSchedule
+    {
+        std::mutex                       mutex;
+        std::condition_variable          changed;
+        std::vector<size_t>              remaining; // Unstarted prerequisites per m_startupOrder index
+        std::vector<std::vector<size_t>> dependents;
+        std::vector<bool>                offMainThread;
+        std::vector<bool>                done;
+        std::deque<size_t>               workerQueue; // Off-thread subsystems whose prerequisites are done
+        size_t                           doneCount = 0;
+        bool                             stopWorkers = false;
+        std::exception_ptr               firstError;
+
+        // Caller holds the mutex
+        void MarkDone(size_t index)
         {
-            if (subsystem->RequiresGameLoop())
+            done[index] = true;
+            ++doneCount;
+            for (size_t dependent : dependents[index])
             {
-                m_gameLoopSubsystems.push_back(subsystem);
+                if (--remaining[dependent] == 0 && offMainThread[dependent])
+                {
+                    workerQueue.push_back(dependent);
+                }
+            }
+            changed.notify_all();
+        }
+    };
+
+    void SubsystemManager::StartupInParallel(std::chrono::steady_clock::time_point startTime)
+    {
+        const size_t count = m_startupOrder.size();
+
+        std::unordered_map<std::string, size_t> indexByName;
+        for (size_t i = 0; i < count; ++i)
+        {
+            indexByName[m_startupOrder[i]->GetSubsystemName()] = i;
+        }
+
+        // Prerequisites: declared dependencies, plus every earlier main-thread subsystem for the
+        // off-thread ones so they see the same engine state a serial startup would have given them.
+        // Main-thread subsystems keep their relative order by running one after another below.
+        StartupSchedule schedule;
+        schedule.remaining.assign(count, 0);
+        schedule.dependents.resize(count);
+        schedule.offMainThread.assign(count, false);
+        schedule.done.assign(count, false);
+
+        size_t offMainThreadCount = 0;
+        for (size_t i = 0; i < count; ++i)
+        {
+            EngineSubsystem* subsystem = m_startupOrder[i];
+            const auto&      entry     = m_subsystemsByName[subsystem->GetSubsystemName()];
+            schedule.offMainThread[i]  = subsystem->CanStartOffMainThread() && !entry->isStarted;
+            offMainThreadCount += schedule.offMainThread[i] ? 1 : 0;
+
+            std::unordered_set<size_t> prerequisites;
+            for (const std::string& dependency : entry->dependencies)
+            {
+                auto it = indexByName.find(dependency);
+                if (it != indexByName.end())
+                {
+                    prerequisites.insert(it->second);
+                }
+            }
+            if (schedule.offMainThread[i])
+            {
+                for (size_t earlier = 0; earlier < i; ++earlier)
+                {
+                    if (!m_startupOrder[earlier]->CanStartOffMainThread())
+                    {
+                        prerequisites.insert(earlier);
+                    }
+                }
+            }
+
+            schedule.remaining[i] = prerequisites.size();
+            for (size_t prerequisite : prerequisites)
+            {
+                schedule.dependents[prerequisite].push_back(i);
+            }
+        }
+
+        std::vector<SubsystemStartupTiming> timings(count);
+
+        // Worker pool: one thread per off-thread subsystem, capped at the core count; startups spend
+        // much of their time in file I/O, so small machines still get a few threads
+        const uint32_t maxWorkers  = (std::max)(4u, std::thread::hardware_concurrency());
+        const uint32_t workerCount = static_cast<uint32_t>((std::min)(static_cast<size_t>(maxWorkers), offMainThreadCount));
+        m_startupReport.workerThreads  = workerCount;
+
+        std::vector<std::thread> workers;
+        workers.reserve(workerCount);
+        for (uint32_t w = 0; w < workerCount; ++w)
+        {
+            workers.emplace_back([this, &schedule, &timings, startTime]()
+            {
+                std::unique_lock<std::mutex> lock(schedule.mutex);
+                while (true)
+                {
+                    schedule.changed.wait(lock, [&schedule]() { return schedule.stopWorkers || !schedule.workerQueue.empty(); });
+                    if (schedule.stopWorkers)
+                    {
+                        return;
+                    }
+
+                    const size_t index = schedule.workerQueue.front();
+                    schedule.workerQueue.pop_front();
+                    lock.unlock();
+
+                    std::exception_ptr error;
+                    try
+                    {
+                        StartupSubsystem(m_startupOrder[index], startTime, true, timings[index]);
+                    }
+                    catch (...)
+                    {
+                        error = std::current_exception();
+                    }
+
+                    lock.lock();
+                    if (error && !schedule.firstError)
+                    {
+                        schedule.firstError = error;
+                    }
+                    schedule.MarkDone(index);
+                }
+            });
+        }
+
+        auto mainThreadWork = [&]()
+        {
+            std::unique_lock<std::mutex> lock(schedule.mutex);
+            for (size_t i = 0; i < count; ++i)
+            {
+                if (schedule.offMainThread[i] && schedule.remaining[i] == 0 && !schedule.done[i])
+                {
+                    schedule.workerQueue.push_back(i);
+                }
+            }
+            schedule.changed.notify_all();
+
+            for (size_t i = 0; i < count; ++i)
+            {
+                if (schedule.offMainThread[i])
+                {
+                    continue;
+                }
+
+                schedule.changed.wait(lock, [&schedule, i]() { return schedule.remaining[i] == 0; });
+                if (!m_subsystemsByName[m_startupOrder[i]->GetSubsystemName()]->isStarted)
+                {
+                    lock.unlock();
+                    StartupSubsystem(m_startupOrder[i], startTime, false, timings[i]);
+                    lock.lock();
+                }
+                schedule.MarkDone(i);
             }
+
+            schedule.changed.wait(lock, [&schedule, count]() { return schedule.doneCount == count; });
+        };
+
+        std::exception_ptr mainThreadError;
+        try
+        {
+            mainThreadWork();
+        }
+        catch (...)
+        {
+            mainThreadError = std::current_exception();
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(schedule.mutex);
+            schedule.stopWorkers = true;
+            schedule.workerQueue.clear(); // Nothing new may start after a main-thread failure
+        }
+        schedule.changed.notify_all();
+        for (std::thread& worker : workers)
+        {
+            worker.join();
+        }
+
+        // Record results in completion order
+        std::vector<size_t> completed;
+        for (size_t i = 0; i < count; ++i)
+        {
+            if (schedule.done[i])
+            {
+                m_subsystemsByName[m_startupOrder[i]->GetSubsystemName()]->isStarted = true;
+                if (!timings[i].name.empty())
+                {
+                    completed.push_back(i);
+                }
+            }
+        }
+        std::sort(completed.begin(), completed.end(), [&timings](size_t a, size_t b)
+        {
+            return timings[a].startMs + timings[a].durationMs < timings[b].startMs + timings[b].durationMs;
+        });
+        for (size_t index : completed)
+        {
+            m_startupReport.summedMs += timings[index].durationMs;
+            m_startupReport.subsystems.push_back(std::move(timings[index]));
+        }
+
+        if (mainThreadError)
+        {
+            std::rethrow_exception(mainThreadError);
+        }
+        if (schedule.firstError)
+        {
+            std::rethrow_exception(schedule.firstError);
         }
     }
 
@@ -133,23 +395,6 @@ namespace enigma::core
         }
     }
 
-    void SubsystemManager::SortSubsystemsByPriority()
-    {
-        std::vector<EngineSubsystem*> subsystems;
-        for (const auto& pair : m_subsystemsByName)
-        {
-            subsystems.push_back(pair.second->subsystem.get());
-        }
-
-        std::sort(subsystems.begin(), subsystems.end(),
-                  [](const EngineSubsystem* a, const EngineSubsystem* b)
-                  {
-                      return a->GetPriority() < b->GetPriority();
-                  });
-
-        m_startupOrder = std::move(subsystems);
-    }
-
     void SubsystemManager::ValidateDependencies()
     {
         for (const auto& pair : m_subsystemsByName)
@@ -169,11 +414,122 @@ namespace enigma::core
 
     void SubsystemManager::CreateStartupOrder()
     {
+        // Dependencies are re-read here: subsystems are usually registered before LoadConfiguration
+        for (auto& [name, entry] : m_subsystemsByName)
+        {
+            entry->dependencies = GetSubsystemDependencies(name);
+        }
+
         ValidateDependencies();
 
-        // Simple priority-based ordering for now
-        // Future enhancement: Implement proper topological sort for dependencies
-        SortSubsystemsByPriority();
+        const std::string cycle = FindDependencyCycle();
+        if (!cycle.empty())
+        {
+            ERROR_AND_DIE("Subsystem dependency cycle: " + cycle);
+        }
+
+        // Kahn's algorithm; among ready subsystems the lowest priority (then name) goes first,
+        // so subsystems without declared dependencies keep their priority order
+        std::unordered_map<std::string, size_t>                   unmetDependencies;
+        std::unordered_map<std::string, std::vector<std::string>> dependents;
+        for (const auto& [name, entry] : m_subsystemsByName)
+        {
+            size_t& unmet = unmetDependencies[name];
+            for (const std::string& dependency : entry->dependencies)
+            {
+                if (m_subsystemsByName.count(dependency) > 0)
+                {
+                    ++unmet;
+                    dependents[dependency].push_back(name);
+                }
+            }
+        }
+
+        auto readyFirst = [this](const std::string& a, const std::string& b)
+        {
+            const int priorityA = m_subsystemsByName.at(a)->subsystem->GetPriority();
+            const int priorityB = m_subsystemsByName.at(b)->subsystem->GetPriority();
+            return priorityA != priorityB ? priorityA < priorityB : a < b;
+        };
+        std::set<std::string, decltype(readyFirst)> ready(readyFirst);
+        for (const auto& [name, unmet] : unmetDependencies)
+        {
+            if (unmet == 0)
+            {
+                ready.insert(name);
+            }
+        }
+
+        m_startupOrder.clear();
+        while (!ready.empty())
+        {
+            const std::string name = *ready.begin();
+            ready.erase(ready.begin());
+            m_startupOrder.push_back(m_subsystemsByName[name]->subsystem.get());
+
+            for (const std::string& dependent : dependents[name])
+            {
+                if (--unmetDependencies[dependent] == 0)
+                {
+                    ready.insert(dependent);
+                }
+            }
+        }
+    }
+
+    std::string SubsystemManager::FindDependencyCycle() const
+    {
+        enum class Mark { Unvisited, InProgress, Done };
+
+        std::vector<std::string> names;
+        for (const auto& pair : m_subsystemsByName)
+        {
+            names.push_back(pair.first);
+        }
+        std::sort(names.begin(), names.end()); // Deterministic report
+
+        std::unordered_map<std::string, Mark> marks;
+        std::vector<std::string>              path;
+        std::string                           cycle;
+
+        std::function<bool(const std::string&)> visit = [&](const std::string& name)
+        {
+            marks[name] = Mark::InProgress;
+            path.push_back(name);
+            for (const std::string& dependency : m_subsystemsByName.at(name)->dependencies)
+            {
+                if (m_subsystemsByName.count(dependency) == 0)
+                {
+                    continue; // Reported by ValidateDependencies
+                }
+                if (marks[dependency] == Mark::InProgress)
+                {
+                    auto first = std::find(path.begin(), path.end(), dependency);
+                    for (auto it = first; it != path.end(); ++it)
+                    {
+                        cycle += *it + " -> ";
+                    }
+                    cycle += dependency;
+                    return true;
+                }
+                if (marks[dependency] == Mark::Unvisited && visit(dependency))
+                {
+                    return true;
+                }
+            }
+            path.pop_back();
+            marks[name] = Mark::Done;
+            return false;
+        };
+
+        for (const std::string& name : names)
+        {
+            if (marks[name] == Mark::Unvisited && visit(name))
+            {
+                break;
+            }
+        }
+        return cycle;
     }
 
     std::vector<std::string> SubsystemManager::GetEnabledModules() const
@@ -1,4 +1,6 @@
 ﻿#pragma once
+#include <chrono>
+#include <cstdint>
 #include <string>
 #include <memory>
 #include <unordered_map>
@@ -29,6 +31,11 @@ namespace enigma::core
         virtual bool        RequiresGameLoop() const { return true; }
         virtual bool        RequiresInitialize() const { return false; } // Only for subsystems that need early init
 
+        // Startup() may run on a startup worker thread, concurrently with other subsystems.
+        // Only declared dependencies (moduleConfig.<name>.dependencies) are guaranteed to have
+        // started first, and subsystems that use this one during their own startup must declare it.
+        virtual bool CanStartOffMainThread() const { return false; }
+
         // Lifecycle methods for game loop subsystems
         virtual void BeginFrame()
         {
@@ -48,6 +55,23 @@ namespace enigma::core
             int GetPriority() const override { return Priority; }
     };
 
+    /// Wall-clock timing of one subsystem's Startup(), relative to the start of StartupAllSubsystems
+    struct SubsystemStartupTiming
+    {
+        std::string name;
+        double      startMs       = 0.0;
+        double      durationMs    = 0.0;
+        bool        offMainThread = false;
+    };
+
+    struct SubsystemStartupReport
+    {
+        double                              wallMs        = 0.0; // Whole StartupAllSubsystems call
+        double                              summedMs      = 0.0; // Serial cost: sum of all Startup() durations
+        uint32_t                            workerThreads = 0;
+        std::vector<SubsystemStartupTiming> subsystems; // In completion order
+    };
+
     class SubsystemManager
     {
     public:
@@ -82,6 +106,16 @@ namespace enigma::core
         void StartupAllSubsystems(); // Second phase: Main startup after all Initialize phases
         void ShutdownAllSubsystems();
 
+        // Parallel startup (engine.parallelStartup, default on): subsystems that CanStartOffMainThread()
+        // start on worker threads as soon as their dependencies are up; the rest keep their order on
+        // the main thread. When disabled every subsystem starts serially in dependency order.
+        void                          SetParallelStartupEnabled(bool enabled) { m_parallelStartup = enabled; }
+        bool                          IsParallelStartupEnabled() const { return m_parallelStartup; }
+        const SubsystemStartupReport& GetStartupReport() const { return m_startupReport; }
+
+        // "a -> b -> a" for the first dependency cycle found among registered subsystems, else empty
+        std::string FindDependencyCycle() const;
+
         // Game loop methods (only for subsystems that require game loop)
         void BeginFrameAllSubsystems();
         void UpdateAllSubsystems(float deltaTime);
@@ -96,20 +130,27 @@ namespace enigma::core
             bool                             isStarted = false;
         };
 
+        struct StartupSchedule; // Shared state of one parallel startup run (SubsystemManager.cpp)
+
         // Storage
         std::unordered_map<std::type_index, EngineSubsystem*>            m_subsystemsByType;
         std::unordered_map<std::string, std::unique_ptr<SubsystemEntry>> m_subsystemsByName;
         std::vector<EngineSubsystem*>                                    m_startupOrder;
         std::vector<EngineSubsystem*>                                    m_gameLoopSubsystems;
+        bool                                                             m_parallelStartup = true;
+        SubsystemStartupReport                                           m_startupReport;
 
         // Configuration
         YamlConfiguration m_engineConfig;
         YamlConfiguration m_moduleConfig;
 
         // Internal methods
-        void                     SortSubsystemsByPriority();
         void                     ValidateDependencies();
-        void                     CreateStartupOrder();
+        void                     CreateStartupOrder(); // Topological order, lowest priority first among ready subsystems
+        void                     StartupSerially(std::chrono::steady_clock::time_point startTime);
+        void                     StartupInParallel(std::chrono::steady_clock::time_point startTime);
+        void                     StartupSubsystem(EngineSubsystem* subsystem, std::chrono::steady_clock::time_point startTime,
+                                                  bool offMainThread, SubsystemStartupTiming& outTiming);
         std::vector<std::string> GetEnabledModules() const;
         std::vector<std::string> GetSubsystemDependencies(const std::string& subsystemName) const;
     };
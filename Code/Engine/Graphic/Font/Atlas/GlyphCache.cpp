@@ -0,0 +1,454 @@
+#include "Engine/Graphic/Font/Atlas/GlyphCache.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <string>
+#include <utility>
+
+#include "Engine/Graphic/Font/Exception/FontException.hpp"
+
+namespace enigma::graphic
+{
+    namespace
+    {
+        void ValidateCacheSettings(const TrueTypeFont& font, const GlyphCacheSettings& settings)
+        {
+            if (!font.IsLoaded())
+            {
+                throw FontConfigurationException("Cannot create glyph cache from an unloaded TrueType font");
+            }
+
+            if (!std::isfinite(settings.pixelHeight) || settings.pixelHeight <= 0.0f)
+            {
+                throw FontConfigurationException(
+                    "Glyph cache pixel height must be positive and finite: " + std::to_string(settings.pixelHeight));
+            }
+
+            if (settings.padding < 0)
+            {
+                throw FontConfigurationException(
+                    "Glyph cache padding must be non-negative: " + std::to_string(settings.padding));
+            }
+
+            if (settings.pageSize.x <= 0 || settings.pageSize.y <= 0)
+            {
+                throw FontConfigurationException(
+                    "Glyph cache page size must be positive: " + settings.pageSize.toString());
+            }
+
+            if (settings.rasterThreadCount < 0)
+            {
+                throw FontConfigurationException(
+                    "Glyph cache raster thread count must be non-negative: " + std::to_string(settings.rasterThreadCount));
+            }
+        }
+
+        AABB2 CalculatePageUvBounds(const IntVec2& position, const IntVec2& size, const IntVec2& pageSize)
+        {
+            const float invWidth  = 1.0f / static_cast<float>(pageSize.x);
+            const float invHeight = 1.0f / static_cast<float>(pageSize.y);
+
+            return AABB2(
+                static_cast<float>(position.x) * invWidth,
+                static_cast<float>(position.y) * invHeight,
+                static_cast<float>(position.x + size.x) * invWidth,
+                static_cast<float>(position.y + size.y) * invHeight);
+        }
+    } // namespace
+
+    GlyphCache::GlyphCache(const TrueTypeFont& font, const GlyphCacheSettings& settings)
+        : m_font(font)
+        , m_settings(settings)
+    {
+        ValidateCacheSettings(font, settings);
+        m_verticalMetrics = font.GetVerticalMetrics(settings.pixelHeight);
+
+        m_workers.reserve(static_cast<size_t>(settings.rasterThreadCount));
+        for (int index = 0; index < settings.rasterThreadCount; ++index)
+        {
+            m_workers.emplace_back(&GlyphCache::WorkerMain, this);
+        }
+    }
+
+    GlyphCache::~GlyphCache()
+    {
+        {
+            std::lock_guard<std::mutex> lock(m_jobMutex);
+            m_stopping = true;
+        }
+        m_jobAvailable.notify_all();
+
+        for (std::thread& worker : m_workers)
+        {
+            if (worker.joinable())
+            {
+                worker.join();
+            }
+        }
+    }
+
+    void GlyphCache::BeginFrame()
+    {
+        ++m_frameIndex;
+        PackCompletedGlyphs();
+    }
+
+    GlyphCacheLookup GlyphCache::Request(uint32_t codepoint)
+    {
+        const auto iter = m_glyphs.find(codepoint);
+        if (iter != m_glyphs.end())
+        {
+            CachedGlyph& glyph  = iter->second;
+            glyph.lastUsedFrame = m_frameIndex;
+            if (glyph.page >= 0)
+            {
+                m_pages[static_cast<size_t>(glyph.page)].lastUsedFrame = m_frameIndex;
+            }
+
+            if (glyph.pending)
+            {
+                ++m_stats.pendingRequests;
+            }
+            else
+            {
+                ++m_stats.hits;
+            }
+            return {&glyph.entry, glyph.page, glyph.pending};
+        }
+
+        ++m_stats.misses;
+
+        GlyphLookupResult lookup = m_font.FindGlyph(codepoint);
+        if (!lookup.found && m_settings.missingPolicy == GlyphMissingPolicy::Strict)
+        {
+            throw AtlasBuildException(
+                "Missing glyph U+" + std::to_string(codepoint) +
+                " requested from strict glyph cache for path='" + m_font.GetFilePath().string() + "'");
+        }
+
+        // Metrics are cheap and let layout advance the pen while the bitmap is still rasterizing
+        CachedGlyph& glyph           = m_glyphs[codepoint];
+        glyph.entry.codepoint        = codepoint;
+        glyph.entry.glyphIndex       = lookup.glyphIndex;
+        glyph.entry.found            = lookup.found;
+        glyph.entry.isFallbackGlyph  = lookup.isFallbackGlyph;
+        glyph.entry.metrics          = m_font.GetGlyphMetrics(codepoint, m_settings.pixelHeight);
+        glyph.lastUsedFrame          = m_frameIndex;
+
+        if (m_workers.empty())
+        {
+            GlyphBitmap bitmap = m_font.RasterizeGlyph(codepoint, m_settings.pixelHeight);
+            ++m_stats.rasterized;
+            if (!PlaceGlyph(glyph, bitmap))
+            {
+                ++m_stats.deferredGlyphs;
+                m_deferred.push_back({codepoint, std::move(bitmap), nullptr});
+            }
+            return {&glyph.entry, glyph.page, glyph.pending};
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(m_jobMutex);
+            m_jobQueue.push_back(codepoint);
+            ++m_jobsInFlight;
+        }
+        m_jobAvailable.notify_one();
+
+        return {&glyph.entry, -1, true};
+    }
+
+    void GlyphCache::WaitForPendingGlyphs()
+    {
+        {
+            std::unique_lock<std::mutex> lock(m_jobMutex);
+            m_jobsIdle.wait(lock, [this]() { return m_jobsInFlight == 0; });
+        }
+        PackCompletedGlyphs();
+    }
+
+    const FontVerticalMetrics& GlyphCache::GetVerticalMetrics() const noexcept
+    {
+        return m_verticalMetrics;
+    }
+
+    const GlyphCacheSettings& GlyphCache::GetSettings() const noexcept
+    {
+        return m_settings;
+    }
+
+    const std::vector<GlyphCachePage>& GlyphCache::GetPages() const noexcept
+    {
+        return m_pages;
+    }
+
+    GlyphCacheStats GlyphCache::GetStats() const
+    {
+        GlyphCacheStats stats = m_stats;
+        stats.residentGlyphs  = m_glyphs.size() - GetPendingGlyphCount();
+        stats.pageCount       = m_pages.size();
+        stats.pageBytes       = m_pages.size() * static_cast<size_t>(m_settings.pageSize.x) * static_cast<size_t>(m_settings.pageSize.y);
+        return stats;
+    }
+
+    uint64_t GlyphCache::GetFrameIndex() const noexcept
+    {
+        return m_frameIndex;
+    }
+
+    size_t GlyphCache::GetPendingGlyphCount() const
+    {
+        return static_cast<size_t>(std::count_if(m_glyphs.begin(), m_glyphs.end(), [](const auto& pair) {
+            return pair.second.pending;
+        }));
+    }
+
+    void GlyphCache::WorkerMain()
+    {
+        while (true)
+        {
+            uint32_t codepoint = 0;
+            {
+                std::unique_lock<std::mutex> lock(m_jobMutex);
+                m_jobAvailable.wait(lock, [this]() { return m_stopping || !m_jobQueue.empty(); });
+                if (m_stopping)
+                {
+                    return;
+                }
+
+                codepoint = m_jobQueue.front();
+                m_jobQueue.pop_front();
+            }
+
+            // TrueTypeFont only reads the shared font data, so rasterization needs no lock
+            RasterizedGlyph result;
+            result.codepoint = codepoint;
+            try
+            {
+                result.bitmap = m_font.RasterizeGlyph(codepoint, m_settings.pixelHeight);
+            }
+            catch (...)
+            {
+                result.error = std::current_exception();
+            }
+
+            std::lock_guard<std::mutex> lock(m_jobMutex);
+            m_completed.push_back(std::move(result));
+            if (--m_jobsInFlight == 0)
+            {
+                m_jobsIdle.notify_all();
+            }
+        }
+    }
+
+    void GlyphCache::PackCompletedGlyphs()
+    {
+        // Deferred glyphs first: they have waited longest for a page
+        std::vector<RasterizedGlyph> work;
+        work.swap(m_deferred);
+        {
+            std::lock_guard<std::mutex> lock(m_jobMutex);
+            work.reserve(work.size() + m_completed.size());
+            for (RasterizedGlyph& completed : m_completed)
+            {
+                work.push_back(std::move(completed));
+                ++m_stats.rasterized;
+            }
+            m_completed.clear();
+        }
+
+        std::exception_ptr firstError;
+        for (RasterizedGlyph& result : work)
+        {
+            const auto iter = m_glyphs.find(result.codepoint);
+            if (iter == m_glyphs.end())
+            {
+                continue;
+            }
+
+            if (result.error)
+            {
+                // Forget the glyph so a later request retries, and report the failure once everything else is packed
+                m_glyphs.erase(iter);
+                if (!firstError)
+                {
+                    firstError = result.error;
+                }
+                continue;
+            }
+
+            if (!PlaceGlyph(iter->second, result.bitmap))
+            {
+                ++m_stats.deferredGlyphs;
+                m_deferred.push_back(std::move(result));
+            }
+        }
+
+        if (firstError)
+        {
+            std::rethrow_exception(firstError);
+        }
+    }
+
+    bool GlyphCache::PlaceGlyph(CachedGlyph& glyph, const GlyphBitmap& bitmap)
+    {
+        GlyphAtlasEntry& entry = glyph.entry;
+        entry.bitmapSize       = IntVec2(bitmap.width, bitmap.height);
+        entry.bitmapOffset     = IntVec2(bitmap.offsetX, bitmap.offsetY);
+        entry.hasVisiblePixels = bitmap.width > 0 && bitmap.height > 0 && !bitmap.pixels.empty();
+
+        if (!entry.hasVisiblePixels)
+        {
+            glyph.page    = -1;
+            glyph.pending = false;
+            return true;
+        }
+
+        const IntVec2 cellSize(bitmap.width + m_settings.padding * 2, bitmap.height + m_settings.padding * 2);
+        if (cellSize.x > m_settings.pageSize.x || cellSize.y > m_settings.pageSize.y)
+        {
+            throw AtlasBuildException(
+                "Glyph U+" + std::to_string(entry.codepoint) + " does not fit a glyph cache page of " +
+                m_settings.pageSize.toString());
+        }
+
+        // Existing pages, then a new page within budget, then the least recently used page
+        int     pageIndex = -1;
+        IntVec2 cellPosition;
+        for (size_t index = 0; index < m_pages.size() && pageIndex < 0; ++index)
+        {
+            if (TryPackInPage(index, cellSize, cellPosition))
+            {
+                pageIndex = static_cast<int>(index);
+            }
+        }
+
+        if (pageIndex < 0 && m_pages.size() < GetMaxPageCount())
+        {
+            AddPage();
+            if (TryPackInPage(m_pages.size() - 1, cellSize, cellPosition))
+            {
+                pageIndex = static_cast<int>(m_pages.size() - 1);
+            }
+        }
+
+        if (pageIndex < 0)
+        {
+            const int victim = FindEvictablePage();
+            if (victim < 0)
+            {
+                return false; // Every page is in use this frame; retry next frame
+            }
+
+            EvictPage(static_cast<size_t>(victim));
+            if (!TryPackInPage(static_cast<size_t>(victim), cellSize, cellPosition))
+            {
+                return false;
+            }
+            pageIndex = victim;
+        }
+
+        GlyphCachePage& page = m_pages[static_cast<size_t>(pageIndex)];
+        entry.atlasPosition  = cellPosition + IntVec2(m_settings.padding, m_settings.padding);
+        entry.uvBounds       = CalculatePageUvBounds(entry.atlasPosition, entry.bitmapSize, m_settings.pageSize);
+
+        for (int y = 0; y < bitmap.height; ++y)
+        {
+            const size_t sourceOffset = static_cast<size_t>(y) * static_cast<size_t>(bitmap.stride);
+            const size_t destOffset   =
+                static_cast<size_t>(entry.atlasPosition.y + y) * static_cast<size_t>(m_settings.pageSize.x) +
+                static_cast<size_t>(entry.atlasPosition.x);
+            std::memcpy(page.pixels.data() + destOffset, bitmap.pixels.data() + sourceOffset, static_cast<size_t>(bitmap.width));
+        }
+
+        // Placing counts as use, so a later glyph in the same frame cannot evict this one
+        ++page.generation;
+        page.lastUsedFrame = m_frameIndex;
+        m_pageLayouts[static_cast<size_t>(pageIndex)].codepoints.push_back(entry.codepoint);
+
+        glyph.page    = pageIndex;
+        glyph.pending = false;
+        return true;
+    }
+
+    bool GlyphCache::TryPackInPage(size_t pageIndex, const IntVec2& cellSize, IntVec2& outPosition)
+    {
+        PageLayout& layout = m_pageLayouts[pageIndex];
+
+        // Shelf with room whose height wastes the fewest rows
+        Shelf* best = nullptr;
+        for (Shelf& shelf : layout.shelves)
+        {
+            if (shelf.height >= cellSize.y && m_settings.pageSize.x - shelf.cursorX >= cellSize.x &&
+                (best == nullptr || shelf.height < best->height))
+            {
+                best = &shelf;
+            }
+        }
+
+        if (best != nullptr)
+        {
+            outPosition = IntVec2(best->cursorX, best->y);
+            best->cursorX += cellSize.x;
+            return true;
+        }
+
+        if (layout.nextShelfY + cellSize.y > m_settings.pageSize.y)
+        {
+            return false;
+        }
+
+        layout.shelves.push_back({layout.nextShelfY, cellSize.y, cellSize.x});
+        outPosition = IntVec2(0, layout.nextShelfY);
+        layout.nextShelfY += cellSize.y;
+        return true;
+    }
+
+    int GlyphCache::FindEvictablePage() const
+    {
+        int      victim     = -1;
+        uint64_t oldestUsed = m_frameIndex;
+        for (size_t index = 0; index < m_pages.size(); ++index)
+        {
+            if (m_pages[index].lastUsedFrame < oldestUsed)
+            {
+                oldestUsed = m_pages[index].lastUsedFrame;
+                victim     = static_cast<int>(index);
+            }
+        }
+        return victim;
+    }
+
+    void GlyphCache::EvictPage(size_t pageIndex)
+    {
+        PageLayout& layout = m_pageLayouts[pageIndex];
+        for (uint32_t codepoint : layout.codepoints)
+        {
+            m_glyphs.erase(codepoint);
+        }
+
+        m_stats.evictedGlyphs += layout.codepoints.size();
+        ++m_stats.evictedPages;
+
+        layout = PageLayout();
+
+        GlyphCachePage& page = m_pages[pageIndex];
+        std::fill(page.pixels.begin(), page.pixels.end(), static_cast<uint8_t>(0));
+        page.lastUsedFrame = 0;
+        ++page.generation;
+    }
+
+    void GlyphCache::AddPage()
+    {
+        GlyphCachePage page;
+        page.pixels.assign(static_cast<size_t>(m_settings.pageSize.x) * static_cast<size_t>(m_settings.pageSize.y), 0u);
+        m_pages.push_back(std::move(page));
+        m_pageLayouts.emplace_back();
+    }
+
+    size_t GlyphCache::GetMaxPageCount() const noexcept
+    {
+        const size_t pageBytes = static_cast<size_t>(m_settings.pageSize.x) * static_cast<size_t>(m_settings.pageSize.y);
+        return std::max<size_t>(1, m_settings.memoryBudgetBytes / pageBytes);
+    }
+} // namespace enigma::graphic
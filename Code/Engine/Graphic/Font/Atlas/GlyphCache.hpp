@@ -0,0 +1,155 @@
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include "Engine/Graphic/Font/Atlas/GlyphAtlas.hpp"
+#include "Engine/Graphic/Font/Atlas/GlyphBitmap.hpp"
+#include "Engine/Graphic/Font/TrueType/TrueTypeFont.hpp"
+#include "Engine/Math/IntVec2.hpp"
+
+namespace enigma::graphic
+{
+    struct GlyphCacheSettings
+    {
+        float              pixelHeight       = 0.0f;
+        int                padding           = 1;
+        IntVec2            pageSize          = IntVec2(512, 512);
+        size_t             memoryBudgetBytes = 4u * 512u * 512u; // Page pixels; at least one page is always kept
+        int                rasterThreadCount = 1; // 0 rasterizes inside Request() on the calling thread
+        GlyphMissingPolicy missingPolicy     = GlyphMissingPolicy::UseFallbackGlyph;
+    };
+
+    struct GlyphCacheLookup
+    {
+        // Metrics are valid as soon as a glyph is requested; atlasPosition, bitmapSize,
+        // bitmapOffset and uvBounds (relative to the page) only once it is resident.
+        const GlyphAtlasEntry* entry   = nullptr;
+        int                    page    = -1; // Page holding the bitmap, -1 while pending or for blank glyphs
+        bool                   pending = false; // Still rasterizing; draw it in a later frame
+    };
+
+    struct GlyphCacheStats
+    {
+        uint64_t hits            = 0;
+        uint64_t misses          = 0; // Requests that started a rasterization
+        uint64_t pendingRequests = 0; // Requests for glyphs still rasterizing
+        uint64_t rasterized      = 0;
+        uint64_t evictedPages    = 0;
+        uint64_t evictedGlyphs   = 0;
+        uint64_t deferredGlyphs  = 0; // Placements postponed because every page was used this frame
+        size_t   residentGlyphs  = 0;
+        size_t   pageCount       = 0;
+        size_t   pageBytes       = 0;
+    };
+
+    struct GlyphCachePage
+    {
+        std::vector<uint8_t> pixels; // AlphaCoverage8, stride = page width
+        uint64_t             lastUsedFrame = 0;
+        uint32_t             generation    = 0; // Bumped whenever pixels change, so page textures know to re-upload
+    };
+
+    // On-demand glyph atlas for large or open-ended character sets.
+    //
+    // A glyph is rasterized the first time it is requested and packed into
+    // fixed-size pages with a shelf packer. Every request stamps the glyph's page
+    // with the current frame; when a new glyph fits in no page and the memory
+    // budget allows no further page, the least recently used page that was not
+    // touched this frame is cleared and reused. Glyphs on an evicted page are
+    // simply rasterized again on their next request.
+    //
+    // With rasterThreadCount > 0 rasterization runs on the cache's worker threads:
+    // Request() returns a pending lookup and BeginFrame() packs whatever finished.
+    // Everything except the rasterization itself runs on the owning thread.
+    class GlyphCache final
+    {
+    public:
+        GlyphCache(const TrueTypeFont& font, const GlyphCacheSettings& settings);
+        ~GlyphCache();
+
+        GlyphCache(const GlyphCache&)            = delete;
+        GlyphCache& operator=(const GlyphCache&) = delete;
+
+        // Advance the frame clock and pack glyphs rasterized since the last frame
+        void BeginFrame();
+
+        GlyphCacheLookup Request(uint32_t codepoint);
+
+        // Block until no rasterization is in flight, then pack the results
+        void WaitForPendingGlyphs();
+
+        const FontVerticalMetrics&         GetVerticalMetrics() const noexcept;
+        const GlyphCacheSettings&          GetSettings() const noexcept;
+        const std::vector<GlyphCachePage>& GetPages() const noexcept;
+        GlyphCacheStats                    GetStats() const;
+        uint64_t                           GetFrameIndex() const noexcept;
+        size_t                             GetPendingGlyphCount() const;
+
+    private:
+        struct Shelf
+        {
+            int y       = 0;
+            int height  = 0;
+            int cursorX = 0;
+        };
+
+        struct PageLayout
+        {
+            std::vector<Shelf>    shelves;
+            int                   nextShelfY = 0;
+            std::vector<uint32_t> codepoints; // Glyphs to drop when the page is evicted
+        };
+
+        struct CachedGlyph
+        {
+            GlyphAtlasEntry entry;
+            int             page          = -1;
+            bool            pending       = true;
+            uint64_t        lastUsedFrame = 0;
+        };
+
+        struct RasterizedGlyph
+        {
+            uint32_t           codepoint = 0;
+            GlyphBitmap        bitmap;
+            std::exception_ptr error;
+        };
+
+        void WorkerMain();
+        void PackCompletedGlyphs();
+        bool PlaceGlyph(CachedGlyph& glyph, const GlyphBitmap& bitmap);
+        bool TryPackInPage(size_t pageIndex, const IntVec2& cellSize, IntVec2& outPosition);
+        int  FindEvictablePage() const;
+        void EvictPage(size_t pageIndex);
+        void AddPage();
+        size_t GetMaxPageCount() const noexcept;
+
+        const TrueTypeFont& m_font;
+        GlyphCacheSettings  m_settings;
+        FontVerticalMetrics m_verticalMetrics;
+        uint64_t            m_frameIndex = 1;
+
+        std::unordered_map<uint32_t, CachedGlyph> m_glyphs; // Node-based: lookups stay valid until their page is evicted
+        std::vector<GlyphCachePage>               m_pages;
+        std::vector<PageLayout>                   m_pageLayouts;
+        std::vector<RasterizedGlyph>              m_deferred; // Rasterized, waiting for an evictable page
+        GlyphCacheStats                           m_stats;
+
+        mutable std::mutex           m_jobMutex;
+        std::condition_variable      m_jobAvailable;
+        std::condition_variable      m_jobsIdle;
+        std::deque<uint32_t>         m_jobQueue;
+        std::vector<RasterizedGlyph> m_completed;
+        size_t                       m_jobsInFlight = 0; // Queued + running
+        bool                         m_stopping     = false;
+        std::vector<std::thread>     m_workers;
+    };
+} // namespace enigma::graphic
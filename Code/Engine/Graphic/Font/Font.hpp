@@ -6,6 +6,7 @@
 #include "Engine/Graphic/Font/Atlas/GlyphMetrics.hpp"
 #include "Engine/Graphic/Font/Atlas/GlyphBitmap.hpp"
 #include "Engine/Graphic/Font/Atlas/GlyphAtlas.hpp"
+#include "Engine/Graphic/Font/Atlas/GlyphCache.hpp"
 #include "Engine/Graphic/Font/Layout/TextLayout.hpp"
 #include "Engine/Graphic/Font/Layout/VertexFont.hpp"
 #include "Engine/Graphic/Font/Render/FontRenderer.hpp"
@@ -65,6 +65,85 @@ namespace enigma::graphic
             bounds.m_maxs.x = std::max(bounds.m_maxs.x, glyphBounds.m_maxs.x);
             bounds.m_maxs.y = std::max(bounds.m_maxs.y, glyphBounds.m_maxs.y);
         }
+
+        struct ResolvedGlyph
+        {
+            const GlyphAtlasEntry* entry        = nullptr;
+            bool                   usedFallback = false;
+            int                    page         = 0;
+            bool                   pending      = false;
+        };
+
+        // Shared pen walk for the atlas and cache paths; resolveGlyph maps a codepoint to a ResolvedGlyph
+        template <typename Resolver>
+        TextLayoutResult LayoutGlyphs(
+            std::string_view           utf8Text,
+            const FontVerticalMetrics& vertical,
+            const TextLayoutSettings&  settings,
+            Resolver&&                 resolveGlyph)
+        {
+            const std::vector<DecodedCodepoint> decodedText = DecodeUtf8Text(utf8Text);
+
+            TextLayoutResult result;
+            result.lineHeight = vertical.lineHeight;
+            result.lineCount  = 1;
+            result.glyphs.reserve(decodedText.size());
+
+            float penX      = settings.origin.x;
+            float baselineY = settings.origin.y;
+
+            AABB2 visibleBounds(0.0f, 0.0f, 0.0f, 0.0f);
+            bool  hasVisibleBounds = false;
+
+            for (const DecodedCodepoint& decoded : decodedText)
+            {
+                if (IsNewline(decoded.codepoint))
+                {
+                    result.advanceWidth = std::max(result.advanceWidth, penX - settings.origin.x);
+                    penX                = settings.origin.x;
+                    baselineY -= result.lineHeight;
+                    ++result.lineCount;
+                    continue;
+                }
+
+                const ResolvedGlyph    resolved = resolveGlyph(decoded.codepoint);
+                const GlyphAtlasEntry& entry    = *resolved.entry;
+
+                TextLayoutGlyphQuad quad;
+                quad.codepoint        = decoded.codepoint;
+                quad.glyphIndex       = entry.glyphIndex;
+                quad.sourceByteOffset = decoded.byteOffset;
+                quad.baselinePosition = Vec2(penX, baselineY);
+                quad.advanceX         = entry.metrics.advanceX;
+                quad.isFallbackGlyph  = resolved.usedFallback || entry.isFallbackGlyph;
+                quad.atlasPage        = resolved.page;
+                quad.isPending        = resolved.pending;
+
+                if (resolved.pending)
+                {
+                    ++result.pendingGlyphCount;
+                }
+                else
+                {
+                    quad.uvBounds         = entry.uvBounds;
+                    quad.hasVisiblePixels = entry.hasVisiblePixels;
+                }
+
+                if (quad.hasVisiblePixels)
+                {
+                    quad.localBounds = BuildLocalBounds(penX, baselineY, entry);
+                    ExpandVisibleBounds(visibleBounds, quad.localBounds, hasVisibleBounds);
+                }
+
+                result.glyphs.push_back(quad);
+                penX += entry.metrics.advanceX;
+            }
+
+            result.advanceWidth = std::max(result.advanceWidth, penX - settings.origin.x);
+            result.visibleBounds = hasVisibleBounds ? visibleBounds : AABB2(0.0f, 0.0f, 0.0f, 0.0f);
+
+            return result;
+        }
     } // namespace
 
     TextLayout::TextLayout() = default;
@@ -85,58 +164,31 @@ namespace enigma::graphic
             throw FontConfigurationException("Cannot build text layout from an unbuilt glyph atlas");
         }
 
-        const std::vector<DecodedCodepoint> decodedText = DecodeUtf8Text(utf8Text);
-        const FontVerticalMetrics&          vertical    = atlas.GetVerticalMetrics();
-
-        TextLayoutResult result;
-        result.lineHeight = vertical.lineHeight;
-        result.lineCount  = 1;
-        result.glyphs.reserve(decodedText.size());
-
-        float penX      = settings.origin.x;
-        float baselineY = settings.origin.y;
-
-        AABB2 visibleBounds(0.0f, 0.0f, 0.0f, 0.0f);
-        bool  hasVisibleBounds = false;
-
-        for (const DecodedCodepoint& decoded : decodedText)
-        {
-            if (IsNewline(decoded.codepoint))
-            {
-                result.advanceWidth = std::max(result.advanceWidth, penX - settings.origin.x);
-                penX                = settings.origin.x;
-                baselineY -= result.lineHeight;
-                ++result.lineCount;
-                continue;
-            }
+        return LayoutGlyphs(utf8Text, atlas.GetVerticalMetrics(), settings, [&](uint32_t codepoint) {
+            ResolvedGlyph resolved;
+            resolved.entry = &ResolveEntry(atlas, codepoint, settings.missingPolicy, resolved.usedFallback);
+            return resolved;
+        });
+    }
 
-            bool                   usedFallback = false;
-            const GlyphAtlasEntry& entry        =
-                ResolveEntry(atlas, decoded.codepoint, settings.missingPolicy, usedFallback);
-
-            TextLayoutGlyphQuad quad;
-            quad.codepoint        = decoded.codepoint;
-            quad.glyphIndex       = entry.glyphIndex;
-            quad.sourceByteOffset = decoded.byteOffset;
-            quad.baselinePosition = Vec2(penX, baselineY);
-            quad.uvBounds         = entry.uvBounds;
-            quad.advanceX         = entry.metrics.advanceX;
-            quad.hasVisiblePixels = entry.hasVisiblePixels;
-            quad.isFallbackGlyph  = usedFallback || entry.isFallbackGlyph;
-
-            if (entry.hasVisiblePixels)
+    TextLayoutResult TextLayout::Build(
+        std::string_view          utf8Text,
+        GlyphCache&               cache,
+        const TextLayoutSettings& settings)
+    {
+        return LayoutGlyphs(utf8Text, cache.GetVerticalMetrics(), settings, [&](uint32_t codepoint) {
+            const GlyphCacheLookup lookup = cache.Request(codepoint);
+            if (!lookup.entry->found && settings.missingPolicy == TextLayoutMissingPolicy::Strict)
             {
-                quad.localBounds = BuildLocalBounds(penX, baselineY, entry);
-                ExpandVisibleBounds(visibleBounds, quad.localBounds, hasVisibleBounds);
+                throw FontConfigurationException(
+                    "Text layout codepoint has no glyph in the glyph cache font: " + std::to_string(codepoint));
             }
 
-            result.glyphs.push_back(quad);
-            penX += entry.metrics.advanceX;
-        }
-
-        result.advanceWidth = std::max(result.advanceWidth, penX - settings.origin.x);
-        result.visibleBounds = hasVisibleBounds ? visibleBounds : AABB2(0.0f, 0.0f, 0.0f, 0.0f);
-
-        return result;
+            ResolvedGlyph resolved;
+            resolved.entry   = lookup.entry;
+            resolved.page    = std::max(lookup.page, 0);
+            resolved.pending = lookup.pending;
+            return resolved;
+        });
     }
 } // namespace enigma::graphic
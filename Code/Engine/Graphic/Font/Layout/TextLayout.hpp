@@ -6,6 +6,7 @@
 #include <vector>
 
 #include "Engine/Graphic/Font/Atlas/GlyphAtlas.hpp"
+#include "Engine/Graphic/Font/Atlas/GlyphCache.hpp"
 #include "Engine/Math/AABB2.hpp"
 #include "Engine/Math/Vec2.hpp"
 
@@ -34,15 +35,18 @@ namespace enigma::graphic
         float    advanceX         = 0.0f;
         bool     hasVisiblePixels = false;
         bool     isFallbackGlyph  = false;
+        int      atlasPage        = 0; // GlyphCache page holding the bitmap; always 0 for a GlyphAtlas
+        bool     isPending        = false; // Still rasterizing in the GlyphCache; advances but has no bitmap yet
     };
 
     struct TextLayoutResult
     {
         std::vector<TextLayoutGlyphQuad> glyphs;
         AABB2                            visibleBounds;
-        float                            advanceWidth = 0.0f;
-        float                            lineHeight   = 0.0f;
-        int                              lineCount    = 0;
+        float                            advanceWidth      = 0.0f;
+        float                            lineHeight        = 0.0f;
+        int                              lineCount         = 0;
+        size_t                           pendingGlyphCount = 0;
     };
 
     class TextLayout final
@@ -60,5 +64,13 @@ namespace enigma::graphic
             std::string_view         utf8Text,
             const GlyphAtlas&        atlas,
             const TextLayoutSettings& settings = TextLayoutSettings{});
+
+        // Requests every glyph from the cache, rasterizing misses on demand.
+        // Pending glyphs keep their advance so the rest of the line does not shift
+        // once they become resident.
+        static TextLayoutResult Build(
+            std::string_view         utf8Text,
+            GlyphCache&              cache,
+            const TextLayoutSettings& settings = TextLayoutSettings{});
     };
 } // namespace enigma::graphic
@@ -0,0 +1,533 @@
+//-----------------------------------------------------------------------------------------------
+// NoiseBatch.cpp
+//
+#include "Engine/Math/NoiseBatch.hpp"
+#include "Engine/Math/RawNoise.hpp"
+#include "Engine/Math/SmoothNoise.hpp"
+
+#include <vector>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#define ENIGMA_NOISE_AVX2 1
+#elif defined(__SSE4_1__) || defined(__AVX__)
+#include <smmintrin.h>
+#define ENIGMA_NOISE_SSE41 1
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define ENIGMA_NOISE_SSE2 1
+#endif
+
+#if defined(ENIGMA_NOISE_AVX2) || defined(ENIGMA_NOISE_SSE41) || defined(ENIGMA_NOISE_SSE2)
+#define ENIGMA_NOISE_LANES 1
+#endif
+
+namespace
+{
+    // Constants shared with the scalar versions in RawNoise.hpp / SmoothNoise.cpp
+    constexpr unsigned int SQ5_BIT_NOISE1    = 0xd2a80a3f;
+    constexpr unsigned int SQ5_BIT_NOISE2    = 0xa884f197;
+    constexpr unsigned int SQ5_BIT_NOISE3    = 0x6C736F4B;
+    constexpr unsigned int SQ5_BIT_NOISE4    = 0xB79F3ABB;
+    constexpr unsigned int SQ5_BIT_NOISE5    = 0x1b56c4f5;
+    constexpr int          PRIME1            = 198491317;
+    constexpr int          PRIME2            = 6542989;
+    constexpr float        OCTAVE_OFFSET     = 0.636764989593174f;
+    constexpr float        fSQRT_3_OVER_3    = 0.57735026918962576450914878050196f;
+    constexpr float        GRADIENT_2D_MAJOR = 0.923879533f; // cos(22.5 degrees)
+    constexpr float        GRADIENT_2D_MINOR = 0.382683432f; // sin(22.5 degrees)
+
+    //-------------------------------------------------------------------------------------------
+    // Per-call setup the scalar functions redo for every point
+    //
+    struct PerlinOctaves
+    {
+        float              invScale       = 1.f;
+        float              octaveScale    = 2.f;
+        float              totalAmplitude = 0.f;
+        bool               renormalize    = true;
+        unsigned int       seed           = 0;
+        std::vector<float> amplitudes;
+
+        PerlinOctaves(float scale, unsigned int numOctaves, float octavePersistence, float inOctaveScale, bool inRenormalize, unsigned int inSeed)
+            : invScale(1.f / scale)
+              , octaveScale(inOctaveScale)
+              , renormalize(inRenormalize)
+              , seed(inSeed)
+        {
+            amplitudes.reserve(numOctaves);
+            float currentAmplitude = 1.f;
+            for (unsigned int octaveNum = 0; octaveNum < numOctaves; ++octaveNum)
+            {
+                amplitudes.push_back(currentAmplitude);
+                totalAmplitude += currentAmplitude;
+                currentAmplitude *= octavePersistence;
+            }
+        }
+
+        bool ShouldRenormalize() const { return renormalize && totalAmplitude > 0.f; }
+    };
+
+#if defined(ENIGMA_NOISE_AVX2)
+    //-------------------------------------------------------------------------------------------
+    struct Lanes
+    {
+        using F = __m256;
+        using I = __m256i;
+        static constexpr int kWidth = 8;
+
+        static F    Set(float value) { return _mm256_set1_ps(value); }
+        static I    SetI(unsigned int value) { return _mm256_set1_epi32(static_cast<int>(value)); }
+        static F    Ramp() { return _mm256_setr_ps(0.f, 1.f, 2.f, 3.f, 4.f, 5.f, 6.f, 7.f); }
+        static F    Load(const float* source) { return _mm256_loadu_ps(source); }
+        static I    LoadI(const int* source) { return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(source)); }
+        static void Store(float* destination, F value) { _mm256_storeu_ps(destination, value); }
+        static void StoreI(unsigned int* destination, I value) { _mm256_storeu_si256(reinterpret_cast<__m256i*>(destination), value); }
+
+        static F Add(F a, F b) { return _mm256_add_ps(a, b); }
+        static F Sub(F a, F b) { return _mm256_sub_ps(a, b); }
+        static F Mul(F a, F b) { return _mm256_mul_ps(a, b); }
+        static F Div(F a, F b) { return _mm256_div_ps(a, b); }
+        static F Floor(F a) { return _mm256_floor_ps(a); }
+        static I Truncate(F a) { return _mm256_cvttps_epi32(a); }
+        static F FlipSign(F a, I signBits) { return _mm256_xor_ps(a, _mm256_castsi256_ps(signBits)); }
+        static F Select(I mask, F whenSet, F whenClear) { return _mm256_blendv_ps(whenClear, whenSet, _mm256_castsi256_ps(mask)); }
+
+        static I AddI(I a, I b) { return _mm256_add_epi32(a, b); }
+        static I MulI(I a, I b) { return _mm256_mullo_epi32(a, b); }
+        static I XorI(I a, I b) { return _mm256_xor_si256(a, b); }
+        static I AndI(I a, I b) { return _mm256_and_si256(a, b); }
+        static I EqualI(I a, I b) { return _mm256_cmpeq_epi32(a, b); }
+        template <int N> static I ShrI(I a) { return _mm256_srli_epi32(a, N); }
+        template <int N> static I ShlI(I a) { return _mm256_slli_epi32(a, N); }
+    };
+#elif defined(ENIGMA_NOISE_SSE41) || defined(ENIGMA_NOISE_SSE2)
+    //-------------------------------------------------------------------------------------------
+    struct Lanes
+    {
+        using F = __m128;
+        using I = __m128i;
+        static constexpr int kWidth = 4;
+
+        static F    Set(float value) { return _mm_set1_ps(value); }
+        static I    SetI(unsigned int value) { return _mm_set1_epi32(static_cast<int>(value)); }
+        static F    Ramp() { return _mm_setr_ps(0.f, 1.f, 2.f, 3.f); }
+        static F    Load(const float* source) { return _mm_loadu_ps(source); }
+        static I    LoadI(const int* source) { return _mm_loadu_si128(reinterpret_cast<const __m128i*>(source)); }
+        static void Store(float* destination, F value) { _mm_storeu_ps(destination, value); }
+        static void StoreI(unsigned int* destination, I value) { _mm_storeu_si128(reinterpret_cast<__m128i*>(destination), value); }
+
+        static F Add(F a, F b) { return _mm_add_ps(a, b); }
+        static F Sub(F a, F b) { return _mm_sub_ps(a, b); }
+        static F Mul(F a, F b) { return _mm_mul_ps(a, b); }
+        static F Div(F a, F b) { return _mm_div_ps(a, b); }
+        static I Truncate(F a) { return _mm_cvttps_epi32(a); }
+        static F FlipSign(F a, I signBits) { return _mm_xor_ps(a, _mm_castsi128_ps(signBits)); }
+
+        static I AddI(I a, I b) { return _mm_add_epi32(a, b); }
+        static I XorI(I a, I b) { return _mm_xor_si128(a, b); }
+        static I AndI(I a, I b) { return _mm_and_si128(a, b); }
+        static I EqualI(I a, I b) { return _mm_cmpeq_epi32(a, b); }
+        template <int N> static I ShrI(I a) { return _mm_srli_epi32(a, N); }
+        template <int N> static I ShlI(I a) { return _mm_slli_epi32(a, N); }
+
+#if defined(ENIGMA_NOISE_SSE41)
+        static F Floor(F a) { return _mm_floor_ps(a); }
+        static I MulI(I a, I b) { return _mm_mullo_epi32(a, b); }
+        static F Select(I mask, F whenSet, F whenClear) { return _mm_blendv_ps(whenClear, whenSet, _mm_castsi128_ps(mask)); }
+#else
+        // Truncate, then step down where that rounded up; the sign bit of x keeps floor(-0) == -0
+        static F Floor(F a)
+        {
+            const F truncated = _mm_cvtepi32_ps(_mm_cvttps_epi32(a));
+            const F roundedUp = _mm_and_ps(_mm_cmpgt_ps(truncated, a), _mm_set1_ps(1.f));
+            return _mm_or_ps(_mm_sub_ps(truncated, roundedUp), _mm_and_ps(a, _mm_set1_ps(-0.f)));
+        }
+
+        // Low 32 bits of the even and odd lane products, re-interleaved
+        static I MulI(I a, I b)
+        {
+            const I even = _mm_mul_epu32(a, b);
+            const I odd  = _mm_mul_epu32(_mm_srli_si128(a, 4), _mm_srli_si128(b, 4));
+            return _mm_unpacklo_epi32(_mm_shuffle_epi32(even, _MM_SHUFFLE(0, 0, 2, 0)), _mm_shuffle_epi32(odd, _MM_SHUFFLE(0, 0, 2, 0)));
+        }
+
+        static F Select(I mask, F whenSet, F whenClear)
+        {
+            const F maskF = _mm_castsi128_ps(mask);
+            return _mm_or_ps(_mm_and_ps(maskF, whenSet), _mm_andnot_ps(maskF, whenClear));
+        }
+#endif
+    };
+#endif
+
+#if defined(ENIGMA_NOISE_LANES)
+    using F = Lanes::F;
+    using I = Lanes::I;
+
+    //-------------------------------------------------------------------------------------------
+    // SquirrelNoise5, one hash per lane
+    //
+    I SquirrelNoise5Lanes(I positionX, I seed)
+    {
+        I mangledBits = Lanes::MulI(positionX, Lanes::SetI(SQ5_BIT_NOISE1));
+        mangledBits   = Lanes::AddI(mangledBits, seed);
+        mangledBits   = Lanes::XorI(mangledBits, Lanes::ShrI<9>(mangledBits));
+        mangledBits   = Lanes::AddI(mangledBits, Lanes::SetI(SQ5_BIT_NOISE2));
+        mangledBits   = Lanes::XorI(mangledBits, Lanes::ShrI<11>(mangledBits));
+        mangledBits   = Lanes::MulI(mangledBits, Lanes::SetI(SQ5_BIT_NOISE3));
+        mangledBits   = Lanes::XorI(mangledBits, Lanes::ShrI<13>(mangledBits));
+        mangledBits   = Lanes::AddI(mangledBits, Lanes::SetI(SQ5_BIT_NOISE4));
+        mangledBits   = Lanes::XorI(mangledBits, Lanes::ShrI<15>(mangledBits));
+        mangledBits   = Lanes::MulI(mangledBits, Lanes::SetI(SQ5_BIT_NOISE5));
+        mangledBits   = Lanes::XorI(mangledBits, Lanes::ShrI<17>(mangledBits));
+        return mangledBits;
+    }
+
+    // Same operation order as SmoothStep3() in Easing.cpp: Interpolate( t^3, 1-(1-t)^3, t )
+    F SmoothStep3Lanes(F t)
+    {
+        const F one       = Lanes::Set(1.f);
+        const F start     = Lanes::Mul(Lanes::Mul(t, t), t);
+        const F oneMinusT = Lanes::Sub(one, t);
+        const F stop      = Lanes::Sub(one, Lanes::Mul(Lanes::Mul(oneMinusT, oneMinusT), oneMinusT));
+        return Lanes::Add(start, Lanes::Mul(Lanes::Sub(stop, start), t));
+    }
+
+    F RenormalizeLanes(F totalNoise, const PerlinOctaves& octaves)
+    {
+        totalNoise = Lanes::Div(totalNoise, Lanes::Set(octaves.totalAmplitude));
+        totalNoise = Lanes::Add(Lanes::Mul(totalNoise, Lanes::Set(0.5f)), Lanes::Set(0.5f));
+        totalNoise = SmoothStep3Lanes(totalNoise);
+        return Lanes::Sub(Lanes::Mul(totalNoise, Lanes::Set(2.f)), Lanes::Set(1.f));
+    }
+
+    //-------------------------------------------------------------------------------------------
+    // gradients[hash & 7] from Compute2dPerlinNoise, rebuilt from the index bits: entries 0,3,4,7
+    //	have the major component in X, entries 2-5 point west and entries 4-7 point south.
+    //
+    F Gradient2dDot(I noise, F displacementX, F displacementY)
+    {
+        const I index     = Lanes::AndI(noise, Lanes::SetI(7));
+        const I majorInX  = Lanes::EqualI(Lanes::AndI(Lanes::ShrI<1>(Lanes::AddI(index, Lanes::SetI(1))), Lanes::SetI(1)), Lanes::SetI(0));
+        const F major     = Lanes::Set(GRADIENT_2D_MAJOR);
+        const F minor     = Lanes::Set(GRADIENT_2D_MINOR);
+        const I signX     = Lanes::ShlI<31>(Lanes::ShrI<2>(Lanes::AddI(index, Lanes::SetI(2))));
+        const I signY     = Lanes::ShlI<31>(Lanes::ShrI<2>(index));
+        const F gradientX = Lanes::FlipSign(Lanes::Select(majorInX, major, minor), signX);
+        const F gradientY = Lanes::FlipSign(Lanes::Select(majorInX, minor, major), signY);
+        return Lanes::Add(Lanes::Mul(gradientX, displacementX), Lanes::Mul(gradientY, displacementY));
+    }
+
+    // gradients[hash & 7] from Compute3dPerlinNoise: cube corners, bit N of the index negates axis N
+    F Gradient3dDot(I noise, F displacementX, F displacementY, F displacementZ)
+    {
+        const I signBit   = Lanes::SetI(0x80000000u);
+        const F component = Lanes::Set(fSQRT_3_OVER_3);
+        const F gradientX = Lanes::FlipSign(component, Lanes::ShlI<31>(noise));
+        const F gradientY = Lanes::FlipSign(component, Lanes::AndI(Lanes::ShlI<30>(noise), signBit));
+        const F gradientZ = Lanes::FlipSign(component, Lanes::AndI(Lanes::ShlI<29>(noise), signBit));
+        return Lanes::Add(Lanes::Add(Lanes::Mul(gradientX, displacementX), Lanes::Mul(gradientY, displacementY)), Lanes::Mul(gradientZ, displacementZ));
+    }
+
+    //-------------------------------------------------------------------------------------------
+    // Compute2dPerlinNoise for Lanes::kWidth points
+    //
+    F Perlin2dLanes(F posX, F posY, const PerlinOctaves& octaves)
+    {
+        const F one        = Lanes::Set(1.f);
+        const F octaveBias = Lanes::Set(OCTAVE_OFFSET);
+        const F rangeScale = Lanes::Set(1.f / 0.662578106f);
+        const I prime      = Lanes::SetI(static_cast<unsigned int>(PRIME1));
+        const I oneI       = Lanes::SetI(1);
+
+        F totalNoise = Lanes::Set(0.f);
+        F currentX   = Lanes::Mul(posX, Lanes::Set(octaves.invScale));
+        F currentY   = Lanes::Mul(posY, Lanes::Set(octaves.invScale));
+
+        for (size_t octaveNum = 0; octaveNum < octaves.amplitudes.size(); ++octaveNum)
+        {
+            const I seed = Lanes::SetI(octaves.seed + static_cast<unsigned int>(octaveNum));
+
+            const F cellMinX   = Lanes::Floor(currentX);
+            const F cellMinY   = Lanes::Floor(currentY);
+            const F cellMaxX   = Lanes::Add(cellMinX, one);
+            const F cellMaxY   = Lanes::Add(cellMinY, one);
+            const I indexWestX = Lanes::Truncate(cellMinX);
+            const I indexEastX = Lanes::AddI(indexWestX, oneI);
+            const I rowSouth   = Lanes::MulI(prime, Lanes::Truncate(cellMinY));
+            const I rowNorth   = Lanes::AddI(rowSouth, prime); // PRIME * (y + 1), with the same wrap-around
+            const I noiseSW    = SquirrelNoise5Lanes(Lanes::AddI(indexWestX, rowSouth), seed);
+            const I noiseSE    = SquirrelNoise5Lanes(Lanes::AddI(indexEastX, rowSouth), seed);
+            const I noiseNW    = SquirrelNoise5Lanes(Lanes::AddI(indexWestX, rowNorth), seed);
+            const I noiseNE    = SquirrelNoise5Lanes(Lanes::AddI(indexEastX, rowNorth), seed);
+
+            const F fromWest  = Lanes::Sub(currentX, cellMinX);
+            const F fromEast  = Lanes::Sub(currentX, cellMaxX);
+            const F fromSouth = Lanes::Sub(currentY, cellMinY);
+            const F fromNorth = Lanes::Sub(currentY, cellMaxY);
+
+            const F dotSouthWest = Gradient2dDot(noiseSW, fromWest, fromSouth);
+            const F dotSouthEast = Gradient2dDot(noiseSE, fromEast, fromSouth);
+            const F dotNorthWest = Gradient2dDot(noiseNW, fromWest, fromNorth);
+            const F dotNorthEast = Gradient2dDot(noiseNE, fromEast, fromNorth);
+
+            const F weightEast  = SmoothStep3Lanes(fromWest);
+            const F weightNorth = SmoothStep3Lanes(fromSouth);
+            const F weightWest  = Lanes::Sub(one, weightEast);
+            const F weightSouth = Lanes::Sub(one, weightNorth);
+
+            const F blendSouth      = Lanes::Add(Lanes::Mul(weightEast, dotSouthEast), Lanes::Mul(weightWest, dotSouthWest));
+            const F blendNorth      = Lanes::Add(Lanes::Mul(weightEast, dotNorthEast), Lanes::Mul(weightWest, dotNorthWest));
+            const F blendTotal      = Lanes::Add(Lanes::Mul(weightSouth, blendSouth), Lanes::Mul(weightNorth, blendNorth));
+            const F noiseThisOctave = Lanes::Mul(blendTotal, rangeScale);
+
+            totalNoise = Lanes::Add(totalNoise, Lanes::Mul(noiseThisOctave, Lanes::Set(octaves.amplitudes[octaveNum])));
+            currentX   = Lanes::Add(Lanes::Mul(currentX, Lanes::Set(octaves.octaveScale)), octaveBias);
+            currentY   = Lanes::Add(Lanes::Mul(currentY, Lanes::Set(octaves.octaveScale)), octaveBias);
+        }
+
+        return octaves.ShouldRenormalize() ? RenormalizeLanes(totalNoise, octaves) : totalNoise;
+    }
+
+    //-------------------------------------------------------------------------------------------
+    // Compute3dPerlinNoise for Lanes::kWidth points
+    //
+    F Perlin3dLanes(F posX, F posY, F posZ, const PerlinOctaves& octaves)
+    {
+        const F one        = Lanes::Set(1.f);
+        const F octaveBias = Lanes::Set(OCTAVE_OFFSET);
+        const F rangeScale = Lanes::Set(1.f / 0.793856621f);
+        const I prime1     = Lanes::SetI(static_cast<unsigned int>(PRIME1));
+        const I prime2     = Lanes::SetI(static_cast<unsigned int>(PRIME2));
+        const I oneI       = Lanes::SetI(1);
+
+        F totalNoise = Lanes::Set(0.f);
+        F currentX   = Lanes::Mul(posX, Lanes::Set(octaves.invScale));
+        F currentY   = Lanes::Mul(posY, Lanes::Set(octaves.invScale));
+        F currentZ   = Lanes::Mul(posZ, Lanes::Set(octaves.invScale));
+
+        for (size_t octaveNum = 0; octaveNum < octaves.amplitudes.size(); ++octaveNum)
+        {
+            const I seed = Lanes::SetI(octaves.seed + static_cast<unsigned int>(octaveNum));
+
+            const F cellMinX   = Lanes::Floor(currentX);
+            const F cellMinY   = Lanes::Floor(currentY);
+            const F cellMinZ   = Lanes::Floor(currentZ);
+            const F cellMaxX   = Lanes::Add(cellMinX, one);
+            const F cellMaxY   = Lanes::Add(cellMinY, one);
+            const F cellMaxZ   = Lanes::Add(cellMinZ, one);
+            const I indexWestX = Lanes::Truncate(cellMinX);
+            const I indexEastX = Lanes::AddI(indexWestX, oneI);
+
+            // x + PRIME1 * y + PRIME2 * z, summed left to right like Get3dNoiseUint
+            const I rowSouth     = Lanes::MulI(prime1, Lanes::Truncate(cellMinY));
+            const I rowNorth     = Lanes::AddI(rowSouth, prime1);
+            const I layerBelow   = Lanes::MulI(prime2, Lanes::Truncate(cellMinZ));
+            const I layerAbove   = Lanes::AddI(layerBelow, prime2);
+            const I westSouth    = Lanes::AddI(indexWestX, rowSouth);
+            const I eastSouth    = Lanes::AddI(indexEastX, rowSouth);
+            const I westNorth    = Lanes::AddI(indexWestX, rowNorth);
+            const I eastNorth    = Lanes::AddI(indexEastX, rowNorth);
+            const I noiseBelowSW = SquirrelNoise5Lanes(Lanes::AddI(westSouth, layerBelow), seed);
+            const I noiseBelowSE = SquirrelNoise5Lanes(Lanes::AddI(eastSouth, layerBelow), seed);
+            const I noiseBelowNW = SquirrelNoise5Lanes(Lanes::AddI(westNorth, layerBelow), seed);
+            const I noiseBelowNE = SquirrelNoise5Lanes(Lanes::AddI(eastNorth, layerBelow), seed);
+            const I noiseAboveSW = SquirrelNoise5Lanes(Lanes::AddI(westSouth, layerAbove), seed);
+            const I noiseAboveSE = SquirrelNoise5Lanes(Lanes::AddI(eastSouth, layerAbove), seed);
+            const I noiseAboveNW = SquirrelNoise5Lanes(Lanes::AddI(westNorth, layerAbove), seed);
+            const I noiseAboveNE = SquirrelNoise5Lanes(Lanes::AddI(eastNorth, layerAbove), seed);
+
+            const F fromWest  = Lanes::Sub(currentX, cellMinX);
+            const F fromEast  = Lanes::Sub(currentX, cellMaxX);
+            const F fromSouth = Lanes::Sub(currentY, cellMinY);
+            const F fromNorth = Lanes::Sub(currentY, cellMaxY);
+            const F fromBelow = Lanes::Sub(currentZ, cellMinZ);
+            const F fromAbove = Lanes::Sub(currentZ, cellMaxZ);
+
+            const F dotBelowSW = Gradient3dDot(noiseBelowSW, fromWest, fromSouth, fromBelow);
+            const F dotBelowSE = Gradient3dDot(noiseBelowSE, fromEast, fromSouth, fromBelow);
+            const F dotBelowNW = Gradient3dDot(noiseBelowNW, fromWest, fromNorth, fromBelow);
+            const F dotBelowNE = Gradient3dDot(noiseBelowNE, fromEast, fromNorth, fromBelow);
+            const F dotAboveSW = Gradient3dDot(noiseAboveSW, fromWest, fromSouth, fromAbove);
+            const F dotAboveSE = Gradient3dDot(noiseAboveSE, fromEast, fromSouth, fromAbove);
+            const F dotAboveNW = Gradient3dDot(noiseAboveNW, fromWest, fromNorth, fromAbove);
+            const F dotAboveNE = Gradient3dDot(noiseAboveNE, fromEast, fromNorth, fromAbove);
+
+            const F weightEast  = SmoothStep3Lanes(fromWest);
+            const F weightNorth = SmoothStep3Lanes(fromSouth);
+            const F weightAbove = SmoothStep3Lanes(fromBelow);
+            const F weightWest  = Lanes::Sub(one, weightEast);
+            const F weightSouth = Lanes::Sub(one, weightNorth);
+            const F weightBelow = Lanes::Sub(one, weightAbove);
+
+            // 8-way blend (8 -> 4 -> 2 -> 1)
+            const F blendBelowSouth = Lanes::Add(Lanes::Mul(weightEast, dotBelowSE), Lanes::Mul(weightWest, dotBelowSW));
+            const F blendBelowNorth = Lanes::Add(Lanes::Mul(weightEast, dotBelowNE), Lanes::Mul(weightWest, dotBelowNW));
+            const F blendAboveSouth = Lanes::Add(Lanes::Mul(weightEast, dotAboveSE), Lanes::Mul(weightWest, dotAboveSW));
+            const F blendAboveNorth = Lanes::Add(Lanes::Mul(weightEast, dotAboveNE), Lanes::Mul(weightWest, dotAboveNW));
+            const F blendBelow      = Lanes::Add(Lanes::Mul(weightSouth, blendBelowSouth), Lanes::Mul(weightNorth, blendBelowNorth));
+            const F blendAbove      = Lanes::Add(Lanes::Mul(weightSouth, blendAboveSouth), Lanes::Mul(weightNorth, blendAboveNorth));
+            const F blendTotal      = Lanes::Add(Lanes::Mul(weightBelow, blendBelow), Lanes::Mul(weightAbove, blendAbove));
+            const F noiseThisOctave = Lanes::Mul(blendTotal, rangeScale);
+
+            totalNoise = Lanes::Add(totalNoise, Lanes::Mul(noiseThisOctave, Lanes::Set(octaves.amplitudes[octaveNum])));
+            currentX   = Lanes::Add(Lanes::Mul(currentX, Lanes::Set(octaves.octaveScale)), octaveBias);
+            currentY   = Lanes::Add(Lanes::Mul(currentY, Lanes::Set(octaves.octaveScale)), octaveBias);
+            currentZ   = Lanes::Add(Lanes::Mul(currentZ, Lanes::Set(octaves.octaveScale)), octaveBias);
+        }
+
+        return octaves.ShouldRenormalize() ? RenormalizeLanes(totalNoise, octaves) : totalNoise;
+    }
+#endif
+}
+
+//-----------------------------------------------------------------------------------------------
+void Get1dNoiseUintBatch(const int* indexX, unsigned int* outNoise, size_t count, unsigned int seed)
+{
+    size_t i = 0;
+#if defined(ENIGMA_NOISE_LANES)
+    const I seedLanes = Lanes::SetI(seed);
+    for (; i + Lanes::kWidth <= count; i += Lanes::kWidth)
+    {
+        Lanes::StoreI(outNoise + i, SquirrelNoise5Lanes(Lanes::LoadI(indexX + i), seedLanes));
+    }
+#endif
+    for (; i < count; ++i)
+    {
+        outNoise[i] = Get1dNoiseUint(indexX[i], seed);
+    }
+}
+
+//-----------------------------------------------------------------------------------------------
+void Get2dNoiseUintBatch(const int* indexX, const int* indexY, unsigned int* outNoise, size_t count, unsigned int seed)
+{
+    size_t i = 0;
+#if defined(ENIGMA_NOISE_LANES)
+    const I seedLanes = Lanes::SetI(seed);
+    const I prime     = Lanes::SetI(static_cast<unsigned int>(PRIME1));
+    for (; i + Lanes::kWidth <= count; i += Lanes::kWidth)
+    {
+        const I position = Lanes::AddI(Lanes::LoadI(indexX + i), Lanes::MulI(prime, Lanes::LoadI(indexY + i)));
+        Lanes::StoreI(outNoise + i, SquirrelNoise5Lanes(position, seedLanes));
+    }
+#endif
+    for (; i < count; ++i)
+    {
+        outNoise[i] = Get2dNoiseUint(indexX[i], indexY[i], seed);
+    }
+}
+
+//-----------------------------------------------------------------------------------------------
+void Get3dNoiseUintBatch(const int* indexX, const int* indexY, const int* indexZ, unsigned int* outNoise, size_t count, unsigned int seed)
+{
+    size_t i = 0;
+#if defined(ENIGMA_NOISE_LANES)
+    const I seedLanes = Lanes::SetI(seed);
+    const I prime1    = Lanes::SetI(static_cast<unsigned int>(PRIME1));
+    const I prime2    = Lanes::SetI(static_cast<unsigned int>(PRIME2));
+    for (; i + Lanes::kWidth <= count; i += Lanes::kWidth)
+    {
+        const I position = Lanes::AddI(Lanes::AddI(Lanes::LoadI(indexX + i), Lanes::MulI(prime1, Lanes::LoadI(indexY + i))), Lanes::MulI(prime2, Lanes::LoadI(indexZ + i)));
+        Lanes::StoreI(outNoise + i, SquirrelNoise5Lanes(position, seedLanes));
+    }
+#endif
+    for (; i < count; ++i)
+    {
+        outNoise[i] = Get3dNoiseUint(indexX[i], indexY[i], indexZ[i], seed);
+    }
+}
+
+//-----------------------------------------------------------------------------------------------
+void Compute2dPerlinNoiseBatch(const float* posX, const float* posY, float* outNoise, size_t count, float scale, unsigned int numOctaves, float octavePersistence, float octaveScale,
+                               bool         renormalize, unsigned int seed)
+{
+    size_t i = 0;
+#if defined(ENIGMA_NOISE_LANES)
+    const PerlinOctaves octaves(scale, numOctaves, octavePersistence, octaveScale, renormalize, seed);
+    for (; i + Lanes::kWidth <= count; i += Lanes::kWidth)
+    {
+        Lanes::Store(outNoise + i, Perlin2dLanes(Lanes::Load(posX + i), Lanes::Load(posY + i), octaves));
+    }
+#endif
+    for (; i < count; ++i)
+    {
+        outNoise[i] = Compute2dPerlinNoise(posX[i], posY[i], scale, numOctaves, octavePersistence, octaveScale, renormalize, seed);
+    }
+}
+
+//-----------------------------------------------------------------------------------------------
+void Compute3dPerlinNoiseBatch(const float* posX, const float* posY, const float* posZ, float* outNoise, size_t count, float scale, unsigned int numOctaves, float octavePersistence,
+                               float        octaveScale, bool renormalize, unsigned int seed)
+{
+    size_t i = 0;
+#if defined(ENIGMA_NOISE_LANES)
+    const PerlinOctaves octaves(scale, numOctaves, octavePersistence, octaveScale, renormalize, seed);
+    for (; i + Lanes::kWidth <= count; i += Lanes::kWidth)
+    {
+        Lanes::Store(outNoise + i, Perlin3dLanes(Lanes::Load(posX + i), Lanes::Load(posY + i), Lanes::Load(posZ + i), octaves));
+    }
+#endif
+    for (; i < count; ++i)
+    {
+        outNoise[i] = Compute3dPerlinNoise(posX[i], posY[i], posZ[i], scale, numOctaves, octavePersistence, octaveScale, renormalize, seed);
+    }
+}
+
+//-----------------------------------------------------------------------------------------------
+void Compute2dPerlinNoiseGrid(float originX, float originY, float stepX, float stepY, int countX, int countY, float* outNoise, float scale, unsigned int numOctaves,
+                              float octavePersistence, float octaveScale, bool renormalize, unsigned int seed)
+{
+#if defined(ENIGMA_NOISE_LANES)
+    const PerlinOctaves octaves(scale, numOctaves, octavePersistence, octaveScale, renormalize, seed);
+    const F             ramp = Lanes::Ramp();
+#endif
+    for (int y = 0; y < countY; ++y)
+    {
+        const float posY = originY + static_cast<float>(y) * stepY;
+        float*      row  = outNoise + static_cast<size_t>(y) * countX;
+        int         x    = 0;
+#if defined(ENIGMA_NOISE_LANES)
+        for (; x + Lanes::kWidth <= countX; x += Lanes::kWidth)
+        {
+            const F posX = Lanes::Add(Lanes::Set(originX), Lanes::Mul(Lanes::Add(Lanes::Set(static_cast<float>(x)), ramp), Lanes::Set(stepX)));
+            Lanes::Store(row + x, Perlin2dLanes(posX, Lanes::Set(posY), octaves));
+        }
+#endif
+        for (; x < countX; ++x)
+        {
+            row[x] = Compute2dPerlinNoise(originX + static_cast<float>(x) * stepX, posY, scale, numOctaves, octavePersistence, octaveScale, renormalize, seed);
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------------------------
+void Compute3dPerlinNoiseGrid(float originX, float originY, float originZ, float stepX, float stepY, float stepZ, int countX, int countY, int countZ, float* outNoise,
+                              float scale, unsigned int numOctaves, float octavePersistence, float octaveScale, bool renormalize, unsigned int seed)
+{
+#if defined(ENIGMA_NOISE_LANES)
+    const PerlinOctaves octaves(scale, numOctaves, octavePersistence, octaveScale, renormalize, seed);
+    const F             ramp = Lanes::Ramp();
+#endif
+    for (int z = 0; z < countZ; ++z)
+    {
+        const float posZ = originZ + static_cast<float>(z) * stepZ;
+        for (int y = 0; y < countY; ++y)
+        {
+            const float posY = originY + static_cast<float>(y) * stepY;
+            float*      row  = outNoise + (static_cast<size_t>(z) * countY + y) * countX;
+            int         x    = 0;
+#if defined(ENIGMA_NOISE_LANES)
+            for (; x + Lanes::kWidth <= countX; x += Lanes::kWidth)
+            {
+                const F posX = Lanes::Add(Lanes::Set(originX), Lanes::Mul(Lanes::Add(Lanes::Set(static_cast<float>(x)), ramp), Lanes::Set(stepX)));
+                Lanes::Store(row + x, Perlin3dLanes(posX, Lanes::Set(posY), Lanes::Set(posZ), octaves));
+            }
+#endif
+            for (; x < countX; ++x)
+            {
+                row[x] = Compute3dPerlinNoise(originX + static_cast<float>(x) * stepX, posY, posZ, scale, numOctaves, octavePersistence, octaveScale, renormalize, seed);
+            }
+        }
+    }
+}
@@ -0,0 +1,46 @@
+//-----------------------------------------------------------------------------------------------
+// NoiseBatch.hpp
+//
+#pragma once
+#include <cstddef>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+// Batched versions of the Squirrel raw noise (RawNoise.hpp) and Perlin noise (SmoothNoise.hpp)
+//	functions, for callers that sample many points with the same settings (terrain columns,
+//	density slabs).  Octave amplitudes, the renormalization factor and per-octave seeds are
+//	computed once per call instead of once per point, and points are evaluated in SIMD lanes:
+//	8 with AVX2, 4 with SSE4.1 or SSE2, picked at compile time like the rest of the engine.
+//	Targets without SSE2 (and batch tails shorter than a lane) use the scalar functions.
+//
+// Results are bit-identical to the scalar functions with the same arguments: the lanes repeat
+//	the scalar operations in the same order, and gradients are rebuilt from hash bits exactly.
+//	This holds as long as the scalar build does not contract a*b+c into FMA instructions
+//	(MSVC /fp:precise does not; GCC/Clang need -ffp-contract=off when FMA is enabled).
+//
+// Grid variants sample origin + index * step along each axis, X fastest, then Y, then Z;
+//	integer origins and steps give exactly the positions a caller would pass one at a time.
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+//-----------------------------------------------------------------------------------------------
+// Raw noise: out[i] = GetNdNoiseUint( indexX[i], ... , seed )
+//
+void Get1dNoiseUintBatch(const int* indexX, unsigned int* outNoise, size_t count, unsigned int seed = 0);
+void Get2dNoiseUintBatch(const int* indexX, const int* indexY, unsigned int* outNoise, size_t count, unsigned int seed = 0);
+void Get3dNoiseUintBatch(const int* indexX, const int* indexY, const int* indexZ, unsigned int* outNoise, size_t count, unsigned int seed = 0);
+
+//-----------------------------------------------------------------------------------------------
+// Perlin noise at arbitrary points: out[i] = ComputeNdPerlinNoise( posX[i], ... )
+//
+void Compute2dPerlinNoiseBatch(const float* posX, const float* posY, float* outNoise, size_t count, float scale = 1.f, unsigned int numOctaves = 1, float octavePersistence = 0.5f,
+                               float octaveScale = 2.f, bool renormalize = true, unsigned int seed = 0);
+void Compute3dPerlinNoiseBatch(const float* posX, const float* posY, const float* posZ, float* outNoise, size_t count, float scale = 1.f, unsigned int numOctaves = 1,
+                               float octavePersistence = 0.5f, float octaveScale = 2.f, bool renormalize = true, unsigned int seed = 0);
+
+//-----------------------------------------------------------------------------------------------
+// Perlin noise on a regular grid; outNoise holds countX * countY (* countZ) values
+//
+void Compute2dPerlinNoiseGrid(float originX, float originY, float stepX, float stepY, int countX, int countY, float* outNoise, float scale = 1.f, unsigned int numOctaves = 1,
+                              float octavePersistence = 0.5f, float octaveScale = 2.f, bool renormalize = true, unsigned int seed = 0);
+void Compute3dPerlinNoiseGrid(float originX, float originY, float originZ, float stepX, float stepY, float stepZ, int countX, int countY, int countZ, float* outNoise,
+                              float scale = 1.f, unsigned int numOctaves = 1, float octavePersistence = 0.5f, float octaveScale = 2.f, bool renormalize = true,
+                              unsigned int seed = 0);
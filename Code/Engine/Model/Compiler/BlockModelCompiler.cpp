@@ -183,6 +183,10 @@ namespace enigma::renderer::model
                 vertex.m_color = faceColor;
             }
 
+            // Faces without a cullface (e.g. the inner step of stairs) never touch the block boundary
+            face.hasCullFace = modelFace.cullFace.has_value();
+            face.tintIndex   = modelFace.tintIndex;
+
             blockMesh->AddFace(face);
         }
     }
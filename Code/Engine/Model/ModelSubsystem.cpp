@@ -11,6 +11,7 @@
 #include "Compiler/GenericModelCompiler.hpp"
 #include "Engine/Core/Logger/LoggerAPI.hpp"
 #include "Engine/Voxel/Block/BlockState.hpp"
+#include "Engine/Voxel/Chunk/MeshBuild/BlockStateQuadTable.hpp"
 
 using namespace enigma::model;
 using namespace enigma::core;
@@ -288,4 +289,7 @@ void ModelSubsystem::CompileAllBlockModels()
 
     // Update statistics
     m_statistics.cachedMeshesCount = totalCompiled;
+
+    // Flatten the compiled meshes into the per-state table the chunk mesher indexes
+    enigma::voxel::BlockStateQuadTable::Publish(enigma::voxel::BlockStateQuadTable::Bake());
 }
@@ -112,6 +112,7 @@ namespace enigma::model
          * This method should be called after all blocks are registered to compile
          * the models for all block states. Follows the Minecraft Forge pattern where
          * model compilation happens automatically in the engine after registration.
+         * Ends by baking and publishing the BlockStateQuadTable used for chunk meshing.
          */
         void CompileAllBlockModels();
 
@@ -25,7 +25,7 @@ enum class MessageBoundaryMode
 {
     NULL_TERMINATED, // Uses \0 as message delimiter
     RAW_BYTES, // Raw byte stream, no message boundary processing
-    LENGTH_PREFIXED // Length prefix mode (future extension)
+    LENGTH_PREFIXED // uint32 length prefix, implemented by enigma::network::NetworkIoBackend
 };
 
 enum class ServerState
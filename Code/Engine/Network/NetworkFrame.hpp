@@ -0,0 +1,60 @@
+#pragma once
+//-----------------------------------------------------------------------------------------------
+// NetworkFrame.hpp
+//
+// Length-prefixed framing (MessageBoundaryMode::LENGTH_PREFIXED):
+//   [uint32 payloadSize, big-endian][payload bytes]
+//
+// Received frames are handed out as NetworkFrameView, a non-owning view that points straight
+// into the connection's receive ring. A view stays valid until the frame is released.
+//-----------------------------------------------------------------------------------------------
+
+#include "Engine/Core/Buffer/ByteBuffer.hpp"
+
+#include <cstddef>
+#include <cstdint>
+
+namespace enigma::network
+{
+    using ConnectionId = uint64_t;
+
+    constexpr ConnectionId kInvalidConnectionId = 0;
+    constexpr size_t       kFrameHeaderSize     = sizeof(uint32_t);
+
+    inline void EncodeFrameHeader(uint32_t payloadSize, uint8_t outHeader[kFrameHeaderSize])
+    {
+        outHeader[0] = static_cast<uint8_t>(payloadSize >> 24);
+        outHeader[1] = static_cast<uint8_t>(payloadSize >> 16);
+        outHeader[2] = static_cast<uint8_t>(payloadSize >> 8);
+        outHeader[3] = static_cast<uint8_t>(payloadSize);
+    }
+
+    inline uint32_t DecodeFrameHeader(const uint8_t header[kFrameHeaderSize])
+    {
+        return (static_cast<uint32_t>(header[0]) << 24) |
+            (static_cast<uint32_t>(header[1]) << 16) |
+            (static_cast<uint32_t>(header[2]) << 8) |
+            static_cast<uint32_t>(header[3]);
+    }
+
+    struct NetworkFrameView
+    {
+        ConnectionId          connectionId = kInvalidConnectionId;
+        const core::byte_t*   data         = nullptr;
+        size_t                size         = 0;
+
+        bool IsValid() const { return connectionId != kInvalidConnectionId; }
+
+        // Zero-copy reader over the payload, valid until ReleaseFrame()
+        core::ByteBufferView AsView(core::ByteOrder order = core::ByteOrder::Big) const
+        {
+            return core::ByteBufferView(data, size, order);
+        }
+
+        // Explicit copy for callers that need to keep the payload beyond ReleaseFrame()
+        core::ByteBuffer ToByteBuffer(core::ByteOrder order = core::ByteOrder::Big) const
+        {
+            return core::ByteBuffer::Wrap(data, size, order);
+        }
+    };
+} // namespace enigma::network
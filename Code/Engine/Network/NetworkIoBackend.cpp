@@ -0,0 +1,770 @@
+#include "NetworkIoBackend.hpp"
+
+#include <algorithm>
+
+namespace enigma::network
+{
+    //-------------------------------------------------------------------------------------------
+    // Connection
+    //-------------------------------------------------------------------------------------------
+    struct NetworkIoBackend::Connection
+    {
+        Connection(ConnectionId connectionId, SocketHandle socketHandle, size_t sendBytes, size_t recvBytes)
+            : id(connectionId)
+              , socket(socketHandle)
+              , sendRing(sendBytes)
+              , recvRing(recvBytes)
+        {
+        }
+
+        ConnectionId      id;
+        SocketHandle      socket;
+        bool              inbound = false;
+        NetworkRingBuffer sendRing; // Producer: SendFrame caller, consumer: I/O thread
+        NetworkRingBuffer recvRing; // Producer: I/O thread, consumer: AcquireFrame caller
+
+        std::atomic<bool> open{true};
+        std::atomic<bool> connecting{false};
+        std::atomic<bool> sendScheduled{false}; // A send request is queued for the I/O thread
+        std::atomic<bool> receivePaused{false}; // Read interest dropped because recvRing is full
+
+        // Closing, read-only state after an orderly peer close: the socket is gone but the
+        // connection stays in m_connections until the consumer has drained recvRing
+        std::atomic<bool> draining{false};
+        std::atomic<bool> drainFinished{false}; // Disconnected reported and table entry removed
+
+        // I/O thread only
+        bool wantWrite       = false;
+        bool readEnabled     = true;
+        bool registeredRead  = false; // Interest currently installed in the poller
+        bool registeredWrite = false;
+
+        // Consumer only
+        size_t               acquiredFrameBytes = 0; // header + payload of the frame handed out
+        std::vector<uint8_t> frameScratch; // Linearized copy of a frame that wraps the ring end
+    };
+
+    //-------------------------------------------------------------------------------------------
+    // Config
+    //-------------------------------------------------------------------------------------------
+    NetworkIoBackendConfig NetworkIoBackendConfig::FromNetworkConfig(const NetworkConfig& config)
+    {
+        NetworkIoBackendConfig result;
+        result.maxFrameBytes  = config.safetyLimits.maxMessageSize;
+        result.maxConnections = static_cast<size_t>((std::max)(config.maxPlayers, 1));
+        result.sendRingBytes  = (std::max)(result.sendRingBytes, config.safetyLimits.maxQueueSize);
+        result.recvRingBytes  = (std::max)(result.recvRingBytes, config.safetyLimits.maxQueueSize);
+        return result;
+    }
+
+    //-------------------------------------------------------------------------------------------
+    // Lifetime
+    //-------------------------------------------------------------------------------------------
+    NetworkIoBackend::NetworkIoBackend(const NetworkIoBackendConfig& config)
+        : m_config(config)
+    {
+        // A frame must always fit in the receive ring, otherwise the reader could never complete it
+        m_config.recvRingBytes = (std::max)(m_config.recvRingBytes, m_config.maxFrameBytes + kFrameHeaderSize);
+        m_config.sendRingBytes = (std::max)(m_config.sendRingBytes, m_config.maxFrameBytes + kFrameHeaderSize);
+    }
+
+    NetworkIoBackend::~NetworkIoBackend()
+    {
+        Stop();
+    }
+
+    bool NetworkIoBackend::Start()
+    {
+        if (IsRunning())
+        {
+            return true;
+        }
+
+        m_platformStarted = socket_api::StartupPlatform();
+        if (!m_platformStarted || !m_poller.Initialize())
+        {
+            Stop();
+            return false;
+        }
+
+        m_running.store(true, std::memory_order_release);
+        m_ioThread = std::thread([this]() { RunIoLoop(); });
+        return true;
+    }
+
+    void NetworkIoBackend::Stop()
+    {
+        if (m_running.exchange(false, std::memory_order_acq_rel))
+        {
+            m_poller.Wakeup();
+        }
+        if (m_ioThread.joinable())
+        {
+            m_ioThread.join();
+        }
+
+        // Run control commands posted after the last loop iteration so their sockets get closed
+        ExecuteCommands();
+        CloseAllSockets();
+        m_poller.Shutdown();
+
+        if (m_platformStarted)
+        {
+            socket_api::ShutdownPlatform();
+            m_platformStarted = false;
+        }
+    }
+
+    //-------------------------------------------------------------------------------------------
+    // Control plane
+    //-------------------------------------------------------------------------------------------
+    uint16_t NetworkIoBackend::Listen(uint16_t port, const std::string& bindIp)
+    {
+        if (!IsRunning())
+        {
+            return 0;
+        }
+
+        SocketHandle socket = socket_api::CreateTcpSocket();
+        if (socket == kInvalidSocket)
+        {
+            return 0;
+        }
+        socket_api::SetReuseAddress(socket);
+        if (!socket_api::SetNonBlocking(socket) || !socket_api::Bind(socket, bindIp, port) || !socket_api::Listen(socket))
+        {
+            socket_api::Close(socket);
+            return 0;
+        }
+
+        uint16_t boundPort = socket_api::GetLocalPort(socket);
+        PostCommand([this, socket]()
+        {
+            Listener listener;
+            listener.socket = socket;
+            listener.token  = kListenerTokenBit | static_cast<uint64_t>(m_listeners.size());
+            m_listeners.push_back(listener);
+            m_poller.Add(socket, listener.token, true, false);
+        });
+        return boundPort;
+    }
+
+    NetworkIoBackend::ConnectionPtr NetworkIoBackend::FindConnection(ConnectionId connectionId) const
+    {
+        std::lock_guard<std::mutex> lock(m_connectionMutex);
+        auto                        it = m_connections.find(connectionId);
+        return it != m_connections.end() ? it->second : nullptr;
+    }
+
+    ConnectionId NetworkIoBackend::Connect(const std::string& serverIp, uint16_t port)
+    {
+        if (!IsRunning())
+        {
+            return kInvalidConnectionId;
+        }
+
+        SocketHandle socket = socket_api::CreateTcpSocket();
+        if (socket == kInvalidSocket)
+        {
+            return kInvalidConnectionId;
+        }
+        if (!socket_api::SetNonBlocking(socket) || !socket_api::ConnectNonBlocking(socket, serverIp, port))
+        {
+            socket_api::Close(socket);
+            return kInvalidConnectionId;
+        }
+        if (m_config.noDelay)
+        {
+            socket_api::SetNoDelay(socket);
+        }
+
+        auto connection = std::make_shared<Connection>(m_nextConnectionId.fetch_add(1), socket, m_config.sendRingBytes, m_config.recvRingBytes);
+        connection->connecting.store(true, std::memory_order_release);
+        {
+            std::lock_guard<std::mutex> lock(m_connectionMutex);
+            m_connections[connection->id] = connection;
+        }
+
+        PostCommand([this, connection]() { RegisterConnection(connection); });
+        return connection->id;
+    }
+
+    void NetworkIoBackend::Disconnect(ConnectionId connectionId)
+    {
+        ConnectionPtr connection = FindConnection(connectionId);
+        if (!connection)
+        {
+            return;
+        }
+        PostCommand([this, connection]()
+        {
+            // Hand frames already accepted by SendFrame to the kernel before closing, best effort:
+            // whatever the socket buffer does not take right now is dropped
+            if (connection->open.load(std::memory_order_acquire) && !connection->connecting.load(std::memory_order_acquire))
+            {
+                FlushSendRing(connection);
+            }
+            CloseConnection(connection, NetworkConnectionEventType::Disconnected);
+        });
+    }
+
+    bool NetworkIoBackend::IsConnected(ConnectionId connectionId) const
+    {
+        ConnectionPtr connection = FindConnection(connectionId);
+        return connection && connection->open.load(std::memory_order_acquire) && !connection->connecting.load(std::memory_order_acquire);
+    }
+
+    size_t NetworkIoBackend::PollConnectionEvents(std::vector<NetworkConnectionEvent>& outEvents)
+    {
+        std::lock_guard<std::mutex> lock(m_eventMutex);
+        outEvents.insert(outEvents.end(), m_events.begin(), m_events.end());
+        size_t count = m_events.size();
+        m_events.clear();
+        return count;
+    }
+
+    void NetworkIoBackend::PostCommand(std::function<void()> command)
+    {
+        {
+            std::lock_guard<std::mutex> lock(m_requestMutex);
+            m_commands.push_back(std::move(command));
+        }
+        m_poller.Wakeup();
+    }
+
+    void NetworkIoBackend::PushEvent(NetworkConnectionEventType type, const ConnectionPtr& connection)
+    {
+        std::lock_guard<std::mutex> lock(m_eventMutex);
+        m_events.push_back(NetworkConnectionEvent{type, connection->id, connection->inbound});
+    }
+
+    //-------------------------------------------------------------------------------------------
+    // Data plane (caller threads)
+    //-------------------------------------------------------------------------------------------
+    NetworkSendResult NetworkIoBackend::SendFrame(ConnectionId connectionId, const void* payload, size_t size)
+    {
+        if (size > m_config.maxFrameBytes)
+        {
+            return NetworkSendResult::FrameTooLarge;
+        }
+
+        ConnectionPtr connection = FindConnection(connectionId);
+        if (!connection || !connection->open.load(std::memory_order_acquire) || connection->connecting.load(std::memory_order_acquire))
+        {
+            return NetworkSendResult::NotConnected;
+        }
+
+        uint8_t header[kFrameHeaderSize];
+        EncodeFrameHeader(static_cast<uint32_t>(size), header);
+        SocketIoSpan pieces[2] = {
+            {header, kFrameHeaderSize},
+            {const_cast<void*>(payload), size}
+        };
+        if (!connection->sendRing.Write(pieces, 2))
+        {
+            m_stats.sendBackpressureCount.fetch_add(1, std::memory_order_relaxed);
+            return NetworkSendResult::Backpressure;
+        }
+        m_stats.framesSent.fetch_add(1, std::memory_order_relaxed);
+
+        // Only the first frame since the last flush needs to notify the I/O thread
+        if (!connection->sendScheduled.exchange(true, std::memory_order_acq_rel))
+        {
+            {
+                std::lock_guard<std::mutex> lock(m_requestMutex);
+                m_sendRequests.push_back(connectionId);
+            }
+            m_poller.Wakeup();
+        }
+        return NetworkSendResult::Ok;
+    }
+
+    NetworkSendResult NetworkIoBackend::SendFrame(ConnectionId connectionId, const core::ByteBuffer& payload)
+    {
+        return SendFrame(connectionId, payload.Data(), payload.WrittenBytes());
+    }
+
+    bool NetworkIoBackend::AcquireFrame(ConnectionId connectionId, NetworkFrameView& outFrame)
+    {
+        ConnectionPtr connection = FindConnection(connectionId);
+        if (!connection)
+        {
+            return false;
+        }
+
+        // Load before inspecting the ring: once draining is visible no more bytes will arrive,
+        // so "no complete frame" below is final and the connection can be retired
+        bool draining = connection->draining.load(std::memory_order_acquire);
+
+        NetworkRingBuffer& ring = connection->recvRing;
+        uint8_t            header[kFrameHeaderSize];
+        if (!ring.Peek(header, kFrameHeaderSize))
+        {
+            if (draining)
+            {
+                FinishDrain(connection);
+            }
+            return false;
+        }
+
+        uint32_t payloadSize = DecodeFrameHeader(header);
+        if (payloadSize > m_config.maxFrameBytes)
+        {
+            // Protocol violation: the stream can no longer be resynchronized
+            ring.Reset();
+            if (draining)
+            {
+                FinishDrain(connection);
+            }
+            else
+            {
+                Disconnect(connectionId);
+            }
+            return false;
+        }
+        if (ring.ReadableBytes() < kFrameHeaderSize + payloadSize)
+        {
+            // A truncated trailing frame of a closed peer can never complete
+            if (draining)
+            {
+                FinishDrain(connection);
+            }
+            return false;
+        }
+
+        const uint8_t* payload = ring.TryGetContiguous(kFrameHeaderSize, payloadSize);
+        if (!payload)
+        {
+            // Rare path: the frame straddles the ring end, linearize it once
+            connection->frameScratch.resize(payloadSize);
+            ring.Peek(connection->frameScratch.data(), payloadSize, kFrameHeaderSize);
+            payload = connection->frameScratch.data();
+        }
+
+        connection->acquiredFrameBytes = kFrameHeaderSize + payloadSize;
+        outFrame.connectionId          = connectionId;
+        outFrame.data                  = payload;
+        outFrame.size                  = payloadSize;
+        return true;
+    }
+
+    void NetworkIoBackend::ReleaseFrame(ConnectionId connectionId)
+    {
+        ConnectionPtr connection = FindConnection(connectionId);
+        if (!connection || connection->acquiredFrameBytes == 0)
+        {
+            return;
+        }
+
+        connection->recvRing.CommitRead(connection->acquiredFrameBytes);
+        connection->acquiredFrameBytes = 0;
+        m_stats.framesReceived.fetch_add(1, std::memory_order_relaxed);
+
+        // Free space appeared: let the I/O thread resume reading a paused socket
+        if (connection->receivePaused.exchange(false, std::memory_order_acq_rel))
+        {
+            {
+                std::lock_guard<std::mutex> lock(m_requestMutex);
+                m_resumeRequests.push_back(connectionId);
+            }
+            m_poller.Wakeup();
+        }
+    }
+
+    size_t NetworkIoBackend::GetPendingSendBytes(ConnectionId connectionId) const
+    {
+        ConnectionPtr connection = FindConnection(connectionId);
+        return connection ? connection->sendRing.ReadableBytes() : 0;
+    }
+
+    NetworkIoStats NetworkIoBackend::GetStats() const
+    {
+        NetworkIoStats stats;
+        stats.bytesSent             = m_stats.bytesSent.load(std::memory_order_relaxed);
+        stats.bytesReceived         = m_stats.bytesReceived.load(std::memory_order_relaxed);
+        stats.framesSent            = m_stats.framesSent.load(std::memory_order_relaxed);
+        stats.framesReceived        = m_stats.framesReceived.load(std::memory_order_relaxed);
+        stats.writeCalls            = m_stats.writeCalls.load(std::memory_order_relaxed);
+        stats.readCalls             = m_stats.readCalls.load(std::memory_order_relaxed);
+        stats.sendBackpressureCount = m_stats.sendBackpressureCount.load(std::memory_order_relaxed);
+        stats.receivePauseCount     = m_stats.receivePauseCount.load(std::memory_order_relaxed);
+        stats.acceptedConnections   = m_stats.acceptedConnections.load(std::memory_order_relaxed);
+        stats.closedConnections     = m_stats.closedConnections.load(std::memory_order_relaxed);
+
+        std::lock_guard<std::mutex> lock(m_connectionMutex);
+        stats.activeConnections = m_connections.size();
+        return stats;
+    }
+
+    //-------------------------------------------------------------------------------------------
+    // I/O thread
+    //-------------------------------------------------------------------------------------------
+    void NetworkIoBackend::RunIoLoop()
+    {
+        while (m_running.load(std::memory_order_acquire))
+        {
+            ExecuteCommands();
+            ProcessSendRequests();
+            ProcessResumeRequests();
+
+            m_poller.Wait(m_pollEvents, m_config.pollTimeoutMs);
+            for (const NetworkPollEvent& event : m_pollEvents)
+            {
+                if ((event.token & kListenerTokenBit) != 0)
+                {
+                    size_t index = static_cast<size_t>(event.token & ~kListenerTokenBit);
+                    if (index < m_listeners.size())
+                    {
+                        HandleListenerReadable(m_listeners[index]);
+                    }
+                    continue;
+                }
+
+                auto it = m_ioConnections.find(event.token);
+                if (it != m_ioConnections.end())
+                {
+                    ConnectionPtr connection = it->second;
+                    HandleConnectionEvent(connection, event);
+                }
+            }
+        }
+    }
+
+    void NetworkIoBackend::ExecuteCommands()
+    {
+        std::vector<std::function<void()>> commands;
+        {
+            std::lock_guard<std::mutex> lock(m_requestMutex);
+            commands.swap(m_commands);
+        }
+        for (auto& command : commands)
+        {
+            command();
+        }
+    }
+
+    void NetworkIoBackend::ProcessSendRequests()
+    {
+        std::vector<ConnectionId> requests;
+        {
+            std::lock_guard<std::mutex> lock(m_requestMutex);
+            requests.swap(m_sendRequests);
+        }
+        for (ConnectionId connectionId : requests)
+        {
+            auto it = m_ioConnections.find(connectionId);
+            if (it == m_ioConnections.end())
+            {
+                continue;
+            }
+            ConnectionPtr connection = it->second;
+            // Clear before flushing so frames written during the flush schedule a new request
+            connection->sendScheduled.store(false, std::memory_order_release);
+            if (connection->connecting.load(std::memory_order_acquire))
+            {
+                continue;
+            }
+            if (!FlushSendRing(connection))
+            {
+                CloseConnection(connection, NetworkConnectionEventType::Disconnected);
+                continue;
+            }
+            UpdateInterest(connection);
+        }
+    }
+
+    void NetworkIoBackend::ProcessResumeRequests()
+    {
+        std::vector<ConnectionId> requests;
+        {
+            std::lock_guard<std::mutex> lock(m_requestMutex);
+            requests.swap(m_resumeRequests);
+        }
+        for (ConnectionId connectionId : requests)
+        {
+            auto it = m_ioConnections.find(connectionId);
+            if (it != m_ioConnections.end())
+            {
+                ConnectionPtr connection = it->second;
+                connection->readEnabled  = true;
+                UpdateInterest(connection);
+                // Data may already be waiting in the kernel; level-triggered polling reports it
+            }
+        }
+    }
+
+    void NetworkIoBackend::HandleListenerReadable(const Listener& listener)
+    {
+        // Drain the whole accept backlog in one wakeup
+        for (;;)
+        {
+            SocketHandle socket = socket_api::Accept(listener.socket);
+            if (socket == kInvalidSocket)
+            {
+                return;
+            }
+
+            bool overCapacity = false;
+            {
+                std::lock_guard<std::mutex> lock(m_connectionMutex);
+                overCapacity = m_connections.size() >= m_config.maxConnections;
+            }
+            if (overCapacity || !socket_api::SetNonBlocking(socket))
+            {
+                socket_api::Close(socket);
+                continue;
+            }
+            if (m_config.noDelay)
+            {
+                socket_api::SetNoDelay(socket);
+            }
+
+            auto connection     = std::make_shared<Connection>(m_nextConnectionId.fetch_add(1), socket, m_config.sendRingBytes, m_config.recvRingBytes);
+            connection->inbound = true;
+            {
+                std::lock_guard<std::mutex> lock(m_connectionMutex);
+                m_connections[connection->id] = connection;
+            }
+            RegisterConnection(connection);
+            m_stats.acceptedConnections.fetch_add(1, std::memory_order_relaxed);
+            PushEvent(NetworkConnectionEventType::Connected, connection);
+        }
+    }
+
+    void NetworkIoBackend::RegisterConnection(const ConnectionPtr& connection)
+    {
+        bool connecting       = connection->connecting.load(std::memory_order_acquire);
+        connection->wantWrite = connecting; // Writability signals connect completion
+        connection->registeredRead      = !connecting;
+        connection->registeredWrite     = connecting;
+        m_ioConnections[connection->id] = connection;
+        if (!m_poller.Add(connection->socket, connection->id, !connecting, connecting))
+        {
+            CloseConnection(connection, connecting ? NetworkConnectionEventType::ConnectFailed : NetworkConnectionEventType::Disconnected);
+        }
+    }
+
+    void NetworkIoBackend::HandleConnectionEvent(const ConnectionPtr& connection, const NetworkPollEvent& event)
+    {
+        if (connection->connecting.load(std::memory_order_acquire))
+        {
+            if (event.error || socket_api::GetPendingError(connection->socket))
+            {
+                CloseConnection(connection, NetworkConnectionEventType::ConnectFailed);
+                return;
+            }
+            if (event.writable)
+            {
+                connection->connecting.store(false, std::memory_order_release);
+                connection->wantWrite = false;
+                UpdateInterest(connection);
+                PushEvent(NetworkConnectionEventType::Connected, connection);
+            }
+            return;
+        }
+
+        if (event.readable || event.error)
+        {
+            SocketIoStatus status = FillReceiveRing(connection);
+            if (status == SocketIoStatus::Closed)
+            {
+                // Orderly shutdown: keep already received frames readable
+                BeginDrain(connection);
+                return;
+            }
+            if (status == SocketIoStatus::Error)
+            {
+                CloseConnection(connection, NetworkConnectionEventType::Disconnected);
+                return;
+            }
+        }
+        if (event.writable)
+        {
+            if (!FlushSendRing(connection))
+            {
+                CloseConnection(connection, NetworkConnectionEventType::Disconnected);
+                return;
+            }
+        }
+        UpdateInterest(connection);
+    }
+
+    bool NetworkIoBackend::FlushSendRing(const ConnectionPtr& connection)
+    {
+        for (;;)
+        {
+            SocketIoSpan spans[2];
+            size_t       spanCount = connection->sendRing.GetReadableSpans(spans);
+            if (spanCount == 0)
+            {
+                connection->wantWrite = false;
+                return true;
+            }
+
+            SocketIoResult result = socket_api::WriteVector(connection->socket, spans, spanCount);
+            m_stats.writeCalls.fetch_add(1, std::memory_order_relaxed);
+            if (result.status == SocketIoStatus::WouldBlock)
+            {
+                connection->wantWrite = true;
+                return true;
+            }
+            if (result.status != SocketIoStatus::Ok)
+            {
+                return false;
+            }
+
+            connection->sendRing.CommitRead(result.transferred);
+            m_stats.bytesSent.fetch_add(result.transferred, std::memory_order_relaxed);
+        }
+    }
+
+    SocketIoStatus NetworkIoBackend::FillReceiveRing(const ConnectionPtr& connection)
+    {
+        for (;;)
+        {
+            SocketIoSpan spans[2];
+            size_t       spanCount = connection->recvRing.GetWritableSpans(spans);
+            if (spanCount == 0)
+            {
+                // Receive backpressure: stop reading until the consumer releases frames.
+                // Set the flag before re-checking to avoid missing a concurrent release.
+                connection->readEnabled = false;
+                connection->receivePaused.store(true, std::memory_order_release);
+                m_stats.receivePauseCount.fetch_add(1, std::memory_order_relaxed);
+                if (connection->recvRing.WritableBytes() > 0 && connection->receivePaused.exchange(false, std::memory_order_acq_rel))
+                {
+                    connection->readEnabled = true;
+                    continue;
+                }
+                return SocketIoStatus::WouldBlock;
+            }
+
+            SocketIoResult result = socket_api::ReadVector(connection->socket, spans, spanCount);
+            m_stats.readCalls.fetch_add(1, std::memory_order_relaxed);
+            if (result.status != SocketIoStatus::Ok)
+            {
+                return result.status;
+            }
+
+            connection->recvRing.CommitWrite(result.transferred);
+            m_stats.bytesReceived.fetch_add(result.transferred, std::memory_order_relaxed);
+
+            size_t offered = spans[0].size + (spanCount > 1 ? spans[1].size : 0);
+            if (result.transferred < offered)
+            {
+                return SocketIoStatus::Ok; // Kernel buffer drained
+            }
+        }
+    }
+
+    void NetworkIoBackend::UpdateInterest(const ConnectionPtr& connection)
+    {
+        if (!connection->open.load(std::memory_order_acquire))
+        {
+            return;
+        }
+        bool wantRead  = connection->readEnabled && !connection->connecting.load(std::memory_order_acquire);
+        bool wantWrite = connection->wantWrite;
+        if (wantRead == connection->registeredRead && wantWrite == connection->registeredWrite)
+        {
+            return;
+        }
+        connection->registeredRead  = wantRead;
+        connection->registeredWrite = wantWrite;
+        m_poller.Modify(connection->socket, connection->id, wantRead, wantWrite);
+    }
+
+    void NetworkIoBackend::CloseConnection(const ConnectionPtr& connection, NetworkConnectionEventType reason)
+    {
+        if (!connection->open.exchange(false, std::memory_order_acq_rel))
+        {
+            // Disconnect() on a draining connection discards whatever is still buffered
+            if (connection->draining.load(std::memory_order_acquire))
+            {
+                FinishDrain(connection);
+            }
+            return;
+        }
+
+        m_poller.Remove(connection->socket);
+        socket_api::Close(connection->socket);
+        m_ioConnections.erase(connection->id);
+        {
+            std::lock_guard<std::mutex> lock(m_connectionMutex);
+            m_connections.erase(connection->id);
+        }
+        m_stats.closedConnections.fetch_add(1, std::memory_order_relaxed);
+        PushEvent(reason, connection);
+    }
+
+    void NetworkIoBackend::BeginDrain(const ConnectionPtr& connection)
+    {
+        if (!connection->open.exchange(false, std::memory_order_acq_rel))
+        {
+            return;
+        }
+
+        // The socket has nothing left to give; only the ring outlives it
+        m_poller.Remove(connection->socket);
+        socket_api::Close(connection->socket);
+        m_ioConnections.erase(connection->id);
+
+        // Publishes every CommitWrite above to the consumer's acquire load in AcquireFrame
+        connection->draining.store(true, std::memory_order_release);
+        if (connection->recvRing.ReadableBytes() == 0)
+        {
+            FinishDrain(connection);
+        }
+    }
+
+    void NetworkIoBackend::FinishDrain(const ConnectionPtr& connection)
+    {
+        // Reachable from the I/O thread (BeginDrain, Disconnect) and the consumer (AcquireFrame)
+        if (connection->drainFinished.exchange(true, std::memory_order_acq_rel))
+        {
+            return;
+        }
+        {
+            std::lock_guard<std::mutex> lock(m_connectionMutex);
+            m_connections.erase(connection->id);
+        }
+        m_stats.closedConnections.fetch_add(1, std::memory_order_relaxed);
+        PushEvent(NetworkConnectionEventType::Disconnected, connection);
+    }
+
+    void NetworkIoBackend::CloseAllSockets()
+    {
+        for (auto& [id, connection] : m_ioConnections)
+        {
+            if (connection->open.exchange(false))
+            {
+                socket_api::Close(connection->socket);
+            }
+        }
+        m_ioConnections.clear();
+
+        // Connections created by Connect() whose registration command never ran
+        {
+            std::lock_guard<std::mutex> lock(m_connectionMutex);
+            for (auto& [id, connection] : m_connections)
+            {
+                if (connection->open.exchange(false))
+                {
+                    socket_api::Close(connection->socket);
+                }
+            }
+            m_connections.clear();
+        }
+
+        for (const Listener& listener : m_listeners)
+        {
+            socket_api::Close(listener.socket);
+        }
+        m_listeners.clear();
+
+        std::lock_guard<std::mutex> lock(m_requestMutex);
+        m_commands.clear();
+        m_sendRequests.clear();
+        m_resumeRequests.clear();
+    }
+} // namespace enigma::network
@@ -0,0 +1,199 @@
+#pragma once
+//-----------------------------------------------------------------------------------------------
+// NetworkIoBackend.hpp
+//
+// Event-driven, cross-platform TCP transport running on its own I/O thread.
+//
+// Compared with NetworkSubsystem (WinSock polling from Update(), std::deque byte queues,
+// delimiter framing) this backend:
+//   - blocks in epoll (Linux) / poll / WSAPoll on a dedicated thread instead of polling per frame
+//   - keeps per-connection send/receive data in contiguous SPSC rings (NetworkRingBuffer)
+//     and moves it with scatter/gather readv/writev (WSARecv/WSASend on Windows)
+//   - frames messages with a 4-byte length prefix and hands out NetworkFrameView pointing
+//     directly into the receive ring (no per-message copy)
+//   - applies backpressure per connection: SendFrame fails fast with Backpressure when the
+//     send ring is full, and the I/O thread stops reading a socket whose receive ring is full
+//     so TCP flow control pushes back on the peer
+//   - drains on orderly peer close: the socket is closed but the connection stays readable
+//     (AcquireFrame keeps returning buffered frames, SendFrame reports NotConnected) and
+//     Disconnected is only reported once every complete frame has been consumed
+//
+// Threading contract:
+//   - Control calls (Listen/Connect/Disconnect/PollConnectionEvents/GetStats) are thread-safe.
+//   - For a given connection, SendFrame must be called from one producer thread at a time and
+//     AcquireFrame/ReleaseFrame from one consumer thread at a time (typically the main thread).
+//-----------------------------------------------------------------------------------------------
+
+#include "Engine/Network/NetworkCommon.hpp"
+#include "Engine/Network/NetworkFrame.hpp"
+#include "Engine/Network/NetworkPoller.hpp"
+#include "Engine/Network/NetworkRingBuffer.hpp"
+
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+namespace enigma::network
+{
+    struct NetworkIoBackendConfig
+    {
+        size_t sendRingBytes  = 256 * 1024; // Per-connection outgoing ring capacity
+        size_t recvRingBytes  = 256 * 1024; // Per-connection incoming ring capacity
+        size_t maxFrameBytes  = 64 * 1024; // Largest accepted payload; larger frames close the connection
+        size_t maxConnections = 1024; // Accepted + outbound connections
+        int    pollTimeoutMs  = 100; // Upper bound on I/O thread sleep, wakeups interrupt it earlier
+        bool   noDelay        = true; // TCP_NODELAY on every connection
+
+        static NetworkIoBackendConfig FromNetworkConfig(const NetworkConfig& config);
+    };
+
+    enum class NetworkSendResult
+    {
+        Ok,
+        Backpressure, // Send ring is full, retry after the I/O thread drained it
+        FrameTooLarge, // Payload exceeds maxFrameBytes
+        NotConnected // Unknown, closed or still connecting connection
+    };
+
+    enum class NetworkConnectionEventType
+    {
+        Connected, // Inbound connection accepted or outbound connect completed
+        ConnectFailed, // Outbound connect failed
+        Disconnected // Peer closed (after its buffered frames were consumed), socket error, protocol error or Disconnect()
+    };
+
+    struct NetworkConnectionEvent
+    {
+        NetworkConnectionEventType type         = NetworkConnectionEventType::Connected;
+        ConnectionId               connectionId = kInvalidConnectionId;
+        bool                       inbound      = false;
+    };
+
+    struct NetworkIoStats
+    {
+        uint64_t bytesSent             = 0;
+        uint64_t bytesReceived         = 0;
+        uint64_t framesSent            = 0;
+        uint64_t framesReceived        = 0;
+        uint64_t writeCalls            = 0; // writev/WSASend syscalls
+        uint64_t readCalls             = 0; // readv/WSARecv syscalls
+        uint64_t sendBackpressureCount = 0; // SendFrame calls rejected because the ring was full
+        uint64_t receivePauseCount     = 0; // Times a socket stopped being read because its ring was full
+        uint64_t acceptedConnections   = 0;
+        uint64_t closedConnections     = 0;
+        size_t   activeConnections     = 0;
+    };
+
+    class NetworkIoBackend
+    {
+    public:
+        explicit NetworkIoBackend(const NetworkIoBackendConfig& config = NetworkIoBackendConfig());
+        ~NetworkIoBackend();
+
+        NetworkIoBackend(const NetworkIoBackend&)            = delete;
+        NetworkIoBackend& operator=(const NetworkIoBackend&) = delete;
+
+        bool Start(); // Creates the poller and launches the I/O thread
+        void Stop(); // Joins the I/O thread and closes every socket
+        bool IsRunning() const { return m_running.load(std::memory_order_acquire); }
+
+        /// Starts listening; port 0 selects an ephemeral port. Returns the bound port, 0 on failure
+        uint16_t Listen(uint16_t port, const std::string& bindIp = "0.0.0.0");
+
+        /// Starts a non-blocking connect; completion is reported through PollConnectionEvents
+        ConnectionId Connect(const std::string& serverIp, uint16_t port);
+        void         Disconnect(ConnectionId connectionId);
+        bool         IsConnected(ConnectionId connectionId) const;
+
+        //=== Data path ===
+        NetworkSendResult SendFrame(ConnectionId connectionId, const void* payload, size_t size);
+        NetworkSendResult SendFrame(ConnectionId connectionId, const core::ByteBuffer& payload);
+
+        /// Exposes the oldest complete frame without copying; false when none is buffered.
+        /// The view stays valid until ReleaseFrame(connectionId).
+        bool AcquireFrame(ConnectionId connectionId, NetworkFrameView& outFrame);
+        void ReleaseFrame(ConnectionId connectionId);
+
+        size_t GetPendingSendBytes(ConnectionId connectionId) const;
+        size_t PollConnectionEvents(std::vector<NetworkConnectionEvent>& outEvents);
+
+        NetworkIoStats GetStats() const;
+        const char*    GetPollerName() const { return m_poller.GetBackendName(); }
+
+    private:
+        struct Connection;
+        using ConnectionPtr = std::shared_ptr<Connection>;
+
+        struct Listener
+        {
+            SocketHandle socket = kInvalidSocket;
+            uint64_t     token  = 0;
+        };
+
+        static constexpr uint64_t kListenerTokenBit = 1ull << 62;
+
+        void RunIoLoop();
+        void ExecuteCommands();
+        void ProcessSendRequests();
+        void ProcessResumeRequests();
+        void HandleListenerReadable(const Listener& listener);
+        void HandleConnectionEvent(const ConnectionPtr& connection, const NetworkPollEvent& event);
+        bool FlushSendRing(const ConnectionPtr& connection);
+        SocketIoStatus FillReceiveRing(const ConnectionPtr& connection);
+        void UpdateInterest(const ConnectionPtr& connection);
+        void RegisterConnection(const ConnectionPtr& connection);
+        void CloseConnection(const ConnectionPtr& connection, NetworkConnectionEventType reason);
+        void BeginDrain(const ConnectionPtr& connection);
+        void FinishDrain(const ConnectionPtr& connection);
+        void CloseAllSockets();
+
+        ConnectionPtr FindConnection(ConnectionId connectionId) const;
+        void          PushEvent(NetworkConnectionEventType type, const ConnectionPtr& connection);
+        void          PostCommand(std::function<void()> command);
+
+        NetworkIoBackendConfig m_config;
+        NetworkPoller          m_poller;
+        std::thread            m_ioThread;
+        std::atomic<bool>      m_running{false};
+        bool                   m_platformStarted = false;
+
+        std::atomic<ConnectionId> m_nextConnectionId{1};
+
+        // Shared connection table for API lookups (guarded by m_connectionMutex)
+        mutable std::mutex                                m_connectionMutex;
+        std::unordered_map<ConnectionId, ConnectionPtr>   m_connections;
+
+        // I/O-thread private state
+        std::unordered_map<uint64_t, ConnectionPtr> m_ioConnections;
+        std::vector<Listener>                       m_listeners;
+        std::vector<NetworkPollEvent>               m_pollEvents;
+
+        // Cross-thread requests to the I/O thread
+        std::mutex                         m_requestMutex;
+        std::vector<std::function<void()>> m_commands; // Control plane: listen/connect/disconnect
+        std::vector<ConnectionId>          m_sendRequests; // Data plane: rings with new outgoing bytes
+        std::vector<ConnectionId>          m_resumeRequests; // Receive rings drained below the pause point
+
+        std::mutex                          m_eventMutex;
+        std::vector<NetworkConnectionEvent> m_events;
+
+        struct AtomicStats
+        {
+            std::atomic<uint64_t> bytesSent{0};
+            std::atomic<uint64_t> bytesReceived{0};
+            std::atomic<uint64_t> framesSent{0};
+            std::atomic<uint64_t> framesReceived{0};
+            std::atomic<uint64_t> writeCalls{0};
+            std::atomic<uint64_t> readCalls{0};
+            std::atomic<uint64_t> sendBackpressureCount{0};
+            std::atomic<uint64_t> receivePauseCount{0};
+            std::atomic<uint64_t> acceptedConnections{0};
+            std::atomic<uint64_t> closedConnections{0};
+        } m_stats;
+    };
+} // namespace enigma::network
@@ -0,0 +1,303 @@
+#include "NetworkPoller.hpp"
+
+#if defined(_WIN32)
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+#include <winsock2.h>
+#elif defined(__linux__)
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <unistd.h>
+#else
+#include <poll.h>
+#endif
+
+#include <atomic>
+#include <unordered_map>
+
+namespace enigma::network
+{
+#if defined(__linux__)
+    //-------------------------------------------------------------------------------------------
+    // epoll backend
+    //-------------------------------------------------------------------------------------------
+    struct NetworkPoller::Impl
+    {
+        int                      epollFd = -1;
+        int                      wakeFd  = -1;
+        std::atomic<bool>        wakePending{false};
+        std::vector<epoll_event> nativeEvents = std::vector<epoll_event>(256);
+    };
+
+    namespace
+    {
+        uint32_t ToEpollMask(bool wantRead, bool wantWrite)
+        {
+            uint32_t mask = 0;
+            if (wantRead) mask |= EPOLLIN | EPOLLRDHUP;
+            if (wantWrite) mask |= EPOLLOUT;
+            return mask;
+        }
+    }
+
+    bool NetworkPoller::Initialize()
+    {
+        m_impl->epollFd = epoll_create1(EPOLL_CLOEXEC);
+        m_impl->wakeFd  = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+        if (m_impl->epollFd < 0 || m_impl->wakeFd < 0)
+        {
+            Shutdown();
+            return false;
+        }
+
+        epoll_event event{};
+        event.events   = EPOLLIN;
+        event.data.u64 = kWakeupToken;
+        return epoll_ctl(m_impl->epollFd, EPOLL_CTL_ADD, m_impl->wakeFd, &event) == 0;
+    }
+
+    void NetworkPoller::Shutdown()
+    {
+        if (m_impl->wakeFd >= 0) ::close(m_impl->wakeFd);
+        if (m_impl->epollFd >= 0) ::close(m_impl->epollFd);
+        m_impl->wakeFd  = -1;
+        m_impl->epollFd = -1;
+    }
+
+    bool NetworkPoller::Add(SocketHandle socket, uint64_t token, bool wantRead, bool wantWrite)
+    {
+        epoll_event event{};
+        event.events   = ToEpollMask(wantRead, wantWrite);
+        event.data.u64 = token;
+        return epoll_ctl(m_impl->epollFd, EPOLL_CTL_ADD, static_cast<int>(socket), &event) == 0;
+    }
+
+    bool NetworkPoller::Modify(SocketHandle socket, uint64_t token, bool wantRead, bool wantWrite)
+    {
+        epoll_event event{};
+        event.events   = ToEpollMask(wantRead, wantWrite);
+        event.data.u64 = token;
+        return epoll_ctl(m_impl->epollFd, EPOLL_CTL_MOD, static_cast<int>(socket), &event) == 0;
+    }
+
+    void NetworkPoller::Remove(SocketHandle socket)
+    {
+        epoll_ctl(m_impl->epollFd, EPOLL_CTL_DEL, static_cast<int>(socket), nullptr);
+    }
+
+    size_t NetworkPoller::Wait(std::vector<NetworkPollEvent>& outEvents, int timeoutMs)
+    {
+        outEvents.clear();
+        int count = epoll_wait(m_impl->epollFd, m_impl->nativeEvents.data(), static_cast<int>(m_impl->nativeEvents.size()), timeoutMs);
+        for (int i = 0; i < count; ++i)
+        {
+            const epoll_event& native = m_impl->nativeEvents[i];
+            if (native.data.u64 == kWakeupToken)
+            {
+                uint64_t value = 0;
+                (void)::read(m_impl->wakeFd, &value, sizeof(value));
+                m_impl->wakePending.store(false, std::memory_order_release);
+                continue;
+            }
+
+            NetworkPollEvent event;
+            event.token    = native.data.u64;
+            event.readable = (native.events & (EPOLLIN | EPOLLRDHUP)) != 0;
+            event.writable = (native.events & EPOLLOUT) != 0;
+            event.error    = (native.events & (EPOLLERR | EPOLLHUP)) != 0;
+            outEvents.push_back(event);
+        }
+
+        // Grow the native event array when saturated so large fan-in does not need extra syscalls
+        if (count == static_cast<int>(m_impl->nativeEvents.size()))
+        {
+            m_impl->nativeEvents.resize(m_impl->nativeEvents.size() * 2);
+        }
+        return outEvents.size();
+    }
+
+    void NetworkPoller::Wakeup()
+    {
+        // Coalesce wakeups: only the first caller since the last Wait() touches the eventfd
+        if (m_impl->wakeFd >= 0 && !m_impl->wakePending.exchange(true, std::memory_order_acq_rel))
+        {
+            uint64_t one = 1;
+            (void)::write(m_impl->wakeFd, &one, sizeof(one));
+        }
+    }
+
+    const char* NetworkPoller::GetBackendName() const
+    {
+        return "epoll";
+    }
+#else
+    //-------------------------------------------------------------------------------------------
+    // poll() / WSAPoll() backend
+    //-------------------------------------------------------------------------------------------
+#if defined(_WIN32)
+    using NativePollFd = WSAPOLLFD;
+    inline int NativePoll(NativePollFd* fds, size_t count, int timeoutMs) { return WSAPoll(fds, static_cast<ULONG>(count), timeoutMs); }
+#else
+    using NativePollFd = pollfd;
+    inline int NativePoll(NativePollFd* fds, size_t count, int timeoutMs) { return ::poll(fds, static_cast<nfds_t>(count), timeoutMs); }
+#endif
+
+    struct NetworkPoller::Impl
+    {
+        SocketHandle                       wakeSocket = kInvalidSocket;
+        std::atomic<bool>                  wakePending{false};
+        std::vector<NativePollFd>          pollFds;
+        std::vector<uint64_t>              tokens;
+        std::unordered_map<SocketHandle, size_t> indexBySocket;
+    };
+
+    namespace
+    {
+        short ToPollMask(bool wantRead, bool wantWrite)
+        {
+            short mask = 0;
+            if (wantRead) mask |= POLLIN;
+            if (wantWrite) mask |= POLLOUT;
+            return mask;
+        }
+    }
+
+    bool NetworkPoller::Initialize()
+    {
+        // A UDP socket connected to itself acts as a portable self-pipe
+        SocketHandle wake = socket_api::CreateUdpSocket();
+        if (wake == kInvalidSocket ||
+            !socket_api::Bind(wake, "127.0.0.1", 0) ||
+            !socket_api::ConnectBlocking(wake, "127.0.0.1", socket_api::GetLocalPort(wake)) ||
+            !socket_api::SetNonBlocking(wake))
+        {
+            socket_api::Close(wake);
+            return false;
+        }
+        m_impl->wakeSocket = wake;
+        return Add(wake, kWakeupToken, true, false);
+    }
+
+    void NetworkPoller::Shutdown()
+    {
+        socket_api::Close(m_impl->wakeSocket);
+        m_impl->wakeSocket = kInvalidSocket;
+        m_impl->pollFds.clear();
+        m_impl->tokens.clear();
+        m_impl->indexBySocket.clear();
+    }
+
+    bool NetworkPoller::Add(SocketHandle socket, uint64_t token, bool wantRead, bool wantWrite)
+    {
+        if (m_impl->indexBySocket.count(socket) != 0)
+        {
+            return false;
+        }
+        NativePollFd entry{};
+        entry.fd     = static_cast<decltype(entry.fd)>(socket);
+        entry.events = ToPollMask(wantRead, wantWrite);
+        m_impl->indexBySocket[socket] = m_impl->pollFds.size();
+        m_impl->pollFds.push_back(entry);
+        m_impl->tokens.push_back(token);
+        return true;
+    }
+
+    bool NetworkPoller::Modify(SocketHandle socket, uint64_t token, bool wantRead, bool wantWrite)
+    {
+        auto it = m_impl->indexBySocket.find(socket);
+        if (it == m_impl->indexBySocket.end())
+        {
+            return false;
+        }
+        m_impl->pollFds[it->second].events = ToPollMask(wantRead, wantWrite);
+        m_impl->tokens[it->second]         = token;
+        return true;
+    }
+
+    void NetworkPoller::Remove(SocketHandle socket)
+    {
+        auto it = m_impl->indexBySocket.find(socket);
+        if (it == m_impl->indexBySocket.end())
+        {
+            return;
+        }
+
+        // Swap-remove keeps the pollfd array dense
+        size_t index = it->second;
+        size_t last  = m_impl->pollFds.size() - 1;
+        if (index != last)
+        {
+            m_impl->pollFds[index] = m_impl->pollFds[last];
+            m_impl->tokens[index]  = m_impl->tokens[last];
+            m_impl->indexBySocket[static_cast<SocketHandle>(m_impl->pollFds[index].fd)] = index;
+        }
+        m_impl->pollFds.pop_back();
+        m_impl->tokens.pop_back();
+        m_impl->indexBySocket.erase(it);
+    }
+
+    size_t NetworkPoller::Wait(std::vector<NetworkPollEvent>& outEvents, int timeoutMs)
+    {
+        outEvents.clear();
+        int count = NativePoll(m_impl->pollFds.data(), m_impl->pollFds.size(), timeoutMs);
+        if (count <= 0)
+        {
+            return 0;
+        }
+
+        for (size_t i = 0; i < m_impl->pollFds.size(); ++i)
+        {
+            const NativePollFd& native = m_impl->pollFds[i];
+            if (native.revents == 0)
+            {
+                continue;
+            }
+            if (m_impl->tokens[i] == kWakeupToken)
+            {
+                uint8_t drain[64];
+                while (socket_api::Receive(m_impl->wakeSocket, drain, sizeof(drain)).status == SocketIoStatus::Ok)
+                {
+                }
+                m_impl->wakePending.store(false, std::memory_order_release);
+                continue;
+            }
+
+            NetworkPollEvent event;
+            event.token    = m_impl->tokens[i];
+            event.readable = (native.revents & POLLIN) != 0;
+            event.writable = (native.revents & POLLOUT) != 0;
+            event.error    = (native.revents & (POLLERR | POLLHUP | POLLNVAL)) != 0;
+            outEvents.push_back(event);
+        }
+        return outEvents.size();
+    }
+
+    void NetworkPoller::Wakeup()
+    {
+        if (m_impl->wakeSocket != kInvalidSocket && !m_impl->wakePending.exchange(true, std::memory_order_acq_rel))
+        {
+            uint8_t one = 1;
+            (void)socket_api::Send(m_impl->wakeSocket, &one, sizeof(one));
+        }
+    }
+
+    const char* NetworkPoller::GetBackendName() const
+    {
+#if defined(_WIN32)
+        return "WSAPoll";
+#else
+        return "poll";
+#endif
+    }
+#endif
+
+    NetworkPoller::NetworkPoller()
+        : m_impl(std::make_unique<Impl>())
+    {
+    }
+
+    NetworkPoller::~NetworkPoller()
+    {
+        Shutdown();
+    }
+} // namespace enigma::network
@@ -0,0 +1,58 @@
+#pragma once
+//-----------------------------------------------------------------------------------------------
+// NetworkPoller.hpp
+//
+// Readiness notification for the network I/O thread.
+//   Linux   : epoll + eventfd wakeup
+//   Others  : poll() / WSAPoll() + self-connected loopback UDP socket wakeup
+//
+// All methods except Wakeup() must be called from the thread that owns the poller.
+//-----------------------------------------------------------------------------------------------
+
+#include "Engine/Network/NetworkSocket.hpp"
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace enigma::network
+{
+    struct NetworkPollEvent
+    {
+        uint64_t token    = 0;
+        bool     readable = false;
+        bool     writable = false;
+        bool     error    = false; // Hang-up or socket error
+    };
+
+    class NetworkPoller
+    {
+    public:
+        static constexpr uint64_t kWakeupToken = ~static_cast<uint64_t>(0);
+
+        NetworkPoller();
+        ~NetworkPoller();
+
+        NetworkPoller(const NetworkPoller&)            = delete;
+        NetworkPoller& operator=(const NetworkPoller&) = delete;
+
+        bool Initialize();
+        void Shutdown();
+
+        bool Add(SocketHandle socket, uint64_t token, bool wantRead, bool wantWrite);
+        bool Modify(SocketHandle socket, uint64_t token, bool wantRead, bool wantWrite);
+        void Remove(SocketHandle socket);
+
+        // Blocks up to timeoutMs (-1 = infinite); wakeup notifications are consumed internally
+        size_t Wait(std::vector<NetworkPollEvent>& outEvents, int timeoutMs);
+
+        // Thread-safe: interrupts a blocked Wait()
+        void Wakeup();
+
+        const char* GetBackendName() const;
+
+    private:
+        struct Impl;
+        std::unique_ptr<Impl> m_impl;
+    };
+} // namespace enigma::network
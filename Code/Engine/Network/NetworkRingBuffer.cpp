@@ -0,0 +1,169 @@
+#include "NetworkRingBuffer.hpp"
+
+#include <algorithm>
+#include <cstring>
+
+namespace enigma::network
+{
+    namespace
+    {
+        size_t RoundUpToPowerOfTwo(size_t value)
+        {
+            size_t result = 64;
+            while (result < value)
+            {
+                result <<= 1;
+            }
+            return result;
+        }
+    }
+
+    NetworkRingBuffer::NetworkRingBuffer(size_t capacity)
+        : m_storage(RoundUpToPowerOfTwo(capacity))
+          , m_mask(m_storage.size() - 1)
+    {
+    }
+
+    size_t NetworkRingBuffer::ReadableBytes() const
+    {
+        uint64_t write = m_writePosition.load(std::memory_order_acquire);
+        uint64_t read  = m_readPosition.load(std::memory_order_acquire);
+        return static_cast<size_t>(write - read);
+    }
+
+    size_t NetworkRingBuffer::WritableBytes() const
+    {
+        return m_storage.size() - ReadableBytes();
+    }
+
+    size_t NetworkRingBuffer::GetWritableSpans(SocketIoSpan outSpans[2])
+    {
+        uint64_t write = m_writePosition.load(std::memory_order_relaxed);
+        uint64_t read  = m_readPosition.load(std::memory_order_acquire);
+        size_t   free  = m_storage.size() - static_cast<size_t>(write - read);
+        if (free == 0)
+        {
+            return 0;
+        }
+
+        size_t offset    = static_cast<size_t>(write) & m_mask;
+        size_t firstSize = (std::min)(free, m_storage.size() - offset);
+        outSpans[0]      = SocketIoSpan{m_storage.data() + offset, firstSize};
+        if (firstSize == free)
+        {
+            return 1;
+        }
+        outSpans[1] = SocketIoSpan{m_storage.data(), free - firstSize};
+        return 2;
+    }
+
+    void NetworkRingBuffer::CommitWrite(size_t bytes)
+    {
+        m_writePosition.store(m_writePosition.load(std::memory_order_relaxed) + bytes, std::memory_order_release);
+    }
+
+    bool NetworkRingBuffer::Write(const SocketIoSpan* pieces, size_t pieceCount)
+    {
+        size_t total = 0;
+        for (size_t i = 0; i < pieceCount; ++i)
+        {
+            total += pieces[i].size;
+        }
+        if (total > WritableBytes())
+        {
+            return false;
+        }
+
+        uint64_t write = m_writePosition.load(std::memory_order_relaxed);
+        for (size_t i = 0; i < pieceCount; ++i)
+        {
+            const auto* source    = static_cast<const uint8_t*>(pieces[i].data);
+            size_t      remaining = pieces[i].size;
+            while (remaining > 0)
+            {
+                size_t offset = static_cast<size_t>(write) & m_mask;
+                size_t chunk  = (std::min)(remaining, m_storage.size() - offset);
+                std::memcpy(m_storage.data() + offset, source, chunk);
+                source += chunk;
+                remaining -= chunk;
+                write += chunk;
+            }
+        }
+        m_writePosition.store(write, std::memory_order_release);
+        return true;
+    }
+
+    bool NetworkRingBuffer::Write(const void* data, size_t size)
+    {
+        SocketIoSpan piece{const_cast<void*>(data), size};
+        return Write(&piece, 1);
+    }
+
+    size_t NetworkRingBuffer::GetReadableSpans(SocketIoSpan outSpans[2]) const
+    {
+        uint64_t read      = m_readPosition.load(std::memory_order_relaxed);
+        uint64_t write     = m_writePosition.load(std::memory_order_acquire);
+        size_t   available = static_cast<size_t>(write - read);
+        if (available == 0)
+        {
+            return 0;
+        }
+
+        auto*  storage   = const_cast<uint8_t*>(m_storage.data());
+        size_t offset    = static_cast<size_t>(read) & m_mask;
+        size_t firstSize = (std::min)(available, m_storage.size() - offset);
+        outSpans[0]      = SocketIoSpan{storage + offset, firstSize};
+        if (firstSize == available)
+        {
+            return 1;
+        }
+        outSpans[1] = SocketIoSpan{storage, available - firstSize};
+        return 2;
+    }
+
+    bool NetworkRingBuffer::Peek(void* dest, size_t size, size_t offset) const
+    {
+        if (offset + size > ReadableBytes())
+        {
+            return false;
+        }
+
+        auto*    target   = static_cast<uint8_t*>(dest);
+        uint64_t position = m_readPosition.load(std::memory_order_relaxed) + offset;
+        while (size > 0)
+        {
+            size_t physical = static_cast<size_t>(position) & m_mask;
+            size_t chunk    = (std::min)(size, m_storage.size() - physical);
+            std::memcpy(target, m_storage.data() + physical, chunk);
+            target += chunk;
+            size -= chunk;
+            position += chunk;
+        }
+        return true;
+    }
+
+    const uint8_t* NetworkRingBuffer::TryGetContiguous(size_t offset, size_t size) const
+    {
+        if (offset + size > ReadableBytes())
+        {
+            return nullptr;
+        }
+
+        size_t physical = static_cast<size_t>(m_readPosition.load(std::memory_order_relaxed) + offset) & m_mask;
+        if (physical + size > m_storage.size())
+        {
+            return nullptr;
+        }
+        return m_storage.data() + physical;
+    }
+
+    void NetworkRingBuffer::CommitRead(size_t bytes)
+    {
+        m_readPosition.store(m_readPosition.load(std::memory_order_relaxed) + bytes, std::memory_order_release);
+    }
+
+    void NetworkRingBuffer::Reset()
+    {
+        m_readPosition.store(m_writePosition.load(std::memory_order_acquire), std::memory_order_release);
+    }
+} // namespace enigma::network
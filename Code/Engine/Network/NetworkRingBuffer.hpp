@@ -0,0 +1,60 @@
+#pragma once
+//-----------------------------------------------------------------------------------------------
+// NetworkRingBuffer.hpp
+//
+// Contiguous single-producer / single-consumer byte ring used for per-connection send and
+// receive queues. Replaces the element-wise std::deque<uint8_t> queues: producers write whole
+// spans with memcpy (or directly via readv into GetWritableSpans), consumers drain whole spans
+// (or directly via writev from GetReadableSpans).
+//
+// Positions are monotonic 64-bit counters; capacity is rounded up to a power of two so the
+// physical offset is (position & mask). One thread may produce while another consumes.
+//-----------------------------------------------------------------------------------------------
+
+#include "Engine/Network/NetworkSocket.hpp"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace enigma::network
+{
+    class NetworkRingBuffer
+    {
+    public:
+        explicit NetworkRingBuffer(size_t capacity);
+
+        NetworkRingBuffer(const NetworkRingBuffer&)            = delete;
+        NetworkRingBuffer& operator=(const NetworkRingBuffer&) = delete;
+
+        size_t Capacity() const { return m_storage.size(); }
+        size_t ReadableBytes() const;
+        size_t WritableBytes() const;
+        bool   IsEmpty() const { return ReadableBytes() == 0; }
+
+        //=== Producer side ===
+        // Returns the number of spans (0..2) covering all free space, in write order
+        size_t GetWritableSpans(SocketIoSpan outSpans[2]);
+        void   CommitWrite(size_t bytes);
+        // All-or-nothing append of several pieces; false when the ring lacks space (backpressure)
+        bool Write(const SocketIoSpan* pieces, size_t pieceCount);
+        bool Write(const void* data, size_t size);
+
+        //=== Consumer side ===
+        size_t GetReadableSpans(SocketIoSpan outSpans[2]) const;
+        // Copies size bytes starting offset bytes past the read position; false if not readable
+        bool Peek(void* dest, size_t size, size_t offset = 0) const;
+        // Pointer to size readable bytes at offset if they do not wrap, nullptr otherwise
+        const uint8_t* TryGetContiguous(size_t offset, size_t size) const;
+        void           CommitRead(size_t bytes);
+        void           Reset();
+
+    private:
+        std::vector<uint8_t> m_storage;
+        size_t               m_mask = 0;
+
+        alignas(64) std::atomic<uint64_t> m_writePosition{0}; // Advanced by producer only
+        alignas(64) std::atomic<uint64_t> m_readPosition{0}; // Advanced by consumer only
+    };
+} // namespace enigma::network
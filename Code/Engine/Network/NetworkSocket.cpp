@@ -0,0 +1,303 @@
+#include "NetworkSocket.hpp"
+
+#if defined(_WIN32)
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+#include <winsock2.h>
+#include <ws2tcpip.h>
+#pragma comment(lib, "Ws2_32.lib")
+#else
+#include <arpa/inet.h>
+#include <cerrno>
+#include <csignal>
+#include <fcntl.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/socket.h>
+#include <sys/uio.h>
+#include <unistd.h>
+#endif
+
+#include <algorithm>
+
+namespace enigma::network::socket_api
+{
+#if defined(_WIN32)
+    namespace
+    {
+        using NativeSocket = SOCKET;
+
+        inline NativeSocket ToNative(SocketHandle h) { return static_cast<NativeSocket>(h); }
+        inline SocketHandle FromNative(NativeSocket s) { return s == INVALID_SOCKET ? kInvalidSocket : static_cast<SocketHandle>(s); }
+        inline bool         IsWouldBlock() { return WSAGetLastError() == WSAEWOULDBLOCK; }
+    }
+
+    bool StartupPlatform()
+    {
+        // WSAStartup is reference counted, every call is matched by ShutdownPlatform()
+        WSADATA wsaData;
+        return WSAStartup(MAKEWORD(2, 2), &wsaData) == 0;
+    }
+
+    void ShutdownPlatform()
+    {
+        WSACleanup();
+    }
+
+    void Close(SocketHandle socket)
+    {
+        if (socket != kInvalidSocket)
+        {
+            closesocket(ToNative(socket));
+        }
+    }
+
+    bool SetNonBlocking(SocketHandle socket)
+    {
+        u_long mode = 1;
+        return ioctlsocket(ToNative(socket), FIONBIO, &mode) == 0;
+    }
+#else
+    namespace
+    {
+        using NativeSocket = int;
+
+        inline NativeSocket ToNative(SocketHandle h) { return static_cast<NativeSocket>(h); }
+        inline SocketHandle FromNative(NativeSocket s) { return s < 0 ? kInvalidSocket : static_cast<SocketHandle>(s); }
+        inline bool         IsWouldBlock() { return errno == EAGAIN || errno == EWOULDBLOCK; }
+
+#if defined(MSG_NOSIGNAL)
+        constexpr int kSendFlags = MSG_NOSIGNAL;
+#else
+        constexpr int kSendFlags = 0;
+#endif
+    }
+
+    bool StartupPlatform()
+    {
+        // A write to a reset connection must surface as EPIPE instead of killing the process
+        std::signal(SIGPIPE, SIG_IGN);
+        return true;
+    }
+
+    void ShutdownPlatform()
+    {
+    }
+
+    void Close(SocketHandle socket)
+    {
+        if (socket != kInvalidSocket)
+        {
+            ::close(ToNative(socket));
+        }
+    }
+
+    bool SetNonBlocking(SocketHandle socket)
+    {
+        int flags = fcntl(ToNative(socket), F_GETFL, 0);
+        return flags >= 0 && fcntl(ToNative(socket), F_SETFL, flags | O_NONBLOCK) == 0;
+    }
+#endif
+
+    namespace
+    {
+        bool MakeAddress(const std::string& ip, uint16_t port, sockaddr_in& outAddress)
+        {
+            outAddress            = sockaddr_in{};
+            outAddress.sin_family = AF_INET;
+            outAddress.sin_port   = htons(port);
+            if (ip.empty() || ip == "0.0.0.0")
+            {
+                outAddress.sin_addr.s_addr = htonl(INADDR_ANY);
+                return true;
+            }
+            return inet_pton(AF_INET, ip.c_str(), &outAddress.sin_addr) == 1;
+        }
+    }
+
+    SocketHandle CreateTcpSocket()
+    {
+        return FromNative(::socket(AF_INET, SOCK_STREAM, IPPROTO_TCP));
+    }
+
+    SocketHandle CreateUdpSocket()
+    {
+        return FromNative(::socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP));
+    }
+
+    bool SetNoDelay(SocketHandle socket)
+    {
+        int enable = 1;
+        return setsockopt(ToNative(socket), IPPROTO_TCP, TCP_NODELAY, reinterpret_cast<const char*>(&enable), sizeof(enable)) == 0;
+    }
+
+    bool SetReuseAddress(SocketHandle socket)
+    {
+        int enable = 1;
+        return setsockopt(ToNative(socket), SOL_SOCKET, SO_REUSEADDR, reinterpret_cast<const char*>(&enable), sizeof(enable)) == 0;
+    }
+
+    bool Bind(SocketHandle socket, const std::string& ip, uint16_t port)
+    {
+        sockaddr_in address;
+        if (!MakeAddress(ip, port, address))
+        {
+            return false;
+        }
+        return ::bind(ToNative(socket), reinterpret_cast<sockaddr*>(&address), sizeof(address)) == 0;
+    }
+
+    bool Listen(SocketHandle socket)
+    {
+        return ::listen(ToNative(socket), SOMAXCONN) == 0;
+    }
+
+    uint16_t GetLocalPort(SocketHandle socket)
+    {
+        sockaddr_in address{};
+        socklen_t   length = sizeof(address);
+        if (getsockname(ToNative(socket), reinterpret_cast<sockaddr*>(&address), &length) != 0)
+        {
+            return 0;
+        }
+        return ntohs(address.sin_port);
+    }
+
+    SocketHandle Accept(SocketHandle listenSocket)
+    {
+        return FromNative(::accept(ToNative(listenSocket), nullptr, nullptr));
+    }
+
+    bool ConnectNonBlocking(SocketHandle socket, const std::string& ip, uint16_t port)
+    {
+        sockaddr_in address;
+        if (!MakeAddress(ip, port, address))
+        {
+            return false;
+        }
+        if (::connect(ToNative(socket), reinterpret_cast<sockaddr*>(&address), sizeof(address)) == 0)
+        {
+            return true;
+        }
+#if defined(_WIN32)
+        return WSAGetLastError() == WSAEWOULDBLOCK;
+#else
+        return errno == EINPROGRESS;
+#endif
+    }
+
+    bool ConnectBlocking(SocketHandle socket, const std::string& ip, uint16_t port)
+    {
+        sockaddr_in address;
+        if (!MakeAddress(ip, port, address))
+        {
+            return false;
+        }
+        return ::connect(ToNative(socket), reinterpret_cast<sockaddr*>(&address), sizeof(address)) == 0;
+    }
+
+    bool GetPendingError(SocketHandle socket)
+    {
+        int       error  = 0;
+        socklen_t length = sizeof(error);
+        if (getsockopt(ToNative(socket), SOL_SOCKET, SO_ERROR, reinterpret_cast<char*>(&error), &length) != 0)
+        {
+            return true;
+        }
+        return error != 0;
+    }
+
+    SocketIoResult ReadVector(SocketHandle socket, const SocketIoSpan* spans, size_t spanCount)
+    {
+        SocketIoResult result;
+#if defined(_WIN32)
+        WSABUF buffers[4];
+        DWORD  count = static_cast<DWORD>((std::min)(spanCount, static_cast<size_t>(4)));
+        for (DWORD i = 0; i < count; ++i)
+        {
+            buffers[i].buf = static_cast<CHAR*>(spans[i].data);
+            buffers[i].len = static_cast<ULONG>(spans[i].size);
+        }
+        DWORD received = 0;
+        DWORD flags    = 0;
+        if (WSARecv(ToNative(socket), buffers, count, &received, &flags, nullptr, nullptr) == SOCKET_ERROR)
+        {
+            result.status = IsWouldBlock() ? SocketIoStatus::WouldBlock : SocketIoStatus::Error;
+            return result;
+        }
+        result.transferred = received;
+#else
+        iovec vectors[4];
+        int   count = static_cast<int>((std::min)(spanCount, static_cast<size_t>(4)));
+        for (int i = 0; i < count; ++i)
+        {
+            vectors[i].iov_base = spans[i].data;
+            vectors[i].iov_len  = spans[i].size;
+        }
+        ssize_t received = ::readv(ToNative(socket), vectors, count);
+        if (received < 0)
+        {
+            result.status = IsWouldBlock() ? SocketIoStatus::WouldBlock : SocketIoStatus::Error;
+            return result;
+        }
+        result.transferred = static_cast<size_t>(received);
+#endif
+        if (result.transferred == 0)
+        {
+            result.status = SocketIoStatus::Closed;
+        }
+        return result;
+    }
+
+    SocketIoResult WriteVector(SocketHandle socket, const SocketIoSpan* spans, size_t spanCount)
+    {
+        SocketIoResult result;
+#if defined(_WIN32)
+        WSABUF buffers[4];
+        DWORD  count = static_cast<DWORD>((std::min)(spanCount, static_cast<size_t>(4)));
+        for (DWORD i = 0; i < count; ++i)
+        {
+            buffers[i].buf = static_cast<CHAR*>(spans[i].data);
+            buffers[i].len = static_cast<ULONG>(spans[i].size);
+        }
+        DWORD sent = 0;
+        if (WSASend(ToNative(socket), buffers, count, &sent, 0, nullptr, nullptr) == SOCKET_ERROR)
+        {
+            result.status = IsWouldBlock() ? SocketIoStatus::WouldBlock : SocketIoStatus::Error;
+            return result;
+        }
+        result.transferred = sent;
+#else
+        msghdr message{};
+        iovec  vectors[4];
+        size_t count = (std::min)(spanCount, static_cast<size_t>(4));
+        for (size_t i = 0; i < count; ++i)
+        {
+            vectors[i].iov_base = spans[i].data;
+            vectors[i].iov_len  = spans[i].size;
+        }
+        message.msg_iov    = vectors;
+        message.msg_iovlen = count;
+        ssize_t sent       = ::sendmsg(ToNative(socket), &message, kSendFlags);
+        if (sent < 0)
+        {
+            result.status = IsWouldBlock() ? SocketIoStatus::WouldBlock : SocketIoStatus::Error;
+            return result;
+        }
+        result.transferred = static_cast<size_t>(sent);
+#endif
+        return result;
+    }
+
+    SocketIoResult Send(SocketHandle socket, const void* data, size_t size)
+    {
+        SocketIoSpan span{const_cast<void*>(data), size};
+        return WriteVector(socket, &span, 1);
+    }
+
+    SocketIoResult Receive(SocketHandle socket, void* data, size_t size)
+    {
+        SocketIoSpan span{data, size};
+        return ReadVector(socket, &span, 1);
+    }
+} // namespace enigma::network::socket_api
@@ -0,0 +1,69 @@
+#pragma once
+//-----------------------------------------------------------------------------------------------
+// NetworkSocket.hpp
+//
+// Thin platform shim over BSD sockets / WinSock used by the event-driven network backend.
+// Socket handles are stored as uint64_t (same convention as NetworkSubsystem) so that no
+// platform header leaks into engine headers.
+//-----------------------------------------------------------------------------------------------
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace enigma::network
+{
+    using SocketHandle = uint64_t;
+
+    constexpr SocketHandle kInvalidSocket = ~static_cast<SocketHandle>(0);
+
+    /// Scatter/gather element, maps onto iovec (POSIX) / WSABUF (Windows)
+    struct SocketIoSpan
+    {
+        void*  data = nullptr;
+        size_t size = 0;
+    };
+
+    enum class SocketIoStatus
+    {
+        Ok, // Transferred > 0 bytes
+        WouldBlock, // Nothing transferred, retry when the poller reports readiness
+        Closed, // Peer performed an orderly shutdown (recv returned 0)
+        Error // Hard error, the socket should be closed
+    };
+
+    struct SocketIoResult
+    {
+        SocketIoStatus status      = SocketIoStatus::Ok;
+        size_t         transferred = 0;
+    };
+
+    namespace socket_api
+    {
+        bool StartupPlatform(); // WSAStartup on Windows, SIGPIPE suppression on POSIX
+        void ShutdownPlatform();
+
+        SocketHandle CreateTcpSocket();
+        SocketHandle CreateUdpSocket();
+        void         Close(SocketHandle socket);
+
+        bool SetNonBlocking(SocketHandle socket);
+        bool SetNoDelay(SocketHandle socket);
+        bool SetReuseAddress(SocketHandle socket);
+
+        bool         Bind(SocketHandle socket, const std::string& ip, uint16_t port);
+        bool         Listen(SocketHandle socket);
+        uint16_t     GetLocalPort(SocketHandle socket);
+        SocketHandle Accept(SocketHandle listenSocket); // kInvalidSocket when nothing is pending
+
+        /// Starts a non-blocking connect; returns false only on immediate hard failure
+        bool ConnectNonBlocking(SocketHandle socket, const std::string& ip, uint16_t port);
+        bool ConnectBlocking(SocketHandle socket, const std::string& ip, uint16_t port);
+        bool GetPendingError(SocketHandle socket); // true if SO_ERROR reports a failure
+
+        SocketIoResult ReadVector(SocketHandle socket, const SocketIoSpan* spans, size_t spanCount);
+        SocketIoResult WriteVector(SocketHandle socket, const SocketIoSpan* spans, size_t spanCount);
+        SocketIoResult Send(SocketHandle socket, const void* data, size_t size);
+        SocketIoResult Receive(SocketHandle socket, void* data, size_t size);
+    }
+} // namespace enigma::network
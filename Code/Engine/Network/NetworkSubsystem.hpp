@@ -11,6 +11,9 @@
  * including initializing and cleaning up network-related resources, starting
  * and stopping servers and clients, sending and receiving data, and
  * maintaining client and server states.
+ *
+ * WinSock-only and polled from Update(). For a cross-platform, event-driven transport
+ * with length-prefixed framing see enigma::network::NetworkIoBackend.
  */
 class NetworkSubsystem
 {
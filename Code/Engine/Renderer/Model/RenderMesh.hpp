@@ -25,6 +25,8 @@ namespace enigma::renderer::model
         Direction               cullDirection = Direction::NORTH; // Direction this face can be culled against
         bool                    isOpaque      = true; // Whether this face is opaque
         int                     textureIndex  = 0; // Index in texture atlas
+        bool                    hasCullFace   = true; // False: always drawn, whatever the neighbor in cullDirection
+        int                     tintIndex     = -1; // Tint slot from the model face, -1 = untinted
 
         RenderFace() = default;
 
@@ -2,6 +2,7 @@
 #include "../ResourceCommon.hpp"
 #include "../../Math/Vec2.hpp"
 #include "../../Math/IntVec2.hpp"
+#include <cstdint>
 #include <string>
 #include <vector>
 #include <unordered_set>
@@ -40,7 +41,8 @@ namespace enigma::resource
         std::string              prefix = ""; // Optional prefix for sprite names
         std::vector<std::string> namespaces; // Namespaces to include (empty = all)
 
-        // For FILTER type
+        // For FILTER type: ResourceGlob patterns matched against the texture path
+        // ('*' stays inside one folder, use '**' to match across folders)
         std::vector<std::string> includePatterns;
         std::vector<std::string> excludePatterns;
 
@@ -124,7 +126,11 @@ namespace enigma::resource
         IntVec2 maxAtlasSize  = IntVec2(4096, 4096); // Maximum atlas size (GPU limit consideration)
         int     padding       = 0; // Padding between sprites (prevent bleeding)
         BorderExtrusionMode borderMode = BorderExtrusionMode::CLAMP_TO_EDGE; // How padding pixels are filled
-        bool    allowRotation = false; // Allow sprite rotation for better packing (disabled for simplicity)
+        bool    allowRotation = false; // Reserved: the MaxRects packer never rotates, AtlasSprite UVs carry no rotation
+
+        // Baked atlas cache: packed pixels + sprite table reused while the inputs are unchanged
+        bool        useBakedCache  = true;
+        std::string bakedCachePath = ".enigma/cache/atlas/"; // <bakedCachePath><name>.atlas
 
         // Export settings
         bool        exportPNG  = true; // Export atlas to PNG for debugging
@@ -195,7 +201,10 @@ namespace enigma::resource
         float  packingEfficiency = 0.0f; // Percentage of atlas actually used
         int    rejectedSprites   = 0; // Number of sprites rejected due to resolution mismatch
         int    scaledSprites     = 0; // Number of sprites that were scaled
+        int    droppedSprites    = 0; // Sprites that did not fit into maxAtlasSize
         size_t atlasSizeBytes    = 0; // Final atlas size in bytes
+        double buildMs           = 0.0; // Packing + copy time, or load time for a baked atlas
+        bool   loadedFromBaked   = false; // Built from the baked cache instead of packing
 
         // Reset all stats
         void Reset()
@@ -206,16 +215,19 @@ namespace enigma::resource
             packingEfficiency = 0.0f;
             rejectedSprites   = 0;
             scaledSprites     = 0;
+            droppedSprites    = 0;
             atlasSizeBytes    = 0;
+            buildMs           = 0.0;
+            loadedFromBaked   = false;
         }
 
-        // Calculate packing efficiency
-        void CalculatePackingEfficiency(int usedPixels)
+        // Calculate packing efficiency (sprite content pixels, padding excluded)
+        void CalculatePackingEfficiency(int64_t usedPixels)
         {
-            int totalPixels = atlasWidth * atlasHeight;
+            int64_t totalPixels = static_cast<int64_t>(atlasWidth) * atlasHeight;
             if (totalPixels > 0)
             {
-                packingEfficiency = static_cast<float>(usedPixels) / static_cast<float>(totalPixels) * 100.0f;
+                packingEfficiency = static_cast<float>(static_cast<double>(usedPixels) / static_cast<double>(totalPixels) * 100.0);
             }
         }
     };
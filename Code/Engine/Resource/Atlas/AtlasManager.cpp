@@ -5,7 +5,6 @@
 #include "../../Core/FileSystemHelper.hpp"
 #include <algorithm>
 #include <filesystem>
-#include <regex>
 
 #include "Engine/Core/Logger/LoggerAPI.hpp"
 using namespace enigma::core;
@@ -73,13 +72,33 @@ namespace enigma::resource
             m_atlases[atlasName]->ClearAtlas();
         }
 
-        // Build the atlas
-        bool success = m_atlases[atlasName]->BuildAtlas(images);
+        // Reuse the baked atlas while the input file set is unchanged, otherwise pack and bake it
+        TextureAtlas*         atlas     = m_atlases[atlasName].get();
+        const uint64_t        bakeKey   = TextureAtlas::ComputeBakeKey(config, images);
+        std::filesystem::path bakedPath = std::filesystem::path(config.bakedCachePath) / (atlasName + ".atlas");
+
+        bool success = config.useBakedCache && atlas->LoadBaked(bakedPath, bakeKey);
+        if (!success)
+        {
+            success = atlas->BuildAtlas(images);
+            if (success && config.useBakedCache && !atlas->SaveBaked(bakedPath, bakeKey))
+            {
+                LogWarn(LogAtlas, "Failed to write baked atlas '%s'", bakedPath.string().c_str());
+            }
+        }
 
         if (success)
         {
             m_lookupCacheValid = false;
-            LogInfo(LogAtlas, "Atlas '%s' built successfully", atlasName.c_str());
+            const AtlasStats& stats = atlas->GetStats();
+            LogInfo(LogAtlas, "Atlas '%s' %s in %.2f ms (%dx%d, %.1f%% packed)", atlasName.c_str(),
+                    stats.loadedFromBaked ? "loaded from baked cache" : "built", stats.buildMs,
+                    stats.atlasWidth, stats.atlasHeight, stats.packingEfficiency);
+            if (stats.droppedSprites > 0)
+            {
+                LogWarn(LogAtlas, "Atlas '%s' dropped %d sprites that did not fit into %dx%d", atlasName.c_str(),
+                        stats.droppedSprites, config.maxAtlasSize.x, config.maxAtlasSize.y);
+            }
 
             // Export to PNG if configured
             if (config.exportPNG)
@@ -211,26 +230,18 @@ namespace enigma::resource
 
     std::vector<ResourceLocation> AtlasManager::FindTexturesByPattern(const std::string& pattern, const std::vector<std::string>& namespaces)
     {
-        std::vector<ResourceLocation> matches;
-
-        // Get all texture resources from the resource subsystem
-        std::vector<ResourceLocation> allTextures = m_resourceSubsystem->ListResources("", ResourceType::TEXTURE);
-
-        for (const ResourceLocation& location : allTextures)
+        // One catalog range query per namespace; "*:" spans every namespace when none are given
+        if (namespaces.empty())
         {
-            // Check namespace filter
-            if (!namespaces.empty() && !MatchesNamespaceFilter(location, namespaces))
-            {
-                continue;
-            }
-
-            // Check pattern match
-            if (MatchesPattern(location.GetPath(), pattern))
-            {
-                matches.push_back(location);
-            }
+            return m_resourceSubsystem->SearchResources(ResourceGlob("*:" + pattern), ResourceType::TEXTURE);
         }
 
+        std::vector<ResourceLocation> matches;
+        for (const std::string& namespaceName : namespaces)
+        {
+            std::vector<ResourceLocation> namespaceMatches = m_resourceSubsystem->SearchResources(ResourceGlob(namespaceName + ":" + pattern), ResourceType::TEXTURE);
+            matches.insert(matches.end(), namespaceMatches.begin(), namespaceMatches.end());
+        }
         return matches;
     }
 
@@ -319,7 +330,7 @@ namespace enigma::resource
     bool AtlasManager::CollectTexturesFromDirectory(const AtlasSourceEntry& source, std::vector<std::shared_ptr<ImageResource>>& outImages)
     {
         // Get all texture resources matching the directory pattern
-        std::vector<ResourceLocation> textureLocations = FindTexturesByPattern(source.source + "*", source.namespaces);
+        std::vector<ResourceLocation> textureLocations = FindTexturesByPattern(source.source + "**", source.namespaces);
 
         for (const ResourceLocation& location : textureLocations)
         {
@@ -368,47 +379,31 @@ namespace enigma::resource
 
     bool AtlasManager::CollectTexturesFromFilter(const AtlasSourceEntry& source, std::vector<std::shared_ptr<ImageResource>>& outImages)
     {
-        std::vector<ResourceLocation> allTextures = m_resourceSubsystem->ListResources("", ResourceType::TEXTURE);
-
-        for (const ResourceLocation& location : allTextures)
+        // Include patterns narrow the catalog query; excludes are compiled once and tested per candidate
+        std::vector<ResourceLocation> candidates;
+        if (source.includePatterns.empty())
         {
-            bool shouldInclude = false;
-
-            // Check include patterns
-            if (source.includePatterns.empty())
-            {
-                shouldInclude = true;
-            }
-            else
-            {
-                for (const std::string& pattern : source.includePatterns)
-                {
-                    if (MatchesPattern(location.GetPath(), pattern))
-                    {
-                        shouldInclude = true;
-                        break;
-                    }
-                }
-            }
+            candidates = FindTexturesByPattern("**", source.namespaces);
+        }
+        for (const std::string& pattern : source.includePatterns)
+        {
+            std::vector<ResourceLocation> matches = FindTexturesByPattern(pattern, source.namespaces);
+            candidates.insert(candidates.end(), matches.begin(), matches.end());
+        }
+        if (source.includePatterns.size() > 1)
+        {
+            std::sort(candidates.begin(), candidates.end());
+            candidates.erase(std::unique(candidates.begin(), candidates.end()), candidates.end());
+        }
 
-            // Check exclude patterns
-            if (shouldInclude)
-            {
-                for (const std::string& pattern : source.excludePatterns)
-                {
-                    if (MatchesPattern(location.GetPath(), pattern))
-                    {
-                        shouldInclude = false;
-                        break;
-                    }
-                }
-            }
+        std::vector<ResourceGlob> excludeGlobs(source.excludePatterns.begin(), source.excludePatterns.end());
 
-            // Check namespace filter
-            if (shouldInclude && !MatchesNamespaceFilter(location, source.namespaces))
+        for (const ResourceLocation& location : candidates)
+        {
+            bool shouldInclude = std::none_of(excludeGlobs.begin(), excludeGlobs.end(), [&location](const ResourceGlob& glob)
             {
-                shouldInclude = false;
-            }
+                return glob.Matches(location.GetPath());
+            });
 
             if (shouldInclude)
             {
@@ -427,47 +422,6 @@ namespace enigma::resource
         return !outImages.empty();
     }
 
-    bool AtlasManager::MatchesNamespaceFilter(const ResourceLocation& location, const std::vector<std::string>& namespaces) const
-    {
-        if (namespaces.empty())
-        {
-            return true;
-        }
-
-        return std::find(namespaces.begin(), namespaces.end(), location.GetNamespace()) != namespaces.end();
-    }
-
-    bool AtlasManager::MatchesPattern(const std::string& str, const std::string& pattern) const
-    {
-        // Simple wildcard matching (* for any characters)
-        if (pattern == "*")
-        {
-            return true;
-        }
-
-        if (pattern.find('*') == std::string::npos)
-        {
-            // No wildcards, exact match
-            return str == pattern;
-        }
-
-        // Convert wildcard pattern to regex
-        std::string regexPattern = pattern;
-        std::replace(regexPattern.begin(), regexPattern.end(), '*', '.');
-        regexPattern = std::regex_replace(regexPattern, std::regex("\\."), ".*");
-
-        try
-        {
-            std::regex regex(regexPattern);
-            return std::regex_match(str, regex);
-        }
-        catch (const std::regex_error&)
-        {
-            // Fallback to simple contains check
-            return str.find(pattern.substr(0, pattern.find('*'))) != std::string::npos;
-        }
-    }
-
     std::string AtlasManager::FindAtlasForSprite(const ResourceLocation& location) const
     {
         for (const auto& atlasPair : m_atlases)
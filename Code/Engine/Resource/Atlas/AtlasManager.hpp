@@ -49,7 +49,7 @@ namespace enigma::resource
 
         // Cross-namespace texture collection
         std::vector<std::shared_ptr<ImageResource>> CollectTexturesForAtlas(const AtlasConfig& config);
-        std::vector<ResourceLocation>               FindTexturesByPattern(const std::string& pattern, const std::vector<std::string>& namespaces = {});
+        std::vector<ResourceLocation>               FindTexturesByPattern(const std::string& pattern, const std::vector<std::string>& namespaces = {}); // ResourceGlob over the path
 
         // Namespace discovery
         std::vector<std::string> DiscoverAvailableNamespaces() const;
@@ -74,8 +74,6 @@ namespace enigma::resource
         bool CollectTexturesFromSingle(const AtlasSourceEntry& source, std::vector<std::shared_ptr<ImageResource>>& outImages);
         bool CollectTexturesFromFilter(const AtlasSourceEntry& source, std::vector<std::shared_ptr<ImageResource>>& outImages);
 
-        bool             MatchesNamespaceFilter(const ResourceLocation& location, const std::vector<std::string>& namespaces) const;
-        bool             MatchesPattern(const std::string& str, const std::string& pattern) const;
         ResourceLocation ExtractResourceLocationFromPath(const std::string& fullPath, const std::string& baseDirectory) const;
 
         // Atlas lookup helpers
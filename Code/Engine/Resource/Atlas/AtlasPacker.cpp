@@ -0,0 +1,136 @@
+#include "AtlasPacker.hpp"
+#include <algorithm>
+#include <climits>
+
+namespace enigma::resource
+{
+    AtlasPacker::AtlasPacker(IntVec2 binSize)
+    {
+        Reset(binSize);
+    }
+
+    void AtlasPacker::Reset(IntVec2 binSize)
+    {
+        m_binSize  = binSize;
+        m_usedArea = 0;
+        m_freeRects.clear();
+        if (binSize.x > 0 && binSize.y > 0)
+        {
+            m_freeRects.push_back({0, 0, binSize.x, binSize.y});
+        }
+    }
+
+    bool AtlasPacker::Insert(IntVec2 cellSize, IntVec2& outPosition)
+    {
+        if (cellSize.x <= 0 || cellSize.y <= 0)
+        {
+            return false;
+        }
+
+        // Best short side fit, ties broken by the long side, then by the top-most position
+        const Rect* best          = nullptr;
+        int         bestShortSide = INT_MAX;
+        int         bestLongSide  = INT_MAX;
+        for (const Rect& free : m_freeRects)
+        {
+            if (free.width < cellSize.x || free.height < cellSize.y)
+            {
+                continue;
+            }
+
+            const int leftoverX = free.width - cellSize.x;
+            const int leftoverY = free.height - cellSize.y;
+            const int shortSide = (std::min)(leftoverX, leftoverY);
+            const int longSide  = (std::max)(leftoverX, leftoverY);
+            if (shortSide < bestShortSide || (shortSide == bestShortSide && longSide < bestLongSide) ||
+                (shortSide == bestShortSide && longSide == bestLongSide && best && (free.y < best->y || (free.y == best->y && free.x < best->x))))
+            {
+                best          = &free;
+                bestShortSide = shortSide;
+                bestLongSide  = longSide;
+            }
+        }
+
+        if (best == nullptr)
+        {
+            return false;
+        }
+
+        const Rect used{best->x, best->y, cellSize.x, cellSize.y};
+        SplitFreeRects(used);
+        PruneFreeRects();
+
+        m_usedArea += static_cast<int64_t>(cellSize.x) * cellSize.y;
+        outPosition = IntVec2(used.x, used.y);
+        return true;
+    }
+
+    float AtlasPacker::GetOccupancy() const
+    {
+        const int64_t binArea = static_cast<int64_t>(m_binSize.x) * m_binSize.y;
+        return binArea > 0 ? static_cast<float>(static_cast<double>(m_usedArea) / static_cast<double>(binArea)) : 0.0f;
+    }
+
+    void AtlasPacker::SplitFreeRects(const Rect& used)
+    {
+        m_splitScratch.clear();
+        for (const Rect& free : m_freeRects)
+        {
+            const bool overlaps = used.x < free.x + free.width && used.x + used.width > free.x &&
+                used.y < free.y + free.height && used.y + used.height > free.y;
+            if (!overlaps)
+            {
+                m_splitScratch.push_back(free);
+                continue;
+            }
+
+            // Up to four maximal leftovers: the parts of the free rectangle beside each edge of the cell
+            if (used.x > free.x)
+            {
+                m_splitScratch.push_back({free.x, free.y, used.x - free.x, free.height});
+            }
+            if (used.x + used.width < free.x + free.width)
+            {
+                m_splitScratch.push_back({used.x + used.width, free.y, free.x + free.width - (used.x + used.width), free.height});
+            }
+            if (used.y > free.y)
+            {
+                m_splitScratch.push_back({free.x, free.y, free.width, used.y - free.y});
+            }
+            if (used.y + used.height < free.y + free.height)
+            {
+                m_splitScratch.push_back({free.x, used.y + used.height, free.width, free.y + free.height - (used.y + used.height)});
+            }
+        }
+        m_freeRects.swap(m_splitScratch);
+    }
+
+    void AtlasPacker::PruneFreeRects()
+    {
+        for (size_t i = 0; i < m_freeRects.size(); ++i)
+        {
+            for (size_t j = i + 1; j < m_freeRects.size();)
+            {
+                if (Contains(m_freeRects[j], m_freeRects[i]))
+                {
+                    m_freeRects.erase(m_freeRects.begin() + static_cast<std::ptrdiff_t>(i));
+                    --i;
+                    break;
+                }
+                if (Contains(m_freeRects[i], m_freeRects[j]))
+                {
+                    m_freeRects.erase(m_freeRects.begin() + static_cast<std::ptrdiff_t>(j));
+                    continue;
+                }
+                ++j;
+            }
+        }
+    }
+
+    bool AtlasPacker::Contains(const Rect& outer, const Rect& inner)
+    {
+        return inner.x >= outer.x && inner.y >= outer.y &&
+            inner.x + inner.width <= outer.x + outer.width &&
+            inner.y + inner.height <= outer.y + outer.height;
+    }
+}
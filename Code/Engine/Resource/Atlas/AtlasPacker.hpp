@@ -0,0 +1,54 @@
+#pragma once
+#include "../../Math/IntVec2.hpp"
+#include <cstdint>
+#include <vector>
+
+namespace enigma::resource
+{
+    /**
+     * @class AtlasPacker
+     * @brief MaxRects bin packer (best short side fit) for atlas sprite cells
+     *
+     * Keeps the list of maximal free rectangles of the bin. Each Insert() picks
+     * the free rectangle that leaves the smallest leftover on its shorter side,
+     * places the cell in its top-left corner, then splits every free rectangle
+     * the cell overlaps and drops rectangles contained in another one.
+     *
+     * Cells are never rotated: atlas UVs carry no rotation flag, so callers that
+     * need padding pass the sprite size plus padding on both sides.
+     */
+    class AtlasPacker
+    {
+    public:
+        AtlasPacker() = default;
+        explicit AtlasPacker(IntVec2 binSize);
+
+        void Reset(IntVec2 binSize);
+
+        /// Place a width x height cell; false when no free rectangle can hold it
+        bool Insert(IntVec2 cellSize, IntVec2& outPosition);
+
+        IntVec2 GetBinSize() const { return m_binSize; }
+        int64_t GetUsedArea() const { return m_usedArea; }
+        float   GetOccupancy() const; // Used area / bin area, 0-1
+
+    private:
+        struct Rect
+        {
+            int x      = 0;
+            int y      = 0;
+            int width  = 0;
+            int height = 0;
+        };
+
+        void SplitFreeRects(const Rect& used);
+        void PruneFreeRects();
+
+        static bool Contains(const Rect& outer, const Rect& inner);
+
+        IntVec2           m_binSize  = IntVec2::ZERO;
+        int64_t           m_usedArea = 0;
+        std::vector<Rect> m_freeRects;
+        std::vector<Rect> m_splitScratch; // Reused by SplitFreeRects
+    };
+}
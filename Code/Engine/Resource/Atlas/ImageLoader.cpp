@@ -2,6 +2,7 @@
 #include "../../Core/ErrorWarningAssert.hpp"
 #include "../../Core/StringUtils.hpp"
 #include "../ResourceMetadata.hpp"
+#include <cstring>
 
 // Include stb_image for loading from memory
 #define STB_IMAGE_IMPLEMENTATION_INCLUDED  // Prevent double definition since Image.cpp already includes it
@@ -85,7 +86,8 @@ namespace enigma::resource
             return nullptr;
         }
 
-        // Use stb_image to load from memory
+        // Use stb_image to load from memory; called from resource worker threads during preload,
+        // so the flip flag is only ever set to the value every other caller uses
         int width, height, channels;
         stbi_set_flip_vertically_on_load(1); // Match existing Image class behavior
 
@@ -95,7 +97,7 @@ namespace enigma::resource
             &width,
             &height,
             &channels,
-            0 // Desired channels (0 = original)
+            4 // Expand to RGBA so texels can be copied in one block
         );
 
         if (!pixels)
@@ -107,24 +109,10 @@ namespace enigma::resource
 
         try
         {
-            // Create Image object with loaded dimensions
+            // Create Image object with loaded dimensions; stb already expanded grey/RGB to RGBA
+            static_assert(sizeof(Rgba8) == 4, "Rgba8 must match stb's 4-channel layout");
             auto image = std::make_unique<Image>(IntVec2(width, height), Rgba8::WHITE);
-
-            // Copy pixel data into Image format
-            for (int y = 0; y < height; ++y)
-            {
-                for (int x = 0; x < width; ++x)
-                {
-                    int pixelIndex = (y * width + x) * channels;
-
-                    unsigned char r = pixels[pixelIndex + 0];
-                    unsigned char g = channels > 1 ? pixels[pixelIndex + 1] : r;
-                    unsigned char b = channels > 2 ? pixels[pixelIndex + 2] : r;
-                    unsigned char a = channels > 3 ? pixels[pixelIndex + 3] : 255;
-
-                    image->SetTexelColor(IntVec2(x, y), Rgba8(r, g, b, a));
-                }
-            }
+            std::memcpy(image->GetRawData(), pixels, static_cast<size_t>(width) * static_cast<size_t>(height) * 4);
 
             // Clean up stb_image memory
             stbi_image_free(pixels);
@@ -24,6 +24,7 @@ namespace enigma::resource
         std::set<std::string> GetSupportedExtensions() const override;
         std::string           GetLoaderName() const override;
         int                   GetPriority() const override;
+        bool                  IsThreadSafe() const override { return true; } // Decodes into a fresh Image, no shared state
 
         // Additional validation
         bool CanLoad(const ResourceMetadata& metadata) const override;
@@ -1,13 +1,20 @@
 #include "TextureAtlas.hpp"
 #include "AtlasBorderHelper.hpp"
+#include "AtlasPacker.hpp"
 #include "../../Core/EngineCommon.hpp"
 #include "../../Core/ErrorWarningAssert.hpp"
 #include "../../Core/StringUtils.hpp"
 #include "../../Core/FileSystemHelper.hpp"
 #include "../../Core/Logger/LoggerAPI.hpp"
+#include "../../Core/MappedFile.hpp"
+#include "../../Core/Buffer/ByteBuffer.hpp"
+#include "../../Core/Buffer/ByteBufferView.hpp"
 #include <algorithm>
+#include <chrono>
 #include <cmath>
+#include <cstring>
 #include <filesystem>
+#include <fstream>
 
 // Prevent Windows min/max macro conflicts
 #ifdef min
@@ -28,6 +35,38 @@
 
 namespace enigma::resource
 {
+    namespace
+    {
+        constexpr uint32_t BAKED_ATLAS_MAGIC   = 0x424C5441; // "ATLB"
+        constexpr uint32_t BAKED_ATLAS_VERSION = 1;
+
+        // Bumped whenever packing or copying changes what a given input set produces
+        constexpr uint64_t ATLAS_LAYOUT_VERSION = 1;
+
+        void HashBytes(uint64_t& hash, const void* data, size_t size)
+        {
+            // FNV-1a 64
+            const uint8_t* bytes = static_cast<const uint8_t*>(data);
+            for (size_t i = 0; i < size; ++i)
+            {
+                hash ^= bytes[i];
+                hash *= 0x100000001B3ull;
+            }
+        }
+
+        template <typename T>
+        void HashValue(uint64_t& hash, const T& value)
+        {
+            HashBytes(hash, &value, sizeof(T));
+        }
+
+        void HashString(uint64_t& hash, const std::string& text)
+        {
+            HashValue(hash, text.size());
+            HashBytes(hash, text.data(), text.size());
+        }
+    }
+
     TextureAtlas::TextureAtlas(const AtlasConfig& config)
         : m_config(config)
           , m_metadata(ResourceLocation("engine", "atlas/" + config.name), std::filesystem::path("atlas/" + config.name))
@@ -35,7 +74,6 @@ namespace enigma::resource
           , m_atlasImage(nullptr)
           , m_atlasDimensions(IntVec2::ZERO)
           , m_isBuilt(false)
-          , m_gridResolution(config.requiredResolution + 2 * config.padding)
           , m_atlasTexture(nullptr)
     {
         m_metadata.type = ResourceType::TEXTURE;
@@ -96,6 +134,8 @@ namespace enigma::resource
             return false;
         }
 
+        const auto buildStart = std::chrono::steady_clock::now();
+
         // Validate all input images
         if (!ValidateImages(images))
         {
@@ -111,15 +151,12 @@ namespace enigma::resource
         // Calculate UV coordinates for all sprites
         CalculateAllUVCoordinates();
 
-        // Update statistics
+        // Update statistics (packing efficiency was measured by PackSprites)
         m_stats.totalSprites   = static_cast<int>(m_sprites.size());
         m_stats.atlasWidth     = m_atlasDimensions.x;
         m_stats.atlasHeight    = m_atlasDimensions.y;
         m_stats.atlasSizeBytes = m_atlasDimensions.x * m_atlasDimensions.y * 4; // RGBA
-
-        // Calculate packing efficiency
-        int usedPixels = m_stats.totalSprites * m_config.requiredResolution * m_config.requiredResolution;
-        m_stats.CalculatePackingEfficiency(usedPixels);
+        m_stats.buildMs        = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - buildStart).count();
 
         m_isBuilt = true;
         return true;
@@ -130,7 +167,6 @@ namespace enigma::resource
         m_atlasImage.reset();
         m_sprites.clear();
         m_spriteLocationMap.clear();
-        m_packingGrid.clear();
         m_atlasDimensions = IntVec2::ZERO;
         m_stats.Reset();
         m_isBuilt      = false;
@@ -259,6 +295,188 @@ namespace enigma::resource
         return result != 0;
     }
 
+    uint64_t TextureAtlas::ComputeBakeKey(const AtlasConfig& config, const std::vector<std::shared_ptr<ImageResource>>& images)
+    {
+        uint64_t hash = 0xCBF29CE484222325ull;
+        HashValue(hash, ATLAS_LAYOUT_VERSION);
+
+        // Every setting that changes the packed pixels or the sprite table
+        HashValue(hash, config.requiredResolution);
+        HashValue(hash, config.autoScale);
+        HashValue(hash, config.rejectMismatched);
+        HashValue(hash, config.maxAtlasSize.x);
+        HashValue(hash, config.maxAtlasSize.y);
+        HashValue(hash, config.padding);
+        HashValue(hash, config.borderMode);
+
+        // Input file set in collection order; content edits show up as size/mtime changes
+        HashValue(hash, images.size());
+        for (const auto& imageRes : images)
+        {
+            if (!imageRes)
+                continue;
+
+            const ResourceMetadata& metadata = imageRes->GetMetadata();
+            HashString(hash, metadata.location.ToString());
+            HashString(hash, metadata.filePath.generic_string());
+            HashValue(hash, static_cast<uint64_t>(metadata.fileSize));
+            HashValue(hash, static_cast<int64_t>(metadata.lastModified.time_since_epoch().count()));
+        }
+        return hash;
+    }
+
+    bool TextureAtlas::SaveBaked(const std::filesystem::path& filepath, uint64_t bakeKey) const
+    {
+        if (!IsLoaded())
+        {
+            return false;
+        }
+
+        using namespace enigma::core;
+
+        ByteBuffer header;
+        header.WriteUnsignedInt(BAKED_ATLAS_MAGIC);
+        header.WriteUnsignedInt(BAKED_ATLAS_VERSION);
+        header.WriteUnsignedLong(bakeKey);
+        header.WriteVarUnsignedInt(static_cast<uint32_t>(m_atlasDimensions.x));
+        header.WriteVarUnsignedInt(static_cast<uint32_t>(m_atlasDimensions.y));
+        header.WriteVarUnsignedInt(static_cast<uint32_t>(m_stats.rejectedSprites));
+        header.WriteVarUnsignedInt(static_cast<uint32_t>(m_stats.scaledSprites));
+        header.WriteVarUnsignedInt(static_cast<uint32_t>(m_stats.droppedSprites));
+        header.WriteFloat(m_stats.packingEfficiency);
+
+        header.WriteVarUnsignedInt(static_cast<uint32_t>(m_sprites.size()));
+        for (const AtlasSprite& sprite : m_sprites)
+        {
+            header.WriteString(sprite.location.GetNamespace());
+            header.WriteString(sprite.location.GetPath());
+            header.WriteVarUnsignedInt(static_cast<uint32_t>(sprite.atlasPosition.x));
+            header.WriteVarUnsignedInt(static_cast<uint32_t>(sprite.atlasPosition.y));
+            header.WriteVarUnsignedInt(static_cast<uint32_t>(sprite.size.x));
+            header.WriteVarUnsignedInt(static_cast<uint32_t>(sprite.size.y));
+            header.WriteVarInt(sprite.originalResolution);
+        }
+
+        // Write a sibling temp file and rename it over the old one so a crash never leaves half an atlas
+        std::error_code ec;
+        if (filepath.has_parent_path())
+        {
+            std::filesystem::create_directories(filepath.parent_path(), ec);
+        }
+
+        std::filesystem::path tempFile = filepath;
+        tempFile += ".tmp";
+        {
+            std::ofstream out(tempFile, std::ios::binary | std::ios::trunc);
+            if (!out)
+            {
+                return false;
+            }
+
+            // Pixels go straight from the atlas image; only the small header is staged in a buffer
+            ByteBuffer trailer;
+            trailer.WriteUnsignedInt(BAKED_ATLAS_MAGIC);
+
+            out.write(reinterpret_cast<const char*>(header.Data()), static_cast<std::streamsize>(header.WrittenBytes()));
+            out.write(static_cast<const char*>(m_atlasImage->GetRawData()), static_cast<std::streamsize>(GetRawDataSize()));
+            out.write(reinterpret_cast<const char*>(trailer.Data()), static_cast<std::streamsize>(trailer.WrittenBytes()));
+            if (!out)
+            {
+                return false;
+            }
+        }
+
+        std::filesystem::rename(tempFile, filepath, ec);
+        if (ec)
+        {
+            std::filesystem::remove(tempFile, ec);
+            return false;
+        }
+        return true;
+    }
+
+    bool TextureAtlas::LoadBaked(const std::filesystem::path& filepath, uint64_t bakeKey)
+    {
+        using namespace enigma::core;
+
+        ClearAtlas();
+        const auto loadStart = std::chrono::steady_clock::now();
+
+        MappedFile file;
+        if (!file.Open(filepath))
+        {
+            return false;
+        }
+
+        try
+        {
+            ByteBufferView reader(file.GetData(), file.GetSize());
+            if (reader.ReadUnsignedInt() != BAKED_ATLAS_MAGIC || reader.ReadUnsignedInt() != BAKED_ATLAS_VERSION ||
+                reader.ReadUnsignedLong() != bakeKey)
+            {
+                return false;
+            }
+
+            IntVec2 dimensions;
+            dimensions.x = static_cast<int>(reader.ReadVarUnsignedInt());
+            dimensions.y = static_cast<int>(reader.ReadVarUnsignedInt());
+            if (dimensions.x <= 0 || dimensions.y <= 0 || dimensions.x > m_config.maxAtlasSize.x || dimensions.y > m_config.maxAtlasSize.y)
+            {
+                return false;
+            }
+
+            m_stats.rejectedSprites   = static_cast<int>(reader.ReadVarUnsignedInt());
+            m_stats.scaledSprites     = static_cast<int>(reader.ReadVarUnsignedInt());
+            m_stats.droppedSprites    = static_cast<int>(reader.ReadVarUnsignedInt());
+            m_stats.packingEfficiency = reader.ReadFloat();
+
+            const uint32_t spriteCount = reader.ReadVarUnsignedInt();
+            m_sprites.reserve(spriteCount);
+            for (uint32_t i = 0; i < spriteCount; ++i)
+            {
+                std::string namespaceName = reader.ReadString();
+                std::string path          = reader.ReadString();
+                IntVec2     position;
+                position.x = static_cast<int>(reader.ReadVarUnsignedInt());
+                position.y = static_cast<int>(reader.ReadVarUnsignedInt());
+                IntVec2 size;
+                size.x = static_cast<int>(reader.ReadVarUnsignedInt());
+                size.y = static_cast<int>(reader.ReadVarUnsignedInt());
+                const int resolution = reader.ReadVarInt();
+
+                m_sprites.emplace_back(ResourceLocation(namespaceName, path), position, size, resolution);
+                m_spriteLocationMap[m_sprites.back().location] = m_sprites.size() - 1;
+            }
+
+            m_atlasDimensions = dimensions;
+            m_atlasImage      = std::make_unique<Image>(m_atlasDimensions, Rgba8(0, 0, 0, 0));
+            reader.ReadRawBytesInto(m_atlasImage->GetRawData(), static_cast<size_t>(dimensions.x) * dimensions.y * sizeof(Rgba8));
+
+            if (reader.ReadUnsignedInt() != BAKED_ATLAS_MAGIC)
+            {
+                ClearAtlas();
+                return false;
+            }
+        }
+        catch (const std::exception&)
+        {
+            ClearAtlas(); // Truncated or corrupt: the caller packs from the images instead
+            return false;
+        }
+
+        CalculateAllUVCoordinates();
+
+        m_stats.totalSprites    = static_cast<int>(m_sprites.size());
+        m_stats.atlasWidth      = m_atlasDimensions.x;
+        m_stats.atlasHeight     = m_atlasDimensions.y;
+        m_stats.atlasSizeBytes  = m_atlasDimensions.x * m_atlasDimensions.y * 4; // RGBA
+        m_stats.loadedFromBaked = true;
+        m_stats.buildMs         = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - loadStart).count();
+
+        m_isBuilt = true;
+        return true;
+    }
+
     void TextureAtlas::PrintAtlasInfo() const
     {
         printf("\n=== Atlas Info: %s ===\n", m_config.name.c_str());
@@ -317,94 +535,149 @@ namespace enigma::resource
 
     bool TextureAtlas::PackSprites(const std::vector<std::shared_ptr<ImageResource>>& images)
     {
-        // Count valid sprites
-        int validSprites = 0;
+        // Resolve every accepted image to its content size and padded cell
+        std::vector<PendingSprite> pending;
+        pending.reserve(images.size());
+        int64_t totalCellArea = 0;
+        IntVec2 largestCell   = IntVec2::ZERO;
         for (const auto& imageRes : images)
         {
             if (!imageRes || !imageRes->IsLoaded() || !imageRes->IsValidForAtlas())
                 continue;
 
+            PendingSprite sprite;
+            sprite.image   = imageRes.get();
             int resolution = imageRes->GetResolution();
-            if (resolution != m_config.requiredResolution)
+            if (resolution == m_config.requiredResolution)
             {
-                if (m_config.rejectMismatched)
-                    continue;
+                sprite.size = IntVec2(resolution, resolution);
             }
-            validSprites++;
+            else if (m_config.rejectMismatched)
+            {
+                continue;
+            }
+            else if (m_config.autoScale)
+            {
+                sprite.size  = IntVec2(m_config.requiredResolution, m_config.requiredResolution);
+                sprite.scale = true;
+            }
+            else
+            {
+                sprite.size = imageRes->GetDimensions(); // Kept at native size, MaxRects packs mixed sizes
+            }
+
+            sprite.cellSize = sprite.size + IntVec2(2 * m_config.padding, 2 * m_config.padding);
+            totalCellArea += static_cast<int64_t>(sprite.cellSize.x) * sprite.cellSize.y;
+            largestCell.x = std::max(largestCell.x, sprite.cellSize.x);
+            largestCell.y = std::max(largestCell.y, sprite.cellSize.y);
+            pending.push_back(sprite);
         }
 
-        if (validSprites == 0)
+        if (pending.empty())
         {
             return false;
         }
 
-        // Calculate optimal atlas size
-        m_atlasDimensions = FindBestAtlasSize(validSprites, m_config.requiredResolution);
-
-        // Create atlas image
-        m_atlasImage = std::make_unique<Image>(m_atlasDimensions, Rgba8(0, 0, 0, 0)); // Transparent background
-
-        // Initialize packing grid (cell size includes padding)
-        InitializePackingGrid(m_atlasDimensions, m_gridResolution);
-
-        // Pack each sprite
-        for (const auto& imageRes : images)
+        // Smallest power-of-two atlas that holds every cell, growing the shorter side first
+        std::vector<IntVec2> cellPositions;
+        m_atlasDimensions = FindBestAtlasSize(totalCellArea, largestCell);
+        while (PackCells(m_atlasDimensions, pending, cellPositions) < pending.size())
         {
-            if (!imageRes || !imageRes->IsLoaded() || !imageRes->IsValidForAtlas())
-                continue;
-
-            int resolution = imageRes->GetResolution();
-            if (resolution != m_config.requiredResolution)
+            const bool canGrowX = m_atlasDimensions.x < m_config.maxAtlasSize.x;
+            const bool canGrowY = m_atlasDimensions.y < m_config.maxAtlasSize.y;
+            if (!canGrowX && !canGrowY)
             {
-                if (m_config.rejectMismatched)
-                    continue;
+                break; // Keep what fits; the rest is dropped below
             }
+            if (canGrowX && (m_atlasDimensions.x <= m_atlasDimensions.y || !canGrowY))
+                m_atlasDimensions.x = std::min(m_atlasDimensions.x * 2, m_config.maxAtlasSize.x);
+            else
+                m_atlasDimensions.y = std::min(m_atlasDimensions.y * 2, m_config.maxAtlasSize.y);
+        }
 
-            // Find position for this sprite (cell size includes padding)
-            IntVec2 cellSize(m_gridResolution, m_gridResolution);
-            IntVec2 cellPosition;
+        // Create atlas image
+        m_atlasImage = std::make_unique<Image>(m_atlasDimensions, Rgba8(0, 0, 0, 0)); // Transparent background
 
-            if (!TryPackSprite(cellSize, cellPosition))
+        int64_t usedPixels = 0;
+        for (size_t i = 0; i < pending.size(); ++i)
+        {
+            const PendingSprite& pendingSprite = pending[i];
+            if (cellPositions[i].x < 0)
             {
                 // Atlas is full, could implement multiple atlas support here
-                break;
+                m_stats.droppedSprites++;
+                continue;
             }
 
             // Sprite content is offset by padding within the cell
-            IntVec2 spritePosition = cellPosition + IntVec2(m_config.padding, m_config.padding);
-            IntVec2 spriteSize(m_config.requiredResolution, m_config.requiredResolution);
+            IntVec2 spritePosition = cellPositions[i] + IntVec2(m_config.padding, m_config.padding);
+            const ImageResource& imageRes = *pendingSprite.image;
 
             // Create atlas sprite entry (position = content area, not cell)
-            AtlasSprite sprite(imageRes->GetResourceLocation(), spritePosition, spriteSize, resolution);
+            AtlasSprite sprite(imageRes.GetResourceLocation(), spritePosition, pendingSprite.size, imageRes.GetResolution());
             m_sprites.push_back(sprite);
-            m_spriteLocationMap[imageRes->GetResourceLocation()] = m_sprites.size() - 1;
+            m_spriteLocationMap[imageRes.GetResourceLocation()] = m_sprites.size() - 1;
+            usedPixels += static_cast<int64_t>(pendingSprite.size.x) * pendingSprite.size.y;
 
             // Copy image data to atlas
-            if (resolution == m_config.requiredResolution)
+            if (pendingSprite.scale)
             {
-                // Direct copy
-                CopyImageToAtlas(imageRes->GetImage(), spritePosition);
+                // Scale and copy
+                Image scaledImage(pendingSprite.size, Rgba8::WHITE);
+                ScaleImageIfNeeded(imageRes.GetImage(), scaledImage, m_config.requiredResolution);
+                CopyImageToAtlas(scaledImage, spritePosition, pendingSprite.size);
             }
-            else if (m_config.autoScale)
+            else
             {
-                // Scale and copy
-                Image scaledImage(spriteSize, Rgba8::WHITE);
-                ScaleImageIfNeeded(imageRes->GetImage(), scaledImage, m_config.requiredResolution);
-                CopyImageToAtlas(scaledImage, spritePosition);
+                // Direct copy
+                CopyImageToAtlas(imageRes.GetImage(), spritePosition, pendingSprite.size);
             }
 
             // Extrude edge pixels into padding area for mipmap bleeding prevention
             if (m_config.padding > 0)
             {
                 AtlasBorderHelper::ExtrudeBorders(
-                    *m_atlasImage, spritePosition, spriteSize,
+                    *m_atlasImage, spritePosition, pendingSprite.size,
                     m_config.padding, m_config.borderMode);
             }
         }
 
+        m_stats.atlasWidth  = m_atlasDimensions.x;
+        m_stats.atlasHeight = m_atlasDimensions.y;
+        m_stats.CalculatePackingEfficiency(usedPixels);
+
         return !m_sprites.empty();
     }
 
+    size_t TextureAtlas::PackCells(IntVec2 atlasDimensions, const std::vector<PendingSprite>& sprites, std::vector<IntVec2>& outCellPositions) const
+    {
+        // Tallest cells first (then widest) keeps MaxRects free lists short; ties keep input order
+        std::vector<size_t> order(sprites.size());
+        for (size_t i = 0; i < order.size(); ++i)
+        {
+            order[i] = i;
+        }
+        std::stable_sort(order.begin(), order.end(), [&sprites](size_t a, size_t b)
+        {
+            const IntVec2& cellA = sprites[a].cellSize;
+            const IntVec2& cellB = sprites[b].cellSize;
+            return cellA.y != cellB.y ? cellA.y > cellB.y : cellA.x > cellB.x;
+        });
+
+        outCellPositions.assign(sprites.size(), IntVec2(-1, -1));
+
+        AtlasPacker packer(atlasDimensions);
+        size_t      placed = 0;
+        for (size_t index : order)
+        {
+            if (packer.Insert(sprites[index].cellSize, outCellPositions[index]))
+            {
+                placed++;
+            }
+        }
+        return placed;
+    }
+
     void TextureAtlas::ScaleImageIfNeeded(const Image& source, Image& destination, int targetResolution) const
     {
         IntVec2 sourceSize = source.GetDimensions();
@@ -429,25 +702,24 @@ namespace enigma::resource
         }
     }
 
-    void TextureAtlas::CopyImageToAtlas(const Image& source, const IntVec2& position)
+    void TextureAtlas::CopyImageToAtlas(const Image& source, const IntVec2& position, const IntVec2& size)
     {
+        // Row copies; the source is clipped to the sprite size (e.g. the first rows of an animation strip)
         IntVec2 sourceSize = source.GetDimensions();
-
-        for (int y = 0; y < sourceSize.y; ++y)
+        int     copyWidth  = std::min(std::min(sourceSize.x, size.x), m_atlasDimensions.x - position.x);
+        int     copyHeight = std::min(std::min(sourceSize.y, size.y), m_atlasDimensions.y - position.y);
+        if (copyWidth <= 0 || copyHeight <= 0 || position.x < 0 || position.y < 0)
         {
-            for (int x = 0; x < sourceSize.x; ++x)
-            {
-                IntVec2 sourcePos(x, y);
-                IntVec2 atlasPos = position + sourcePos;
+            return;
+        }
 
-                // Bounds check
-                if (atlasPos.x >= 0 && atlasPos.x < m_atlasDimensions.x &&
-                    atlasPos.y >= 0 && atlasPos.y < m_atlasDimensions.y)
-                {
-                    Rgba8 color = source.GetTexelColor(sourcePos);
-                    m_atlasImage->SetTexelColor(atlasPos, color);
-                }
-            }
+        const Rgba8* sourceTexels = static_cast<const Rgba8*>(source.GetRawData());
+        Rgba8*       atlasTexels  = static_cast<Rgba8*>(m_atlasImage->GetRawData());
+        for (int y = 0; y < copyHeight; ++y)
+        {
+            std::memcpy(atlasTexels + static_cast<size_t>(position.y + y) * m_atlasDimensions.x + position.x,
+                        sourceTexels + static_cast<size_t>(y) * sourceSize.x,
+                        static_cast<size_t>(copyWidth) * sizeof(Rgba8));
         }
     }
 
@@ -459,12 +731,11 @@ namespace enigma::resource
         }
     }
 
-    IntVec2 TextureAtlas::FindBestAtlasSize(int totalSprites, int spriteResolution) const
+    IntVec2 TextureAtlas::FindBestAtlasSize(int64_t totalCellArea, IntVec2 largestCell) const
     {
-        // Calculate minimum area needed (account for padding around each sprite)
-        int effectiveCellSize = spriteResolution + 2 * m_config.padding;
-        int totalArea = totalSprites * effectiveCellSize * effectiveCellSize;
-        int minSize   = static_cast<int>(std::ceil(std::sqrt(static_cast<float>(totalArea))));
+        // Lower bound only: PackSprites() grows the result until every cell fits
+        int minSize = static_cast<int>(std::ceil(std::sqrt(static_cast<double>(totalCellArea))));
+        minSize     = std::max(minSize, std::max(largestCell.x, largestCell.y));
 
         // Round up to next power of 2 for GPU efficiency
         int size = 1;
@@ -473,65 +744,16 @@ namespace enigma::resource
             size *= 2;
         }
 
-        // Ensure we don't exceed maximum atlas size
-        size = std::min(size, m_config.maxAtlasSize.x);
-        size = std::min(size, m_config.maxAtlasSize.y);
-
-        return IntVec2(size, size);
-    }
-
-    bool TextureAtlas::TryPackSprite(IntVec2 spriteSize, IntVec2& outPosition)
-    {
-        int gridCols = m_atlasDimensions.x / m_gridResolution;
-        int gridRows = m_atlasDimensions.y / m_gridResolution;
-
-        // Simple linear search for free space (can be optimized with better algorithms)
-        for (int row = 0; row <= gridRows - (spriteSize.y / m_gridResolution); ++row)
+        // A 2:1 atlas is enough when half the square still covers the area
+        IntVec2 dimensions(size, size);
+        if (size > 1 && static_cast<int64_t>(size) * (size / 2) >= totalCellArea && size / 2 >= largestCell.y)
         {
-            for (int col = 0; col <= gridCols - (spriteSize.x / m_gridResolution); ++col)
-            {
-                // Check if this position is free
-                bool canPlace   = true;
-                int  spriteCols = spriteSize.x / m_gridResolution;
-                int  spriteRows = spriteSize.y / m_gridResolution;
-
-                for (int sr = 0; sr < spriteRows && canPlace; ++sr)
-                {
-                    for (int sc = 0; sc < spriteCols && canPlace; ++sc)
-                    {
-                        if (m_packingGrid[row + sr][col + sc])
-                        {
-                            canPlace = false;
-                        }
-                    }
-                }
-
-                if (canPlace)
-                {
-                    // Mark this area as occupied
-                    for (int sr = 0; sr < spriteRows; ++sr)
-                    {
-                        for (int sc = 0; sc < spriteCols; ++sc)
-                        {
-                            m_packingGrid[row + sr][col + sc] = true;
-                        }
-                    }
-
-                    outPosition = IntVec2(col * m_gridResolution, row * m_gridResolution);
-                    return true;
-                }
-            }
+            dimensions.y = size / 2;
         }
 
-        return false; // No space found
-    }
-
-    void TextureAtlas::InitializePackingGrid(IntVec2 atlasDimensions, int spriteSize)
-    {
-        int gridCols = atlasDimensions.x / spriteSize;
-        int gridRows = atlasDimensions.y / spriteSize;
-
-        m_packingGrid.clear();
-        m_packingGrid.resize(gridRows, std::vector<bool>(gridCols, false));
+        // Ensure we don't exceed maximum atlas size
+        dimensions.x = std::min(dimensions.x, m_config.maxAtlasSize.x);
+        dimensions.y = std::min(dimensions.y, m_config.maxAtlasSize.y);
+        return dimensions;
     }
 }
@@ -5,6 +5,8 @@
 #include "ImageResource.hpp"
 #include "../../Core/Image.hpp"
 #include "../../Renderer/Texture.hpp"
+#include <cstdint>
+#include <filesystem>
 #include <memory>
 #include <unordered_map>
 #include <vector>
@@ -15,6 +17,10 @@ namespace enigma::resource
      * TextureAtlas - Single atlas management class
      * Handles atlas building from ImageResource collection, sprite positioning/UV calculation,
      * and PNG export functionality. Integrates with existing Texture class for rendering.
+     *
+     * Sprites are packed with AtlasPacker (MaxRects, no rotation) into the smallest
+     * power-of-two atlas that holds them. A built atlas can be saved as a baked file
+     * (pixels + sprite table) and loaded back while ComputeBakeKey() still matches.
      */
     class TextureAtlas : public IResource
     {
@@ -52,6 +58,11 @@ namespace enigma::resource
         // PNG export functionality
         bool ExportToPNG(const std::string& filepath) const;
 
+        // Baked atlas cache; LoadBaked() fails on a missing, stale or corrupt file
+        bool            SaveBaked(const std::filesystem::path& filepath, uint64_t bakeKey) const;
+        bool            LoadBaked(const std::filesystem::path& filepath, uint64_t bakeKey);
+        static uint64_t ComputeBakeKey(const AtlasConfig& config, const std::vector<std::shared_ptr<ImageResource>>& images);
+
         // Debug methods
         void        PrintAtlasInfo() const;
         std::string GetDebugString() const;
@@ -61,28 +72,23 @@ namespace enigma::resource
         void             Unload();
 
     private:
+        // Sprite waiting to be packed: content size plus the padded cell the packer places
+        struct PendingSprite
+        {
+            const ImageResource* image = nullptr;
+            IntVec2              size;
+            IntVec2              cellSize;
+            bool                 scale = false; // Nearest-neighbour scale to requiredResolution
+        };
+
         // Atlas building helpers
         bool    ValidateImages(const std::vector<std::shared_ptr<ImageResource>>& images);
         bool    PackSprites(const std::vector<std::shared_ptr<ImageResource>>& images);
         void    ScaleImageIfNeeded(const Image& source, Image& destination, int targetResolution) const;
-        void    CopyImageToAtlas(const Image& source, const IntVec2& position);
+        void    CopyImageToAtlas(const Image& source, const IntVec2& position, const IntVec2& size);
         void    CalculateAllUVCoordinates();
-        IntVec2 FindBestAtlasSize(int totalSprites, int spriteResolution) const;
-
-        // Simple rectangle packing (can be upgraded to more sophisticated algorithms later)
-        struct PackingRect
-        {
-            IntVec2 position;
-            IntVec2 size;
-            bool    occupied = false;
-
-            PackingRect(IntVec2 pos, IntVec2 s) : position(pos), size(s)
-            {
-            }
-        };
-
-        bool TryPackSprite(IntVec2 spriteSize, IntVec2& outPosition);
-        void InitializePackingGrid(IntVec2 atlasDimensions, int spriteSize);
+        IntVec2 FindBestAtlasSize(int64_t totalCellArea, IntVec2 largestCell) const;
+        size_t  PackCells(IntVec2 atlasDimensions, const std::vector<PendingSprite>& sprites, std::vector<IntVec2>& outCellPositions) const;
 
     private:
         AtlasConfig      m_config; // Atlas configuration
@@ -99,10 +105,6 @@ namespace enigma::resource
         AtlasStats m_stats; // Generation statistics
         bool       m_isBuilt; // Whether atlas has been built
 
-        // Packing data (for simple grid-based packing)
-        std::vector<std::vector<bool>> m_packingGrid; // Grid for sprite placement
-        int                            m_gridResolution; // Resolution of each grid cell
-
         // Texture integration (managed externally by renderer)
         mutable Texture* m_atlasTexture; // Rendered texture (created by renderer)
     };
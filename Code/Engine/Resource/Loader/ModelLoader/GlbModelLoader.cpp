@@ -1,9 +1,12 @@
 ﻿#include "GlbModelLoader.hpp"
 
+#include <cstring>
+
 #include "Engine/Core/EngineCommon.hpp"
 #define TINYGLTF_IMPLEMENTATION
 #define TINYGLTF_NO_STB_IMAGE_WRITE
 
+#include "MeshCache.hpp"
 #include "ObjModelLoader.hpp"
 #include "Engine/Renderer/Texture.hpp"
 #include "Engine/Core/Image.hpp"
@@ -25,6 +28,25 @@ bool GlbModelLoader::CanLoad(const std::string& extension) const
 std::unique_ptr<FMesh> GlbModelLoader::Load(const ResourceLocation& location, const std::string& filePath)
 {
     UNUSED(location)
+
+    // A cached import skips tinygltf entirely, including image decoding
+    const bool            useCache = !m_meshCacheDirectory.empty();
+    std::filesystem::path cacheFile;
+    uint64_t              cacheKey = 0;
+    if (useCache)
+    {
+        cacheFile = MeshCache::GetCacheFile(m_meshCacheDirectory, filePath);
+        cacheKey  = MeshCache::ComputeSourceKey(GetLoaderName(), filePath);
+
+        auto                          cached = std::make_unique<FMesh>();
+        std::vector<MeshCacheTexture> textures;
+        if (MeshCache::Load(cacheFile, cacheKey, *cached, textures))
+        {
+            RestoreCachedTextures(*cached, textures);
+            return cached;
+        }
+    }
+
     tinygltf::Model model;
     std::string     err;
     std::string     warn;
@@ -68,7 +90,13 @@ std::unique_ptr<FMesh> GlbModelLoader::Load(const ResourceLocation& location, co
     CalculateTangentsAndBitangents(*mesh);
 
     // Extract material and texture channels
-    ExtractMaterials(model, *mesh);
+    std::vector<MeshCacheTexture> cacheTextures;
+    ExtractMaterials(model, *mesh, useCache ? &cacheTextures : nullptr);
+
+    if (useCache)
+    {
+        MeshCache::Save(cacheFile, cacheKey, *mesh, cacheTextures);
+    }
 
     return mesh;
 }
@@ -341,7 +369,7 @@ void GlbModelLoader::ExtractIndices(const tinygltf::Model& model, int accessorIn
  * @param mesh The mesh object to be populated with the extracted materials.
  *             The `materials` vector of the mesh is filled with processed materials.
  */
-void GlbModelLoader::ExtractMaterials(const tinygltf::Model& model, FMesh& mesh)
+void GlbModelLoader::ExtractMaterials(const tinygltf::Model& model, FMesh& mesh, std::vector<MeshCacheTexture>* outCacheTextures)
 {
     mesh.materials.reserve(model.materials.size());
 
@@ -352,10 +380,63 @@ void GlbModelLoader::ExtractMaterials(const tinygltf::Model& model, FMesh& mesh)
         material.name = gltfMaterial.name.empty() ? "Material_" + std::to_string(i) : gltfMaterial.name;
 
         ProcessMaterial(gltfMaterial, material, model);
+        if (outCacheTextures)
+        {
+            CaptureMaterialTextures(gltfMaterial, material, static_cast<uint32_t>(i), model, *outCacheTextures);
+        }
         mesh.materials.push_back(std::move(material));
     }
 }
 
+/**
+ * Records the pixels of every texture ProcessMaterial attached to `material`,
+ * so the mesh cache can recreate the textures without tinygltf.
+ */
+void GlbModelLoader::CaptureMaterialTextures(const tinygltf::Material& gltfMaterial, const FMaterial& material, uint32_t materialIndex,
+                                             const tinygltf::Model& model, std::vector<MeshCacheTexture>& outCacheTextures)
+{
+    const std::pair<EMaterialChannel, int> channelTextures[] = {
+        {EMaterialChannel::Albedo, gltfMaterial.pbrMetallicRoughness.baseColorTexture.index},
+        {EMaterialChannel::MetallicRoughness, gltfMaterial.pbrMetallicRoughness.metallicRoughnessTexture.index},
+        {EMaterialChannel::Normal, gltfMaterial.normalTexture.index},
+        {EMaterialChannel::Occlusion, gltfMaterial.occlusionTexture.index},
+        {EMaterialChannel::Emission, gltfMaterial.emissiveTexture.index},
+    };
+
+    for (const auto& [channel, textureIndex] : channelTextures)
+    {
+        if (!material.HasTexture(channel))
+        {
+            continue;
+        }
+
+        const tinygltf::Image& gltfImage = model.images[model.textures[textureIndex].source];
+        MeshCacheTexture       cacheTexture;
+        cacheTexture.materialIndex = materialIndex;
+        cacheTexture.channel       = channel;
+        cacheTexture.texCoordSet   = material.GetTextureCoordSet(channel);
+        cacheTexture.dimensions    = IntVec2(gltfImage.width, gltfImage.height);
+        if (ConvertGLTFImage(gltfImage, cacheTexture.texels))
+        {
+            outCacheTextures.push_back(std::move(cacheTexture));
+        }
+    }
+}
+
+void GlbModelLoader::RestoreCachedTextures(FMesh& mesh, const std::vector<MeshCacheTexture>& textures)
+{
+    for (const MeshCacheTexture& cacheTexture : textures)
+    {
+        auto texture = CreateTextureFromTexels(cacheTexture.dimensions, cacheTexture.texels);
+        if (texture)
+        {
+            FMaterial& material                             = mesh.materials[cacheTexture.materialIndex];
+            material.textureCoordSets[cacheTexture.channel] = cacheTexture.texCoordSet;
+            material.SetTexture(cacheTexture.channel, std::move(texture));
+        }
+    }
+}
+
 /**
  * Processes the material data from a glTF model and populates the provided `material`
  * object with rendering parameters, textures, and other properties.
@@ -484,64 +565,26 @@ void GlbModelLoader::ProcessMaterial(const tinygltf::Material& gltfMaterial, FMa
 std::unique_ptr<Texture> GlbModelLoader::CreateTextureFromGLTFImage(const tinygltf::Image& gltfImage, const std::string& debugName)
 {
     UNUSED(debugName)
-    if (gltfImage.image.empty())
+    std::vector<Rgba8> texels;
+    if (!ConvertGLTFImage(gltfImage, texels))
     {
         return nullptr;
     }
 
-    // Create an Image object for the engine
-    IntVec2 dimensions(gltfImage.width, gltfImage.height);
-    Image   engineImage(dimensions, Rgba8::WHITE); // 创建具有正确尺寸的Image
-
-    // Set the pixel data manually
-    const unsigned char* srcData     = gltfImage.image.data();
-    int                  totalPixels = gltfImage.width * gltfImage.height;
+    return CreateTextureFromTexels(IntVec2(gltfImage.width, gltfImage.height), texels);
+}
 
-    // Converts pixel format based on the number of channels
-    if (gltfImage.component == 1)
-    {
-        // Grayscale graph
-        for (int i = 0; i < totalPixels; ++i)
-        {
-            unsigned char gray = srcData[i];
-            int           x    = i % gltfImage.width;
-            int           y    = i / gltfImage.width;
-            engineImage.SetTexelColor(IntVec2(x, y), Rgba8(gray, gray, gray, 255));
-        }
-    }
-    else if (gltfImage.component == 3)
-    {
-        // RGB
-        for (int i = 0; i < totalPixels; ++i)
-        {
-            int x = i % gltfImage.width;
-            int y = i / gltfImage.width;
-            engineImage.SetTexelColor(IntVec2(x, y),
-                                      Rgba8(srcData[i * 3 + 0], // R
-                                            srcData[i * 3 + 1], // G
-                                            srcData[i * 3 + 2], // B
-                                            255)); // A
-        }
-    }
-    else if (gltfImage.component == 4)
-    {
-        // RGBA
-        for (int i = 0; i < totalPixels; ++i)
-        {
-            int x = i % gltfImage.width;
-            int y = i / gltfImage.width;
-            engineImage.SetTexelColor(IntVec2(x, y),
-                                      Rgba8(srcData[i * 4 + 0], // R
-                                            srcData[i * 4 + 1], // G
-                                            srcData[i * 4 + 2], // B
-                                            srcData[i * 4 + 3])); // A
-        }
-    }
-    else
+std::unique_ptr<Texture> GlbModelLoader::CreateTextureFromTexels(const IntVec2& dimensions, const std::vector<Rgba8>& texels)
+{
+    if (!m_renderer || texels.empty())
     {
         return nullptr;
     }
 
+    // Create an Image object for the engine and fill it with one bulk copy
+    Image engineImage(dimensions, Rgba8::WHITE);
+    std::memcpy(engineImage.GetRawData(), texels.data(), texels.size() * sizeof(Rgba8));
+
     // Create textures using the existing IRenderer interface and immediately wrap them as smart pointers
     Texture* rawTexture = m_renderer->CreateTextureFromImage(engineImage);
     if (rawTexture)
@@ -553,6 +596,45 @@ std::unique_ptr<Texture> GlbModelLoader::CreateTextureFromGLTFImage(const tinygl
     return nullptr;
 }
 
+/**
+ * Converts tinygltf image pixels (grayscale, RGB or RGBA) to tightly packed Rgba8 texels.
+ * Returns false for empty images or unsupported channel counts.
+ */
+bool GlbModelLoader::ConvertGLTFImage(const tinygltf::Image& gltfImage, std::vector<Rgba8>& outTexels)
+{
+    const size_t totalPixels = static_cast<size_t>(gltfImage.width) * static_cast<size_t>(gltfImage.height);
+    const int    components  = gltfImage.component;
+    if (gltfImage.image.empty() || (components != 1 && components != 3 && components != 4) ||
+        gltfImage.image.size() < totalPixels * static_cast<size_t>(components))
+    {
+        return false;
+    }
+
+    const unsigned char* srcData = gltfImage.image.data();
+    outTexels.resize(totalPixels);
+
+    // Converts pixel format based on the number of channels
+    if (components == 4)
+    {
+        std::memcpy(outTexels.data(), srcData, totalPixels * sizeof(Rgba8));
+    }
+    else if (components == 3)
+    {
+        for (size_t i = 0; i < totalPixels; ++i)
+        {
+            outTexels[i] = Rgba8(srcData[i * 3 + 0], srcData[i * 3 + 1], srcData[i * 3 + 2], 255);
+        }
+    }
+    else
+    {
+        for (size_t i = 0; i < totalPixels; ++i)
+        {
+            outTexels[i] = Rgba8(srcData[i], srcData[i], srcData[i], 255);
+        }
+    }
+    return true;
+}
+
 /**
  * Extracts a texture from the given texture information in a GLTF model,
  * validating its existence and creating a texture instance from the associated
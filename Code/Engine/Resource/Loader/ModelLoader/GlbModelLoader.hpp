@@ -14,6 +14,9 @@ namespace tinygltf
     struct Primitive;
 }
 
+struct IntVec2;
+struct MeshCacheTexture;
+
 class GlbModelLoader : public ModelLoader
 {
 public:
@@ -42,12 +45,17 @@ private:
     void ExtractTangents(const tinygltf::Model& model, int accessorIndex, FMesh& mesh);
     void ExtractIndices(const tinygltf::Model& model, int accessorIndex, FMesh& mesh);
 
-    // Material extraction
-    void ExtractMaterials(const tinygltf::Model& model, FMesh& mesh);
+    // Material extraction; outCacheTextures (optional) receives every texture's pixels for the mesh cache
+    void ExtractMaterials(const tinygltf::Model& model, FMesh& mesh, std::vector<MeshCacheTexture>* outCacheTextures = nullptr);
     void ProcessMaterial(const tinygltf::Material& gltfMaterial, FMaterial& material, const tinygltf::Model& model);
+    void CaptureMaterialTextures(const tinygltf::Material& gltfMaterial, const FMaterial& material, uint32_t materialIndex,
+                                 const tinygltf::Model& model, std::vector<MeshCacheTexture>& outCacheTextures);
+    void RestoreCachedTextures(FMesh& mesh, const std::vector<MeshCacheTexture>& textures);
 
     // Create texture from image from tinygltf::Image
     std::unique_ptr<Texture> CreateTextureFromGLTFImage(const tinygltf::Image& gltfImage, const std::string& debugName);
+    std::unique_ptr<Texture> CreateTextureFromTexels(const IntVec2& dimensions, const std::vector<Rgba8>& texels);
+    static bool              ConvertGLTFImage(const tinygltf::Image& gltfImage, std::vector<Rgba8>& outTexels);
     std::unique_ptr<Texture> ExtractTextureFromInfo(const tinygltf::TextureInfo& textureInfo, const tinygltf::Model& model, const std::string& channelName);
     std::unique_ptr<Texture> ExtractTextureFromNormalInfo(const tinygltf::NormalTextureInfo& normalInfo, const tinygltf::Model& model);
     std::unique_ptr<Texture> ExtractTextureFromOcclusionInfo(const tinygltf::OcclusionTextureInfo& occlusionInfo, const tinygltf::Model& model);
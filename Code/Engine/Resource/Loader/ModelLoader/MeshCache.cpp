@@ -0,0 +1,297 @@
+#include "MeshCache.hpp"
+
+#include <cstdio>
+#include <exception>
+#include <fstream>
+#include <type_traits>
+
+#include "Engine/Core/MappedFile.hpp"
+#include "Engine/Core/Buffer/ByteBuffer.hpp"
+#include "Engine/Core/Buffer/ByteBufferView.hpp"
+#include "Engine/Renderer/Texture.hpp"
+
+namespace
+{
+    static_assert(std::is_standard_layout_v<Vertex_PCUTBN>, "Cached vertices are copied as raw bytes");
+
+    void HashBytes(uint64_t& hash, const void* data, size_t size)
+    {
+        const unsigned char* bytes = static_cast<const unsigned char*>(data);
+        for (size_t i = 0; i < size; ++i)
+        {
+            hash ^= bytes[i];
+            hash *= 0x100000001B3ull;
+        }
+    }
+
+    template <typename T>
+    void HashValue(uint64_t& hash, const T& value)
+    {
+        HashBytes(hash, &value, sizeof(T));
+    }
+
+    void HashString(uint64_t& hash, const std::string& text)
+    {
+        HashValue(hash, text.size());
+        HashBytes(hash, text.data(), text.size());
+    }
+
+    void HashFileStamp(uint64_t& hash, const std::filesystem::path& path)
+    {
+        std::error_code ec;
+        const auto      size     = std::filesystem::file_size(path, ec);
+        const uint64_t  fileSize = ec ? UINT64_MAX : static_cast<uint64_t>(size);
+        const auto      modified = std::filesystem::last_write_time(path, ec);
+        const int64_t   ticks    = ec ? 0 : static_cast<int64_t>(modified.time_since_epoch().count());
+
+        HashString(hash, path.generic_string());
+        HashValue(hash, fileSize);
+        HashValue(hash, ticks);
+    }
+
+    void WriteMaterial(enigma::core::ByteBuffer& buffer, const FMaterial& material)
+    {
+        buffer.WriteString(material.name);
+        buffer.WriteFloat(material.baseColorFactor.x);
+        buffer.WriteFloat(material.baseColorFactor.y);
+        buffer.WriteFloat(material.baseColorFactor.z);
+        buffer.WriteFloat(material.baseColorFactor.w);
+        buffer.WriteFloat(material.metallicFactor);
+        buffer.WriteFloat(material.roughnessFactor);
+        buffer.WriteFloat(material.emissiveFactor.x);
+        buffer.WriteFloat(material.emissiveFactor.y);
+        buffer.WriteFloat(material.emissiveFactor.z);
+        buffer.WriteFloat(material.normalScale);
+        buffer.WriteFloat(material.occlusionStrength);
+        buffer.WriteFloat(material.alphaCutoff);
+        buffer.WriteByte(static_cast<uint8_t>(material.alphaMode));
+        buffer.WriteBool(material.doubleSided);
+    }
+
+    void ReadMaterial(enigma::core::ByteBufferView& reader, FMaterial& material)
+    {
+        material.name              = reader.ReadString();
+        material.baseColorFactor.x = reader.ReadFloat();
+        material.baseColorFactor.y = reader.ReadFloat();
+        material.baseColorFactor.z = reader.ReadFloat();
+        material.baseColorFactor.w = reader.ReadFloat();
+        material.metallicFactor    = reader.ReadFloat();
+        material.roughnessFactor   = reader.ReadFloat();
+        material.emissiveFactor.x  = reader.ReadFloat();
+        material.emissiveFactor.y  = reader.ReadFloat();
+        material.emissiveFactor.z  = reader.ReadFloat();
+        material.normalScale       = reader.ReadFloat();
+        material.occlusionStrength = reader.ReadFloat();
+        material.alphaCutoff       = reader.ReadFloat();
+        material.alphaMode         = static_cast<FMaterial::AlphaMode>(reader.ReadByte());
+        material.doubleSided       = reader.ReadBool();
+    }
+}
+
+std::filesystem::path MeshCache::GetCacheFile(const std::filesystem::path& cacheDirectory, const std::string& sourcePath)
+{
+    std::error_code             ec;
+    const std::filesystem::path absolute = std::filesystem::absolute(sourcePath, ec).lexically_normal();
+
+    uint64_t hash = 0xCBF29CE484222325ull;
+    HashString(hash, (ec ? std::filesystem::path(sourcePath) : absolute).generic_string());
+
+    char suffix[24];
+    std::snprintf(suffix, sizeof(suffix), "_%016llx.mesh", static_cast<unsigned long long>(hash));
+    return cacheDirectory / (std::filesystem::path(sourcePath).stem().string() + suffix);
+}
+
+uint64_t MeshCache::ComputeSourceKey(const std::string& loaderName, const std::string& sourcePath, const std::vector<std::filesystem::path>& dependencies)
+{
+    uint64_t hash = 0xCBF29CE484222325ull;
+    HashValue(hash, kVersion);
+    HashString(hash, loaderName);
+    HashFileStamp(hash, sourcePath);
+
+    HashValue(hash, dependencies.size());
+    for (const std::filesystem::path& dependency : dependencies)
+    {
+        HashFileStamp(hash, dependency);
+    }
+    return hash;
+}
+
+bool MeshCache::Save(const std::filesystem::path& cacheFile, uint64_t sourceKey, const FMesh& mesh, const std::vector<MeshCacheTexture>& textures)
+{
+    using namespace enigma::core;
+
+    ByteBuffer header;
+    header.WriteUnsignedInt(kMagic);
+    header.WriteUnsignedInt(kVersion);
+    header.WriteUnsignedLong(sourceKey);
+    header.WriteUnsignedInt(static_cast<uint32_t>(sizeof(Vertex_PCUTBN)));
+    header.WriteUnsignedLong(mesh.m_vertices.size());
+    header.WriteUnsignedLong(mesh.m_indices.size());
+    header.WriteString(mesh.m_MetaData.is_null() ? std::string() : mesh.m_MetaData.dump());
+
+    header.WriteVarUnsignedInt(static_cast<uint32_t>(mesh.m_subMeshes.size()));
+    for (const SubMesh& subMesh : mesh.m_subMeshes)
+    {
+        header.WriteVarUnsignedInt(subMesh.materialIndex);
+        header.WriteVarUnsignedInt(subMesh.indexStart);
+        header.WriteVarUnsignedInt(subMesh.indexCount);
+        header.WriteString(subMesh.name);
+    }
+
+    header.WriteVarUnsignedInt(static_cast<uint32_t>(mesh.materials.size()));
+    for (const FMaterial& material : mesh.materials)
+    {
+        WriteMaterial(header, material);
+    }
+
+    header.WriteVarUnsignedInt(static_cast<uint32_t>(textures.size()));
+    for (const MeshCacheTexture& texture : textures)
+    {
+        header.WriteVarUnsignedInt(texture.materialIndex);
+        header.WriteByte(static_cast<uint8_t>(texture.channel));
+        header.WriteVarInt(texture.texCoordSet);
+        header.WriteVarUnsignedInt(static_cast<uint32_t>(texture.dimensions.x));
+        header.WriteVarUnsignedInt(static_cast<uint32_t>(texture.dimensions.y));
+    }
+
+    std::error_code ec;
+    if (cacheFile.has_parent_path())
+    {
+        std::filesystem::create_directories(cacheFile.parent_path(), ec);
+    }
+
+    // Write a sibling temp file and rename it over the old one so a crash never leaves half a mesh
+    std::filesystem::path tempFile = cacheFile;
+    tempFile += ".tmp";
+    {
+        std::ofstream out(tempFile, std::ios::binary | std::ios::trunc);
+        if (!out)
+        {
+            return false;
+        }
+
+        // Bulk arrays go straight from the mesh; only the header is staged in a buffer
+        ByteBuffer trailer;
+        trailer.WriteUnsignedInt(kMagic);
+
+        out.write(reinterpret_cast<const char*>(header.Data()), static_cast<std::streamsize>(header.WrittenBytes()));
+        for (const MeshCacheTexture& texture : textures)
+        {
+            out.write(reinterpret_cast<const char*>(texture.texels.data()), static_cast<std::streamsize>(texture.texels.size() * sizeof(Rgba8)));
+        }
+        out.write(reinterpret_cast<const char*>(mesh.m_vertices.data()), static_cast<std::streamsize>(mesh.m_vertices.size() * sizeof(Vertex_PCUTBN)));
+        out.write(reinterpret_cast<const char*>(mesh.m_indices.data()), static_cast<std::streamsize>(mesh.m_indices.size() * sizeof(unsigned int)));
+        out.write(reinterpret_cast<const char*>(trailer.Data()), static_cast<std::streamsize>(trailer.WrittenBytes()));
+        if (!out)
+        {
+            return false;
+        }
+    }
+
+    std::filesystem::rename(tempFile, cacheFile, ec);
+    if (ec)
+    {
+        std::filesystem::remove(tempFile, ec);
+        return false;
+    }
+    return true;
+}
+
+bool MeshCache::Load(const std::filesystem::path& cacheFile, uint64_t sourceKey, FMesh& outMesh, std::vector<MeshCacheTexture>& outTextures)
+{
+    using namespace enigma::core;
+
+    MappedFile file;
+    if (!file.Open(cacheFile))
+    {
+        return false;
+    }
+
+    try
+    {
+        ByteBufferView reader(file.GetData(), file.GetSize());
+        if (reader.ReadUnsignedInt() != kMagic || reader.ReadUnsignedInt() != kVersion || reader.ReadUnsignedLong() != sourceKey ||
+            reader.ReadUnsignedInt() != sizeof(Vertex_PCUTBN))
+        {
+            return false;
+        }
+
+        const uint64_t vertexCount = reader.ReadUnsignedLong();
+        const uint64_t indexCount  = reader.ReadUnsignedLong();
+
+        FMesh                         mesh;
+        std::vector<MeshCacheTexture> textures;
+
+        const std::string metaData = reader.ReadString();
+        if (!metaData.empty())
+        {
+            mesh.m_MetaData = json::parse(metaData, nullptr, false);
+        }
+
+        const uint32_t subMeshCount = reader.ReadVarUnsignedInt();
+        mesh.m_subMeshes.resize(subMeshCount);
+        for (SubMesh& subMesh : mesh.m_subMeshes)
+        {
+            subMesh.materialIndex = reader.ReadVarUnsignedInt();
+            subMesh.indexStart    = reader.ReadVarUnsignedInt();
+            subMesh.indexCount    = reader.ReadVarUnsignedInt();
+            subMesh.name          = reader.ReadString();
+        }
+
+        const uint32_t materialCount = reader.ReadVarUnsignedInt();
+        mesh.materials.resize(materialCount);
+        for (FMaterial& material : mesh.materials)
+        {
+            ReadMaterial(reader, material);
+        }
+
+        const uint32_t textureCount = reader.ReadVarUnsignedInt();
+        textures.resize(textureCount);
+        for (MeshCacheTexture& texture : textures)
+        {
+            texture.materialIndex = reader.ReadVarUnsignedInt();
+            texture.channel       = static_cast<EMaterialChannel>(reader.ReadByte());
+            texture.texCoordSet   = reader.ReadVarInt();
+            texture.dimensions.x  = static_cast<int>(reader.ReadVarUnsignedInt());
+            texture.dimensions.y  = static_cast<int>(reader.ReadVarUnsignedInt());
+            if (texture.materialIndex >= materialCount || texture.channel >= EMaterialChannel::COUNT)
+            {
+                return false;
+            }
+        }
+
+        for (MeshCacheTexture& texture : textures)
+        {
+            const size_t texelCount = static_cast<size_t>(texture.dimensions.x) * static_cast<size_t>(texture.dimensions.y);
+            if (!reader.HasRemaining(texelCount * sizeof(Rgba8)))
+            {
+                return false;
+            }
+            texture.texels.resize(texelCount);
+            reader.ReadRawBytesInto(texture.texels.data(), texelCount * sizeof(Rgba8));
+        }
+
+        // Size checks before resizing, so a corrupt count cannot trigger a huge allocation
+        if (!reader.HasRemaining(vertexCount * sizeof(Vertex_PCUTBN) + indexCount * sizeof(unsigned int)))
+        {
+            return false;
+        }
+        mesh.m_vertices.resize(static_cast<size_t>(vertexCount));
+        mesh.m_indices.resize(static_cast<size_t>(indexCount));
+        reader.ReadRawBytesInto(mesh.m_vertices.data(), mesh.m_vertices.size() * sizeof(Vertex_PCUTBN));
+        reader.ReadRawBytesInto(mesh.m_indices.data(), mesh.m_indices.size() * sizeof(unsigned int));
+
+        if (reader.ReadUnsignedInt() != kMagic)
+        {
+            return false;
+        }
+
+        outMesh     = std::move(mesh);
+        outTextures = std::move(textures);
+    }
+    catch (const std::exception&)
+    {
+        return false; // Truncated or corrupt: the caller imports from source instead
+    }
+    return true;
+}
@@ -0,0 +1,49 @@
+#pragma once
+#include <cstdint>
+#include <filesystem>
+#include <string>
+#include <vector>
+
+#include "ModelLoader.hpp"
+#include "Engine/Core/Rgba8.hpp"
+#include "Engine/Math/IntVec2.hpp"
+
+// Texture pixels captured at import, so a cached mesh can rebuild its materials without the source file
+struct MeshCacheTexture
+{
+    uint32_t           materialIndex = 0;
+    EMaterialChannel   channel       = EMaterialChannel::Albedo;
+    int                texCoordSet   = 0;
+    IntVec2            dimensions;
+    std::vector<Rgba8> texels;
+};
+
+/**
+ * @brief Versioned binary snapshot of an imported FMesh
+ *
+ * Stores the final vertices (positions, normals, UVs and tangent frames, after
+ * all loader post-processing), indices, the submesh table, material parameters
+ * and texture pixels. Vertices and indices are written as raw arrays, so a
+ * load is a header parse followed by one bulk copy per array.
+ *
+ * The source key covers the format version, the loader, and the size and
+ * mtime of the source file plus any side files it depends on; a mismatched
+ * key, vertex layout or a truncated file fails Load() and the caller imports
+ * from source again. Files are written to a temp file and renamed into place.
+ */
+class MeshCache
+{
+public:
+    static constexpr uint32_t kMagic   = 0x4853454D; // "MESH"
+    static constexpr uint32_t kVersion = 1;
+
+    /// Cache file for a source model: <directory>/<stem>_<path hash>.mesh
+    static std::filesystem::path GetCacheFile(const std::filesystem::path& cacheDirectory, const std::string& sourcePath);
+
+    static uint64_t ComputeSourceKey(const std::string& loaderName, const std::string& sourcePath, const std::vector<std::filesystem::path>& dependencies = {});
+
+    static bool Save(const std::filesystem::path& cacheFile, uint64_t sourceKey, const FMesh& mesh, const std::vector<MeshCacheTexture>& textures = {});
+
+    /// Restores geometry, submeshes, metadata and material parameters; textures come back as pixels for the caller to upload
+    static bool Load(const std::filesystem::path& cacheFile, uint64_t sourceKey, FMesh& outMesh, std::vector<MeshCacheTexture>& outTextures);
+};
@@ -1,4 +1,6 @@
 ﻿#pragma once
+#include <filesystem>
+
 #include "Engine/Core/Vertex_PCU.hpp"
 #include "Engine/Math/Vec4.hpp"
 #include "Engine/Resource/Loader/Loader.hpp"
@@ -137,7 +139,8 @@ struct FMesh
 class ModelLoader : public ResourceLoader<FMesh>
 {
 protected:
-    IRenderer* m_renderer; // Cached renderer backend
+    IRenderer*            m_renderer; // Cached renderer backend
+    std::filesystem::path m_meshCacheDirectory = ".enigma/cache/mesh/"; // Binary snapshots of imported meshes, see MeshCache
 
 public:
     explicit ModelLoader(IRenderer* renderer)
@@ -146,4 +149,8 @@ public:
     }
 
     virtual ~ModelLoader() = default;
+
+    /// Where imported meshes are cached; an empty path always imports from source
+    void                         SetMeshCacheDirectory(const std::filesystem::path& directory) { m_meshCacheDirectory = directory; }
+    const std::filesystem::path& GetMeshCacheDirectory() const { return m_meshCacheDirectory; }
 };
@@ -1,14 +1,11 @@
 ﻿#include "ObjModelLoader.hpp"
+#include "MeshCache.hpp"
 
-#include <array>
 #include <filesystem>
 #include <fstream>
 #include <iostream>
-#include <regex>
-#include <sstream>
 
 #include "Engine/Core/EngineCommon.hpp"
-#include "Engine/Core/FileSystemHelper.hpp"
 #include "Engine/Math/MathUtils.hpp"
 
 ObjModelLoader::ObjModelLoader(IRenderer* renderer) : ModelLoader(renderer)
@@ -35,6 +32,29 @@ std::unique_ptr<FMesh> ObjModelLoader::LoadObjModel(const std::string& filePath)
     std::filesystem::path fileName   = path.filename();
     std::filesystem::path metaPath   = parentPath / fileName.replace_extension().concat(".meta.json");
 
+    // The meta file transforms the vertices, so it is part of the cache key
+    const bool            useCache = !m_meshCacheDirectory.empty();
+    std::filesystem::path cacheFile;
+    uint64_t              cacheKey = 0;
+    if (useCache)
+    {
+        std::vector<std::filesystem::path> dependencies;
+        if (std::filesystem::exists(metaPath))
+        {
+            dependencies.push_back(metaPath);
+        }
+
+        cacheFile = MeshCache::GetCacheFile(m_meshCacheDirectory, filePath);
+        cacheKey  = MeshCache::ComputeSourceKey(GetLoaderName(), filePath, dependencies);
+
+        std::unique_ptr<FMesh>        cached = std::make_unique<FMesh>();
+        std::vector<MeshCacheTexture> textures;
+        if (MeshCache::Load(cacheFile, cacheKey, *cached, textures))
+        {
+            return cached;
+        }
+    }
+
     // Prepare FMesh
     std::unique_ptr<FMesh> mesh = std::make_unique<FMesh>();
 
@@ -44,32 +64,19 @@ std::unique_ptr<FMesh> ObjModelLoader::LoadObjModel(const std::string& filePath)
         mesh->m_MetaData = json::parse(f, nullptr, false, true);
     }
 
-
-    // Read the entire file into a string at once
-    std::string fileContent;
-    FileReadToString(fileContent, filePath);
-
-    if (fileContent.empty())
+    // Parse the memory-mapped file in line-aligned chunks, one per hardware thread
+    ObjParseResult parsed;
+    if (!ObjParser::ParseFile(filePath, parsed) || parsed.stats.bytes == 0)
     {
         ERROR_AND_DIE("Unable to read OBJ file:" + filePath)
     }
 
-    // Preallocate container (better estimate based on file size)
-    size_t fileSize       = fileContent.size();
-    size_t estimatedLines = fileSize / 20; // Average 20 characters per line
-
-    mesh->vertexPosition.reserve(estimatedLines / 8); // Estimate the number of v rows
-    mesh->vertexNormal.reserve(estimatedLines / 10); // Estimate the number of vn rows
-    mesh->uvTexCoords.reserve(estimatedLines / 10); // Estimate the number of vt rows
-
-    std::vector<std::string> faceLines;
-    faceLines.reserve(estimatedLines / 4); // Estimate the number of face rows
-
-    // Use efficient string parsing, avoiding regular expressions
-    ParseObjContentOptimized(fileContent, *mesh.get(), faceLines);
+    mesh->vertexPosition = std::move(parsed.positions);
+    mesh->vertexNormal   = std::move(parsed.normals);
+    mesh->uvTexCoords    = std::move(parsed.texCoords);
 
     // Process face data
-    ProcessFacesOptimized(*mesh.get(), faceLines);
+    BuildVertices(*mesh.get(), parsed.corners);
 
     // Generate normal and tangent space
     GenerateNormalsIfNeeded(*mesh.get());
@@ -77,243 +84,18 @@ std::unique_ptr<FMesh> ObjModelLoader::LoadObjModel(const std::string& filePath)
     // Process MetaData
     ProcessMetaData(mesh);
 
-    return mesh;
-}
-
-// Optimized content parsing function - avoid line-by-line splitting and regular expressions
-void ObjModelLoader::ParseObjContentOptimized(const std::string& content, FMesh& mesh, std::vector<std::string>& faceLines)
-{
-    const char* ptr = content.c_str();
-    const char* end = ptr + content.size();
-
-    while (ptr < end)
-    {
-        // Skip whitespace characters
-        while (ptr < end && (*ptr == ' ' || *ptr == '\t')) ++ptr;
-
-        // Skip empty lines
-        if (ptr >= end || *ptr == '\n' || *ptr == '\r')
-        {
-            // Jump to the next line
-            while (ptr < end && (*ptr == '\n' || *ptr == '\r')) ++ptr;
-            continue;
-        }
-
-        // Skip comment lines
-        if (*ptr == '#')
-        {
-            // Jump to the end of the line
-            while (ptr < end && *ptr != '\n' && *ptr != '\r') ++ptr;
-            continue;
-        }
-
-        // Parse command type
-        if (ptr + 1 < end)
-        {
-            if (*ptr == 'v')
-            {
-                if (*(ptr + 1) == ' ')
-                {
-                    //Vertex position "v x y z"
-                    ptr += 2;
-                    ParseVertex(ptr, end, mesh);
-                }
-                else if (*(ptr + 1) == 'n' && *(ptr + 2) == ' ')
-                {
-                    // Normal "vn x y z"
-                    ptr += 3;
-                    ParseNormal(ptr, end, mesh);
-                }
-                else if (*(ptr + 1) == 't' && *(ptr + 2) == ' ')
-                {
-                    // Texture coordinates "vt u v"
-                    ptr += 3;
-                    ParseTexCoord(ptr, end, mesh);
-                }
-                else
-                {
-                    // Skip unknown v commands
-                    while (ptr < end && *ptr != '\n' && *ptr != '\r') ++ptr;
-                }
-            }
-            else if (*ptr == 'f' && *(ptr + 1) == ' ')
-            {
-                // Face "f ..."
-                const char* lineStart = ptr;
-                while (ptr < end && *ptr != '\n' && *ptr != '\r') ++ptr;
-                faceLines.emplace_back(lineStart, ptr - lineStart);
-            }
-            else
-            {
-                // Skip other commands
-                while (ptr < end && *ptr != '\n' && *ptr != '\r') ++ptr;
-            }
-        }
-        else
-        {
-            // Skip single character lines
-            while (ptr < end && *ptr != '\n' && *ptr != '\r') ++ptr;
-        }
-
-        // Jump to the next line
-        while (ptr < end && (*ptr == '\n' || *ptr == '\r')) ++ptr;
-    }
-}
-
-// Efficient floating point parsing
-inline float FastAtof(const char*& ptr, const char* end)
-{
-    // Skip leading spaces
-    while (ptr < end && (*ptr == ' ' || *ptr == '\t')) ++ptr;
-
-    if (ptr >= end) return 0.0f;
-
-    bool negative = false;
-    if (*ptr == '-')
-    {
-        negative = true;
-        ++ptr;
-    }
-    else if (*ptr == '+')
-    {
-        ++ptr;
-    }
-
-    float result = 0.0f;
-
-    // integer part
-    while (ptr < end && *ptr >= '0' && *ptr <= '9')
-    {
-        result = result * 10.0f + (float)(*ptr - '0');
-        ++ptr;
-    }
-
-    // Decimal part
-    if (ptr < end && *ptr == '.')
+    if (useCache)
     {
-        ++ptr;
-        float fraction = 0.1f;
-        while (ptr < end && *ptr >= '0' && *ptr <= '9')
-        {
-            result += (float)(*ptr - '0') * fraction;
-            fraction *= 0.1f;
-            ++ptr;
-        }
+        MeshCache::Save(cacheFile, cacheKey, *mesh);
     }
-    return negative ? -result : result;
-}
 
-inline int FastParseInt(const char*& ptr, const char* end)
-{
-    int result = 0;
-    while (ptr < end && *ptr >= '0' && *ptr <= '9')
-    {
-        result = result * 10 + (*ptr - '0');
-        ++ptr;
-    }
-    return result;
-}
-
-void ObjModelLoader::ParseVertex(const char*& ptr, const char* end, FMesh& mesh)
-{
-    Vec3 position;
-    position.x = FastAtof(ptr, end);
-    position.y = FastAtof(ptr, end);
-    position.z = FastAtof(ptr, end);
-    mesh.vertexPosition.push_back(position);
-}
-
-// Optimized normal parsing
-void ObjModelLoader::ParseNormal(const char*& ptr, const char* end, FMesh& mesh)
-{
-    Vec3 normal;
-    normal.x = FastAtof(ptr, end);
-    normal.y = FastAtof(ptr, end);
-    normal.z = FastAtof(ptr, end);
-    mesh.vertexNormal.push_back(normal);
-}
-
-// Optimized texture coordinate parsing
-void ObjModelLoader::ParseTexCoord(const char*& ptr, const char* end, FMesh& mesh)
-{
-    Vec2 uv;
-    uv.x = FastAtof(ptr, end);
-    uv.y = FastAtof(ptr, end);
-    mesh.uvTexCoords.push_back(uv);
+    return mesh;
 }
 
-void ObjModelLoader::ProcessFacesOptimized(FMesh& mesh, const std::vector<std::string>& faceLines)
+void ObjModelLoader::BuildVertices(FMesh& mesh, const std::vector<ObjCorner>& corners)
 {
-    // Use local definitions to avoid header file dependency issues
-    struct LocalFaceVertex
-    {
-        int posIndex    = -1;
-        int uvIndex     = -1;
-        int normalIndex = -1;
-    };
-
-    // Preallocate triangle container
-    std::vector<std::array<LocalFaceVertex, 3>> allTriangles;
-    allTriangles.reserve(faceLines.size() * 2); // Assume Most of them are probably quad
-
-    for (const std::string& faceLine : faceLines)
-    {
-        std::vector<LocalFaceVertex> faceVertices;
-        faceVertices.reserve(8); // Supports up to 8 polygons
-
-        //Quickly parse the face line
-        const char* ptr = faceLine.c_str() + 1; // Skip 'f'
-        const char* end = ptr + faceLine.size() - 1;
-
-        while (ptr < end)
-        {
-            // Skip spaces
-            while (ptr < end && *ptr == ' ') ++ptr;
-            if (ptr >= end) break;
-
-            LocalFaceVertex vertex;
-
-            // Parse vertex index
-            vertex.posIndex = FastParseInt(ptr, end) - 1;
-
-            if (ptr < end && *ptr == '/')
-            {
-                ++ptr;
-                if (ptr < end && *ptr != '/')
-                {
-                    vertex.uvIndex = FastParseInt(ptr, end) - 1;
-                }
-                if (ptr < end && *ptr == '/')
-                {
-                    ++ptr;
-                    if (ptr < end && *ptr != ' ')
-                    {
-                        vertex.normalIndex = FastParseInt(ptr, end) - 1;
-                    }
-                }
-            }
-
-            faceVertices.push_back(vertex);
-        }
-
-        // Triangulate
-        if (faceVertices.size() >= 3)
-        {
-            for (size_t i = 1; i < faceVertices.size() - 1; ++i)
-            {
-                std::array<LocalFaceVertex, 3> triangle = {
-                    faceVertices[0],
-                    faceVertices[i],
-                    faceVertices[i + 1]
-                };
-                allTriangles.push_back(triangle);
-            }
-        }
-    }
-
-    // Generate vertex data - process it here directly to avoid type conversion issues
     mesh.m_vertices.clear();
-    mesh.m_vertices.reserve(allTriangles.size() * 3);
+    mesh.m_vertices.resize(corners.size());
 
     // Default Value
     const Vec3  defaultPosition(0.0f, 0.0f, 0.0f);
@@ -323,33 +105,22 @@ void ObjModelLoader::ProcessFacesOptimized(FMesh& mesh, const std::vector<std::s
     const Vec2  defaultUV(0.0f, 0.0f);
     const Rgba8 defaultColor(255, 255, 255, 255);
 
-    for (const auto& triangle : allTriangles)
-    {
-        for (int i = 0; i < 3; ++i)
-        {
-            const LocalFaceVertex& faceVertex = triangle[i];
-
-            Vertex_PCUTBN vertex;
-
-            // Get data safely
-            vertex.m_position = (faceVertex.posIndex >= 0 && faceVertex.posIndex < (int)mesh.vertexPosition.size())
-                                    ? mesh.vertexPosition[faceVertex.posIndex]
-                                    : defaultPosition;
-
-            vertex.m_normal = (faceVertex.normalIndex >= 0 && faceVertex.normalIndex < (int)mesh.vertexNormal.size())
-                                  ? mesh.vertexNormal[faceVertex.normalIndex]
-                                  : defaultNormal;
+    const int positionCount = static_cast<int>(mesh.vertexPosition.size());
+    const int normalCount   = static_cast<int>(mesh.vertexNormal.size());
+    const int uvCount       = static_cast<int>(mesh.uvTexCoords.size());
 
-            vertex.m_uvTexCoords = (faceVertex.uvIndex >= 0 && faceVertex.uvIndex < (int)mesh.uvTexCoords.size())
-                                       ? mesh.uvTexCoords[faceVertex.uvIndex]
-                                       : defaultUV;
-
-            vertex.m_color     = defaultColor;
-            vertex.m_tangent   = defaultTangent;
-            vertex.m_bitangent = defaultBinormal;
-
-            mesh.m_vertices.push_back(vertex);
-        }
+    for (size_t i = 0; i < corners.size(); ++i)
+    {
+        const ObjCorner& corner = corners[i];
+        Vertex_PCUTBN&   vertex = mesh.m_vertices[i];
+
+        // Get data safely
+        vertex.m_position    = (corner.posIndex >= 0 && corner.posIndex < positionCount) ? mesh.vertexPosition[corner.posIndex] : defaultPosition;
+        vertex.m_normal      = (corner.normalIndex >= 0 && corner.normalIndex < normalCount) ? mesh.vertexNormal[corner.normalIndex] : defaultNormal;
+        vertex.m_uvTexCoords = (corner.uvIndex >= 0 && corner.uvIndex < uvCount) ? mesh.uvTexCoords[corner.uvIndex] : defaultUV;
+        vertex.m_color       = defaultColor;
+        vertex.m_tangent     = defaultTangent;
+        vertex.m_bitangent   = defaultBinormal;
     }
 }
 
@@ -388,177 +159,6 @@ void ObjModelLoader::ProcessMetaData(std::unique_ptr<FMesh>& mesh)
     }
 }
 
-void ObjModelLoader::ProcessVertex(FMesh& mesh, std::string& data)
-{
-    Vec3    position;
-    Strings values = SplitStringOnDelimiter(data, ' ');
-    position.x     = (float)atof(values[1].c_str());
-    position.y     = (float)atof(values[2].c_str());
-    position.z     = (float)atof(values[3].c_str());
-    mesh.vertexPosition.push_back(position);
-}
-
-void ObjModelLoader::ProcessNormal(FMesh& mesh, std::string& data)
-{
-    Vec3    normal;
-    Strings values = SplitStringOnDelimiter(data, ' ');
-    normal.x       = (float)atof(values[1].c_str());
-    normal.y       = (float)atof(values[2].c_str());
-    normal.z       = (float)atof(values[3].c_str());
-    mesh.vertexNormal.push_back(normal);
-}
-
-void ObjModelLoader::ProcessTextureCoords(FMesh& mesh, std::string& data)
-{
-    Vec2    uvCoords;
-    Strings values = SplitStringOnDelimiter(data, ' ');
-    uvCoords.x     = (float)atof(values[1].c_str());
-    uvCoords.y     = (float)atof(values[2].c_str());
-    mesh.uvTexCoords.push_back(uvCoords);
-}
-
-void ObjModelLoader::ProcessFaces(FMesh& mesh, Strings& data)
-{
-    struct FaceVertex
-    {
-        int posIndex    = -1; //Vertex position index
-        int uvIndex     = -1; // Texture coordinate index
-        int normalIndex = -1; // Normal index
-    };
-
-    // Parse a single vertex index string (like "1//2" or "1/2/3" or "1")
-    auto parseFaceVertex = [](const std::string& vertexStr) -> FaceVertex
-    {
-        FaceVertex vertex;
-
-        // 分割索引字符串
-        std::vector<std::string> indices;
-        std::stringstream        ss(vertexStr);
-        std::string              token;
-
-        while (std::getline(ss, token, '/'))
-        {
-            indices.push_back(token);
-        }
-
-        // Parse indexes in different formats
-        if (!indices.empty() && !indices[0].empty())
-        {
-            vertex.posIndex = std::atoi(indices[0].c_str()) - 1; // OBJ index starts from 1 and is converted to start from 0
-        }
-
-        if (indices.size() >= 2 && !indices[1].empty())
-        {
-            vertex.uvIndex = std::atoi(indices[1].c_str()) - 1;
-        }
-
-        if (indices.size() >= 3 && !indices[2].empty())
-        {
-            vertex.normalIndex = std::atoi(indices[2].c_str()) - 1;
-        }
-
-        return vertex;
-    };
-
-    // Triangulate polygonal face (fan triangulation: f 1 2 3 4 5 -> 123, 134, 145)
-    auto triangulatePolygon = [](const std::vector<FaceVertex>& polygon) -> std::vector<std::array<FaceVertex, 3>>
-    {
-        std::vector<std::array<FaceVertex, 3>> triangles;
-
-        if (polygon.size() < 3) return triangles;
-
-        // Fan-shaped triangulation: With the first vertex as the center, connect all adjacent vertex pairs
-        for (size_t i = 1; i < polygon.size() - 1; ++i)
-        {
-            std::array<FaceVertex, 3> triangle = {
-                polygon[0], // First vertex
-                polygon[i], // Current vertex
-                polygon[i + 1] // Next vertex
-            };
-            triangles.push_back(triangle);
-        }
-
-        return triangles;
-    };
-
-    // Process all faces
-    std::vector<std::array<FaceVertex, 3>> allTriangles;
-
-    for (const std::string& faceLine : data)
-    {
-        // Split face row: "f v1//n1 v2//n2 v3//n3 ..."
-        Strings faceTokens = SplitStringOnDelimiter(faceLine, ' ');
-
-        if (faceTokens.size() < 4) continue; // At least "f" + 3 m_vertices are required
-
-        // parse all m_vertices of the face (skipping the first "f" marker)
-        std::vector<FaceVertex> faceVertices;
-        for (size_t i = 1; i < faceTokens.size(); ++i)
-        {
-            FaceVertex vertex = parseFaceVertex(faceTokens[i]);
-            faceVertices.push_back(vertex);
-        }
-
-        // Triangulate this face
-        auto triangles = triangulatePolygon(faceVertices);
-        allTriangles.insert(allTriangles.end(), triangles.begin(), triangles.end());
-    }
-
-    // Generate the final Vertex_PCUTBN vertex data
-    mesh.m_vertices.clear();
-    mesh.m_vertices.reserve(allTriangles.size() * 3);
-
-    // Default Value
-    const Vec3  defaultPosition(0.0f, 0.0f, 0.0f);
-    const Vec3  defaultNormal(0.0f, 0.0f, 1.0f); // 向上法线
-    const Vec3  defaultTangent(1.0f, 0.0f, 0.0f); // 向右切线
-    const Vec3  defaultBinormal(0.0f, 1.0f, 0.0f); // 向前副法线
-    const Vec2  defaultUV(0.0f, 0.0f);
-    const Rgba8 defaultColor(255, 255, 255, 255); // 白色
-
-    for (const auto& triangle : allTriangles)
-    {
-        for (int i = 0; i < 3; ++i)
-        {
-            const FaceVertex& faceVertex = triangle[i];
-
-            // Get location data
-            Vec3 position = defaultPosition;
-            if (faceVertex.posIndex >= 0 && faceVertex.posIndex < (int)mesh.vertexPosition.size())
-            {
-                position = mesh.vertexPosition[faceVertex.posIndex];
-            }
-
-            // Get normal data
-            Vec3 normal = defaultNormal;
-            if (faceVertex.normalIndex >= 0 && faceVertex.normalIndex < (int)mesh.vertexNormal.size())
-            {
-                normal = mesh.vertexNormal[faceVertex.normalIndex];
-            }
-
-            // Get UV data (texture coordinates)
-            Vec2 uv = defaultUV;
-            if (faceVertex.uvIndex >= 0 && faceVertex.uvIndex < (int)mesh.uvTexCoords.size())
-            {
-                uv = mesh.uvTexCoords[faceVertex.uvIndex];
-            }
-
-            Vertex_PCUTBN vertex;
-            vertex.m_position    = position;
-            vertex.m_color       = defaultColor;
-            vertex.m_uvTexCoords = uv;
-            vertex.m_tangent     = defaultTangent;
-            vertex.m_bitangent   = defaultBinormal;
-            vertex.m_normal      = normal;
-
-            mesh.m_vertices.push_back(vertex);
-        }
-    }
-
-    // Verify the generated data
-    ValidateMeshData(mesh);
-}
-
 void ObjModelLoader::ValidateMeshData(const FMesh& mesh) const
 {
     // Check if the number of m_vertices is a multiple of 3 (triangle)
@@ -763,9 +363,3 @@ void ObjModelLoader::OrthonormalizeVertexTangentSpace(Vertex_PCUTBN& vertex)
         B = -B;
     }
 }
-
-void ObjModelLoader::ProcessExtraSpace(std::string& inData)
-{
-    inData = std::regex_replace(inData, std::regex(R"(^\s+|\s+$)"), "");
-    inData = std::regex_replace(inData, std::regex(R"(\s{2,})"), " ");
-}
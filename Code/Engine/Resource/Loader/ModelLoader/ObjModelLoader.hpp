@@ -1,5 +1,6 @@
 ﻿#pragma once
 #include "ModelLoader.hpp"
+#include "ObjParser.hpp"
 #include "Engine/Core/StringUtils.hpp"
 
 class ObjModelLoader : public ModelLoader
@@ -24,18 +25,7 @@ public:
 private:
     std::unique_ptr<FMesh> LoadObjModel(const std::string& filePath);
 
-    // Optimized parsing function
-    void ParseObjContentOptimized(const std::string& content, FMesh& mesh, std::vector<std::string>& faceLines);
-    void ParseVertex(const char*& ptr, const char* end, FMesh& mesh);
-    void ParseNormal(const char*& ptr, const char* end, FMesh& mesh);
-    void ParseTexCoord(const char*& ptr, const char* end, FMesh& mesh);
-
-    void ProcessFacesOptimized(FMesh& mesh, const std::vector<std::string>& faceLines);
+    // Expands parsed triangle corners into the mesh's unindexed vertex list
+    void BuildVertices(FMesh& mesh, const std::vector<ObjCorner>& corners);
     void ProcessMetaData(std::unique_ptr<FMesh>& mesh);
-
-    [[deprecated]] void ProcessVertex(FMesh& mesh, std::string& data);
-    [[deprecated]] void ProcessNormal(FMesh& mesh, std::string& data);
-    [[deprecated]] void ProcessTextureCoords(FMesh& mesh, std::string& data);
-    [[deprecated]] void ProcessFaces(FMesh& mesh, Strings& data);
-    [[deprecated]] void ProcessExtraSpace(std::string& inData);
 };
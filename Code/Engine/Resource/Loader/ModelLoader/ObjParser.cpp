@@ -0,0 +1,421 @@
+#include "ObjParser.hpp"
+
+#include <algorithm>
+#include <charconv>
+#include <chrono>
+#include <condition_variable>
+#include <cstring>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+
+#include "Engine/Core/MappedFile.hpp"
+
+namespace
+{
+    // Relative (negative) face indices are stored chunk-local, shifted below this bias, until the merge rebases them
+    constexpr int kRelativeIndexBias = -(1 << 30);
+
+    struct ObjChunk
+    {
+        const char* begin = nullptr;
+        const char* end   = nullptr;
+
+        std::vector<Vec3>      positions;
+        std::vector<Vec3>      normals;
+        std::vector<Vec2>      texCoords;
+        std::vector<ObjCorner> corners;
+
+        // Global offsets, filled in before the merge
+        size_t positionBase = 0;
+        size_t normalBase   = 0;
+        size_t texCoordBase = 0;
+        size_t cornerBase   = 0;
+    };
+
+    inline bool IsBlank(char c)
+    {
+        return c == ' ' || c == '\t';
+    }
+
+    inline const char* SkipBlanks(const char* ptr, const char* end)
+    {
+        while (ptr < end && IsBlank(*ptr)) ++ptr;
+        return ptr;
+    }
+
+    inline const char* SkipToken(const char* ptr, const char* end)
+    {
+        while (ptr < end && !IsBlank(*ptr)) ++ptr;
+        return ptr;
+    }
+
+    inline float ParseFloat(const char*& ptr, const char* end)
+    {
+        ptr = SkipBlanks(ptr, end);
+        if (ptr < end && *ptr == '+') ++ptr; // from_chars rejects an explicit plus sign
+
+        float value         = 0.0f;
+        auto [next, result] = std::from_chars(ptr, end, value);
+        if (result == std::errc::invalid_argument)
+        {
+            ptr = SkipToken(ptr, end);
+            return 0.0f;
+        }
+        ptr = next;
+        return value;
+    }
+
+    // Parses one face index field and encodes it against the chunk-local element count
+    inline int ParseIndex(const char*& ptr, const char* end, size_t localCount)
+    {
+        int value           = 0;
+        auto [next, result] = std::from_chars(ptr, end, value);
+        if (result != std::errc())
+        {
+            return -1;
+        }
+        ptr = next;
+
+        if (value > 0)
+        {
+            return value - 1;
+        }
+        if (value < 0)
+        {
+            return kRelativeIndexBias + static_cast<int>(localCount) + value;
+        }
+        return -1;
+    }
+
+    inline int ResolveIndex(int encoded, size_t base)
+    {
+        return encoded < -1 ? static_cast<int>(base) + (encoded - kRelativeIndexBias) : encoded;
+    }
+
+    void ParseFace(const char* ptr, const char* end, ObjChunk& chunk)
+    {
+        ObjCorner first;
+        ObjCorner previous;
+        int       cornerCount = 0;
+
+        while (true)
+        {
+            ptr = SkipBlanks(ptr, end);
+            if (ptr >= end)
+            {
+                break;
+            }
+
+            ObjCorner corner;
+            corner.posIndex = ParseIndex(ptr, end, chunk.positions.size());
+            if (ptr < end && *ptr == '/')
+            {
+                ++ptr;
+                if (ptr < end && *ptr != '/')
+                {
+                    corner.uvIndex = ParseIndex(ptr, end, chunk.texCoords.size());
+                }
+                if (ptr < end && *ptr == '/')
+                {
+                    ++ptr;
+                    corner.normalIndex = ParseIndex(ptr, end, chunk.normals.size());
+                }
+            }
+            ptr = SkipToken(ptr, end);
+
+            // Fan triangulation: f 1 2 3 4 5 -> 123, 134, 145
+            if (cornerCount == 0)
+            {
+                first = corner;
+            }
+            else if (cornerCount >= 2)
+            {
+                chunk.corners.push_back(first);
+                chunk.corners.push_back(previous);
+                chunk.corners.push_back(corner);
+            }
+            previous = corner;
+            ++cornerCount;
+        }
+    }
+
+    void ParseLine(const char* ptr, const char* end, ObjChunk& chunk)
+    {
+        if (end > ptr && end[-1] == '\r') --end;
+        ptr = SkipBlanks(ptr, end);
+        if (end - ptr < 2)
+        {
+            return;
+        }
+
+        if (ptr[0] == 'v')
+        {
+            if (IsBlank(ptr[1]))
+            {
+                ptr += 2;
+                Vec3 position;
+                position.x = ParseFloat(ptr, end);
+                position.y = ParseFloat(ptr, end);
+                position.z = ParseFloat(ptr, end);
+                chunk.positions.push_back(position);
+            }
+            else if (ptr[1] == 'n' && end - ptr > 2 && IsBlank(ptr[2]))
+            {
+                ptr += 3;
+                Vec3 normal;
+                normal.x = ParseFloat(ptr, end);
+                normal.y = ParseFloat(ptr, end);
+                normal.z = ParseFloat(ptr, end);
+                chunk.normals.push_back(normal);
+            }
+            else if (ptr[1] == 't' && end - ptr > 2 && IsBlank(ptr[2]))
+            {
+                ptr += 3;
+                Vec2 uv;
+                uv.x = ParseFloat(ptr, end);
+                uv.y = ParseFloat(ptr, end);
+                chunk.texCoords.push_back(uv);
+            }
+        }
+        else if (ptr[0] == 'f' && IsBlank(ptr[1]))
+        {
+            ParseFace(ptr + 2, end, chunk);
+        }
+        // Comments, groups, materials and smoothing groups are ignored
+    }
+
+    void ParseChunk(ObjChunk& chunk)
+    {
+        // Rough per-line estimates; a typical OBJ line is 20-40 bytes
+        const size_t estimatedLines = static_cast<size_t>(chunk.end - chunk.begin) / 32;
+        chunk.positions.reserve(estimatedLines / 3);
+        chunk.corners.reserve(estimatedLines * 2);
+
+        const char* ptr = chunk.begin;
+        while (ptr < chunk.end)
+        {
+            const char* lineEnd = static_cast<const char*>(std::memchr(ptr, '\n', static_cast<size_t>(chunk.end - ptr)));
+            if (lineEnd == nullptr)
+            {
+                lineEnd = chunk.end;
+            }
+            ParseLine(ptr, lineEnd, chunk);
+            ptr = lineEnd + 1;
+        }
+    }
+
+    void MergeChunk(const ObjChunk& chunk, ObjParseResult& result)
+    {
+        std::copy(chunk.positions.begin(), chunk.positions.end(), result.positions.begin() + chunk.positionBase);
+        std::copy(chunk.normals.begin(), chunk.normals.end(), result.normals.begin() + chunk.normalBase);
+        std::copy(chunk.texCoords.begin(), chunk.texCoords.end(), result.texCoords.begin() + chunk.texCoordBase);
+
+        ObjCorner* out = result.corners.data() + chunk.cornerBase;
+        for (const ObjCorner& corner : chunk.corners)
+        {
+            out->posIndex    = ResolveIndex(corner.posIndex, chunk.positionBase);
+            out->uvIndex     = ResolveIndex(corner.uvIndex, chunk.texCoordBase);
+            out->normalIndex = ResolveIndex(corner.normalIndex, chunk.normalBase);
+            ++out;
+        }
+    }
+
+    // Process-wide fork-join pool shared by every parse: workers start once, on the first multi-chunk
+    // file, and are reused for both the parse and the merge phase of every later file.
+    // The scheduler's task queue is not used because its completion records are drained (and the
+    // tasks deleted) by World, while models also load before a world exists and on resource threads.
+    class ObjChunkWorkerPool
+    {
+    public:
+        static ObjChunkWorkerPool& Get()
+        {
+            static ObjChunkWorkerPool pool;
+            return pool;
+        }
+
+        ~ObjChunkWorkerPool()
+        {
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                m_stopping = true;
+            }
+            m_workAvailable.notify_all();
+            for (std::thread& worker : m_workers)
+            {
+                worker.join();
+            }
+        }
+
+        // Runs fn(0..count-1) on the pool and the calling thread, returns once every index finished.
+        // Several threads may run jobs at the same time; their items interleave in FIFO order.
+        void Run(size_t count, const std::function<void(size_t)>& fn)
+        {
+            if (count <= 1 || m_workers.empty())
+            {
+                for (size_t i = 0; i < count; ++i)
+                {
+                    fn(i);
+                }
+                return;
+            }
+
+            Job job{&fn, count};
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_jobs.push_back(&job);
+            lock.unlock();
+            m_workAvailable.notify_all();
+
+            // The caller works on its own job too instead of blocking a thread
+            lock.lock();
+            while (job.nextIndex < job.count)
+            {
+                const size_t index = ClaimLocked(job);
+                lock.unlock();
+                fn(index);
+                lock.lock();
+                ++job.finishedCount;
+            }
+            m_jobFinished.wait(lock, [&job]() { return job.finishedCount == job.count; });
+        }
+
+    private:
+        struct Job
+        {
+            const std::function<void(size_t)>* fn;
+            size_t                             count;
+            size_t                             nextIndex     = 0; // Guarded by m_mutex, like finishedCount
+            size_t                             finishedCount = 0;
+        };
+
+        ObjChunkWorkerPool()
+        {
+            const unsigned int hardwareThreads = std::thread::hardware_concurrency();
+            const unsigned int workerCount     = hardwareThreads > 1 ? hardwareThreads - 1 : 0;
+            m_workers.reserve(workerCount);
+            for (unsigned int i = 0; i < workerCount; ++i)
+            {
+                m_workers.emplace_back([this]() { WorkerMain(); });
+            }
+        }
+
+        // Hands out the job's next index and unlinks the job once nothing is left to claim
+        size_t ClaimLocked(Job& job)
+        {
+            const size_t index = job.nextIndex++;
+            if (job.nextIndex == job.count)
+            {
+                m_jobs.erase(std::find(m_jobs.begin(), m_jobs.end(), &job));
+            }
+            return index;
+        }
+
+        void WorkerMain()
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            for (;;)
+            {
+                m_workAvailable.wait(lock, [this]() { return m_stopping || !m_jobs.empty(); });
+                if (m_stopping)
+                {
+                    return;
+                }
+
+                Job&         job   = *m_jobs.front();
+                const size_t index = ClaimLocked(job);
+                lock.unlock();
+                (*job.fn)(index);
+                lock.lock();
+
+                // Last touch of the job: its owner may return as soon as the count is complete
+                if (++job.finishedCount == job.count)
+                {
+                    m_jobFinished.notify_all();
+                }
+            }
+        }
+
+        std::mutex               m_mutex;
+        std::condition_variable  m_workAvailable;
+        std::condition_variable  m_jobFinished;
+        std::deque<Job*>         m_jobs; // Jobs with unclaimed indices
+        std::vector<std::thread> m_workers;
+        bool                     m_stopping = false;
+    };
+
+    template <typename Fn>
+    void RunPerChunk(std::vector<ObjChunk>& chunks, Fn&& fn)
+    {
+        ObjChunkWorkerPool::Get().Run(chunks.size(), [&chunks, &fn](size_t index) { fn(chunks[index]); });
+    }
+}
+
+ObjParseResult ObjParser::Parse(const char* data, size_t size, unsigned int threadCount)
+{
+    const auto parseStart = std::chrono::steady_clock::now();
+
+    if (threadCount == 0)
+    {
+        threadCount = std::max(1u, std::thread::hardware_concurrency());
+    }
+    const size_t chunkCount = std::max<size_t>(1, std::min<size_t>(threadCount, size / kMinChunkBytes));
+
+    // Line-aligned chunk boundaries
+    std::vector<ObjChunk> chunks(chunkCount);
+    const char*           end    = data + size;
+    const char*           cursor = data;
+    for (size_t i = 0; i < chunkCount; ++i)
+    {
+        const char* chunkEnd = i + 1 == chunkCount ? end : std::max(cursor, data + size * (i + 1) / chunkCount);
+        if (chunkEnd < end)
+        {
+            const char* newline = static_cast<const char*>(std::memchr(chunkEnd, '\n', static_cast<size_t>(end - chunkEnd)));
+            chunkEnd            = newline ? newline + 1 : end;
+        }
+        chunks[i].begin = cursor;
+        chunks[i].end   = chunkEnd;
+        cursor          = chunkEnd;
+    }
+
+    RunPerChunk(chunks, ParseChunk);
+
+    // Index merge: prefix sums give every chunk its global offsets, then chunks copy and rebase in parallel
+    ObjParseResult result;
+    size_t         positionCount = 0, normalCount = 0, texCoordCount = 0, cornerCount = 0;
+    for (ObjChunk& chunk : chunks)
+    {
+        chunk.positionBase = positionCount;
+        chunk.normalBase   = normalCount;
+        chunk.texCoordBase = texCoordCount;
+        chunk.cornerBase   = cornerCount;
+        positionCount += chunk.positions.size();
+        normalCount += chunk.normals.size();
+        texCoordCount += chunk.texCoords.size();
+        cornerCount += chunk.corners.size();
+    }
+    result.positions.resize(positionCount);
+    result.normals.resize(normalCount);
+    result.texCoords.resize(texCoordCount);
+    result.corners.resize(cornerCount);
+
+    RunPerChunk(chunks, [&result](const ObjChunk& chunk) { MergeChunk(chunk, result); });
+
+    result.stats.bytes     = size;
+    result.stats.chunks    = chunkCount;
+    result.stats.triangles = cornerCount / 3;
+    result.stats.parseMs   = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - parseStart).count();
+    return result;
+}
+
+bool ObjParser::ParseFile(const std::filesystem::path& filePath, ObjParseResult& outResult, unsigned int threadCount)
+{
+    enigma::core::MappedFile file;
+    if (!file.Open(filePath))
+    {
+        return false;
+    }
+
+    outResult = Parse(reinterpret_cast<const char*>(file.GetData()), file.GetSize(), threadCount);
+    return true;
+}
@@ -0,0 +1,54 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <vector>
+
+#include "Engine/Math/Vec2.hpp"
+#include "Engine/Math/Vec3.hpp"
+
+// One triangle corner, already resolved to 0-based indices into the parse result (-1 = not specified)
+struct ObjCorner
+{
+    int posIndex    = -1;
+    int uvIndex     = -1;
+    int normalIndex = -1;
+};
+
+struct ObjParseStats
+{
+    size_t bytes     = 0;
+    size_t chunks    = 0;
+    size_t triangles = 0;
+    double parseMs   = 0.0; // Chunk parsing plus the index merge
+
+    double GetThroughputMBps() const { return parseMs > 0.0 ? static_cast<double>(bytes) / (1024.0 * 1024.0) / (parseMs / 1000.0) : 0.0; }
+};
+
+struct ObjParseResult
+{
+    std::vector<Vec3>      positions;
+    std::vector<Vec3>      normals;
+    std::vector<Vec2>      texCoords;
+    std::vector<ObjCorner> corners; // Three per triangle, polygons fan-triangulated
+    ObjParseStats          stats;
+};
+
+// Allocation-free OBJ geometry parser (v / vn / vt / f) built on std::from_chars.
+//
+// The buffer is cut into line-aligned chunks that are parsed on separate threads
+// into chunk-local arrays. Face indices are kept as written, except relative
+// (negative) ones, which only make sense against the chunk's own element count;
+// the merge step concatenates the chunks and rebases those onto the global
+// arrays. Out-of-range indices are kept and left for the caller to reject.
+class ObjParser
+{
+public:
+    // threadCount 0 picks one chunk per hardware thread; small inputs always parse on the calling thread
+    static ObjParseResult Parse(const char* data, size_t size, unsigned int threadCount = 0);
+
+    // Memory-maps the file and parses it in place. False if the file cannot be mapped
+    static bool ParseFile(const std::filesystem::path& filePath, ObjParseResult& outResult, unsigned int threadCount = 0);
+
+    static constexpr size_t kMinChunkBytes = 1024 * 1024;
+};
@@ -46,7 +46,7 @@ bool ModelFace::LoadFromJson(const JsonObject& json)
 
     if (json.Has("tintindex"))
     {
-        tintIndex = json.GetInt("tintindex") != 0;
+        tintIndex = json.GetInt("tintindex");
     }
 
     return true;
@@ -47,7 +47,7 @@ namespace enigma::resource::model
         Vec4                       uv       = Vec4(0, 0, 16, 16); // UV coordinates in texture space
         int                        rotation = 0; // Rotation in 90-degree increments (0, 90, 180, 270)
         std::optional<std::string> cullFace; // Face to cull against ("up", "down", "north", etc.)
-        bool                       tintIndex = false; // Whether to apply tint
+        int                        tintIndex = -1; // Tint slot passed to the block color provider, -1 = untinted
 
         ModelFace() = default;
 
@@ -1,6 +1,9 @@
 ﻿#include "ResourceProvider.hpp"
 
+#include <algorithm>
+#include <cctype>
 #include <fstream>
+#include <unordered_set>
 
 namespace enigma::resource
 {
@@ -163,6 +166,130 @@ namespace enigma::resource
         return results;
     }
 
+    std::vector<ResourceMetadata> IResourceProvider::BuildIndex(ResourceIndexCache* cache) const
+    {
+        (void)cache; // Only directory-backed providers can reuse listings
+
+        std::vector<ResourceMetadata> results;
+        for (const ResourceLocation& location : ListResources())
+        {
+            auto metadata = GetMetadata(location);
+            if (metadata)
+            {
+                results.push_back(std::move(*metadata));
+            }
+        }
+        return results;
+    }
+
+    std::vector<ResourceMetadata> FileSystemResourceProvider::BuildIndex(ResourceIndexCache* cache) const
+    {
+        // Same namespace roots as ListResources("")
+        std::vector<std::pair<std::string, std::filesystem::path>> roots;
+        if (!m_namespaceMappings.empty())
+        {
+            for (const auto& [ns, path] : m_namespaceMappings)
+            {
+                if (std::filesystem::exists(path) && std::filesystem::is_directory(path))
+                {
+                    roots.emplace_back(ns, path);
+                }
+            }
+        }
+        else
+        {
+            for (const auto& entry : std::filesystem::directory_iterator(m_basePath))
+            {
+                if (entry.is_directory())
+                {
+                    roots.emplace_back(entry.path().filename().string(), entry.path());
+                }
+            }
+        }
+
+        // Without a persistent cache every directory is listed once, still with no per-file stat
+        ResourceIndexCache  scratch;
+        ResourceIndexCache& listings = cache ? *cache : scratch;
+
+        std::vector<ResourceMetadata> results;
+        for (const auto& [ns, root] : roots)
+        {
+            listings.ScanRoot(root, [&](const std::string& relativeDirectory, const ResourceIndexCache::DirectoryEntry& directory)
+            {
+                indexListedDirectory(root, ns, relativeDirectory, directory, results);
+            });
+        }
+        return results;
+    }
+
+    void FileSystemResourceProvider::indexListedDirectory(const std::filesystem::path& root, const std::string& namespace_id, const std::string& relativeDirectory,
+                                                          const ResourceIndexCache::DirectoryEntry& directory, std::vector<ResourceMetadata>& results) const
+    {
+        auto toLower = [](std::string text)
+        {
+            std::transform(text.begin(), text.end(), text.begin(), [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+            return text;
+        };
+
+        // Case-folded names, so "Stone.PNG" resolves like it does through exists() on Windows
+        std::unordered_map<std::string, const ResourceIndexCache::FileEntry*> filesByName;
+        filesByName.reserve(directory.files.size());
+        for (const ResourceIndexCache::FileEntry& file : directory.files)
+        {
+            filesByName.emplace(toLower(file.name), &file);
+        }
+
+        const std::filesystem::path directoryPath = relativeDirectory.empty() ? root : root / relativeDirectory;
+
+        std::unordered_set<std::string> seenStems;
+        for (const ResourceIndexCache::FileEntry& file : directory.files)
+        {
+            // Locations drop the extension, so "stone.png" and "stone.jpg" are one resource
+            const size_t      extensionPos = file.name.find_last_of('.');
+            const std::string stem         = extensionPos == std::string::npos ? file.name : file.name.substr(0, extensionPos);
+            if (stem.empty() || !seenStems.insert(stem).second)
+            {
+                continue;
+            }
+
+            // GetMetadata() order: the extensionless file, then each search extension in turn
+            const std::string                    stemKey = toLower(stem);
+            const ResourceIndexCache::FileEntry* chosen  = nullptr;
+            auto                                 exact   = filesByName.find(stemKey);
+            if (exact != filesByName.end())
+            {
+                chosen = exact->second;
+            }
+            for (size_t i = 0; chosen == nullptr && i < m_searchExtensions.size(); ++i)
+            {
+                auto hit = filesByName.find(stemKey + toLower(m_searchExtensions[i]));
+                if (hit != filesByName.end())
+                {
+                    chosen = hit->second;
+                }
+            }
+            if (chosen == nullptr)
+            {
+                continue;
+            }
+
+            try
+            {
+                ResourceMetadata metadata;
+                metadata.location     = ResourceLocation(namespace_id, relativeDirectory.empty() ? stem : relativeDirectory + "/" + stem);
+                metadata.filePath     = directoryPath / chosen->name;
+                metadata.fileSize     = chosen->size;
+                metadata.lastModified = ResourceIndexCache::TicksToFileTime(chosen->modifiedTicks);
+                metadata.type         = ResourceMetadata::DetectType(metadata.filePath);
+                results.push_back(std::move(metadata));
+            }
+            catch (const std::exception&)
+            {
+                // Ignore invalid resource locations
+            }
+        }
+    }
+
     void FileSystemResourceProvider::SetNamespaceMapping(const std::string& namespace_id, const std::filesystem::path& path)
     {
         m_namespaceMappings[namespace_id] = path;
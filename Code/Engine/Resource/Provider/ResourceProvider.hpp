@@ -1,5 +1,6 @@
 ﻿#pragma once
 #include "../ResourceMetadata.hpp"
+#include "../ResourceIndexCache.hpp"
 #include <vector>
 #include <unordered_map>
 
@@ -21,6 +22,9 @@ namespace enigma::resource
         virtual std::vector<uint8_t>            ReadResource(const ResourceLocation& location) = 0; // Read resource data
         virtual std::vector<ResourceLocation>   ListResources(const std::string& namespace_id = "", ResourceType type = ResourceType::UNKNOWN) const = 0; // List all resources
 
+        // Metadata of every resource in one pass; providers may reuse directory listings from the cache
+        virtual std::vector<ResourceMetadata> BuildIndex(ResourceIndexCache* cache) const;
+
         // Get priority (higher value, higher priority)
         virtual int GetPriority() const { return 0; }
     };
@@ -35,7 +39,7 @@ namespace enigma::resource
         std::optional<ResourceMetadata> GetMetadata(const ResourceLocation& location) const override;
         std::vector<uint8_t>            ReadResource(const ResourceLocation& location) override;
         std::vector<ResourceLocation>   ListResources(const std::string& namespace_id = "", ResourceType type = ResourceType::UNKNOWN) const override;
-
+        std::vector<ResourceMetadata>   BuildIndex(ResourceIndexCache* cache) const override;
 
         void SetNamespaceMapping(const std::string& namespace_id, const std::filesystem::path& path); // Set namespace mapping (optional)
         void SetSearchExtensions(const std::vector<std::string>& extensions); // Set the file extension for the search
@@ -54,6 +58,10 @@ namespace enigma::resource
         // Find resource by path (supports both with and without extension)
         std::optional<ResourceLocation> findResourceByPath(const ResourceLocation& location) const;
 
+        // Resolve one directory listing into metadata, choosing files the same way GetMetadata() does
+        void indexListedDirectory(const std::filesystem::path& root, const std::string& namespace_id, const std::string& relativeDirectory,
+                                  const ResourceIndexCache::DirectoryEntry& directory, std::vector<ResourceMetadata>& results) const;
+
         // Scan directory structure
         void scanDirectory(const std::filesystem::path& dir, const std::string& namespace_id, std::vector<ResourceLocation>& results, ResourceType filterType) const;
     };
@@ -0,0 +1,91 @@
+#include "ResourceCatalog.hpp"
+
+#include <algorithm>
+
+namespace enigma::resource
+{
+    namespace
+    {
+        bool HasPrefix(std::string_view text, std::string_view prefix)
+        {
+            return text.substr(0, prefix.size()) == prefix;
+        }
+
+        bool MatchesType(ResourceType wanted, ResourceType actual)
+        {
+            return wanted == ResourceType::UNKNOWN || wanted == actual;
+        }
+    }
+
+    void ResourceCatalog::Rebuild(const std::unordered_map<ResourceLocation, ResourceMetadata>& index)
+    {
+        m_entries.clear();
+        m_entries.reserve(index.size());
+        for (const auto& [location, metadata] : index)
+        {
+            m_entries.push_back({location.ToString(), location, metadata.type});
+        }
+
+        std::sort(m_entries.begin(), m_entries.end(), [](const Entry& a, const Entry& b)
+        {
+            return a.key < b.key;
+        });
+    }
+
+    size_t ResourceCatalog::FindPrefixBegin(std::string_view prefix) const
+    {
+        auto it = std::lower_bound(m_entries.begin(), m_entries.end(), prefix, [](const Entry& entry, std::string_view value)
+        {
+            return std::string_view(entry.key) < value;
+        });
+        return static_cast<size_t>(it - m_entries.begin());
+    }
+
+    size_t ResourceCatalog::Search(const ResourceGlob& glob, ResourceType type, std::vector<ResourceLocation>& outResults) const
+    {
+        const std::string_view prefix  = glob.GetLiteralPrefix();
+        size_t                 visited = 0;
+
+        for (size_t i = FindPrefixBegin(prefix); i < m_entries.size(); ++i)
+        {
+            const Entry& entry = m_entries[i];
+            if (!HasPrefix(entry.key, prefix))
+            {
+                break;
+            }
+
+            ++visited;
+            if (MatchesType(type, entry.type) && glob.Matches(entry.key))
+            {
+                outResults.push_back(entry.location);
+            }
+        }
+        return visited;
+    }
+
+    size_t ResourceCatalog::ListNamespace(std::string_view namespaceName, ResourceType type, std::vector<ResourceLocation>& outResults) const
+    {
+        std::string prefix(namespaceName);
+        if (!prefix.empty())
+        {
+            prefix += ':';
+        }
+
+        size_t visited = 0;
+        for (size_t i = FindPrefixBegin(prefix); i < m_entries.size(); ++i)
+        {
+            const Entry& entry = m_entries[i];
+            if (!HasPrefix(entry.key, prefix))
+            {
+                break;
+            }
+
+            ++visited;
+            if (MatchesType(type, entry.type))
+            {
+                outResults.push_back(entry.location);
+            }
+        }
+        return visited;
+    }
+}
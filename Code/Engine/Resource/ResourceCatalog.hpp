@@ -0,0 +1,46 @@
+#pragma once
+#include "ResourceMetadata.hpp"
+#include "ResourceGlob.hpp"
+
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace enigma::resource
+{
+    /**
+     * @brief Sorted "namespace:path" view of the resource index for range queries
+     *
+     * Searches binary-search the literal prefix of a glob (everything before its
+     * first wildcard) and only test keys inside that range, so
+     * "minecraft:textures/block/*" never looks at item textures, sounds or other
+     * namespaces. Namespace listings use the "namespace:" prefix the same way.
+     *
+     * The catalog is a snapshot: rebuild it whenever the index changes. It holds
+     * no lock of its own; ResourceSubsystem guards it with the index mutex.
+     */
+    class ResourceCatalog
+    {
+    public:
+        void   Rebuild(const std::unordered_map<ResourceLocation, ResourceMetadata>& index);
+        void   Clear() { m_entries.clear(); }
+        size_t GetSize() const { return m_entries.size(); }
+
+        /// Appends matches in key order; returns how many entries were visited
+        size_t Search(const ResourceGlob& glob, ResourceType type, std::vector<ResourceLocation>& outResults) const;
+        size_t ListNamespace(std::string_view namespaceName, ResourceType type, std::vector<ResourceLocation>& outResults) const;
+
+    private:
+        struct Entry
+        {
+            std::string      key; // "namespace:path"
+            ResourceLocation location;
+            ResourceType     type = ResourceType::UNKNOWN;
+        };
+
+        size_t FindPrefixBegin(std::string_view prefix) const;
+
+        std::vector<Entry> m_entries;
+    };
+}
@@ -0,0 +1,179 @@
+#include "ResourceGlob.hpp"
+
+namespace enigma::resource
+{
+    ResourceGlob::ResourceGlob(std::string_view pattern)
+        : m_pattern(pattern)
+    {
+        size_t i = 0;
+        while (i < m_pattern.size())
+        {
+            const char c = m_pattern[i];
+            if (c == '*')
+            {
+                size_t run = i;
+                while (run < m_pattern.size() && m_pattern[run] == '*')
+                {
+                    ++run;
+                }
+
+                if (run - i == 1)
+                {
+                    m_tokens.push_back({TokenKind::Star, 0, 0});
+                    i = run;
+                    continue;
+                }
+
+                // "**" owning a whole segment may swallow its trailing '/' too
+                const bool segmentStart = i == 0 || m_pattern[i - 1] == '/';
+                if (segmentStart && run < m_pattern.size() && m_pattern[run] == '/')
+                {
+                    m_tokens.push_back({TokenKind::GlobStarDir, 0, 0});
+                    i = run + 1;
+                }
+                else
+                {
+                    m_tokens.push_back({TokenKind::GlobStar, 0, 0});
+                    i = run;
+                }
+                continue;
+            }
+
+            if (c == '?')
+            {
+                m_tokens.push_back({TokenKind::AnyChar, 0, 0});
+                ++m_minLength;
+                ++i;
+                continue;
+            }
+
+            const size_t start = i;
+            while (i < m_pattern.size() && m_pattern[i] != '*' && m_pattern[i] != '?')
+            {
+                ++i;
+            }
+            m_tokens.push_back({TokenKind::Literal, static_cast<uint32_t>(start), static_cast<uint32_t>(i - start)});
+            m_minLength += i - start;
+        }
+
+        if (!m_tokens.empty() && m_tokens[0].kind == TokenKind::Literal)
+        {
+            m_prefixLength = m_tokens[0].length;
+        }
+    }
+
+    bool ResourceGlob::Matches(std::string_view text) const
+    {
+        if (text.size() < m_minLength)
+        {
+            return false;
+        }
+        return MatchTokens(text);
+    }
+
+    bool ResourceGlob::MatchTokens(std::string_view text) const
+    {
+        constexpr size_t kNone = static_cast<size_t>(-1);
+
+        size_t tokenIndex = 0;
+        size_t position   = 0;
+
+        // Most recent '*': token to resume after it and the text position it currently ends at
+        size_t starResume = kNone;
+        size_t starEnd    = 0;
+
+        // Most recent '**' / '**/': same, plus whether it may only end just past a '/'
+        size_t globResume = kNone;
+        size_t globEnd    = 0;
+        bool   globDir    = false;
+
+        for (;;)
+        {
+            if (tokenIndex < m_tokens.size())
+            {
+                const Token& token   = m_tokens[tokenIndex];
+                bool         advance = false;
+                switch (token.kind)
+                {
+                case TokenKind::Literal:
+                    advance = text.size() - position >= token.length &&
+                        text.substr(position, token.length) == std::string_view(m_pattern.data() + token.offset, token.length);
+                    if (advance)
+                    {
+                        position += token.length;
+                    }
+                    break;
+                case TokenKind::AnyChar:
+                    advance = position < text.size() && text[position] != '/';
+                    if (advance)
+                    {
+                        ++position;
+                    }
+                    break;
+                case TokenKind::Star:
+                    starResume = tokenIndex + 1;
+                    starEnd    = position;
+                    advance    = true;
+                    break;
+                case TokenKind::GlobStar:
+                case TokenKind::GlobStarDir:
+                    if (token.kind == TokenKind::GlobStar && tokenIndex + 1 == m_tokens.size())
+                    {
+                        return true;
+                    }
+                    // Earlier wildcards never need to move again: this one absorbs anything they could
+                    globResume = tokenIndex + 1;
+                    globEnd    = position;
+                    globDir    = token.kind == TokenKind::GlobStarDir;
+                    starResume = kNone;
+                    advance    = true;
+                    break;
+                }
+
+                if (advance)
+                {
+                    ++tokenIndex;
+                    continue;
+                }
+            }
+            else if (position == text.size())
+            {
+                return true;
+            }
+
+            // Mismatch: let the last '*' eat one more character of its segment
+            if (starResume != kNone && starEnd < text.size() && text[starEnd] != '/')
+            {
+                tokenIndex = starResume;
+                position   = ++starEnd;
+                continue;
+            }
+            starResume = kNone;
+
+            // The '*' hit a segment end: move the last '**' forward (a whole '**/' to the next segment)
+            if (globResume == kNone)
+            {
+                return false;
+            }
+            if (globDir)
+            {
+                const size_t slash = text.find('/', globEnd);
+                if (slash == std::string_view::npos)
+                {
+                    return false;
+                }
+                globEnd = slash + 1;
+            }
+            else
+            {
+                if (globEnd >= text.size())
+                {
+                    return false;
+                }
+                ++globEnd;
+            }
+            tokenIndex = globResume;
+            position   = globEnd;
+        }
+    }
+}
@@ -0,0 +1,65 @@
+#pragma once
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace enigma::resource
+{
+    /**
+     * @brief Glob pattern compiled once and matched without allocating
+     *
+     * Syntax, matched against "namespace:path" keys or bare paths:
+     * - `?`   one character other than '/'
+     * - `*`   any run of characters inside one path segment (never crosses '/')
+     * - `**`  any run of characters, including '/'
+     *
+     * A `**` that is a whole path segment may also match zero directories, so
+     * textures/`**`/stone.png matches both "textures/stone.png" and
+     * "textures/block/stone.png".
+     *
+     * Every other character is literal. The literal prefix up to the first
+     * wildcard is exposed so sorted catalogs can narrow a search to a key range.
+     *
+     * Matching is iterative and O(pattern * text) in the worst case: a `*`
+     * backtracks inside its segment only, and once it runs into a '/' the most
+     * recent `**` advances instead (one segment at a time for `**`/).
+     */
+    class ResourceGlob
+    {
+    public:
+        ResourceGlob() = default;
+        explicit ResourceGlob(std::string_view pattern);
+
+        bool Matches(std::string_view text) const;
+
+        const std::string& GetPattern() const { return m_pattern; }
+        std::string_view   GetLiteralPrefix() const { return std::string_view(m_pattern).substr(0, m_prefixLength); }
+        bool               IsLiteral() const { return m_tokens.size() <= 1 && m_prefixLength == m_pattern.size(); }
+        bool               MatchesEverything() const { return m_tokens.size() == 1 && m_tokens[0].kind == TokenKind::GlobStar; }
+
+    private:
+        enum class TokenKind : uint8_t
+        {
+            Literal,
+            AnyChar,
+            Star,
+            GlobStar,
+            GlobStarDir // "**/" at a segment start: empty, or anything ending in '/'
+        };
+
+        struct Token
+        {
+            TokenKind kind   = TokenKind::Literal;
+            uint32_t  offset = 0; // Literal text inside m_pattern
+            uint32_t  length = 0;
+        };
+
+        bool MatchTokens(std::string_view text) const;
+
+        std::string        m_pattern;
+        std::vector<Token> m_tokens;
+        size_t             m_prefixLength = 0;
+        size_t             m_minLength    = 0; // Characters every match needs at least
+    };
+}
@@ -0,0 +1,294 @@
+#include "ResourceIndexCache.hpp"
+
+#include "Engine/Core/MappedFile.hpp"
+#include "Engine/Core/Buffer/ByteBuffer.hpp"
+#include "Engine/Core/Buffer/ByteBufferView.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <system_error>
+
+using namespace enigma::core;
+
+namespace enigma::resource
+{
+    namespace
+    {
+        constexpr uint32_t INDEX_CACHE_MAGIC   = 0x58444952; // "RIDX"
+        constexpr uint32_t INDEX_CACHE_VERSION = 1;
+
+        // A directory changed this recently may change again within the same mtime tick
+        constexpr auto RACY_MTIME_WINDOW = std::chrono::seconds(2);
+
+        std::string MakeRootKey(const std::filesystem::path& root)
+        {
+            std::error_code ec;
+            std::filesystem::path absolute = std::filesystem::absolute(root, ec);
+            return (ec ? root : absolute).lexically_normal().generic_string();
+        }
+    }
+
+    std::filesystem::file_time_type ResourceIndexCache::TicksToFileTime(int64_t ticks)
+    {
+        return std::filesystem::file_time_type(std::filesystem::file_time_type::duration(ticks));
+    }
+
+    bool ResourceIndexCache::Load(const std::filesystem::path& cacheFile)
+    {
+        Clear();
+
+        MappedFile file;
+        if (!file.Open(cacheFile))
+        {
+            return false;
+        }
+
+        std::unordered_map<std::string, RootEntry> roots;
+        try
+        {
+            ByteBufferView reader(file.GetData(), file.GetSize());
+            if (reader.ReadUnsignedInt() != INDEX_CACHE_MAGIC || reader.ReadUnsignedInt() != INDEX_CACHE_VERSION)
+            {
+                return false;
+            }
+
+            const uint32_t rootCount = reader.ReadVarUnsignedInt();
+            for (uint32_t r = 0; r < rootCount; ++r)
+            {
+                RootEntry&     root           = roots[reader.ReadString()];
+                const uint32_t directoryCount = reader.ReadVarUnsignedInt();
+                root.directories.reserve(directoryCount);
+
+                for (uint32_t d = 0; d < directoryCount; ++d)
+                {
+                    std::string    relative  = reader.ReadString();
+                    DirectoryEntry directory;
+                    directory.modifiedTicks = reader.ReadLong();
+
+                    directory.subdirectories.resize(reader.ReadVarUnsignedInt());
+                    for (std::string& name : directory.subdirectories)
+                    {
+                        name = reader.ReadString();
+                    }
+
+                    directory.files.resize(reader.ReadVarUnsignedInt());
+                    for (FileEntry& entry : directory.files)
+                    {
+                        entry.name          = reader.ReadString();
+                        entry.size          = reader.ReadVarUnsignedLong();
+                        entry.modifiedTicks = reader.ReadLong();
+                    }
+
+                    root.directories.emplace(std::move(relative), std::move(directory));
+                }
+            }
+
+            // Trailer guards against a file cut short exactly on a record boundary
+            if (reader.ReadUnsignedInt() != INDEX_CACHE_MAGIC)
+            {
+                return false;
+            }
+        }
+        catch (const std::exception&)
+        {
+            return false; // Truncated or corrupt: the next scan is a full walk
+        }
+
+        m_roots                = std::move(roots);
+        m_stats.loadedFromDisk = true;
+        return true;
+    }
+
+    bool ResourceIndexCache::Save(const std::filesystem::path& cacheFile)
+    {
+        ByteBuffer writer;
+        writer.WriteUnsignedInt(INDEX_CACHE_MAGIC);
+        writer.WriteUnsignedInt(INDEX_CACHE_VERSION);
+
+        uint32_t rootCount = 0;
+        for (const auto& [key, root] : m_roots)
+        {
+            rootCount += root.touched ? 1 : 0;
+        }
+        writer.WriteVarUnsignedInt(rootCount);
+
+        for (const auto& [key, root] : m_roots)
+        {
+            if (!root.touched)
+            {
+                continue;
+            }
+
+            writer.WriteString(key);
+            writer.WriteVarUnsignedInt(static_cast<uint32_t>(root.directories.size()));
+            for (const auto& [relative, directory] : root.directories)
+            {
+                writer.WriteString(relative);
+                writer.WriteLong(directory.modifiedTicks);
+
+                writer.WriteVarUnsignedInt(static_cast<uint32_t>(directory.subdirectories.size()));
+                for (const std::string& name : directory.subdirectories)
+                {
+                    writer.WriteString(name);
+                }
+
+                writer.WriteVarUnsignedInt(static_cast<uint32_t>(directory.files.size()));
+                for (const FileEntry& entry : directory.files)
+                {
+                    writer.WriteString(entry.name);
+                    writer.WriteVarUnsignedLong(entry.size);
+                    writer.WriteLong(entry.modifiedTicks);
+                }
+            }
+        }
+        writer.WriteUnsignedInt(INDEX_CACHE_MAGIC);
+
+        // Write a sibling temp file and rename it over the old cache so readers never see half a file
+        std::error_code ec;
+        if (cacheFile.has_parent_path())
+        {
+            std::filesystem::create_directories(cacheFile.parent_path(), ec);
+        }
+
+        std::filesystem::path tempFile = cacheFile;
+        tempFile += ".tmp";
+        {
+            std::ofstream out(tempFile, std::ios::binary | std::ios::trunc);
+            if (!out)
+            {
+                return false;
+            }
+            out.write(reinterpret_cast<const char*>(writer.Data()), static_cast<std::streamsize>(writer.WrittenBytes()));
+            if (!out)
+            {
+                return false;
+            }
+        }
+
+        std::filesystem::rename(tempFile, cacheFile, ec);
+        if (ec)
+        {
+            std::filesystem::remove(tempFile, ec);
+            return false;
+        }
+
+        m_dirty = false;
+        return true;
+    }
+
+    void ResourceIndexCache::Clear()
+    {
+        m_roots.clear();
+        m_stats = ResourceIndexCacheStats();
+        m_dirty = false;
+    }
+
+    void ResourceIndexCache::ResetStats()
+    {
+        const bool loadedFromDisk = m_stats.loadedFromDisk;
+        m_stats                   = ResourceIndexCacheStats();
+        m_stats.loadedFromDisk    = loadedFromDisk;
+    }
+
+    bool ResourceIndexCache::ListDirectory(const std::filesystem::path& directory, DirectoryEntry& outEntry)
+    {
+        std::error_code ec;
+        for (std::filesystem::directory_iterator it(directory, ec), end; !ec && it != end; it.increment(ec))
+        {
+            const std::filesystem::directory_entry& entry = *it;
+            std::error_code                         entryEc;
+
+            if (entry.is_directory(entryEc))
+            {
+                outEntry.subdirectories.push_back(entry.path().filename().generic_string());
+            }
+            else if (entry.is_regular_file(entryEc))
+            {
+                // directory_entry caches size and time from the listing on Windows, so this is not a stat per file
+                FileEntry file;
+                file.name          = entry.path().filename().generic_string();
+                file.size          = entry.file_size(entryEc);
+                file.modifiedTicks = static_cast<int64_t>(entry.last_write_time(entryEc).time_since_epoch().count());
+                outEntry.files.push_back(std::move(file));
+            }
+        }
+
+        std::sort(outEntry.subdirectories.begin(), outEntry.subdirectories.end());
+        std::sort(outEntry.files.begin(), outEntry.files.end(), [](const FileEntry& a, const FileEntry& b)
+        {
+            return a.name < b.name;
+        });
+        return !ec;
+    }
+
+    void ResourceIndexCache::ScanRoot(const std::filesystem::path& root, const DirectoryVisitor& visitor)
+    {
+        const std::string key    = MakeRootKey(root);
+        auto              cached = m_roots.find(key);
+        const auto        now    = std::filesystem::file_time_type::clock::now();
+
+        RootEntry next;
+        next.touched = true;
+
+        std::vector<std::string> pending = {std::string()};
+        while (!pending.empty())
+        {
+            std::string relative = std::move(pending.back());
+            pending.pop_back();
+
+            const std::filesystem::path directoryPath = relative.empty() ? root : root / relative;
+
+            std::error_code ec;
+            const auto      modified = std::filesystem::last_write_time(directoryPath, ec);
+            if (ec)
+            {
+                m_dirty = true; // Vanished since its parent was listed
+                continue;
+            }
+
+            const int64_t  ticks = static_cast<int64_t>(modified.time_since_epoch().count());
+            DirectoryEntry directory;
+
+            bool reused = false;
+            if (cached != m_roots.end())
+            {
+                auto hit = cached->second.directories.find(relative);
+                if (hit != cached->second.directories.end() && hit->second.modifiedTicks != 0 && hit->second.modifiedTicks == ticks)
+                {
+                    directory = std::move(hit->second);
+                    reused    = true;
+                }
+            }
+
+            if (reused)
+            {
+                ++m_stats.directoriesReused;
+                m_stats.filesReused += directory.files.size();
+            }
+            else
+            {
+                ListDirectory(directoryPath, directory);
+                directory.modifiedTicks = now - modified < RACY_MTIME_WINDOW ? 0 : ticks;
+                ++m_stats.directoriesScanned;
+                m_stats.filesScanned += directory.files.size();
+                m_dirty = true;
+            }
+
+            visitor(relative, directory);
+
+            for (const std::string& name : directory.subdirectories)
+            {
+                pending.push_back(relative.empty() ? name : relative + "/" + name);
+            }
+            next.directories.emplace(std::move(relative), std::move(directory));
+        }
+
+        // Directories that disappeared are simply not carried over
+        if (cached != m_roots.end() && cached->second.directories.size() != next.directories.size())
+        {
+            m_dirty = true;
+        }
+        m_roots[key] = std::move(next);
+    }
+}
@@ -0,0 +1,85 @@
+#pragma once
+#include <cstdint>
+#include <filesystem>
+#include <functional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace enigma::resource
+{
+    struct ResourceIndexCacheStats
+    {
+        bool   loadedFromDisk     = false; // Load() accepted an existing cache file
+        size_t directoriesReused  = 0; // Listing taken from the cache, mtime unchanged
+        size_t directoriesScanned = 0; // Listing read from disk
+        size_t filesReused        = 0;
+        size_t filesScanned       = 0;
+    };
+
+    /**
+     * @brief Persistent directory listings used to skip unchanged parts of a resource scan
+     *
+     * For every provider root the cache stores each directory's mtime together
+     * with its file names, sizes and mtimes and its subdirectory names. ScanRoot()
+     * walks the tree, stats only directories, and reuses the stored listing of
+     * every directory whose mtime did not change; adding, removing or renaming an
+     * entry bumps the mtime of its parent directory, so only those directories
+     * are listed again. Edits to a file's contents do not touch the directory,
+     * which means cached file sizes/mtimes can lag behind until the next listing.
+     *
+     * Directories modified within the last few seconds are stored as "always
+     * rescan", since a later change in the same mtime tick would be invisible.
+     * A missing, truncated or outdated cache file loads as empty, which turns the
+     * next scan into a full walk.
+     *
+     * Not thread-safe; the owner serializes access.
+     */
+    class ResourceIndexCache
+    {
+    public:
+        struct FileEntry
+        {
+            std::string name;
+            uint64_t    size          = 0;
+            int64_t     modifiedTicks = 0; // std::filesystem::file_time_type ticks
+        };
+
+        struct DirectoryEntry
+        {
+            int64_t                  modifiedTicks = 0; // 0 = rescan next time
+            std::vector<std::string> subdirectories;
+            std::vector<FileEntry>   files;
+        };
+
+        /// Called once per directory, with its '/'-separated path relative to the root ("" for the root itself)
+        using DirectoryVisitor = std::function<void(const std::string& relativeDirectory, const DirectoryEntry& directory)>;
+
+        bool Load(const std::filesystem::path& cacheFile);
+        bool Save(const std::filesystem::path& cacheFile);
+        void Clear();
+        bool IsEmpty() const { return m_roots.empty(); }
+        bool IsDirty() const { return m_dirty; }
+
+        /// Walks a provider root, re-listing only directories whose mtime changed since the cached snapshot
+        void ScanRoot(const std::filesystem::path& root, const DirectoryVisitor& visitor);
+
+        const ResourceIndexCacheStats& GetStats() const { return m_stats; }
+        void                           ResetStats();
+
+        static std::filesystem::file_time_type TicksToFileTime(int64_t ticks);
+
+    private:
+        struct RootEntry
+        {
+            std::unordered_map<std::string, DirectoryEntry> directories; // Keyed by relative directory
+            bool                                            touched = false; // Scanned since Load(); untouched roots are dropped on Save()
+        };
+
+        static bool ListDirectory(const std::filesystem::path& directory, DirectoryEntry& outEntry);
+
+        std::unordered_map<std::string, RootEntry> m_roots; // Keyed by normalized absolute root path
+        ResourceIndexCacheStats                    m_stats;
+        bool                                       m_dirty = false;
+    };
+}
@@ -18,6 +18,7 @@ namespace enigma::resource
         virtual std::set<std::string> GetSupportedExtensions() const = 0; // Get supported file extensions
         virtual std::string           GetLoaderName() const = 0; // Get the loader name
         virtual int                   GetPriority() const { return 0; } // Get priority (higher value, higher priority)
+        virtual bool                  IsThreadSafe() const { return false; } // Load() may run on resource worker threads during preload
 
         // Check if this resource can be loaded
         virtual bool CanLoad(const ResourceMetadata& metadata) const
@@ -9,7 +9,6 @@
 #include "BlockState/BlockStateLoader.hpp"
 #include <iostream>
 #include <algorithm>
-#include <regex>
 #include <thread>
 #include <set>
 
@@ -155,6 +154,7 @@ void ResourceSubsystem::Shutdown()
     {
         std::unique_lock<std::shared_mutex> lock(m_indexMutex);
         m_resourceIndex.clear();
+        m_resourceCatalog.Clear();
     }
 
     m_state = SubsystemState::UNINITIALIZED;
@@ -321,39 +321,20 @@ std::vector<ResourceLocation> ResourceSubsystem::ListResources(const std::string
 {
     std::vector<ResourceLocation>       results;
     std::shared_lock<std::shared_mutex> lock(m_indexMutex);
-
-    for (const auto& [location, metadata] : m_resourceIndex)
-    {
-        bool matchNamespace = namespaceName.empty() || location.GetNamespace() == namespaceName;
-        bool matchType      = type == ResourceType::UNKNOWN || metadata.type == type;
-
-        if (matchNamespace && matchType)
-        {
-            results.push_back(location);
-        }
-    }
-
+    m_resourceCatalog.ListNamespace(namespaceName, type, results);
     return results;
 }
 
 std::vector<ResourceLocation> ResourceSubsystem::SearchResources(const std::string& pattern, ResourceType type) const
+{
+    return SearchResources(ResourceGlob(pattern), type);
+}
+
+std::vector<ResourceLocation> ResourceSubsystem::SearchResources(const ResourceGlob& glob, ResourceType type) const
 {
     std::vector<ResourceLocation>       results;
     std::shared_lock<std::shared_mutex> lock(m_indexMutex);
-
-    for (const auto& [location, metadata] : m_resourceIndex)
-    {
-        if (type != ResourceType::UNKNOWN && metadata.type != type)
-        {
-            continue;
-        }
-
-        if (MatchesPattern(location.ToString(), pattern))
-        {
-            results.push_back(location);
-        }
-    }
-
+    m_resourceCatalog.Search(glob, type, results);
     return results;
 }
 
@@ -431,6 +412,9 @@ void ResourceSubsystem::ScanNamespace(const std::string& namespaceName)
             }
         }
     }
+
+    std::unique_lock<std::shared_mutex> indexLock(m_indexMutex);
+    m_resourceCatalog.Rebuild(m_resourceIndex);
 }
 
 /**
@@ -625,8 +609,7 @@ ResourcePtr ResourceSubsystem::LoadResourceInternal(const ResourceLocation& loca
     }
 
     // Read data
-    auto data                        = provider->ReadResource(location);
-    m_perfStats.bytesLoadedThisFrame += data.size();
+    auto data = provider->ReadResource(location);
 
     if (m_config.logResourceLoads)
     {
@@ -657,7 +640,12 @@ ResourcePtr ResourceSubsystem::LoadResourceInternal(const ResourceLocation& loca
     // Load resource
     ResourcePtr resource = loader->Load(*metadataOpt, data);
 
-    // Store resource in preloaded resources (if not already there)
+    // File modification time for hot reload, read before taking the lock
+    std::error_code                 timeError;
+    std::filesystem::file_time_type modifiedTime = std::filesystem::last_write_time(metadataOpt->filePath, timeError);
+
+    // Store resource in preloaded resources (if not already there). Load workers run this
+    // concurrently during preload, so every shared member is updated under the lock.
     {
         std::unique_lock<std::shared_mutex> lock(m_resourceMutex);
         if (m_loadedResources.find(location) == m_loadedResources.end())
@@ -665,12 +653,12 @@ ResourcePtr ResourceSubsystem::LoadResourceInternal(const ResourceLocation& loca
             m_loadedResources[location] = resource;
             m_totalLoaded.fetch_add(1);
         }
-    }
 
-    // Update file modification time for hot reload
-    if (std::filesystem::exists(metadataOpt->filePath))
-    {
-        m_fileModificationTimes[location] = std::filesystem::last_write_time(metadataOpt->filePath);
+        if (!timeError)
+        {
+            m_fileModificationTimes[location] = modifiedTime;
+        }
+        m_perfStats.bytesLoadedThisFrame += data.size();
     }
 
     return resource;
@@ -681,20 +669,44 @@ void ResourceSubsystem::UpdateResourceIndex()
     std::unique_lock<std::shared_mutex> indexLock(m_indexMutex);
     std::shared_lock<std::shared_mutex> providerLock(m_providerMutex);
 
+    const auto scanStart = std::chrono::steady_clock::now();
+
+    // Directory listings from the last launch; a missing or invalid file means a full walk
+    const bool useIndexCache = m_config.enableIndexCache;
+    if (useIndexCache && m_indexCache.IsEmpty())
+    {
+        m_indexCache.Load(m_config.indexCachePath);
+    }
+    m_indexCache.ResetStats();
+
     m_resourceIndex.clear();
 
     for (const auto& provider : m_resourceProviders)
     {
-        auto resources = provider->ListResources();
-        for (const auto& location : resources)
+        for (auto& metadata : provider->BuildIndex(useIndexCache ? &m_indexCache : nullptr))
         {
-            auto metadata = provider->GetMetadata(location);
-            if (metadata)
-            {
-                m_resourceIndex[location] = *metadata;
-            }
+            ResourceLocation location = metadata.location;
+            m_resourceIndex[location] = std::move(metadata);
         }
     }
+
+    m_resourceCatalog.Rebuild(m_resourceIndex);
+
+    if (useIndexCache && m_indexCache.IsDirty() && !m_indexCache.Save(m_config.indexCachePath))
+    {
+        std::cerr << "[ResourceSubsystem] Failed to write resource index cache: " << m_config.indexCachePath << '\n';
+    }
+
+    m_lastIndexScan.scanMs        = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - scanStart).count();
+    m_lastIndexScan.resourceCount = m_resourceIndex.size();
+    m_lastIndexScan.cache         = m_indexCache.GetStats();
+
+    if (m_config.printScanResults)
+    {
+        std::cout << "[ResourceSubsystem] Indexed " << m_lastIndexScan.resourceCount << " resources in " << m_lastIndexScan.scanMs
+            << " ms (" << m_lastIndexScan.cache.directoriesReused << " directories from cache, "
+            << m_lastIndexScan.cache.directoriesScanned << " rescanned)." << '\n';
+    }
 }
 
 std::shared_ptr<IResourceProvider> ResourceSubsystem::FindProviderForResource(
@@ -713,72 +725,134 @@ std::shared_ptr<IResourceProvider> ResourceSubsystem::FindProviderForResource(
     return nullptr;
 }
 
-bool ResourceSubsystem::MatchesPattern(const std::string& str, const std::string& pattern) const
+void ResourceSubsystem::PreloadAllDiscoveredResources()
 {
-    // Simple wildcard matching
-    std::string regexPattern = pattern;
+    // Resources whose loader is thread-safe (image decode dominates startup) go to the load
+    // workers; everything else loads here in the meantime
+    std::vector<ResourceLocation> serialLoads;
+    std::vector<ResourceLocation> workerLoads;
+    const bool                    useWorkers = m_config.enableParallelLoading && !m_workerThreads.empty();
 
-    // Escape special characters
-    regexPattern = std::regex_replace(regexPattern, std::regex("\\."), "\\.");
-    regexPattern = std::regex_replace(regexPattern, std::regex("\\+"), "\\+");
+    {
+        std::shared_lock<std::shared_mutex> lock(m_indexMutex);
+        for (const auto& [location, metadata] : m_resourceIndex)
+        {
+            ResourceLoaderPtr loader = useWorkers ? m_loaderRegistry.FindLoaderForResource(metadata) : nullptr;
+            if (loader && loader->IsThreadSafe())
+            {
+                workerLoads.push_back(location);
+            }
+            else
+            {
+                serialLoads.push_back(location);
+            }
+        }
+    }
 
-    // Convert wildcards
-    regexPattern = std::regex_replace(regexPattern, std::regex("\\*"), ".*");
-    regexPattern = std::regex_replace(regexPattern, std::regex("\\?"), ".");
+    m_lastPreload = PreloadStats();
+    const size_t total = serialLoads.size() + workerLoads.size();
+    if (total == 0)
+    {
+        return;
+    }
 
-    std::regex re(regexPattern);
-    return std::regex_match(str, re);
-}
+    if (m_config.logResourceLoads)
+    {
+        std::cout << "[ResourceSubsystem] Preloading all " << total
+            << " discovered resources (" << workerLoads.size() << " on worker threads)..." << std::endl;
+    }
 
-void ResourceSubsystem::PreloadAllDiscoveredResources()
-{
-    std::vector<ResourceLocation> toPreload;
+    const auto preloadStart = std::chrono::steady_clock::now();
 
+    std::vector<std::future<ResourcePtr>> workerResults;
+    workerResults.reserve(workerLoads.size());
     {
-        std::shared_lock<std::shared_mutex> lock(m_indexMutex);
-        for (const auto& [location, metadata] : m_resourceIndex)
+        std::lock_guard<std::mutex> lock(m_queueMutex);
+        for (const ResourceLocation& location : workerLoads)
         {
-            toPreload.push_back(location);
+            LoadRequest request;
+            request.location    = location;
+            request.requestTime = preloadStart;
+            workerResults.push_back(request.promise.get_future());
+            m_loadQueue.push(std::move(request));
         }
     }
+    m_queueCV.notify_all();
 
-    if (!toPreload.empty())
+    size_t loaded = 0;
+    auto   reportFailure = [this](const ResourceLocation& location, const std::exception& e)
     {
         if (m_config.logResourceLoads)
         {
-            std::cout << "[ResourceSubsystem] Preloading all " << toPreload.size()
-                << " discovered resources..." << std::endl;
+            std::cout << "[ResourceSubsystem] Failed to load resource: " << location.ToString() << " - " << e.what() << std::endl;
         }
+    };
 
-        size_t loaded = 0;
-        size_t total  = toPreload.size();
-
-        for (const auto& location : toPreload)
+    for (const auto& location : serialLoads)
+    {
+        try
         {
-            try
-            {
-                auto resource = LoadResourceInternal(location);
-                loaded++;
+            auto resource = LoadResourceInternal(location);
+            loaded++;
 
-                if (m_config.logResourceLoads && loaded % 10 == 0)
-                {
-                    std::cout << "[ResourceSubsystem] Loaded " << loaded << "/" << total << " resources" << std::endl;
-                }
+            if (m_config.logResourceLoads && loaded % 10 == 0)
+            {
+                std::cout << "[ResourceSubsystem] Loaded " << loaded << "/" << total << " resources" << std::endl;
             }
-            catch (const std::exception& e)
+        }
+        catch (const std::exception& e)
+        {
+            reportFailure(location, e);
+        }
+    }
+
+    // Help the workers drain the queue rather than blocking on the first future
+    while (true)
+    {
+        LoadRequest request;
+        {
+            std::lock_guard<std::mutex> lock(m_queueMutex);
+            if (m_loadQueue.empty())
             {
-                if (m_config.logResourceLoads)
-                {
-                    std::cout << "[ResourceSubsystem] Failed to load resource: " << location.ToString() << " - " << e.what() << std::endl;
-                }
+                break;
             }
+            request = std::move(m_loadQueue.front());
+            m_loadQueue.pop();
         }
 
-        if (m_config.logResourceLoads)
+        try
+        {
+            request.promise.set_value(LoadResourceInternal(request.location));
+        }
+        catch (const std::exception&)
         {
-            std::cout << "[ResourceSubsystem] Preloading complete. Loaded " << loaded << "/" << total << " resources." << std::endl;
+            request.promise.set_exception(std::current_exception());
         }
     }
+
+    for (size_t i = 0; i < workerResults.size(); ++i)
+    {
+        try
+        {
+            workerResults[i].get();
+            loaded++;
+        }
+        catch (const std::exception& e)
+        {
+            reportFailure(workerLoads[i], e);
+        }
+    }
+
+    m_lastPreload.preloadMs       = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - preloadStart).count();
+    m_lastPreload.resourceCount   = loaded;
+    m_lastPreload.failedCount     = total - loaded;
+    m_lastPreload.decodedOnWorker = workerLoads.size();
+
+    if (m_config.logResourceLoads)
+    {
+        std::cout << "[ResourceSubsystem] Preloading complete. Loaded " << loaded << "/" << total << " resources in "
+            << m_lastPreload.preloadMs << " ms." << std::endl;
+    }
 }
 
 void ResourceSubsystem::UpdateFrameStatistics()
@@ -3,6 +3,7 @@
 #include "Provider/ResourceProvider.hpp"
 #include "ResourceLoader.hpp"
 #include "ResourceMapper.hpp"
+#include "ResourceCatalog.hpp"
 #include "../Core/SubsystemManager.hpp"
 #include <mutex>
 #include <shared_mutex>
@@ -55,6 +56,10 @@ namespace enigma::resource
         bool  compressCache          = false;
         float cacheEvictionThreshold = 0.9f; // Start eviction when 90% full
 
+        // Index cache configuration: directory listings persisted between launches
+        bool                  enableIndexCache = true;
+        std::filesystem::path indexCachePath   = ".enigma/cache/resource_index.bin";
+
         // Debug configuration
         bool logResourceLoads          = false;
         bool logCacheMisses            = false;
@@ -152,6 +157,7 @@ namespace enigma::resource
         void Startup() override;
         void Shutdown() override;
         bool RequiresGameLoop() const override { return false; }
+        bool CanStartOffMainThread() const override { return true; } // Scan, preload and atlas build are CPU/file work only
 
         /// Update for resource management (hot reload, async loading, etc.)
         void Update(); // Called manually when needed, not part of game loop
@@ -183,7 +189,9 @@ namespace enigma::resource
         /// Resource Queries
         std::optional<ResourceMetadata> GetMetadata(const ResourceLocation& location) const;
         std::vector<ResourceLocation>   ListResources(const std::string& namespaceName = "", ResourceType type = ResourceType::UNKNOWN) const;
-        std::vector<ResourceLocation>   SearchResources(const std::string& pattern, ResourceType type = ResourceType::UNKNOWN) const;
+        /// Glob search over "namespace:path": `*` stays inside a segment, `**` crosses '/', `?` is one character
+        std::vector<ResourceLocation> SearchResources(const std::string& pattern, ResourceType type = ResourceType::UNKNOWN) const;
+        std::vector<ResourceLocation> SearchResources(const ResourceGlob& glob, ResourceType type = ResourceType::UNKNOWN) const;
 
         /// Resource Management
         void ClearAllResources();
@@ -231,6 +239,25 @@ namespace enigma::resource
 
         PerformanceStats GetPerformanceStats() const { return m_perfStats; }
 
+        struct IndexScanStats
+        {
+            double                  scanMs        = 0.0;
+            size_t                  resourceCount = 0;
+            ResourceIndexCacheStats cache;
+        };
+
+        IndexScanStats GetLastIndexScanStats() const { return m_lastIndexScan; }
+
+        struct PreloadStats
+        {
+            double preloadMs       = 0.0;
+            size_t resourceCount   = 0; // Resources that loaded successfully
+            size_t failedCount     = 0;
+            size_t decodedOnWorker = 0; // Handed to the load workers (thread-safe loaders only)
+        };
+
+        PreloadStats GetLastPreloadStats() const { return m_lastPreload; }
+
         /// Resource Mapping
         ResourceMapper&       GetResourceMapper() { return m_resourceMapper; }
         const ResourceMapper& GetResourceMapper() const { return m_resourceMapper; }
@@ -245,7 +272,6 @@ namespace enigma::resource
         ResourcePtr                        LoadResourceInternal(const ResourceLocation& location);
         void                               UpdateResourceIndex();
         std::shared_ptr<IResourceProvider> FindProviderForResource(const ResourceLocation& location) const;
-        bool                               MatchesPattern(const std::string& str, const std::string& pattern) const;
         void                               UpdateFrameStatistics();
         bool                               ShouldStopLoadingThisFrame() const;
         void                               PreloadAllDiscoveredResources();
@@ -268,6 +294,10 @@ namespace enigma::resource
         // Resource index (all discovered resources)
         mutable std::shared_mutex                              m_indexMutex;
         std::unordered_map<ResourceLocation, ResourceMetadata> m_resourceIndex;
+        ResourceCatalog                                        m_resourceCatalog; // Sorted view of m_resourceIndex, rebuilt with it
+        ResourceIndexCache                                     m_indexCache; // Guarded by m_indexMutex as well
+        IndexScanStats                                         m_lastIndexScan;
+        PreloadStats                                           m_lastPreload;
 
         // Preloaded resources storage
         mutable std::shared_mutex                         m_resourceMutex;
@@ -18,20 +18,312 @@ namespace enigma::voxel
 
     std::shared_ptr<Biome> MultiNoiseBiomeSource::GetBiome(int x, int y, int z) const
     {
-        // 步骤1: 使用Climate::Sampler采样当前位置的气候参数
+        // 算术右移对负坐标同样向下取整,与Minecraft的QuartPos.fromBlock一致
+        return GetBiomeAtQuart(x >> 2, y >> 2, z >> 2);
+    }
+
+    size_t MultiNoiseBiomeSource::QuartKeyHash::operator()(const QuartKey& key) const noexcept
+    {
+        // 三个坐标完整参与64位混合(splitmix64终结器),相等性由QuartKey::operator==保证
+        uint64_t h = static_cast<uint64_t>(static_cast<uint32_t>(key.x));
+        h          = h * 0x9E3779B97F4A7C15ull ^ static_cast<uint64_t>(static_cast<uint32_t>(key.y));
+        h          = h * 0x9E3779B97F4A7C15ull ^ static_cast<uint64_t>(static_cast<uint32_t>(key.z));
+        h ^= h >> 30;
+        h *= 0xBF58476D1CE4E5B9ull;
+        h ^= h >> 27;
+        h *= 0x94D049BB133111EBull;
+        h ^= h >> 31;
+        return static_cast<size_t>(h);
+    }
+
+    std::shared_ptr<Biome> MultiNoiseBiomeSource::GetBiomeAtQuart(int quartX, int quartY, int quartZ) const
+    {
+        if (m_parameterList.empty())
+        {
+            return nullptr;
+        }
+
+        const QuartKey key{quartX, quartY, quartZ};
+
+        {
+            std::lock_guard<std::mutex> lock(m_quartCacheMutex);
+            auto                        it = m_quartCache.find(key);
+            if (it != m_quartCache.end())
+            {
+                m_quartCacheSlots[it->second.slot].referenced = true;
+                return m_parameterList[it->second.biomeIndex].biome;
+            }
+        }
+
+        // 缓存未命中: 在quart原点采样(锁外执行,噪声采样是只读操作)
         Climate::TargetPoint target;
         if (m_climateSampler)
         {
-            target = m_climateSampler->Sample(x, y, z);
+            target = m_climateSampler->Sample(quartX * 4, quartY * 4, quartZ * 4);
+        }
+
+        const size_t index = FindNearestIndex(target);
+
+        {
+            std::lock_guard<std::mutex> lock(m_quartCacheMutex);
+            // 另一个线程可能已在锁外完成同一quart的查找
+            if (m_quartCache.find(key) == m_quartCache.end())
+            {
+                uint32_t slot = 0;
+                if (m_quartCacheSlots.size() < kQuartCacheCapacity)
+                {
+                    slot = static_cast<uint32_t>(m_quartCacheSlots.size());
+                    m_quartCacheSlots.push_back(QuartCacheSlot{});
+                }
+                else
+                {
+                    // 时钟算法: 跳过并清除被引用过的槽位,淘汰第一个未被引用的槽位
+                    while (m_quartCacheSlots[m_quartClockHand].referenced)
+                    {
+                        m_quartCacheSlots[m_quartClockHand].referenced = false;
+                        m_quartClockHand                               = (m_quartClockHand + 1) % kQuartCacheCapacity;
+                    }
+                    slot             = static_cast<uint32_t>(m_quartClockHand);
+                    m_quartClockHand = (m_quartClockHand + 1) % kQuartCacheCapacity;
+                    m_quartCache.erase(m_quartCacheSlots[slot].key);
+                }
+
+                m_quartCacheSlots[slot] = QuartCacheSlot{key, false};
+                m_quartCache.emplace(key, QuartCacheEntry{static_cast<uint32_t>(index), slot});
+            }
+        }
+
+        return m_parameterList[index].biome;
+    }
+
+    void MultiNoiseBiomeSource::GetBiomes(const QuartArea& area, std::vector<std::shared_ptr<Biome>>& outBiomes) const
+    {
+        outBiomes.clear();
+        outBiomes.resize(area.GetCount());
+        if (outBiomes.empty() || m_parameterList.empty())
+        {
+            return;
         }
-        else
+
+        size_t outIndex = 0;
+        for (int y = 0; y < area.sizeY; ++y)
         {
-            // 如果采样器为空,使用默认气候参数
-            target = Climate::TargetPoint(0.0f, 0.0f, 0.0f, 0.0f, 0.0f);
+            for (int z = 0; z < area.sizeZ; ++z)
+            {
+                for (int x = 0; x < area.sizeX; ++x)
+                {
+                    outBiomes[outIndex++] = GetBiomeAtQuart(area.minQuartX + x, area.minQuartY + y, area.minQuartZ + z);
+                }
+            }
         }
+    }
+
+    void MultiNoiseBiomeSource::RegisterBiome(const Climate::TargetPoint& climate, std::shared_ptr<Biome> biome)
+    {
+        m_parameterList.emplace_back(climate, biome);
+        m_treeDirty.store(true, std::memory_order_release);
 
-        // 步骤2: 查找最近的生物群系
-        return FindNearestBiome(target);
+        ClearQuartCache();
+    }
+
+    size_t MultiNoiseBiomeSource::GetQuartCacheSize() const
+    {
+        std::lock_guard<std::mutex> lock(m_quartCacheMutex);
+        return m_quartCache.size();
+    }
+
+    void MultiNoiseBiomeSource::ClearQuartCache() const
+    {
+        std::lock_guard<std::mutex> lock(m_quartCacheMutex);
+        m_quartCache.clear();
+        m_quartCacheSlots.clear();
+        m_quartClockHand = 0;
+    }
+
+    void MultiNoiseBiomeSource::BuildSearchTree() const
+    {
+        std::lock_guard<std::mutex> lock(m_treeMutex);
+        if (!m_treeDirty.load(std::memory_order_acquire))
+        {
+            return;
+        }
+
+        m_treeNodes.clear();
+        m_treeNodes.reserve(m_parameterList.size() / kLeafSize * 2 + 1);
+        m_treeOrder.resize(m_parameterList.size());
+        for (size_t i = 0; i < m_treeOrder.size(); ++i)
+        {
+            m_treeOrder[i] = static_cast<uint32_t>(i);
+        }
+        m_treeRoot = BuildSubtree(0, static_cast<uint32_t>(m_treeOrder.size()));
+
+        m_treePoints.resize(m_treeOrder.size());
+        for (size_t i = 0; i < m_treeOrder.size(); ++i)
+        {
+            m_treePoints[i] = m_parameterList[m_treeOrder[i]].climate;
+        }
+
+        m_treeDirty.store(false, std::memory_order_release);
+    }
+
+    void MultiNoiseBiomeSource::EnsureSearchTree() const
+    {
+        if (m_treeDirty.load(std::memory_order_acquire))
+        {
+            BuildSearchTree();
+        }
+    }
+
+    float MultiNoiseBiomeSource::GetAxisValue(const Climate::TargetPoint& point, int axis)
+    {
+        switch (axis)
+        {
+        case 0: return point.temperature;
+        case 1: return point.humidity;
+        case 2: return point.continentalness;
+        case 3: return point.erosion;
+        default: return point.weirdness;
+        }
+    }
+
+    float MultiNoiseBiomeSource::BoundsDistanceSquared(const Climate::TargetPoint& target, const KdNode& node)
+    {
+        // 与TargetPoint::DistanceSquared相同的累加顺序,保证下界在浮点意义上成立
+        auto axisGap = [](float value, float minValue, float maxValue)
+        {
+            if (value < minValue) return minValue - value;
+            if (value > maxValue) return value - maxValue;
+            return 0.0f;
+        };
+        float dt = axisGap(target.temperature, node.boundsMin.temperature, node.boundsMax.temperature);
+        float dh = axisGap(target.humidity, node.boundsMin.humidity, node.boundsMax.humidity);
+        float dc = axisGap(target.continentalness, node.boundsMin.continentalness, node.boundsMax.continentalness);
+        float de = axisGap(target.erosion, node.boundsMin.erosion, node.boundsMax.erosion);
+        float dw = axisGap(target.weirdness, node.boundsMin.weirdness, node.boundsMax.weirdness);
+        return dt * dt + dh * dh + dc * dc + de * de + dw * dw;
+    }
+
+    int32_t MultiNoiseBiomeSource::BuildSubtree(uint32_t begin, uint32_t end) const
+    {
+        int32_t nodeIndex = static_cast<int32_t>(m_treeNodes.size());
+        m_treeNodes.emplace_back();
+
+        // 计算包围盒,同时选择跨度最大的维度作为分割轴
+        float minValues[5];
+        float maxValues[5];
+        for (int a = 0; a < 5; ++a)
+        {
+            minValues[a] = std::numeric_limits<float>::max();
+            maxValues[a] = std::numeric_limits<float>::lowest();
+        }
+        for (uint32_t i = begin; i < end; ++i)
+        {
+            const Climate::TargetPoint& point = m_parameterList[m_treeOrder[i]].climate;
+            for (int a = 0; a < 5; ++a)
+            {
+                float value  = GetAxisValue(point, a);
+                minValues[a] = (std::min)(minValues[a], value);
+                maxValues[a] = (std::max)(maxValues[a], value);
+            }
+        }
+
+        int axis = 0;
+        for (int a = 1; a < 5; ++a)
+        {
+            if (maxValues[a] - minValues[a] > maxValues[axis] - minValues[axis])
+            {
+                axis = a;
+            }
+        }
+
+        KdNode& node   = m_treeNodes[nodeIndex];
+        node.boundsMin = Climate::TargetPoint(minValues[0], minValues[1], minValues[2], minValues[3], minValues[4]);
+        node.boundsMax = Climate::TargetPoint(maxValues[0], maxValues[1], maxValues[2], maxValues[3], maxValues[4]);
+        node.begin     = begin;
+        node.end       = end;
+
+        if (end - begin <= kLeafSize)
+        {
+            return nodeIndex;
+        }
+
+        // 中位数分割
+        uint32_t mid = begin + (end - begin) / 2;
+        std::nth_element(m_treeOrder.begin() + begin, m_treeOrder.begin() + mid, m_treeOrder.begin() + end,
+                         [this, axis](uint32_t lhs, uint32_t rhs)
+                         {
+                             return GetAxisValue(m_parameterList[lhs].climate, axis) < GetAxisValue(m_parameterList[rhs].climate, axis);
+                         });
+
+        int32_t left                 = BuildSubtree(begin, mid);
+        int32_t right                = BuildSubtree(mid, end);
+        m_treeNodes[nodeIndex].left  = left;
+        m_treeNodes[nodeIndex].right = right;
+        return nodeIndex;
+    }
+
+    void MultiNoiseBiomeSource::SearchSubtree(int32_t nodeIndex, const Climate::TargetPoint& target, uint32_t& bestIndex, float& bestDistanceSquared) const
+    {
+        const KdNode& node = m_treeNodes[nodeIndex];
+
+        if (node.left < 0)
+        {
+            for (uint32_t i = node.begin; i < node.end; ++i)
+            {
+                float distanceSquared = target.DistanceSquared(m_treePoints[i]);
+                if (distanceSquared > bestDistanceSquared)
+                {
+                    continue;
+                }
+                uint32_t pointIndex = m_treeOrder[i];
+
+                // 严格小于更新,相等时取注册顺序靠前者 (与线性扫描的选择结果一致)
+                if (distanceSquared < bestDistanceSquared ||
+                    (distanceSquared == bestDistanceSquared && pointIndex < bestIndex))
+                {
+                    bestDistanceSquared = distanceSquared;
+                    bestIndex           = pointIndex;
+                }
+            }
+            return;
+        }
+
+        // 先访问包围盒更近的子树,以便尽早收紧当前最优距离
+        float   leftDistance  = BoundsDistanceSquared(target, m_treeNodes[node.left]);
+        float   rightDistance = BoundsDistanceSquared(target, m_treeNodes[node.right]);
+        int32_t nearChild     = node.left;
+        int32_t farChild      = node.right;
+        float   nearDistance  = leftDistance;
+        float   farDistance   = rightDistance;
+        if (rightDistance < leftDistance)
+        {
+            std::swap(nearChild, farChild);
+            std::swap(nearDistance, farDistance);
+        }
+
+        // 严格大于才剪枝: 距离相等的子树可能包含下标更小的点
+        if (!(nearDistance > bestDistanceSquared))
+        {
+            SearchSubtree(nearChild, target, bestIndex, bestDistanceSquared);
+        }
+        if (!(farDistance > bestDistanceSquared))
+        {
+            SearchSubtree(farChild, target, bestIndex, bestDistanceSquared);
+        }
+    }
+
+    size_t MultiNoiseBiomeSource::FindNearestIndex(const Climate::TargetPoint& target) const
+    {
+        EnsureSearchTree();
+
+        // 与线性扫描相同的初始候选: 第一个注册的生物群系
+        uint32_t bestIndex           = 0;
+        float    bestDistanceSquared = target.DistanceSquared(m_parameterList[0].climate);
+        if (m_treeRoot >= 0)
+        {
+            SearchSubtree(m_treeRoot, target, bestIndex, bestDistanceSquared);
+        }
+        return bestIndex;
     }
 
     std::shared_ptr<Biome> MultiNoiseBiomeSource::FindNearestBiome(const Climate::TargetPoint& target) const
@@ -42,6 +334,17 @@ namespace enigma::voxel
             return nullptr;
         }
 
+        return m_parameterList[FindNearestIndex(target)].biome;
+    }
+
+    std::shared_ptr<Biome> MultiNoiseBiomeSource::FindNearestBiomeLinear(const Climate::TargetPoint& target) const
+    {
+        // 边界情况: 如果没有注册任何生物群系,返回nullptr
+        if (m_parameterList.empty())
+        {
+            return nullptr;
+        }
+
         // 初始化:选择第一个生物群系作为初始最近候选
         std::shared_ptr<Biome> nearestBiome       = m_parameterList[0].biome;
         float                  minDistanceSquared = target.DistanceSquared(m_parameterList[0].climate);
@@ -5,6 +5,10 @@
 #include <vector>
 #include <memory>
 #include <limits>
+#include <atomic>
+#include <mutex>
+#include <cstdint>
+#include <unordered_map>
 
 namespace enigma::voxel
 {
@@ -40,9 +44,10 @@ namespace enigma::voxel
      *
      * 性能优化:
      *   - 使用距离平方避免开平方根运算
-     *   - 预排序Biome列表(按大陆度排序,提前剔除不可能的候选)
-     *   - 块级缓存(每个Chunk只查询一次,16x16x128个方块共享)
-     *   - 早期退出(找到距离为0的完美匹配时立即返回)
+     *   - 5D KD树索引ParameterList,查询从O(N)降低到约O(log N)
+     *   - Quart级缓存(4x4x4方块共享一次查询结果,与Minecraft的biome quart对齐)
+     *   - 批量查询接口GetBiomes(area),一次填充整块区域
+     *   - KD树查找结果与线性扫描逐位一致(相同的距离公式与并列规则)
      *
      * 参考:
      *   - net.minecraft.world.level.biome.MultiNoiseBiomeSource
@@ -88,12 +93,59 @@ namespace enigma::voxel
          * @param z 世界Z坐标
          * @return 该位置的生物群系
          *
-         * 实现步骤:
-         *   1. 使用Climate::Sampler采样气候参数 -> Climate::TargetPoint
-         *   2. 调用FindNearestBiome查找距离最近的生物群系
+         * 实现: 转换为quart坐标(x >> 2, y >> 2, z >> 2)后调用GetBiomeAtQuart,
+         *       同一quart内的方块返回相同结果并共享quart缓存
          */
         std::shared_ptr<Biome> GetBiome(int x, int y, int z) const override;
 
+        /**
+         * @brief Quart区域 - Quart Area
+         *
+         * 以quart(4方块)为单位描述的3D区域,用于批量查询
+         * quart坐标(qx, qy, qz)对应世界坐标(qx*4, qy*4, qz*4)
+         */
+        struct QuartArea
+        {
+            int minQuartX = 0; ///< 起始quart X
+            int minQuartY = 0; ///< 起始quart Y (高度)
+            int minQuartZ = 0; ///< 起始quart Z
+            int sizeX     = 1; ///< X方向quart数量
+            int sizeY     = 1; ///< Y方向quart数量
+            int sizeZ     = 1; ///< Z方向quart数量
+
+            size_t GetCount() const
+            {
+                if (sizeX <= 0 || sizeY <= 0 || sizeZ <= 0) return 0;
+                return static_cast<size_t>(sizeX) * static_cast<size_t>(sizeY) * static_cast<size_t>(sizeZ);
+            }
+        };
+
+        /**
+         * @brief 获取指定quart的生物群系(带缓存)
+         *
+         * @param quartX quart X坐标 (世界X >> 2)
+         * @param quartY quart Y坐标 (世界Y >> 2, 高度)
+         * @param quartZ quart Z坐标 (世界Z >> 2)
+         * @return 在quart原点(quartX*4, quartY*4, quartZ*4)采样得到的生物群系
+         *
+         * 同一quart内的所有方块共享一次采样与查找结果,
+         * 结果写入线程安全的quart缓存,重复查询直接命中
+         * 缓存以完整的(x, y, z)为键,任意int坐标都不会互相冲突;
+         * 缓存满时按时钟(second-chance)算法淘汰最近未命中的条目
+         */
+        std::shared_ptr<Biome> GetBiomeAtQuart(int quartX, int quartY, int quartZ) const;
+
+        /**
+         * @brief 批量获取区域内每个quart的生物群系
+         *
+         * @param area 查询区域(quart单位)
+         * @param outBiomes 输出数组,大小调整为area.GetCount()
+         *
+         * 输出布局: index = (y * sizeZ + z) * sizeX + x (X变化最快)
+         * 每个元素等价于GetBiomeAtQuart(minQuartX + x, minQuartY + y, minQuartZ + z)
+         */
+        void GetBiomes(const QuartArea& area, std::vector<std::shared_ptr<Biome>>& outBiomes) const;
+
         /**
          * @brief 注册一个生物群系及其理想气候参数
          *
@@ -102,11 +154,19 @@ namespace enigma::voxel
          *
          * 将(climate, biome)对添加到ParameterList中
          * 用于后续的最近邻匹配
+         *
+         * 注意: 注册会使KD树与quart缓存失效,下一次查询时重建
+         *       注册必须在任何并发查询开始之前完成
          */
-        void RegisterBiome(const Climate::TargetPoint& climate, std::shared_ptr<Biome> biome)
-        {
-            m_parameterList.emplace_back(climate, biome);
-        }
+        void RegisterBiome(const Climate::TargetPoint& climate, std::shared_ptr<Biome> biome);
+
+        /**
+         * @brief 立即构建KD树索引
+         *
+         * 可选调用: 查询时若索引已失效会自动构建,
+         * 在注册完成后显式调用可以避免首次查询的构建开销
+         */
+        void BuildSearchTree() const;
 
         /**
          * @brief 在ParameterList中查找最近的Biome
@@ -114,45 +174,112 @@ namespace enigma::voxel
          * @param target 目标气候参数点
          * @return 距离最小的Biome
          *
-         * 算法: 朴素最近邻查找 (Naive Nearest Neighbor)
-         * 时间复杂度: O(N)
-         * 空间复杂度: O(1)
+         * 算法: 5D KD树最近邻查找 (KD-Tree Nearest Neighbor)
+         * 时间复杂度: 平均约O(log N), 最坏O(N)
          *
-         * 优化方向 (未来扩展):
-         *   1. KD树: O(log N)查找,但构建成本高
-         *   2. 网格划分: 预计算每个网格的Biome,O(1)查找
-         *   3. 层级采样: 低分辨率Biome + 高分辨率变种
-         *   4. 块级缓存: 每个Chunk只查询一次
+         * 一致性保证:
+         *   - 叶点距离使用与线性扫描相同的TargetPoint::DistanceSquared
+         *   - 剪枝条件为"包围盒距离平方 > 当前最优"(严格大于),包围盒距离按相同的
+         *     维度顺序累加,浮点舍入单调,被剪枝的子树不可能包含距离更小或相等的点
+         *   - 距离相等时选择注册顺序靠前的点,与线性扫描的严格小于比较一致
          */
         std::shared_ptr<Biome> FindNearestBiome(const Climate::TargetPoint& target) const;
 
+        /**
+         * @brief 线性扫描查找最近的Biome (参考实现)
+         *
+         * 朴素O(N)最近邻查找,用于验证KD树结果以及性能对比
+         */
+        std::shared_ptr<Biome> FindNearestBiomeLinear(const Climate::TargetPoint& target) const;
+
+        /// 已注册的生物群系数量
+        size_t GetBiomeCount() const { return m_parameterList.size(); }
+
+        /// 当前quart缓存中的条目数量 (不超过kQuartCacheCapacity)
+        size_t GetQuartCacheSize() const;
+
+        static constexpr size_t kQuartCacheCapacity = 1u << 16; ///< quart缓存上限,超出后按时钟算法淘汰
+
     private:
+        /**
+         * @brief KD树节点
+         *
+         * 每个节点记录其子树所有点的包围盒;叶节点持有m_treeOrder中[begin, end)区间的点,
+         * 内部节点按axis维度中位数分割为左右子树
+         */
+        struct KdNode
+        {
+            Climate::TargetPoint boundsMin; ///< 子树包围盒最小角
+            Climate::TargetPoint boundsMax; ///< 子树包围盒最大角
+            int32_t              left  = -1; ///< 左子树,叶节点为-1
+            int32_t              right = -1; ///< 右子树,叶节点为-1
+            uint32_t             begin = 0; ///< 叶节点点区间起始(m_treeOrder下标)
+            uint32_t             end   = 0; ///< 叶节点点区间结束
+        };
+
+        /**
+         * @brief quart缓存键 - 完整保存三个坐标,哈希冲突时由operator==区分
+         */
+        struct QuartKey
+        {
+            int x = 0;
+            int y = 0;
+            int z = 0;
+
+            bool operator==(const QuartKey& other) const { return x == other.x && y == other.y && z == other.z; }
+        };
+
+        struct QuartKeyHash
+        {
+            size_t operator()(const QuartKey& key) const noexcept;
+        };
+
+        /**
+         * @brief quart缓存条目
+         *
+         * slot为该条目在时钟环(m_quartCacheSlots)中的位置
+         */
+        struct QuartCacheEntry
+        {
+            uint32_t biomeIndex = 0; ///< ParameterPoint下标
+            uint32_t slot       = 0; ///< 时钟环槽位
+        };
+
+        /**
+         * @brief 时钟环槽位,referenced在命中时置位,时钟指针扫过时清零(second chance)
+         */
+        struct QuartCacheSlot
+        {
+            QuartKey key;
+            bool     referenced = false;
+        };
+
+        static constexpr uint32_t kLeafSize = 8; ///< 叶节点最多容纳的点数
+
+        static float GetAxisValue(const Climate::TargetPoint& point, int axis);
+        static float BoundsDistanceSquared(const Climate::TargetPoint& target, const KdNode& node);
+
+        int32_t BuildSubtree(uint32_t begin, uint32_t end) const;
+        void    SearchSubtree(int32_t nodeIndex, const Climate::TargetPoint& target, uint32_t& bestIndex, float& bestDistanceSquared) const;
+        size_t  FindNearestIndex(const Climate::TargetPoint& target) const;
+        void    EnsureSearchTree() const;
+
         std::shared_ptr<NoiseRouter>      m_noiseRouter; ///< 噪声路由器,提供气候参数采样
         std::unique_ptr<Climate::Sampler> m_climateSampler; ///< 气候采样器
         std::vector<ParameterPoint>       m_parameterList; ///< 生物群系参数列表
 
-        /**
-         * 性能优化建议 (未来实现):
-         *
-         * 1. 块级缓存 (Chunk-Level Caching):
-         *    - 每个Chunk (16x16x128) 只查询一次Biome
-         *    - 使用std::unordered_map<ChunkCoord, Biome*>缓存
-         *    - 内存占用: ~8MB (10000个Chunk * 8字节指针)
-         *
-         * 2. 空间哈希 (Spatial Hashing):
-         *    - 将5D空间划分为超立方体网格
-         *    - 每个网格预计算最可能的Biome
-         *    - 查询时直接访问网格,无需遍历ParameterList
-         *
-         * 3. KD树加速 (KD-Tree Acceleration):
-         *    - 构建5D KD树索引ParameterList
-         *    - 查询复杂度从O(N)降低到O(log N)
-         *    - 适合静态Biome配置(构建后不再修改)
-         *
-         * 4. 多线程优化 (Multithreading):
-         *    - GetBiome是只读操作,天然线程安全
-         *    - 可以并行查询多个Chunk的Biome
-         *    - 使用std::shared_ptr避免数据竞争
-         */
+        mutable std::vector<KdNode>   m_treeNodes; ///< KD树节点(扁平存储)
+        mutable std::vector<uint32_t> m_treeOrder; ///< 按叶节点排列的ParameterPoint下标
+        mutable std::vector<Climate::TargetPoint> m_treePoints; ///< 按叶节点排列的气候参数副本(叶扫描连续访问)
+        mutable int32_t               m_treeRoot = -1; ///< 根节点下标
+        mutable std::atomic<bool>   m_treeDirty{true}; ///< KD树是否需要重建
+        mutable std::mutex          m_treeMutex; ///< 保护KD树构建
+
+        void ClearQuartCache() const;
+
+        mutable std::unordered_map<QuartKey, QuartCacheEntry, QuartKeyHash> m_quartCache; ///< quart坐标 -> 缓存条目
+        mutable std::vector<QuartCacheSlot>                                 m_quartCacheSlots; ///< 时钟环,最多kQuartCacheCapacity个槽位
+        mutable size_t                                                      m_quartClockHand = 0; ///< 下一个淘汰候选槽位
+        mutable std::mutex                                                  m_quartCacheMutex; ///< 保护quart缓存、时钟环与时钟指针
     };
 } // namespace enigma::voxel
@@ -3,6 +3,7 @@
 #include "../Property/PropertyMap.hpp"
 #include "BlockPos.hpp"
 #include "../Fluid/FluidState.hpp"
+#include <cstdint>
 #include <memory>
 
 #include "Engine/Registry/Block/Block.hpp"
@@ -57,6 +58,9 @@ namespace enigma::voxel
         // State index within Block's state list
         size_t m_stateIndex = 0;
 
+        // Dense index across every registered state, assigned once by BlockStateQuadTable::Bake
+        mutable uint32_t m_globalStateId = UINT32_MAX;
+
         // ============================================================
         // FluidState cache
         // [MINECRAFT REF] BlockBehaviour.BlockStateBase.fluidState
@@ -112,6 +116,13 @@ namespace enigma::voxel
          */
         size_t GetStateIndex() const { return m_stateIndex; }
 
+        /**
+         * @brief Get the dense registry-wide state ID (UINT32_MAX until the quad table has been baked)
+         */
+        uint32_t GetGlobalStateId() const { return m_globalStateId; }
+
+        void SetGlobalStateId(uint32_t id) const { m_globalStateId = id; }
+
         // ============================================================
         // Property Access
         // [MINECRAFT REF] StateHolder.getValue() - inherited
@@ -11,13 +11,22 @@
 #include "Engine/Renderer/Model/RenderMesh.hpp"
 #include "Engine/Resource/ResourceSubsystem.hpp"
 #include "Engine/Resource/Atlas/TextureAtlas.hpp"
-#include "Engine/Voxel/Builtin/DefaultBlock.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <utility>
 
 using namespace enigma::voxel;
 
 namespace
 {
     std::atomic<uint64_t> g_nextChunkInstanceId{ 1ULL };
+
+    BlockState* ResolveAirState()
+    {
+        auto airBlock = enigma::registry::block::BlockRegistry::GetBlock("simpleminer", "air");
+        return airBlock->GetDefaultState();
+    }
 }
 
 // Optimized bit-shift coordinate to index conversion
@@ -36,28 +45,25 @@ inline void Chunk::IndexToCoords(size_t index, int32_t& x, int32_t& y, int32_t&
     z = static_cast<int32_t>(index >> (CHUNK_BITS_X + CHUNK_BITS_Y));
 }
 
-Chunk::Chunk(IntVec2 chunkCoords) : m_chunkCoords(chunkCoords)
+Chunk::Chunk(IntVec2 chunkCoords) : Chunk(chunkCoords, ResolveAirState())
 {
-    m_instanceId = g_nextChunkInstanceId.fetch_add(1ULL, std::memory_order_relaxed);
-    core::LogInfo("chunk", "Chunk created: %d, %d", m_chunkCoords.x, m_chunkCoords.y);
-    m_blocks.reserve(BLOCKS_PER_CHUNK * sizeof(BlockState*));
+}
 
-    auto  airBlock = enigma::registry::block::BlockRegistry::GetBlock("simpleminer", "air");
-    auto* airState = airBlock->GetDefaultState();
-    for (size_t i = 0; i < BLOCKS_PER_CHUNK; ++i)
-    {
-        m_blocks.push_back(airState);
-    }
+Chunk::Chunk(IntVec2 chunkCoords, BlockState* fillState) : m_chunkCoords(chunkCoords)
+{
+    m_instanceId = g_nextChunkInstanceId.fetch_add(1ULL, std::memory_order_relaxed);
+    core::LogDebug("chunk", "Chunk created: %d, %d", m_chunkCoords.x, m_chunkCoords.y);
 
-    /// Calculate chunk bound aabb3
-    BlockPos chunkBottomPos = GetWorldPos();
-    m_chunkBounding.m_mins  = Vec3((float)chunkBottomPos.x, (float)chunkBottomPos.y, (float)chunkBottomPos.z);
-    m_chunkBounding.m_maxs  = m_chunkBounding.m_mins + Vec3(CHUNK_SIZE_X, CHUNK_SIZE_Y, CHUNK_SIZE_Z);
+    // Single allocation per array, filled in bulk (no reserve/push_back loop)
+    m_blocks.assign(BLOCKS_PER_CHUNK, fillState);
 
     // [A05] Initialize independent light data arrays (Task 1)
     // Each block gets its own light data and flags to avoid BlockState sharing pollution
-    m_lightData.resize(BLOCKS_PER_CHUNK, 0); // Initialize all light values to 0 (outdoor=0, indoor=0)
-    m_flags.resize(BLOCKS_PER_CHUNK, 0); // Initialize all flags to 0 (no flags set)
+    m_lightData.assign(BLOCKS_PER_CHUNK, 0); // Initialize all light values to 0 (outdoor=0, indoor=0)
+    m_flags.assign(BLOCKS_PER_CHUNK, 0); // Initialize all flags to 0 (no flags set)
+
+    FillHeightmaps(fillState);
+    UpdateChunkBounding();
 }
 
 Chunk::~Chunk() = default;
@@ -96,9 +102,11 @@ void Chunk::SetBlock(int32_t x, int32_t y, int32_t z, BlockState* state)
         return;
     }*/
     m_blocks[index] = state;
+    UpdateHeightmaps(x, y, z, state);
 
     // Mark chunk as dirty for mesh rebuild only (world generation, no save needed)
-    m_isDirty = true;
+    m_isDirty              = true;
+    m_dirtyMeshSectionMask = ~0u;
 }
 
 void Chunk::SetBlockByPlayer(int32_t x, int32_t y, int32_t z, BlockState* state)
@@ -112,11 +120,12 @@ void Chunk::SetBlockByPlayer(int32_t x, int32_t y, int32_t z, BlockState* state)
     // 2. Set new block
     size_t index    = CoordsToIndex(x, y, z);
     m_blocks[index] = state;
+    UpdateHeightmaps(x, y, z, state);
 
     // 3. Mark chunk as modified and dirty
     m_isModified     = true;
     m_playerModified = true;
-    m_isDirty        = true;
+    MarkMeshSectionsDirty(z);
 
     // 4. Get new block properties
     // [UPDATED] Use per-state opacity check for non-full blocks (slabs/stairs)
@@ -138,6 +147,7 @@ void Chunk::SetBlockByPlayer(int32_t x, int32_t y, int32_t z, BlockState* state)
                 if (aboveIsSky)
                 {
                     // Descend downward, flagging non-opaque blocks as SKY
+                    int lowestZ = z;
                     for (int descendZ = z; descendZ >= 0; --descendZ)
                     {
                         BlockState* currentBlock = GetBlock(x, y, descendZ);
@@ -150,10 +160,13 @@ void Chunk::SetBlockByPlayer(int32_t x, int32_t y, int32_t z, BlockState* state)
                         // Flag as SKY and mark dirty
                         SetIsSky(x, y, descendZ, true);
                         SetSkyLight(x, y, descendZ, 15);
+                        lowestZ = descendZ;
 
                         BlockIterator descendIter(this, (int)CoordsToIndex(x, y, descendZ));
                         m_world->MarkLightingDirty(descendIter);
                     }
+                    MarkMeshSectionsDirty(lowestZ, z); // Set directly, so the light engine will not see it change
+                    m_world->NotifyLightChanged(*this, lowestZ, z);
                 }
             }
         }
@@ -166,6 +179,7 @@ void Chunk::SetBlockByPlayer(int32_t x, int32_t y, int32_t z, BlockState* state)
             SetSkyLight(x, y, z, 0);
 
             // Descend downward, clearing SKY flags
+            int lowestZ = z;
             for (int descendZ = z - 1; descendZ >= 0; --descendZ)
             {
                 BlockState* currentBlock = GetBlock(x, y, descendZ);
@@ -178,30 +192,70 @@ void Chunk::SetBlockByPlayer(int32_t x, int32_t y, int32_t z, BlockState* state)
                 // Clear SKY flag and mark dirty
                 SetIsSky(x, y, descendZ, false);
                 SetSkyLight(x, y, descendZ, 0);
+                lowestZ = descendZ;
 
                 BlockIterator descendIter(this, (int)CoordsToIndex(x, y, descendZ));
                 m_world->MarkLightingDirty(descendIter);
             }
+            MarkMeshSectionsDirty(lowestZ, z); // Set directly, so the light engine will not see it change
+            m_world->NotifyLightChanged(*this, lowestZ, z);
         }
 
         // Always mark the changed block itself as dirty
         m_world->MarkLightingDirty(iter);
+        m_world->NotifyBlockChanged(*this, static_cast<int32_t>(index));
     }
 }
 
+void Chunk::SetBlockForBulkEdit(int32_t x, int32_t y, int32_t z, BlockState* state)
+{
+    m_blocks[CoordsToIndex(x, y, z)] = state;
+    m_isModified                     = true;
+    m_playerModified                 = true;
+}
+
 void Chunk::MarkDirty()
 {
+    m_isDirty              = true;
+    m_dirtyMeshSectionMask = ~0u;
+}
+
+void Chunk::MarkMeshSectionsDirty(int32_t z)
+{
+    MarkMeshSectionsDirty(z, z);
+}
+
+void Chunk::MarkMeshSectionsDirty(int32_t minZ, int32_t maxZ)
+{
+    // Face culling and AO sample one block up and down, so a change can cross a section border
+    const uint32_t firstSection = static_cast<uint32_t>((std::max)(minZ - 1, 0)) / ChunkMesh::MESH_SECTION_HEIGHT;
+    const uint32_t lastSection  = static_cast<uint32_t>((std::min)(maxZ + 1, CHUNK_MAX_Z)) / ChunkMesh::MESH_SECTION_HEIGHT;
+    for (uint32_t section = firstSection; section <= lastSection; ++section)
+    {
+        m_dirtyMeshSectionMask |= 1u << section;
+    }
     m_isDirty = true;
 }
 
+void Chunk::ClearMeshSectionsDirty()
+{
+    m_dirtyMeshSectionMask = 0;
+    m_isDirty              = false;
+}
+
 bool Chunk::RebuildMesh()
 {
-    ChunkMeshBuilder builder;
-    auto             newMesh = builder.BuildMesh(this);
+    ChunkMeshBufferPool* bufferPool = m_world != nullptr ? &m_world->GetChunkMeshBufferPool() : nullptr;
+    ChunkMeshBuilder     builder(bufferPool);
+    auto                 newMesh = builder.BuildMesh(this);
 
     if (newMesh)
     {
-        SetMesh(std::move(newMesh));
+        std::shared_ptr<ChunkMesh> previousMesh = SetMesh(std::move(newMesh));
+        if (bufferPool != nullptr)
+        {
+            bufferPool->Release(std::move(previousMesh));
+        }
         core::LogInfo("chunk", "Chunk mesh rebuilt using ChunkMeshBuilder");
         return true;
     }
@@ -214,17 +268,29 @@ bool Chunk::RebuildMesh()
     return false;
 }
 
-void Chunk::SetMesh(std::unique_ptr<ChunkMesh> mesh)
+std::shared_ptr<ChunkMesh> Chunk::SetMesh(std::unique_ptr<ChunkMesh> mesh)
 {
-    m_mesh    = std::move(mesh);
-    m_isDirty = false;
+    std::shared_ptr<ChunkMesh> previousMesh = std::exchange(m_mesh, std::shared_ptr<ChunkMesh>(std::move(mesh)));
+    m_isDirty              = false;
+    m_dirtyMeshSectionMask = 0;
+    return previousMesh;
 }
 
-ChunkMesh* Chunk::GetMesh() const
+const ChunkMesh* Chunk::GetMesh() const
 {
     return m_mesh.get();
 }
 
+ChunkMesh* Chunk::GetMutableChunkMesh()
+{
+    // Snapshots only take references on the main thread, so a count of 1 cannot grow under us
+    if (m_mesh != nullptr && m_mesh.use_count() > 1)
+    {
+        m_mesh = std::make_shared<ChunkMesh>(*m_mesh);
+    }
+    return m_mesh.get();
+}
+
 bool Chunk::NeedsMeshRebuild() const
 {
     return m_isDirty;
@@ -271,15 +337,9 @@ BlockState* Chunk::GetTopBlock(const BlockPos& worldPos)
         // return BlockState{};
         return nullptr; // Return nullptr for now
     }
-    for (int z = worldPos.z; z < 0; --z)
-    {
-        BlockState* block = GetBlock(localX, localY, z);
-        if (block || block != AIR->GetDefaultState())
-        {
-            return block;
-        }
-    }
-    return nullptr;
+
+    int topZ = GetTopBlockZ(worldPos);
+    return topZ >= 0 ? GetBlock(localX, localY, topZ) : nullptr;
 }
 
 void Chunk::SetBlockWorld(const BlockPos& worldPos, BlockState* state)
@@ -320,15 +380,14 @@ int Chunk::GetTopBlockZ(const BlockPos& worldPos)
         return -1; // Return nullptr for now
     }
 
-    for (int z = localZ; z >= 0; --z)
+    // Queries at or above the surface are answered by the heightmap;
+    // only queries starting below it (caves, overhangs) scan the column
+    int surfaceZ = GetHeight(HeightmapType::WorldSurface, localX, localY);
+    if (localZ >= surfaceZ)
     {
-        BlockState* block = GetBlock(localX, localY, z);
-        if (block && block != AIR->GetDefaultState())
-        {
-            return z;
-        }
+        return surfaceZ;
     }
-    return -1;
+    return ScanColumnHeight(HeightmapType::WorldSurface, localX, localY, localZ);
 }
 
 /**
@@ -439,7 +498,133 @@ void Chunk::DebugDraw(IRenderer* renderer)
  */
 void Chunk::Clear()
 {
-    ERROR_RECOVERABLE("Chunk::Clear is not implemented")
+    FillStorage(ResolveAirState());
+    m_isDirty              = true;
+    m_dirtyMeshSectionMask = ~0u;
+}
+
+void Chunk::ResetForReuse(IntVec2 chunkCoords, BlockState* fillState)
+{
+    m_instanceId  = g_nextChunkInstanceId.fetch_add(1ULL, std::memory_order_relaxed);
+    m_chunkCoords = chunkCoords;
+    FillStorage(fillState);
+    UpdateChunkBounding();
+
+    m_mesh.reset();
+    m_state.Store(ChunkState::Inactive);
+    m_isDirty              = true;
+    m_dirtyMeshSectionMask = ~0u;
+    m_isModified     = false;
+    m_playerModified = false;
+    m_isPopulated    = false;
+    m_world          = nullptr;
+    m_attachmentHolder.ClearAllAttachments();
+}
+
+void Chunk::FillStorage(BlockState* fillState)
+{
+    std::fill(m_blocks.begin(), m_blocks.end(), fillState);
+    std::memset(m_lightData.data(), 0, m_lightData.size());
+    std::memset(m_flags.data(), 0, m_flags.size());
+    FillHeightmaps(fillState);
+}
+
+//-------------------------------------------------------------------------------------------
+// Heightmaps
+//-------------------------------------------------------------------------------------------
+
+void Chunk::SetHeightmap(HeightmapType type, const ChunkHeightmap& heightmap)
+{
+    m_heightmaps[static_cast<size_t>(type)] = heightmap;
+}
+
+void Chunk::MarkBlocksReplaced()
+{
+    m_isDirty              = true;
+    m_dirtyMeshSectionMask = ~0u;
+}
+
+void Chunk::RecomputeHeightmaps()
+{
+    for (size_t t = 0; t < HEIGHTMAP_TYPE_COUNT; ++t)
+    {
+        HeightmapType   type      = static_cast<HeightmapType>(t);
+        ChunkHeightmap& heightmap = m_heightmaps[t];
+        for (int32_t y = 0; y < CHUNK_SIZE_Y; ++y)
+        {
+            for (int32_t x = 0; x < CHUNK_SIZE_X; ++x)
+            {
+                heightmap.Set(x, y, ScanColumnHeight(type, x, y, CHUNK_MAX_Z));
+            }
+        }
+    }
+}
+
+void Chunk::RecomputeColumnHeightmaps(int32_t x, int32_t y)
+{
+    for (size_t t = 0; t < HEIGHTMAP_TYPE_COUNT; ++t)
+    {
+        m_heightmaps[t].Set(x, y, ScanColumnHeight(static_cast<HeightmapType>(t), x, y, CHUNK_MAX_Z));
+    }
+}
+
+void Chunk::FillHeightmaps(BlockState* fillState)
+{
+    for (size_t t = 0; t < HEIGHTMAP_TYPE_COUNT; ++t)
+    {
+        bool matches = ChunkHeightmap::Matches(static_cast<HeightmapType>(t), fillState);
+        m_heightmaps[t].Fill(matches ? CHUNK_MAX_Z : ChunkHeightmap::NO_BLOCK);
+    }
+}
+
+/**
+ * @brief Keep heightmaps current after writing state at (x, y, z)
+ *
+ * Writes below a column's height cannot change it, so the common case during
+ * generation and player edits is one compare per heightmap. Placing a matching
+ * block above raises the height; replacing the top block with a non-matching
+ * one rescans downward from just below it.
+ */
+void Chunk::UpdateHeightmaps(int32_t x, int32_t y, int32_t z, BlockState* state)
+{
+    for (size_t t = 0; t < HEIGHTMAP_TYPE_COUNT; ++t)
+    {
+        ChunkHeightmap& heightmap = m_heightmaps[t];
+        int32_t         height    = heightmap.Get(x, y);
+        if (z < height)
+        {
+            continue;
+        }
+
+        HeightmapType type = static_cast<HeightmapType>(t);
+        if (ChunkHeightmap::Matches(type, state))
+        {
+            heightmap.Set(x, y, z);
+        }
+        else if (z == height)
+        {
+            heightmap.Set(x, y, ScanColumnHeight(type, x, y, z - 1));
+        }
+    }
+}
+
+int32_t Chunk::ScanColumnHeight(HeightmapType type, int32_t x, int32_t y, int32_t fromZ) const
+{
+    for (int32_t z = fromZ; z >= 0; --z)
+    {
+        if (ChunkHeightmap::Matches(type, m_blocks[CoordsToIndex(x, y, z)]))
+        {
+            return z;
+        }
+    }
+    return ChunkHeightmap::NO_BLOCK;
+}
+
+void Chunk::UpdateChunkBounding()
+{
+    BlockPos chunkBottomPos = GetWorldPos();
+    m_chunkBounding.m_mins  = Vec3((float)chunkBottomPos.x, (float)chunkBottomPos.y, (float)chunkBottomPos.z);
+    m_chunkBounding.m_maxs  = m_chunkBounding.m_mins + Vec3(CHUNK_SIZE_X, CHUNK_SIZE_Y, CHUNK_SIZE_Z);
 }
 
 /**
@@ -550,14 +735,10 @@ Chunk* Chunk::GetWestNeighbor() const
 void Chunk::InitializeLighting(World* world)
 {
     // Step 1: Default all blocks to lighting=0, clear both per-engine dirty flags
-    for (int i = 0; i < BLOCKS_PER_CHUNK; ++i)
+    std::memset(m_lightData.data(), 0, m_lightData.size());
+    for (uint8_t& flags : m_flags)
     {
-        int32_t x, y, z;
-        IndexToCoords(i, x, y, z);
-        SetSkyLight(x, y, z, 0);
-        SetBlockLight(x, y, z, 0);
-        SetIsBlockLightDirty(x, y, z, false);
-        SetIsSkyLightDirty(x, y, z, false);
+        flags &= static_cast<uint8_t>(~(0x02 | 0x04)); // IsBlockLightDirty | IsSkyLightDirty
     }
 
     // Step 2: Mark boundary blocks as dirty
@@ -565,19 +746,17 @@ void Chunk::InitializeLighting(World* world)
 
     // Step 3: Set SKY flags and skylight=15 directly (no BFS for sky blocks)
     // Sky blocks always have light level 15 - set directly without BFS queue
+    // Everything above the LightBlocking heightmap is sky, so no opacity checks are needed
+    const ChunkHeightmap& lightBlocking = GetHeightmap(HeightmapType::LightBlocking);
     for (int x = 0; x < CHUNK_SIZE_X; ++x)
     {
         for (int y = 0; y < CHUNK_SIZE_Y; ++y)
         {
-            for (int z = CHUNK_MAX_Z; z >= 0; --z)
+            for (int z = CHUNK_MAX_Z; z > lightBlocking.Get(x, y); --z)
             {
-                BlockState* state = GetBlock(x, y, z);
-                if (state->GetBlock()->IsOpaque(state))
-                {
-                    break;
-                }
-                SetIsSky(x, y, z, true);
-                SetSkyLight(x, y, z, 15);
+                size_t index       = CoordsToIndex(x, y, z);
+                m_flags[index]     |= 0x01; // IsSky
+                m_lightData[index] = 0xF0; // Skylight 15, block light 0
             }
         }
     }
@@ -586,11 +765,20 @@ void Chunk::InitializeLighting(World* world)
     // Frontier = non-sky, non-opaque blocks directly adjacent to a sky block
     // These are cave/overhang entry points where skylight propagates inward
     // (~100-500 blocks per chunk vs ~49K if all sky blocks were queued)
+    // Sky is contiguous from the top, so a non-sky block can only touch sky sideways:
+    // candidates lie between the lowest in-chunk neighbor height and this column's height
     for (int x = 0; x < CHUNK_SIZE_X; ++x)
     {
         for (int y = 0; y < CHUNK_SIZE_Y; ++y)
         {
-            for (int z = CHUNK_MAX_Z; z >= 0; --z)
+            int columnHeight   = lightBlocking.Get(x, y);
+            int neighborHeight = columnHeight;
+            if (x > 0) neighborHeight = (std::min)(neighborHeight, lightBlocking.Get(x - 1, y));
+            if (x < CHUNK_MAX_X) neighborHeight = (std::min)(neighborHeight, lightBlocking.Get(x + 1, y));
+            if (y > 0) neighborHeight = (std::min)(neighborHeight, lightBlocking.Get(x, y - 1));
+            if (y < CHUNK_MAX_Y) neighborHeight = (std::min)(neighborHeight, lightBlocking.Get(x, y + 1));
+
+            for (int z = columnHeight; z > neighborHeight; --z)
             {
                 if (GetIsSky(x, y, z))
                 {
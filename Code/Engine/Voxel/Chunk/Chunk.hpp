@@ -1,6 +1,7 @@
 ﻿#pragma once
 #include "../Block/BlockState.hpp"
 #include "../Block/BlockPos.hpp"
+#include "ChunkHeightmap.hpp"
 #include "ChunkMesh.hpp"
 #include "ChunkSerializationInterfaces.hpp"
 #include "ChunkState.hpp"
@@ -35,7 +36,7 @@ namespace enigma::voxel
      * MEMBER VARIABLES:
      * - IntVec2 m_chunkCoords;                         // Chunk coordinates (X, Y)
      * - BlockState* m_blocks[TOTAL_BLOCKS];            // Flat block storage
-     * - std::unique_ptr<ChunkMesh> m_mesh;             // Compiled mesh for rendering
+     * - std::shared_ptr<ChunkMesh> m_mesh;             // Compiled mesh for rendering (shared with region snapshots)
      * - bool m_isDirty = true;                         // Needs mesh rebuild
      * - bool m_isModified = false;                     // Has unsaved changes
      * - bool m_playerModified = false;                 // Modified by player (save strategy)
@@ -137,9 +138,21 @@ namespace enigma::voxel
         static constexpr int32_t CHUNK_MASK_Y = CHUNK_MAX_Y << CHUNK_BITS_X;
         static constexpr int32_t CHUNK_MASK_Z = CHUNK_MAX_Z << (CHUNK_BITS_X + CHUNK_BITS_Y);
 
-        Chunk(IntVec2 chunkCoords);
+        Chunk(IntVec2 chunkCoords); // Fills with the registry air state
+        Chunk(IntVec2 chunkCoords, BlockState* fillState); // Fills with a pre-resolved state (ChunkPool)
         ~Chunk();
 
+        /// Reinitialize a recycled chunk in place (ChunkPool)
+        /// Keeps the block/light/flag allocations, bulk-fills them and resets every per-instance field
+        /// including a fresh instance id, so stale async results keyed by the old id are rejected
+        void ResetForReuse(IntVec2 chunkCoords, BlockState* fillState);
+
+        /// Bytes held by the block, light and flag arrays of one chunk
+        static constexpr size_t GetStorageBytes()
+        {
+            return static_cast<size_t>(BLOCKS_PER_CHUNK) * (sizeof(BlockState*) + sizeof(uint8_t) + sizeof(uint8_t));
+        }
+
         // Block Access - PUBLIC for World class access
         BlockState* GetBlock(int32_t x, int32_t y, int32_t z); // Local coordinates
         BlockState* GetBlock(int32_t x, int32_t y, int32_t z) const; // Local coordinates (read-only)
@@ -151,6 +164,22 @@ namespace enigma::voxel
         void        SetBlockWorldByPlayer(const BlockPos& worldPos, BlockState* state); // Player action (sets modify flag)
         int         GetTopBlockZ(const BlockPos& worldPos);
 
+        // Heightmaps - highest matching block per column, maintained by SetBlock/SetBlockByPlayer
+        int32_t               GetHeight(HeightmapType type, int32_t x, int32_t y) const { return m_heightmaps[static_cast<size_t>(type)].Get(x, y); }
+        const ChunkHeightmap& GetHeightmap(HeightmapType type) const { return m_heightmaps[static_cast<size_t>(type)]; }
+        void                  SetHeightmap(HeightmapType type, const ChunkHeightmap& heightmap); // Restore from save data
+        void                  RecomputeHeightmaps(); // Full column rescan (after bulk edits that bypass SetBlock)
+        void                  RecomputeColumnHeightmaps(int32_t x, int32_t y); // Same, one column
+
+        // Bulk edit (World::BeginBulkEdit/SetBlocks/CommitBulkEdit) - writes the block and the player-modified
+        // flags only; the commit restores heightmaps, sky flags, light and mesh dirtiness once per touched column
+        void SetBlockForBulkEdit(int32_t x, int32_t y, int32_t z, BlockState* state);
+
+        // Bulk load - raw block array in CoordsToIndex order, written in one pass by deserializers
+        // Bypasses heightmap upkeep: restore heightmaps (SetHeightmap/RecomputeHeightmaps), then MarkBlocksReplaced()
+        BlockState** GetBlockStorageForLoad() { return m_blocks.data(); }
+        void         MarkBlocksReplaced(); // Whole-chunk mesh dirty, same as a SetBlock pass
+
         // Optimized coordinate to index conversion using bit operations
         static size_t CoordsToIndex(int32_t x, int32_t y, int32_t z);
         static void   IndexToCoords(size_t index, int32_t& x, int32_t& y, int32_t& z);
@@ -166,11 +195,17 @@ namespace enigma::voxel
         // Mesh Management - PUBLIC for rendering system
         void       MarkDirty(); // Mark chunk as needing mesh rebuild
         bool       RebuildMesh(); // Synchronous fallback wrapper around ChunkMeshBuilder
-        void       SetMesh(std::unique_ptr<ChunkMesh> mesh); // Set new mesh after CPU meshing
-        ChunkMesh* GetMesh() const; // Get mesh for rendering
+        std::shared_ptr<ChunkMesh> SetMesh(std::unique_ptr<ChunkMesh> mesh); // Set new mesh after CPU meshing; returns the replaced mesh for recycling
+        const ChunkMesh* GetMesh() const; // Get mesh for rendering
         bool       NeedsMeshRebuild() const; // Check if mesh needs rebuilding
         bool       CanPublishMesh() const; // Main-thread mesh publication legality
 
+        // Per-section mesh dirtiness (ChunkMesh::MESH_SECTION_COUNT bits) for edit patching
+        void     MarkMeshSectionsDirty(int32_t z); // Sections whose faces or AO can see a change at local z
+        void     MarkMeshSectionsDirty(int32_t minZ, int32_t maxZ); // Same, for changes anywhere in [minZ, maxZ]
+        void     ClearMeshSectionsDirty(); // Dirty sections were spliced into the current mesh
+        uint32_t GetDirtyMeshSectionMask() const { return m_dirtyMeshSectionMask; }
+
         //-------------------------------------------------------------------------------------------
         // State Management - PUBLIC for World management
         //-------------------------------------------------------------------------------------------
@@ -247,7 +282,11 @@ namespace enigma::voxel
 
         // Geometry
 #pragma region GEOMETRY
-        ChunkMesh*          GetChunkMesh() const { return m_mesh.get(); }
+        // The mesh is shared read-only with region build snapshots (GetSharedChunkMesh); writers go
+        // through GetMutableChunkMesh, which clones it first while a snapshot still holds it
+        const ChunkMesh*                 GetChunkMesh() const { return m_mesh.get(); }
+        std::shared_ptr<const ChunkMesh> GetSharedChunkMesh() const { return m_mesh; }
+        ChunkMesh*                       GetMutableChunkMesh();
         [[nodiscard]] Mat44 GetModelToWorldTransform() const;
 #pragma endregion GEOMETRY
 
@@ -258,7 +297,7 @@ namespace enigma::voxel
         uint64_t                   m_instanceId = 0;
         IntVec2                    m_chunkCoords = IntVec2(0, 0);
         std::vector<BlockState*>   m_blocks; // Block storage
-        std::unique_ptr<ChunkMesh> m_mesh; // Compiled mesh for rendering
+        std::shared_ptr<ChunkMesh> m_mesh; // Compiled mesh for rendering
 
         //-------------------------------------------------------------------------------------------
         // State Management (Multi-threaded loading system)
@@ -269,6 +308,7 @@ namespace enigma::voxel
         // Sub-states (Only accessed by main thread)
         //-------------------------------------------------------------------------------------------
         bool m_isDirty        = true; // Needs mesh rebuild (main thread only)
+        uint32_t m_dirtyMeshSectionMask = ~0u; // Sections that changed since the mesh was built (main thread only)
         bool m_isModified     = false; // Needs to be saved to disk (main thread only)
         bool m_playerModified = false; // Modified by player (for PlayerModifiedOnly save strategy)
         bool m_isPopulated    = false; // Has decorations/structures (legacy, main thread only)
@@ -313,6 +353,11 @@ namespace enigma::voxel
         std::vector<uint8_t> m_lightData; // Light data: high 4 bits = outdoor (0-15), low 4 bits = indoor (0-15)
         std::vector<uint8_t> m_flags; // Flags: IsSky, IsLightDirty, CanOcclude, IsSolid, IsVisible
 
+        //-------------------------------------------------------------------------------------------
+        // Heightmaps (WorldSurface, MotionBlocking, LightBlocking)
+        //-------------------------------------------------------------------------------------------
+        std::array<ChunkHeightmap, HEIGHTMAP_TYPE_COUNT> m_heightmaps;
+
         //-------------------------------------------------------------------------------------------
         // [Phase 2] Mesh Readiness Coordination
         //-------------------------------------------------------------------------------------------
@@ -347,5 +392,11 @@ namespace enigma::voxel
          * @param world World pointer for accessing MarkLightingDirty()
          */
         void MarkBoundaryBlocksDirty(World* world);
+
+        void    FillStorage(BlockState* fillState); // Bulk-fill blocks, zero light and flags
+        void    FillHeightmaps(BlockState* fillState); // Heights for a chunk uniformly filled with fillState
+        void    UpdateHeightmaps(int32_t x, int32_t y, int32_t z, BlockState* state); // Incremental update after a block write
+        int32_t ScanColumnHeight(HeightmapType type, int32_t x, int32_t y, int32_t fromZ) const;
+        void    UpdateChunkBounding();
     };
 }
@@ -0,0 +1,17 @@
+#include "ChunkBatchRegionBuildTask.hpp"
+
+using namespace enigma::voxel;
+
+void ChunkBatchRegionBuildTask::Execute()
+{
+    if (IsCancellationRequested())
+    {
+        return;
+    }
+
+    m_result = std::make_shared<const ChunkBatchRegionBuildOutput>(ChunkBatchRegionBuilder::BuildRegionGeometry(m_snapshot));
+
+    // Drop the mesh references now, so chunks that replaced their mesh meanwhile can free or recycle it
+    m_snapshot.chunks.clear();
+    m_snapshot.chunks.shrink_to_fit();
+}
@@ -0,0 +1,63 @@
+#pragma once
+
+#include "Engine/Core/Schedule/RunnableTask.hpp"
+#include "Engine/Core/Schedule/ScheduleTaskTypes.hpp"
+#include "ChunkBatchRegionBuilder.hpp"
+
+#include <cstdint>
+#include <memory>
+#include <utility>
+
+namespace enigma::voxel
+{
+    inline constexpr const char* kChunkBatchRegionBuildTaskType   = enigma::core::TaskTypeConstants::MESH_BUILDING;
+    inline constexpr const char* kChunkBatchRegionBuildTaskDomain = "chunk-batch-arena-region";
+
+    inline uint64_t MakeChunkBatchRegionBuildTaskValue(const ChunkBatchRegionId& regionId) noexcept
+    {
+        const uint64_t x = static_cast<uint64_t>(static_cast<uint32_t>(regionId.regionCoords.x));
+        const uint64_t y = static_cast<uint64_t>(static_cast<uint32_t>(regionId.regionCoords.y));
+        return (y << 32ULL) | x;
+    }
+
+    inline enigma::core::TaskKey MakeChunkBatchRegionBuildTaskKey(const ChunkBatchRegionId& regionId)
+    {
+        return enigma::core::TaskKey{ kChunkBatchRegionBuildTaskDomain, MakeChunkBatchRegionBuildTaskValue(regionId) };
+    }
+
+    //-----------------------------------------------------------------------------------------------
+    // Assembles one render region from a main-thread ChunkBatchRegionBuildSnapshot on mesh worker
+    // threads. The result is immutable and position independent (region-relative slices), so the
+    // owning ChunkRenderRegionStorage only allocates arena ranges, uploads and swaps it in.
+    // The job never touches live chunks or arena state; the chunk meshes it reads are shared
+    // read-only, chunks copy them before writing (Chunk::GetMutableChunkMesh).
+    //-----------------------------------------------------------------------------------------------
+    class ChunkBatchRegionBuildTask : public enigma::core::RunnableTask
+    {
+    public:
+        explicit ChunkBatchRegionBuildTask(ChunkBatchRegionBuildSnapshot snapshot)
+            : RunnableTask(kChunkBatchRegionBuildTaskType)
+              , m_regionId(snapshot.regionId)
+              , m_generation(snapshot.generation)
+              , m_snapshot(std::move(snapshot))
+        {
+        }
+
+        void Execute() override;
+
+        const ChunkBatchRegionId& GetRegionId() const noexcept { return m_regionId; }
+        uint64_t                  GetGeneration() const noexcept { return m_generation; }
+
+        // Main thread, after the completion record arrives; null when cancelled before building
+        std::shared_ptr<const ChunkBatchRegionBuildOutput> TakeResult() noexcept
+        {
+            return std::exchange(m_result, nullptr);
+        }
+
+    private:
+        ChunkBatchRegionId                                 m_regionId;
+        uint64_t                                           m_generation = 0;
+        ChunkBatchRegionBuildSnapshot                      m_snapshot;
+        std::shared_ptr<const ChunkBatchRegionBuildOutput> m_result;
+    };
+}
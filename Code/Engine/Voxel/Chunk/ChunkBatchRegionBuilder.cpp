@@ -12,13 +12,26 @@ namespace
     using enigma::voxel::Chunk;
     using enigma::voxel::ChunkBatchChunkBuildOutput;
     using enigma::voxel::ChunkBatchChunkLayerSlice;
+    using enigma::voxel::ChunkBatchChunkMeshSnapshot;
     using enigma::voxel::ChunkBatchRegionBuildInput;
     using enigma::voxel::ChunkBatchRegionBuildOutput;
+    using enigma::voxel::ChunkBatchRegionBuildSnapshot;
     using enigma::voxel::ChunkBatchRegionId;
     using enigma::voxel::ChunkBatchSubDraw;
 
     constexpr uint32_t kVertexReserveAlignment = 8u;
     constexpr uint32_t kIndexReserveAlignment  = 3u;
+    constexpr size_t   kLayerCount             = 3u;
+
+    // Read-only view of one chunk's layers: the live ChunkMesh on the synchronous path, a
+    // ChunkBatchChunkMeshSnapshot on scheduler workers. Both paths assemble through it.
+    struct ChunkLayerSource
+    {
+        IntVec2                           chunkCoords = IntVec2::ZERO;
+        AABB3                             worldBounds;
+        const std::vector<TerrainVertex>* vertices[kLayerCount] = {};
+        const std::vector<uint32_t>*      indices[kLayerCount]  = {};
+    };
 
     uint32_t AlignUp(uint32_t value, uint32_t alignment)
     {
@@ -77,10 +90,9 @@ namespace
             0.0f);
     }
 
-    Vec3 GetChunkRegionLocalTranslation(const Chunk& chunk, const ChunkBatchRegionId& regionId)
+    Vec3 GetChunkRegionLocalTranslation(const IntVec2& chunkCoords, const ChunkBatchRegionId& regionId)
     {
         const IntVec2 minChunkCoords = enigma::voxel::GetChunkBatchRegionMinChunkCoords(regionId);
-        const IntVec2 chunkCoords    = chunk.GetChunkCoords();
 
         return Vec3(
             static_cast<float>((chunkCoords.x - minChunkCoords.x) * Chunk::CHUNK_SIZE_X),
@@ -141,14 +153,50 @@ namespace
         }
     }
 
+    ChunkLayerSource MakeMeshLayerSource(IntVec2 chunkCoords, const AABB3& worldBounds, const enigma::voxel::ChunkMesh* mesh)
+    {
+        ChunkLayerSource source;
+        source.chunkCoords = chunkCoords;
+        source.worldBounds = worldBounds;
+        if (mesh == nullptr)
+        {
+            return source;
+        }
+
+        for (size_t layerIndex = 0; layerIndex < kLayerCount; ++layerIndex)
+        {
+            const enigma::voxel::ChunkBatchLayer layer = static_cast<enigma::voxel::ChunkBatchLayer>(layerIndex);
+            source.vertices[layerIndex] = &GetVerticesForLayer(*mesh, layer);
+            source.indices[layerIndex]  = &GetIndicesForLayer(*mesh, layer);
+        }
+
+        return source;
+    }
+
+    ChunkLayerSource MakeMeshLayerSource(const Chunk& chunk)
+    {
+        return MakeMeshLayerSource(chunk.GetChunkCoords(), BuildChunkWorldBounds(chunk), chunk.GetChunkMesh());
+    }
+
+    ChunkLayerSource MakeSnapshotLayerSource(const ChunkBatchChunkMeshSnapshot& snapshot)
+    {
+        return MakeMeshLayerSource(snapshot.chunkCoords, snapshot.worldBounds, snapshot.mesh.get());
+    }
+
     bool AppendLayerGeometry(
         ChunkBatchChunkBuildOutput& output,
-        const enigma::voxel::ChunkMesh& mesh,
+        const ChunkLayerSource& source,
         enigma::voxel::ChunkBatchLayer layer,
         const Vec3& translation)
     {
-        const std::vector<TerrainVertex>& sourceVertices = GetVerticesForLayer(mesh, layer);
-        const std::vector<uint32_t>&      sourceIndices  = GetIndicesForLayer(mesh, layer);
+        const size_t layerIndex = static_cast<size_t>(layer);
+        if (source.vertices[layerIndex] == nullptr || source.indices[layerIndex] == nullptr)
+        {
+            return false;
+        }
+
+        const std::vector<TerrainVertex>& sourceVertices = *source.vertices[layerIndex];
+        const std::vector<uint32_t>&      sourceIndices  = *source.indices[layerIndex];
         if (sourceVertices.empty() || sourceIndices.empty())
         {
             return false;
@@ -179,25 +227,19 @@ namespace
         return true;
     }
 
-    ChunkBatchChunkBuildOutput BuildChunkGeometryInternal(const Chunk& chunk, const ChunkBatchRegionId& regionId)
+    ChunkBatchChunkBuildOutput BuildChunkGeometryInternal(const ChunkLayerSource& source, const ChunkBatchRegionId& regionId)
     {
         ChunkBatchChunkBuildOutput output;
-        output.chunkCoords = chunk.GetChunkCoords();
-
-        const enigma::voxel::ChunkMesh* mesh = chunk.GetChunkMesh();
-        if (mesh == nullptr)
-        {
-            return output;
-        }
+        output.chunkCoords = source.chunkCoords;
 
-        const Vec3 translation = GetChunkRegionLocalTranslation(chunk, regionId);
-        AppendLayerGeometry(output, *mesh, enigma::voxel::ChunkBatchLayer::Opaque, translation);
-        AppendLayerGeometry(output, *mesh, enigma::voxel::ChunkBatchLayer::Cutout, translation);
-        AppendLayerGeometry(output, *mesh, enigma::voxel::ChunkBatchLayer::Translucent, translation);
+        const Vec3 translation = GetChunkRegionLocalTranslation(source.chunkCoords, regionId);
+        AppendLayerGeometry(output, source, enigma::voxel::ChunkBatchLayer::Opaque, translation);
+        AppendLayerGeometry(output, source, enigma::voxel::ChunkBatchLayer::Cutout, translation);
+        AppendLayerGeometry(output, source, enigma::voxel::ChunkBatchLayer::Translucent, translation);
 
         if (output.HasGeometry())
         {
-            output.worldBounds = BuildChunkWorldBounds(chunk);
+            output.worldBounds = source.worldBounds;
             output.hasWorldBounds = true;
         }
 
@@ -392,46 +434,29 @@ namespace
             }
         }
     }
-}
 
-namespace enigma::voxel
-{
-    ChunkBatchChunkBuildOutput ChunkBatchRegionBuilder::BuildChunkGeometry(const Chunk& chunk, const ChunkBatchRegionId& regionId)
-    {
-        if (!IsChunkEligibleForBuild(&chunk, regionId))
-        {
-            return {};
-        }
-
-        return BuildChunkGeometryInternal(chunk, regionId);
-    }
-
-    ChunkBatchRegionBuildOutput ChunkBatchRegionBuilder::BuildRegionGeometry(const ChunkBatchRegionBuildInput& input)
+    ChunkBatchRegionBuildOutput BuildRegionGeometryFromSources(
+        const ChunkBatchRegionId&            regionId,
+        const std::vector<ChunkLayerSource>& sources)
     {
         ChunkBatchRegionBuildOutput output;
 
-        const Vec3 regionOriginWorld = GetRegionOriginWorldPosition(input.regionId);
+        const Vec3 regionOriginWorld = GetRegionOriginWorldPosition(regionId);
         output.geometry.regionModelMatrix = Mat44::MakeTranslation3D(regionOriginWorld);
         output.geometry.worldBounds       = AABB3(regionOriginWorld, regionOriginWorld);
         output.geometry.gpuDataValid      = false;
 
-        const std::vector<const Chunk*> chunks = GetSortedEligibleChunks(input);
-        if (chunks.empty())
+        if (sources.empty())
         {
             return output;
         }
 
-        output.chunkOutputs.reserve(chunks.size());
+        output.chunkOutputs.reserve(sources.size());
         bool hasWorldBounds = false;
 
-        for (const Chunk* chunk : chunks)
+        for (const ChunkLayerSource& source : sources)
         {
-            if (chunk == nullptr)
-            {
-                continue;
-            }
-
-            ChunkBatchChunkBuildOutput chunkOutput = BuildChunkGeometryInternal(*chunk, input.regionId);
+            ChunkBatchChunkBuildOutput chunkOutput = BuildChunkGeometryInternal(source, regionId);
             if (!chunkOutput.HasGeometry())
             {
                 continue;
@@ -458,17 +483,17 @@ namespace enigma::voxel
 
         output.totalVertexCapacity = AssignVertexAllocations(output.chunkOutputs);
         uint32_t indexCursor = 0u;
-        indexCursor = AssignLayerSlices(output.chunkOutputs, ChunkBatchLayer::Opaque, indexCursor);
-        indexCursor = AssignLayerSlices(output.chunkOutputs, ChunkBatchLayer::Cutout, indexCursor);
-        indexCursor = AssignLayerSlices(output.chunkOutputs, ChunkBatchLayer::Translucent, indexCursor);
+        indexCursor = AssignLayerSlices(output.chunkOutputs, enigma::voxel::ChunkBatchLayer::Opaque, indexCursor);
+        indexCursor = AssignLayerSlices(output.chunkOutputs, enigma::voxel::ChunkBatchLayer::Cutout, indexCursor);
+        indexCursor = AssignLayerSlices(output.chunkOutputs, enigma::voxel::ChunkBatchLayer::Translucent, indexCursor);
         output.totalIndexCapacity = indexCursor;
 
-        output.geometry.opaque = BuildRegionLayerSpan(output.chunkOutputs, ChunkBatchLayer::Opaque);
-        output.geometry.cutout = BuildRegionLayerSpan(output.chunkOutputs, ChunkBatchLayer::Cutout);
-        output.geometry.translucent = BuildRegionLayerSpan(output.chunkOutputs, ChunkBatchLayer::Translucent);
-        output.geometry.opaqueSubDraws = BuildRegionSubDraws(output.chunkOutputs, ChunkBatchLayer::Opaque);
-        output.geometry.cutoutSubDraws = BuildRegionSubDraws(output.chunkOutputs, ChunkBatchLayer::Cutout);
-        output.geometry.translucentSubDraws = BuildRegionSubDraws(output.chunkOutputs, ChunkBatchLayer::Translucent);
+        output.geometry.opaque = BuildRegionLayerSpan(output.chunkOutputs, enigma::voxel::ChunkBatchLayer::Opaque);
+        output.geometry.cutout = BuildRegionLayerSpan(output.chunkOutputs, enigma::voxel::ChunkBatchLayer::Cutout);
+        output.geometry.translucent = BuildRegionLayerSpan(output.chunkOutputs, enigma::voxel::ChunkBatchLayer::Translucent);
+        output.geometry.opaqueSubDraws = BuildRegionSubDraws(output.chunkOutputs, enigma::voxel::ChunkBatchLayer::Opaque);
+        output.geometry.cutoutSubDraws = BuildRegionSubDraws(output.chunkOutputs, enigma::voxel::ChunkBatchLayer::Cutout);
+        output.geometry.translucentSubDraws = BuildRegionSubDraws(output.chunkOutputs, enigma::voxel::ChunkBatchLayer::Translucent);
 
         if (hasWorldBounds)
         {
@@ -478,3 +503,61 @@ namespace enigma::voxel
         return output;
     }
 }
+
+namespace enigma::voxel
+{
+    ChunkBatchChunkBuildOutput ChunkBatchRegionBuilder::BuildChunkGeometry(const Chunk& chunk, const ChunkBatchRegionId& regionId)
+    {
+        if (!IsChunkEligibleForBuild(&chunk, regionId))
+        {
+            return {};
+        }
+
+        return BuildChunkGeometryInternal(MakeMeshLayerSource(chunk), regionId);
+    }
+
+    ChunkBatchRegionBuildOutput ChunkBatchRegionBuilder::BuildRegionGeometry(const ChunkBatchRegionBuildInput& input)
+    {
+        const std::vector<const Chunk*> chunks = GetSortedEligibleChunks(input);
+
+        std::vector<ChunkLayerSource> sources;
+        sources.reserve(chunks.size());
+        for (const Chunk* chunk : chunks)
+        {
+            sources.push_back(MakeMeshLayerSource(*chunk));
+        }
+
+        return BuildRegionGeometryFromSources(input.regionId, sources);
+    }
+
+    ChunkBatchRegionBuildSnapshot ChunkBatchRegionBuilder::CaptureRegionSnapshot(const ChunkBatchRegionBuildInput& input, uint64_t generation)
+    {
+        ChunkBatchRegionBuildSnapshot snapshot;
+        snapshot.regionId   = input.regionId;
+        snapshot.generation = generation;
+
+        const std::vector<const Chunk*> chunks = GetSortedEligibleChunks(input);
+        snapshot.chunks.reserve(chunks.size());
+        for (const Chunk* chunk : chunks)
+        {
+            ChunkBatchChunkMeshSnapshot& chunkSnapshot = snapshot.chunks.emplace_back();
+            chunkSnapshot.chunkCoords = chunk->GetChunkCoords();
+            chunkSnapshot.worldBounds = BuildChunkWorldBounds(*chunk);
+            chunkSnapshot.mesh        = chunk->GetSharedChunkMesh();
+        }
+
+        return snapshot;
+    }
+
+    ChunkBatchRegionBuildOutput ChunkBatchRegionBuilder::BuildRegionGeometry(const ChunkBatchRegionBuildSnapshot& snapshot)
+    {
+        std::vector<ChunkLayerSource> sources;
+        sources.reserve(snapshot.chunks.size());
+        for (const ChunkBatchChunkMeshSnapshot& chunkSnapshot : snapshot.chunks)
+        {
+            sources.push_back(MakeSnapshotLayerSource(chunkSnapshot));
+        }
+
+        return BuildRegionGeometryFromSources(snapshot.regionId, sources);
+    }
+}
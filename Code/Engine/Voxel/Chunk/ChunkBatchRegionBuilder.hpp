@@ -1,5 +1,6 @@
 #pragma once
 
+#include <memory>
 #include <vector>
 
 #include "../World/TerrainVertexLayout.hpp"
@@ -8,6 +9,7 @@
 namespace enigma::voxel
 {
     class Chunk;
+    struct ChunkMesh;
 
     struct ChunkBatchRegionBuildInput
     {
@@ -15,6 +17,23 @@ namespace enigma::voxel
         std::vector<const Chunk*> chunks;
     };
 
+    // One chunk's mesh, shared with the chunk on the main thread so a worker can assemble the region
+    // while the chunk moves on: patches and rebuilds replace the chunk's mesh instead of writing to it
+    struct ChunkBatchChunkMeshSnapshot
+    {
+        IntVec2                          chunkCoords = IntVec2::ZERO;
+        AABB3                            worldBounds;
+        std::shared_ptr<const ChunkMesh> mesh;
+    };
+
+    // Everything BuildRegionGeometry reads, detached from the live chunks; safe to build on any thread
+    struct ChunkBatchRegionBuildSnapshot
+    {
+        ChunkBatchRegionId                       regionId;
+        uint64_t                                 generation = 0; // ChunkRenderRegion::buildGeneration at capture
+        std::vector<ChunkBatchChunkMeshSnapshot> chunks;          // Eligible chunks only, sorted by coords
+    };
+
     struct ChunkBatchChunkBuildOutput
     {
         IntVec2                               chunkCoords = IntVec2::ZERO;
@@ -101,5 +120,10 @@ namespace enigma::voxel
 
         static ChunkBatchChunkBuildOutput  BuildChunkGeometry(const Chunk& chunk, const ChunkBatchRegionId& regionId);
         static ChunkBatchRegionBuildOutput BuildRegionGeometry(const ChunkBatchRegionBuildInput& input);
+
+        /// Main thread: share the eligible chunks' meshes; the only part of a build that reads live chunks
+        static ChunkBatchRegionBuildSnapshot CaptureRegionSnapshot(const ChunkBatchRegionBuildInput& input, uint64_t generation = 0);
+        /// Any thread: same output BuildRegionGeometry gives for the chunks at capture time
+        static ChunkBatchRegionBuildOutput BuildRegionGeometry(const ChunkBatchRegionBuildSnapshot& snapshot);
     };
 }
@@ -181,11 +181,57 @@ namespace enigma::voxel
         ChunkBatchArenaFallbackReason lastReason = ChunkBatchArenaFallbackReason::None;
     };
 
+    // Bytes written into the shared arenas, split by path, so edit patches can be compared
+    // against the whole-chunk replacement they avoid
+    struct ChunkBatchUploadDiagnostics
+    {
+        uint64_t regionUploadBytesLifetime      = 0; // Full region commits
+        uint64_t replacementUploadBytesLifetime = 0; // Whole-chunk slice replacements
+        uint64_t patchUploadBytesLifetime       = 0; // In-place section patches
+        uint64_t patchReplacementBytesLifetime  = 0; // Slice replacement cost of the same patches
+        uint32_t patchCountLifetime             = 0;
+        uint32_t patchRejectedCountLifetime     = 0; // Left to the replacement / region path
+        uint64_t lastPatchUploadBytes           = 0;
+        uint64_t lastPatchReplacementBytes      = 0;
+    };
+
+    // Full region rebuilds: assembly runs on scheduler workers (ChunkBatchRegionBuildTask), so the
+    // owning thread only pays for the mesh snapshot at submit and the arena commit at completion
+    struct ChunkBatchRegionBuildDiagnostics
+    {
+        uint32_t submittedCountLifetime        = 0;
+        uint32_t committedCountLifetime        = 0; // Worker results swapped in
+        uint32_t discardedStaleCountLifetime   = 0; // Region changed or unloaded after the snapshot
+        uint32_t discardedFailedCountLifetime  = 0; // Cancelled, failed or rejected by the scheduler
+        uint32_t syncBuildCountLifetime        = 0; // Built and committed on the owning thread
+        uint32_t inFlightCount                 = 0;
+        uint64_t snapshotMainThreadUsLifetime  = 0;
+        uint64_t commitMainThreadUsLifetime    = 0; // Async results only
+        uint64_t syncBuildMainThreadUsLifetime = 0; // Gather + assemble + commit
+        uint64_t lastSnapshotMainThreadUs      = 0;
+        uint64_t lastCommitMainThreadUs        = 0;
+        uint64_t lastSyncBuildMainThreadUs     = 0;
+
+        /// Owning-thread cost per dirty region rebuilt through the worker path
+        double GetAsyncMainThreadUsPerRegion() const
+        {
+            return committedCountLifetime > 0 ?
+                static_cast<double>(snapshotMainThreadUsLifetime + commitMainThreadUsLifetime) / committedCountLifetime : 0.0;
+        }
+
+        double GetSyncMainThreadUsPerRegion() const
+        {
+            return syncBuildCountLifetime > 0 ?
+                static_cast<double>(syncBuildMainThreadUsLifetime) / syncBuildCountLifetime : 0.0;
+        }
+    };
+
     struct ChunkBatchArenaDiagnostics
     {
         ChunkBatchArenaSideDiagnostics     vertex;
         ChunkBatchArenaSideDiagnostics     index;
         ChunkBatchArenaFallbackDiagnostics fallback;
+        ChunkBatchUploadDiagnostics        upload;
     };
 
     struct ChunkBatchSubDraw
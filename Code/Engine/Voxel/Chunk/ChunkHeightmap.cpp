@@ -0,0 +1,47 @@
+#include "ChunkHeightmap.hpp"
+
+#include "Engine/Registry/Block/Block.hpp"
+#include "Engine/Voxel/Block/BlockState.hpp"
+
+namespace enigma::voxel
+{
+    bool ChunkHeightmap::Matches(HeightmapType type, BlockState* state)
+    {
+        if (state == nullptr)
+        {
+            return false;
+        }
+
+        registry::block::Block* block = state->GetBlock();
+        if (block == nullptr)
+        {
+            return false;
+        }
+
+        switch (type)
+        {
+        case HeightmapType::WorldSurface:
+            // BlockRegistry loads air as the only invisible block by default
+            return block->IsVisible();
+
+        case HeightmapType::MotionBlocking:
+            if (!block->IsVisible())
+            {
+                return false;
+            }
+            if (block->IsFullBlock() || !state->GetFluidState().IsEmpty())
+            {
+                return true;
+            }
+            // Partial blocks (slabs, stairs) still block motion when they have a collision shape
+            return !block->GetCollisionShape(state).IsEmpty();
+
+        case HeightmapType::LightBlocking:
+            // Same per-state opacity test as Chunk::InitializeLighting sky columns
+            return block->IsOpaque(state);
+
+        default:
+            return false;
+        }
+    }
+}
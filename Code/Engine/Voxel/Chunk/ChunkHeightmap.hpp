@@ -0,0 +1,64 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace enigma::voxel
+{
+    class BlockState;
+
+    /**
+     * @brief Column predicates tracked per chunk (Minecraft Heightmap.Types)
+     *
+     * - WorldSurface:   highest non-air block (spawn, GetTopBlock)
+     * - MotionBlocking: highest block with collision or fluid (feature/tree placement)
+     * - LightBlocking:  highest opaque block (sky light initial fill)
+     */
+    enum class HeightmapType : uint8_t
+    {
+        WorldSurface = 0,
+        MotionBlocking,
+        LightBlocking,
+        Count
+    };
+
+    constexpr size_t HEIGHTMAP_TYPE_COUNT = static_cast<size_t>(HeightmapType::Count);
+
+    /**
+     * @brief 16x16 array holding the highest matching block Z of each column
+     *
+     * Columns are indexed x + (y << 4), matching the low bits of Chunk::CoordsToIndex.
+     * A column without a matching block stores NO_BLOCK (-1).
+     *
+     * The heightmap itself is plain data; Chunk keeps it up to date from SetBlock()
+     * and SetBlockByPlayer() because only the chunk can rescan a column.
+     */
+    class ChunkHeightmap
+    {
+    public:
+        static constexpr int32_t COLUMN_BITS  = 4;
+        static constexpr int32_t COLUMN_COUNT = 1 << (COLUMN_BITS * 2); // 256
+        static constexpr int32_t NO_BLOCK     = -1;
+
+        ChunkHeightmap() { Fill(NO_BLOCK); }
+
+        static constexpr int32_t ColumnIndex(int32_t x, int32_t y) { return x + (y << COLUMN_BITS); }
+
+        int32_t Get(int32_t x, int32_t y) const { return m_heights[ColumnIndex(x, y)]; }
+        void    Set(int32_t x, int32_t y, int32_t z) { m_heights[ColumnIndex(x, y)] = static_cast<int16_t>(z); }
+        void    Fill(int32_t z) { m_heights.fill(static_cast<int16_t>(z)); }
+
+        int32_t GetByColumn(int32_t column) const { return m_heights[column]; }
+        void    SetByColumn(int32_t column, int32_t z) { m_heights[column] = static_cast<int16_t>(z); }
+
+        bool operator==(const ChunkHeightmap& other) const { return m_heights == other.m_heights; }
+        bool operator!=(const ChunkHeightmap& other) const { return !(*this == other); }
+
+        /// True when state counts as a surface block for the given heightmap type
+        static bool Matches(HeightmapType type, BlockState* state);
+
+    private:
+        std::array<int16_t, COLUMN_COUNT> m_heights;
+    };
+}
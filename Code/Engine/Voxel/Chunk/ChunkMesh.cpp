@@ -1,6 +1,8 @@
 ﻿#include "ChunkMesh.hpp"
 #include "Engine/Voxel/World/TerrainVertexLayout.hpp"
 #include "Engine/Graphic/Core/DX12/D3D12RenderSystem.hpp"
+
+#include <algorithm>
 using namespace enigma::voxel;
 
 void ChunkMesh::Clear()
@@ -12,6 +14,13 @@ void ChunkMesh::Clear()
     m_cutoutIndices.clear();
     m_translucentIndices.clear();
     ReleaseGpuBuffers();
+
+    for (auto& layerStarts : m_sectionQuadStart)
+    {
+        layerStarts.fill(0);
+    }
+    m_nextSection      = 0;
+    m_hasSectionRanges = false;
 }
 
 void ChunkMesh::Reserve(size_t opaqueQuads, size_t cutoutQuads, size_t translucentQuads)
@@ -25,6 +34,130 @@ void ChunkMesh::Reserve(size_t opaqueQuads, size_t cutoutQuads, size_t transluce
     m_translucentIndices.reserve(translucentQuads * 6);
 }
 
+// ============================================================
+// Section quad ranges
+// ============================================================
+
+uint32_t ChunkMesh::GetLayerQuadCount(uint32_t layer) const
+{
+    switch (layer)
+    {
+    case 0:
+        return static_cast<uint32_t>(m_opaqueTerrainVertices.size() / 4);
+    case 1:
+        return static_cast<uint32_t>(m_cutoutTerrainVertices.size() / 4);
+    default:
+        return static_cast<uint32_t>(m_translucentTerrainVertices.size() / 4);
+    }
+}
+
+void ChunkMesh::BeginSection(uint32_t sectionIndex)
+{
+    // Sections skipped since the previous call are empty and start where this one does
+    for (; m_nextSection <= sectionIndex && m_nextSection < MESH_SECTION_COUNT; ++m_nextSection)
+    {
+        for (uint32_t layer = 0; layer < LAYER_COUNT; ++layer)
+        {
+            m_sectionQuadStart[layer][m_nextSection] = GetLayerQuadCount(layer);
+        }
+    }
+}
+
+void ChunkMesh::EndSections()
+{
+    for (; m_nextSection <= MESH_SECTION_COUNT; ++m_nextSection)
+    {
+        for (uint32_t layer = 0; layer < LAYER_COUNT; ++layer)
+        {
+            m_sectionQuadStart[layer][m_nextSection] = GetLayerQuadCount(layer);
+        }
+    }
+    m_hasSectionRanges = true;
+}
+
+bool ChunkMesh::ReplaceSections(uint32_t firstSection, uint32_t endSection, const ChunkMesh& sectionMesh, ChunkMeshSectionPatch& outPatch)
+{
+    if (!m_hasSectionRanges || !sectionMesh.m_hasSectionRanges || firstSection >= endSection || endSection > MESH_SECTION_COUNT)
+    {
+        return false;
+    }
+
+    std::vector<graphic::TerrainVertex>* vertexLayers[LAYER_COUNT] = {&m_opaqueTerrainVertices, &m_cutoutTerrainVertices, &m_translucentTerrainVertices};
+    std::vector<uint32_t>*               indexLayers[LAYER_COUNT]  = {&m_opaqueIndices, &m_cutoutIndices, &m_translucentIndices};
+    const std::vector<graphic::TerrainVertex>* sourceVertexLayers[LAYER_COUNT] = {
+        &sectionMesh.m_opaqueTerrainVertices, &sectionMesh.m_cutoutTerrainVertices, &sectionMesh.m_translucentTerrainVertices
+    };
+    const std::vector<uint32_t>* sourceIndexLayers[LAYER_COUNT] = {
+        &sectionMesh.m_opaqueIndices, &sectionMesh.m_cutoutIndices, &sectionMesh.m_translucentIndices
+    };
+
+    outPatch.firstSection = firstSection;
+    outPatch.endSection   = endSection;
+
+    for (uint32_t layer = 0; layer < LAYER_COUNT; ++layer)
+    {
+        std::vector<graphic::TerrainVertex>& vertices = *vertexLayers[layer];
+        std::vector<uint32_t>&               indices  = *indexLayers[layer];
+
+        const uint32_t oldCount    = GetLayerQuadCount(layer);
+        const uint32_t oldBegin    = m_sectionQuadStart[layer][firstSection];
+        const uint32_t oldEnd      = m_sectionQuadStart[layer][endSection];
+        const uint32_t sourceBegin = sectionMesh.m_sectionQuadStart[layer][firstSection];
+        const uint32_t sourceEnd   = sectionMesh.m_sectionQuadStart[layer][endSection];
+        const uint32_t newQuads    = sourceEnd - sourceBegin;
+        const uint32_t newCount    = oldCount - (oldEnd - oldBegin) + newQuads;
+
+        // Vertices: swap the section range for the re-meshed one
+        vertices.erase(vertices.begin() + oldBegin * 4, vertices.begin() + oldEnd * 4);
+        vertices.insert(vertices.begin() + oldBegin * 4,
+                        sourceVertexLayers[layer]->begin() + sourceBegin * 4,
+                        sourceVertexLayers[layer]->begin() + sourceEnd * 4);
+
+        // Indices: same swap, then rebase the inserted quads and shift every quad after them
+        indices.erase(indices.begin() + oldBegin * 6, indices.begin() + oldEnd * 6);
+        indices.insert(indices.begin() + oldBegin * 6,
+                       sourceIndexLayers[layer]->begin() + sourceBegin * 6,
+                       sourceIndexLayers[layer]->begin() + sourceEnd * 6);
+
+        const uint32_t insertedBase = oldBegin * 4 - sourceBegin * 4;
+        for (size_t i = oldBegin * 6; i < static_cast<size_t>(oldBegin + newQuads) * 6; ++i)
+        {
+            indices[i] += insertedBase;
+        }
+        if (newQuads != oldEnd - oldBegin)
+        {
+            const uint32_t tailShift = (newQuads - (oldEnd - oldBegin)) * 4; // Wraps for shrinking; unsigned add still lands right
+            for (size_t i = static_cast<size_t>(oldBegin + newQuads) * 6; i < indices.size(); ++i)
+            {
+                indices[i] += tailShift;
+            }
+        }
+
+        // Section starts: re-meshed sections take the source layout, later sections shift
+        for (uint32_t section = firstSection + 1; section <= MESH_SECTION_COUNT; ++section)
+        {
+            if (section <= endSection)
+            {
+                m_sectionQuadStart[layer][section] = oldBegin + (sectionMesh.m_sectionQuadStart[layer][section] - sourceBegin);
+            }
+            else
+            {
+                m_sectionQuadStart[layer][section] = m_sectionQuadStart[layer][section] - oldEnd + (oldBegin + newQuads);
+            }
+        }
+
+        ChunkMeshLayerPatch& layerPatch = outPatch.layers[layer];
+        layerPatch.firstQuad            = oldBegin;
+        layerPatch.oldEndQuad           = oldEnd;
+        layerPatch.newEndQuad           = oldBegin + newQuads;
+        layerPatch.oldQuadCount         = oldCount;
+        layerPatch.newQuadCount         = newCount;
+    }
+
+    InvalidateGPUData();
+    return true;
+}
+
 bool ChunkMesh::IsEmpty() const
 {
     return m_opaqueTerrainVertices.empty() &&
@@ -32,6 +165,25 @@ bool ChunkMesh::IsEmpty() const
         m_translucentTerrainVertices.empty();
 }
 
+size_t ChunkMesh::GetQuadCapacity() const
+{
+    auto layerQuads = [](const std::vector<graphic::TerrainVertex>& vertices, const std::vector<uint32_t>& indices)
+    {
+        return (std::min)(vertices.capacity() / 4, indices.capacity() / 6);
+    };
+
+    return layerQuads(m_opaqueTerrainVertices, m_opaqueIndices) +
+        layerQuads(m_cutoutTerrainVertices, m_cutoutIndices) +
+        layerQuads(m_translucentTerrainVertices, m_translucentIndices);
+}
+
+size_t ChunkMesh::GetCapacityBytes() const
+{
+    const size_t vertexCapacity = m_opaqueTerrainVertices.capacity() + m_cutoutTerrainVertices.capacity() + m_translucentTerrainVertices.capacity();
+    const size_t indexCapacity  = m_opaqueIndices.capacity() + m_cutoutIndices.capacity() + m_translucentIndices.capacity();
+    return vertexCapacity * sizeof(graphic::TerrainVertex) + indexCapacity * sizeof(uint32_t);
+}
+
 // ============================================================
 // Opaque Statistics
 // ============================================================
@@ -307,6 +459,13 @@ void ChunkMesh::ReleaseGpuBuffers(bool releaseOpaque, bool releaseCutout, bool r
     }
 }
 
+bool ChunkMesh::HasGpuBuffers() const
+{
+    return m_d12OpaqueVertexBuffer || m_d12OpaqueIndexBuffer ||
+        m_d12CutoutVertexBuffer || m_d12CutoutIndexBuffer ||
+        m_d12TranslucentVertexBuffer || m_d12TranslucentIndexBuffer;
+}
+
 void ChunkMesh::CompileToGPU(bool compileOpaque, bool compileCutout, bool compileTranslucent)
 {
     const bool needsOpaqueUpload = compileOpaque &&
@@ -2,6 +2,7 @@
 #include <vector>
 #include <memory>
 #include <array>
+#include <cstdint>
 
 #include "Engine/Graphic/Resource/Buffer/D12IndexBuffer.hpp"
 #include "Engine/Graphic/Resource/Buffer/D12VertexBuffer.hpp"
@@ -10,6 +11,26 @@
 
 namespace enigma::voxel
 {
+    /// Quad range one ChunkMesh::ReplaceSections splice touched in a single render layer
+    struct ChunkMeshLayerPatch
+    {
+        uint32_t firstQuad     = 0; // First quad of the replaced sections
+        uint32_t oldEndQuad    = 0; // End of the replaced range before the splice
+        uint32_t newEndQuad    = 0; // End of the inserted range after the splice
+        uint32_t oldQuadCount  = 0; // Layer quad count before the splice
+        uint32_t newQuadCount  = 0; // Layer quad count after the splice
+
+        bool IsUnchanged() const { return firstQuad == oldEndQuad && firstQuad == newEndQuad; }
+    };
+
+    /// Result of ChunkMesh::ReplaceSections, indexed by ChunkBatchLayer
+    struct ChunkMeshSectionPatch
+    {
+        uint32_t                           firstSection = 0;
+        uint32_t                           endSection   = 0;
+        std::array<ChunkMeshLayerPatch, 3> layers;
+    };
+
     /**
      * @brief Chunk mesh data holder for DX12 deferred rendering
      * 
@@ -28,10 +49,46 @@ namespace enigma::voxel
         ChunkMesh()  = default;
         ~ChunkMesh() = default;
 
+        // Copied by Chunk::GetMutableChunkMesh (copy-on-write), moved out by ChunkMeshBufferPool
+        ChunkMesh(const ChunkMesh&)            = default;
+        ChunkMesh& operator=(const ChunkMesh&) = default;
+        ChunkMesh(ChunkMesh&&)                 = default;
+        ChunkMesh& operator=(ChunkMesh&&)      = default;
+
+        // Vertical sections of MESH_SECTION_HEIGHT blocks; ChunkMeshBuilder emits quads section by section
+        static constexpr uint32_t MESH_SECTION_HEIGHT = 16;
+        static constexpr uint32_t MESH_SECTION_COUNT  = 16; // 256 / MESH_SECTION_HEIGHT
+        static constexpr uint32_t LAYER_COUNT         = 3;
+
         // Data Management
         void Clear();
         void Reserve(size_t opaqueQuads, size_t cutoutQuads, size_t translucentQuads);
 
+        // ========================================================================
+        // Section quad ranges (edit patching)
+        // ========================================================================
+        // The builder calls BeginSection() before emitting the quads of each section (in
+        // ascending order) and EndSections() when done. Afterwards every layer knows which
+        // quad range belongs to which section, so ReplaceSections() can splice a re-meshed
+        // section range into the existing buffers without rebuilding the whole chunk.
+        // Any Clear() drops the ranges.
+        // ========================================================================
+        void     BeginSection(uint32_t sectionIndex);
+        void     EndSections();
+        bool     HasSectionRanges() const { return m_hasSectionRanges; }
+        uint32_t GetSectionQuadStart(uint32_t layer, uint32_t sectionIndex) const { return m_sectionQuadStart[layer][sectionIndex]; }
+        uint32_t GetLayerQuadCount(uint32_t layer) const;
+
+        /**
+         * @brief Replace sections [firstSection, endSection) with the same sections of sectionMesh
+         *
+         * sectionMesh must carry section ranges (e.g. from ChunkMeshBuilder::BuildSections);
+         * only its quads inside the range are copied. Indices of the inserted quads and of every
+         * quad after them are rebased, so the layer stays a valid 4-vertex/6-index quad list.
+         * @return false (mesh untouched) if either mesh lacks section ranges
+         */
+        bool ReplaceSections(uint32_t firstSection, uint32_t endSection, const ChunkMesh& sectionMesh, ChunkMeshSectionPatch& outPatch);
+
         // ========================================================================
         // [FLIPPED QUADS] Adaptive Quad Triangulation for Smooth AO
         // ========================================================================
@@ -83,9 +140,14 @@ namespace enigma::voxel
 
         bool IsEmpty() const;
 
+        // Buffer capacity (ChunkMeshBufferPool size classes)
+        size_t GetQuadCapacity() const; // Quads that fit in all layers without reallocating
+        size_t GetCapacityBytes() const;
+
         // GPU Buffer Management
         void CompileToGPU(bool compileOpaque = true, bool compileCutout = true, bool compileTranslucent = true);
         void ReleaseGpuBuffers(bool releaseOpaque = true, bool releaseCutout = true, bool releaseTranslucent = true);
+        bool HasGpuBuffers() const;
         void InvalidateGPUData();
 
         // DX12 Buffer Access - Opaque (used by TerrainRenderPass)
@@ -130,5 +192,10 @@ namespace enigma::voxel
         bool                                      m_opaqueGpuDataValid = false;
         bool                                      m_cutoutGpuDataValid = false;
         bool                                      m_translucentGpuDataValid = false;
+
+        // m_sectionQuadStart[layer][s] = first quad of section s; [MESH_SECTION_COUNT] = layer end
+        std::array<std::array<uint32_t, MESH_SECTION_COUNT + 1>, LAYER_COUNT> m_sectionQuadStart{};
+        uint32_t                                                            m_nextSection      = 0;
+        bool                                                                m_hasSectionRanges = false;
     };
 }
@@ -0,0 +1,178 @@
+#include "ChunkMeshBufferPool.hpp"
+#include "ChunkMesh.hpp"
+
+#include <algorithm>
+
+namespace enigma::voxel
+{
+    ChunkMeshBufferPool::ChunkMeshBufferPool(const ChunkMeshBufferPoolConfig& config)
+        : m_config(config)
+    {
+    }
+
+    ChunkMeshBufferPool::~ChunkMeshBufferPool() = default;
+
+    uint32_t ChunkMeshBufferPool::GetSizeClass(size_t quadCount)
+    {
+        uint32_t sizeClass = 0;
+        while (sizeClass + 1 < CLASS_COUNT && quadCount >= (size_t{1} << (MIN_CLASS_SHIFT + sizeClass + 1)))
+        {
+            ++sizeClass;
+        }
+        return sizeClass;
+    }
+
+    std::unique_ptr<ChunkMesh> ChunkMeshBufferPool::Acquire(const ChunkMeshCapacityHint& hint)
+    {
+        const size_t requiredQuads = hint.GetTotalQuads();
+
+        std::unique_ptr<ChunkMesh> mesh;
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            ++m_stats.acquireCount;
+
+            for (uint32_t sizeClass = GetSizeClass(requiredQuads); sizeClass < CLASS_COUNT && !mesh; ++sizeClass)
+            {
+                std::vector<std::unique_ptr<ChunkMesh>>& freeList = m_freeMeshes[sizeClass];
+                for (auto it = freeList.begin(); it != freeList.end(); ++it)
+                {
+                    if ((*it)->GetQuadCapacity() >= requiredQuads)
+                    {
+                        mesh = std::move(*it);
+                        freeList.erase(it);
+                        break;
+                    }
+                }
+            }
+
+            if (mesh)
+            {
+                ++m_stats.hitCount;
+                m_stats.retainedBytes -= (std::min)(m_stats.retainedBytes, mesh->GetCapacityBytes());
+            }
+            else
+            {
+                ++m_stats.allocationCount;
+            }
+        }
+
+        if (!mesh)
+        {
+            mesh = std::make_unique<ChunkMesh>();
+        }
+
+        // Per-layer reserve; a pooled mesh only reallocates a layer that is smaller than hinted
+        mesh->Reserve(hint.opaqueQuads, hint.cutoutQuads, hint.translucentQuads);
+        return mesh;
+    }
+
+    void ChunkMeshBufferPool::Release(std::unique_ptr<ChunkMesh> mesh)
+    {
+        if (!mesh)
+        {
+            return;
+        }
+
+        mesh->Clear();
+        const size_t meshBytes = mesh->GetCapacityBytes();
+        const size_t quadCount = mesh->GetQuadCapacity();
+
+        std::lock_guard<std::mutex> lock(m_mutex);
+        ++m_stats.releaseCount;
+
+        std::vector<std::unique_ptr<ChunkMesh>>& freeList = m_freeMeshes[GetSizeClass(quadCount)];
+        if (meshBytes == 0 ||
+            freeList.size() >= m_config.maxMeshesPerClass ||
+            m_stats.retainedBytes + meshBytes > m_config.maxRetainedBytes)
+        {
+            ++m_stats.discardCount;
+            return; // unique_ptr frees the buffers
+        }
+
+        m_stats.retainedBytes += meshBytes;
+        freeList.push_back(std::move(mesh));
+    }
+
+    void ChunkMeshBufferPool::Release(std::shared_ptr<ChunkMesh> mesh)
+    {
+        if (!mesh || mesh.use_count() != 1)
+        {
+            return; // The last snapshot reference frees it
+        }
+        Release(std::make_unique<ChunkMesh>(std::move(*mesh)));
+    }
+
+    void ChunkMeshBufferPool::Trim(size_t maxRetainedBytes)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        TrimLocked(maxRetainedBytes);
+    }
+
+    void ChunkMeshBufferPool::TrimLocked(size_t maxRetainedBytes)
+    {
+        for (uint32_t sizeClass = CLASS_COUNT; sizeClass-- > 0 && m_stats.retainedBytes > maxRetainedBytes;)
+        {
+            std::vector<std::unique_ptr<ChunkMesh>>& freeList = m_freeMeshes[sizeClass];
+            while (!freeList.empty() && m_stats.retainedBytes > maxRetainedBytes)
+            {
+                m_stats.retainedBytes -= (std::min)(m_stats.retainedBytes, freeList.back()->GetCapacityBytes());
+                freeList.pop_back();
+                ++m_stats.trimmedCount;
+            }
+        }
+    }
+
+    void ChunkMeshBufferPool::RecordBuild(uint64_t buildMicroseconds, bool buffersGrew)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_buildTimeUs.Record(buildMicroseconds);
+        if (buffersGrew)
+        {
+            ++m_stats.growCount;
+        }
+    }
+
+    void ChunkMeshBufferPool::SetConfig(const ChunkMeshBufferPoolConfig& config)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_config = config;
+        for (std::vector<std::unique_ptr<ChunkMesh>>& freeList : m_freeMeshes)
+        {
+            while (freeList.size() > m_config.maxMeshesPerClass)
+            {
+                m_stats.retainedBytes -= (std::min)(m_stats.retainedBytes, freeList.back()->GetCapacityBytes());
+                freeList.pop_back();
+                ++m_stats.trimmedCount;
+            }
+        }
+        TrimLocked(m_config.maxRetainedBytes);
+    }
+
+    ChunkMeshBufferPoolStats ChunkMeshBufferPool::GetStats() const
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        ChunkMeshBufferPoolStats stats = m_stats;
+
+        stats.pooledMeshes = 0;
+        for (const std::vector<std::unique_ptr<ChunkMesh>>& freeList : m_freeMeshes)
+        {
+            stats.pooledMeshes += freeList.size();
+        }
+
+        stats.buildCount  = m_buildTimeUs.GetCount();
+        stats.buildP50Us  = m_buildTimeUs.GetValueAtPercentile(50.0);
+        stats.buildP99Us  = m_buildTimeUs.GetValueAtPercentile(99.0);
+        stats.buildMaxUs  = m_buildTimeUs.GetMax();
+        stats.buildMeanUs = m_buildTimeUs.GetMean();
+        return stats;
+    }
+
+    void ChunkMeshBufferPool::ResetStats()
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        const size_t retainedBytes = m_stats.retainedBytes;
+        m_stats                    = ChunkMeshBufferPoolStats();
+        m_stats.retainedBytes      = retainedBytes;
+        m_buildTimeUs.Reset();
+    }
+}
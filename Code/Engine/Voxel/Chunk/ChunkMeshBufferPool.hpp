@@ -0,0 +1,122 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "Engine/Core/Schedule/ScheduleTelemetry.hpp"
+
+namespace enigma::voxel
+{
+    struct ChunkMesh;
+
+    /**
+     * @brief Expected quad counts per render layer for a mesh build
+     *
+     * Taken from the chunk's previous mesh when it is dispatched, so a rebuild can
+     * reserve once and skip the builder's face-counting pre-pass.
+     */
+    struct ChunkMeshCapacityHint
+    {
+        uint32_t opaqueQuads      = 0;
+        uint32_t cutoutQuads      = 0;
+        uint32_t translucentQuads = 0;
+        bool     fromHistory      = false; // False for a chunk that was never meshed
+
+        size_t GetTotalQuads() const { return static_cast<size_t>(opaqueQuads) + cutoutQuads + translucentQuads; }
+    };
+
+    /**
+     * @brief Limits for meshes retained by ChunkMeshBufferPool
+     *
+     * A typical surface chunk mesh holds 5-20k quads (~0.5-2 MB of vertex and index
+     * capacity), so the defaults keep a few dozen meshes worth of buffers around.
+     */
+    struct ChunkMeshBufferPoolConfig
+    {
+        size_t maxMeshesPerClass = 16;
+        size_t maxRetainedBytes  = 64ull * 1024 * 1024;
+    };
+
+    struct ChunkMeshBufferPoolStats
+    {
+        uint64_t acquireCount    = 0; // Acquire() calls
+        uint64_t hitCount        = 0; // Acquire() served from the pool
+        uint64_t allocationCount = 0; // Fresh ChunkMesh objects created on a miss
+        uint64_t growCount       = 0; // Builds whose buffers reallocated despite the reserve
+        uint64_t releaseCount    = 0; // Release() calls
+        uint64_t discardCount    = 0; // Released meshes destroyed because a cap was hit
+        uint64_t trimmedCount    = 0; // Pooled meshes destroyed by Trim()
+        size_t   pooledMeshes    = 0; // Meshes currently waiting for reuse
+        size_t   retainedBytes   = 0; // Buffer capacity held by pooled meshes
+
+        // ChunkMeshBuilder::Build wall time (all builds that used this pool)
+        uint64_t buildCount  = 0;
+        uint64_t buildP50Us  = 0;
+        uint64_t buildP99Us  = 0;
+        uint64_t buildMaxUs  = 0;
+        double   buildMeanUs = 0.0;
+
+        double GetHitRate() const { return acquireCount == 0 ? 0.0 : static_cast<double>(hitCount) / static_cast<double>(acquireCount); }
+    };
+
+    /**
+     * @brief Size-class pool of ChunkMesh CPU buffers for mesh builds
+     *
+     * Mesh build workers acquire a cleared ChunkMesh with enough capacity for the
+     * expected quad count instead of growing six fresh vectors per build. The mesh a
+     * chunk replaces (or drops on unload) comes back through Release() with its
+     * vector capacity intact and its GPU buffers released.
+     *
+     * Size classes are powers of two of total quad capacity, starting at 256 quads.
+     * Acquire() takes the smallest pooled mesh that fits; a miss allocates.
+     *
+     * Threading: Acquire/RecordBuild run on mesh workers, Release/Trim on the main
+     * thread; every method takes the internal mutex.
+     */
+    class ChunkMeshBufferPool
+    {
+    public:
+        static constexpr uint32_t MIN_CLASS_SHIFT = 8; // 256 quads
+        static constexpr uint32_t CLASS_COUNT     = 10; // Last class holds everything >= 128k quads
+
+        explicit ChunkMeshBufferPool(const ChunkMeshBufferPoolConfig& config = ChunkMeshBufferPoolConfig());
+        ~ChunkMeshBufferPool();
+
+        ChunkMeshBufferPool(const ChunkMeshBufferPool&)            = delete;
+        ChunkMeshBufferPool& operator=(const ChunkMeshBufferPool&) = delete;
+
+        /// Returns an empty mesh reserved for the hinted per-layer quad counts
+        std::unique_ptr<ChunkMesh> Acquire(const ChunkMeshCapacityHint& hint);
+
+        /// Clears the mesh (dropping its GPU buffers) and keeps it for reuse while under the caps
+        void Release(std::unique_ptr<ChunkMesh> mesh);
+        /// Same for a mesh a chunk let go of; skipped while a region snapshot still shares it
+        void Release(std::shared_ptr<ChunkMesh> mesh);
+
+        /// Destroys pooled meshes, largest classes first, until at most maxRetainedBytes remain
+        void Trim(size_t maxRetainedBytes = 0);
+
+        /// Called by ChunkMeshBuilder after each build
+        void RecordBuild(uint64_t buildMicroseconds, bool buffersGrew);
+
+        void                             SetConfig(const ChunkMeshBufferPoolConfig& config);
+        const ChunkMeshBufferPoolConfig& GetConfig() const { return m_config; }
+        ChunkMeshBufferPoolStats         GetStats() const;
+        void                             ResetStats();
+
+        static uint32_t GetSizeClass(size_t quadCount);
+
+    private:
+        void TrimLocked(size_t maxRetainedBytes);
+
+        ChunkMeshBufferPoolConfig                                            m_config;
+        mutable std::mutex                                                   m_mutex;
+        std::array<std::vector<std::unique_ptr<ChunkMesh>>, CLASS_COUNT>     m_freeMeshes;
+        ChunkMeshBufferPoolStats                                             m_stats;
+        core::LatencyHistogram                                               m_buildTimeUs;
+    };
+}
@@ -7,6 +7,7 @@
 #include "../Fluid/FluidState.hpp"
 #include "../World/TerrainVertexLayout.hpp"
 #include "Engine/Core/Logger/LoggerAPI.hpp"
+#include "Engine/Core/Profiler/Profiler.hpp"
 #include "Engine/Math/Mat44.hpp"
 #include "Engine/Registry/Block/BlockRegistry.hpp"
 #include "Engine/Registry/Block/RenderShape.hpp"
@@ -14,6 +15,7 @@
 
 #include <algorithm>
 #include <array>
+#include <chrono>
 #include <string>
 
 using namespace enigma::voxel;
@@ -52,6 +54,16 @@ namespace
         int dz;
     };
 
+    // Neighbor offset per Direction (NORTH +Y, SOUTH -Y, EAST +X, WEST -X, UP +Z, DOWN -Z)
+    static const AOOffset kDirectionOffsets[6] = {
+        {0, 1, 0},
+        {0, -1, 0},
+        {1, 0, 0},
+        {-1, 0, 0},
+        {0, 0, 1},
+        {0, 0, -1},
+    };
+
     static const float AO_CURVE[4] = { 1.0f, 0.7f, 0.5f, 0.2f };
 
     static const AOOffset AO_OFFSETS_UP[4][3] = {
@@ -227,15 +239,73 @@ namespace
 
         return result;
     }
+
+    // Per-direction lighting, AO and shading shared by every quad a block emits on that side
+    struct FaceShading
+    {
+        float   aoValues[4] = {};
+        bool    flipQuad    = false;
+        uint8_t shade       = 255;
+        Vec3    faceNormal;
+        Vec2    lightmapCoord;
+    };
+
+    FaceShading ShadeFace(const ChunkMeshingSnapshot& snapshot, int32_t x, int32_t y, int32_t z, Direction direction)
+    {
+        FaceShading        shading;
+        const LightingData lighting = GetNeighborLighting(snapshot, x, y, z, direction);
+        CalculateFaceAO(snapshot, x, y, z, direction, shading.aoValues);
+        shading.flipQuad      = ShouldFlipQuad(shading.aoValues);
+        shading.shade         = static_cast<uint8_t>(GetDirectionalShade(direction) * 255.0f);
+        shading.faceNormal    = GetFaceNormal(direction);
+        shading.lightmapCoord = Vec2(lighting.blockLight, lighting.skyLight);
+        return shading;
+    }
+
+    void ShadeTerrainVertex(enigma::graphic::TerrainVertex& vertex, const FaceShading& shading, int vertexIndex, RenderType renderType)
+    {
+        vertex.m_normal        = shading.faceNormal;
+        vertex.m_lightmapCoord = shading.lightmapCoord;
+        if (renderType == RenderType::TRANSLUCENT)
+        {
+            const uint8_t shadedValue = static_cast<uint8_t>(shading.shade * shading.aoValues[vertexIndex]);
+            vertex.m_color            = Rgba8(shadedValue, shadedValue, shadedValue, 255);
+        }
+        else
+        {
+            const uint8_t ao = static_cast<uint8_t>(shading.aoValues[vertexIndex] * 255.0f);
+            vertex.m_color   = Rgba8(shading.shade, shading.shade, shading.shade, ao);
+        }
+    }
+
+    // A full opaque cube whose six neighbors all occlude emits nothing; most of a chunk's volume
+    bool IsBuriedFullCube(const BlockStateQuadTable& quadTable, const BakedBlockState& entry, const ChunkMeshingSnapshot& snapshot, int32_t x, int32_t y, int32_t z)
+    {
+        if (!entry.Has(kBakedStateFullOpaqueCube) || entry.Has(kBakedStateNeighborSkip))
+        {
+            return false;
+        }
+        for (const AOOffset& offset : kDirectionOffsets)
+        {
+            const BakedBlockState* neighbor = quadTable.Find(snapshot.GetBlock(x + offset.dx, y + offset.dy, z + offset.dz));
+            if (neighbor == nullptr || !neighbor->Has(kBakedStateOccludes))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
 }
 
-ChunkMeshBuilder::ChunkMeshBuilder()
+ChunkMeshBuilder::ChunkMeshBuilder(ChunkMeshBufferPool* bufferPool)
+    : m_bufferPool(bufferPool)
 {
     m_air = registry::block::BlockRegistry::GetBlock("simpleminer", "air");
 }
 
 ChunkMeshBuildResult ChunkMeshBuilder::Build(const ChunkMeshBuildInput& input) const
 {
+    ENGINE_PROFILE_SCOPE("ChunkMeshBuilder::Build");
     ChunkMeshBuildResult result;
     result.chunkCoords     = input.GetChunkCoords();
     result.chunkInstanceId = input.GetChunkInstanceId();
@@ -251,52 +321,135 @@ ChunkMeshBuildResult ChunkMeshBuilder::Build(const ChunkMeshBuildInput& input) c
         return result;
     }
 
-    const ChunkMeshingSnapshot& snapshot = *input.snapshot;
+    const ChunkMeshingSnapshot& snapshot   = *input.snapshot;
+    const auto                  buildStart = std::chrono::steady_clock::now();
 
-    auto   chunkMesh = std::make_unique<ChunkMesh>();
-    int    blockCount = 0;
-    size_t opaqueQuadCount = 0;
-    size_t cutoutQuadCount = 0;
-    size_t translucentQuadCount = 0;
+    // A rebuild reserves from the previous mesh's quad counts and skips the counting pass;
+    // a first build counts exactly. Either way the buffers come from the pool when one is set.
+    const ChunkMeshCapacityHint capacityHint = input.capacityHint.fromHistory ? input.capacityHint : CountQuads(snapshot, BlockStateQuadTable::GetCurrent().get());
 
-    for (int32_t x = 0; x < Chunk::CHUNK_SIZE_X; ++x)
+    std::unique_ptr<ChunkMesh> chunkMesh;
+    if (m_bufferPool != nullptr)
     {
-        for (int32_t y = 0; y < Chunk::CHUNK_SIZE_Y; ++y)
+        chunkMesh = m_bufferPool->Acquire(capacityHint);
+    }
+    else
+    {
+        chunkMesh = std::make_unique<ChunkMesh>();
+        chunkMesh->Reserve(capacityHint.opaqueQuads, capacityHint.cutoutQuads, capacityHint.translucentQuads);
+    }
+    const size_t reservedBytes = chunkMesh->GetCapacityBytes();
+    const int    blockCount    = MeshSections(*chunkMesh, snapshot, 0, ChunkMesh::MESH_SECTION_COUNT);
+    chunkMesh->EndSections();
+
+    if (m_bufferPool != nullptr)
+    {
+        const auto buildMicros = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - buildStart).count();
+        m_bufferPool->RecordBuild(static_cast<uint64_t>(buildMicros), chunkMesh->GetCapacityBytes() != reservedBytes);
+    }
+
+    result.metrics.opaqueVertexCount      = chunkMesh->GetOpaqueVertexCount();
+    result.metrics.cutoutVertexCount      = chunkMesh->GetCutoutVertexCount();
+    result.metrics.translucentVertexCount = chunkMesh->GetTranslucentVertexCount();
+    result.metrics.opaqueIndexCount       = chunkMesh->GetOpaqueIndexCount();
+    result.metrics.cutoutIndexCount       = chunkMesh->GetCutoutIndexCount();
+    result.metrics.translucentIndexCount  = chunkMesh->GetTranslucentIndexCount();
+    result.mesh                           = std::move(chunkMesh);
+    result.status                         = ChunkMeshBuildResultStatus::Built;
+    result.detail                         = "Built";
+
+    core::LogDebug("ChunkMeshBuilder",
+                   "Built snapshot mesh for chunk (%d, %d), blocks=%d, opaque=%llu, cutout=%llu, translucent=%llu",
+                   input.GetChunkCoords().x,
+                   input.GetChunkCoords().y,
+                   blockCount,
+                   result.metrics.opaqueVertexCount,
+                   result.metrics.cutoutVertexCount,
+                   result.metrics.translucentVertexCount);
+    return result;
+}
+
+std::unique_ptr<ChunkMesh> ChunkMeshBuilder::BuildSections(const ChunkMeshingSnapshot& snapshot, uint32_t firstSection, uint32_t endSection) const
+{
+    ENGINE_PROFILE_SCOPE("ChunkMeshBuilder::BuildSections");
+    if (firstSection >= endSection || endSection > ChunkMesh::MESH_SECTION_COUNT)
+    {
+        return nullptr;
+    }
+
+    // Section meshes are small and short-lived; a pooled mesh is handed back by the caller
+    std::unique_ptr<ChunkMesh> sectionMesh = m_bufferPool != nullptr ? m_bufferPool->Acquire(ChunkMeshCapacityHint()) : std::make_unique<ChunkMesh>();
+    MeshSections(*sectionMesh, snapshot, firstSection, endSection);
+    sectionMesh->EndSections();
+    return sectionMesh;
+}
+
+int ChunkMeshBuilder::MeshSections(ChunkMesh& chunkMesh, const ChunkMeshingSnapshot& snapshot, uint32_t firstSection, uint32_t endSection) const
+{
+    static_assert(static_cast<int32_t>(ChunkMesh::MESH_SECTION_COUNT * ChunkMesh::MESH_SECTION_HEIGHT) == Chunk::CHUNK_SIZE_Z,
+                  "ChunkMesh sections must cover the chunk height");
+
+    // One table for the whole build, even if a reload publishes a new one meanwhile
+    const std::shared_ptr<const BlockStateQuadTable> quadTable = BlockStateQuadTable::GetCurrent();
+
+    // Section-major (z outermost) so each section's quads stay contiguous in every layer
+    int blockCount = 0;
+    for (uint32_t section = firstSection; section < endSection; ++section)
+    {
+        chunkMesh.BeginSection(section);
+
+        const int32_t sectionMinZ = static_cast<int32_t>(section * ChunkMesh::MESH_SECTION_HEIGHT);
+        for (int32_t z = sectionMinZ; z < sectionMinZ + static_cast<int32_t>(ChunkMesh::MESH_SECTION_HEIGHT); ++z)
         {
-            for (int32_t z = 0; z < Chunk::CHUNK_SIZE_Z; ++z)
+            for (int32_t y = 0; y < Chunk::CHUNK_SIZE_Y; ++y)
             {
-                BlockState* blockState = snapshot.GetCenterBlock(x, y, z);
-                if (!ShouldRenderBlock(blockState))
-                {
-                    continue;
-                }
-
-                const RenderType renderType = GetBlockRenderType(blockState);
-                for (Direction direction : kAllDirections)
+                for (int32_t x = 0; x < Chunk::CHUNK_SIZE_X; ++x)
                 {
-                    if (!ShouldRenderFace(snapshot, blockState, x, y, z, direction))
+                    BlockState*            blockState = snapshot.GetCenterBlock(x, y, z);
+                    const BakedBlockState* baked      = quadTable ? quadTable->Find(blockState) : nullptr;
+                    if (baked != nullptr)
                     {
+                        if (baked->Has(kBakedStateRenders) && !IsBuriedFullCube(*quadTable, *baked, snapshot, x, y, z))
+                        {
+                            AddBakedBlockToMesh(chunkMesh, *quadTable, *baked, blockState, snapshot, x, y, z);
+                            blockCount++;
+                        }
                         continue;
                     }
 
-                    switch (renderType)
+                    if (!ShouldRenderBlock(blockState))
                     {
-                    case RenderType::SOLID:
-                        opaqueQuadCount++;
-                        break;
-                    case RenderType::CUTOUT:
-                        cutoutQuadCount++;
-                        break;
-                    case RenderType::TRANSLUCENT:
-                        translucentQuadCount++;
-                        break;
+                        continue;
                     }
+
+                    AddBlockToMesh(chunkMesh, blockState, GetBlockPosition(x, y, z), snapshot, x, y, z);
+                    blockCount++;
                 }
             }
         }
     }
+    return blockCount;
+}
 
-    chunkMesh->Reserve(opaqueQuadCount, cutoutQuadCount, translucentQuadCount);
+ChunkMeshCapacityHint ChunkMeshBuilder::CountQuads(const ChunkMeshingSnapshot& snapshot, const BlockStateQuadTable* quadTable) const
+{
+    ChunkMeshCapacityHint hint;
+
+    auto addQuads = [&hint](RenderType renderType, size_t count)
+    {
+        switch (renderType)
+        {
+        case RenderType::SOLID:
+            hint.opaqueQuads += count;
+            break;
+        case RenderType::CUTOUT:
+            hint.cutoutQuads += count;
+            break;
+        case RenderType::TRANSLUCENT:
+            hint.translucentQuads += count;
+            break;
+        }
+    };
 
     for (int32_t x = 0; x < Chunk::CHUNK_SIZE_X; ++x)
     {
@@ -304,37 +457,57 @@ ChunkMeshBuildResult ChunkMeshBuilder::Build(const ChunkMeshBuildInput& input) c
         {
             for (int32_t z = 0; z < Chunk::CHUNK_SIZE_Z; ++z)
             {
-                BlockState* blockState = snapshot.GetCenterBlock(x, y, z);
+                BlockState*            blockState = snapshot.GetCenterBlock(x, y, z);
+                const BakedBlockState* baked      = quadTable ? quadTable->Find(blockState) : nullptr;
+                if (baked != nullptr)
+                {
+                    if (!baked->Has(kBakedStateRenders) || IsBuriedFullCube(*quadTable, *baked, snapshot, x, y, z))
+                    {
+                        continue;
+                    }
+
+                    for (Direction direction : kAllDirections)
+                    {
+                        size_t                quadCount = 0;
+                        const BakedBlockQuad* quads     = quadTable->GetQuads(*baked, direction, quadCount);
+                        if (quadCount == 0)
+                        {
+                            continue;
+                        }
+
+                        if (IsBakedFaceVisible(*quadTable, *baked, blockState, snapshot, x, y, z, direction))
+                        {
+                            addQuads(baked->renderType, quadCount);
+                            continue;
+                        }
+                        for (size_t i = 0; i < quadCount; ++i)
+                        {
+                            addQuads(baked->renderType, quads[i].cullable ? 0 : 1);
+                        }
+                    }
+                    continue;
+                }
+
                 if (!ShouldRenderBlock(blockState))
                 {
                     continue;
                 }
 
-                AddBlockToMesh(*chunkMesh, blockState, GetBlockPosition(x, y, z), snapshot, x, y, z);
-                blockCount++;
+                const RenderType renderType = GetBlockRenderType(blockState);
+                for (Direction direction : kAllDirections)
+                {
+                    if (!ShouldRenderFace(snapshot, blockState, x, y, z, direction))
+                    {
+                        continue;
+                    }
+
+                    addQuads(renderType, 1);
+                }
             }
         }
     }
 
-    result.metrics.opaqueVertexCount      = chunkMesh->GetOpaqueVertexCount();
-    result.metrics.cutoutVertexCount      = chunkMesh->GetCutoutVertexCount();
-    result.metrics.translucentVertexCount = chunkMesh->GetTranslucentVertexCount();
-    result.metrics.opaqueIndexCount       = chunkMesh->GetOpaqueIndexCount();
-    result.metrics.cutoutIndexCount       = chunkMesh->GetCutoutIndexCount();
-    result.metrics.translucentIndexCount  = chunkMesh->GetTranslucentIndexCount();
-    result.mesh                           = std::move(chunkMesh);
-    result.status                         = ChunkMeshBuildResultStatus::Built;
-    result.detail                         = "Built";
-
-    core::LogDebug("ChunkMeshBuilder",
-                   "Built snapshot mesh for chunk (%d, %d), blocks=%d, opaque=%llu, cutout=%llu, translucent=%llu",
-                   input.GetChunkCoords().x,
-                   input.GetChunkCoords().y,
-                   blockCount,
-                   result.metrics.opaqueVertexCount,
-                   result.metrics.cutoutVertexCount,
-                   result.metrics.translucentVertexCount);
-    return result;
+    return hint;
 }
 
 std::unique_ptr<ChunkMesh> ChunkMeshBuilder::BuildMesh(Chunk* chunk) const
@@ -367,6 +540,89 @@ std::unique_ptr<ChunkMesh> ChunkMeshBuilder::BuildMesh(Chunk* chunk) const
     return std::move(result.mesh);
 }
 
+void ChunkMeshBuilder::AddBakedBlockToMesh(ChunkMesh& chunkMesh,
+                                           const BlockStateQuadTable& quadTable,
+                                           const BakedBlockState& entry,
+                                           BlockState* blockState,
+                                           const ChunkMeshingSnapshot& snapshot,
+                                           int32_t x,
+                                           int32_t y,
+                                           int32_t z) const
+{
+    const Vec3 blockOffset(static_cast<float>(x), static_cast<float>(y), static_cast<float>(z));
+
+    for (Direction direction : kAllDirections)
+    {
+        size_t                quadCount = 0;
+        const BakedBlockQuad* quads     = quadTable.GetQuads(entry, direction, quadCount);
+        if (quadCount == 0)
+        {
+            continue;
+        }
+
+        // Faces without a cullface still draw when the neighbor hides the block side
+        const bool faceVisible = IsBakedFaceVisible(quadTable, entry, blockState, snapshot, x, y, z, direction);
+        bool       shaded      = false;
+        FaceShading shading;
+
+        for (size_t quadIndex = 0; quadIndex < quadCount; ++quadIndex)
+        {
+            const BakedBlockQuad& quad = quads[quadIndex];
+            if (quad.cullable && !faceVisible)
+            {
+                continue;
+            }
+            if (!shaded)
+            {
+                shading = ShadeFace(snapshot, x, y, z, direction);
+                shaded  = true;
+            }
+
+            std::array<graphic::TerrainVertex, 4> terrainQuad;
+            for (int vertexIndex = 0; vertexIndex < 4; ++vertexIndex)
+            {
+                terrainQuad[vertexIndex].m_position    = quad.positions[vertexIndex] + blockOffset;
+                terrainQuad[vertexIndex].m_uvTexCoords = quad.uvs[vertexIndex];
+                ShadeTerrainVertex(terrainQuad[vertexIndex], shading, vertexIndex, entry.renderType);
+            }
+
+            if (graphic::TerrainVertexLayout::OnBuildVertexLayout.HasListeners())
+            {
+                graphic::TerrainVertexLayout::OnBuildVertexLayout.Broadcast(terrainQuad.data(), quadTable.GetBlockName(blockState));
+            }
+
+            AppendTerrainQuad(chunkMesh, entry.renderType, entry.Has(kBakedStateFluid) ? blockState : nullptr, snapshot, x, y, z, direction, terrainQuad, shading.flipQuad);
+        }
+    }
+}
+
+bool ChunkMeshBuilder::IsBakedFaceVisible(const BlockStateQuadTable& quadTable,
+                                          const BakedBlockState& entry,
+                                          BlockState* blockState,
+                                          const ChunkMeshingSnapshot& snapshot,
+                                          int32_t x,
+                                          int32_t y,
+                                          int32_t z,
+                                          Direction direction) const
+{
+    // Same decisions as ShouldRenderFace, with the Block queries answered by the table
+    const AOOffset&        offset        = kDirectionOffsets[static_cast<int>(direction)];
+    BlockState*            neighborBlock = snapshot.GetBlock(x + offset.dx, y + offset.dy, z + offset.dz);
+    const BakedBlockState* neighborEntry = quadTable.Find(neighborBlock);
+    if (neighborEntry == nullptr && (neighborBlock == nullptr || neighborBlock->GetBlock() == nullptr))
+    {
+        return true;
+    }
+
+    if (entry.Has(kBakedStateNeighborSkip) && blockState->GetBlock()->SkipRendering(blockState, neighborBlock, direction))
+    {
+        return false;
+    }
+
+    const bool neighborOccludes = neighborEntry != nullptr ? neighborEntry->Has(kBakedStateOccludes) : neighborBlock->CanOcclude();
+    return !(neighborOccludes && entry.Has(kBakedStateCulledByOccluder));
+}
+
 void ChunkMeshBuilder::AddBlockToMesh(ChunkMesh& chunkMesh,
                                       BlockState* blockState,
                                       const BlockPos& blockPos,
@@ -389,10 +645,13 @@ void ChunkMeshBuilder::AddBlockToMesh(ChunkMesh& chunkMesh,
     const RenderType renderType = GetBlockRenderType(blockState);
     const Vec3       blockPosVec3(static_cast<float>(blockPos.x), static_cast<float>(blockPos.y), static_cast<float>(blockPos.z));
     const Mat44      blockToChunkTransform = Mat44::MakeTranslation3D(blockPosVec3);
+    const bool       hasUncullableFaces    = std::any_of(blockRenderMesh->faces.begin(), blockRenderMesh->faces.end(),
+                                                         [](const renderer::model::RenderFace& face) { return !face.hasCullFace; });
 
     for (Direction direction : kAllDirections)
     {
-        if (!ShouldRenderFace(snapshot, blockState, x, y, z, direction))
+        const bool faceVisible = ShouldRenderFace(snapshot, blockState, x, y, z, direction);
+        if (!faceVisible && !hasUncullableFaces)
         {
             continue;
         }
@@ -403,14 +662,8 @@ void ChunkMeshBuilder::AddBlockToMesh(ChunkMesh& chunkMesh,
             continue;
         }
 
-        const LightingData lighting = GetNeighborLighting(snapshot, x, y, z, direction);
-        float              aoValues[4] = {};
-        CalculateFaceAO(snapshot, x, y, z, direction, aoValues);
-        const bool         flipQuad = ShouldFlipQuad(aoValues);
-        const float        directionalShade = GetDirectionalShade(direction);
-        const uint8_t      shade = static_cast<uint8_t>(directionalShade * 255.0f);
-        const Vec3         faceNormal = GetFaceNormal(direction);
-        const Vec2         lightmapCoord(lighting.blockLight, lighting.skyLight);
+        bool        shaded = false;
+        FaceShading shading;
 
         for (const auto* renderFace : renderFaces)
         {
@@ -418,26 +671,23 @@ void ChunkMeshBuilder::AddBlockToMesh(ChunkMesh& chunkMesh,
             {
                 continue;
             }
+            if (renderFace->hasCullFace && !faceVisible)
+            {
+                continue;
+            }
+            if (!shaded)
+            {
+                shading = ShadeFace(snapshot, x, y, z, direction);
+                shaded  = true;
+            }
 
             std::array<graphic::TerrainVertex, 4> terrainQuad;
             for (int vertexIndex = 0; vertexIndex < 4; ++vertexIndex)
             {
                 const Vertex_PCU& srcVertex = renderFace->vertices[vertexIndex];
-                terrainQuad[vertexIndex].m_position      = blockToChunkTransform.TransformPosition3D(srcVertex.m_position);
-                terrainQuad[vertexIndex].m_uvTexCoords   = srcVertex.m_uvTextCoords;
-                terrainQuad[vertexIndex].m_normal        = faceNormal;
-                terrainQuad[vertexIndex].m_lightmapCoord = lightmapCoord;
-
-                if (renderType == RenderType::TRANSLUCENT)
-                {
-                    const uint8_t shadedValue = static_cast<uint8_t>(shade * aoValues[vertexIndex]);
-                    terrainQuad[vertexIndex].m_color = Rgba8(shadedValue, shadedValue, shadedValue, 255);
-                }
-                else
-                {
-                    const uint8_t ao = static_cast<uint8_t>(aoValues[vertexIndex] * 255.0f);
-                    terrainQuad[vertexIndex].m_color = Rgba8(shade, shade, shade, ao);
-                }
+                terrainQuad[vertexIndex].m_position    = blockToChunkTransform.TransformPosition3D(srcVertex.m_position);
+                terrainQuad[vertexIndex].m_uvTexCoords = srcVertex.m_uvTextCoords;
+                ShadeTerrainVertex(terrainQuad[vertexIndex], shading, vertexIndex, renderType);
             }
 
             if (graphic::TerrainVertexLayout::OnBuildVertexLayout.HasListeners())
@@ -447,42 +697,57 @@ void ChunkMeshBuilder::AddBlockToMesh(ChunkMesh& chunkMesh,
                 graphic::TerrainVertexLayout::OnBuildVertexLayout.Broadcast(terrainQuad.data(), namespacedBlockName);
             }
 
-            switch (renderType)
-            {
-            case RenderType::SOLID:
-                chunkMesh.AddOpaqueTerrainQuad(terrainQuad, flipQuad);
-                break;
-            case RenderType::CUTOUT:
-                chunkMesh.AddCutoutTerrainQuad(terrainQuad, flipQuad);
-                break;
-            case RenderType::TRANSLUCENT:
-                chunkMesh.AddTranslucentTerrainQuad(terrainQuad, flipQuad);
-
-                if (direction == Direction::UP && !blockState->GetFluidState().IsEmpty())
-                {
-                    BlockState* upBlock = snapshot.GetBlock(x, y, z + 1);
-                    bool        needBackface = true;
-                    if (upBlock != nullptr && !upBlock->GetFluidState().IsEmpty() &&
-                        upBlock->GetFluidState().IsSame(blockState->GetFluidState()))
-                    {
-                        needBackface = false;
-                    }
+            AppendTerrainQuad(chunkMesh, renderType, blockState, snapshot, x, y, z, direction, terrainQuad, shading.flipQuad);
+        }
+    }
+}
 
-                    if (needBackface)
-                    {
-                        std::array<graphic::TerrainVertex, 4> backfaceQuad = terrainQuad;
-                        const Vec3 flippedNormal = -faceNormal;
-                        for (graphic::TerrainVertex& vertex : backfaceQuad)
-                        {
-                            vertex.m_normal = flippedNormal;
-                        }
+void ChunkMeshBuilder::AppendTerrainQuad(ChunkMesh& chunkMesh,
+                                         RenderType renderType,
+                                         BlockState* blockState,
+                                         const ChunkMeshingSnapshot& snapshot,
+                                         int32_t x,
+                                         int32_t y,
+                                         int32_t z,
+                                         Direction direction,
+                                         const std::array<graphic::TerrainVertex, 4>& terrainQuad,
+                                         bool flipQuad) const
+{
+    switch (renderType)
+    {
+    case RenderType::SOLID:
+        chunkMesh.AddOpaqueTerrainQuad(terrainQuad, flipQuad);
+        break;
+    case RenderType::CUTOUT:
+        chunkMesh.AddCutoutTerrainQuad(terrainQuad, flipQuad);
+        break;
+    case RenderType::TRANSLUCENT:
+        chunkMesh.AddTranslucentTerrainQuad(terrainQuad, flipQuad);
+
+        // Fluid surfaces get a backface too, unless the same fluid continues above
+        if (direction == Direction::UP && blockState != nullptr && !blockState->GetFluidState().IsEmpty())
+        {
+            BlockState* upBlock = snapshot.GetBlock(x, y, z + 1);
+            bool        needBackface = true;
+            if (upBlock != nullptr && !upBlock->GetFluidState().IsEmpty() &&
+                upBlock->GetFluidState().IsSame(blockState->GetFluidState()))
+            {
+                needBackface = false;
+            }
 
-                        chunkMesh.AddTranslucentTerrainQuadBackface(backfaceQuad, flipQuad);
-                    }
+            if (needBackface)
+            {
+                std::array<graphic::TerrainVertex, 4> backfaceQuad = terrainQuad;
+                const Vec3 flippedNormal = -terrainQuad[0].m_normal;
+                for (graphic::TerrainVertex& vertex : backfaceQuad)
+                {
+                    vertex.m_normal = flippedNormal;
                 }
-                break;
+
+                chunkMesh.AddTranslucentTerrainQuadBackface(backfaceQuad, flipQuad);
             }
         }
+        break;
     }
 }
 
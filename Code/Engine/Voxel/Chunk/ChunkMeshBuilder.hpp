@@ -1,11 +1,16 @@
 #pragma once
 
 #include "ChunkMesh.hpp"
+#include "ChunkMeshBufferPool.hpp"
 #include "MeshBuild/ChunkMeshBuildInput.hpp"
 #include "MeshBuild/ChunkMeshBuildResult.hpp"
+#include "MeshBuild/BlockStateQuadTable.hpp"
 #include "../Block/BlockState.hpp"
 #include "../../Voxel/Property/PropertyTypes.hpp"
 #include "Engine/Registry/Block/RenderType.hpp"
+#include "Engine/Voxel/World/TerrainVertexLayout.hpp"
+
+#include <array>
 
 #include <memory>
 
@@ -17,13 +22,39 @@ namespace enigma::voxel
     class ChunkMeshBuilder
     {
     public:
-        ChunkMeshBuilder();
+        /// bufferPool: optional source of reusable mesh buffers (World's pool); builds also
+        /// report their timing to it. Without a pool every build allocates a fresh mesh.
+        explicit ChunkMeshBuilder(ChunkMeshBufferPool* bufferPool = nullptr);
         ~ChunkMeshBuilder() = default;
 
         ChunkMeshBuildResult       Build(const ChunkMeshBuildInput& input) const;
         std::unique_ptr<ChunkMesh> BuildMesh(Chunk* chunk) const;
 
+        /// Mesh only sections [firstSection, endSection) of the snapshot, with section ranges
+        /// set, for ChunkMesh::ReplaceSections. Returns nullptr for an empty/invalid range.
+        std::unique_ptr<ChunkMesh> BuildSections(const ChunkMeshingSnapshot& snapshot, uint32_t firstSection, uint32_t endSection) const;
+
     private:
+        int MeshSections(ChunkMesh& chunkMesh, const ChunkMeshingSnapshot& snapshot, uint32_t firstSection, uint32_t endSection) const;
+        ChunkMeshCapacityHint CountQuads(const ChunkMeshingSnapshot& snapshot, const BlockStateQuadTable* quadTable) const;
+        /// Baked path: quads, render type and culling flags come from the BlockStateQuadTable entry
+        void AddBakedBlockToMesh(ChunkMesh& chunkMesh,
+                                 const BlockStateQuadTable& quadTable,
+                                 const BakedBlockState& entry,
+                                 BlockState* blockState,
+                                 const ChunkMeshingSnapshot& snapshot,
+                                 int32_t x,
+                                 int32_t y,
+                                 int32_t z) const;
+        bool IsBakedFaceVisible(const BlockStateQuadTable& quadTable,
+                                const BakedBlockState& entry,
+                                BlockState* blockState,
+                                const ChunkMeshingSnapshot& snapshot,
+                                int32_t x,
+                                int32_t y,
+                                int32_t z,
+                                Direction direction) const;
+        /// Per-face path for states the table does not cover, or when no table is published
         void AddBlockToMesh(ChunkMesh& chunkMesh,
                             BlockState* blockState,
                             const BlockPos& blockPos,
@@ -31,6 +62,16 @@ namespace enigma::voxel
                             int32_t x,
                             int32_t y,
                             int32_t z) const;
+        void AppendTerrainQuad(ChunkMesh& chunkMesh,
+                               registry::block::RenderType renderType,
+                               BlockState* blockState,
+                               const ChunkMeshingSnapshot& snapshot,
+                               int32_t x,
+                               int32_t y,
+                               int32_t z,
+                               Direction direction,
+                               const std::array<graphic::TerrainVertex, 4>& terrainQuad,
+                               bool flipQuad) const;
         bool ShouldRenderBlock(BlockState* blockState) const;
         bool ShouldRenderFace(const ChunkMeshingSnapshot& snapshot,
                               BlockState* currentBlock,
@@ -42,6 +83,7 @@ namespace enigma::voxel
         BlockPos GetBlockPosition(int x, int y, int z) const;
 
     private:
-        std::shared_ptr<registry::block::Block> m_air = nullptr;
+        std::shared_ptr<registry::block::Block> m_air        = nullptr;
+        ChunkMeshBufferPool*                    m_bufferPool = nullptr;
     };
 }
@@ -0,0 +1,95 @@
+#include "ChunkPool.hpp"
+#include "Chunk.hpp"
+
+#include "Engine/Registry/Block/BlockRegistry.hpp"
+
+#include <algorithm>
+
+namespace enigma::voxel
+{
+    ChunkPool::ChunkPool(const ChunkPoolConfig& config)
+        : m_config(config)
+    {
+    }
+
+    ChunkPool::~ChunkPool() = default;
+
+    std::unique_ptr<Chunk> ChunkPool::Acquire(IntVec2 chunkCoords, BlockState* fillState)
+    {
+        ++m_stats.acquireCount;
+        BlockState* resolvedFill = ResolveFillState(fillState);
+
+        if (m_freeChunks.empty())
+        {
+            return std::make_unique<Chunk>(chunkCoords, resolvedFill);
+        }
+
+        ++m_stats.hitCount;
+        std::unique_ptr<Chunk> chunk = std::move(m_freeChunks.back());
+        m_freeChunks.pop_back();
+        chunk->ResetForReuse(chunkCoords, resolvedFill);
+        return chunk;
+    }
+
+    void ChunkPool::Release(std::unique_ptr<Chunk> chunk)
+    {
+        if (!chunk)
+        {
+            return;
+        }
+
+        ++m_stats.releaseCount;
+        if (m_freeChunks.size() >= GetMaxPooledChunks())
+        {
+            ++m_stats.discardCount;
+            return; // unique_ptr destroys the chunk
+        }
+
+        // Drop GPU/mesh resources and world links now rather than when the chunk is reused
+        chunk->SetMesh(nullptr);
+        chunk->SetWorld(nullptr);
+        chunk->GetAttachmentHolder().ClearAllAttachments();
+        m_freeChunks.push_back(std::move(chunk));
+    }
+
+    void ChunkPool::Trim(size_t maxChunks)
+    {
+        if (m_freeChunks.size() > maxChunks)
+        {
+            m_freeChunks.resize(maxChunks);
+        }
+    }
+
+    void ChunkPool::SetConfig(const ChunkPoolConfig& config)
+    {
+        m_config = config;
+        Trim(GetMaxPooledChunks());
+    }
+
+    ChunkPoolStats ChunkPool::GetStats() const
+    {
+        ChunkPoolStats stats = m_stats;
+        stats.pooledChunks   = m_freeChunks.size();
+        stats.retainedBytes  = m_freeChunks.size() * Chunk::GetStorageBytes();
+        return stats;
+    }
+
+    BlockState* ChunkPool::ResolveFillState(BlockState* fillState)
+    {
+        if (fillState != nullptr)
+        {
+            return fillState;
+        }
+        if (m_airState == nullptr)
+        {
+            auto airBlock = registry::block::BlockRegistry::GetBlock("simpleminer", "air");
+            m_airState    = airBlock ? airBlock->GetDefaultState() : nullptr;
+        }
+        return m_airState;
+    }
+
+    size_t ChunkPool::GetMaxPooledChunks() const
+    {
+        return (std::min)(m_config.maxPooledChunks, m_config.maxRetainedBytes / Chunk::GetStorageBytes());
+    }
+}
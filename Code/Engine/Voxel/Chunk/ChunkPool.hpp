@@ -0,0 +1,83 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "Engine/Math/IntVec2.hpp"
+
+namespace enigma::voxel
+{
+    class Chunk;
+    class BlockState;
+
+    /**
+     * @brief Limits for chunks retained by ChunkPool
+     *
+     * A chunk keeps ~640 KB of block/light/flag storage, so the defaults
+     * retain at most 64 chunks (~40 MB) for reuse while flying.
+     */
+    struct ChunkPoolConfig
+    {
+        size_t maxPooledChunks  = 64;
+        size_t maxRetainedBytes = 64ull * 1024 * 1024;
+    };
+
+    struct ChunkPoolStats
+    {
+        uint64_t acquireCount  = 0; // Acquire() calls
+        uint64_t hitCount      = 0; // Acquire() served from the pool
+        uint64_t releaseCount  = 0; // Release() calls
+        uint64_t discardCount  = 0; // Released chunks destroyed because the pool was full
+        size_t   pooledChunks  = 0; // Chunks currently waiting for reuse
+        size_t   retainedBytes = 0; // Storage bytes held by pooled chunks
+
+        double GetHitRate() const { return acquireCount == 0 ? 0.0 : static_cast<double>(hitCount) / static_cast<double>(acquireCount); }
+    };
+
+    /**
+     * @brief Recycles unloaded chunks to avoid reallocating 65,536-entry block arrays
+     *
+     * World acquires chunks here instead of constructing them and releases them
+     * instead of destroying them. A recycled chunk keeps its block, light and flag
+     * allocations; Acquire() bulk-fills them through Chunk::ResetForReuse().
+     *
+     * The air state is resolved from BlockRegistry once (on first acquire) instead
+     * of by string lookup for every chunk construction.
+     *
+     * Threading: main thread only, like World's m_loadedChunks map.
+     */
+    class ChunkPool
+    {
+    public:
+        explicit ChunkPool(const ChunkPoolConfig& config = ChunkPoolConfig());
+        ~ChunkPool();
+
+        ChunkPool(const ChunkPool&)            = delete;
+        ChunkPool& operator=(const ChunkPool&) = delete;
+
+        /// Returns a chunk at chunkCoords in the Inactive state filled with fillState
+        /// (the registry air state when fillState is null)
+        std::unique_ptr<Chunk> Acquire(IntVec2 chunkCoords, BlockState* fillState = nullptr);
+
+        /// Takes ownership of an unloaded chunk; keeps it for reuse while under the configured caps
+        void Release(std::unique_ptr<Chunk> chunk);
+
+        /// Destroys pooled chunks until at most maxChunks remain
+        void Trim(size_t maxChunks = 0);
+
+        void                   SetConfig(const ChunkPoolConfig& config);
+        const ChunkPoolConfig& GetConfig() const { return m_config; }
+        ChunkPoolStats         GetStats() const;
+
+    private:
+        BlockState* ResolveFillState(BlockState* fillState);
+        size_t      GetMaxPooledChunks() const;
+
+        ChunkPoolConfig                     m_config;
+        std::vector<std::unique_ptr<Chunk>> m_freeChunks;
+        BlockState*                         m_airState = nullptr;
+        ChunkPoolStats                      m_stats;
+    };
+}
@@ -1,13 +1,18 @@
 #include "ChunkRenderRegionStorage.hpp"
 
 #include <algorithm>
+#include <chrono>
 #include <cstring>
 
 #include "ChunkBatchArenaRelocation.hpp"
 #include "ChunkBatchRegionBuilder.hpp"
+#include "ChunkBatchRegionBuildTask.hpp"
 #include "Chunk.hpp"
 #include "ChunkHelper.hpp"
+#include "ChunkMesh.hpp"
 #include "Engine/Core/EngineCommon.hpp"
+#include "Engine/Core/Profiler/Profiler.hpp"
+#include "Engine/Core/Schedule/ScheduleSubsystem.hpp"
 #include "Engine/Core/StringUtils.hpp"
 #include "Engine/Graphic/Core/DX12/D3D12RenderSystem.hpp"
 #include "Engine/Graphic/Resource/Buffer/BufferTransferCoordinator.hpp"
@@ -48,10 +53,15 @@ namespace
     using enigma::voxel::ChunkBatchLayerSpan;
     using enigma::voxel::ChunkBatchRegionBuildInput;
     using enigma::voxel::ChunkBatchRegionBuildOutput;
+    using enigma::voxel::ChunkBatchRegionBuildSnapshot;
+    using enigma::voxel::ChunkBatchRegionBuildTask;
     using enigma::voxel::ChunkBatchRegionBuilder;
     using enigma::voxel::ChunkBatchRegionId;
     using enigma::voxel::ChunkBatchSubDraw;
+    using enigma::voxel::ChunkBatchUploadDiagnostics;
     using enigma::voxel::ChunkBatchVertexArenaState;
+    using enigma::voxel::ChunkMeshLayerPatch;
+    using enigma::voxel::ChunkMeshSectionPatch;
     using enigma::voxel::ChunkRenderRegion;
     using enigma::voxel::ChunkRenderRegionStorage;
     using enigma::voxel::RetiredArenaAllocation;
@@ -537,6 +547,32 @@ namespace
         return span;
     }
 
+    void RebuildRegionDrawRangesFromChunkSlices(ChunkRenderRegion& region)
+    {
+        region.geometry.opaqueSubDraws = BuildRegionSubDrawsFromChunkSlices(region.chunkSlices, ChunkBatchLayer::Opaque);
+        region.geometry.cutoutSubDraws = BuildRegionSubDrawsFromChunkSlices(region.chunkSlices, ChunkBatchLayer::Cutout);
+        region.geometry.translucentSubDraws = BuildRegionSubDrawsFromChunkSlices(region.chunkSlices, ChunkBatchLayer::Translucent);
+        region.geometry.opaque = BuildRegionSpanFromSubDraws(region.geometry.opaqueSubDraws);
+        region.geometry.cutout = BuildRegionSpanFromSubDraws(region.geometry.cutoutSubDraws);
+        region.geometry.translucent = BuildRegionSpanFromSubDraws(region.geometry.translucentSubDraws);
+    }
+
+    uint64_t SumUploadBytes(const BufferTransferBatch& batch)
+    {
+        uint64_t bytes = 0;
+        for (const BufferUploadSpan& span : batch.uploadSpans)
+        {
+            bytes += span.sizeInBytes;
+        }
+        return bytes;
+    }
+
+    uint64_t GetElapsedMicroseconds(std::chrono::steady_clock::time_point start)
+    {
+        return static_cast<uint64_t>(
+            std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count());
+    }
+
 }
 
 namespace enigma::voxel
@@ -626,9 +662,15 @@ namespace enigma::voxel
         if (regionIt != m_regions.end())
         {
             regionIt->second.dirty = true;
+            BumpRegionBuildGeneration(regionIt->second);
         }
     }
 
+    void ChunkRenderRegionStorage::BumpRegionBuildGeneration(ChunkRenderRegion& region)
+    {
+        region.buildGeneration = ++m_lastRegionBuildGeneration;
+    }
+
     void ChunkRenderRegionStorage::RemoveQueuedDirtyRegion(const ChunkBatchRegionId& regionId)
     {
         if (m_dirtyRegionSet.erase(regionId) == 0)
@@ -1276,6 +1318,8 @@ namespace enigma::voxel
             return false;
         }
 
+        m_arenaDiagnostics.upload.regionUploadBytesLifetime += SumUploadBytes(transferPlan.uploadBatch);
+
         const ChunkBatchArenaAllocation oldVertexAllocation = region.geometry.vertexAllocation;
         const ChunkBatchArenaAllocation oldIndexAllocation  = region.geometry.indexAllocation;
 
@@ -1590,6 +1634,7 @@ namespace enigma::voxel
                         ? ChunkBatchArenaFallbackReason::ReplacementVertexUploadFailed
                         : ChunkBatchArenaFallbackReason::ReplacementIndexUploadFailed);
             }
+            m_arenaDiagnostics.upload.replacementUploadBytesLifetime += SumUploadBytes(replacementBatch);
 
             runtimeSlice.worldBounds = nextWorldBounds;
             runtimeSlice.hasWorldBounds = nextHasWorldBounds;
@@ -1601,12 +1646,7 @@ namespace enigma::voxel
             appliedReplacementCount++;
         }
 
-        region.geometry.opaqueSubDraws = BuildRegionSubDrawsFromChunkSlices(region.chunkSlices, ChunkBatchLayer::Opaque);
-        region.geometry.cutoutSubDraws = BuildRegionSubDrawsFromChunkSlices(region.chunkSlices, ChunkBatchLayer::Cutout);
-        region.geometry.translucentSubDraws = BuildRegionSubDrawsFromChunkSlices(region.chunkSlices, ChunkBatchLayer::Translucent);
-        region.geometry.opaque = BuildRegionSpanFromSubDraws(region.geometry.opaqueSubDraws);
-        region.geometry.cutout = BuildRegionSpanFromSubDraws(region.geometry.cutoutSubDraws);
-        region.geometry.translucent = BuildRegionSpanFromSubDraws(region.geometry.translucentSubDraws);
+        RebuildRegionDrawRangesFromChunkSlices(region);
 
         bool hasWorldBounds = false;
         AABB3 worldBounds = BuildFallbackRegionBounds(region.id);
@@ -1644,6 +1684,252 @@ namespace enigma::voxel
         return true;
     }
 
+    bool ChunkRenderRegionStorage::TryApplyChunkMeshPatch(const Chunk& chunk, const ChunkMeshSectionPatch& patch)
+    {
+        ENGINE_PROFILE_SCOPE("ChunkRenderRegionStorage::TryApplyChunkMeshPatch");
+        ChunkBatchUploadDiagnostics& uploadDiagnostics = m_arenaDiagnostics.upload;
+        auto reject = [&uploadDiagnostics]()
+        {
+            uploadDiagnostics.patchRejectedCountLifetime++;
+            return false;
+        };
+
+        const int64_t chunkKey  = GetChunkKey(chunk);
+        auto          mappingIt = m_chunkToRegion.find(chunkKey);
+        if (mappingIt == m_chunkToRegion.end())
+        {
+            return reject();
+        }
+
+        auto regionIt = m_regions.find(mappingIt->second);
+        if (regionIt == m_regions.end())
+        {
+            return reject();
+        }
+
+        // The resident slice must hold exactly the pre-splice mesh
+        ChunkRenderRegion& region = regionIt->second;
+        if (!region.HasValidBatchGeometry() || region.dirtyChunkKeys.count(chunkKey) != 0)
+        {
+            return reject();
+        }
+
+        auto runtimeSliceIt = region.chunkSlices.find(chunkKey);
+        if (runtimeSliceIt == region.chunkSlices.end())
+        {
+            return reject();
+        }
+        ChunkBatchChunkRuntimeSlice& runtimeSlice = runtimeSliceIt->second;
+
+        // Same rule as slice replacement: ranges are overwritten in place, so no frame may still read them
+        auto* commandListManager = graphic::D3D12RenderSystem::GetCommandListManager();
+        if (commandListManager == nullptr)
+        {
+            return reject();
+        }
+        commandListManager->UpdateCompletedCommandLists();
+        if (!IsGraphicsSubmissionComplete(CaptureLatestGraphicsRetirementToken(), commandListManager->GetCompletedFenceSnapshot()))
+        {
+            return reject();
+        }
+
+        const ChunkBatchLayer layers[] = {
+            ChunkBatchLayer::Opaque,
+            ChunkBatchLayer::Cutout,
+            ChunkBatchLayer::Translucent
+        };
+
+        // Layers are concatenated in the slice, so each layer's vertex base is the sum of the ones before it
+        uint32_t oldVertexBase[3] = {};
+        uint32_t newVertexBase[3] = {};
+        uint32_t oldVertexCount   = 0u;
+        uint32_t newVertexCount   = 0u;
+        for (ChunkBatchLayer layer : layers)
+        {
+            const size_t                     layerIndex = static_cast<size_t>(layer);
+            const ChunkMeshLayerPatch&       layerPatch = patch.layers[layerIndex];
+            const ChunkBatchChunkLayerSlice& layerSlice = runtimeSlice.GetLayerSlice(layer);
+            if (layerSlice.indexCount != layerPatch.oldQuadCount * 6u || layerPatch.newQuadCount * 6u > layerSlice.reservedIndexCount)
+            {
+                return reject();
+            }
+
+            oldVertexBase[layerIndex] = oldVertexCount;
+            newVertexBase[layerIndex] = newVertexCount;
+            oldVertexCount += layerPatch.oldQuadCount * 4u;
+            newVertexCount += layerPatch.newQuadCount * 4u;
+        }
+
+        if (newVertexCount == 0u || newVertexCount > runtimeSlice.vertexAllocation.elementCount)
+        {
+            return reject();
+        }
+
+        const ChunkBatchChunkBuildOutput chunkOutput = ChunkBatchRegionBuilder::BuildChunkGeometry(chunk, region.id);
+        if (chunkOutput.vertices.size() != newVertexCount)
+        {
+            return reject();
+        }
+
+        // Dirty ranges per layer, in quads. A layer whose base moved is rewritten whole; a layer whose
+        // count changed is rewritten from the splice to the old or new end (indices after it shift);
+        // otherwise only the replaced range changes.
+        uint32_t vertexBegin = newVertexCount;
+        uint32_t vertexEnd   = 0u;
+        uint32_t indexBeginQuad[3] = {};
+        uint32_t indexEndQuad[3]   = {};
+        for (ChunkBatchLayer layer : layers)
+        {
+            const size_t               layerIndex   = static_cast<size_t>(layer);
+            const ChunkMeshLayerPatch& layerPatch   = patch.layers[layerIndex];
+            const bool                 baseMoved    = oldVertexBase[layerIndex] != newVertexBase[layerIndex];
+            const bool                 countChanged = layerPatch.oldQuadCount != layerPatch.newQuadCount;
+
+            const uint32_t firstQuad     = baseMoved ? 0u : layerPatch.firstQuad;
+            const uint32_t vertexEndQuad = (baseMoved || countChanged) ? layerPatch.newQuadCount : layerPatch.newEndQuad;
+            if (firstQuad < vertexEndQuad)
+            {
+                vertexBegin = (std::min)(vertexBegin, newVertexBase[layerIndex] + firstQuad * 4u);
+                vertexEnd   = (std::max)(vertexEnd, newVertexBase[layerIndex] + vertexEndQuad * 4u);
+            }
+
+            indexBeginQuad[layerIndex] = firstQuad;
+            indexEndQuad[layerIndex]   = (baseMoved || countChanged) ? (std::max)(layerPatch.oldQuadCount, layerPatch.newQuadCount) : layerPatch.newEndQuad;
+        }
+
+        BufferTransferBatch patchBatch = {};
+        patchBatch.workload       = enigma::graphic::QueueWorkloadClass::ChunkGeometryUpload;
+        patchBatch.preferredQueue = CommandQueueType::Copy;
+
+        if (vertexBegin < vertexEnd)
+        {
+            const ChunkBatchArenaAllocation absoluteVertexAllocation = MakeAbsoluteAllocation(
+                region.geometry.vertexAllocation,
+                runtimeSlice.vertexAllocation.startElement + vertexBegin,
+                vertexEnd - vertexBegin);
+            if (!ValidateUploadRange(m_vertexArena.buffer, absoluteVertexAllocation, sizeof(TerrainVertex), vertexEnd - vertexBegin))
+            {
+                return reject();
+            }
+
+            AppendTransitionIfMissing(
+                patchBatch.preTransferTransitions,
+                m_vertexArena.buffer.get(),
+                D3D12_RESOURCE_STATE_COPY_DEST,
+                D3D12_RESOURCE_STATE_GENERIC_READ,
+                "ChunkBatchVertexArena");
+            AppendTransitionIfMissing(
+                patchBatch.postTransferTransitions,
+                m_vertexArena.buffer.get(),
+                D3D12_RESOURCE_STATE_COPY_DEST,
+                D3D12_RESOURCE_STATE_GENERIC_READ,
+                "ChunkBatchVertexArena");
+            patchBatch.uploadSpans.push_back(BufferUploadSpan{
+                m_vertexArena.buffer.get(),
+                ComputeByteOffset(absoluteVertexAllocation, sizeof(TerrainVertex)),
+                chunkOutput.vertices.data() + vertexBegin,
+                ComputeByteSize(vertexEnd - vertexBegin, sizeof(TerrainVertex))
+            });
+        }
+
+        std::vector<uint32_t> indexUploads[3];
+        for (ChunkBatchLayer layer : layers)
+        {
+            const size_t layerIndex = static_cast<size_t>(layer);
+            if (indexBeginQuad[layerIndex] >= indexEndQuad[layerIndex])
+            {
+                continue;
+            }
+
+            // Indices past the new count become degenerate, as in slice replacement
+            const ChunkBatchChunkLayerSlice& layerSlice    = runtimeSlice.GetLayerSlice(layer);
+            const std::vector<uint32_t>&     sourceIndices = chunkOutput.GetIndicesForLayer(layer);
+            const uint32_t                   indexBegin    = indexBeginQuad[layerIndex] * 6u;
+            const uint32_t                   indexEnd      = indexEndQuad[layerIndex] * 6u;
+            std::vector<uint32_t>&           layerUpload   = indexUploads[layerIndex];
+            layerUpload.assign(indexEnd - indexBegin, runtimeSlice.vertexAllocation.startElement);
+            for (uint32_t indexOffset = indexBegin; indexOffset < (std::min)(indexEnd, static_cast<uint32_t>(sourceIndices.size())); ++indexOffset)
+            {
+                layerUpload[indexOffset - indexBegin] = runtimeSlice.vertexAllocation.startElement + sourceIndices[indexOffset];
+            }
+
+            const ChunkBatchArenaAllocation absoluteIndexAllocation = MakeAbsoluteAllocation(
+                region.geometry.indexAllocation,
+                layerSlice.startIndex + indexBegin,
+                indexEnd - indexBegin);
+            if (!ValidateUploadRange(m_indexArena.buffer, absoluteIndexAllocation, sizeof(uint32_t), layerUpload.size()))
+            {
+                return reject();
+            }
+
+            AppendTransitionIfMissing(
+                patchBatch.preTransferTransitions,
+                m_indexArena.buffer.get(),
+                D3D12_RESOURCE_STATE_COPY_DEST,
+                D3D12_RESOURCE_STATE_GENERIC_READ,
+                "ChunkBatchIndexArena");
+            AppendTransitionIfMissing(
+                patchBatch.postTransferTransitions,
+                m_indexArena.buffer.get(),
+                D3D12_RESOURCE_STATE_COPY_DEST,
+                D3D12_RESOURCE_STATE_GENERIC_READ,
+                "ChunkBatchIndexArena");
+            patchBatch.uploadSpans.push_back(BufferUploadSpan{
+                m_indexArena.buffer.get(),
+                ComputeByteOffset(absoluteIndexAllocation, sizeof(uint32_t)),
+                layerUpload.data(),
+                ComputeByteSize(static_cast<uint32_t>(layerUpload.size()), sizeof(uint32_t))
+            });
+        }
+
+        if (!ExecuteUploadBatchAndWait(patchBatch))
+        {
+            // Ranges may be half-written; the caller's fallback replaces the whole slice
+            region.dirtyChunkKeys.insert(chunkKey);
+            return reject();
+        }
+
+        for (ChunkBatchLayer layer : layers)
+        {
+            runtimeSlice.GetLayerSlice(layer).indexCount = patch.layers[static_cast<size_t>(layer)].newQuadCount * 6u;
+        }
+        RebuildRegionDrawRangesFromChunkSlices(region);
+
+        uint64_t replacementBytes = ComputeByteSize(newVertexCount, sizeof(TerrainVertex));
+        for (ChunkBatchLayer layer : layers)
+        {
+            replacementBytes += ComputeByteSize(runtimeSlice.GetLayerSlice(layer).reservedIndexCount, sizeof(uint32_t));
+        }
+
+        uploadDiagnostics.lastPatchUploadBytes      = SumUploadBytes(patchBatch);
+        uploadDiagnostics.lastPatchReplacementBytes = replacementBytes;
+        uploadDiagnostics.patchUploadBytesLifetime += uploadDiagnostics.lastPatchUploadBytes;
+        uploadDiagnostics.patchReplacementBytesLifetime += replacementBytes;
+        uploadDiagnostics.patchCountLifetime++;
+
+        // A worker build in flight snapshotted the pre-patch mesh; drop it and rebuild from current meshes
+        if (region.pendingBuildGeneration != 0)
+        {
+            EnqueueDirtyRegion(region.id);
+        }
+        return true;
+    }
+
+    bool ChunkRenderRegionStorage::IsChunkGeometryCurrent(const IntVec2& chunkCoords) const
+    {
+        const int64_t chunkKey  = GetChunkKey(chunkCoords);
+        auto          mappingIt = m_chunkToRegion.find(chunkKey);
+        if (mappingIt == m_chunkToRegion.end())
+        {
+            return false;
+        }
+
+        auto regionIt = m_regions.find(mappingIt->second);
+        return regionIt != m_regions.end() &&
+            regionIt->second.geometry.gpuDataValid &&
+            regionIt->second.dirtyChunkKeys.count(chunkKey) == 0;
+    }
+
     void ChunkRenderRegionStorage::MarkChunkDirty(const IntVec2& chunkCoords)
     {
         const ChunkBatchRegionId regionId = GetChunkBatchRegionIdForChunk(chunkCoords);
@@ -1713,13 +1999,23 @@ namespace enigma::voxel
             return 0;
         }
 
-        uint32_t rebuiltRegionCount = 0;
-        while (rebuiltRegionCount < maxRegionsPerFrame && !m_dirtyRegionQueue.empty())
+        ENGINE_PROFILE_SCOPE("ChunkRenderRegionStorage::RebuildDirtyRegions");
+        // One budget for commits and new work: a commit costs an arena upload, a dirty region a patch,
+        // a snapshot or a synchronous build. Commits first, so finished work is never starved.
+        uint32_t rebuiltRegionCount   = CommitCompletedRegionBuilds(maxRegionsPerFrame);
+        uint32_t processedRegionCount = rebuiltRegionCount;
+        while (processedRegionCount < maxRegionsPerFrame && !m_dirtyRegionQueue.empty())
         {
             const ChunkBatchRegionId regionId = m_dirtyRegionQueue.front();
             m_dirtyRegionQueue.pop_front();
             m_dirtyRegionSet.erase(regionId);
-            if (RebuildRegionInternal(regionId))
+
+            const RegionRebuildResult result = RebuildRegionInternal(regionId, m_asyncRegionBuildsEnabled);
+            if (result != RegionRebuildResult::Skipped)
+            {
+                processedRegionCount++;
+            }
+            if (result == RegionRebuildResult::Rebuilt)
             {
                 rebuiltRegionCount++;
             }
@@ -1735,7 +2031,7 @@ namespace enigma::voxel
         for (const ChunkBatchRegionId& regionId : regionIds)
         {
             RemoveQueuedDirtyRegion(regionId);
-            if (RebuildRegionInternal(regionId))
+            if (RebuildRegionInternal(regionId, false) == RegionRebuildResult::Rebuilt)
             {
                 rebuiltRegionCount++;
             }
@@ -1744,15 +2040,16 @@ namespace enigma::voxel
         return rebuiltRegionCount;
     }
 
-    bool ChunkRenderRegionStorage::RebuildRegionInternal(const ChunkBatchRegionId& regionId)
+    ChunkRenderRegionStorage::RegionRebuildResult ChunkRenderRegionStorage::RebuildRegionInternal(const ChunkBatchRegionId& regionId, bool allowAsync)
     {
         auto regionIt = m_regions.find(regionId);
         if (regionIt == m_regions.end())
         {
-            return false;
+            return RegionRebuildResult::Skipped;
         }
 
-        ChunkRenderRegion& region = regionIt->second;
+        const auto         buildStart = std::chrono::steady_clock::now();
+        ChunkRenderRegion& region     = regionIt->second;
         region.dirty = false;
 
         std::vector<const Chunk*> sourceChunks = GatherRegionChunks(region);
@@ -1760,7 +2057,7 @@ namespace enigma::voxel
         {
             ClearRegionGeometry(region, false);
             m_regions.erase(regionIt);
-            return true;
+            return RegionRebuildResult::Rebuilt;
         }
 
         if (region.geometry.gpuDataValid &&
@@ -1773,7 +2070,7 @@ namespace enigma::voxel
             ChunkBatchArenaFallbackReason fallbackReason = ChunkBatchArenaFallbackReason::None;
             if (TryApplyDirtyChunkReplacements(region, fallbackReason))
             {
-                return true;
+                return RegionRebuildResult::Rebuilt;
             }
 
             if (fallbackReason != ChunkBatchArenaFallbackReason::None)
@@ -1782,33 +2079,171 @@ namespace enigma::voxel
             }
         }
 
+        if (allowAsync && SubmitRegionBuildTask(region, sourceChunks))
+        {
+            return RegionRebuildResult::Submitted;
+        }
+
+        // Synchronous build supersedes any worker build still in flight for this region
+        BumpRegionBuildGeneration(region);
         const ChunkBatchRegionBuildOutput buildOutput = ChunkBatchRegionBuilder::BuildRegionGeometry(
             ChunkBatchRegionBuildInput{regionId, sourceChunks});
         const bool commitSucceeded = CommitBuildOutput(region, buildOutput);
 
-        if (commitSucceeded && m_world != nullptr)
+        if (commitSucceeded)
         {
-            for (const Chunk* sourceChunk : sourceChunks)
-            {
-                Chunk* mutableChunk = const_cast<Chunk*>(sourceChunk);
-                if (mutableChunk == nullptr || !mutableChunk->IsActive())
-                {
-                    continue;
-                }
+            ReleaseSourceChunkGpuBuffers(region);
+        }
 
-                ChunkMesh* chunkMesh = mutableChunk->GetChunkMesh();
-                if (chunkMesh == nullptr)
-                {
-                    continue;
-                }
+        m_regionBuildDiagnostics.syncBuildCountLifetime++;
+        m_regionBuildDiagnostics.lastSyncBuildMainThreadUs = GetElapsedMicroseconds(buildStart);
+        m_regionBuildDiagnostics.syncBuildMainThreadUsLifetime += m_regionBuildDiagnostics.lastSyncBuildMainThreadUs;
+        return RegionRebuildResult::Rebuilt;
+    }
 
-                chunkMesh->ReleaseGpuBuffers(true, true, true);
-            }
+    bool ChunkRenderRegionStorage::SubmitRegionBuildTask(ChunkRenderRegion& region, const std::vector<const Chunk*>& sourceChunks)
+    {
+        if (g_theSchedule == nullptr)
+        {
+            return false;
+        }
+
+        const auto snapshotStart = std::chrono::steady_clock::now();
+        ChunkBatchRegionBuildSnapshot snapshot = ChunkBatchRegionBuilder::CaptureRegionSnapshot(
+            ChunkBatchRegionBuildInput{region.id, sourceChunks},
+            region.buildGeneration);
+        auto* task = new ChunkBatchRegionBuildTask(std::move(snapshot));
+
+        enigma::core::TaskSubmissionOptions options;
+        options.supportsCancellation = true;
+        options.taskKey              = enigma::voxel::MakeChunkBatchRegionBuildTaskKey(region.id);
+        options.version              = region.buildGeneration;
+        options.keyedPolicy          = enigma::core::KeyedTaskPolicy::LatestOnly;
+
+        const enigma::core::TaskHandle handle = g_theSchedule->SubmitTask(task, options);
+        if (!handle.IsValid())
+        {
+            delete task;
+            ERROR_RECOVERABLE(Stringf("ChunkRenderRegionStorage: Failed to submit region build task for region (%d, %d), building synchronously",
+                region.id.regionCoords.x,
+                region.id.regionCoords.y));
+            return false;
         }
 
+        region.pendingBuildGeneration = region.buildGeneration;
+        m_regionBuildDiagnostics.submittedCountLifetime++;
+        m_regionBuildDiagnostics.inFlightCount++;
+        m_regionBuildDiagnostics.lastSnapshotMainThreadUs = GetElapsedMicroseconds(snapshotStart);
+        m_regionBuildDiagnostics.snapshotMainThreadUsLifetime += m_regionBuildDiagnostics.lastSnapshotMainThreadUs;
         return true;
     }
 
+    void ChunkRenderRegionStorage::OnRegionBuildTaskCompleted(const core::TaskCompletionRecord& record, ChunkBatchRegionBuildTask* task)
+    {
+        if (task == nullptr)
+        {
+            return;
+        }
+
+        if (m_regionBuildDiagnostics.inFlightCount > 0)
+        {
+            m_regionBuildDiagnostics.inFlightCount--;
+        }
+
+        const ChunkBatchRegionId regionId   = task->GetRegionId();
+        const uint64_t           generation = task->GetGeneration();
+        auto                     regionIt   = m_regions.find(regionId);
+        ChunkRenderRegion*       region     = regionIt != m_regions.end() ? &regionIt->second : nullptr;
+        if (region != nullptr && region->pendingBuildGeneration == generation)
+        {
+            region->pendingBuildGeneration = 0;
+        }
+
+        std::shared_ptr<const ChunkBatchRegionBuildOutput> output = task->TakeResult();
+        const bool completedNormally =
+            record.finalState == core::TaskState::Completed &&
+            !record.isStale &&
+            record.policyDecision == core::TaskPolicyDecision::Executed &&
+            output != nullptr;
+        if (completedNormally)
+        {
+            m_completedRegionBuilds.push_back(CompletedRegionBuild{regionId, generation, std::move(output)});
+            return;
+        }
+
+        if (region == nullptr || region->buildGeneration != generation)
+        {
+            m_regionBuildDiagnostics.discardedStaleCountLifetime++;
+            return;
+        }
+
+        // Nothing newer is queued for this region: retry from its current meshes
+        m_regionBuildDiagnostics.discardedFailedCountLifetime++;
+        EnqueueDirtyRegion(regionId);
+    }
+
+    uint32_t ChunkRenderRegionStorage::CommitCompletedRegionBuilds(uint32_t maxRegions)
+    {
+        uint32_t committedRegionCount = 0;
+        while (committedRegionCount < maxRegions && !m_completedRegionBuilds.empty())
+        {
+            const CompletedRegionBuild completed = std::move(m_completedRegionBuilds.front());
+            m_completedRegionBuilds.pop_front();
+
+            auto regionIt = m_regions.find(completed.regionId);
+            if (regionIt == m_regions.end() || regionIt->second.buildGeneration != completed.generation)
+            {
+                m_regionBuildDiagnostics.discardedStaleCountLifetime++;
+                continue;
+            }
+
+            const auto         commitStart = std::chrono::steady_clock::now();
+            ChunkRenderRegion& region      = regionIt->second;
+            if (CommitBuildOutput(region, *completed.output))
+            {
+                ReleaseSourceChunkGpuBuffers(region);
+            }
+
+            m_regionBuildDiagnostics.committedCountLifetime++;
+            m_regionBuildDiagnostics.lastCommitMainThreadUs = GetElapsedMicroseconds(commitStart);
+            m_regionBuildDiagnostics.commitMainThreadUsLifetime += m_regionBuildDiagnostics.lastCommitMainThreadUs;
+            committedRegionCount++;
+        }
+
+        return committedRegionCount;
+    }
+
+    void ChunkRenderRegionStorage::ReleaseSourceChunkGpuBuffers(const ChunkRenderRegion& region)
+    {
+        if (m_world == nullptr)
+        {
+            return;
+        }
+
+        // Region geometry now draws these chunks; their per-chunk buffers are no longer needed
+        for (int64_t chunkKey : region.chunkKeys)
+        {
+            int32_t chunkX = 0;
+            int32_t chunkY = 0;
+            ChunkHelper::UnpackCoordinates(chunkKey, chunkX, chunkY);
+
+            Chunk* chunk = m_world->GetChunk(chunkX, chunkY);
+            if (chunk == nullptr || !chunk->IsActive())
+            {
+                continue;
+            }
+
+            // Checked first so meshes a region snapshot still shares are not copied for nothing
+            const ChunkMesh* chunkMesh = chunk->GetChunkMesh();
+            if (chunkMesh == nullptr || !chunkMesh->HasGpuBuffers())
+            {
+                continue;
+            }
+
+            chunk->GetMutableChunkMesh()->ReleaseGpuBuffers(true, true, true);
+        }
+    }
+
     ChunkRenderRegion* ChunkRenderRegionStorage::GetRegion(const ChunkBatchRegionId& id)
     {
         const auto it = m_regions.find(id);
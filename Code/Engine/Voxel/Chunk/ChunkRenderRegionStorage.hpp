@@ -9,6 +9,11 @@
 #include "ChunkBatchTypes.hpp"
 #include "Engine/Graphic/Resource/CommandQueueTypes.hpp"
 
+namespace enigma::core
+{
+    struct TaskCompletionRecord;
+}
+
 namespace enigma::graphic
 {
     struct TerrainVertex;
@@ -18,7 +23,9 @@ namespace enigma::voxel
 {
     class Chunk;
     class World;
+    class ChunkBatchRegionBuildTask;
     struct ChunkBatchRegionBuildOutput;
+    struct ChunkMeshSectionPatch;
 
     struct ChunkBatchChunkRuntimeSlice
     {
@@ -61,6 +68,8 @@ namespace enigma::voxel
         std::unordered_set<int64_t>               dirtyChunkKeys;
         bool                                      dirty = false;
         bool                                      buildFailed = false;
+        uint64_t                                  buildGeneration = 0;        // Bumped on every change; older worker results are dropped
+        uint64_t                                  pendingBuildGeneration = 0; // Generation of the newest worker build in flight, 0 if none
 
         bool HasResidentChunks() const
         {
@@ -128,9 +137,41 @@ namespace enigma::voxel
         void NotifyChunkMeshReady(Chunk* chunk);
         void NotifyChunkUnloaded(const IntVec2& chunkCoords);
 
+        /**
+         * @brief Upload a ChunkMesh::ReplaceSections splice into the chunk's resident arena slice
+         *
+         * Writes only the vertex and index ranges the splice moved, in place, when the region is
+         * current for this chunk, the GPU is idle, and the new layer counts fit the slice's
+         * reserved capacity. Returns false without touching anything otherwise; the caller then
+         * falls back to NotifyChunkMeshReady (slice replacement or region rebuild).
+         */
+        bool TryApplyChunkMeshPatch(const Chunk& chunk, const ChunkMeshSectionPatch& patch);
+
+        /// True when the chunk's resident region geometry reflects its current mesh
+        bool IsChunkGeometryCurrent(const IntVec2& chunkCoords) const;
+
+        /**
+         * @brief Commit finished worker builds, then start builds for queued dirty regions
+         *
+         * With async builds enabled, full region rebuilds snapshot the chunk meshes here and assemble
+         * on scheduler workers; results are committed (arena allocation, upload, swap) on a later
+         * call. Results whose region changed after the snapshot are dropped.
+         * maxRegionsPerFrame is one budget for the whole call: commits are taken first, whatever is
+         * left goes to dirty regions (patches, submissions, synchronous rebuilds). Returns the number
+         * of regions whose geometry changed this call.
+         */
         uint32_t RebuildDirtyRegions(uint32_t maxRegionsPerFrame);
+        /// Always synchronous; supersedes any worker build in flight for these regions
         uint32_t RebuildRegionsNow(const std::vector<ChunkBatchRegionId>& regionIds);
 
+        /// Enable worker region builds; the owner turns this off when no mesh worker threads exist
+        void SetAsyncRegionBuildsEnabled(bool enabled) { m_asyncRegionBuildsEnabled = enabled; }
+        bool IsAsyncRegionBuildsEnabled() const { return m_asyncRegionBuildsEnabled; }
+        /// Owner's scheduler drain hands every ChunkBatchRegionBuildTask record here; the owner deletes the task
+        void OnRegionBuildTaskCompleted(const core::TaskCompletionRecord& record, ChunkBatchRegionBuildTask* task);
+        /// Worker builds whose completion record has not been drained yet
+        bool HasPendingRegionBuilds() const { return m_regionBuildDiagnostics.inFlightCount > 0; }
+
         ChunkRenderRegion*       GetRegion(const ChunkBatchRegionId& id);
         const ChunkRenderRegion* GetRegion(const ChunkBatchRegionId& id) const;
 
@@ -144,12 +185,25 @@ namespace enigma::voxel
         uint32_t GetIndexArenaCapacity() const { return m_indexArena.capacityIndices; }
         uint32_t GetIndexArenaRemainingCapacity() const;
         const ChunkBatchArenaDiagnostics& GetArenaDiagnostics() const { return m_arenaDiagnostics; }
+        const ChunkBatchRegionBuildDiagnostics& GetRegionBuildDiagnostics() const { return m_regionBuildDiagnostics; }
 
     private:
-        // First-version arena growth, buffer mutation, and active region publication stay synchronous on
-        // the owning thread. Future async reuse is limited to CPU-only planning / metadata staging and
-        // must re-enter through the modern ScheduleSubsystem completion path before any GPU state changes.
-        static constexpr const char* kFutureArenaPlanningTaskDomain = "chunk-batch-arena-region";
+        // Region assembly (mesh collection, layer slices, bounds, CPU buffers) runs on ScheduleSubsystem
+        // workers and re-enters through the completion path as an immutable result. Arena growth,
+        // relocation, buffer mutation and active region publication stay synchronous on the owning thread.
+        enum class RegionRebuildResult : uint8_t
+        {
+            Skipped,   // Region no longer exists
+            Rebuilt,   // Geometry replaced, patched or cleared synchronously
+            Submitted  // Snapshot handed to a worker; committed by a later RebuildDirtyRegions
+        };
+
+        struct CompletedRegionBuild
+        {
+            ChunkBatchRegionId                                 regionId;
+            uint64_t                                           generation = 0;
+            std::shared_ptr<const ChunkBatchRegionBuildOutput> output;
+        };
 
         ChunkRenderRegion& EnsureRegion(const ChunkBatchRegionId& regionId);
         void               EnqueueDirtyRegion(const ChunkBatchRegionId& regionId);
@@ -158,7 +212,11 @@ namespace enigma::voxel
         void               ReleaseRegionArenaAllocations(ChunkRenderRegion& region);
         bool               CommitBuildOutput(ChunkRenderRegion& region, const ChunkBatchRegionBuildOutput& buildOutput);
         std::vector<const Chunk*> GatherRegionChunks(ChunkRenderRegion& region);
-        bool               RebuildRegionInternal(const ChunkBatchRegionId& regionId);
+        RegionRebuildResult RebuildRegionInternal(const ChunkBatchRegionId& regionId, bool allowAsync);
+        bool               SubmitRegionBuildTask(ChunkRenderRegion& region, const std::vector<const Chunk*>& sourceChunks);
+        uint32_t           CommitCompletedRegionBuilds(uint32_t maxRegions);
+        void               ReleaseSourceChunkGpuBuffers(const ChunkRenderRegion& region);
+        void               BumpRegionBuildGeneration(ChunkRenderRegion& region);
         bool               TryApplyDirtyChunkReplacements(ChunkRenderRegion& region, ChunkBatchArenaFallbackReason& outFallbackReason);
         bool               AllocateVertexArenaSlice(uint32_t vertexCount, ChunkBatchArenaAllocation& outAllocation);
         bool               AllocateIndexArenaSlice(uint32_t indexCount, ChunkBatchArenaAllocation& outAllocation);
@@ -197,5 +255,9 @@ namespace enigma::voxel
         ChunkBatchArenaDiagnostics                        m_arenaDiagnostics;
         uint32_t                                          m_replacementUploadCount = 0;
         uint32_t                                          m_replacementFallbackCount = 0;
+        bool                                              m_asyncRegionBuildsEnabled = false;
+        uint64_t                                          m_lastRegionBuildGeneration = 0; // Storage-wide, so a re-created region never matches an old result
+        std::deque<CompletedRegionBuild>                  m_completedRegionBuilds;
+        ChunkBatchRegionBuildDiagnostics                  m_regionBuildDiagnostics;
     };
 }
@@ -80,6 +80,20 @@ namespace enigma::voxel
             return false;
         }
 
+        /**
+         * @brief 从内存映射等外部缓冲区反序列化区块（零拷贝加载路径）
+         * @param chunk 要填充数据的区块
+         * @param data 输入数据起始地址（调用期间必须保持有效）
+         * @param size 输入数据字节数
+         * @return 反序列化是否成功
+         *
+         * 默认实现复制到vector后调用上面的重载；支持直接解码的序列化器应覆盖此方法。
+         */
+        virtual bool DeserializeChunk(Chunk* chunk, const uint8_t* data, size_t size)
+        {
+            return DeserializeChunk(chunk, std::vector<uint8_t>(data, data + size));
+        }
+
         virtual std::string GetSupportedVersion() const { return "SimpleMiner-1.0"; }
     };
 
@@ -134,5 +148,16 @@ namespace enigma::voxel
             UNUSED(chunkY)
             return false;
         }
+
+        /**
+         * @brief 提示存储即将加载该区块（预读文件页到页缓存）
+         *
+         * 在区块进入加载队列时调用，磁盘读取与队列等待重叠。默认不做任何事。
+         */
+        virtual void PrefetchChunk(int32_t chunkX, int32_t chunkY)
+        {
+            UNUSED(chunkX)
+            UNUSED(chunkY)
+        }
     };
 }
@@ -71,6 +71,11 @@ namespace enigma::voxel
         config.enableCompression = true;
         config.compressionLevel  = 3;
         config.maxCachedRegions  = 16;
+        config.memoryMappedLoad  = true;
+        config.prefetchOnQueue   = true;
+        config.writeBehindMaxPendingMB      = 16;
+        config.writeBehindMaxPendingSeconds = 10.0f;
+        config.writeBehindBatchSize         = 64;
         config.autoSaveEnabled   = true;
         config.autoSaveInterval  = 300.0f;
         config.baseSavePath      = ".enigma/saves";
@@ -132,6 +137,30 @@ namespace enigma::voxel
                 config.maxCachedRegions = static_cast<size_t>(yaml.GetInt("chunk_storage.cache.max_regions", 16));
             }
 
+            // Load I/O
+            if (yaml.IsSet("chunk_storage.io.memory_mapped_load"))
+            {
+                config.memoryMappedLoad = yaml.GetBoolean("chunk_storage.io.memory_mapped_load", true);
+            }
+            if (yaml.IsSet("chunk_storage.io.prefetch_on_queue"))
+            {
+                config.prefetchOnQueue = yaml.GetBoolean("chunk_storage.io.prefetch_on_queue", true);
+            }
+
+            // Write-Behind Saves
+            if (yaml.IsSet("chunk_storage.write_behind.max_pending_mb"))
+            {
+                config.writeBehindMaxPendingMB = static_cast<size_t>(yaml.GetInt("chunk_storage.write_behind.max_pending_mb", 16));
+            }
+            if (yaml.IsSet("chunk_storage.write_behind.max_pending_seconds"))
+            {
+                config.writeBehindMaxPendingSeconds = yaml.GetFloat("chunk_storage.write_behind.max_pending_seconds", 10.0f);
+            }
+            if (yaml.IsSet("chunk_storage.write_behind.batch_size"))
+            {
+                config.writeBehindBatchSize = static_cast<size_t>(yaml.GetInt("chunk_storage.write_behind.batch_size", 64));
+            }
+
             // Auto-Save
             if (yaml.IsSet("chunk_storage.auto_save.enabled"))
             {
@@ -184,6 +213,13 @@ namespace enigma::voxel
 
             yaml.Set("chunk_storage.cache.max_regions", static_cast<int>(maxCachedRegions));
 
+            yaml.Set("chunk_storage.io.memory_mapped_load", memoryMappedLoad);
+            yaml.Set("chunk_storage.io.prefetch_on_queue", prefetchOnQueue);
+
+            yaml.Set("chunk_storage.write_behind.max_pending_mb", static_cast<int>(writeBehindMaxPendingMB));
+            yaml.Set("chunk_storage.write_behind.max_pending_seconds", writeBehindMaxPendingSeconds);
+            yaml.Set("chunk_storage.write_behind.batch_size", static_cast<int>(writeBehindBatchSize));
+
             yaml.Set("chunk_storage.auto_save.enabled", autoSaveEnabled);
             yaml.Set("chunk_storage.auto_save.interval", autoSaveInterval);
 
@@ -222,6 +258,14 @@ namespace enigma::voxel
             return false;
         }
 
+        // Validate write-behind limits
+        if (writeBehindMaxPendingMB > 1024 || writeBehindMaxPendingSeconds < 0.0f || writeBehindBatchSize < 1)
+        {
+            LogError(LogChunkSave, "Invalid write-behind limits: %zu MB, %.1f s, batch %zu (max 1024 MB, batch >= 1)",
+                     writeBehindMaxPendingMB, writeBehindMaxPendingSeconds, writeBehindBatchSize);
+            return false;
+        }
+
         // Validate auto-save interval
         if (autoSaveEnabled && (autoSaveInterval < 10.0f || autoSaveInterval > 3600.0f))
         {
@@ -248,6 +292,10 @@ namespace enigma::voxel
         oss << "  compression: " << (enableCompression ? "enabled" : "disabled")
             << " (level " << compressionLevel << ")\n";
         oss << "  maxCachedRegions: " << maxCachedRegions << "\n";
+        oss << "  memoryMappedLoad: " << (memoryMappedLoad ? "enabled" : "disabled")
+            << ", prefetchOnQueue: " << (prefetchOnQueue ? "enabled" : "disabled") << "\n";
+        oss << "  writeBehind: " << writeBehindMaxPendingMB << " MB, " << writeBehindMaxPendingSeconds
+            << "s, batch " << writeBehindBatchSize << "\n";
         oss << "  autoSave: " << (autoSaveEnabled ? "enabled" : "disabled")
             << " (interval " << autoSaveInterval << "s)\n";
         oss << "  baseSavePath: " << baseSavePath << "\n";
@@ -55,6 +55,19 @@ namespace enigma::voxel
         //-------------------------------------------------------------------------------------------
         size_t maxCachedRegions = 16;
 
+        //-------------------------------------------------------------------------------------------
+        // Load I/O (ESFS format only)
+        //-------------------------------------------------------------------------------------------
+        bool memoryMappedLoad = true; // Decode from a file mapping instead of reading into a buffer
+        bool prefetchOnQueue  = true; // Start page-cache readahead when a chunk enters the load queue
+
+        //-------------------------------------------------------------------------------------------
+        // Write-Behind Saves (ESFS format only, see ChunkWriteBehindQueue)
+        //-------------------------------------------------------------------------------------------
+        size_t writeBehindMaxPendingMB      = 16; // Serialized saves held in memory before forcing writes
+        float  writeBehindMaxPendingSeconds = 10.0f; // Oldest save age before it is written
+        size_t writeBehindBatchSize         = 64; // Chunks written per background batch
+
         //-------------------------------------------------------------------------------------------
         // Auto-Save
         //-------------------------------------------------------------------------------------------
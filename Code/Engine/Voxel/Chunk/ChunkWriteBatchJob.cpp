@@ -0,0 +1,29 @@
+#include "ChunkWriteBatchJob.hpp"
+#include "Engine/Voxel/World/ESFSWorldStorage.hpp"
+
+namespace enigma::voxel
+{
+    ChunkWriteBatchJob::ChunkWriteBatchJob(ChunkWriteBehindQueue* queue, ChunkWriteBatch&& batch, ESFSChunkStorage* storage)
+        : RunnableTask(enigma::core::TaskTypeConstants::FILE_IO)
+          , m_queue(queue)
+          , m_storage(storage)
+          , m_batch(std::move(batch))
+    {
+    }
+
+    void ChunkWriteBatchJob::Execute()
+    {
+        // A cancelled batch is requeued by the main thread when the completion record is drained
+        if (IsCancellationRequested())
+        {
+            return;
+        }
+
+        m_queue->WriteBatch(m_batch, [this](IntVec2 coords, const std::vector<uint8_t>& payload)
+        {
+            return m_storage->WriteSerializedChunk(coords.x, coords.y, payload);
+        });
+        m_queue->CompleteBatch(std::move(m_batch));
+        m_completed = true;
+    }
+} // namespace enigma::voxel
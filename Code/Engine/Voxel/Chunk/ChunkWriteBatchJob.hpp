@@ -0,0 +1,31 @@
+#pragma once
+#include "Engine/Core/Schedule/RunnableTask.hpp"
+#include "Engine/Voxel/World/ChunkWriteBehindQueue.hpp"
+
+namespace enigma::voxel
+{
+    class ESFSChunkStorage;
+
+    //-----------------------------------------------------------------------------------------------
+    // Job for writing one ChunkWriteBehindQueue batch on FileIO threads
+    // IO-intensive work: one atomic temp-file + rename commit per chunk, in batch (coordinate) order
+    // The payloads are already serialized, so the job never touches live chunks
+    //-----------------------------------------------------------------------------------------------
+    class ChunkWriteBatchJob : public enigma::core::RunnableTask
+    {
+    public:
+        ChunkWriteBatchJob(ChunkWriteBehindQueue* queue, ChunkWriteBatch&& batch, ESFSChunkStorage* storage);
+
+        void Execute() override;
+
+        // Main thread: a job cancelled before running still owns its batch and must return it to the queue
+        bool            IsCompleted() const { return m_completed; }
+        ChunkWriteBatch TakeBatch() { return std::move(m_batch); }
+
+    private:
+        ChunkWriteBehindQueue* m_queue; // Owned by World, outlives the job
+        ESFSChunkStorage*      m_storage; // Owned by World, outlives the job
+        ChunkWriteBatch        m_batch;
+        bool                   m_completed = false; // Batch was written and handed back to the queue
+    };
+} // namespace enigma::voxel
@@ -2,6 +2,8 @@
 #include "Chunk.hpp"
 #include "../../Registry/Block/BlockRegistry.hpp"
 #include "../../Core/Logger/LoggerAPI.hpp"
+#include "../../Core/Buffer/BitStream.hpp"
+#include <algorithm>
 #include <cstring>
 
 namespace enigma::voxel
@@ -37,26 +39,36 @@ namespace enigma::voxel
             return false;
         }
 
-        // Step 3: Prepend header
+        // Step 3: Pack heightmaps
+        std::vector<uint8_t> heightmapData;
+        WriteHeightmaps(chunk, heightmapData);
+
+        // Step 4: Prepend header
         Header header; // Already initialized with correct values
         outData.clear();
-        outData.reserve(sizeof(Header) + rleData.size());
+        outData.reserve(sizeof(Header) + heightmapData.size() + rleData.size());
 
         // Write header (8 bytes)
         outData.insert(outData.end(),
                        reinterpret_cast<const uint8_t*>(&header),
                        reinterpret_cast<const uint8_t*>(&header) + sizeof(Header));
 
-        // Write RLE data
+        // Write heightmaps (fixed size) followed by RLE data
+        outData.insert(outData.end(), heightmapData.begin(), heightmapData.end());
         outData.insert(outData.end(), rleData.begin(), rleData.end());
 
-        LogDebug("esfs_serializer", "Serialized chunk to %zu bytes (header 8 + RLE %zu)",
-                 outData.size(), rleData.size());
+        LogDebug("esfs_serializer", "Serialized chunk to %zu bytes (header 8 + heightmaps %zu + RLE %zu)",
+                 outData.size(), heightmapData.size(), rleData.size());
 
         return true;
     }
 
     bool ESFSChunkSerializer::DeserializeChunk(Chunk* chunk, const std::vector<uint8_t>& data)
+    {
+        return DeserializeChunk(chunk, data.data(), data.size());
+    }
+
+    bool ESFSChunkSerializer::DeserializeChunk(Chunk* chunk, const uint8_t* data, size_t size)
     {
         if (!chunk)
         {
@@ -64,42 +76,45 @@ namespace enigma::voxel
             return false;
         }
 
-        // Step 1: Validate data size (at least header)
-        if (data.size() < sizeof(Header))
+        // Step 1: Validate data size (at least header and heightmaps)
+        if (!data || size < sizeof(Header) + HEIGHTMAP_SECTION_BYTES)
         {
             LogError("esfs_serializer", "Data too small: %zu bytes (expected at least %zu)",
-                     data.size(), sizeof(Header));
+                     size, sizeof(Header) + HEIGHTMAP_SECTION_BYTES);
             return false;
         }
 
         // Step 2: Extract and validate header
         Header header;
-        std::memcpy(&header, data.data(), sizeof(Header));
+        std::memcpy(&header, data, sizeof(Header));
 
         if (!ValidateHeader(header))
         {
             return false;
         }
 
-        // Step 3: Extract RLE data (everything after header)
-        std::vector<uint8_t> rleData(data.begin() + sizeof(Header), data.end());
-
-        // Step 4: RLE decompress to block IDs
-        std::vector<int32_t> blockIDs;
-        if (!DecompressRLE(rleData, blockIDs))
+        // Step 3: Read heightmaps (applied after the blocks, see Step 5)
+        std::array<ChunkHeightmap, HEIGHTMAP_TYPE_COUNT> heightmaps;
+        if (!ReadHeightmaps(data, size, heightmaps))
         {
-            LogError("esfs_serializer", "Failed to RLE decompress data");
             return false;
         }
 
-        // Step 5: Convert block IDs back to Chunk
-        if (!DeserializeFromBlockIDs(chunk, blockIDs))
+        // Step 4: Decode RLE runs straight into the chunk's block storage (no intermediate ID array)
+        const size_t rleOffset = sizeof(Header) + HEIGHTMAP_SECTION_BYTES;
+        if (!DecodeRLEIntoChunk(chunk, data + rleOffset, size - rleOffset))
         {
-            LogError("esfs_serializer", "Failed to deserialize block IDs to chunk");
+            LogError("esfs_serializer", "Failed to RLE decode block data");
             return false;
         }
 
-        LogDebug("esfs_serializer", "Deserialized chunk from %zu bytes", data.size());
+        // Step 5: Saved heightmaps are authoritative (the bulk decode does not maintain them)
+        for (size_t t = 0; t < HEIGHTMAP_TYPE_COUNT; ++t)
+        {
+            chunk->SetHeightmap(static_cast<HeightmapType>(t), heightmaps[t]);
+        }
+
+        LogDebug("esfs_serializer", "Deserialized chunk from %zu bytes", size);
         return true;
     }
 
@@ -115,7 +130,7 @@ namespace enigma::voxel
             return false;
         }
 
-        // Allocate block ID array (16 * 16 * 128 = 32768)
+        // Allocate block ID array (16 * 16 * 256 = 65536)
         outBlockIDs.resize(Chunk::BLOCKS_PER_CHUNK);
 
         // Convert BlockState pointers to Block IDs
@@ -166,74 +181,15 @@ namespace enigma::voxel
         return true;
     }
 
-    bool ESFSChunkSerializer::DeserializeFromBlockIDs(Chunk* chunk, const std::vector<int32_t>& blockIDs)
-    {
-        if (!chunk)
-        {
-            LogError("esfs_serializer", "DeserializeFromBlockIDs: chunk is null");
-            return false;
-        }
-
-        if (blockIDs.size() != Chunk::BLOCKS_PER_CHUNK)
-        {
-            LogError("esfs_serializer", "DeserializeFromBlockIDs: invalid block ID count %zu (expected %d)",
-                     blockIDs.size(), Chunk::BLOCKS_PER_CHUNK);
-            return false;
-        }
-
-        // Convert Block IDs back to BlockState pointers
-        for (int32_t z = 0; z < Chunk::CHUNK_SIZE_Z; ++z)
-        {
-            for (int32_t y = 0; y < Chunk::CHUNK_SIZE_Y; ++y)
-            {
-                for (int32_t x = 0; x < Chunk::CHUNK_SIZE_X; ++x)
-                {
-                    size_t  index   = Chunk::CoordsToIndex(x, y, z);
-                    int32_t blockId = blockIDs[index];
-
-                    // Get Block from BlockRegistry by ID
-                    auto block = BlockRegistry::GetBlockById(blockId);
-
-                    if (!block)
-                    {
-                        // Unknown block ID -> fallback to Air
-                        LogWarn("esfs_serializer", "Unknown block ID %d at (%d, %d, %d), using Air", blockId, x, y, z);
-                        block = BlockRegistry::GetBlock("air");
-
-                        if (!block)
-                        {
-                            LogError("esfs_serializer", "Critical: Air block not registered!");
-                            return false;
-                        }
-                    }
-
-                    // Get default BlockState for this Block
-                    BlockState* state = block->GetDefaultState();
-
-                    if (!state)
-                    {
-                        LogError("esfs_serializer", "Block '%s' has no default state", block->GetRegistryKey().c_str());
-                        return false;
-                    }
-
-                    // Set block in chunk (using world generation method - no modify flag)
-                    chunk->SetBlock(x, y, z, state);
-                }
-            }
-        }
-
-        return true;
-    }
-
     //-------------------------------------------------------------------------------------------
     // RLE Compression/Decompression
     //-------------------------------------------------------------------------------------------
 
     bool ESFSChunkSerializer::CompressRLE(const std::vector<int32_t>& blockIDs, std::vector<uint8_t>& outRLE)
     {
-        if (blockIDs.size() != 32768)
+        if (blockIDs.size() != static_cast<size_t>(Chunk::BLOCKS_PER_CHUNK))
         {
-            LogError("esfs_serializer", "Invalid block data size: %zu (expected 32768)", blockIDs.size());
+            LogError("esfs_serializer", "Invalid block data size: %zu (expected %d)", blockIDs.size(), Chunk::BLOCKS_PER_CHUNK);
             return false;
         }
 
@@ -249,7 +205,7 @@ namespace enigma::voxel
 
         // Clear output
         outRLE.clear();
-        outRLE.reserve(32768 * 2); // Worst case: every block is different
+        outRLE.reserve(Chunk::BLOCKS_PER_CHUNK * 2); // Worst case: every block is different
 
         // RLE encoding: [BlockType (1 byte)][RunLength (1 byte)]
         size_t i = 0;
@@ -280,60 +236,134 @@ namespace enigma::voxel
         return true;
     }
 
-    bool ESFSChunkSerializer::DecompressRLE(const std::vector<uint8_t>& rleData, std::vector<int32_t>& outBlockIDs)
+    bool ESFSChunkSerializer::DecodeRLEIntoChunk(Chunk* chunk, const uint8_t* rleData, size_t rleSize)
     {
         // Validate RLE data size (must be even: pairs of [BlockType][RunLength])
-        if (rleData.size() % 2 != 0)
+        if (rleSize % 2 != 0)
         {
-            LogError("esfs_serializer", "Invalid RLE data size: %zu (must be even)", rleData.size());
+            LogError("esfs_serializer", "Invalid RLE data size: %zu (must be even)", rleSize);
             return false;
         }
 
-        // Clear output and reserve space
-        outBlockIDs.clear();
-        outBlockIDs.reserve(32768);
-
-        // Decode RLE runs
+        // Validate the run lengths first so a corrupt file leaves the chunk untouched
         size_t totalBlocks = 0;
-        for (size_t i = 0; i < rleData.size(); i += 2)
+        for (size_t i = 0; i < rleSize; i += 2)
         {
-            uint8_t blockType = rleData[i];
-            uint8_t runLength = rleData[i + 1];
-
-            // Validate run length
-            if (runLength == 0)
+            if (rleData[i + 1] == 0)
             {
                 LogError("esfs_serializer", "Invalid RLE run length: 0 at byte offset %zu", i);
-                outBlockIDs.clear();
                 return false;
             }
+            totalBlocks += rleData[i + 1];
+        }
+
+        if (totalBlocks != static_cast<size_t>(Chunk::BLOCKS_PER_CHUNK))
+        {
+            LogError("esfs_serializer", "RLE data holds %zu blocks (expected %d)", totalBlocks, Chunk::BLOCKS_PER_CHUNK);
+            return false;
+        }
 
-            // Expand run
-            for (uint8_t j = 0; j < runLength; ++j)
+        // Each block ID is resolved to its default state once per chunk, then runs are filled directly
+        std::array<BlockState*, 256> statesById{};
+        BlockState**                 blocks = chunk->GetBlockStorageForLoad();
+        size_t                       index  = 0;
+        for (size_t i = 0; i < rleSize; i += 2)
+        {
+            const uint8_t blockId   = rleData[i];
+            const uint8_t runLength = rleData[i + 1];
+
+            BlockState*& state = statesById[blockId];
+            if (!state)
             {
-                outBlockIDs.push_back(static_cast<int32_t>(blockType));
+                state = ResolveDefaultState(blockId);
+                if (!state)
+                {
+                    return false;
+                }
             }
 
-            totalBlocks += runLength;
+            std::fill_n(blocks + index, runLength, state);
+            index += runLength;
+        }
+
+        chunk->MarkBlocksReplaced();
+        LogDebug("esfs_serializer", "RLE decoded %zu bytes -> %zu blocks", rleSize, index);
+        return true;
+    }
+
+    BlockState* ESFSChunkSerializer::ResolveDefaultState(int32_t blockId)
+    {
+        auto block = BlockRegistry::GetBlockById(blockId);
+        if (!block)
+        {
+            // Unknown block ID -> fallback to Air
+            LogWarn("esfs_serializer", "Unknown block ID %d, using Air", blockId);
+            block = BlockRegistry::GetBlock("air");
 
-            // Safety check: prevent infinite decompression
-            if (totalBlocks > 32768)
+            if (!block)
             {
-                LogError("esfs_serializer", "RLE decompression exceeded block count: %zu (max 32768)", totalBlocks);
-                outBlockIDs.clear();
-                return false;
+                LogError("esfs_serializer", "Critical: Air block not registered!");
+                return nullptr;
+            }
+        }
+
+        BlockState* state = block->GetDefaultState();
+        if (!state)
+        {
+            LogError("esfs_serializer", "Block '%s' has no default state", block->GetRegistryKey().c_str());
+        }
+        return state;
+    }
+
+    //-------------------------------------------------------------------------------------------
+    // Heightmaps
+    //-------------------------------------------------------------------------------------------
+
+    void ESFSChunkSerializer::WriteHeightmaps(const Chunk* chunk, std::vector<uint8_t>& outData)
+    {
+        // Each column stores height + 1 (0 = no block) in HEIGHTMAP_BITS bits
+        ByteBuffer buffer(ByteOrder::Little, HEIGHTMAP_SECTION_BYTES);
+        {
+            BitWriter writer(buffer);
+            for (size_t t = 0; t < HEIGHTMAP_TYPE_COUNT; ++t)
+            {
+                const ChunkHeightmap& heightmap = chunk->GetHeightmap(static_cast<HeightmapType>(t));
+                for (int32_t column = 0; column < ChunkHeightmap::COLUMN_COUNT; ++column)
+                {
+                    writer.WriteBits(static_cast<uint64_t>(heightmap.GetByColumn(column) + 1), HEIGHTMAP_BITS);
+                }
             }
         }
+        outData.assign(buffer.Data(), buffer.Data() + buffer.WrittenBytes());
+    }
+
+    bool ESFSChunkSerializer::ReadHeightmaps(const std::vector<uint8_t>& data, std::array<ChunkHeightmap, HEIGHTMAP_TYPE_COUNT>& outHeightmaps)
+    {
+        return ReadHeightmaps(data.data(), data.size(), outHeightmaps);
+    }
 
-        // Validate total block count
-        if (outBlockIDs.size() != 32768)
+    bool ESFSChunkSerializer::ReadHeightmaps(const uint8_t* data, size_t size, std::array<ChunkHeightmap, HEIGHTMAP_TYPE_COUNT>& outHeightmaps)
+    {
+        if (!data || size < sizeof(Header) + HEIGHTMAP_SECTION_BYTES)
         {
-            LogError("esfs_serializer", "RLE decompression resulted in %zu blocks (expected 32768)", outBlockIDs.size());
-            outBlockIDs.clear();
+            LogError("esfs_serializer", "ReadHeightmaps: data too small (%zu bytes)", size);
             return false;
         }
 
-        LogDebug("esfs_serializer", "RLE decompressed %zu bytes -> %zu blocks", rleData.size(), outBlockIDs.size());
+        BitReader reader(data + sizeof(Header), HEIGHTMAP_SECTION_BYTES);
+        for (size_t t = 0; t < HEIGHTMAP_TYPE_COUNT; ++t)
+        {
+            for (int32_t column = 0; column < ChunkHeightmap::COLUMN_COUNT; ++column)
+            {
+                int32_t height = static_cast<int32_t>(reader.ReadBits(HEIGHTMAP_BITS)) - 1;
+                if (height > Chunk::CHUNK_MAX_Z)
+                {
+                    LogError("esfs_serializer", "Invalid heightmap value %d (type %zu, column %d)", height, t, column);
+                    return false;
+                }
+                outHeightmaps[t].SetByColumn(column, height);
+            }
+        }
         return true;
     }
 
@@ -350,18 +380,19 @@ namespace enigma::voxel
             return false;
         }
 
-        // Check version
-        if (header.version != 1)
+        // Check version (version 1 files hold 128-high chunks without heightmaps)
+        if (header.version != FORMAT_VERSION)
         {
-            LogError("esfs_serializer", "Unsupported ESFS version: %u (expected 1)", header.version);
+            LogError("esfs_serializer", "Unsupported ESFS version: %u (expected %u)", header.version, FORMAT_VERSION);
             return false;
         }
 
-        // Check chunk bits (Assignment 02: 4, 4, 7)
-        if (header.chunkBitsX != 4 || header.chunkBitsY != 4 || header.chunkBitsZ != 7)
+        // Check chunk bits against the current chunk layout (4, 4, 8)
+        if (header.chunkBitsX != Chunk::CHUNK_BITS_X || header.chunkBitsY != Chunk::CHUNK_BITS_Y || header.chunkBitsZ != Chunk::CHUNK_BITS_Z)
         {
-            LogError("esfs_serializer", "Invalid chunk bits: (%u, %u, %u) (expected 4, 4, 7)",
-                     header.chunkBitsX, header.chunkBitsY, header.chunkBitsZ);
+            LogError("esfs_serializer", "Invalid chunk bits: (%u, %u, %u) (expected %d, %d, %d)",
+                     header.chunkBitsX, header.chunkBitsY, header.chunkBitsZ,
+                     Chunk::CHUNK_BITS_X, Chunk::CHUNK_BITS_Y, Chunk::CHUNK_BITS_Z);
             return false;
         }
 
@@ -1,5 +1,7 @@
 #pragma once
+#include "ChunkHeightmap.hpp"
 #include "ChunkSerializationInterfaces.hpp"
+#include <array>
 #include <vector>
 #include <cstdint>
 
@@ -12,13 +14,14 @@ namespace enigma::voxel
      * -----------------------
      * 1. Extract block IDs from Chunk (BlockState* -> Block numeric ID)
      * 2. Apply RLE compression to block ID array
-     * 3. Prepend 8-byte header (ESFS magic, version, chunk bits)
-     * 4. Return compressed binary data
+     * 3. Pack the three column heightmaps (9 bits per column, 864 bytes)
+     * 4. Prepend 8-byte header (ESFS magic, version, chunk bits)
+     * 5. Return Header + Heightmaps + RLE data
      *
      * Performance:
      * ------------
-     * - Serialization: ~0.5ms (32768 blocks -> ~2-10KB)
-     * - Deserialization: ~0.3ms
+     * - Serialization: ~0.5ms (65536 blocks -> ~2-10KB)
+     * - Deserialization: ~0.3ms (single pass from the mapped file into block storage)
      * - Compression Ratio: 10-50x (depending on block variety)
      *
      * Usage:
@@ -30,6 +33,10 @@ namespace enigma::voxel
     class ESFSChunkSerializer : public IChunkSerializer
     {
     public:
+        static constexpr uint8_t  FORMAT_VERSION          = 2; // v2: 256-high chunks + heightmaps
+        static constexpr uint32_t HEIGHTMAP_BITS          = 9; // height + 1 in [0, 256]
+        static constexpr size_t   HEIGHTMAP_SECTION_BYTES = HEIGHTMAP_TYPE_COUNT * ChunkHeightmap::COLUMN_COUNT * HEIGHTMAP_BITS / 8;
+
         //-------------------------------------------------------------------------------------------
         // IChunkSerializer Interface
         //-------------------------------------------------------------------------------------------
@@ -38,7 +45,7 @@ namespace enigma::voxel
          * @brief Serialize chunk to ESFS binary format (Header + RLE data)
          *
          * @param chunk Chunk to serialize
-         * @param outData Output binary data (Header 8 bytes + RLE compressed block IDs)
+         * @param outData Output binary data (Header 8 bytes + heightmaps + RLE compressed block IDs)
          * @return True if serialization succeeded
          */
         bool SerializeChunk(const Chunk* chunk, std::vector<uint8_t>& outData) override;
@@ -47,11 +54,37 @@ namespace enigma::voxel
          * @brief Deserialize ESFS binary format to chunk
          *
          * @param chunk Chunk to fill with data
-         * @param data Input binary data (Header + RLE compressed block IDs)
+         * @param data Input binary data (Header + heightmaps + RLE compressed block IDs)
          * @return True if deserialization succeeded
          */
         bool DeserializeChunk(Chunk* chunk, const std::vector<uint8_t>& data) override;
 
+        /**
+         * @brief Deserialize ESFS binary data in place (memory-mapped load path)
+         *
+         * Decodes straight from the caller's buffer into the chunk's block storage
+         * without copying the file or building an intermediate block ID array.
+         *
+         * @param chunk Chunk to fill with data
+         * @param data Serialized chunk data, valid for the duration of the call
+         * @param size Size of data in bytes
+         * @return True if deserialization succeeded
+         */
+        bool DeserializeChunk(Chunk* chunk, const uint8_t* data, size_t size) override;
+
+        /**
+         * @brief Read only the heightmap section of serialized chunk data
+         *
+         * Lets callers such as spawn search query column heights of a saved
+         * chunk without RLE-decoding its blocks. Does not validate the header.
+         *
+         * @param data Serialized chunk data (Header + heightmaps + RLE)
+         * @param outHeightmaps Output heightmaps indexed by HeightmapType
+         * @return True if the heightmap section is present and valid
+         */
+        static bool ReadHeightmaps(const std::vector<uint8_t>& data, std::array<ChunkHeightmap, HEIGHTMAP_TYPE_COUNT>& outHeightmaps);
+        static bool ReadHeightmaps(const uint8_t* data, size_t size, std::array<ChunkHeightmap, HEIGHTMAP_TYPE_COUNT>& outHeightmaps);
+
     private:
         //-------------------------------------------------------------------------------------------
         // ESFS File Header (8 bytes)
@@ -59,10 +92,10 @@ namespace enigma::voxel
         struct Header
         {
             char    magic[4]   = {'E', 'S', 'F', 'S'}; // "ESFS"
-            uint8_t version    = 1; // Format version
+            uint8_t version    = FORMAT_VERSION; // Format version
             uint8_t chunkBitsX = 4; // 16 blocks
             uint8_t chunkBitsY = 4; // 16 blocks
-            uint8_t chunkBitsZ = 7; // 128 blocks
+            uint8_t chunkBitsZ = 8; // 256 blocks
 
             // Calculate expected block count
             uint32_t GetBlockCount() const
@@ -84,44 +117,52 @@ namespace enigma::voxel
          * Air blocks (null or no block) are represented as ID 0.
          *
          * @param chunk Chunk to serialize
-         * @param outBlockIDs Output block ID array (32768 entries, values 0-255)
+         * @param outBlockIDs Output block ID array (65536 entries, values 0-255)
          * @return True if conversion succeeded
          */
         bool SerializeToBlockIDs(const Chunk* chunk, std::vector<int32_t>& outBlockIDs);
 
-        /**
-         * @brief Convert block ID array back to Chunk
-         *
-         * Looks up Block by numeric ID and sets BlockState in chunk.
-         *
-         * @param chunk Chunk to fill
-         * @param blockIDs Input block ID array (32768 entries)
-         * @return True if conversion succeeded
-         */
-        bool DeserializeFromBlockIDs(Chunk* chunk, const std::vector<int32_t>& blockIDs);
-
         /**
          * @brief RLE compress block ID array
          *
          * Run-Length Encoding format: [BlockType (1 byte)][RunLength (1 byte)]
          * Each run represents consecutive identical blocks (max 255 per run).
          *
-         * @param blockIDs Input block IDs (32768 entries, values 0-255)
+         * @param blockIDs Input block IDs (65536 entries, values 0-255)
          * @param outRLE Output RLE-compressed data
          * @return True if compression succeeded
          */
         bool CompressRLE(const std::vector<int32_t>& blockIDs, std::vector<uint8_t>& outRLE);
 
         /**
-         * @brief RLE decompress to block ID array
+         * @brief Decode RLE runs directly into the chunk's block storage
          *
-         * Decodes RLE format: [BlockType][RunLength] pairs.
+         * Decodes [BlockType][RunLength] pairs in one pass, resolving each block ID
+         * to its default state once per chunk. The run lengths are validated before
+         * the chunk is written, so malformed data leaves it unchanged.
          *
+         * @param chunk Chunk to fill (heightmaps are left to the caller)
          * @param rleData Input RLE-compressed data
-         * @param outBlockIDs Output block ID array (will be resized to 32768)
-         * @return True if decompression succeeded
+         * @param rleSize Size of rleData in bytes
+         * @return True if decoding succeeded
+         */
+        bool DecodeRLEIntoChunk(Chunk* chunk, const uint8_t* rleData, size_t rleSize);
+
+        /**
+         * @brief Default state for a saved block ID (Air for unknown IDs)
+         *
+         * @param blockId Numeric block ID
+         * @return Default state, or nullptr if not even Air is registered
+         */
+        static BlockState* ResolveDefaultState(int32_t blockId);
+
+        /**
+         * @brief Pack the chunk's heightmaps (HEIGHTMAP_SECTION_BYTES bytes)
+         *
+         * @param chunk Chunk whose heightmaps are written
+         * @param outData Output packed heightmaps
          */
-        bool DecompressRLE(const std::vector<uint8_t>& rleData, std::vector<int32_t>& outBlockIDs);
+        void WriteHeightmaps(const Chunk* chunk, std::vector<uint8_t>& outData);
 
         /**
          * @brief Validate ESFS header
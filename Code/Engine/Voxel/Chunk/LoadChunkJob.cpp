@@ -43,7 +43,14 @@ namespace enigma::voxel
         {
             // ESFS format
             GUARANTEE_OR_DIE(m_esfStorage == nullptr, "LoadChunkJob: Both storages are set");
-            m_loadSuccess = m_esfsStorage->LoadChunkData(chunk, m_chunkCoords.x, m_chunkCoords.y);
+            if (m_pendingSave.payload)
+            {
+                m_loadSuccess = m_esfsStorage->LoadChunkFromMemory(chunk, m_chunkCoords.x, m_chunkCoords.y, *m_pendingSave.payload);
+            }
+            else
+            {
+                m_loadSuccess = m_esfsStorage->LoadChunkData(chunk, m_chunkCoords.x, m_chunkCoords.y);
+            }
         }
         else
         {
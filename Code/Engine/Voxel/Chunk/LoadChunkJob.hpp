@@ -2,6 +2,7 @@
 #include "ChunkJob.hpp"
 #include "Engine/Voxel/World/ESFWorldStorage.hpp"
 #include "Engine/Voxel/World/ESFSWorldStorage.hpp"
+#include "Engine/Voxel/World/ChunkWriteBehindQueue.hpp"
 
 namespace enigma::voxel
 {
@@ -39,13 +40,19 @@ namespace enigma::voxel
 
         void Execute() override;
 
+        // ESFS only: load from a save still held by the write-behind queue instead of the (stale) file
+        void SetPendingSave(const ChunkWriteBehindHit& pendingSave) { m_pendingSave = pendingSave; }
+
         // Result query (called by main thread after completion)
-        bool WasSuccessful() const { return m_loadSuccess; }
+        bool                       WasSuccessful() const { return m_loadSuccess; }
+        bool                       LoadedFromPendingSave() const { return m_pendingSave.payload != nullptr; }
+        const ChunkWriteBehindHit& GetPendingSave() const { return m_pendingSave; }
 
     private:
-        World*            m_world; // World instance to get Chunk via coordinates
-        ESFChunkStorage*  m_esfStorage; // ESF storage (or nullptr if using ESFS)
-        ESFSChunkStorage* m_esfsStorage; // ESFS storage (or nullptr if using ESF)
-        bool              m_loadSuccess; // Did the load operation succeed?
+        World*              m_world; // World instance to get Chunk via coordinates
+        ESFChunkStorage*    m_esfStorage; // ESF storage (or nullptr if using ESFS)
+        ESFSChunkStorage*   m_esfsStorage; // ESFS storage (or nullptr if using ESF)
+        bool                m_loadSuccess; // Did the load operation succeed?
+        ChunkWriteBehindHit m_pendingSave; // Unwritten save this chunk loads from (payload null = disk)
     };
 } // namespace enigma::voxel
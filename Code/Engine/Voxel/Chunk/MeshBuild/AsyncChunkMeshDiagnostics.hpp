@@ -100,7 +100,9 @@ namespace enigma::voxel
         uint64_t boundedWaitAttempts           = 0;
         uint64_t boundedWaitSatisfied          = 0;
         uint64_t boundedWaitTimedOut           = 0;
-        uint64_t boundedWaitYieldCount         = 0;
+        uint64_t boundedWaitYieldCount         = 0; // WaitOrExecute rounds
+        uint64_t boundedWaitInlineExecutions   = 0; // Important builds claimed and run on the main thread
+        uint64_t boundedWaitAssistedTasks      = 0; // Other mesh tasks run on the main thread while waiting
         uint64_t boundedWaitMicroseconds = 0;
     };
 
@@ -0,0 +1,221 @@
+#include "BlockStateQuadTable.hpp"
+
+#include "Engine/Core/Logger/LoggerAPI.hpp"
+#include "Engine/Registry/Block/Block.hpp"
+#include "Engine/Registry/Block/BlockRegistry.hpp"
+#include "Engine/Registry/Block/RenderShape.hpp"
+#include "Engine/Renderer/Model/RenderMesh.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <mutex>
+
+using namespace enigma::voxel;
+using namespace enigma::registry::block;
+
+namespace
+{
+    std::shared_ptr<const BlockStateQuadTable> s_currentTable;
+    std::mutex                                 s_bakeMutex;
+    uint32_t                                   s_nextGlobalStateId = 0;
+
+    // Axis and side of the block boundary a direction faces, in SimpleMiner space (+X forward, +Y left, +Z up)
+    void GetBoundaryPlane(Direction direction, int& outAxis, float& outPlane)
+    {
+        switch (direction)
+        {
+        case Direction::NORTH: outAxis = 1; outPlane = 1.0f; return;
+        case Direction::SOUTH: outAxis = 1; outPlane = 0.0f; return;
+        case Direction::EAST: outAxis = 0; outPlane = 1.0f; return;
+        case Direction::WEST: outAxis = 0; outPlane = 0.0f; return;
+        case Direction::UP: outAxis = 2; outPlane = 1.0f; return;
+        case Direction::DOWN: outAxis = 2; outPlane = 0.0f; return;
+        }
+        outAxis  = 2;
+        outPlane = 1.0f;
+    }
+
+    float GetAxis(const Vec3& v, int axis)
+    {
+        return axis == 0 ? v.x : (axis == 1 ? v.y : v.z);
+    }
+
+    // True when the quad covers the whole block face on the boundary plane of its direction
+    bool IsFullBoundaryQuad(const BakedBlockQuad& quad, Direction direction)
+    {
+        constexpr float kEpsilon = 1e-4f;
+
+        int   axis  = 0;
+        float plane = 0.0f;
+        GetBoundaryPlane(direction, axis, plane);
+
+        float minA = 1.0f, maxA = 0.0f, minB = 1.0f, maxB = 0.0f;
+        for (const Vec3& position : quad.positions)
+        {
+            if (std::abs(GetAxis(position, axis) - plane) > kEpsilon)
+            {
+                return false;
+            }
+            const float a = GetAxis(position, (axis + 1) % 3);
+            const float b = GetAxis(position, (axis + 2) % 3);
+            minA          = (std::min)(minA, a);
+            maxA          = (std::max)(maxA, a);
+            minB          = (std::min)(minB, b);
+            maxB          = (std::max)(maxB, b);
+        }
+        return minA < kEpsilon && minB < kEpsilon && maxA > 1.0f - kEpsilon && maxB > 1.0f - kEpsilon;
+    }
+}
+
+std::shared_ptr<const BlockStateQuadTable> BlockStateQuadTable::Bake()
+{
+    std::lock_guard<std::mutex> lock(s_bakeMutex);
+    const auto                  bakeStart = std::chrono::steady_clock::now();
+
+    // Collect every state; states seen for the first time get the next dense ID
+    std::vector<BlockState*> allStates;
+    for (const std::shared_ptr<Block>& block : BlockRegistry::GetAllBlocks())
+    {
+        if (!block)
+        {
+            continue;
+        }
+        for (BlockState* state : block->GetAllStates())
+        {
+            if (state == nullptr)
+            {
+                continue;
+            }
+            if (state->GetGlobalStateId() == UINT32_MAX)
+            {
+                state->SetGlobalStateId(s_nextGlobalStateId++);
+            }
+            allStates.push_back(state);
+        }
+    }
+
+    auto table = std::make_shared<BlockStateQuadTable>();
+    table->m_states.resize(s_nextGlobalStateId);
+    table->m_blockNames.resize(s_nextGlobalStateId);
+
+    // Same air the mesher skips
+    const std::shared_ptr<Block> air = BlockRegistry::GetBlock("simpleminer", "air");
+
+    // Quads are appended state by state in ID order, so each entry's ranges stay contiguous
+    std::sort(allStates.begin(), allStates.end(), [](const BlockState* lhs, const BlockState* rhs) { return lhs->GetGlobalStateId() < rhs->GetGlobalStateId(); });
+
+    for (BlockState* state : allStates)
+    {
+        Block*           block = state->GetBlock();
+        BakedBlockState& entry = table->m_states[state->GetGlobalStateId()];
+        table->m_blockNames[state->GetGlobalStateId()] = block->GetNamespace() + ":" + block->GetRegistryName();
+
+        entry.renderType = block->GetRenderType();
+        if (state->CanOcclude()) entry.flags |= kBakedStateOccludes;
+        if (!state->GetFluidState().IsEmpty()) entry.flags |= kBakedStateFluid;
+        if (entry.renderType == RenderType::SOLID || (entry.renderType == RenderType::TRANSLUCENT && entry.Has(kBakedStateFluid)))
+        {
+            entry.flags |= kBakedStateCulledByOccluder;
+        }
+
+        const auto renderMesh = state->GetRenderMesh();
+        const bool renders    = block != air.get() && block->GetRenderShape(state) != RenderShape::INVISIBLE && renderMesh && !renderMesh->IsEmpty();
+
+        uint32_t quadCursor = static_cast<uint32_t>(table->m_quads.size());
+        bool     fullCube   = renders && entry.renderType == RenderType::SOLID && entry.Has(kBakedStateOccludes);
+        for (int d = 0; d < 6; ++d)
+        {
+            entry.quadBegin[d] = quadCursor;
+            if (!renders)
+            {
+                continue;
+            }
+
+            const Direction direction      = static_cast<Direction>(d);
+            size_t          directionQuads = 0;
+            for (const renderer::model::RenderFace& face : renderMesh->faces)
+            {
+                if (face.cullDirection != direction || face.vertices.size() < 4)
+                {
+                    continue;
+                }
+
+                BakedBlockQuad quad;
+                for (int v = 0; v < 4; ++v)
+                {
+                    quad.positions[v] = face.vertices[v].m_position;
+                    quad.uvs[v]       = face.vertices[v].m_uvTextCoords;
+                }
+                quad.tintIndex = static_cast<int8_t>(face.tintIndex);
+                quad.cullable  = face.hasCullFace;
+                table->m_quads.push_back(quad);
+                ++directionQuads;
+            }
+            quadCursor = static_cast<uint32_t>(table->m_quads.size());
+
+            fullCube = fullCube && directionQuads == 1 && table->m_quads.back().cullable && IsFullBoundaryQuad(table->m_quads.back(), direction);
+        }
+        entry.quadBegin[6] = quadCursor;
+
+        if (renders && quadCursor > entry.quadBegin[0]) entry.flags |= kBakedStateRenders;
+        if (fullCube) entry.flags |= kBakedStateFullOpaqueCube;
+    }
+
+    // SkipRendering is virtual and neighbor-dependent, so it cannot be tabled outright. Probe
+    // each block's default state against every state once; blocks that never skip (most of
+    // them) drop the per-face virtual call entirely.
+    for (const std::shared_ptr<Block>& block : BlockRegistry::GetAllBlocks())
+    {
+        BlockState* self = block ? block->GetDefaultState() : nullptr;
+        if (self == nullptr)
+        {
+            continue;
+        }
+
+        bool canSkip = false;
+        for (size_t i = 0; i < allStates.size() && !canSkip; ++i)
+        {
+            for (int d = 0; d < 6 && !canSkip; ++d)
+            {
+                canSkip = block->SkipRendering(self, allStates[i], static_cast<Direction>(d));
+            }
+        }
+        if (canSkip)
+        {
+            for (BlockState* state : block->GetAllStates())
+            {
+                if (state != nullptr)
+                {
+                    table->m_states[state->GetGlobalStateId()].flags |= kBakedStateNeighborSkip;
+                }
+            }
+        }
+    }
+
+    const double bakeMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - bakeStart).count();
+    core::LogInfo("BlockStateQuadTable", "Baked %zu states, %zu quads (%zu KB) in %.2f ms",
+                  table->m_states.size(), table->m_quads.size(), table->GetMemoryBytes() / 1024, bakeMs);
+    return table;
+}
+
+void BlockStateQuadTable::Publish(std::shared_ptr<const BlockStateQuadTable> table)
+{
+    std::atomic_store(&s_currentTable, std::move(table));
+}
+
+std::shared_ptr<const BlockStateQuadTable> BlockStateQuadTable::GetCurrent()
+{
+    return std::atomic_load(&s_currentTable);
+}
+
+size_t BlockStateQuadTable::GetMemoryBytes() const
+{
+    size_t bytes = m_states.capacity() * sizeof(BakedBlockState) + m_quads.capacity() * sizeof(BakedBlockQuad);
+    for (const std::string& name : m_blockNames)
+    {
+        bytes += sizeof(std::string) + name.capacity();
+    }
+    return bytes;
+}
@@ -0,0 +1,94 @@
+#pragma once
+
+#include "Engine/Math/Vec2.hpp"
+#include "Engine/Math/Vec3.hpp"
+#include "Engine/Registry/Block/RenderType.hpp"
+#include "Engine/Voxel/Block/BlockState.hpp"
+#include "Engine/Voxel/Property/PropertyTypes.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace enigma::voxel
+{
+    /// One model quad in block space (0-1), with UVs already mapped into the block atlas
+    struct BakedBlockQuad
+    {
+        Vec3   positions[4];
+        Vec2   uvs[4];
+        int8_t tintIndex = -1;
+        bool   cullable  = true; // Model face has a cullface: hidden when the neighbor in its direction hides it
+    };
+
+    enum BakedBlockStateFlags : uint8_t
+    {
+        kBakedStateRenders          = 1 << 0, // Not air, not RenderShape::INVISIBLE, and has quads
+        kBakedStateFullOpaqueCube   = 1 << 1, // SOLID, occludes, and one full-size cullable quad per direction
+        kBakedStateOccludes         = 1 << 2, // CanOcclude(): hides neighbor faces and darkens AO
+        kBakedStateFluid            = 1 << 3,
+        kBakedStateCulledByOccluder = 1 << 4, // Own faces are hidden by an occluding neighbor (SOLID, or translucent fluid)
+        kBakedStateNeighborSkip     = 1 << 5, // Block::SkipRendering can return true; still asked per face
+    };
+
+    struct BakedBlockState
+    {
+        uint32_t                    quadBegin[7] = {}; // Quads facing direction d are [quadBegin[d], quadBegin[d + 1])
+        registry::block::RenderType renderType   = registry::block::RenderType::SOLID;
+        uint8_t                     flags        = 0;
+
+        bool Has(BakedBlockStateFlags flag) const { return (flags & flag) != 0; }
+    };
+
+    /**
+     * @brief Immutable per-BlockState meshing data, indexed by BlockState::GetGlobalStateId()
+     *
+     * Baked once the registry is frozen and block models are compiled. It flattens each
+     * state's RenderMesh into per-direction quad ranges and caches the render type and
+     * culling properties that ChunkMeshBuilder would otherwise query through the Block
+     * on every face. The hot meshing loop then only indexes arrays.
+     *
+     * Global state IDs are assigned on the first bake and kept by later bakes (model
+     * reloads), so a table and the IDs always agree. The published table is swapped
+     * atomically; mesh builds already running keep the table they started with.
+     */
+    class BlockStateQuadTable
+    {
+    public:
+        /// Build a table from every state in BlockRegistry. Call after CompileAllBlockModels
+        static std::shared_ptr<const BlockStateQuadTable> Bake();
+
+        /// Make a table visible to ChunkMeshBuilder. nullptr returns meshing to the per-face model path
+        static void Publish(std::shared_ptr<const BlockStateQuadTable> table);
+
+        static std::shared_ptr<const BlockStateQuadTable> GetCurrent();
+
+        /// nullptr for states the table does not cover (created after the bake)
+        const BakedBlockState* Find(const BlockState* state) const
+        {
+            const uint32_t id = state ? state->GetGlobalStateId() : UINT32_MAX;
+            return id < m_states.size() ? &m_states[id] : nullptr;
+        }
+
+        const BakedBlockQuad* GetQuads(const BakedBlockState& entry, Direction direction, size_t& outCount) const
+        {
+            const int d = static_cast<int>(direction);
+            outCount    = entry.quadBegin[d + 1] - entry.quadBegin[d];
+            return m_quads.data() + entry.quadBegin[d];
+        }
+
+        /// "namespace:name" of the state's block, for TerrainVertexLayout listeners
+        const std::string& GetBlockName(const BlockState* state) const { return m_blockNames[state->GetGlobalStateId()]; }
+
+        size_t GetStateCount() const { return m_states.size(); }
+        size_t GetQuadCount() const { return m_quads.size(); }
+        size_t GetMemoryBytes() const;
+
+    private:
+        std::vector<BakedBlockState> m_states;
+        std::vector<BakedBlockQuad>  m_quads;
+        std::vector<std::string>     m_blockNames;
+    };
+}
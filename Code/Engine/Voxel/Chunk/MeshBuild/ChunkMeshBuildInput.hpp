@@ -1,6 +1,7 @@
 #pragma once
 
 #include "Engine/Graphic/Reload/RenderPipelineReloadTypes.hpp"
+#include "Engine/Voxel/Chunk/ChunkMeshBufferPool.hpp"
 #include "Engine/Voxel/Chunk/MeshBuild/ChunkMeshingDispatchContext.hpp"
 
 #include <cstdint>
@@ -15,6 +16,7 @@ namespace enigma::voxel
         ChunkMeshingDispatchContext                 dispatchContext;
         std::shared_ptr<const ChunkMeshingSnapshot> snapshot;
         enigma::graphic::RenderPipelineReloadGeneration reloadGeneration;
+        ChunkMeshCapacityHint                       capacityHint; // Previous mesh quad counts, if any
 
         const IntVec2& GetChunkCoords() const noexcept
         {
@@ -1,6 +1,7 @@
 #include "ChunkMeshBuildInputFactory.hpp"
 
 #include "Engine/Voxel/Chunk/Chunk.hpp"
+#include "Engine/Voxel/Chunk/ChunkMesh.hpp"
 #include "Engine/Voxel/World/World.hpp"
 
 using namespace enigma::voxel;
@@ -17,6 +18,20 @@ namespace
         context.worldLifetimeToken = chunk.GetWorld() != nullptr ? chunk.GetWorld()->GetWorldLifetimeToken() : 0;
         return context;
     }
+
+    ChunkMeshCapacityHint MakeCapacityHint(const Chunk& chunk)
+    {
+        ChunkMeshCapacityHint hint;
+        const ChunkMesh*      previousMesh = chunk.GetMesh();
+        if (previousMesh != nullptr)
+        {
+            hint.opaqueQuads      = static_cast<uint32_t>(previousMesh->GetOpaqueVertexCount() / 4);
+            hint.cutoutQuads      = static_cast<uint32_t>(previousMesh->GetCutoutVertexCount() / 4);
+            hint.translucentQuads = static_cast<uint32_t>(previousMesh->GetTranslucentVertexCount() / 4);
+            hint.fromHistory      = true;
+        }
+        return hint;
+    }
 }
 
 bool ChunkMeshBuildInputFactory::TryCreate(const Chunk& chunk, uint64_t buildVersion, bool important, ChunkMeshBuildInput& outInput)
@@ -39,5 +54,6 @@ bool ChunkMeshBuildInputFactory::TryCreate(const Chunk& chunk,
 
     outInput.dispatchContext = MakeDispatchContext(chunk, buildVersion, important);
     outInput.reloadGeneration = reloadGeneration;
+    outInput.capacityHint     = MakeCapacityHint(chunk);
     return true;
 }
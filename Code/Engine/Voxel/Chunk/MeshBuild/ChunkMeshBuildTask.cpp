@@ -105,7 +105,8 @@ void ChunkMeshBuildTask::Execute()
         buildInput.snapshot = std::move(snapshot);
     }
 
-    ChunkMeshBuilder builder;
+    ChunkMeshBufferPool* bufferPool = m_world != nullptr ? &m_world->GetChunkMeshBufferPool() : nullptr;
+    ChunkMeshBuilder     builder(bufferPool);
     result = builder.Build(buildInput);
     if (buildInput.snapshot)
     {
@@ -122,6 +123,10 @@ void ChunkMeshBuildTask::Execute()
 
     if (IsCancellationRequested())
     {
+        if (bufferPool != nullptr)
+        {
+            bufferPool->Release(std::move(result.mesh));
+        }
         result.mesh.reset();
         result.status = ChunkMeshBuildResultStatus::Cancelled;
         result.detail = "CancelledAfterBuild";
@@ -0,0 +1,37 @@
+#pragma once
+
+#include <cstdint>
+
+#include "Engine/Core/Schedule/ScheduleTelemetry.hpp"
+
+namespace enigma::voxel
+{
+    /**
+     * @brief Counters for World's block-edit mesh patch path
+     *
+     * An edit first tries to re-mesh only its dirty sections and splice them into the
+     * chunk's mesh and resident region slice; anything that cannot takes the regular
+     * async rebuild. Edit-to-visible latency is recorded for both paths so they can be
+     * compared (upload bytes live in ChunkBatchArenaDiagnostics::upload).
+     */
+    struct ChunkMeshPatchDiagnostics
+    {
+        uint64_t requested               = 0; // Block edits routed through RequestChunkMeshEditUpdate
+        uint64_t patched                 = 0; // Edits spliced into the current mesh
+        uint64_t sectionsRemeshed        = 0;
+        uint64_t fallbackBuildInFlight   = 0; // A full build was already queued or running
+        uint64_t fallbackNoSectionRanges = 0; // No mesh yet, or it predates section tracking
+        uint64_t fallbackTooManySections = 0;
+        uint64_t fallbackSnapshotFailed  = 0;
+        uint64_t regionPatchRejected     = 0; // Spliced on the CPU but uploaded through the region path
+
+        core::LatencyHistogram patchBuildUs; // Snapshot + section mesh + splice + arena patch
+        core::LatencyHistogram patchedEditToVisibleUs; // Edit until the in-place arena patch landed
+        core::LatencyHistogram rebuiltEditToVisibleUs; // Edit until a rebuild / region upload landed
+
+        void Reset()
+        {
+            *this = ChunkMeshPatchDiagnostics();
+        }
+    };
+}
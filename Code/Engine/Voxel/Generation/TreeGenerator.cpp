@@ -104,6 +104,20 @@ namespace enigma::voxel
         return 64; // Fallback to sea level if no terrain generator
     }
 
+    int TreeGenerator::GetSurfaceHeightAt(const Chunk* chunk, int globalX, int globalY) const
+    {
+        if (chunk)
+        {
+            int localX = globalX - Chunk::ChunkCoordsToWorld(chunk->GetChunkX());
+            int localY = globalY - Chunk::ChunkCoordsToWorld(chunk->GetChunkY());
+            if (localX >= 0 && localX < Chunk::CHUNK_SIZE_X && localY >= 0 && localY < Chunk::CHUNK_SIZE_Y)
+            {
+                return chunk->GetHeight(HeightmapType::MotionBlocking, localX, localY);
+            }
+        }
+        return GetGroundHeightAt(globalX, globalY);
+    }
+
     void TreeGenerator::ClearNoiseCache()
     {
         m_treeNoiseCache.clear();
@@ -147,6 +147,20 @@ namespace enigma::voxel
          */
         int GetGroundHeightAt(int globalX, int globalY) const;
 
+        /**
+         * @brief Get placement surface height, preferring the chunk's own heightmap
+         * 
+         * Columns inside chunk read its MotionBlocking heightmap (O(1), reflects
+         * blocks actually placed, including water and earlier features). Columns
+         * outside chunk fall back to the noise-based GetGroundHeightAt().
+         * 
+         * @param chunk Chunk being generated (may be null)
+         * @param globalX World X coordinate
+         * @param globalY World Y coordinate (Z in Minecraft terms)
+         * @return Z coordinate of the highest motion-blocking block
+         */
+        int GetSurfaceHeightAt(const Chunk* chunk, int globalX, int globalY) const;
+
         /**
          * @brief Clear noise cache
          * 
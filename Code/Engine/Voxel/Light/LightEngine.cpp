@@ -2,7 +2,9 @@
 #include "LightEngineCommon.hpp"
 #include "LightException.hpp"
 #include "Engine/Core/Logger/LoggerAPI.hpp"
+#include "Engine/Core/Profiler/Profiler.hpp"
 #include "Engine/Voxel/Chunk/Chunk.hpp"
+#include "Engine/Voxel/World/World.hpp"
 using namespace enigma::core;
 
 namespace enigma::voxel
@@ -86,6 +88,7 @@ namespace enigma::voxel
     //-------------------------------------------------------------------------------------------
     void LightEngine::ProcessDirtyQueue()
     {
+        ENGINE_PROFILE_SCOPE("LightEngine::ProcessDirtyQueue");
         while (!m_dirtyQueue.empty())
         {
             ProcessNextDirtyBlock();
@@ -142,7 +145,11 @@ namespace enigma::voxel
             if (correctLight != currentLight)
             {
                 SetLightValue(chunk, x, y, z, correctLight);
-                chunk->MarkDirty();
+                chunk->MarkMeshSectionsDirty(z);
+                if (m_world)
+                {
+                    m_world->NotifyLightChanged(*chunk, z, z);
+                }
                 PropagateToNeighbors(iter);
             }
         }
@@ -180,7 +187,9 @@ namespace enigma::voxel
                     Chunk* neighborChunk = neighbor.GetChunk();
                     if (neighborChunk && neighborChunk != currentChunk)
                     {
-                        neighborChunk->MarkDirty();
+                        int32_t neighborX, neighborY, neighborZ;
+                        neighbor.GetLocalCoords(neighborX, neighborY, neighborZ);
+                        neighborChunk->MarkMeshSectionsDirty(neighborZ);
                     }
                 }
             }
@@ -12,6 +12,7 @@
 #include "LightEngineCommon.hpp"
 
 #include "Engine/Core/Logger/LoggerAPI.hpp"
+#include "Engine/Core/Profiler/Profiler.hpp"
 #include "Engine/Voxel/Chunk/Chunk.hpp"
 #include "Engine/Voxel/World/World.hpp"
 #undef max
@@ -83,22 +84,30 @@ namespace enigma::voxel
 
     int VoxelLightEngine::RunLightUpdates()
     {
+        ENGINE_PROFILE_SCOPE("VoxelLightEngine::RunLightUpdates");
         int processed = 0;
 
         // [STEP 1] Process block light updates
-        while (m_blockEngine->HasWork())
         {
-            m_blockEngine->ProcessNextDirtyBlock();
-            ++processed;
+            ENGINE_PROFILE_SCOPE("BlockLightEngine::Process");
+            while (m_blockEngine->HasWork())
+            {
+                m_blockEngine->ProcessNextDirtyBlock();
+                ++processed;
+            }
         }
 
         // [STEP 2] Process sky light updates
-        while (m_skyEngine->HasWork())
         {
-            m_skyEngine->ProcessNextDirtyBlock();
-            ++processed;
+            ENGINE_PROFILE_SCOPE("SkyLightEngine::Process");
+            while (m_skyEngine->HasWork())
+            {
+                m_skyEngine->ProcessNextDirtyBlock();
+                ++processed;
+            }
         }
 
+        ENGINE_PROFILE_COUNTER("VoxelLightEngine::ProcessedBlocks", processed);
         return processed;
     }
 
@@ -0,0 +1,72 @@
+﻿#pragma once
+#include "Engine/Math/IntVec2.hpp"
+
+#include <array>
+#include <cstdint>
+#include <vector>
+
+namespace enigma::voxel
+{
+    /**
+     * @brief 区块网络同步协议常量与数据结构
+     *
+     * 线格式(每个NetworkIoBackend帧承载一个包):
+     *   [uint8 ChunkPacketType][payload...]
+     *
+     * 区块按16格高度切分为Section(16x16x16 = 4096方块),索引布局与Chunk::CoordsToIndex一致,
+     * 因此Section内局部索引 = chunkIndex & 0xFFF, sectionY = chunkIndex >> 12。
+     *
+     * 方块以"网络状态ID"传输: (Block数值ID << 16) | BlockState索引, 0表示空气。
+     * 光照按字节传输: 高4位天空光, 低4位方块光(与Chunk::m_lightData一致)。
+     */
+    enum class ChunkPacketType : uint8_t
+    {
+        ChunkData    = 1, // 服务器 -> 客户端: 完整区块的一段连续Section(调色板 + 位压缩)
+        SectionDelta = 2, // 服务器 -> 客户端: 批量方块变化(稀疏列表或整Section重发)
+        LightUpdate  = 3, // 服务器 -> 客户端: 仅内容发生变化的Section光照
+        ChunkUnload  = 4, // 服务器 -> 客户端: 区块离开视距
+        ClientView   = 5 // 客户端 -> 服务器: 观察者位置
+    };
+
+    constexpr int32_t  kChunkSectionHeight    = 16;
+    constexpr int32_t  kChunkSectionCount     = 16; // 256 / 16
+    constexpr int32_t  kBlocksPerChunkSection = 16 * 16 * kChunkSectionHeight;
+    constexpr int32_t  kBlocksPerNetworkChunk = kBlocksPerChunkSection * kChunkSectionCount;
+    constexpr uint32_t kAirNetworkStateId     = 0;
+
+    /**
+     * @brief 区块的网络镜像(客户端无头镜像使用)
+     *
+     * 全空气Section不分配方块数组(sectionBlocks[i]为空),光照总是完整存储。
+     */
+    struct ChunkSnapshot
+    {
+        IntVec2                                                chunkCoords;
+        std::array<std::vector<uint32_t>, kChunkSectionCount> sectionBlocks;
+        std::array<std::vector<uint8_t>, kChunkSectionCount>  sectionLight;
+        uint32_t                                               receivedSectionCount = 0; // ChunkData分段到达计数
+        bool                                                   complete             = false;
+
+        uint32_t GetStateId(int32_t chunkIndex) const
+        {
+            const std::vector<uint32_t>& blocks = sectionBlocks[chunkIndex >> 12];
+            return blocks.empty() ? kAirNetworkStateId : blocks[chunkIndex & 0xFFF];
+        }
+
+        uint8_t GetLight(int32_t chunkIndex) const
+        {
+            const std::vector<uint8_t>& light = sectionLight[chunkIndex >> 12];
+            return light.empty() ? 0 : light[chunkIndex & 0xFFF];
+        }
+    };
+
+    inline int64_t PackNetworkChunkCoords(IntVec2 chunkCoords)
+    {
+        return (static_cast<int64_t>(chunkCoords.x) << 32) | static_cast<uint32_t>(chunkCoords.y);
+    }
+
+    inline IntVec2 UnpackNetworkChunkCoords(int64_t packed)
+    {
+        return IntVec2(static_cast<int32_t>(packed >> 32), static_cast<int32_t>(packed & 0xFFFFFFFF));
+    }
+}
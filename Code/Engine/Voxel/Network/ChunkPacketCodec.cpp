@@ -0,0 +1,244 @@
+﻿#include "ChunkPacketCodec.hpp"
+#include "Engine/Core/Buffer/BufferSerializable.hpp"
+
+#include <algorithm>
+#include <unordered_map>
+
+namespace enigma::voxel
+{
+    namespace
+    {
+        constexpr uint8_t kMaxBitsPerEntry = 12; // 4096个不同值
+
+        uint8_t GetBitsForPaletteSize(size_t paletteSize)
+        {
+            uint8_t bits = 0;
+            while ((static_cast<size_t>(1) << bits) < paletteSize)
+            {
+                ++bits;
+            }
+            return bits;
+        }
+
+        //-------------------------------------------------------------------------------------------
+        // 调色板构建: 8位值使用查找表, 32位值使用哈希表并缓存上一次命中(地形中连续相同方块很常见)
+        //-------------------------------------------------------------------------------------------
+        void BuildPalette(const uint8_t* values, std::vector<uint8_t>& palette, std::vector<uint16_t>& indices)
+        {
+            int16_t lookup[256];
+            std::fill(std::begin(lookup), std::end(lookup), static_cast<int16_t>(-1));
+            for (int32_t i = 0; i < kBlocksPerChunkSection; ++i)
+            {
+                int16_t& slot = lookup[values[i]];
+                if (slot < 0)
+                {
+                    slot = static_cast<int16_t>(palette.size());
+                    palette.push_back(values[i]);
+                }
+                indices[i] = static_cast<uint16_t>(slot);
+            }
+        }
+
+        void BuildPalette(const uint32_t* values, std::vector<uint32_t>& palette, std::vector<uint16_t>& indices)
+        {
+            std::unordered_map<uint32_t, uint16_t> lookup;
+            uint32_t                               lastValue = values[0];
+            uint16_t                               lastIndex = 0;
+            palette.push_back(lastValue);
+            lookup.emplace(lastValue, lastIndex);
+            for (int32_t i = 0; i < kBlocksPerChunkSection; ++i)
+            {
+                if (values[i] != lastValue)
+                {
+                    lastValue          = values[i];
+                    auto [it, created] = lookup.emplace(lastValue, static_cast<uint16_t>(palette.size()));
+                    if (created)
+                    {
+                        palette.push_back(lastValue);
+                    }
+                    lastIndex = it->second;
+                }
+                indices[i] = lastIndex;
+            }
+        }
+
+        void WriteValue(core::ByteBuffer& buffer, uint8_t value) { buffer.WriteByte(value); }
+        void WriteValue(core::ByteBuffer& buffer, uint32_t value) { buffer.WriteUnsignedInt(value); }
+        void ReadValue(core::ByteBuffer& buffer, uint8_t& value) { value = buffer.ReadByte(); }
+        void ReadValue(core::ByteBuffer& buffer, uint32_t& value) { value = buffer.ReadUnsignedInt(); }
+
+        template <typename T>
+        void WritePalettedSection(core::ByteBuffer& buffer, const T* values)
+        {
+            std::vector<T>        palette;
+            std::vector<uint16_t> indices(kBlocksPerChunkSection);
+            BuildPalette(values, palette, indices);
+
+            uint8_t bits = GetBitsForPaletteSize(palette.size());
+            buffer.WriteByte(bits);
+            if (bits == 0)
+            {
+                WriteValue(buffer, palette[0]);
+                return;
+            }
+
+            buffer.WriteUnsignedShort(static_cast<uint16_t>(palette.size()));
+            for (T value : palette)
+            {
+                WriteValue(buffer, value);
+            }
+
+            const int32_t valuesPerWord = 64 / bits;
+            for (int32_t start = 0; start < kBlocksPerChunkSection; start += valuesPerWord)
+            {
+                uint64_t word  = 0;
+                int32_t  count = (std::min)(valuesPerWord, kBlocksPerChunkSection - start);
+                for (int32_t i = 0; i < count; ++i)
+                {
+                    word |= static_cast<uint64_t>(indices[start + i]) << (i * bits);
+                }
+                buffer.WriteUnsignedLong(word);
+            }
+        }
+
+        template <typename T>
+        bool ReadPalettedSection(core::ByteBuffer& buffer, T* outValues)
+        {
+            uint8_t bits = buffer.ReadByte();
+            if (bits == 0)
+            {
+                T value{};
+                ReadValue(buffer, value);
+                std::fill(outValues, outValues + kBlocksPerChunkSection, value);
+                return true;
+            }
+            if (bits > kMaxBitsPerEntry)
+            {
+                return false;
+            }
+
+            uint16_t paletteSize = buffer.ReadUnsignedShort();
+            if (paletteSize < 2 || paletteSize > (1u << bits))
+            {
+                return false;
+            }
+            std::vector<T> palette(paletteSize);
+            for (T& value : palette)
+            {
+                ReadValue(buffer, value);
+            }
+
+            const int32_t  valuesPerWord = 64 / bits;
+            const uint64_t mask          = (static_cast<uint64_t>(1) << bits) - 1;
+            for (int32_t start = 0; start < kBlocksPerChunkSection; start += valuesPerWord)
+            {
+                uint64_t word  = buffer.ReadUnsignedLong();
+                int32_t  count = (std::min)(valuesPerWord, kBlocksPerChunkSection - start);
+                for (int32_t i = 0; i < count; ++i)
+                {
+                    uint64_t index = (word >> (i * bits)) & mask;
+                    if (index >= paletteSize)
+                    {
+                        return false;
+                    }
+                    outValues[start + i] = palette[index];
+                }
+            }
+            return true;
+        }
+    }
+
+    //-------------------------------------------------------------------------------------------
+    // Section容器
+    //-------------------------------------------------------------------------------------------
+    void ChunkPacketCodec::WriteBlockSection(core::ByteBuffer& buffer, const uint32_t* blocks)
+    {
+        WritePalettedSection(buffer, blocks);
+    }
+
+    bool ChunkPacketCodec::ReadBlockSection(core::ByteBuffer& buffer, uint32_t* outBlocks)
+    {
+        return ReadPalettedSection(buffer, outBlocks);
+    }
+
+    void ChunkPacketCodec::WriteLightSection(core::ByteBuffer& buffer, const uint8_t* light)
+    {
+        WritePalettedSection(buffer, light);
+    }
+
+    bool ChunkPacketCodec::ReadLightSection(core::ByteBuffer& buffer, uint8_t* outLight)
+    {
+        return ReadPalettedSection(buffer, outLight);
+    }
+
+    bool ChunkPacketCodec::IsSectionEmpty(const uint32_t* blocks)
+    {
+        for (int32_t i = 0; i < kBlocksPerChunkSection; ++i)
+        {
+            if (blocks[i] != kAirNetworkStateId)
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    uint64_t ChunkPacketCodec::HashLightSection(const uint8_t* light)
+    {
+        // FNV-1a, 仅用于判断光照是否变化
+        uint64_t hash = 14695981039346656037ull;
+        for (int32_t i = 0; i < kBlocksPerChunkSection; ++i)
+        {
+            hash ^= light[i];
+            hash *= 1099511628211ull;
+        }
+        return hash;
+    }
+
+    //-------------------------------------------------------------------------------------------
+    // 包头与简单包
+    //-------------------------------------------------------------------------------------------
+    void ChunkPacketCodec::WritePacketHeader(core::ByteBuffer& buffer, ChunkPacketType type, IntVec2 chunkCoords)
+    {
+        buffer.WriteByte(static_cast<uint8_t>(type));
+        buffer.Write(chunkCoords);
+    }
+
+    ChunkPacketType ChunkPacketCodec::ReadPacketType(core::ByteBuffer& buffer)
+    {
+        return static_cast<ChunkPacketType>(buffer.ReadByte());
+    }
+
+    void ChunkPacketCodec::WriteChunkUnload(core::ByteBuffer& buffer, IntVec2 chunkCoords)
+    {
+        WritePacketHeader(buffer, ChunkPacketType::ChunkUnload, chunkCoords);
+    }
+
+    void ChunkPacketCodec::WriteClientView(core::ByteBuffer& buffer, const Vec3& position)
+    {
+        buffer.WriteByte(static_cast<uint8_t>(ChunkPacketType::ClientView));
+        buffer.Write(position);
+    }
+
+    //-------------------------------------------------------------------------------------------
+    // SectionDelta条目
+    //-------------------------------------------------------------------------------------------
+    void ChunkPacketCodec::WriteSparseDelta(core::ByteBuffer& buffer, uint8_t sectionY, const std::vector<BlockChange>& changes)
+    {
+        buffer.WriteByte(sectionY);
+        buffer.WriteByte(static_cast<uint8_t>(DeltaMode::Sparse));
+        buffer.WriteUnsignedShort(static_cast<uint16_t>(changes.size()));
+        for (const BlockChange& change : changes)
+        {
+            buffer.WriteUnsignedShort(change.sectionIndex);
+            buffer.WriteUnsignedInt(change.stateId);
+        }
+    }
+
+    void ChunkPacketCodec::WriteFullSectionDelta(core::ByteBuffer& buffer, uint8_t sectionY, const uint32_t* blocks)
+    {
+        buffer.WriteByte(sectionY);
+        buffer.WriteByte(static_cast<uint8_t>(DeltaMode::FullSection));
+        WriteBlockSection(buffer, blocks);
+    }
+}
@@ -0,0 +1,68 @@
+﻿#pragma once
+#include "ChunkNetworkProtocol.hpp"
+#include "Engine/Core/Buffer/ByteBuffer.hpp"
+#include "Engine/Math/Vec3.hpp"
+
+#include <cstdint>
+#include <vector>
+
+namespace enigma::voxel
+{
+    /**
+     * @brief 区块网络包编解码器(全部经由ByteBuffer / BufferSerializable)
+     *
+     * Section容器格式(调色板 + 位压缩, 每个值不跨越64位字边界):
+     *   [uint8 bitsPerEntry]
+     *   bitsPerEntry == 0: [value]                          // 整个Section为同一值
+     *   bitsPerEntry >  0: [uint16 paletteSize][palette...][uint64 words...]
+     *   words数量 = ceil(4096 / (64 / bitsPerEntry))
+     *
+     * 包格式:
+     *   ChunkData:    [type][IntVec2][uint8 firstSection][uint8 count]
+     *                 { [uint8 flags(bit0=hasBlocks)][方块容器(可选)][光照容器] } * count
+     *   SectionDelta: [type][IntVec2][uint8 count]
+     *                 { [uint8 sectionY][uint8 mode] mode0: [uint16 n]{uint16 index, uint32 stateId}*n
+     *                                                mode1: [方块容器] } * count
+     *   LightUpdate:  [type][IntVec2][uint8 count]{ [uint8 sectionY][光照容器] } * count
+     *   ChunkUnload:  [type][IntVec2]
+     *   ClientView:   [type][Vec3 position]
+     *
+     * 读取函数在数据格式非法时返回false; 数据截断时ByteBuffer抛出BufferUnderflowException。
+     */
+    class ChunkPacketCodec
+    {
+    public:
+        struct BlockChange
+        {
+            uint16_t sectionIndex = 0; // Section内局部索引(0-4095)
+            uint32_t stateId      = kAirNetworkStateId;
+        };
+
+        enum class DeltaMode : uint8_t
+        {
+            Sparse      = 0,
+            FullSection = 1
+        };
+
+        //=== Section容器 ===
+        static void WriteBlockSection(core::ByteBuffer& buffer, const uint32_t* blocks);
+        static bool ReadBlockSection(core::ByteBuffer& buffer, uint32_t* outBlocks);
+        static void WriteLightSection(core::ByteBuffer& buffer, const uint8_t* light);
+        static bool ReadLightSection(core::ByteBuffer& buffer, uint8_t* outLight);
+
+        static bool     IsSectionEmpty(const uint32_t* blocks);
+        static uint64_t HashLightSection(const uint8_t* light);
+
+        //=== 包头 ===
+        static void            WritePacketHeader(core::ByteBuffer& buffer, ChunkPacketType type, IntVec2 chunkCoords);
+        static ChunkPacketType ReadPacketType(core::ByteBuffer& buffer);
+
+        //=== 简单包 ===
+        static void WriteChunkUnload(core::ByteBuffer& buffer, IntVec2 chunkCoords);
+        static void WriteClientView(core::ByteBuffer& buffer, const Vec3& position);
+
+        //=== SectionDelta条目 ===
+        static void WriteSparseDelta(core::ByteBuffer& buffer, uint8_t sectionY, const std::vector<BlockChange>& changes);
+        static void WriteFullSectionDelta(core::ByteBuffer& buffer, uint8_t sectionY, const uint32_t* blocks);
+    };
+}
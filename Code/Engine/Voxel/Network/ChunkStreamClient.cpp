@@ -0,0 +1,227 @@
+﻿#include "ChunkStreamClient.hpp"
+#include "Engine/Core/Buffer/BufferSerializable.hpp"
+#include "Engine/Core/Logger/LoggerAPI.hpp"
+
+namespace enigma::voxel
+{
+    using namespace enigma::core;
+
+    ChunkStreamClient::ChunkStreamClient(network::NetworkIoBackend& backend, network::ConnectionId serverConnection)
+        : m_backend(backend)
+          , m_serverConnection(serverConnection)
+    {
+    }
+
+    bool ChunkStreamClient::SendViewCenter(const Vec3& position)
+    {
+        core::ByteBuffer packet;
+        ChunkPacketCodec::WriteClientView(packet, position);
+        return m_backend.SendFrame(m_serverConnection, packet) == network::NetworkSendResult::Ok;
+    }
+
+    size_t ChunkStreamClient::Tick()
+    {
+        size_t                    processed = 0;
+        network::NetworkFrameView frame;
+        while (m_backend.AcquireFrame(m_serverConnection, frame))
+        {
+            HandlePacket(frame.data, frame.size);
+            m_backend.ReleaseFrame(m_serverConnection);
+            ++processed;
+        }
+        return processed;
+    }
+
+    bool ChunkStreamClient::HandlePacket(const uint8_t* data, size_t size)
+    {
+        ++m_stats.packetsReceived;
+        m_stats.bytesReceived += size;
+
+        bool valid = false;
+        try
+        {
+            core::ByteBuffer buffer      = core::ByteBuffer::Wrap(data, size);
+            ChunkPacketType  type        = ChunkPacketCodec::ReadPacketType(buffer);
+            IntVec2          chunkCoords = buffer.Read<IntVec2>();
+
+            if (type == ChunkPacketType::ChunkData)
+            {
+                m_stats.chunkDataBytes += size;
+                valid = HandleChunkData(buffer, chunkCoords);
+            }
+            else if (type == ChunkPacketType::ChunkUnload)
+            {
+                valid = m_chunks.erase(PackNetworkChunkCoords(chunkCoords)) != 0;
+                m_stats.chunksUnloaded += valid ? 1 : 0;
+            }
+            else
+            {
+                auto it = m_chunks.find(PackNetworkChunkCoords(chunkCoords));
+                if (it != m_chunks.end() && type == ChunkPacketType::SectionDelta)
+                {
+                    m_stats.deltaBytes += size;
+                    valid = HandleSectionDelta(buffer, *it->second);
+                }
+                else if (it != m_chunks.end() && type == ChunkPacketType::LightUpdate)
+                {
+                    m_stats.lightBytes += size;
+                    valid = HandleLightUpdate(buffer, *it->second);
+                }
+            }
+        }
+        catch (const core::BufferUnderflowException&)
+        {
+            valid = false;
+        }
+
+        if (!valid)
+        {
+            ++m_stats.malformedPackets;
+            LogWarn("chunk_stream", "Discarded malformed or unexpected chunk packet (%zu bytes)", size);
+        }
+        return valid;
+    }
+
+    bool ChunkStreamClient::HandleChunkData(core::ByteBuffer& buffer, IntVec2 chunkCoords)
+    {
+        uint8_t firstSection = buffer.ReadByte();
+        uint8_t sectionCount = buffer.ReadByte();
+        if (firstSection + sectionCount > kChunkSectionCount)
+        {
+            return false;
+        }
+
+        std::unique_ptr<ChunkSnapshot>& slot = m_chunks[PackNetworkChunkCoords(chunkCoords)];
+        if (!slot || firstSection == 0)
+        {
+            // 首段到达(或重新加载)时重置镜像
+            slot              = std::make_unique<ChunkSnapshot>();
+            slot->chunkCoords = chunkCoords;
+        }
+        ChunkSnapshot& snapshot = *slot;
+
+        for (int32_t sectionY = firstSection; sectionY < firstSection + sectionCount; ++sectionY)
+        {
+            bool                   hasBlocks = (buffer.ReadByte() & 1) != 0;
+            std::vector<uint32_t>& blocks    = snapshot.sectionBlocks[sectionY];
+            if (hasBlocks)
+            {
+                blocks.resize(kBlocksPerChunkSection);
+                if (!ChunkPacketCodec::ReadBlockSection(buffer, blocks.data()))
+                {
+                    return false;
+                }
+            }
+            else
+            {
+                blocks.clear();
+            }
+
+            std::vector<uint8_t>& light = snapshot.sectionLight[sectionY];
+            light.resize(kBlocksPerChunkSection);
+            if (!ChunkPacketCodec::ReadLightSection(buffer, light.data()))
+            {
+                return false;
+            }
+        }
+
+        snapshot.receivedSectionCount += sectionCount;
+        if (firstSection + sectionCount == kChunkSectionCount)
+        {
+            snapshot.complete = snapshot.receivedSectionCount == static_cast<uint32_t>(kChunkSectionCount);
+            ++m_stats.chunksCompleted;
+            Notify(snapshot, ChunkPacketType::ChunkData);
+        }
+        return true;
+    }
+
+    bool ChunkStreamClient::HandleSectionDelta(core::ByteBuffer& buffer, ChunkSnapshot& snapshot)
+    {
+        uint8_t entryCount = buffer.ReadByte();
+        for (uint8_t entry = 0; entry < entryCount; ++entry)
+        {
+            uint8_t sectionY = buffer.ReadByte();
+            uint8_t mode     = buffer.ReadByte();
+            if (sectionY >= kChunkSectionCount)
+            {
+                return false;
+            }
+
+            std::vector<uint32_t>& blocks = snapshot.sectionBlocks[sectionY];
+            blocks.resize(kBlocksPerChunkSection, kAirNetworkStateId);
+            if (mode == static_cast<uint8_t>(ChunkPacketCodec::DeltaMode::FullSection))
+            {
+                if (!ChunkPacketCodec::ReadBlockSection(buffer, blocks.data()))
+                {
+                    return false;
+                }
+                m_stats.blockChangesApplied += kBlocksPerChunkSection;
+                continue;
+            }
+            if (mode != static_cast<uint8_t>(ChunkPacketCodec::DeltaMode::Sparse))
+            {
+                return false;
+            }
+
+            uint16_t changeCount = buffer.ReadUnsignedShort();
+            for (uint16_t change = 0; change < changeCount; ++change)
+            {
+                uint16_t sectionIndex = buffer.ReadUnsignedShort();
+                uint32_t stateId      = buffer.ReadUnsignedInt();
+                if (sectionIndex >= kBlocksPerChunkSection)
+                {
+                    return false;
+                }
+                blocks[sectionIndex] = stateId;
+            }
+            m_stats.blockChangesApplied += changeCount;
+        }
+        Notify(snapshot, ChunkPacketType::SectionDelta);
+        return true;
+    }
+
+    bool ChunkStreamClient::HandleLightUpdate(core::ByteBuffer& buffer, ChunkSnapshot& snapshot)
+    {
+        uint8_t entryCount = buffer.ReadByte();
+        for (uint8_t entry = 0; entry < entryCount; ++entry)
+        {
+            uint8_t sectionY = buffer.ReadByte();
+            if (sectionY >= kChunkSectionCount)
+            {
+                return false;
+            }
+            std::vector<uint8_t>& light = snapshot.sectionLight[sectionY];
+            light.resize(kBlocksPerChunkSection);
+            if (!ChunkPacketCodec::ReadLightSection(buffer, light.data()))
+            {
+                return false;
+            }
+        }
+        Notify(snapshot, ChunkPacketType::LightUpdate);
+        return true;
+    }
+
+    void ChunkStreamClient::Notify(const ChunkSnapshot& snapshot, ChunkPacketType reason) const
+    {
+        if (m_listener && snapshot.complete)
+        {
+            m_listener(snapshot, reason);
+        }
+    }
+
+    const ChunkSnapshot* ChunkStreamClient::FindChunk(IntVec2 chunkCoords) const
+    {
+        auto it = m_chunks.find(PackNetworkChunkCoords(chunkCoords));
+        return it != m_chunks.end() ? it->second.get() : nullptr;
+    }
+
+    size_t ChunkStreamClient::GetCompleteChunkCount() const
+    {
+        size_t count = 0;
+        for (const auto& [packedCoords, snapshot] : m_chunks)
+        {
+            count += snapshot->complete ? 1 : 0;
+        }
+        return count;
+    }
+}
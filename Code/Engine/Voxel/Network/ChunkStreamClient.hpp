@@ -0,0 +1,69 @@
+﻿#pragma once
+#include "ChunkNetworkProtocol.hpp"
+#include "ChunkPacketCodec.hpp"
+#include "Engine/Network/NetworkIoBackend.hpp"
+
+#include <functional>
+#include <memory>
+#include <unordered_map>
+
+namespace enigma::voxel
+{
+    struct ChunkStreamClientStats
+    {
+        uint64_t packetsReceived     = 0;
+        uint64_t bytesReceived       = 0;
+        uint64_t chunkDataBytes      = 0;
+        uint64_t deltaBytes          = 0;
+        uint64_t lightBytes          = 0;
+        uint64_t chunksCompleted     = 0;
+        uint64_t chunksUnloaded      = 0;
+        uint64_t blockChangesApplied = 0; // 稀疏变化条目 + 整Section重发 * 4096
+        uint64_t malformedPackets    = 0;
+    };
+
+    /**
+     * @brief 区块同步客户端 - 无头区块镜像
+     *
+     * 接收ChunkStreamServer的数据包并维护ChunkSnapshot镜像, 不依赖渲染或World。
+     * 需要写回真实World时, 通过SetChunkListener在区块完成/变化时得到通知
+     * (参见WorldChunkReplicationSource::ApplySnapshot)。
+     *
+     * 线程: 非线程安全, Tick()与查询须在同一线程。
+     */
+    class ChunkStreamClient
+    {
+    public:
+        using ChunkListener = std::function<void(const ChunkSnapshot& snapshot, ChunkPacketType reason)>;
+
+        ChunkStreamClient(network::NetworkIoBackend& backend, network::ConnectionId serverConnection);
+
+        /// 上报观察者位置(世界坐标, z向上), 服务器据此排序与卸载区块
+        bool SendViewCenter(const Vec3& position);
+
+        /// 处理所有已缓冲的帧, 返回处理的包数量
+        size_t Tick();
+
+        /// 解析单个数据包; 格式非法时返回false并计入malformedPackets
+        bool HandlePacket(const uint8_t* data, size_t size);
+
+        const ChunkSnapshot* FindChunk(IntVec2 chunkCoords) const;
+        size_t               GetCompleteChunkCount() const;
+        size_t               GetChunkCount() const { return m_chunks.size(); }
+
+        void                          SetChunkListener(ChunkListener listener) { m_listener = std::move(listener); }
+        const ChunkStreamClientStats& GetStats() const { return m_stats; }
+
+    private:
+        bool HandleChunkData(core::ByteBuffer& buffer, IntVec2 chunkCoords);
+        bool HandleSectionDelta(core::ByteBuffer& buffer, ChunkSnapshot& snapshot);
+        bool HandleLightUpdate(core::ByteBuffer& buffer, ChunkSnapshot& snapshot);
+        void Notify(const ChunkSnapshot& snapshot, ChunkPacketType reason) const;
+
+        network::NetworkIoBackend&                                  m_backend;
+        network::ConnectionId                                       m_serverConnection = network::kInvalidConnectionId;
+        std::unordered_map<int64_t, std::unique_ptr<ChunkSnapshot>> m_chunks;
+        ChunkListener                                               m_listener;
+        ChunkStreamClientStats                                      m_stats;
+    };
+}
@@ -0,0 +1,521 @@
+﻿#include "ChunkStreamServer.hpp"
+#include "Engine/Core/Buffer/BufferSerializable.hpp"
+#include "Engine/Core/Logger/LoggerAPI.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+namespace enigma::voxel
+{
+    using namespace enigma::core;
+
+    namespace
+    {
+        // [type][IntVec2] 之后的字段偏移
+        constexpr size_t kPacketHeaderBytes   = 1 + 2 * sizeof(int32_t);
+        constexpr size_t kChunkDataCountOffset = kPacketHeaderBytes + 1; // [firstSection][count]
+        constexpr size_t kEntryCountOffset     = kPacketHeaderBytes; // SectionDelta / LightUpdate: [count]
+
+        IntVec2 GetChunkCoordsForPosition(const Vec3& position)
+        {
+            return IntVec2(static_cast<int32_t>(std::floor(position.x)) >> 4, static_cast<int32_t>(std::floor(position.y)) >> 4);
+        }
+
+        int64_t GetDistanceSquared(IntVec2 a, IntVec2 b)
+        {
+            int64_t dx = static_cast<int64_t>(a.x) - b.x;
+            int64_t dy = static_cast<int64_t>(a.y) - b.y;
+            return dx * dx + dy * dy;
+        }
+
+        void BeginEntryPacket(core::ByteBuffer& packet, ChunkPacketType type, IntVec2 chunkCoords)
+        {
+            ChunkPacketCodec::WritePacketHeader(packet, type, chunkCoords);
+            packet.WriteByte(0); // 条目数量, 封包时回填
+        }
+    }
+
+    ChunkStreamServer::ChunkStreamServer(network::NetworkIoBackend& backend, IChunkReplicationSource& source, const ChunkStreamConfig& config)
+        : m_backend(backend)
+          , m_source(source)
+          , m_config(config)
+    {
+    }
+
+    //-------------------------------------------------------------------------------------------
+    // 连接管理
+    //-------------------------------------------------------------------------------------------
+    void ChunkStreamServer::AddConnection(network::ConnectionId connectionId)
+    {
+        ConnectionState& connection = m_connections[connectionId];
+        connection.id               = connectionId;
+    }
+
+    void ChunkStreamServer::RemoveConnection(network::ConnectionId connectionId)
+    {
+        auto it = m_connections.find(connectionId);
+        if (it == m_connections.end())
+        {
+            return;
+        }
+        for (int64_t packedCoords : it->second.sentChunks)
+        {
+            ReleaseHolder(packedCoords);
+        }
+        m_connections.erase(it);
+    }
+
+    void ChunkStreamServer::SetViewCenter(network::ConnectionId connectionId, const Vec3& position)
+    {
+        auto it = m_connections.find(connectionId);
+        if (it != m_connections.end())
+        {
+            UpdateViewCenter(it->second, position);
+        }
+    }
+
+    void ChunkStreamServer::UpdateViewCenter(ConnectionState& connection, const Vec3& position)
+    {
+        IntVec2 centerChunk = GetChunkCoordsForPosition(position);
+        if (connection.hasView && centerChunk == connection.centerChunk)
+        {
+            return;
+        }
+        connection.hasView     = true;
+        connection.centerChunk = centerChunk;
+        RebuildSendOrder(connection);
+    }
+
+    void ChunkStreamServer::RebuildSendOrder(ConnectionState& connection)
+    {
+        const int32_t radius        = m_config.viewRadius;
+        const int64_t radiusSquared = static_cast<int64_t>(radius) * radius;
+
+        connection.sendOrder.clear();
+        for (int32_t dy = -radius; dy <= radius; ++dy)
+        {
+            for (int32_t dx = -radius; dx <= radius; ++dx)
+            {
+                IntVec2 chunkCoords(connection.centerChunk.x + dx, connection.centerChunk.y + dy);
+                if (GetDistanceSquared(chunkCoords, connection.centerChunk) <= radiusSquared)
+                {
+                    connection.sendOrder.push_back(chunkCoords);
+                }
+            }
+        }
+
+        IntVec2 center = connection.centerChunk;
+        std::stable_sort(connection.sendOrder.begin(), connection.sendOrder.end(), [center](const IntVec2& a, const IntVec2& b)
+        {
+            return GetDistanceSquared(a, center) < GetDistanceSquared(b, center);
+        });
+    }
+
+    //-------------------------------------------------------------------------------------------
+    // 世界变化通知
+    //-------------------------------------------------------------------------------------------
+    void ChunkStreamServer::OnBlockChanged(IntVec2 chunkCoords, int32_t chunkIndex)
+    {
+        int64_t packedCoords = PackNetworkChunkCoords(chunkCoords);
+        if (chunkIndex < 0 || chunkIndex >= kBlocksPerNetworkChunk || m_holderCounts.count(packedCoords) == 0)
+        {
+            return; // 没有客户端持有该区块, 之后的完整发送自然包含最新状态
+        }
+
+        int32_t     sectionY = chunkIndex >> 12;
+        DirtyChunk& dirty    = m_dirtyChunks[packedCoords];
+        dirty.changedIndices[sectionY].push_back(static_cast<uint16_t>(chunkIndex & 0xFFF));
+        dirty.lightDirtyMask |= 1u << sectionY; // 方块变化通常伴随光照变化, 内容未变时会被哈希过滤
+    }
+
+    void ChunkStreamServer::OnLightChanged(IntVec2 chunkCoords, int32_t sectionY)
+    {
+        int64_t packedCoords = PackNetworkChunkCoords(chunkCoords);
+        if (sectionY < 0 || sectionY >= kChunkSectionCount || m_holderCounts.count(packedCoords) == 0)
+        {
+            return;
+        }
+        m_dirtyChunks[packedCoords].lightDirtyMask |= 1u << sectionY;
+    }
+
+    void ChunkStreamServer::OnChunkUnloaded(IntVec2 chunkCoords)
+    {
+        int64_t packedCoords = PackNetworkChunkCoords(chunkCoords);
+        for (auto& [connectionId, connection] : m_connections)
+        {
+            if (connection.sentChunks.erase(packedCoords) != 0)
+            {
+                EnqueueUnload(connection, chunkCoords);
+                ReleaseHolder(packedCoords);
+            }
+        }
+        m_dirtyChunks.erase(packedCoords);
+    }
+
+    //-------------------------------------------------------------------------------------------
+    // Tick
+    //-------------------------------------------------------------------------------------------
+    void ChunkStreamServer::Tick()
+    {
+        for (auto& [connectionId, connection] : m_connections)
+        {
+            ReceiveClientPackets(connection);
+        }
+
+        FlushWorldChanges();
+
+        for (auto& [connectionId, connection] : m_connections)
+        {
+            UnloadOutOfRange(connection);
+
+            size_t budgetUsed = 0;
+            if (DrainOutbound(connection, budgetUsed))
+            {
+                StreamChunks(connection, budgetUsed);
+            }
+        }
+    }
+
+    void ChunkStreamServer::ReceiveClientPackets(ConnectionState& connection)
+    {
+        network::NetworkFrameView frame;
+        while (m_backend.AcquireFrame(connection.id, frame))
+        {
+            try
+            {
+                core::ByteBuffer buffer = frame.ToByteBuffer();
+                ChunkPacketType  type   = ChunkPacketCodec::ReadPacketType(buffer);
+                if (type == ChunkPacketType::ClientView)
+                {
+                    UpdateViewCenter(connection, buffer.Read<Vec3>());
+                }
+                else
+                {
+                    LogWarn("chunk_stream", "Ignoring unexpected packet type %u from connection %llu",
+                            static_cast<unsigned>(type), static_cast<unsigned long long>(connection.id));
+                }
+            }
+            catch (const core::BufferUnderflowException&)
+            {
+                LogWarn("chunk_stream", "Truncated packet from connection %llu", static_cast<unsigned long long>(connection.id));
+            }
+            m_backend.ReleaseFrame(connection.id);
+        }
+    }
+
+    void ChunkStreamServer::FlushWorldChanges()
+    {
+        std::vector<ChunkPacketCodec::BlockChange> changes;
+        core::ByteBuffer                           entry;
+
+        for (auto& [packedCoords, dirty] : m_dirtyChunks)
+        {
+            IntVec2                                     chunkCoords = UnpackNetworkChunkCoords(packedCoords);
+            std::array<uint64_t, kChunkSectionCount>&   lightHashes = m_lightHashes[packedCoords];
+            std::vector<SharedPacket>                   deltaPackets;
+            std::vector<SharedPacket>                   lightPackets;
+            core::ByteBuffer                            deltaPacket;
+            core::ByteBuffer                            lightPacket;
+            uint8_t                                     deltaCount = 0;
+            uint8_t                                     lightCount = 0;
+            BeginEntryPacket(deltaPacket, ChunkPacketType::SectionDelta, chunkCoords);
+            BeginEntryPacket(lightPacket, ChunkPacketType::LightUpdate, chunkCoords);
+
+            for (int32_t sectionY = 0; sectionY < kChunkSectionCount; ++sectionY)
+            {
+                std::vector<uint16_t>& changedIndices = dirty.changedIndices[sectionY];
+                bool                   lightDirty     = (dirty.lightDirtyMask & (1u << sectionY)) != 0;
+                if (changedIndices.empty() && !lightDirty)
+                {
+                    continue;
+                }
+
+                m_source.CaptureSection(chunkCoords, sectionY, m_blockScratch.data(), m_lightScratch.data());
+
+                if (!changedIndices.empty())
+                {
+                    std::sort(changedIndices.begin(), changedIndices.end());
+                    changedIndices.erase(std::unique(changedIndices.begin(), changedIndices.end()), changedIndices.end());
+
+                    if (changedIndices.size() > m_config.sparseDeltaLimit)
+                    {
+                        ChunkPacketCodec::WriteFullSectionDelta(entry, static_cast<uint8_t>(sectionY), m_blockScratch.data());
+                    }
+                    else
+                    {
+                        changes.clear();
+                        for (uint16_t sectionIndex : changedIndices)
+                        {
+                            changes.push_back({sectionIndex, m_blockScratch[sectionIndex]});
+                        }
+                        ChunkPacketCodec::WriteSparseDelta(entry, static_cast<uint8_t>(sectionY), changes);
+                    }
+                    AppendEntry(deltaPackets, deltaPacket, entry, deltaCount, ChunkPacketType::SectionDelta, chunkCoords, m_config.maxPacketBytes);
+                }
+
+                uint64_t lightHash = ChunkPacketCodec::HashLightSection(m_lightScratch.data());
+                if (lightHash != lightHashes[sectionY])
+                {
+                    lightHashes[sectionY] = lightHash;
+                    entry.WriteByte(static_cast<uint8_t>(sectionY));
+                    ChunkPacketCodec::WriteLightSection(entry, m_lightScratch.data());
+                    AppendEntry(lightPackets, lightPacket, entry, lightCount, ChunkPacketType::LightUpdate, chunkCoords, m_config.maxPacketBytes);
+                }
+                else if (lightDirty)
+                {
+                    ++m_stats.suppressedLightSend;
+                }
+            }
+
+            if (deltaCount > 0)
+            {
+                deltaPacket.OverwriteAt<uint8_t>(kEntryCountOffset, deltaCount);
+                deltaPackets.push_back(Share(deltaPacket));
+            }
+            if (lightCount > 0)
+            {
+                lightPacket.OverwriteAt<uint8_t>(kEntryCountOffset, lightCount);
+                lightPackets.push_back(Share(lightPacket));
+            }
+            for (const SharedPacket& packet : deltaPackets)
+            {
+                Broadcast(packedCoords, packet, PacketCategory::Delta);
+            }
+            for (const SharedPacket& packet : lightPackets)
+            {
+                Broadcast(packedCoords, packet, PacketCategory::Light);
+            }
+        }
+        m_dirtyChunks.clear();
+    }
+
+    void ChunkStreamServer::UnloadOutOfRange(ConnectionState& connection)
+    {
+        if (!connection.hasView)
+        {
+            return;
+        }
+
+        const int64_t unloadRadius = m_config.viewRadius + 1;
+        for (auto it = connection.sentChunks.begin(); it != connection.sentChunks.end();)
+        {
+            IntVec2 chunkCoords = UnpackNetworkChunkCoords(*it);
+            if (GetDistanceSquared(chunkCoords, connection.centerChunk) <= unloadRadius * unloadRadius)
+            {
+                ++it;
+                continue;
+            }
+            int64_t packedCoords = *it;
+            it                   = connection.sentChunks.erase(it);
+            EnqueueUnload(connection, chunkCoords);
+            ReleaseHolder(packedCoords);
+        }
+    }
+
+    void ChunkStreamServer::StreamChunks(ConnectionState& connection, size_t& budgetUsed)
+    {
+        if (!connection.hasView)
+        {
+            return;
+        }
+
+        std::vector<SharedPacket> packets;
+        for (const IntVec2& chunkCoords : connection.sendOrder)
+        {
+            if (!connection.outbound.empty() || budgetUsed >= m_config.bytesPerTickBudget)
+            {
+                return; // 上一个区块尚未发完(预算或背压), 下一Tick继续
+            }
+
+            int64_t packedCoords = PackNetworkChunkCoords(chunkCoords);
+            if (connection.sentChunks.count(packedCoords) != 0 || !m_source.IsChunkReady(chunkCoords))
+            {
+                continue;
+            }
+
+            packets.clear();
+            EncodeChunk(chunkCoords, packets);
+            connection.sentChunks.insert(packedCoords);
+            for (size_t index = 0; index < packets.size(); ++index)
+            {
+                connection.outbound.push_back({packets[index], PacketCategory::ChunkData, index + 1 == packets.size()});
+            }
+            DrainOutbound(connection, budgetUsed);
+        }
+    }
+
+    bool ChunkStreamServer::DrainOutbound(ConnectionState& connection, size_t& budgetUsed)
+    {
+        while (!connection.outbound.empty())
+        {
+            const OutboundPacket& front = connection.outbound.front();
+            size_t                size  = front.packet->WrittenBytes();
+
+            // 预算只限制后续包; 每Tick至少发出一个包, 避免大于预算的包永远无法发送
+            if (budgetUsed > 0 && budgetUsed + size > m_config.bytesPerTickBudget)
+            {
+                ++m_stats.budgetDeferrals;
+                return false;
+            }
+
+            network::NetworkSendResult result = m_backend.SendFrame(connection.id, *front.packet);
+            if (result == network::NetworkSendResult::Backpressure)
+            {
+                ++m_stats.backpressureStalls;
+                return false;
+            }
+            if (result != network::NetworkSendResult::Ok)
+            {
+                LogWarn("chunk_stream", "Dropping %zu queued packets for connection %llu",
+                        connection.outbound.size(), static_cast<unsigned long long>(connection.id));
+                connection.outbound.clear();
+                return false;
+            }
+
+            budgetUsed += size;
+            switch (front.category)
+            {
+            case PacketCategory::ChunkData:
+                m_stats.chunkBytes += size;
+                m_stats.chunksSent += front.completesChunk ? 1 : 0;
+                break;
+            case PacketCategory::Delta:
+                ++m_stats.deltaPackets;
+                m_stats.deltaBytes += size;
+                break;
+            case PacketCategory::Light:
+                ++m_stats.lightPackets;
+                m_stats.lightBytes += size;
+                break;
+            case PacketCategory::Unload:
+                ++m_stats.unloadPackets;
+                break;
+            }
+            connection.outbound.pop_front();
+        }
+        return true;
+    }
+
+    //-------------------------------------------------------------------------------------------
+    // 编码
+    //-------------------------------------------------------------------------------------------
+    void ChunkStreamServer::EncodeChunk(IntVec2 chunkCoords, std::vector<SharedPacket>& outPackets)
+    {
+        int64_t packedCoords = PackNetworkChunkCoords(chunkCoords);
+        bool    firstHolder  = ++m_holderCounts[packedCoords] == 1;
+        auto&   lightHashes  = m_lightHashes[packedCoords];
+
+        core::ByteBuffer packet;
+        core::ByteBuffer entry;
+        uint8_t          sectionCount = 0;
+        auto             beginPacket  = [&](int32_t firstSection)
+        {
+            ChunkPacketCodec::WritePacketHeader(packet, ChunkPacketType::ChunkData, chunkCoords);
+            packet.WriteByte(static_cast<uint8_t>(firstSection));
+            packet.WriteByte(0);
+            sectionCount = 0;
+        };
+        beginPacket(0);
+
+        for (int32_t sectionY = 0; sectionY < kChunkSectionCount; ++sectionY)
+        {
+            m_source.CaptureSection(chunkCoords, sectionY, m_blockScratch.data(), m_lightScratch.data());
+
+            bool hasBlocks = !ChunkPacketCodec::IsSectionEmpty(m_blockScratch.data());
+            entry.WriteByte(hasBlocks ? 1 : 0);
+            if (hasBlocks)
+            {
+                ChunkPacketCodec::WriteBlockSection(entry, m_blockScratch.data());
+            }
+            ChunkPacketCodec::WriteLightSection(entry, m_lightScratch.data());
+
+            // 已有其他持有者时, 光照与上次复制不一致说明有未通知的变化: 标记为脏, 下一Tick同步给所有持有者
+            uint64_t lightHash = ChunkPacketCodec::HashLightSection(m_lightScratch.data());
+            if (firstHolder)
+            {
+                lightHashes[sectionY] = lightHash;
+            }
+            else if (lightHashes[sectionY] != lightHash)
+            {
+                m_dirtyChunks[packedCoords].lightDirtyMask |= 1u << sectionY;
+            }
+
+            if (sectionCount > 0 && packet.WrittenBytes() + entry.WrittenBytes() > m_config.maxPacketBytes)
+            {
+                packet.OverwriteAt<uint8_t>(kChunkDataCountOffset, sectionCount);
+                outPackets.push_back(Share(packet));
+                beginPacket(sectionY);
+            }
+            packet.WriteRawBytes(entry.Data(), entry.WrittenBytes());
+            entry.Clear();
+            ++sectionCount;
+        }
+
+        packet.OverwriteAt<uint8_t>(kChunkDataCountOffset, sectionCount);
+        outPackets.push_back(Share(packet));
+    }
+
+    void ChunkStreamServer::EnqueueUnload(ConnectionState& connection, IntVec2 chunkCoords)
+    {
+        core::ByteBuffer packet;
+        ChunkPacketCodec::WriteChunkUnload(packet, chunkCoords);
+        connection.outbound.push_back({Share(packet), PacketCategory::Unload, false});
+    }
+
+    void ChunkStreamServer::Broadcast(int64_t packedCoords, const SharedPacket& packet, PacketCategory category)
+    {
+        for (auto& [connectionId, connection] : m_connections)
+        {
+            if (connection.sentChunks.count(packedCoords) != 0)
+            {
+                connection.outbound.push_back({packet, category, false});
+            }
+        }
+    }
+
+    void ChunkStreamServer::ReleaseHolder(int64_t packedCoords)
+    {
+        auto it = m_holderCounts.find(packedCoords);
+        if (it == m_holderCounts.end() || --it->second > 0)
+        {
+            return;
+        }
+        m_holderCounts.erase(it);
+        m_lightHashes.erase(packedCoords);
+        m_dirtyChunks.erase(packedCoords);
+    }
+
+    ChunkStreamServer::SharedPacket ChunkStreamServer::Share(core::ByteBuffer& buffer)
+    {
+        SharedPacket shared = std::make_shared<const core::ByteBuffer>(std::move(buffer));
+        buffer              = core::ByteBuffer();
+        return shared;
+    }
+
+    void ChunkStreamServer::AppendEntry(std::vector<SharedPacket>& packets, core::ByteBuffer& packet, core::ByteBuffer& entry,
+                                        uint8_t& entryCount, ChunkPacketType type, IntVec2 chunkCoords, size_t maxPacketBytes)
+    {
+        if (entryCount > 0 && packet.WrittenBytes() + entry.WrittenBytes() > maxPacketBytes)
+        {
+            packet.OverwriteAt<uint8_t>(kEntryCountOffset, entryCount);
+            packets.push_back(Share(packet));
+            BeginEntryPacket(packet, type, chunkCoords);
+            entryCount = 0;
+        }
+        packet.WriteRawBytes(entry.Data(), entry.WrittenBytes());
+        entry.Clear();
+        ++entryCount;
+    }
+
+    size_t ChunkStreamServer::GetSentChunkCount(network::ConnectionId connectionId) const
+    {
+        auto it = m_connections.find(connectionId);
+        return it != m_connections.end() ? it->second.sentChunks.size() : 0;
+    }
+
+    size_t ChunkStreamServer::GetQueuedPacketCount(network::ConnectionId connectionId) const
+    {
+        auto it = m_connections.find(connectionId);
+        return it != m_connections.end() ? it->second.outbound.size() : 0;
+    }
+}
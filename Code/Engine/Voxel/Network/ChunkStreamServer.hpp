@@ -0,0 +1,152 @@
+﻿#pragma once
+#include "ChunkNetworkProtocol.hpp"
+#include "ChunkPacketCodec.hpp"
+#include "Engine/Network/NetworkIoBackend.hpp"
+
+#include <array>
+#include <deque>
+#include <memory>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+namespace enigma::voxel
+{
+    /**
+     * @brief 服务器端区块数据来源
+     *
+     * 将具体的World(或无头测试世界)与同步层解耦。所有调用发生在ChunkStreamServer::Tick所在线程。
+     */
+    class IChunkReplicationSource
+    {
+    public:
+        virtual ~IChunkReplicationSource() = default;
+
+        /// 区块是否已生成完毕并可以发送
+        virtual bool IsChunkReady(IntVec2 chunkCoords) const = 0;
+
+        /// 读取一个Section: outBlocks为4096个网络状态ID, outLight为4096个光照字节
+        virtual void CaptureSection(IntVec2 chunkCoords, int32_t sectionY, uint32_t* outBlocks, uint8_t* outLight) const = 0;
+    };
+
+    struct ChunkStreamConfig
+    {
+        int32_t viewRadius         = 8; // 区块半径(圆形), 超出 viewRadius + 1 时卸载
+        size_t  bytesPerTickBudget = 256 * 1024; // 每个连接每Tick最多发送的字节数
+        size_t  maxPacketBytes     = 60 * 1024; // 单包上限, 必须不大于NetworkIoBackendConfig::maxFrameBytes
+        size_t  sparseDeltaLimit   = 512; // 单个Section变化超过该数量时整Section重发
+    };
+
+    struct ChunkStreamStats
+    {
+        uint64_t chunksSent          = 0;
+        uint64_t chunkBytes          = 0; // ChunkData包总字节数, chunkBytes / chunksSent 即每区块字节数
+        uint64_t deltaPackets        = 0;
+        uint64_t deltaBytes          = 0;
+        uint64_t lightPackets        = 0;
+        uint64_t lightBytes          = 0;
+        uint64_t unloadPackets       = 0;
+        uint64_t budgetDeferrals     = 0; // 因字节预算推迟到下一Tick的次数
+        uint64_t backpressureStalls  = 0; // NetworkIoBackend返回Backpressure的次数
+        uint64_t suppressedLightSend = 0; // 标记为脏但内容未变化而跳过的光照Section
+    };
+
+    /**
+     * @brief 区块同步服务器
+     *
+     * 职责:
+     *   - 按客户端位置的距离优先级发送完整区块(调色板 + 位压缩, 按maxPacketBytes拆分为多个ChunkData包)
+     *   - 将Tick间累积的方块修改合并为每区块一个SectionDelta包, 变化较多的Section整体重发
+     *   - 光照仅在Section内容哈希变化时发送(LightUpdate)
+     *   - 每个连接每Tick受bytesPerTickBudget限制, 并尊重NetworkIoBackend的发送背压
+     *
+     * 用法:
+     *   通过World::SetChunkStreamServer挂接后, World在方块修改、光照变化与区块卸载时自动调用
+     *   OnBlockChanged / OnLightChanged / OnChunkUnloaded; 其他数据来源需自行调用。每帧调用一次Tick()。
+     *   客户端通过ClientView包上报位置, 也可以由服务器直接调用SetViewCenter。
+     *
+     * 线程: 非线程安全, 所有调用须在同一线程(通常为主线程)。
+     */
+    class ChunkStreamServer
+    {
+    public:
+        ChunkStreamServer(network::NetworkIoBackend& backend, IChunkReplicationSource& source, const ChunkStreamConfig& config = ChunkStreamConfig());
+
+        void AddConnection(network::ConnectionId connectionId);
+        void RemoveConnection(network::ConnectionId connectionId);
+        void SetViewCenter(network::ConnectionId connectionId, const Vec3& position);
+
+        void OnBlockChanged(IntVec2 chunkCoords, int32_t chunkIndex);
+        void OnLightChanged(IntVec2 chunkCoords, int32_t sectionY);
+        void OnChunkUnloaded(IntVec2 chunkCoords);
+
+        void Tick();
+
+        size_t                  GetSentChunkCount(network::ConnectionId connectionId) const;
+        size_t                  GetQueuedPacketCount(network::ConnectionId connectionId) const;
+        const ChunkStreamStats& GetStats() const { return m_stats; }
+
+    private:
+        using SharedPacket = std::shared_ptr<const core::ByteBuffer>;
+
+        enum class PacketCategory : uint8_t
+        {
+            ChunkData,
+            Delta,
+            Light,
+            Unload
+        };
+
+        struct OutboundPacket
+        {
+            SharedPacket   packet;
+            PacketCategory category       = PacketCategory::ChunkData;
+            bool           completesChunk = false; // 区块最后一个ChunkData包
+        };
+
+        struct ConnectionState
+        {
+            network::ConnectionId       id = network::kInvalidConnectionId;
+            bool                        hasView = false;
+            IntVec2                     centerChunk;
+            std::vector<IntVec2>        sendOrder; // 视距内区块, 按到centerChunk的距离排序
+            std::unordered_set<int64_t> sentChunks; // 已进入发送队列(客户端视为持有)的区块
+            std::deque<OutboundPacket>  outbound; // 严格FIFO, 保证ChunkData先于其后的增量
+        };
+
+        struct DirtyChunk
+        {
+            std::array<std::vector<uint16_t>, kChunkSectionCount> changedIndices;
+            uint32_t                                              lightDirtyMask = 0;
+        };
+
+        void ReceiveClientPackets(ConnectionState& connection);
+        void UpdateViewCenter(ConnectionState& connection, const Vec3& position);
+        void FlushWorldChanges();
+        void UnloadOutOfRange(ConnectionState& connection);
+        void StreamChunks(ConnectionState& connection, size_t& budgetUsed);
+        bool DrainOutbound(ConnectionState& connection, size_t& budgetUsed);
+        void EncodeChunk(IntVec2 chunkCoords, std::vector<SharedPacket>& outPackets);
+        void EnqueueUnload(ConnectionState& connection, IntVec2 chunkCoords);
+        void Broadcast(int64_t packedCoords, const SharedPacket& packet, PacketCategory category);
+        void ReleaseHolder(int64_t packedCoords);
+        void RebuildSendOrder(ConnectionState& connection);
+
+        static SharedPacket Share(core::ByteBuffer& buffer);
+        static void         AppendEntry(std::vector<SharedPacket>& packets, core::ByteBuffer& packet, core::ByteBuffer& entry,
+                                        uint8_t& entryCount, ChunkPacketType type, IntVec2 chunkCoords, size_t maxPacketBytes);
+
+        network::NetworkIoBackend& m_backend;
+        IChunkReplicationSource&   m_source;
+        ChunkStreamConfig          m_config;
+        ChunkStreamStats           m_stats;
+
+        std::unordered_map<network::ConnectionId, ConnectionState> m_connections;
+        std::unordered_map<int64_t, DirtyChunk>                    m_dirtyChunks;
+        std::unordered_map<int64_t, uint32_t>                      m_holderCounts; // 持有该区块的连接数
+        std::unordered_map<int64_t, std::array<uint64_t, kChunkSectionCount>> m_lightHashes; // 最近一次复制出去的光照
+
+        std::vector<uint32_t> m_blockScratch = std::vector<uint32_t>(kBlocksPerChunkSection);
+        std::vector<uint8_t>  m_lightScratch = std::vector<uint8_t>(kBlocksPerChunkSection);
+    };
+}
@@ -0,0 +1,111 @@
+﻿#include "WorldChunkReplicationSource.hpp"
+#include "../Chunk/Chunk.hpp"
+#include "../World/World.hpp"
+#include "../../Registry/Block/BlockRegistry.hpp"
+
+#include <algorithm>
+
+namespace enigma::voxel
+{
+    using namespace enigma::registry::block;
+
+    static_assert(Chunk::CHUNK_SIZE_X * Chunk::CHUNK_SIZE_Y * kChunkSectionHeight == kBlocksPerChunkSection,
+                  "Chunk section layout must match the network protocol");
+    static_assert(Chunk::BLOCKS_PER_CHUNK == kBlocksPerNetworkChunk, "Chunk height must match the network protocol");
+
+    WorldChunkReplicationSource::WorldChunkReplicationSource(World* world)
+        : m_world(world)
+    {
+    }
+
+    bool WorldChunkReplicationSource::IsChunkReady(IntVec2 chunkCoords) const
+    {
+        Chunk* chunk = m_world ? m_world->GetChunk(chunkCoords.x, chunkCoords.y) : nullptr;
+        return chunk != nullptr && chunk->IsActive();
+    }
+
+    void WorldChunkReplicationSource::CaptureSection(IntVec2 chunkCoords, int32_t sectionY, uint32_t* outBlocks, uint8_t* outLight) const
+    {
+        const Chunk* chunk = m_world ? m_world->GetChunk(chunkCoords.x, chunkCoords.y) : nullptr;
+        if (!chunk)
+        {
+            std::fill(outBlocks, outBlocks + kBlocksPerChunkSection, kAirNetworkStateId);
+            std::fill(outLight, outLight + kBlocksPerChunkSection, static_cast<uint8_t>(0));
+            return;
+        }
+
+        // Section内索引与Chunk::CoordsToIndex同序: x最快, 其次y, 最后z
+        int32_t sectionIndex = 0;
+        int32_t baseZ        = sectionY * kChunkSectionHeight;
+        for (int32_t z = baseZ; z < baseZ + kChunkSectionHeight; ++z)
+        {
+            for (int32_t y = 0; y < Chunk::CHUNK_SIZE_Y; ++y)
+            {
+                for (int32_t x = 0; x < Chunk::CHUNK_SIZE_X; ++x, ++sectionIndex)
+                {
+                    outBlocks[sectionIndex] = ToNetworkStateId(chunk->GetBlock(x, y, z));
+                    outLight[sectionIndex]  = static_cast<uint8_t>((chunk->GetSkyLight(x, y, z) << 4) | (chunk->GetBlockLight(x, y, z) & 0x0F));
+                }
+            }
+        }
+    }
+
+    uint32_t WorldChunkReplicationSource::ToNetworkStateId(const BlockState* state)
+    {
+        if (!state || !state->GetBlock())
+        {
+            return kAirNetworkStateId;
+        }
+        int32_t blockId = state->GetBlock()->GetNumericId();
+        if (blockId < 0)
+        {
+            return kAirNetworkStateId;
+        }
+        return (static_cast<uint32_t>(blockId) << 16) | static_cast<uint32_t>(state->GetStateIndex() & 0xFFFF);
+    }
+
+    BlockState* WorldChunkReplicationSource::FromNetworkStateId(uint32_t stateId)
+    {
+        auto block = BlockRegistry::GetBlockById(static_cast<int>(stateId >> 16));
+        if (!block)
+        {
+            block = BlockRegistry::GetBlock("simpleminer", "air");
+        }
+        if (!block)
+        {
+            return nullptr;
+        }
+        BlockState* state = block->GetStateByIndex(stateId & 0xFFFF);
+        return state ? state : block->GetDefaultState();
+    }
+
+    size_t WorldChunkReplicationSource::ApplySnapshot(const ChunkSnapshot& snapshot, Chunk* chunk)
+    {
+        if (!chunk)
+        {
+            return 0;
+        }
+
+        size_t  changedCount = 0;
+        int32_t chunkIndex   = 0;
+        for (int32_t z = 0; z < Chunk::CHUNK_SIZE_Z; ++z)
+        {
+            for (int32_t y = 0; y < Chunk::CHUNK_SIZE_Y; ++y)
+            {
+                for (int32_t x = 0; x < Chunk::CHUNK_SIZE_X; ++x, ++chunkIndex)
+                {
+                    uint32_t stateId = snapshot.GetStateId(chunkIndex);
+                    if (ToNetworkStateId(chunk->GetBlock(x, y, z)) != stateId)
+                    {
+                        chunk->SetBlock(x, y, z, FromNetworkStateId(stateId));
+                        ++changedCount;
+                    }
+                    uint8_t light = snapshot.GetLight(chunkIndex);
+                    chunk->SetSkyLight(x, y, z, static_cast<uint8_t>(light >> 4));
+                    chunk->SetBlockLight(x, y, z, static_cast<uint8_t>(light & 0x0F));
+                }
+            }
+        }
+        return changedCount;
+    }
+}
@@ -0,0 +1,36 @@
+﻿#pragma once
+#include "ChunkStreamServer.hpp"
+
+namespace enigma::voxel
+{
+    class BlockState;
+    class Chunk;
+    class World;
+
+    /**
+     * @brief 以World为数据来源的区块同步适配器
+     *
+     * 服务器端: 将Chunk中的BlockState*与光照转换为网络状态ID与光照字节。
+     * 客户端: ApplySnapshot将ChunkStreamClient的镜像写回客户端World中的Chunk。
+     *
+     * 网络状态ID = (Block数值ID << 16) | BlockState索引, 与ESFSChunkSerializer一样依赖
+     * 服务器与客户端使用相同的BlockRegistry注册顺序。
+     */
+    class WorldChunkReplicationSource : public IChunkReplicationSource
+    {
+    public:
+        explicit WorldChunkReplicationSource(World* world);
+
+        bool IsChunkReady(IntVec2 chunkCoords) const override;
+        void CaptureSection(IntVec2 chunkCoords, int32_t sectionY, uint32_t* outBlocks, uint8_t* outLight) const override;
+
+        static uint32_t    ToNetworkStateId(const BlockState* state);
+        static BlockState* FromNetworkStateId(uint32_t stateId);
+
+        /// 将完整镜像写入chunk(不标记为玩家修改), 返回实际变化的方块数量
+        static size_t ApplySnapshot(const ChunkSnapshot& snapshot, Chunk* chunk);
+
+    private:
+        World* m_world = nullptr;
+    };
+}
@@ -5,3 +5,19 @@ float NoiseGenerator::Sample2D(float x, float z) const
 {
     return Sample(x, 0.0f, z);
 }
+
+void NoiseGenerator::SampleBatch(const float* x, const float* y, const float* z, float* out, size_t count) const
+{
+    for (size_t i = 0; i < count; ++i)
+    {
+        out[i] = Sample(x[i], y[i], z[i]);
+    }
+}
+
+void NoiseGenerator::Sample2DBatch(const float* x, const float* z, float* out, size_t count) const
+{
+    for (size_t i = 0; i < count; ++i)
+    {
+        out[i] = Sample2D(x[i], z[i]);
+    }
+}
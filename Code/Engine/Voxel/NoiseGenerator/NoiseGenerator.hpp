@@ -1,4 +1,5 @@
 ﻿#pragma once
+#include <cstddef>
 #include <string>
 
 namespace enigma::voxel
@@ -22,6 +23,9 @@ namespace enigma::voxel
         virtual float Sample(float x, float y, float z) const = 0;
         // Optional: 2D sampling (required for some applications)
         virtual float Sample2D(float x, float z) const;
+        // Batch sampling: out[i] = Sample(x[i], y[i], z[i]); generators with a vectorized path override these
+        virtual void SampleBatch(const float* x, const float* y, const float* z, float* out, size_t count) const;
+        virtual void Sample2DBatch(const float* x, const float* z, float* out, size_t count) const;
         // Get the noise type
         virtual NoiseType GetType() const = 0;
         // Get configuration information (for serialization)
@@ -1,5 +1,6 @@
 ﻿#include "PerlinNoiseGenerator.hpp"
 
+#include "Engine/Math/NoiseBatch.hpp"
 #include "Engine/Math/SmoothNoise.hpp"
 using namespace enigma::voxel;
 
@@ -39,6 +40,16 @@ float PerlinNoiseGenerator::Sample2D(float x, float z) const
     );
 }
 
+void PerlinNoiseGenerator::SampleBatch(const float* x, const float* y, const float* z, float* out, size_t count) const
+{
+    Compute3dPerlinNoiseBatch(x, y, z, out, count, m_scale, m_numOctaves, m_octavePersistence, m_octaveScale, m_renormalize, m_seed);
+}
+
+void PerlinNoiseGenerator::Sample2DBatch(const float* x, const float* z, float* out, size_t count) const
+{
+    Compute2dPerlinNoiseBatch(x, z, out, count, m_scale, m_numOctaves, m_octavePersistence, m_octaveScale, m_renormalize, m_seed);
+}
+
 NoiseType PerlinNoiseGenerator::GetType() const
 {
     return NoiseType::PERLIN;
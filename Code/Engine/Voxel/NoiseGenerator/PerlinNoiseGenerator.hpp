@@ -17,6 +17,8 @@ namespace enigma::voxel
 
         float       Sample(float x, float y, float z) const override;
         float       Sample2D(float x, float z) const override;
+        void        SampleBatch(const float* x, const float* y, const float* z, float* out, size_t count) const override;
+        void        Sample2DBatch(const float* x, const float* z, float* out, size_t count) const override;
         NoiseType   GetType() const override;
         std::string GetConfigString() const override;
 
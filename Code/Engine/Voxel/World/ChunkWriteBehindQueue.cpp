@@ -0,0 +1,294 @@
+#include "ChunkWriteBehindQueue.hpp"
+#include "Engine/Voxel/Chunk/ChunkHelper.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <limits>
+
+namespace enigma::voxel
+{
+    namespace
+    {
+        constexpr int32_t WRITE_ORDER_REGION_BITS = 5; // 32x32 chunks, the ESF region size
+    }
+
+    ChunkWriteBehindQueue::ChunkWriteBehindQueue(const ChunkWriteBehindConfig& config)
+        : m_config(config)
+    {
+    }
+
+    uint64_t ChunkWriteBehindQueue::GetWriteOrderKey(IntVec2 coords)
+    {
+        // Bias the 16-bit region coordinate so negative regions sort before positive ones
+        auto bias = [](int32_t value) { return static_cast<uint64_t>((static_cast<uint32_t>(value) + 0x8000u) & 0xFFFFu); };
+
+        const uint64_t regionY = bias(coords.y >> WRITE_ORDER_REGION_BITS);
+        const uint64_t regionX = bias(coords.x >> WRITE_ORDER_REGION_BITS);
+        const uint64_t localY  = static_cast<uint64_t>(coords.y & ((1 << WRITE_ORDER_REGION_BITS) - 1));
+        const uint64_t localX  = static_cast<uint64_t>(coords.x & ((1 << WRITE_ORDER_REGION_BITS) - 1));
+        return (regionY << 48) | (regionX << 32) | (localY << WRITE_ORDER_REGION_BITS) | localX;
+    }
+
+    void ChunkWriteBehindQueue::Enqueue(IntVec2 coords, std::vector<uint8_t>&& payload, bool playerModified, double nowSeconds)
+    {
+        const size_t payloadBytes = payload.size();
+        auto         shared       = std::make_shared<const std::vector<uint8_t>>(std::move(payload));
+
+        std::lock_guard<std::mutex> lock(m_mutex);
+        ++m_stats.enqueued;
+
+        auto [it, inserted] = m_pending.try_emplace(ChunkHelper::PackCoordinates(coords.x, coords.y));
+        PendingSave& save = it->second;
+        if (inserted)
+        {
+            save.coords        = coords;
+            save.queuedSeconds = nowSeconds;
+        }
+        else
+        {
+            // Keep the original queue time so repeated saves cannot postpone the write forever
+            ++m_stats.coalesced;
+            m_stats.pendingBytes -= (std::min)(m_stats.pendingBytes, save.payload->size());
+        }
+
+        save.payload        = std::move(shared);
+        save.sequence       = m_nextSequence++;
+        save.playerModified = save.playerModified || playerModified;
+
+        m_stats.pendingBytes += payloadBytes;
+        m_stats.peakPendingBytes = (std::max)(m_stats.peakPendingBytes, m_stats.pendingBytes);
+    }
+
+    bool ChunkWriteBehindQueue::Find(IntVec2 coords, ChunkWriteBehindHit& outHit) const
+    {
+        const int64_t               key = ChunkHelper::PackCoordinates(coords.x, coords.y);
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        auto it = m_pending.find(key);
+        if (it == m_pending.end())
+        {
+            it = m_inFlight.find(key);
+            if (it == m_inFlight.end())
+            {
+                return false;
+            }
+        }
+
+        outHit.payload        = it->second.payload;
+        outHit.sequence       = it->second.sequence;
+        outHit.playerModified = it->second.playerModified;
+        return true;
+    }
+
+    bool ChunkWriteBehindQueue::Contains(IntVec2 coords) const
+    {
+        const int64_t               key = ChunkHelper::PackCoordinates(coords.x, coords.y);
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_pending.count(key) > 0 || m_inFlight.count(key) > 0;
+    }
+
+    bool ChunkWriteBehindQueue::Reclaim(IntVec2 coords, uint64_t sequence)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        auto it = m_pending.find(ChunkHelper::PackCoordinates(coords.x, coords.y));
+        if (it == m_pending.end() || it->second.sequence != sequence)
+        {
+            return false; // Already on its way to disk, or replaced by a newer save
+        }
+
+        RemovePendingLocked(it);
+        ++m_stats.reclaimed;
+        return true;
+    }
+
+    void ChunkWriteBehindQueue::RemovePendingLocked(std::unordered_map<int64_t, PendingSave>::iterator it)
+    {
+        m_stats.pendingBytes -= (std::min)(m_stats.pendingBytes, it->second.payload->size());
+        m_pending.erase(it);
+    }
+
+    ChunkWriteBatch ChunkWriteBehindQueue::PopDueBatch(double nowSeconds)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (m_batchInFlight || m_pending.empty())
+        {
+            return ChunkWriteBatch();
+        }
+        return TakeBatchLocked(m_config.maxBatchEntries, nowSeconds, false);
+    }
+
+    ChunkWriteBatch ChunkWriteBehindQueue::TakeBatchLocked(size_t maxEntries, double nowSeconds, bool takeAll)
+    {
+        ChunkWriteBatch batch;
+
+        if (!takeAll)
+        {
+            // Cheap pre-check: nothing is due while under budget and the oldest save is young
+            double oldestSeconds = std::numeric_limits<double>::max();
+            for (const auto& [key, save] : m_pending)
+            {
+                oldestSeconds = (std::min)(oldestSeconds, save.queuedSeconds);
+            }
+            if (m_stats.pendingBytes <= m_config.maxPendingBytes && nowSeconds - oldestSeconds < m_config.maxPendingSeconds)
+            {
+                return batch;
+            }
+        }
+
+        // Oldest first: aged-out saves, then whatever brings the pending bytes back under budget
+        std::vector<std::pair<double, int64_t>> byAge;
+        byAge.reserve(m_pending.size());
+        for (const auto& [key, save] : m_pending)
+        {
+            byAge.emplace_back(save.queuedSeconds, key);
+        }
+        std::sort(byAge.begin(), byAge.end());
+
+        size_t remainingBytes = m_stats.pendingBytes;
+        for (const auto& [queuedSeconds, key] : byAge)
+        {
+            const bool due = takeAll ||
+                nowSeconds - queuedSeconds >= m_config.maxPendingSeconds ||
+                remainingBytes > m_config.maxPendingBytes;
+            if (!due || batch.entries.size() >= maxEntries)
+            {
+                break;
+            }
+
+            auto it = m_pending.find(key);
+
+            ChunkWriteEntry entry;
+            entry.coords         = it->second.coords;
+            entry.payload        = it->second.payload;
+            entry.sequence       = it->second.sequence;
+            entry.playerModified = it->second.playerModified;
+            batch.entries.push_back(entry);
+
+            remainingBytes -= (std::min)(remainingBytes, it->second.payload->size());
+            m_inFlight[key] = it->second;
+            RemovePendingLocked(it);
+        }
+
+        std::sort(batch.entries.begin(), batch.entries.end(), [](const ChunkWriteEntry& a, const ChunkWriteEntry& b)
+        {
+            return GetWriteOrderKey(a.coords) < GetWriteOrderKey(b.coords);
+        });
+
+        m_batchInFlight = !batch.entries.empty();
+        return batch;
+    }
+
+    void ChunkWriteBehindQueue::WriteBatch(ChunkWriteBatch& batch, const WriteFunction& writeFunction)
+    {
+        const auto start = std::chrono::steady_clock::now();
+        for (ChunkWriteEntry& entry : batch.entries)
+        {
+            entry.written = writeFunction(entry.coords, *entry.payload);
+        }
+        batch.writeMicros += static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(
+            std::chrono::steady_clock::now() - start).count());
+    }
+
+    void ChunkWriteBehindQueue::CompleteBatch(ChunkWriteBatch&& batch)
+    {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            for (ChunkWriteEntry& entry : batch.entries)
+            {
+                const int64_t key = ChunkHelper::PackCoordinates(entry.coords.x, entry.coords.y);
+                auto          it  = m_inFlight.find(key);
+                if (it == m_inFlight.end() || it->second.sequence != entry.sequence)
+                {
+                    continue;
+                }
+
+                PendingSave save = std::move(it->second);
+                m_inFlight.erase(it);
+
+                if (entry.written)
+                {
+                    ++m_stats.written;
+                    continue;
+                }
+
+                // Retry on the next due batch unless the chunk was saved again meanwhile
+                ++m_stats.failed;
+                if (m_pending.count(key) == 0)
+                {
+                    m_stats.pendingBytes += save.payload->size();
+                    m_pending.emplace(key, std::move(save));
+                }
+            }
+
+            m_stats.writeMicros += batch.writeMicros;
+            ++m_stats.batches;
+            m_batchInFlight = false;
+        }
+        m_batchDone.notify_all();
+        batch.entries.clear();
+    }
+
+    bool ChunkWriteBehindQueue::FlushAll(const WriteFunction& writeFunction, const ProgressFunction& progress)
+    {
+        ChunkWriteBatch batch;
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_batchDone.wait(lock, [this]() { return !m_batchInFlight; });
+            if (m_pending.empty())
+            {
+                return true;
+            }
+            batch = TakeBatchLocked(std::numeric_limits<size_t>::max(), 0.0, true);
+        }
+
+        const size_t total = batch.entries.size();
+        const auto   start = std::chrono::steady_clock::now();
+        size_t       failures = 0;
+        for (size_t i = 0; i < total; ++i)
+        {
+            ChunkWriteEntry& entry = batch.entries[i];
+            entry.written          = writeFunction(entry.coords, *entry.payload);
+            failures += entry.written ? 0 : 1;
+            if (progress)
+            {
+                progress(i + 1, total);
+            }
+        }
+        batch.writeMicros = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(
+            std::chrono::steady_clock::now() - start).count());
+
+        CompleteBatch(std::move(batch));
+        return failures == 0;
+    }
+
+    bool ChunkWriteBehindQueue::HasBatchInFlight() const
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_batchInFlight;
+    }
+
+    void ChunkWriteBehindQueue::SetConfig(const ChunkWriteBehindConfig& config)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_config = config;
+    }
+
+    ChunkWriteBehindStats ChunkWriteBehindQueue::GetStats() const
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        ChunkWriteBehindStats stats = m_stats;
+        stats.pendingEntries        = m_pending.size();
+        stats.inFlightEntries       = m_inFlight.size();
+        return stats;
+    }
+
+    void ChunkWriteBehindQueue::ResetStats()
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        const size_t pendingBytes = m_stats.pendingBytes;
+        m_stats                   = ChunkWriteBehindStats();
+        m_stats.pendingBytes      = pendingBytes;
+        m_stats.peakPendingBytes  = pendingBytes;
+    }
+}
@@ -0,0 +1,154 @@
+#pragma once
+#include "Engine/Math/IntVec2.hpp"
+
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+namespace enigma::voxel
+{
+    /**
+     * @brief Limits that decide when pending chunk saves go to disk
+     *
+     * Entries stay in memory until they are older than maxPendingSeconds or the
+     * pending bytes exceed maxPendingBytes; a serialized ESFS chunk is typically
+     * 2-10 KB, so the default budget holds a few thousand unloaded chunks.
+     */
+    struct ChunkWriteBehindConfig
+    {
+        size_t maxPendingBytes   = 16ull * 1024 * 1024;
+        double maxPendingSeconds = 10.0;
+        size_t maxBatchEntries   = 64; // Chunks written per flush job
+    };
+
+    struct ChunkWriteBehindStats
+    {
+        uint64_t enqueued         = 0; // Enqueue() calls
+        uint64_t coalesced        = 0; // Enqueues that replaced a pending save of the same chunk
+        uint64_t reclaimed        = 0; // Pending saves dropped because the chunk was reloaded from memory
+        uint64_t written          = 0; // Chunk files committed to disk
+        uint64_t failed           = 0; // Writes that failed and were requeued
+        uint64_t batches          = 0; // Write batches completed
+        uint64_t writeMicros      = 0; // Time spent inside the write function
+        size_t   pendingEntries   = 0;
+        size_t   pendingBytes     = 0;
+        size_t   peakPendingBytes = 0;
+        size_t   inFlightEntries  = 0;
+
+        uint64_t GetAvoidedWrites() const { return coalesced + reclaimed; }
+        double   GetWritesPerSecond() const { return writeMicros == 0 ? 0.0 : static_cast<double>(written) * 1.0e6 / static_cast<double>(writeMicros); }
+    };
+
+    /// One chunk save taken out of the queue for writing
+    struct ChunkWriteEntry
+    {
+        IntVec2                                     coords;
+        std::shared_ptr<const std::vector<uint8_t>> payload; // Serialized chunk, immutable once queued
+        uint64_t                                    sequence       = 0;
+        bool                                        playerModified = false;
+        bool                                        written        = false;
+    };
+
+    /// Coordinate-sorted set of saves written by one flush job
+    struct ChunkWriteBatch
+    {
+        std::vector<ChunkWriteEntry> entries;
+        uint64_t                     writeMicros = 0;
+
+        bool IsEmpty() const { return entries.empty(); }
+    };
+
+    /// A pending or in-flight save found for a chunk that is being loaded again
+    struct ChunkWriteBehindHit
+    {
+        std::shared_ptr<const std::vector<uint8_t>> payload;
+        uint64_t                                    sequence       = 0;
+        bool                                        playerModified = false;
+    };
+
+    /**
+     * @brief Write-behind buffer for serialized chunk saves
+     *
+     * Unloaded dirty chunks are serialized once and parked here instead of being
+     * written immediately. A second save of the same chunk replaces the pending
+     * one, and a chunk that is loaded again before its save reached disk is read
+     * back from memory (Find/Reclaim), so short unload/reload cycles cost no I/O.
+     *
+     * Writes leave in batches sorted by region and chunk coordinates. Only one
+     * batch is in flight at a time, which keeps successive saves of a chunk in
+     * order; FlushAll() waits for it and then drains everything synchronously.
+     * The write function is expected to commit each file atomically.
+     *
+     * Threading: WriteBatch/CompleteBatch run on a FileIO worker, everything else
+     * on the main thread; all shared state is guarded by the internal mutex.
+     */
+    class ChunkWriteBehindQueue
+    {
+    public:
+        using WriteFunction    = std::function<bool(IntVec2 coords, const std::vector<uint8_t>& payload)>;
+        using ProgressFunction = std::function<void(size_t written, size_t total)>;
+
+        explicit ChunkWriteBehindQueue(const ChunkWriteBehindConfig& config = ChunkWriteBehindConfig());
+
+        ChunkWriteBehindQueue(const ChunkWriteBehindQueue&)            = delete;
+        ChunkWriteBehindQueue& operator=(const ChunkWriteBehindQueue&) = delete;
+
+        /// Park a serialized save; replaces (coalesces) a pending save of the same chunk
+        void Enqueue(IntVec2 coords, std::vector<uint8_t>&& payload, bool playerModified, double nowSeconds);
+
+        /// Latest pending or in-flight save of a chunk, so loads never read a stale file
+        bool Find(IntVec2 coords, ChunkWriteBehindHit& outHit) const;
+        bool Contains(IntVec2 coords) const;
+
+        /// Drop the pending save a reloaded chunk was built from; the chunk is dirty again instead
+        bool Reclaim(IntVec2 coords, uint64_t sequence);
+
+        /// Take the saves that are due (aged out or over the byte budget); empty while a batch is in flight
+        ChunkWriteBatch PopDueBatch(double nowSeconds);
+
+        /// Worker side: write every entry of the batch, then hand it back through CompleteBatch()
+        void WriteBatch(ChunkWriteBatch& batch, const WriteFunction& writeFunction);
+
+        /// Retire an in-flight batch; unwritten entries are requeued unless a newer save replaced them
+        void CompleteBatch(ChunkWriteBatch&& batch);
+
+        /// Wait for the in-flight batch, then write every pending save on the calling thread
+        bool FlushAll(const WriteFunction& writeFunction, const ProgressFunction& progress = nullptr);
+
+        bool                          HasBatchInFlight() const;
+        void                          SetConfig(const ChunkWriteBehindConfig& config);
+        const ChunkWriteBehindConfig& GetConfig() const { return m_config; }
+        ChunkWriteBehindStats         GetStats() const;
+        void                          ResetStats();
+
+        /// Region-major sort key used to order writes
+        static uint64_t GetWriteOrderKey(IntVec2 coords);
+
+    private:
+        struct PendingSave
+        {
+            IntVec2                                     coords;
+            std::shared_ptr<const std::vector<uint8_t>> payload;
+            uint64_t                                    sequence       = 0;
+            double                                      queuedSeconds  = 0.0;
+            bool                                        playerModified = false;
+        };
+
+        ChunkWriteBatch TakeBatchLocked(size_t maxEntries, double nowSeconds, bool takeAll);
+        void            RemovePendingLocked(std::unordered_map<int64_t, PendingSave>::iterator it);
+
+        ChunkWriteBehindConfig                   m_config;
+        mutable std::mutex                       m_mutex;
+        std::condition_variable                  m_batchDone;
+        std::unordered_map<int64_t, PendingSave> m_pending;
+        std::unordered_map<int64_t, PendingSave> m_inFlight;
+        bool                                     m_batchInFlight = false;
+        uint64_t                                 m_nextSequence  = 1;
+        ChunkWriteBehindStats                    m_stats;
+    };
+}
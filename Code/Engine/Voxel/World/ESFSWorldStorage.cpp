@@ -2,6 +2,8 @@
 #include "../Chunk/Chunk.hpp"
 #include "../Chunk/ESFSFile.hpp"
 #include "../../Core/Logger/LoggerAPI.hpp"
+#include "../../Core/MappedFile.hpp"
+#include <filesystem>
 #include <fstream>
 
 #include "Engine/Voxel/Chunk/ESFFormat.hpp"
@@ -27,6 +29,8 @@ namespace enigma::voxel
             LogError(LogESF, "Failed to create region directory for world: %s", worldPath.c_str());
         }
 
+        RemoveStaleTempFiles();
+
         LogInfo(LogESF, "Initialized ESFS storage for world: %s", worldPath.c_str());
         LogInfo(LogESF, "Config: %s", config.ToString().c_str());
     }
@@ -51,55 +55,112 @@ namespace enigma::voxel
         const Chunk* chunk = static_cast<const Chunk*>(data);
 
         // Apply save strategy filter
+        if (!PassesSaveStrategy(chunk))
+        {
+            LogDebug(LogESF, "Skipping save for chunk (%d, %d) filtered by save strategy %s",
+                     chunkX, chunkY, ChunkSaveStrategyToString(m_config.saveStrategy));
+            return true; // Not an error, just skipped
+        }
+
+        // Serialize chunk using serializer (ESFS format: Header + RLE data)
+        std::vector<uint8_t> serializedData;
+        if (!m_serializer->SerializeChunk(chunk, serializedData))
+        {
+            LogError(LogESF, "Failed to serialize chunk (%d, %d)", chunkX, chunkY);
+            return false;
+        }
+
+        // Write serialized data to file
+        return WriteSerializedChunk(chunkX, chunkY, serializedData);
+    }
+
+    bool ESFSChunkStorage::PassesSaveStrategy(const Chunk* chunk) const
+    {
         switch (m_config.saveStrategy)
         {
         case ChunkSaveStrategy::ModifiedOnly:
-            if (!chunk->IsModified())
-            {
-                LogDebug(LogESF, "Skipping save for unmodified chunk (%d, %d)", chunkX, chunkY);
-                return true; // Not an error, just skipped
-            }
-            break;
+            return chunk->IsModified();
 
         case ChunkSaveStrategy::PlayerModifiedOnly:
-            // Check player-modified flag (only save chunks modified by player actions)
-            if (!chunk->IsPlayerModified())
-            {
-                LogDebug(LogESF, "Skipping save for non-player-modified chunk (%d, %d)", chunkX, chunkY);
-                return true;
-            }
-            break;
+            // Only save chunks modified by player actions
+            return chunk->IsPlayerModified();
 
         case ChunkSaveStrategy::All:
         default:
             // Save all chunks regardless
-            break;
+            return true;
         }
+    }
 
-        // Serialize chunk using serializer (ESFS format: Header + RLE data)
-        std::vector<uint8_t> serializedData;
-        if (!m_serializer->SerializeChunk(chunk, serializedData))
+    bool ESFSChunkStorage::WriteSerializedChunk(int32_t chunkX, int32_t chunkY, const std::vector<uint8_t>& serializedData)
+    {
+        // Write the whole file next to the target, then rename over it: a crash mid-write
+        // leaves the previous version intact and only an orphaned .tmp behind
+        const std::string filePath = ESFSFile::GetChunkFilePath(m_worldPath, chunkX, chunkY);
+        const std::string tempPath = filePath + TEMP_FILE_SUFFIX;
         {
-            LogError(LogESF, "Failed to serialize chunk (%d, %d)", chunkX, chunkY);
-            return false;
+            std::ofstream file(tempPath, std::ios::binary | std::ios::trunc);
+            if (!file.is_open())
+            {
+                LogError(LogESF, "Failed to open file for writing: %s", tempPath.c_str());
+                return false;
+            }
+
+            file.write(reinterpret_cast<const char*>(serializedData.data()), static_cast<std::streamsize>(serializedData.size()));
+            file.flush();
+            if (!file.good())
+            {
+                LogError(LogESF, "Failed to write chunk data to %s", tempPath.c_str());
+                file.close();
+                std::error_code ignored;
+                std::filesystem::remove(tempPath, ignored);
+                return false;
+            }
         }
 
-        // Write serialized data to file
-        std::string   filePath = ESFSFile::GetChunkFilePath(m_worldPath, chunkX, chunkY);
-        std::ofstream file(filePath, std::ios::binary | std::ios::trunc);
-        if (!file.is_open())
+        std::error_code ec;
+        std::filesystem::rename(tempPath, filePath, ec);
+        if (ec)
         {
-            LogError(LogESF, "Failed to open file for writing: %s", filePath.c_str());
+            LogError(LogESF, "Failed to commit %s: %s", filePath.c_str(), ec.message().c_str());
+            std::filesystem::remove(tempPath, ec);
             return false;
         }
 
-        file.write(reinterpret_cast<const char*>(serializedData.data()), serializedData.size());
-        file.close();
-
         ++m_chunksSaved;
         LogDebug(LogESF, "Saved chunk (%d, %d) to %s (%zu bytes) - Total saved: %zu",
-                 chunkX, chunkY, filePath.c_str(), serializedData.size(), m_chunksSaved);
+                 chunkX, chunkY, filePath.c_str(), serializedData.size(), m_chunksSaved.load());
+        return true;
+    }
+
+    void ESFSChunkStorage::RemoveStaleTempFiles()
+    {
+        std::error_code ec;
+        for (const auto& entry : std::filesystem::directory_iterator(m_worldPath + "/region", ec))
+        {
+            if (entry.path().extension() == TEMP_FILE_SUFFIX)
+            {
+                LogWarn(LogESF, "Removing interrupted chunk write: %s", entry.path().string().c_str());
+                std::error_code ignored;
+                std::filesystem::remove(entry.path(), ignored);
+            }
+        }
+    }
+
+    bool ESFSChunkStorage::LoadChunkFromMemory(Chunk* chunk, int32_t chunkX, int32_t chunkY, const std::vector<uint8_t>& serializedData)
+    {
+        if (!chunk || !m_serializer)
+        {
+            return false;
+        }
+
+        if (!m_serializer->DeserializeChunk(chunk, serializedData.data(), serializedData.size()))
+        {
+            LogError(LogESF, "Failed to deserialize pending save of chunk (%d, %d)", chunkX, chunkY);
+            return false;
+        }
 
+        ++m_chunksLoaded;
         return true;
     }
 
@@ -127,6 +188,26 @@ namespace enigma::voxel
             return false;
         }
 
+        // Zero-copy path: decode straight from the mapped file pages
+        if (m_config.memoryMappedLoad)
+        {
+            MappedFile mappedFile;
+            if (mappedFile.Open(filePath))
+            {
+                if (!m_serializer->DeserializeChunk(chunk, mappedFile.GetData(), mappedFile.GetSize()))
+                {
+                    LogError(LogESF, "Failed to deserialize chunk (%d, %d)", chunkX, chunkY);
+                    return false;
+                }
+
+                ++m_chunksLoaded;
+                LogDebug(LogESF, "Loaded chunk (%d, %d) from mapped %s (%zu bytes) - Total loaded: %zu",
+                         chunkX, chunkY, filePath.c_str(), mappedFile.GetSize(), m_chunksLoaded);
+                return true;
+            }
+            LogDebug(LogESF, "Could not map %s, falling back to buffered read", filePath.c_str());
+        }
+
         // Read serialized data from file
         std::ifstream file(filePath, std::ios::binary);
         if (!file.is_open())
@@ -163,6 +244,19 @@ namespace enigma::voxel
         return ESFSFile::ChunkExists(m_worldPath, chunkX, chunkY);
     }
 
+    void ESFSChunkStorage::PrefetchChunk(int32_t chunkX, int32_t chunkY)
+    {
+        if (!m_config.prefetchOnQueue)
+        {
+            return;
+        }
+
+        if (MappedFile::PrefetchFile(ESFSFile::GetChunkFilePath(m_worldPath, chunkX, chunkY)))
+        {
+            ++m_chunksPrefetched;
+        }
+    }
+
     bool ESFSChunkStorage::DeleteChunk(int32_t chunkX, int32_t chunkY)
     {
         bool success = ESFSFile::DeleteChunk(m_worldPath, chunkX, chunkY);
@@ -201,7 +295,9 @@ namespace enigma::voxel
         stats += "ESFS Storage Statistics:\n";
         stats += "  World Path: " + m_worldPath + "\n";
         stats += "  Chunks Loaded: " + std::to_string(m_chunksLoaded) + "\n";
-        stats += "  Chunks Saved: " + std::to_string(m_chunksSaved) + "\n";
+        stats += "  Chunks Saved: " + std::to_string(m_chunksSaved.load()) + "\n";
+        stats += "  Chunks Prefetched: " + std::to_string(m_chunksPrefetched) + "\n";
+        stats += "  Load Path: " + std::string(m_config.memoryMappedLoad ? "memory-mapped" : "buffered") + "\n";
         stats += "  Storage Format: ESFS (Single-file)\n";
         stats += "  Compression: RLE (Run-Length Encoding)\n";
         stats += "  Save Strategy: " + std::string(ChunkSaveStrategyToString(m_config.saveStrategy));
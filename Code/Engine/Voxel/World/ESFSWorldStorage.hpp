@@ -3,6 +3,7 @@
 #include "../Chunk/ESFSFile.hpp"
 #include "../Chunk/ChunkStorageConfig.hpp"
 #include "Engine/Core/EngineCommon.hpp"
+#include <atomic>
 #include <string>
 #include <memory>
 #include <vector>
@@ -86,6 +87,17 @@ namespace enigma::voxel
          */
         bool ChunkExists(int32_t chunkX, int32_t chunkY) const override;
 
+        /**
+         * @brief Start page-cache readahead of a chunk file that is about to be loaded
+         *
+         * Called on the main thread when a chunk enters the load queue, so the
+         * disk read overlaps the queue wait. No-op if config.prefetchOnQueue is off.
+         *
+         * @param chunkX Chunk X coordinate
+         * @param chunkY Chunk Y coordinate
+         */
+        void PrefetchChunk(int32_t chunkX, int32_t chunkY) override;
+
         /**
          * @brief Delete chunk file from disk
          *
@@ -148,7 +160,46 @@ namespace enigma::voxel
          */
         bool SaveChunkFromSnapshot(int32_t chunkX, int32_t chunkY, const std::vector<BlockState*>& blockData);
 
+        //-------------------------------------------------------------------------------------------
+        // Write-Behind Support (ChunkWriteBehindQueue / ChunkWriteBatchJob)
+        //-------------------------------------------------------------------------------------------
+
+        /**
+         * @brief Whether the configured save strategy keeps this chunk
+         */
+        bool PassesSaveStrategy(const Chunk* chunk) const;
+
+        /**
+         * @brief Atomically replace a chunk file with already serialized data
+         *
+         * Writes {file}.tmp and renames it over the chunk file, so readers and a
+         * crash mid-write only ever see a complete old or new file. Thread-safe
+         * for distinct chunks.
+         *
+         * @param chunkX Chunk X coordinate
+         * @param chunkY Chunk Y coordinate
+         * @param serializedData ESFSChunkSerializer output
+         * @return True if the file was committed
+         */
+        bool WriteSerializedChunk(int32_t chunkX, int32_t chunkY, const std::vector<uint8_t>& serializedData);
+
+        /**
+         * @brief Populate a chunk from a save that has not reached disk yet
+         *
+         * @param chunk Chunk to populate
+         * @param chunkX Chunk X coordinate
+         * @param chunkY Chunk Y coordinate
+         * @param serializedData ESFSChunkSerializer output held by the write-behind queue
+         * @return True if deserialized successfully
+         */
+        bool LoadChunkFromMemory(Chunk* chunk, int32_t chunkX, int32_t chunkY, const std::vector<uint8_t>& serializedData);
+
     private:
+        static constexpr const char* TEMP_FILE_SUFFIX = ".tmp";
+
+        /// Delete .tmp files left by writes that were interrupted before their rename
+        void RemoveStaleTempFiles();
+
         //-------------------------------------------------------------------------------------------
         // Member Variables
         //-------------------------------------------------------------------------------------------
@@ -157,7 +208,8 @@ namespace enigma::voxel
         IChunkSerializer*  m_serializer = nullptr; // Chunk serializer (not owned)
 
         // Statistics (for debugging/profiling)
-        mutable size_t m_chunksLoaded = 0;
-        mutable size_t m_chunksSaved  = 0;
+        mutable size_t      m_chunksLoaded     = 0;
+        std::atomic<size_t> m_chunksSaved      = 0; // Written by FileIO workers
+        size_t              m_chunksPrefetched = 0; // Main thread only
     };
 } // namespace enigma::voxel
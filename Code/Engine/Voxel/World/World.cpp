@@ -4,10 +4,16 @@
 #include "../Chunk/ChunkStorageConfig.hpp"
 #include "../Chunk/ESFSChunkSerializer.hpp"
 #include "../Chunk/ChunkHelper.hpp"
+#include "../Chunk/ChunkBatchRegionBuildTask.hpp"
+#include "../Chunk/ChunkMeshBuilder.hpp"
+#include "../Chunk/MeshBuild/ChunkMeshingMaterializer.hpp"
+#include "../Chunk/MeshBuild/ChunkMeshingSnapshot.hpp"
 #include "../Block/PlacementContext.hpp"
+#include "../Network/ChunkStreamServer.hpp"
 
 #include "Engine/Core/EngineCommon.hpp"
 #include "Engine/Core/Logger/LoggerAPI.hpp"
+#include "Engine/Core/Profiler/Profiler.hpp"
 #include "Engine/Renderer/IRenderer.hpp"
 #include "Engine/Renderer/Texture.hpp"
 #include "Engine/Resource/ResourceSubsystem.hpp"
@@ -57,6 +63,12 @@ static Direction GetDirectionFromNormal(const Vec3& normal)
     }
 }
 
+// Clock for ChunkWriteBehindQueue ages
+static double GetSecondsSince(std::chrono::steady_clock::time_point epoch)
+{
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - epoch).count();
+}
+
 World::~World()
 {
 }
@@ -111,9 +123,9 @@ void World::SetBlockState(const BlockPos& pos, BlockState* state) const
     {
         chunk->SetBlockWorldByPlayer(pos, state);
 
-        // Mark chunk for mesh rebuild on main thread
+        // Patch or rebuild the chunk mesh on main thread
         // This ensures visual feedback when player places/breaks blocks
-        const_cast<World*>(this)->ScheduleChunkMeshRebuild(chunk, true);
+        const_cast<World*>(this)->RequestChunkMeshEditUpdate(chunk);
     }
 }
 
@@ -164,7 +176,7 @@ bool World::IsBlockLoaded(const BlockPos& pos)
 
 BlockState* World::GetTopBlock(const BlockPos& pos)
 {
-    Chunk* chunk = GetChunk(pos.GetBlockXInChunk(), pos.GetBlockYInChunk());
+    Chunk* chunk = GetChunk(pos);
     if (chunk)
     {
         return chunk->GetTopBlock(pos);
@@ -174,10 +186,8 @@ BlockState* World::GetTopBlock(const BlockPos& pos)
 
 BlockState* World::GetTopBlock(int32_t x, int32_t y)
 {
-    UNUSED(x)
-    UNUSED(y)
-    ERROR_RECOVERABLE("World::GetTopBlock is not implemented")
-    return nullptr;
+    // Whole-column query: answered directly by the WorldSurface heightmap
+    return GetTopBlock(BlockPos(x, y, Chunk::CHUNK_MAX_Z));
 }
 
 int World::GetTopBlockZ(const BlockPos& pos)
@@ -622,6 +632,10 @@ void World::UnloadChunk(int32_t chunkCoordinateX, int32_t chunkCoordinateY)
     // Clean dirty light queue before deactivating chunk
     UndirtyAllBlocksInChunk(chunk);
     m_chunkRenderRegionStorage.NotifyChunkUnloaded(IntVec2(chunkCoordinateX, chunkCoordinateY));
+    if (m_chunkStreamServer)
+    {
+        m_chunkStreamServer->OnChunkUnloaded(IntVec2(chunkCoordinateX, chunkCoordinateY));
+    }
 
     // Validate pointer again before accessing chunk state (double insurance)
     const IntVec2 chunkCoords(chunkCoordinateX, chunkCoordinateY);
@@ -681,24 +695,22 @@ void World::UnloadChunk(int32_t chunkCoordinateX, int32_t chunkCoordinateY)
         // Other states: immediate deletion (preserve original behavior)
         LogDebug("world", "Chunk (%d, %d) safe to unload immediately (state: %d)", chunkCoordinateX, chunkCoordinateY, (int)currentState);
 
-        // Save chunk if modified and storage is configured
-        if (chunk && chunk->NeedsMeshRebuild() && m_chunkStorage && m_chunkSerializer)
+        // Park modified chunk data in the write-behind queue; it reaches disk in a later batch
+        if (QueueChunkForWriteBehind(chunk, chunkCoords))
         {
-            // The logic of saving to disk (simplified version, the full version is in SaveChunkToDisk)
-            // Only do basic serialization and saving here
-            LogDebug("world", "Saving modified chunk (%d, %d) to disk", chunkCoordinateX, chunkCoordinateY);
+            LogDebug("world", "Queued modified chunk (%d, %d) for write-behind save", chunkCoordinateX, chunkCoordinateY);
         }
 
         // Cleanup VBO resources to prevent GPU leaks
         if (chunk && chunk->GetMesh())
         {
-            chunk->SetMesh(nullptr);
+            m_chunkMeshBufferPool.Release(chunk->SetMesh(nullptr));
         }
 
         chunk->TrySetState(currentState, ChunkState::Inactive);
         EraseChunkMeshBuildState(chunkCoords);
+        m_chunkPool.Release(std::move(it->second));
         m_loadedChunks.erase(it);
-        // unique_ptr will automatically delete the chunk
     }
 }
 
@@ -835,30 +847,52 @@ std::vector<std::pair<int32_t, int32_t>> World::CalculateNeededChunks() const
 void World::Update(float deltaTime)
 {
     UNUSED(deltaTime)
+    ENGINE_PROFILE_SCOPE("World::Update");
     m_chunkBatchStats.ResetFrameCounters();
     m_asyncChunkMeshDiagnostics.ClearFrame();
 
     // Phase 3: Update nearby chunks (activate/deactivate based on player position)
-    UpdateNearbyChunks();
+    {
+        ENGINE_PROFILE_SCOPE("World::UpdateNearbyChunks");
+        UpdateNearbyChunks();
+    }
 
     // Phase 4: Process job queues with limits (submit pending → active)
-    ProcessJobQueues();
+    {
+        ENGINE_PROFILE_SCOPE("World::ProcessJobQueues");
+        ProcessJobQueues();
+    }
 
     // Phase 4: Remove distant jobs from pending queues
     RemoveDistantJobs();
 
     // Process completed chunk tasks from async workers (Phase 3)
-    ProcessCompletedChunkTasks();
+    {
+        ENGINE_PROFILE_SCOPE("World::ProcessCompletedChunkTasks");
+        ProcessCompletedChunkTasks();
+    }
+
+    // Hand aged-out or over-budget chunk saves to a FileIO worker
+    SubmitDueChunkWriteBatch();
 
     // [REFACTORED] Process dirty lighting via VoxelLightEngine
     m_voxelLightEngine->RunLightUpdates();
 
+    // Block edits whose light has settled: splice re-meshed sections into the current meshes
+    ApplyPendingChunkMeshPatches();
+
     // Dispatch mesh build work and optionally wait a bounded amount for important chunks.
-    UpdateChunkMeshes();
-    RunImportantChunkBoundedWait();
+    {
+        ENGINE_PROFILE_SCOPE("World::UpdateChunkMeshes");
+        UpdateChunkMeshes();
+        RunImportantChunkBoundedWait();
+    }
 
+    // Region assembly shares the mesh worker threads; without them regions rebuild synchronously
+    m_chunkRenderRegionStorage.SetAsyncRegionBuildsEnabled(CanDispatchAsyncChunkMeshBuilds());
     const uint32_t rebuiltRegionCount = m_chunkRenderRegionStorage.RebuildDirtyRegions(m_maxChunkBatchRegionRebuildsPerFrame);
     m_chunkBatchStats.dirtyRegionRebuilds = rebuiltRegionCount;
+    UpdateChunkEditVisibilityWaits();
 
     uint32_t activeChunkCount = 0;
 
@@ -875,6 +909,9 @@ void World::Update(float deltaTime)
 
     m_chunkBatchStats.visibleChunks = activeChunkCount;
     RefreshAsyncChunkMeshDiagnosticsSnapshot();
+
+    ENGINE_PROFILE_COUNTER("World::LoadedChunks", m_loadedChunks.size());
+    ENGINE_PROFILE_COUNTER("World::DirtyRegionRebuilds", rebuiltRegionCount);
 }
 
 bool World::SetEnableChunkDebug(bool enable)
@@ -986,6 +1023,12 @@ bool World::InitializeWorldStorage(const std::string& savesPath)
         auto esfsStorage = std::make_unique<ESFSChunkStorage>(m_worldPath, config, m_chunkSerializer.get());
         SetChunkStorage(std::move(esfsStorage));
 
+        ChunkWriteBehindConfig writeBehindConfig;
+        writeBehindConfig.maxPendingBytes   = config.writeBehindMaxPendingMB * 1024 * 1024;
+        writeBehindConfig.maxPendingSeconds = config.writeBehindMaxPendingSeconds;
+        writeBehindConfig.maxBatchEntries   = config.writeBehindBatchSize;
+        m_chunkWriteBehind.SetConfig(writeBehindConfig);
+
         // Create separate ESFS serializer and storage for ChunkManager
         auto              esfsSerializerForManager = std::make_unique<ESFSChunkSerializer>();
         IChunkSerializer* serializerPtr            = esfsSerializerForManager.get(); // Get pointer before move
@@ -1021,7 +1064,7 @@ bool World::InitializeWorldStorage(const std::string& savesPath)
     return true;
 }
 
-bool World::SaveWorld()
+bool World::SaveWorld(const ChunkWriteBehindQueue::ProgressFunction& progress)
 {
     if (!m_worldManager)
     {
@@ -1043,7 +1086,55 @@ bool World::SaveWorld()
         return false;
     }
 
-    // Force save all block data
+    // Force save all block data: dirty loaded chunks join the write-behind queue, then everything is flushed
+    ESFSChunkStorage* esfsStorage = dynamic_cast<ESFSChunkStorage*>(m_chunkStorage.get());
+    if (esfsStorage)
+    {
+        size_t queuedLoadedChunks = 0;
+        for (const auto& [packedCoords, chunk] : m_loadedChunks)
+        {
+            if (chunk && chunk->GetState() == ChunkState::Active && QueueChunkForWriteBehind(chunk.get(), chunk->GetChunkCoords()))
+            {
+                ++queuedLoadedChunks;
+            }
+        }
+
+        WaitForChunkWriteBatch();
+
+        const ChunkWriteBehindStats before         = m_chunkWriteBehind.GetStats();
+        size_t                      lastLoggedTenth = 0;
+        const bool                  flushed        = m_chunkWriteBehind.FlushAll(
+            [esfsStorage](IntVec2 coords, const std::vector<uint8_t>& payload)
+            {
+                return esfsStorage->WriteSerializedChunk(coords.x, coords.y, payload);
+            },
+            [&](size_t written, size_t total)
+            {
+                const size_t tenth = written * 10 / total;
+                if (tenth != lastLoggedTenth || written == total)
+                {
+                    lastLoggedTenth = tenth;
+                    LogInfo("world", "Saving chunks: %zu/%zu", written, total);
+                }
+                if (progress)
+                {
+                    progress(written, total);
+                }
+            });
+
+        const ChunkWriteBehindStats after = m_chunkWriteBehind.GetStats();
+        LogInfo("world", "Chunk save flush: %zu loaded chunks queued, %llu written (%.0f saves/s), %llu redundant writes avoided this session",
+                queuedLoadedChunks,
+                static_cast<unsigned long long>(after.written - before.written),
+                after.GetWritesPerSecond(),
+                static_cast<unsigned long long>(after.GetAvoidedWrites()));
+        if (!flushed)
+        {
+            LogError("world", "Failed to write %zu chunks for '%s'; they stay queued for the next save",
+                     after.pendingEntries, m_worldName.c_str());
+            return false;
+        }
+    }
 
     LogInfo("world", "World '%s' saved successfully", m_worldName.c_str());
     return true;
@@ -1085,6 +1176,7 @@ void World::CloseWorld()
     {
         SaveWorld();
     }
+    WaitForChunkWriteBatch(); // A background batch must not outlive the storage it writes to
 
     ReleaseLoadedChunkRuntimeState();
     ClearAsyncChunkMeshBuildState();
@@ -1133,7 +1225,7 @@ void World::ActivateChunk(IntVec2 chunkCoords)
         int64_t packedCoords = ChunkHelper::PackCoordinates(chunkCoords.x, chunkCoords.y);
         auto&   loadedChunks = GetLoadedChunks();
 
-        auto newChunk = std::make_unique<Chunk>(chunkCoords);
+        auto newChunk = m_chunkPool.Acquire(chunkCoords);
         chunk         = newChunk.get();
         chunk->SetWorld(this); // [FIX] 设置m_world指针，使GetEastNeighbor()等方法能工作
         loadedChunks[packedCoords] = std::move(newChunk);
@@ -1163,11 +1255,11 @@ void World::ActivateChunk(IntVec2 chunkCoords)
 
     LogDebug("world", "Chunk (%d, %d) transitioned to CheckingDisk", chunkCoords.x, chunkCoords.y);
 
-    // Check if chunk exists on disk
+    // Check if chunk exists on disk (or is still waiting to be written there)
     bool chunkExistsOnDisk = false;
     if (m_chunkStorage)
     {
-        chunkExistsOnDisk = m_chunkStorage->ChunkExists(chunkCoords.x, chunkCoords.y);
+        chunkExistsOnDisk = m_chunkWriteBehind.Contains(chunkCoords) || m_chunkStorage->ChunkExists(chunkCoords.x, chunkCoords.y);
         LogDebug("world", "Chunk (%d, %d) disk check: %s",
                  chunkCoords.x, chunkCoords.y,
                  chunkExistsOnDisk ? "EXISTS" : "NOT_FOUND");
@@ -1183,6 +1275,7 @@ void World::ActivateChunk(IntVec2 chunkCoords)
         if (chunk->TrySetState(ChunkState::CheckingDisk, ChunkState::PendingLoad))
         {
             m_pendingLoadQueue.push_back(chunkCoords);
+            m_chunkStorage->PrefetchChunk(chunkCoords.x, chunkCoords.y); // Readahead overlaps the queue wait
             LogDebug("world", "Chunk (%d, %d) added to load queue (size: %zu)",
                      chunkCoords.x, chunkCoords.y, m_pendingLoadQueue.size());
         }
@@ -1297,7 +1390,12 @@ bool World::SubmitLoadChunkJob(IntVec2 chunkCoords, Chunk* chunk)
     {
         // Create LoadChunkJob for ESFS format and transfer ownership to ScheduleSubsystem
         // [REFACTORED] Pass World* instead of Chunk* - Job will get Chunk via GetChunk()
-        LoadChunkJob* job = new LoadChunkJob(chunkCoords, this, esfsStorage);
+        LoadChunkJob*       job = new LoadChunkJob(chunkCoords, this, esfsStorage);
+        ChunkWriteBehindHit pendingSave;
+        if (m_chunkWriteBehind.Find(chunkCoords, pendingSave))
+        {
+            job->SetPendingSave(pendingSave); // The file on disk is older than this save, or missing
+        }
         const TaskHandle handle = g_theSchedule->SubmitTask(job, options);
         if (!handle.IsValid())
         {
@@ -1426,6 +1524,101 @@ bool World::RequestActiveChunkTaskCancellation(std::unordered_map<int64_t, enigm
     return cancellationRequested;
 }
 
+bool World::QueueChunkForWriteBehind(Chunk* chunk, IntVec2 chunkCoords)
+{
+    if (chunk == nullptr || !chunk->IsModified() || !m_chunkSerializer)
+    {
+        return false;
+    }
+
+    // ESF keeps its own region serialization and is not routed through the write-behind queue
+    ESFSChunkStorage* esfsStorage = dynamic_cast<ESFSChunkStorage*>(m_chunkStorage.get());
+    if (!esfsStorage || !esfsStorage->PassesSaveStrategy(chunk))
+    {
+        return false;
+    }
+
+    std::vector<uint8_t> payload;
+    if (!m_chunkSerializer->SerializeChunk(chunk, payload))
+    {
+        LogError("world", "Failed to serialize chunk (%d, %d) for write-behind save", chunkCoords.x, chunkCoords.y);
+        return false;
+    }
+
+    m_chunkWriteBehind.Enqueue(chunkCoords, std::move(payload), chunk->IsPlayerModified(), GetSecondsSince(m_chunkWriteBehindEpoch));
+    chunk->SetModified(false);
+    return true;
+}
+
+void World::SubmitDueChunkWriteBatch()
+{
+    if (m_isShuttingDown.load() || !g_theSchedule || m_chunkWriteBatchHandle.IsValid())
+    {
+        return;
+    }
+
+    ESFSChunkStorage* esfsStorage = dynamic_cast<ESFSChunkStorage*>(m_chunkStorage.get());
+    if (!esfsStorage)
+    {
+        return;
+    }
+
+    ChunkWriteBatch batch = m_chunkWriteBehind.PopDueBatch(GetSecondsSince(m_chunkWriteBehindEpoch));
+    if (batch.IsEmpty())
+    {
+        return;
+    }
+
+    const size_t batchSize = batch.entries.size();
+
+    // Not cancellable: the batch owns the only copy of saves that already left the pending set
+    TaskSubmissionOptions options;
+    options.priority             = TaskPriority::Normal;
+    options.supportsCancellation = false;
+
+    m_chunkWriteBatchHandle = g_theSchedule->SubmitTask(new ChunkWriteBatchJob(&m_chunkWriteBehind, std::move(batch), esfsStorage), options);
+    if (!m_chunkWriteBatchHandle.IsValid())
+    {
+        LogError("world", "SubmitDueChunkWriteBatch failed to obtain task handle for %zu chunk saves", batchSize);
+        return;
+    }
+
+    LogDebug("world", "Submitted ChunkWriteBatchJob with %zu chunk saves, handle (%llu,%u)",
+             batchSize, m_chunkWriteBatchHandle.id, m_chunkWriteBatchHandle.generation);
+}
+
+void World::WaitForChunkWriteBatch()
+{
+    // Help the scheduler finish the in-flight batch, then drain its record so the queue is idle
+    while (m_chunkWriteBatchHandle.IsValid() && g_theSchedule)
+    {
+        try
+        {
+            g_theSchedule->WaitOrExecute(m_chunkWriteBatchHandle, std::chrono::milliseconds(1));
+        }
+        catch (const std::exception&)
+        {
+            // Already drained; the next ProcessCompletedChunkTasks pass clears the handle.
+        }
+        ProcessCompletedChunkTasks();
+    }
+}
+
+void World::ProcessChunkWriteBatchTaskRecord(const enigma::core::TaskCompletionRecord& record, ChunkWriteBatchJob* job)
+{
+    if (record.handle == m_chunkWriteBatchHandle)
+    {
+        m_chunkWriteBatchHandle = TaskHandle();
+    }
+
+    if (!job->IsCompleted())
+    {
+        // Never ran (failed or discarded): every entry goes back to the pending set
+        LogDiscardedChunkTaskRecord(record, "chunk write batch", getTaskStateName(record.finalState));
+        m_chunkWriteBehind.CompleteBatch(job->TakeBatch());
+    }
+}
+
 bool World::FinalizePendingUnloadChunk(Chunk* chunk, IntVec2 chunkCoords, const char* jobLabel)
 {
     if (chunk == nullptr || chunk->GetState() != ChunkState::PendingUnload)
@@ -1433,15 +1626,22 @@ bool World::FinalizePendingUnloadChunk(Chunk* chunk, IntVec2 chunkCoords, const
         return false;
     }
 
+    QueueChunkForWriteBehind(chunk, chunkCoords);
+
     if (chunk->GetMesh())
     {
-        chunk->SetMesh(nullptr);
+        m_chunkMeshBufferPool.Release(chunk->SetMesh(nullptr));
     }
 
     RemovePendingChunkMeshBuildRequest(chunkCoords);
     EraseChunkMeshBuildState(chunkCoords);
     chunk->SetState(ChunkState::Inactive);
-    m_loadedChunks.erase(ChunkHelper::PackCoordinates(chunkCoords.x, chunkCoords.y));
+    auto chunkIt = m_loadedChunks.find(ChunkHelper::PackCoordinates(chunkCoords.x, chunkCoords.y));
+    if (chunkIt != m_loadedChunks.end())
+    {
+        m_chunkPool.Release(std::move(chunkIt->second));
+        m_loadedChunks.erase(chunkIt);
+    }
 
     LogDebug("world", "Finalized pending unload for chunk (%d, %d) after %s job completion",
              chunkCoords.x, chunkCoords.y, jobLabel);
@@ -1752,6 +1952,20 @@ void World::HandleLoadChunkCompleted(LoadChunkJob* job)
     // Check if load was successful
     if (job->WasSuccessful())
     {
+        if (job->LoadedFromPendingSave())
+        {
+            // The unwritten save now lives in this chunk again: dirty it instead of writing the old copy
+            const ChunkWriteBehindHit& pendingSave = job->GetPendingSave();
+            if (m_chunkWriteBehind.Reclaim(coords, pendingSave.sequence))
+            {
+                chunk->MarkModified();
+            }
+            if (pendingSave.playerModified)
+            {
+                chunk->MarkPlayerModified();
+            }
+        }
+
         // [Phase 6] Initialize lighting after loading from disk
         chunk->InitializeLighting(this);
 
@@ -2483,17 +2697,47 @@ void World::QueueChunkMeshBuildRetry(Chunk& chunk, ChunkMeshBuildState& buildSta
 }
 
 bool World::HasImportantChunkMeshBuildInFlight() const
+{
+    return FindImportantChunkMeshBuildHandle().has_value();
+}
+
+std::optional<enigma::core::TaskHandle> World::FindImportantChunkMeshBuildHandle() const
 {
     for (const auto& [packedCoords, buildState] : m_chunkMeshBuildStates)
     {
         UNUSED(packedCoords);
         if (buildState.activeHandle.has_value() && buildState.activeImportant)
         {
-            return true;
+            return buildState.activeHandle;
         }
     }
 
-    return false;
+    return std::nullopt;
+}
+
+//------------------------------------------------------------------------------------------------------------------
+// Any generate/load/save/mesh handle still owned by World (shutdown drain helps these finish)
+//------------------------------------------------------------------------------------------------------------------
+std::optional<enigma::core::TaskHandle> World::FindOutstandingTrackedTaskHandle() const
+{
+    for (const auto* handleMap : {&m_activeGenerateJobHandles, &m_activeLoadJobHandles, &m_activeSaveJobHandles})
+    {
+        if (!handleMap->empty())
+        {
+            return handleMap->begin()->second;
+        }
+    }
+
+    for (const auto& [packedCoords, buildState] : m_chunkMeshBuildStates)
+    {
+        UNUSED(packedCoords);
+        if (buildState.activeHandle.has_value())
+        {
+            return buildState.activeHandle;
+        }
+    }
+
+    return std::nullopt;
 }
 
 void World::RunImportantChunkBoundedWait()
@@ -2514,27 +2758,43 @@ void World::RunImportantChunkBoundedWait()
     m_asyncChunkMeshDiagnostics.cumulative.boundedWaitAttempts++;
 
     const Clock::time_point startTime = Clock::now();
+    const Clock::time_point deadline  = startTime + std::chrono::microseconds(m_importantChunkWaitBudgetMicros);
     uint32_t                yieldCount = 0;
     bool                    satisfied  = false;
 
+    // Instead of yielding, run the important build ourselves if it is still queued, or help
+    // drain other mesh work while a worker finishes it
     while (yieldCount < m_importantChunkWaitYieldLimit)
     {
         ProcessCompletedChunkTasks();
-        if (!HasImportantChunkMeshBuildInFlight())
+        const std::optional<TaskHandle> importantHandle = FindImportantChunkMeshBuildHandle();
+        if (!importantHandle.has_value())
         {
             satisfied = true;
             break;
         }
 
-        const uint64_t elapsedMicros = static_cast<uint64_t>(
-            std::chrono::duration_cast<std::chrono::microseconds>(Clock::now() - startTime).count()
-        );
-        if (elapsedMicros >= m_importantChunkWaitBudgetMicros)
+        const Clock::time_point now = Clock::now();
+        if (now >= deadline)
         {
             break;
         }
 
-        std::this_thread::yield();
+        try
+        {
+            const TaskWaitResult waitResult = g_theSchedule->WaitOrExecute(
+                *importantHandle, std::chrono::duration_cast<std::chrono::microseconds>(deadline - now));
+
+            const uint64_t inlineExecutions = waitResult.executedInline ? 1ULL : 0ULL;
+            m_asyncChunkMeshDiagnostics.frame.boundedWaitInlineExecutions += inlineExecutions;
+            m_asyncChunkMeshDiagnostics.cumulative.boundedWaitInlineExecutions += inlineExecutions;
+            m_asyncChunkMeshDiagnostics.frame.boundedWaitAssistedTasks += waitResult.assistedTasks;
+            m_asyncChunkMeshDiagnostics.cumulative.boundedWaitAssistedTasks += waitResult.assistedTasks;
+        }
+        catch (const std::exception&)
+        {
+            // The task can become terminal and drained between passes.
+        }
         yieldCount++;
     }
 
@@ -2710,6 +2970,21 @@ void World::ProcessChunkMeshBuildTaskRecord(const enigma::core::TaskCompletionRe
 
     std::optional<ChunkMeshBuildResult> result = task->TakeResult();
 
+    // Meshes that are not published (stale, cancelled, discarded after unload) go back to the pool
+    struct UnpublishedMeshRecycler
+    {
+        ChunkMeshBufferPool&                 pool;
+        std::optional<ChunkMeshBuildResult>& result;
+
+        ~UnpublishedMeshRecycler()
+        {
+            if (result.has_value() && result->mesh)
+            {
+                pool.Release(std::move(result->mesh));
+            }
+        }
+    } meshRecycler{m_chunkMeshBufferPool, result};
+
     const bool completedNormally =
         record.finalState == TaskState::Completed &&
         !record.isStale &&
@@ -2717,7 +2992,7 @@ void World::ProcessChunkMeshBuildTaskRecord(const enigma::core::TaskCompletionRe
 
     if (completedNormally)
     {
-        HandleChunkMeshBuildCompleted(record, task, std::move(result));
+        HandleChunkMeshBuildCompleted(record, task, result);
         return;
     }
 
@@ -2773,7 +3048,7 @@ void World::ProcessChunkMeshBuildTaskRecord(const enigma::core::TaskCompletionRe
 
 void World::HandleChunkMeshBuildCompleted(const enigma::core::TaskCompletionRecord& record,
                                           ChunkMeshBuildTask* task,
-                                          std::optional<ChunkMeshBuildResult> result)
+                                          std::optional<ChunkMeshBuildResult>& result)
 {
     UNUSED(record);
 
@@ -2903,7 +3178,7 @@ void World::HandleChunkMeshBuildCompleted(const enigma::core::TaskCompletionReco
         return;
     }
 
-    chunk->SetMesh(std::move(result->mesh));
+    m_chunkMeshBufferPool.Release(chunk->SetMesh(std::move(result->mesh)));
     m_chunkRenderRegionStorage.NotifyChunkMeshReady(chunk);
     m_asyncChunkMeshDiagnostics.frame.published++;
     m_asyncChunkMeshDiagnostics.cumulative.published++;
@@ -3196,6 +3471,7 @@ void World::RemoveDistantJobs()
                 if (state == ChunkState::PendingGenerate || state == ChunkState::PendingLoad ||
                     state == ChunkState::CheckingDisk)
                 {
+                    m_chunkPool.Release(std::move(chunkIt->second));
                     m_loadedChunks.erase(chunkIt);
                     LogDebug("world", "Removed distant pending chunk (%d, %d) from loadedChunks",
                              coords.x, coords.y);
@@ -3333,10 +3609,18 @@ void World::ProcessCompletedChunkTasks()
         {
             ProcessSaveChunkTaskRecord(record, saveJob);
         }
+        else if (auto* writeBatchJob = dynamic_cast<ChunkWriteBatchJob*>(task))
+        {
+            ProcessChunkWriteBatchTaskRecord(record, writeBatchJob);
+        }
         else if (auto* chunkMeshBuildTask = dynamic_cast<ChunkMeshBuildTask*>(task))
         {
             ProcessChunkMeshBuildTaskRecord(record, chunkMeshBuildTask);
         }
+        else if (auto* regionBuildTask = dynamic_cast<ChunkBatchRegionBuildTask*>(task))
+        {
+            m_chunkRenderRegionStorage.OnRegionBuildTaskCompleted(record, regionBuildTask);
+        }
         else
         {
             LogWarn("world",
@@ -3504,6 +3788,8 @@ void World::ClearAsyncChunkMeshBuildState()
     m_pendingChunkMeshBuildQueue.clear();
     m_chunkMeshBuildStates.clear();
     m_chunkMeshNeighborWaitRegistry.Clear();
+    m_pendingChunkMeshPatches.clear();
+    m_chunkEditVisibilityWaits.clear();
     m_asyncChunkMeshDiagnostics.ClearAll();
     m_asyncChunkMeshDiagnostics.asyncEnabled = m_asyncChunkMeshEnabled;
     m_workerMaterializationAttempts.store(0, std::memory_order_relaxed);
@@ -3541,13 +3827,15 @@ void World::ReleaseLoadedChunkRuntimeState()
 
         if (chunk->GetMesh() != nullptr)
         {
-            chunk->SetMesh(nullptr);
+            m_chunkMeshBufferPool.Release(chunk->SetMesh(nullptr));
         }
 
         chunk->SetState(ChunkState::Inactive);
     }
 
     m_loadedChunks.clear();
+    m_chunkPool.Trim();
+    m_chunkMeshBufferPool.Trim();
 }
 
 ChunkMeshBuildState& World::GetOrCreateChunkMeshBuildState(IntVec2 chunkCoords)
@@ -3799,7 +4087,7 @@ bool World::RebuildChunkMeshNow(Chunk* chunk)
         return false;
     }
 
-    ChunkMesh* chunkMesh = chunk->GetChunkMesh();
+    const ChunkMesh* chunkMesh = chunk->GetChunkMesh();
     if (chunkMesh)
     {
         m_chunkRenderRegionStorage.NotifyChunkMeshReady(chunk);
@@ -3852,6 +4140,207 @@ void World::ScheduleChunkMeshRebuild(Chunk* chunk, bool forceImportant)
              buildState.important ? "true" : "false");
 }
 
+void World::RequestChunkMeshEditUpdate(Chunk* chunk)
+{
+    if (!chunk || m_isShuttingDown.load())
+    {
+        return;
+    }
+
+    m_chunkMeshPatchDiagnostics.requested++;
+    const IntVec2 chunkCoords = chunk->GetChunkCoords();
+    const int64_t chunkKey    = ChunkHelper::PackCoordinates(chunkCoords.x, chunkCoords.y);
+    const auto    editTime    = std::chrono::steady_clock::now();
+
+    if (!CanPatchChunkMesh(*chunk))
+    {
+        const ChunkMeshBuildState* buildState = FindChunkMeshBuildState(chunkCoords);
+        if (buildState != nullptr && (buildState->pendingDispatch || buildState->activeHandle.has_value()))
+        {
+            m_chunkMeshPatchDiagnostics.fallbackBuildInFlight++;
+        }
+        else
+        {
+            m_chunkMeshPatchDiagnostics.fallbackNoSectionRanges++;
+        }
+        FallBackToChunkMeshRebuild(chunk, chunkKey, editTime);
+        return;
+    }
+
+    // Applied after this frame's light update, so light changes from the edit land in the same patch
+    m_pendingChunkMeshPatches.try_emplace(chunkKey, editTime);
+}
+
+bool World::CanPatchChunkMesh(const Chunk& chunk) const
+{
+    if (!m_enableChunkMeshPatching || !chunk.IsActive())
+    {
+        return false;
+    }
+
+    const ChunkMesh* chunkMesh = chunk.GetChunkMesh();
+    if (chunkMesh == nullptr || !chunkMesh->HasSectionRanges())
+    {
+        return false;
+    }
+
+    // A queued or running build (or a partial mesh awaiting refinement) supersedes the current mesh
+    const ChunkMeshBuildState* buildState = FindChunkMeshBuildState(chunk.GetChunkCoords());
+    return buildState == nullptr ||
+        (!buildState->pendingDispatch &&
+         !buildState->activeHandle.has_value() &&
+         !buildState->waitingForNeighbors &&
+         !buildState->refinementPending);
+}
+
+void World::FallBackToChunkMeshRebuild(Chunk* chunk, int64_t chunkKey, std::chrono::steady_clock::time_point editTime)
+{
+    ScheduleChunkMeshRebuild(chunk, true);
+    m_chunkEditVisibilityWaits.try_emplace(chunkKey, editTime);
+}
+
+void World::ApplyPendingChunkMeshPatches()
+{
+    if (m_pendingChunkMeshPatches.empty())
+    {
+        return;
+    }
+
+    ENGINE_PROFILE_SCOPE("World::ApplyPendingChunkMeshPatches");
+    for (const auto& [chunkKey, editTime] : m_pendingChunkMeshPatches)
+    {
+        auto chunkIt = m_loadedChunks.find(chunkKey);
+        if (chunkIt == m_loadedChunks.end() || chunkIt->second == nullptr || !chunkIt->second->IsActive())
+        {
+            continue;
+        }
+
+        Chunk* chunk = chunkIt->second.get();
+        if (!CanPatchChunkMesh(*chunk))
+        {
+            m_chunkMeshPatchDiagnostics.fallbackBuildInFlight++;
+            FallBackToChunkMeshRebuild(chunk, chunkKey, editTime);
+            continue;
+        }
+
+        const uint32_t dirtyMask = chunk->GetDirtyMeshSectionMask();
+        if (dirtyMask == 0)
+        {
+            continue; // Nothing left to re-mesh
+        }
+
+        // One contiguous range covering every dirty section; bits past the last section mean "all"
+        uint32_t firstSection = 0;
+        uint32_t endSection   = ChunkMesh::MESH_SECTION_COUNT;
+        while ((dirtyMask & (1u << firstSection)) == 0)
+        {
+            ++firstSection;
+        }
+        while ((dirtyMask & (1u << (endSection - 1))) == 0)
+        {
+            --endSection;
+        }
+
+        if ((dirtyMask >> ChunkMesh::MESH_SECTION_COUNT) != 0 || endSection - firstSection > m_maxChunkMeshPatchSections)
+        {
+            m_chunkMeshPatchDiagnostics.fallbackTooManySections++;
+            FallBackToChunkMeshRebuild(chunk, chunkKey, editTime);
+            continue;
+        }
+
+        const auto            patchStart = std::chrono::steady_clock::now();
+        ChunkMeshSectionPatch patch;
+        if (!PatchChunkMeshSections(*chunk, firstSection, endSection, patch))
+        {
+            m_chunkMeshPatchDiagnostics.fallbackSnapshotFailed++;
+            FallBackToChunkMeshRebuild(chunk, chunkKey, editTime);
+            continue;
+        }
+
+        chunk->ClearMeshSectionsDirty();
+        m_chunkMeshPatchDiagnostics.patched++;
+        m_chunkMeshPatchDiagnostics.sectionsRemeshed += endSection - firstSection;
+
+        const bool regionPatched = m_chunkRenderRegionStorage.TryApplyChunkMeshPatch(*chunk, patch);
+        const auto patchEnd      = std::chrono::steady_clock::now();
+        m_chunkMeshPatchDiagnostics.patchBuildUs.Record(static_cast<uint64_t>(
+            std::chrono::duration_cast<std::chrono::microseconds>(patchEnd - patchStart).count()));
+
+        if (regionPatched)
+        {
+            m_chunkMeshPatchDiagnostics.patchedEditToVisibleUs.Record(static_cast<uint64_t>(
+                std::chrono::duration_cast<std::chrono::microseconds>(patchEnd - editTime).count()));
+        }
+        else
+        {
+            // The CPU mesh is current; let the region path upload it (slice replacement or rebuild)
+            m_chunkMeshPatchDiagnostics.regionPatchRejected++;
+            m_chunkRenderRegionStorage.NotifyChunkMeshReady(chunk);
+            m_chunkEditVisibilityWaits.try_emplace(chunkKey, editTime);
+        }
+    }
+    m_pendingChunkMeshPatches.clear();
+}
+
+bool World::PatchChunkMeshSections(Chunk& chunk, uint32_t firstSection, uint32_t endSection, ChunkMeshSectionPatch& outPatch)
+{
+    const ChunkMeshBuildState* buildState   = FindChunkMeshBuildState(chunk.GetChunkCoords());
+    const uint64_t             buildVersion = buildState != nullptr ? buildState->latestRequestedVersion : 0;
+
+    ChunkMeshBuildInput input;
+    if (!ChunkMeshBuildInputFactory::TryCreate(chunk, buildVersion, true, input))
+    {
+        return false;
+    }
+
+    if (m_chunkMeshPatchScratch == nullptr)
+    {
+        m_chunkMeshPatchScratch = std::make_shared<ChunkMeshingScratch>();
+    }
+
+    ChunkMeshingSnapshot snapshot(m_chunkMeshPatchScratch);
+    if (!ChunkMeshingMaterializer::TryMaterialize(chunk, input.dispatchContext, *m_chunkMeshPatchScratch, snapshot).Succeeded())
+    {
+        return false;
+    }
+
+    ChunkMeshBuilder           builder(&m_chunkMeshBufferPool);
+    std::unique_ptr<ChunkMesh> sectionMesh = builder.BuildSections(snapshot, firstSection, endSection);
+    const bool                 spliced     = sectionMesh != nullptr &&
+        chunk.GetMutableChunkMesh()->ReplaceSections(firstSection, endSection, *sectionMesh, outPatch);
+    m_chunkMeshBufferPool.Release(std::move(sectionMesh));
+    return spliced;
+}
+
+void World::UpdateChunkEditVisibilityWaits()
+{
+    constexpr auto kMaxVisibilityWait = std::chrono::seconds(10); // Chunks parked on neighbors are not tracked forever
+
+    const auto now = std::chrono::steady_clock::now();
+    for (auto it = m_chunkEditVisibilityWaits.begin(); it != m_chunkEditVisibilityWaits.end();)
+    {
+        auto chunkIt = m_loadedChunks.find(it->first);
+        if (chunkIt == m_loadedChunks.end() || chunkIt->second == nullptr || now - it->second > kMaxVisibilityWait)
+        {
+            it = m_chunkEditVisibilityWaits.erase(it);
+            continue;
+        }
+
+        const IntVec2              chunkCoords = chunkIt->second->GetChunkCoords();
+        const ChunkMeshBuildState* buildState  = FindChunkMeshBuildState(chunkCoords);
+        const bool                 buildInFlight = buildState != nullptr && (buildState->pendingDispatch || buildState->activeHandle.has_value());
+        if (buildInFlight || !m_chunkRenderRegionStorage.IsChunkGeometryCurrent(chunkCoords))
+        {
+            ++it;
+            continue;
+        }
+
+        m_chunkMeshPatchDiagnostics.rebuiltEditToVisibleUs.Record(static_cast<uint64_t>(
+            std::chrono::duration_cast<std::chrono::microseconds>(now - it->second).count()));
+        it = m_chunkEditVisibilityWaits.erase(it);
+    }
+}
+
 void World::InvalidateAllChunkMeshes()
 {
     MarkLoadedChunksForReload(m_currentReloadGeneration);
@@ -4156,10 +4645,28 @@ void World::WaitForPendingTasks()
            !m_activeGenerateJobHandles.empty() ||
            !m_activeLoadJobHandles.empty() ||
            !m_activeSaveJobHandles.empty() ||
-           HasOutstandingChunkMeshBuildWork())
+           HasOutstandingChunkMeshBuildWork() ||
+           m_chunkRenderRegionStorage.HasPendingRegionBuilds())
     {
         ProcessCompletedChunkTasks();
-        std::this_thread::yield();
+
+        // Help the scheduler finish tracked work instead of spinning; short budget so the
+        // atomic job counters above are re-checked regularly
+        const std::optional<TaskHandle> trackedHandle = FindOutstandingTrackedTaskHandle();
+        if (!trackedHandle.has_value())
+        {
+            std::this_thread::yield();
+            continue;
+        }
+
+        try
+        {
+            g_theSchedule->WaitOrExecute(*trackedHandle, std::chrono::milliseconds(1));
+        }
+        catch (const std::exception&)
+        {
+            // Already drained; the next ProcessCompletedChunkTasks pass updates the handle maps.
+        }
     }
 
     ProcessCompletedChunkTasks();
@@ -4268,6 +4775,27 @@ void World::MarkLightingDirty(const BlockIterator& iter)
     m_voxelLightEngine->GetSkyEngine().MarkDirty(iter);
 }
 
+void World::NotifyBlockChanged(const Chunk& chunk, int32_t blockIndex) const
+{
+    if (m_chunkStreamServer)
+    {
+        m_chunkStreamServer->OnBlockChanged(chunk.GetChunkCoords(), blockIndex);
+    }
+}
+
+void World::NotifyLightChanged(const Chunk& chunk, int32_t minZ, int32_t maxZ) const
+{
+    if (!m_chunkStreamServer)
+    {
+        return;
+    }
+
+    for (int32_t sectionY = minZ / kChunkSectionHeight; sectionY <= maxZ / kChunkSectionHeight; ++sectionY)
+    {
+        m_chunkStreamServer->OnLightChanged(chunk.GetChunkCoords(), sectionY);
+    }
+}
+
 //-----------------------------------------------------------------------------------------------
 // Phase 10: Block Digging and Placing Operations
 //-----------------------------------------------------------------------------------------------
@@ -4318,8 +4846,8 @@ void World::DigBlock(const BlockIterator& blockIter)
 
     chunk->SetBlockByPlayer(localX, localY, localZ, airState);
 
-    // 6. Schedule chunk mesh rebuild
-    ScheduleChunkMeshRebuild(chunk, true);
+    // 6. Patch the edited sections (or schedule a chunk mesh rebuild)
+    RequestChunkMeshEditUpdate(chunk);
 
     LogDebug("world", "DigBlock: Removed block at (%d, %d, %d)",
              blockIter.GetBlockPos().x, blockIter.GetBlockPos().y, blockIter.GetBlockPos().z);
@@ -4373,8 +4901,8 @@ void World::PlaceBlock(const BlockIterator& blockIter, BlockState* newState)
 
     chunk->SetBlockByPlayer(localX, localY, localZ, newState);
 
-    // 6. Schedule chunk mesh rebuild
-    ScheduleChunkMeshRebuild(chunk, true);
+    // 6. Patch the edited sections (or schedule a chunk mesh rebuild)
+    RequestChunkMeshEditUpdate(chunk);
 
     // 7. Notify 6 neighbors about block change (for stairs shape update, etc.)
     //    This is critical for stairs/slab auto-connection feature
@@ -4480,7 +5008,7 @@ void World::PlaceBlock(const BlockIterator&        blockIter, enigma::registry::
                 int32_t localX, localY, localZ;
                 raycast.m_hitBlockIter.GetLocalCoords(localX, localY, localZ);
                 clickedChunk->SetBlockByPlayer(localX, localY, localZ, mergedState);
-                ScheduleChunkMeshRebuild(clickedChunk, true);
+                RequestChunkMeshEditUpdate(clickedChunk);
 
                 LogDebug("world", "PlaceBlock (context): Merged slab at clickedPos (%d, %d, %d)",
                          ctx.clickedPos.x, ctx.clickedPos.y, ctx.clickedPos.z);
@@ -4533,3 +5061,303 @@ void World::PlaceBlock(const BlockIterator&        blockIter, enigma::registry::
     LogDebug("world", "PlaceBlock (context): Placed block at (%d, %d, %d) with placement context",
              targetPos.x, targetPos.y, targetPos.z);
 }
+
+//-----------------------------------------------------------------------------------------------
+// Bulk Block Edits
+//-----------------------------------------------------------------------------------------------
+
+void World::BeginBulkEdit()
+{
+    if (m_bulkEditActive)
+    {
+        ERROR_RECOVERABLE("World::BeginBulkEdit called while a bulk edit is already open")
+        return;
+    }
+
+    m_bulkEditActive = true;
+    m_bulkEditChunks.clear();
+}
+
+size_t World::SetBlocks(const BlockPos& minCorner, const BlockPos& maxCorner, BlockState* state)
+{
+    return SetBlocks(minCorner, maxCorner, [state](const BlockPos&, BlockState*) { return state; });
+}
+
+size_t World::SetBlocks(const BlockPos& minCorner, const BlockPos& maxCorner, const BulkBlockPalette& palette)
+{
+    if (!m_bulkEditActive)
+    {
+        ERROR_RECOVERABLE("World::SetBlocks needs an open bulk edit (BeginBulkEdit)")
+        return 0;
+    }
+
+    const int32_t minX = (std::min)(minCorner.x, maxCorner.x);
+    const int32_t maxX = (std::max)(minCorner.x, maxCorner.x);
+    const int32_t minY = (std::min)(minCorner.y, maxCorner.y);
+    const int32_t maxY = (std::max)(minCorner.y, maxCorner.y);
+    const int32_t minZ = (std::max)((std::min)(minCorner.z, maxCorner.z), 0);
+    const int32_t maxZ = (std::min)((std::max)(minCorner.z, maxCorner.z), Chunk::CHUNK_MAX_Z);
+    if (!palette || minZ > maxZ)
+    {
+        return 0;
+    }
+
+    ENGINE_PROFILE_SCOPE("World::SetBlocks");
+    size_t written = 0;
+    for (int32_t chunkY = minY >> Chunk::CHUNK_BITS_Y; chunkY <= maxY >> Chunk::CHUNK_BITS_Y; ++chunkY)
+    {
+        for (int32_t chunkX = minX >> Chunk::CHUNK_BITS_X; chunkX <= maxX >> Chunk::CHUNK_BITS_X; ++chunkX)
+        {
+            Chunk* chunk = GetChunk(chunkX, chunkY);
+            if (!chunk || !chunk->IsActive())
+            {
+                continue;
+            }
+
+            const int32_t originX   = Chunk::ChunkCoordsToWorld(chunkX);
+            const int32_t originY   = Chunk::ChunkCoordsToWorld(chunkY);
+            const int32_t localMinX = (std::max)(minX - originX, 0);
+            const int32_t localMaxX = (std::min)(maxX - originX, Chunk::CHUNK_MAX_X);
+            const int32_t localMinY = (std::max)(minY - originY, 0);
+            const int32_t localMaxY = (std::min)(maxY - originY, Chunk::CHUNK_MAX_Y);
+
+            BulkEditChunk* record = nullptr; // Created on the first write, so no-op regions leave no trace
+            for (int32_t z = minZ; z <= maxZ; ++z)
+            {
+                for (int32_t y = localMinY; y <= localMaxY; ++y)
+                {
+                    for (int32_t x = localMinX; x <= localMaxX; ++x)
+                    {
+                        BlockState* current = chunk->GetBlock(x, y, z);
+                        BlockState* next    = palette(BlockPos(originX + x, originY + y, z), current);
+                        if (next == nullptr || next == current)
+                        {
+                            continue;
+                        }
+
+                        if (record == nullptr)
+                        {
+                            record = &m_bulkEditChunks[ChunkHelper::PackCoordinates(chunkX, chunkY)];
+                            if (record->written.empty() || record->chunkInstanceId != chunk->GetInstanceId())
+                            {
+                                *record                 = BulkEditChunk();
+                                record->chunkInstanceId = chunk->GetInstanceId();
+                                record->written.assign(Chunk::BLOCKS_PER_CHUNK, false);
+                                record->columns.assign(Chunk::CHUNK_SIZE_X * Chunk::CHUNK_SIZE_Y, false);
+                            }
+                        }
+
+                        chunk->SetBlockForBulkEdit(x, y, z, next);
+                        ++written;
+
+                        const size_t index = Chunk::CoordsToIndex(x, y, z);
+                        if (!record->written[index])
+                        {
+                            record->written[index] = true;
+                            record->blockCount++;
+                        }
+
+                        const size_t column = static_cast<size_t>(x + y * Chunk::CHUNK_SIZE_X);
+                        if (!record->columns[column])
+                        {
+                            record->columns[column] = true;
+                            record->columnCount++;
+                        }
+                        record->minZ = (std::min)(record->minZ, z);
+                        record->maxZ = (std::max)(record->maxZ, z);
+                    }
+                }
+            }
+        }
+    }
+    return written;
+}
+
+BulkBlockEditStats World::CommitBulkEdit()
+{
+    BulkBlockEditStats stats;
+    if (!m_bulkEditActive)
+    {
+        ERROR_RECOVERABLE("World::CommitBulkEdit called without an open bulk edit")
+        return stats;
+    }
+
+    ENGINE_PROFILE_SCOPE("World::CommitBulkEdit");
+    m_bulkEditActive = false;
+
+    // Chunks unloaded or recycled since their blocks were written have nothing left to fix up
+    std::vector<std::pair<Chunk*, const BulkEditChunk*>> touched;
+    std::unordered_set<int64_t>                          touchedKeys;
+    for (const auto& [chunkKey, record] : m_bulkEditChunks)
+    {
+        auto chunkIt = m_loadedChunks.find(chunkKey);
+        if (chunkIt == m_loadedChunks.end() || chunkIt->second == nullptr || !chunkIt->second->IsActive() ||
+            chunkIt->second->GetInstanceId() != record.chunkInstanceId)
+        {
+            continue;
+        }
+        touched.emplace_back(chunkIt->second.get(), &record);
+        touchedKeys.insert(chunkKey);
+    }
+
+    // Untouched neighbors need a remesh when the edit reaches their border faces or its light spills into them
+    struct NeighborChunk
+    {
+        Chunk*   chunk               = nullptr;
+        uint32_t dirtyMaskBeforeEdit = 0;
+        bool     sharesEditedFaces   = false;
+    };
+    std::unordered_map<int64_t, NeighborChunk> neighbors;
+    for (const auto& [chunk, record] : touched)
+    {
+        bool touchesEdge[4] = {false, false, false, false}; // West, east, south, north
+        for (int32_t i = 0; i < Chunk::CHUNK_SIZE_X; ++i)
+        {
+            touchesEdge[0] = touchesEdge[0] || record->columns[i * Chunk::CHUNK_SIZE_X];
+            touchesEdge[1] = touchesEdge[1] || record->columns[Chunk::CHUNK_MAX_X + i * Chunk::CHUNK_SIZE_X];
+            touchesEdge[2] = touchesEdge[2] || record->columns[i];
+            touchesEdge[3] = touchesEdge[3] || record->columns[i + Chunk::CHUNK_MAX_Y * Chunk::CHUNK_SIZE_X];
+        }
+
+        const IntVec2 coords     = chunk->GetChunkCoords();
+        const IntVec2 offsets[4] = {IntVec2(-1, 0), IntVec2(1, 0), IntVec2(0, -1), IntVec2(0, 1)};
+        for (int side = 0; side < 4; ++side)
+        {
+            const IntVec2 neighborCoords = coords + offsets[side];
+            const int64_t neighborKey    = ChunkHelper::PackCoordinates(neighborCoords.x, neighborCoords.y);
+            Chunk*        neighborChunk  = GetChunk(neighborCoords.x, neighborCoords.y);
+            if (touchedKeys.count(neighborKey) != 0 || neighborChunk == nullptr || !neighborChunk->IsActive())
+            {
+                continue;
+            }
+
+            auto [neighborIt, inserted] = neighbors.try_emplace(neighborKey, NeighborChunk{neighborChunk, neighborChunk->GetDirtyMeshSectionMask(), false});
+            if (touchesEdge[side])
+            {
+                neighborIt->second.sharesEditedFaces = true;
+                neighborChunk->MarkMeshSectionsDirty(record->minZ, record->maxZ);
+            }
+        }
+    }
+
+    // 1. Heightmaps and SKY flags, once per touched column; sky is everything above the topmost
+    //    opaque block, as in Chunk::InitializeLighting
+    for (const auto& [chunk, record] : touched)
+    {
+        stats.chunksTouched++;
+        stats.columnsTouched += record->columnCount;
+        stats.blocksWritten += record->blockCount;
+
+        for (int32_t y = 0; y < Chunk::CHUNK_SIZE_Y; ++y)
+        {
+            for (int32_t x = 0; x < Chunk::CHUNK_SIZE_X; ++x)
+            {
+                if (!record->columns[x + y * Chunk::CHUNK_SIZE_X])
+                {
+                    continue;
+                }
+
+                chunk->RecomputeColumnHeightmaps(x, y);
+                const int32_t skyFloor = chunk->GetHeight(HeightmapType::LightBlocking, x, y);
+                for (int32_t z = Chunk::CHUNK_MAX_Z; z >= 0; --z)
+                {
+                    const bool isSky = z > skyFloor;
+                    if (chunk->GetIsSky(x, y, z) == isSky)
+                    {
+                        continue;
+                    }
+
+                    chunk->SetIsSky(x, y, z, isSky);
+                    chunk->SetSkyLight(x, y, z, isSky ? 15 : 0);
+                    chunk->MarkMeshSectionsDirty(z); // Set directly, so the light engine will not see it change
+                    NotifyLightChanged(*chunk, z, z);
+                    MarkLightingDirty(BlockIterator(chunk, static_cast<int>(Chunk::CoordsToIndex(x, y, z))));
+                    stats.skyFlagsChanged++;
+                }
+            }
+        }
+    }
+
+    // 2. Seed one light update for the whole edit: written blocks, plus untouched blocks on the edit's surface
+    BlockLightEngine& blockEngine = m_voxelLightEngine->GetBlockEngine();
+    SkyLightEngine&   skyEngine   = m_voxelLightEngine->GetSkyEngine();
+    for (const auto& [chunk, record] : touched)
+    {
+        const int firstIndex = record->minZ << (Chunk::CHUNK_BITS_X + Chunk::CHUNK_BITS_Y);
+        const int endIndex   = (record->maxZ + 1) << (Chunk::CHUNK_BITS_X + Chunk::CHUNK_BITS_Y);
+        for (int index = firstIndex; index < endIndex; ++index)
+        {
+            if (!record->written[index])
+            {
+                continue;
+            }
+
+            NotifyBlockChanged(*chunk, index); // Also covers the light resolved directly below
+
+            BlockIterator iter(chunk, index);
+            BlockState*   state = iter.GetBlock();
+            int32_t       x, y, z;
+            iter.GetLocalCoords(x, y, z);
+
+            // Opaque, non-emissive and below the sky: both engines would compute 0, so skip the queue
+            if (state->GetLightEmission() == 0 && !chunk->GetIsSky(x, y, z) && state->GetLightBlock(this, iter.GetBlockPos()) >= 15)
+            {
+                chunk->SetBlockLight(x, y, z, 0);
+                chunk->SetSkyLight(x, y, z, 0);
+                stats.lightResolvedDirect++;
+            }
+            else
+            {
+                MarkLightingDirty(iter);
+            }
+
+            for (const BlockIterator& neighbor : iter.GetNeighbors())
+            {
+                if (!neighbor.IsValid())
+                {
+                    continue;
+                }
+
+                const bool neighborWritten = neighbor.GetChunk() == chunk ? record->written[neighbor.GetBlockIndex()] : IsBulkWritten(neighbor);
+                if (!neighborWritten)
+                {
+                    blockEngine.MarkDirtyIfNotOpaque(neighbor);
+                    skyEngine.MarkDirtyIfNotOpaque(neighbor);
+                }
+            }
+        }
+        chunk->MarkMeshSectionsDirty(record->minZ, record->maxZ);
+    }
+
+    stats.lightBlocksProcessed = static_cast<uint64_t>(m_voxelLightEngine->RunLightUpdates());
+
+    // 3. One mesh update per affected chunk
+    for (const auto& [chunk, record] : touched)
+    {
+        RequestChunkMeshEditUpdate(chunk);
+        stats.meshUpdatesRequested++;
+    }
+    for (const auto& [neighborKey, neighbor] : neighbors)
+    {
+        if (neighbor.sharesEditedFaces || neighbor.chunk->GetDirtyMeshSectionMask() != neighbor.dirtyMaskBeforeEdit)
+        {
+            RequestChunkMeshEditUpdate(neighbor.chunk);
+            stats.neighborMeshUpdates++;
+        }
+    }
+
+    m_bulkEditChunks.clear();
+    LogDebug("world", "CommitBulkEdit: %llu blocks in %u chunks, %llu light blocks processed, %u + %u mesh updates",
+             stats.blocksWritten, stats.chunksTouched, stats.lightBlocksProcessed, stats.meshUpdatesRequested, stats.neighborMeshUpdates);
+    return stats;
+}
+
+bool World::IsBulkWritten(const BlockIterator& iter) const
+{
+    const Chunk*  chunk    = iter.GetChunk();
+    const IntVec2 coords   = chunk->GetChunkCoords();
+    auto          recordIt = m_bulkEditChunks.find(ChunkHelper::PackCoordinates(coords.x, coords.y));
+    return recordIt != m_bulkEditChunks.end() &&
+        recordIt->second.chunkInstanceId == chunk->GetInstanceId() &&
+        recordIt->second.written[iter.GetBlockIndex()];
+}
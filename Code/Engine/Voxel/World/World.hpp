@@ -9,15 +9,20 @@
 #include "../Chunk/ChunkSerializationInterfaces.hpp"
 #include "../Chunk/ChunkRenderRegionStorage.hpp"
 #include "../Chunk/ChunkJob.hpp"
+#include "../Chunk/ChunkPool.hpp"
+#include "../Chunk/ChunkMeshBufferPool.hpp"
 #include "../Chunk/GenerateChunkJob.hpp"
 #include "../Chunk/LoadChunkJob.hpp"
 #include "../Chunk/MeshBuild/ChunkMeshNeighborReadiness.hpp"
 #include "../Chunk/MeshBuild/ChunkMeshBuildInputFactory.hpp"
 #include "../Chunk/MeshBuild/AsyncChunkMeshDiagnostics.hpp"
+#include "../Chunk/MeshBuild/ChunkMeshPatchDiagnostics.hpp"
 #include "../Chunk/MeshBuild/ChunkMeshBuildTask.hpp"
 #include "../Chunk/SaveChunkJob.hpp"
+#include "../Chunk/ChunkWriteBatchJob.hpp"
 #include "../Generation/TerrainGenerator.hpp"
 #include "ChunkMeshNeighborWaitRegistry.hpp"
+#include "ChunkWriteBehindQueue.hpp"
 #include "ESFWorldStorage.hpp"
 #include "VoxelRaycastResult3D.hpp"
 #include "Engine/Graphic/Reload/RenderPipelineReloadTypes.hpp"
@@ -30,6 +35,9 @@
 #include <vector>
 #include <deque>
 #include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <functional>
 #include <optional>
 
 class Texture;
@@ -41,6 +49,10 @@ namespace enigma::voxel
     // ========================================================================
     constexpr char WORLD_SAVE_PATH[] = ".enigma/saves";
 
+    struct ChunkMeshingScratch;
+    struct ChunkMeshSectionPatch;
+    class ChunkStreamServer;
+
     /**
          * @brief Main world class - manages the voxel world and its chunks
          *
@@ -73,6 +85,22 @@ namespace enigma::voxel
         bool                                       activeRequiresWorkerMaterialization = false;
     };
 
+    /// Returns the state to write at pos (current is what is there now); nullptr or current leaves it untouched
+    using BulkBlockPalette = std::function<BlockState*(const BlockPos& pos, BlockState* current)>;
+
+    /// What one World::CommitBulkEdit did
+    struct BulkBlockEditStats
+    {
+        uint64_t blocksWritten          = 0;
+        uint32_t chunksTouched          = 0;
+        uint32_t columnsTouched         = 0;
+        uint64_t skyFlagsChanged        = 0; // Blocks that gained or lost the SKY flag
+        uint64_t lightResolvedDirect    = 0; // Opaque, non-emissive writes set to light 0 without queueing
+        uint64_t lightBlocksProcessed   = 0; // VoxelLightEngine::RunLightUpdates work for the commit
+        uint32_t meshUpdatesRequested   = 0; // RequestChunkMeshEditUpdate calls for touched chunks
+        uint32_t neighborMeshUpdates    = 0; // Same, for untouched neighbors reached by faces or light
+    };
+
     class World
     {
     public:
@@ -101,6 +129,16 @@ namespace enigma::voxel
         void PlaceBlock(const BlockIterator&        blockIter, enigma::registry::block::Block* blockType,
                         const VoxelRaycastResult3D& raycast, const Vec3&                       playerLookDir);
 
+        // Bulk edits (fills, structure pastes): SetBlocks writes straight into chunk storage and only
+        // records what it touched; CommitBulkEdit then fixes heightmaps and sky columns, runs one light
+        // update for the whole edit and requests one mesh update per affected chunk.
+        // Blocks in chunks that are not loaded and active are skipped. Regions are inclusive corners.
+        void               BeginBulkEdit();
+        size_t             SetBlocks(const BlockPos& minCorner, const BlockPos& maxCorner, const BulkBlockPalette& palette);
+        size_t             SetBlocks(const BlockPos& minCorner, const BlockPos& maxCorner, BlockState* state);
+        BulkBlockEditStats CommitBulkEdit();
+        bool               IsBulkEditActive() const { return m_bulkEditActive; }
+
         //-------------------------------------------------------------------------------------------
         // VoxelLightEngine Integration
         //-------------------------------------------------------------------------------------------
@@ -119,6 +157,13 @@ namespace enigma::voxel
         // Light Dirty Marking (convenience wrapper for Chunk usage)
         void MarkLightingDirty(const BlockIterator& iter);
 
+        // Chunk replication: block edits, light changes and unloads are forwarded to the attached
+        // stream server (not owned, nullptr when not serving). Main thread only, like the server.
+        void               SetChunkStreamServer(ChunkStreamServer* streamServer) { m_chunkStreamServer = streamServer; }
+        ChunkStreamServer* GetChunkStreamServer() const { return m_chunkStreamServer; }
+        void               NotifyBlockChanged(const Chunk& chunk, int32_t blockIndex) const;
+        void               NotifyLightChanged(const Chunk& chunk, int32_t minZ, int32_t maxZ) const;
+
         // Chunk Operations:
         Chunk* GetChunk(int32_t chunkCoordinateX, int32_t chunkCoordinateY);
         Chunk* GetChunk(int32_t chunkCoordinateX, int32_t chunkCoordinateY) const;
@@ -148,7 +193,14 @@ namespace enigma::voxel
         const ChunkBatchStats&                               GetChunkBatchStats() const { return m_chunkBatchStats; }
         ChunkRenderRegionStorage&                            GetChunkRenderRegionStorage() { return m_chunkRenderRegionStorage; }
         const ChunkRenderRegionStorage&                      GetChunkRenderRegionStorage() const { return m_chunkRenderRegionStorage; }
+        ChunkPool&                                           GetChunkPool() { return m_chunkPool; }
+        const ChunkPool&                                     GetChunkPool() const { return m_chunkPool; }
+        ChunkMeshBufferPool&                                 GetChunkMeshBufferPool() { return m_chunkMeshBufferPool; }
+        const ChunkMeshBufferPool&                           GetChunkMeshBufferPool() const { return m_chunkMeshBufferPool; }
         const AsyncChunkMeshDiagnostics&                     GetAsyncChunkMeshDiagnostics() const { return m_asyncChunkMeshDiagnostics; }
+        const ChunkMeshPatchDiagnostics&                     GetChunkMeshPatchDiagnostics() const { return m_chunkMeshPatchDiagnostics; }
+        const ChunkWriteBehindQueue&                         GetChunkWriteBehindQueue() const { return m_chunkWriteBehind; }
+        ChunkMeshPatchDiagnostics&                           MutableChunkMeshPatchDiagnostics() { return m_chunkMeshPatchDiagnostics; }
         uint32_t                                             GetMaxChunkBatchRegionRebuildsPerFrame() const { return m_maxChunkBatchRegionRebuildsPerFrame; }
 
         // 调试功能
@@ -166,7 +218,8 @@ namespace enigma::voxel
 
         // World file management interface
         bool InitializeWorldStorage(const std::string& savesPath);
-        bool SaveWorld();
+        // Writes world info and flushes every dirty chunk; progress is reported per chunk written
+        bool SaveWorld(const ChunkWriteBehindQueue::ProgressFunction& progress = nullptr);
         bool LoadWorld();
         void CloseWorld();
 
@@ -205,6 +258,12 @@ namespace enigma::voxel
         // Called by lifecycle, block edits, explicit invalidation, and controlled neighbor refresh
         void ScheduleChunkMeshRebuild(Chunk* chunk, bool forceImportant = false);
 
+        // Block-edit entry point: queues a section patch (ApplyPendingChunkMeshPatches) when the
+        // chunk's current mesh can take one, otherwise an important full rebuild
+        void RequestChunkMeshEditUpdate(Chunk* chunk);
+        void SetChunkMeshPatchingEnabled(bool enabled) { m_enableChunkMeshPatching = enabled; }
+        bool IsChunkMeshPatchingEnabled() const { return m_enableChunkMeshPatching; }
+
         // [R5.0] Mark all loaded chunks as dirty and schedule mesh rebuild
         // Called when ShaderBundle switches (material ID mappings change)
         // Reference: Iris levelRenderer.allChanged() on shader pack switch
@@ -240,6 +299,11 @@ namespace enigma::voxel
         // Submit chunk save job to ScheduleSubsystem
         bool SubmitSaveChunkJob(IntVec2 chunkCoords, const Chunk* chunk);
 
+        // Write-behind saves (ESFS): serialize a dirty chunk into m_chunkWriteBehind, write due batches off-thread
+        bool QueueChunkForWriteBehind(Chunk* chunk, IntVec2 chunkCoords);
+        void SubmitDueChunkWriteBatch();
+        void WaitForChunkWriteBatch();
+
         void StoreActiveChunkTaskHandle(std::unordered_map<int64_t, enigma::core::TaskHandle>& handleMap, IntVec2 chunkCoords,
                                         const enigma::core::TaskHandle& handle);
         void ClearActiveChunkTaskHandle(std::unordered_map<int64_t, enigma::core::TaskHandle>& handleMap, IntVec2 chunkCoords);
@@ -249,6 +313,7 @@ namespace enigma::voxel
         void ProcessGenerateChunkTaskRecord(const enigma::core::TaskCompletionRecord& record, GenerateChunkJob* job);
         void ProcessLoadChunkTaskRecord(const enigma::core::TaskCompletionRecord& record, LoadChunkJob* job);
         void ProcessSaveChunkTaskRecord(const enigma::core::TaskCompletionRecord& record, SaveChunkJob* job);
+        void ProcessChunkWriteBatchTaskRecord(const enigma::core::TaskCompletionRecord& record, ChunkWriteBatchJob* job);
         void ProcessChunkMeshBuildTaskRecord(const enigma::core::TaskCompletionRecord& record, ChunkMeshBuildTask* task);
         void LogDiscardedChunkTaskRecord(const enigma::core::TaskCompletionRecord& record, const char* jobLabel, const char* reason) const;
 
@@ -262,7 +327,7 @@ namespace enigma::voxel
         void HandleSaveChunkCompleted(SaveChunkJob* job);
         void HandleChunkMeshBuildCompleted(const enigma::core::TaskCompletionRecord& record,
                                            ChunkMeshBuildTask* task,
-                                           std::optional<ChunkMeshBuildResult> result);
+                                           std::optional<ChunkMeshBuildResult>& result);
         bool ShouldRequeueDiscardedChunkMeshBuild(const enigma::core::TaskCompletionRecord& record,
                                                   const std::optional<ChunkMeshBuildResult>& result,
                                                   const Chunk& chunk,
@@ -285,6 +350,8 @@ namespace enigma::voxel
         void QueueChunkMeshBuildRetry(Chunk& chunk, ChunkMeshBuildState& buildState, IntVec2 chunkCoords);
         bool IsImportantChunkMeshBuild(const Chunk& chunk, bool forceImportant = false) const;
         bool HasImportantChunkMeshBuildInFlight() const;
+        std::optional<enigma::core::TaskHandle> FindImportantChunkMeshBuildHandle() const;
+        std::optional<enigma::core::TaskHandle> FindOutstandingTrackedTaskHandle() const;
         void RunImportantChunkBoundedWait();
         void RefreshAsyncChunkMeshDiagnosticsSnapshot();
         void CancelActiveChunkMeshBuilds(const char* reason);
@@ -312,9 +379,30 @@ namespace enigma::voxel
         const ChunkMeshBuildState* FindChunkMeshBuildState(IntVec2 chunkCoords) const;
         void     EraseChunkMeshBuildState(IntVec2 chunkCoords);
 
+        // Edit patch path: after light updates, re-mesh dirty sections and splice them in place
+        void ApplyPendingChunkMeshPatches();
+        bool CanPatchChunkMesh(const Chunk& chunk) const;
+        bool PatchChunkMeshSections(Chunk& chunk, uint32_t firstSection, uint32_t endSection, ChunkMeshSectionPatch& outPatch);
+        void FallBackToChunkMeshRebuild(Chunk* chunk, int64_t chunkKey, std::chrono::steady_clock::time_point editTime);
+        void UpdateChunkEditVisibilityWaits();
+
         // Sort mesh rebuild queue by distance to player (nearest first)
         void SortMeshQueueByDistance();
 
+        // Bulk edit bookkeeping, per touched chunk
+        struct BulkEditChunk
+        {
+            uint64_t          chunkInstanceId = 0;
+            std::vector<bool> written; // Chunk::CoordsToIndex order
+            std::vector<bool> columns; // x + y * CHUNK_SIZE_X
+            int32_t           minZ = INT32_MAX;
+            int32_t           maxZ = INT32_MIN;
+            uint32_t          columnCount = 0;
+            uint64_t          blockCount  = 0;
+        };
+
+        bool IsBulkWritten(const BlockIterator& iter) const;
+
         // Get distance from chunk to player (helper for sorting)
         float GetChunkDistanceToPlayer(Chunk* chunk) const;
 
@@ -348,6 +436,8 @@ namespace enigma::voxel
 
     private:
         std::unordered_map<int64_t, std::unique_ptr<Chunk>> m_loadedChunks;
+        ChunkPool                                           m_chunkPool; // Recycles unloaded chunk storage
+        ChunkMeshBufferPool                                 m_chunkMeshBufferPool; // Recycles replaced/unloaded chunk mesh buffers
         bool                                                m_enableChunkDebug         = false;
         Texture*                                            m_cachedBlocksAtlasTexture = nullptr;
         ChunkBatchStats                                     m_chunkBatchStats;
@@ -405,6 +495,11 @@ namespace enigma::voxel
         int m_maxLoadJobs     = 64; // Increased for ESFS format (no file lock contention, SSD-friendly)
         int m_maxSaveJobs     = 32; // Increased for better save throughput (lower priority than load)
 
+        // Write-behind chunk saves: one batch job in flight at a time
+        ChunkWriteBehindQueue                 m_chunkWriteBehind;
+        enigma::core::TaskHandle              m_chunkWriteBatchHandle;
+        std::chrono::steady_clock::time_point m_chunkWriteBehindEpoch = std::chrono::steady_clock::now();
+
         //-------------------------------------------------------------------------------------------
         // Async Chunk Mesh Build State
         //-------------------------------------------------------------------------------------------
@@ -420,9 +515,21 @@ namespace enigma::voxel
         float                                            m_importantChunkDistanceThreshold = 2.0f;
         bool                                             m_enableImportantChunkBoundedWait = true;
         uint32_t                                         m_importantChunkWaitBudgetMicros = 750;
-        uint32_t                                         m_importantChunkWaitYieldLimit   = 8;
+        uint32_t                                         m_importantChunkWaitYieldLimit   = 8; // Max WaitOrExecute rounds per frame
         uint32_t           m_maxChunkBatchRegionRebuildsPerFrame = 2;
 
+        // Block-edit section patching (chunk key -> time of the first unapplied edit)
+        std::unordered_map<int64_t, std::chrono::steady_clock::time_point> m_pendingChunkMeshPatches;
+        std::unordered_map<int64_t, std::chrono::steady_clock::time_point> m_chunkEditVisibilityWaits; // Edits left to a rebuild
+        std::shared_ptr<ChunkMeshingScratch>                                m_chunkMeshPatchScratch; // Reused by every patch snapshot
+        ChunkMeshPatchDiagnostics                                           m_chunkMeshPatchDiagnostics;
+        bool                                                                m_enableChunkMeshPatching   = true;
+        uint32_t                                                            m_maxChunkMeshPatchSections = 4; // Wider dirty ranges take a full rebuild
+
+        // Open bulk edit (BeginBulkEdit .. CommitBulkEdit), keyed by packed chunk coordinates
+        bool                                       m_bulkEditActive = false;
+        std::unordered_map<int64_t, BulkEditChunk> m_bulkEditChunks;
+
         //-------------------------------------------------------------------------------------------
         // Phase 5: Graceful Shutdown State
         //-------------------------------------------------------------------------------------------
@@ -433,6 +540,7 @@ namespace enigma::voxel
         // [REFACTORED] Lighting System State - Now uses VoxelLightEngine
         //-------------------------------------------------------------------------------------------
         std::unique_ptr<VoxelLightEngine> m_voxelLightEngine; // Composite light engine
+        ChunkStreamServer*                m_chunkStreamServer = nullptr; // Not owned, see SetChunkStreamServer
         int                               m_skyDarken = 0; // Computed from time (0 at noon, 11 at midnight)
         struct AsyncChunkMeshWorkerCounterSnapshot
         {
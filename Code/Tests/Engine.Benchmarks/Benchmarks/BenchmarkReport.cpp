@@ -0,0 +1,125 @@
+#include "BenchmarkReport.hpp"
+
+#include <algorithm>
+
+#define WIN32_LEAN_AND_MEAN
+#include <Windows.h>
+#include <Psapi.h>
+#pragma comment(lib, "Psapi.lib")
+
+namespace enigma::benchmark
+{
+    namespace
+    {
+        double Percentile(std::vector<double> sorted, double fraction)
+        {
+            if (sorted.empty())
+            {
+                return 0.0;
+            }
+            std::sort(sorted.begin(), sorted.end());
+            const size_t index = static_cast<size_t>(fraction * static_cast<double>(sorted.size() - 1) + 0.5);
+            return sorted[(std::min)(index, sorted.size() - 1)];
+        }
+    }
+
+    ProcessMemorySample SampleProcessMemory()
+    {
+        ProcessMemorySample        sample;
+        PROCESS_MEMORY_COUNTERS_EX counters{};
+        if (GetProcessMemoryInfo(GetCurrentProcess(), reinterpret_cast<PROCESS_MEMORY_COUNTERS*>(&counters), sizeof(counters)))
+        {
+            sample.workingSetBytes     = counters.WorkingSetSize;
+            sample.peakWorkingSetBytes = counters.PeakWorkingSetSize;
+        }
+        return sample;
+    }
+
+    void BenchmarkStage::SetMetric(const std::string& key, double value)
+    {
+        for (auto& metric : metrics)
+        {
+            if (metric.first == key)
+            {
+                metric.second = value;
+                return;
+            }
+        }
+        metrics.emplace_back(key, value);
+    }
+
+    BenchmarkReport::BenchmarkReport(std::string benchmarkName, uint64_t seed)
+        : m_benchmarkName(std::move(benchmarkName))
+          , m_seed(seed)
+    {
+    }
+
+    BenchmarkStage& BenchmarkReport::BeginStage(const std::string& name)
+    {
+        m_stages.emplace_back();
+        BenchmarkStage& stage = m_stages.back();
+        stage.name            = name;
+        stage.memoryBegin     = SampleProcessMemory();
+        stage.start           = std::chrono::steady_clock::now();
+        return stage;
+    }
+
+    void BenchmarkReport::EndStage(BenchmarkStage& stage, uint64_t itemCount)
+    {
+        stage.totalMs   = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - stage.start).count();
+        stage.itemCount = itemCount;
+        stage.memoryEnd = SampleProcessMemory();
+    }
+
+    void BenchmarkReport::WriteJson(std::FILE* file) const
+    {
+        std::fprintf(file, "{\"benchmark\":\"%s\",\"seed\":%llu,\"stages\":[", m_benchmarkName.c_str(), static_cast<unsigned long long>(m_seed));
+        for (size_t i = 0; i < m_stages.size(); ++i)
+        {
+            const BenchmarkStage& stage     = m_stages[i];
+            const double          perItemUs = stage.itemCount > 0 ? stage.totalMs * 1000.0 / static_cast<double>(stage.itemCount) : 0.0;
+            const long long       deltaBytes = static_cast<long long>(stage.memoryEnd.workingSetBytes) - static_cast<long long>(stage.memoryBegin.workingSetBytes);
+
+            std::fprintf(file, "%s\n  {\"name\":\"%s\",\"items\":%llu,\"totalMs\":%.3f,\"perItemUs\":%.3f",
+                         i == 0 ? "" : ",", stage.name.c_str(), static_cast<unsigned long long>(stage.itemCount), stage.totalMs, perItemUs);
+            if (!stage.samplesUs.empty())
+            {
+                std::fprintf(file, ",\"p50Us\":%.3f,\"p95Us\":%.3f,\"maxUs\":%.3f",
+                             Percentile(stage.samplesUs, 0.50), Percentile(stage.samplesUs, 0.95),
+                             *std::max_element(stage.samplesUs.begin(), stage.samplesUs.end()));
+            }
+            std::fprintf(file, ",\"workingSetBytes\":%llu,\"workingSetDeltaBytes\":%lld,\"peakWorkingSetBytes\":%llu,\"metrics\":{",
+                         static_cast<unsigned long long>(stage.memoryEnd.workingSetBytes), deltaBytes,
+                         static_cast<unsigned long long>(stage.memoryEnd.peakWorkingSetBytes));
+            for (size_t m = 0; m < stage.metrics.size(); ++m)
+            {
+                std::fprintf(file, "%s\"%s\":%.17g", m == 0 ? "" : ",", stage.metrics[m].first.c_str(), stage.metrics[m].second);
+            }
+            std::fprintf(file, "}}");
+        }
+        std::fprintf(file, "\n]}\n");
+    }
+
+    bool BenchmarkReport::WriteJsonFile(const std::string& path) const
+    {
+        std::FILE* file = nullptr;
+        if (fopen_s(&file, path.c_str(), "wb") != 0 || file == nullptr)
+        {
+            return false;
+        }
+        WriteJson(file);
+        std::fclose(file);
+        return true;
+    }
+
+    void BenchmarkReport::PrintSummary(std::FILE* file) const
+    {
+        for (const BenchmarkStage& stage : m_stages)
+        {
+            const double perItemUs = stage.itemCount > 0 ? stage.totalMs * 1000.0 / static_cast<double>(stage.itemCount) : 0.0;
+            std::fprintf(file, "[ BENCH    ] %-10s %8llu items %10.2f ms %10.2f us/item  peak %.1f MB\n",
+                         stage.name.c_str(), static_cast<unsigned long long>(stage.itemCount), stage.totalMs, perItemUs,
+                         static_cast<double>(stage.memoryEnd.peakWorkingSetBytes) / (1024.0 * 1024.0));
+        }
+    }
+}
@@ -0,0 +1,64 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace enigma::benchmark
+{
+    /// Process memory figures (bytes) sampled from the OS
+    struct ProcessMemorySample
+    {
+        uint64_t workingSetBytes     = 0;
+        uint64_t peakWorkingSetBytes = 0; // Process lifetime peak
+    };
+
+    ProcessMemorySample SampleProcessMemory();
+
+    /// Timing and memory record of one benchmark stage
+    struct BenchmarkStage
+    {
+        std::string                                  name;
+        uint64_t                                     itemCount = 0;
+        double                                       totalMs   = 0.0;
+        std::vector<double>                          samplesUs; // Optional per-item latencies
+        std::vector<std::pair<std::string, double>>  metrics; // Stage-specific figures (vertex counts, bytes, ...)
+        ProcessMemorySample                          memoryBegin;
+        ProcessMemorySample                          memoryEnd;
+        std::chrono::steady_clock::time_point        start;
+
+        void AddSample(double microseconds) { samplesUs.push_back(microseconds); }
+        void SetMetric(const std::string& key, double value);
+    };
+
+    /// Collects stages in run order and writes them as one JSON document
+    ///
+    /// Output shape:
+    /// {"benchmark":"world","seed":..,"stages":[{"name":..,"items":..,"totalMs":..,"perItemUs":..,
+    ///   "p50Us":..,"p95Us":..,"maxUs":..,"workingSetBytes":..,"workingSetDeltaBytes":..,
+    ///   "peakWorkingSetBytes":..,"metrics":{..}}]}
+    class BenchmarkReport
+    {
+    public:
+        BenchmarkReport(std::string benchmarkName, uint64_t seed);
+
+        BenchmarkStage& BeginStage(const std::string& name);
+        void            EndStage(BenchmarkStage& stage, uint64_t itemCount);
+
+        const std::vector<BenchmarkStage>& GetStages() const { return m_stages; }
+
+        void WriteJson(std::FILE* file) const;
+        bool WriteJsonFile(const std::string& path) const;
+
+        /// One human-readable line per stage
+        void PrintSummary(std::FILE* file) const;
+
+    private:
+        std::string                 m_benchmarkName;
+        uint64_t                    m_seed = 0;
+        std::vector<BenchmarkStage> m_stages;
+    };
+}
@@ -0,0 +1,161 @@
+#include "BenchmarkTerrainGenerator.hpp"
+
+#include "Engine/Math/NoiseBatch.hpp"
+#include "Engine/Math/RawNoise.hpp"
+#include "Engine/Math/SmoothNoise.hpp"
+#include "Engine/Registry/Block/Block.hpp"
+#include "Engine/Registry/Block/BlockRegistry.hpp"
+
+#include <algorithm>
+
+namespace enigma::benchmark
+{
+    using voxel::BlockState;
+    using voxel::Chunk;
+
+    BenchmarkTerrainGenerator::BenchmarkTerrainGenerator(const std::string& blockNamespace)
+        : TerrainGenerator("benchmark", "engine")
+          , m_blockNamespace(blockNamespace)
+    {
+    }
+
+    bool BenchmarkTerrainGenerator::ResolveBlocks()
+    {
+        m_stone = ResolveState("stone", nullptr);
+        if (!m_stone)
+        {
+            return false;
+        }
+        m_air       = ResolveState("air", nullptr);
+        m_dirt      = ResolveState("dirt", m_stone);
+        m_grass     = ResolveState("grass", m_dirt);
+        m_sand      = ResolveState("sand", m_dirt);
+        m_water     = ResolveState("water", nullptr); // Dry world when the namespace has no fluid
+        m_glowstone = ResolveState("glowstone", m_stone);
+        return true;
+    }
+
+    BlockState* BenchmarkTerrainGenerator::ResolveState(const char* name, BlockState* fallback) const
+    {
+        auto block = registry::block::BlockRegistry::GetBlock(m_blockNamespace, name);
+        return block ? block->GetDefaultState() : fallback;
+    }
+
+    bool BenchmarkTerrainGenerator::Initialize(uint32_t seed)
+    {
+        m_seed = seed;
+        return true;
+    }
+
+    int32_t BenchmarkTerrainGenerator::ComputeHeight(int32_t globalX, int32_t globalY, uint32_t seed) const
+    {
+        return HeightFromNoise(Compute2dPerlinNoise(static_cast<float>(globalX), static_cast<float>(globalY), HEIGHT_SCALE, HEIGHT_OCTAVES, 0.5f, 2.f, true, seed));
+    }
+
+    int32_t BenchmarkTerrainGenerator::HeightFromNoise(float noise)
+    {
+        const int height = SEA_LEVEL + static_cast<int>(noise * HEIGHT_AMPLITUDE);
+        return std::clamp(height, 1, Chunk::CHUNK_MAX_Z - 8);
+    }
+
+    int BenchmarkTerrainGenerator::GetGroundHeightAt(int globalX, int globalY) const
+    {
+        return ComputeHeight(globalX, globalY, m_seed);
+    }
+
+    bool BenchmarkTerrainGenerator::GenerateChunk(Chunk* chunk, int32_t chunkX, int32_t chunkY, uint32_t worldSeed)
+    {
+        if (!chunk || !m_stone)
+        {
+            return false;
+        }
+
+        // Shape pass needs the seed; the remaining passes only read what it wrote
+        const int32_t baseX = Chunk::ChunkCoordsToWorld(chunkX);
+        const int32_t baseY = Chunk::ChunkCoordsToWorld(chunkY);
+
+        // All columns in one batched call; same values as ComputeHeight per column
+        float columnNoise[Chunk::CHUNK_SIZE_X * Chunk::CHUNK_SIZE_Y];
+        Compute2dPerlinNoiseGrid(static_cast<float>(baseX), static_cast<float>(baseY), 1.f, 1.f, Chunk::CHUNK_SIZE_X, Chunk::CHUNK_SIZE_Y, columnNoise,
+                                 HEIGHT_SCALE, HEIGHT_OCTAVES, 0.5f, 2.f, true, worldSeed);
+        for (int32_t y = 0; y < Chunk::CHUNK_SIZE_Y; ++y)
+        {
+            for (int32_t x = 0; x < Chunk::CHUNK_SIZE_X; ++x)
+            {
+                const int32_t height = HeightFromNoise(columnNoise[y * Chunk::CHUNK_SIZE_X + x]);
+                for (int32_t z = 0; z <= height; ++z)
+                {
+                    chunk->SetBlock(x, y, z, m_stone);
+                }
+                if (m_water)
+                {
+                    for (int32_t z = height + 1; z <= SEA_LEVEL; ++z)
+                    {
+                        chunk->SetBlock(x, y, z, m_water);
+                    }
+                }
+            }
+        }
+        return ApplySurfaceRules(chunk, chunkX, chunkY) && GenerateFeatures(chunk, chunkX, chunkY);
+    }
+
+    bool BenchmarkTerrainGenerator::GenerateTerrainShape(Chunk* chunk, int32_t chunkX, int32_t chunkY)
+    {
+        return GenerateChunk(chunk, chunkX, chunkY, m_seed);
+    }
+
+    bool BenchmarkTerrainGenerator::ApplySurfaceRules(Chunk* chunk, int32_t chunkX, int32_t chunkY)
+    {
+        UNUSED(chunkX)
+        UNUSED(chunkY)
+        for (int32_t y = 0; y < Chunk::CHUNK_SIZE_Y; ++y)
+        {
+            for (int32_t x = 0; x < Chunk::CHUNK_SIZE_X; ++x)
+            {
+                int32_t top = Chunk::CHUNK_MAX_Z;
+                while (top > 0 && chunk->GetBlock(x, y, top) != m_stone)
+                {
+                    --top;
+                }
+
+                const bool  shore   = top <= SEA_LEVEL + 1;
+                BlockState* surface = shore ? m_sand : m_grass;
+                BlockState* filler  = shore ? m_sand : m_dirt;
+                chunk->SetBlock(x, y, top, surface);
+                for (int32_t z = (std::max)(top - 3, 1); z < top; ++z)
+                {
+                    chunk->SetBlock(x, y, z, filler);
+                }
+            }
+        }
+        return true;
+    }
+
+    bool BenchmarkTerrainGenerator::GenerateFeatures(Chunk* chunk, int32_t chunkX, int32_t chunkY)
+    {
+        // One short emissive pillar in roughly every fourth chunk
+        const unsigned int roll = Get2dNoiseUint(chunkX, chunkY, m_seed);
+        if ((roll & 3u) != 0)
+        {
+            return true;
+        }
+
+        const int32_t x = static_cast<int32_t>((roll >> 2) % Chunk::CHUNK_SIZE_X);
+        const int32_t y = static_cast<int32_t>((roll >> 6) % Chunk::CHUNK_SIZE_Y);
+        int32_t       z = Chunk::CHUNK_MAX_Z;
+        while (z > 0 && (chunk->GetBlock(x, y, z) == nullptr || chunk->GetBlock(x, y, z) == m_air))
+        {
+            --z;
+        }
+        for (int32_t i = 1; i <= 4 && z + i < Chunk::CHUNK_SIZE_Z; ++i)
+        {
+            chunk->SetBlock(x, y, z + i, m_glowstone);
+        }
+        return true;
+    }
+
+    std::string BenchmarkTerrainGenerator::GetConfigDescription() const
+    {
+        return "Benchmark heightmap (sea level 64, amplitude 28, Perlin scale 96 x4 octaves)";
+    }
+}
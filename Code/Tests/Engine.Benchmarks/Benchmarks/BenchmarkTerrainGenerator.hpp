@@ -0,0 +1,56 @@
+#pragma once
+
+#include "Engine/Voxel/Generation/TerrainGenerator.hpp"
+
+namespace enigma::benchmark
+{
+    /// Deterministic heightmap terrain used by the world benchmark
+    ///
+    /// The engine ships no concrete generator (games provide their own), so the benchmark
+    /// brings a small one with a realistic mix of solid, surface, fluid and emissive blocks:
+    /// Perlin column height, stone/dirt/grass layers, sand shores, water up to sea level and
+    /// sparse glowstone pillars so block light has work to do.
+    class BenchmarkTerrainGenerator : public voxel::TerrainGenerator
+    {
+    public:
+        explicit BenchmarkTerrainGenerator(const std::string& blockNamespace);
+
+        /// Resolve block states once; call after blocks are registered
+        bool ResolveBlocks();
+
+        bool GenerateChunk(voxel::Chunk* chunk, int32_t chunkX, int32_t chunkY, uint32_t worldSeed) override;
+        bool GenerateTerrainShape(voxel::Chunk* chunk, int32_t chunkX, int32_t chunkY) override;
+        bool ApplySurfaceRules(voxel::Chunk* chunk, int32_t chunkX, int32_t chunkY) override;
+        bool GenerateFeatures(voxel::Chunk* chunk, int32_t chunkX, int32_t chunkY) override;
+
+        int32_t     GetSeaLevel() const override { return SEA_LEVEL; }
+        int         GetGroundHeightAt(int globalX, int globalY) const override;
+        std::string GetConfigDescription() const override;
+
+        bool Initialize(uint32_t seed) override;
+
+        /// Non-air states that edits can place
+        voxel::BlockState* GetStone() const { return m_stone; }
+        voxel::BlockState* GetEmissive() const { return m_glowstone; }
+
+    private:
+        static constexpr int32_t SEA_LEVEL        = 64;
+        static constexpr float   HEIGHT_AMPLITUDE = 28.f;
+        static constexpr float   HEIGHT_SCALE     = 96.f;
+        static constexpr int     HEIGHT_OCTAVES   = 4;
+
+        voxel::BlockState* ResolveState(const char* name, voxel::BlockState* fallback) const;
+        int32_t            ComputeHeight(int32_t globalX, int32_t globalY, uint32_t seed) const;
+        static int32_t     HeightFromNoise(float noise);
+
+        std::string        m_blockNamespace;
+        uint32_t           m_seed      = 0;
+        voxel::BlockState* m_air       = nullptr;
+        voxel::BlockState* m_stone     = nullptr;
+        voxel::BlockState* m_dirt      = nullptr;
+        voxel::BlockState* m_grass     = nullptr;
+        voxel::BlockState* m_sand      = nullptr;
+        voxel::BlockState* m_water     = nullptr;
+        voxel::BlockState* m_glowstone = nullptr;
+    };
+}
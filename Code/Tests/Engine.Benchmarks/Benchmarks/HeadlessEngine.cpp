@@ -0,0 +1,65 @@
+#include "HeadlessEngine.hpp"
+
+#include "Engine/Core/Engine.hpp"
+#include "Engine/Core/Logger/LoggerSubsystem.hpp"
+#include "Engine/Model/ModelSubsystem.hpp"
+#include "Engine/Registry/Block/BlockRegistry.hpp"
+#include "Engine/Registry/Core/RegisterSubsystem.hpp"
+
+#include <cstdio>
+#include <memory>
+
+namespace enigma::benchmark
+{
+    HeadlessEngine::~HeadlessEngine()
+    {
+        Shutdown();
+    }
+
+    bool HeadlessEngine::Startup(const HeadlessEngineOptions& options)
+    {
+        // Keep per-task LogInfo calls cheap so the logger does not dominate the measurements
+        m_loggerConfig.globalLogLevel       = core::LogLevel::WARNING;
+        m_loggerConfig.enableFileLogging    = false;
+        m_loggerConfig.enableConsoleLogging = false;
+
+        if (!m_scheduleConfig.LoadFromFile(options.scheduleConfigPath))
+        {
+            m_scheduleConfig = core::ScheduleConfig::GetDefaultConfig();
+        }
+
+        core::Engine::CreateInstance();
+        GEngine->RegisterSubsystem(std::make_unique<core::LoggerSubsystem>(m_loggerConfig));
+        GEngine->RegisterSubsystem(std::make_unique<core::ScheduleSubsystem>(m_scheduleConfig));
+        GEngine->RegisterSubsystem(std::make_unique<core::RegisterSubsystem>());
+        GEngine->RegisterSubsystem(std::make_unique<resource::ResourceSubsystem>(m_resourceConfig));
+        GEngine->RegisterSubsystem(std::make_unique<model::ModelSubsystem>());
+        GEngine->Startup();
+        m_started = true;
+
+        registry::block::BlockRegistry::LoadNamespaceBlocks(options.blockDataPath, options.blockNamespace);
+        m_registeredBlockCount = registry::block::BlockRegistry::GetBlockCount();
+        if (m_registeredBlockCount == 0)
+        {
+            std::fprintf(stderr, "No blocks registered from %s/%s/block\n", options.blockDataPath.c_str(), options.blockNamespace.c_str());
+            return false;
+        }
+
+        if (auto* modelSubsystem = GEngine->GetSubsystem<model::ModelSubsystem>())
+        {
+            modelSubsystem->CompileAllBlockModels();
+        }
+        return true;
+    }
+
+    void HeadlessEngine::Shutdown()
+    {
+        if (!m_started)
+        {
+            return;
+        }
+        m_started = false;
+        GEngine->Shutdown();
+        core::Engine::DestroyInstance();
+    }
+}
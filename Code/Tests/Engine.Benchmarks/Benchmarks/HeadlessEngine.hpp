@@ -0,0 +1,46 @@
+#pragma once
+
+#include "Engine/Core/Logger/LoggerConfig.hpp"
+#include "Engine/Core/Schedule/ScheduleSubsystem.hpp"
+#include "Engine/Resource/ResourceSubsystem.hpp"
+
+#include <string>
+
+namespace enigma::benchmark
+{
+    struct HeadlessEngineOptions
+    {
+        std::string scheduleConfigPath = ".enigma/config/engine/schedule.yml";
+        std::string blockDataPath      = ".enigma/data"; // Expects <blockDataPath>/<namespace>/block/*.yml
+        std::string blockNamespace     = "simpleminer";
+    };
+
+    /// Boots the CPU-only part of the engine: Logger, Schedule, Register, Resource and Model
+    ///
+    /// No window, renderer or audio is created. Resource atlases are packed in memory only
+    /// (TextureAtlas skips the GPU upload while g_theRenderer is null) so block models still
+    /// get UVs and ChunkMeshBuilder produces the same vertices as in the game.
+    class HeadlessEngine
+    {
+    public:
+        HeadlessEngine() = default;
+        ~HeadlessEngine();
+
+        HeadlessEngine(const HeadlessEngine&)            = delete;
+        HeadlessEngine& operator=(const HeadlessEngine&) = delete;
+
+        /// Start subsystems, register blocks from YAML and compile their models
+        bool Startup(const HeadlessEngineOptions& options);
+        void Shutdown();
+
+        size_t GetRegisteredBlockCount() const { return m_registeredBlockCount; }
+
+    private:
+        // Subsystems keep references to their configs, so they live as long as the engine
+        core::LoggerConfig       m_loggerConfig;
+        core::ScheduleConfig     m_scheduleConfig;
+        resource::ResourceConfig m_resourceConfig;
+        bool                     m_started              = false;
+        size_t                   m_registeredBlockCount = 0;
+    };
+}
@@ -0,0 +1,167 @@
+#include "NoiseBenchmark.hpp"
+
+#include "Engine/Math/NoiseBatch.hpp"
+#include "Engine/Math/RawNoise.hpp"
+#include "Engine/Math/SmoothNoise.hpp"
+#include "Engine/Voxel/Chunk/Chunk.hpp"
+
+#include <cstring>
+
+namespace enigma::benchmark
+{
+    namespace
+    {
+        // Terrain-like settings, shared by the scalar and batch stage of each pair
+        constexpr float        kScale2d    = 96.f;
+        constexpr unsigned int kOctaves2d  = 4;
+        constexpr float        kScale3d    = 24.f;
+        constexpr unsigned int kOctaves3d  = 3;
+        constexpr float        kWorldRange = 4096.f; // Blocks around the origin
+        constexpr int          kColumnsX   = voxel::Chunk::CHUNK_SIZE_X;
+        constexpr int          kColumnsY   = voxel::Chunk::CHUNK_SIZE_Y;
+
+        template <typename T>
+        size_t CountMismatches(const std::vector<T>& expected, const std::vector<T>& actual)
+        {
+            size_t mismatches = 0;
+            for (size_t i = 0; i < expected.size(); ++i)
+            {
+                mismatches += std::memcmp(&expected[i], &actual[i], sizeof(T)) != 0 ? 1 : 0;
+            }
+            return mismatches;
+        }
+    }
+
+    NoiseBenchmark::NoiseBenchmark(const NoiseBenchmarkOptions& options)
+        : m_options(options)
+    {
+        // Fractional world positions, the same for every run with the same seed
+        m_posX.resize(m_options.sampleCount);
+        m_posY.resize(m_options.sampleCount);
+        m_posZ.resize(m_options.sampleCount);
+        for (size_t i = 0; i < m_options.sampleCount; ++i)
+        {
+            const int index = static_cast<int>(i);
+            m_posX[i]       = (Get1dNoiseZeroToOne(index, m_options.seed) * 2.f - 1.f) * kWorldRange;
+            m_posY[i]       = (Get1dNoiseZeroToOne(index, m_options.seed + 1) * 2.f - 1.f) * kWorldRange;
+            m_posZ[i]       = Get1dNoiseZeroToOne(index, m_options.seed + 2) * static_cast<float>(voxel::Chunk::CHUNK_SIZE_Z);
+        }
+    }
+
+    void NoiseBenchmark::Run(BenchmarkReport& report)
+    {
+        if (m_options.sampleCount == 0)
+        {
+            return;
+        }
+        RunRaw3d(report);
+        RunPerlin2d(report);
+        RunPerlin2dGrid(report);
+        RunPerlin3d(report);
+    }
+
+    void NoiseBenchmark::RunRaw3d(BenchmarkReport& report)
+    {
+        const size_t              count = m_options.sampleCount;
+        std::vector<int>          indexX(count), indexY(count), indexZ(count);
+        std::vector<unsigned int> scalar(count), batch(count);
+        for (size_t i = 0; i < count; ++i)
+        {
+            indexX[i] = static_cast<int>(m_posX[i]);
+            indexY[i] = static_cast<int>(m_posY[i]);
+            indexZ[i] = static_cast<int>(m_posZ[i]);
+        }
+
+        BenchmarkStage& scalarStage = report.BeginStage("noise-raw3d");
+        for (size_t i = 0; i < count; ++i)
+        {
+            scalar[i] = Get3dNoiseUint(indexX[i], indexY[i], indexZ[i], m_options.seed);
+        }
+        FinishStage(report, scalarStage, count);
+        const double scalarMs = scalarStage.totalMs;
+
+        BenchmarkStage& batchStage = report.BeginStage("noise-raw3d-batch");
+        Get3dNoiseUintBatch(indexX.data(), indexY.data(), indexZ.data(), batch.data(), count, m_options.seed);
+        FinishStage(report, batchStage, count, scalarMs, CountMismatches(scalar, batch));
+    }
+
+    void NoiseBenchmark::RunPerlin2d(BenchmarkReport& report)
+    {
+        const size_t       count = m_options.sampleCount;
+        std::vector<float> scalar(count), batch(count);
+
+        BenchmarkStage& scalarStage = report.BeginStage("noise-perlin2d");
+        for (size_t i = 0; i < count; ++i)
+        {
+            scalar[i] = Compute2dPerlinNoise(m_posX[i], m_posY[i], kScale2d, kOctaves2d, 0.5f, 2.f, true, m_options.seed);
+        }
+        FinishStage(report, scalarStage, count);
+        const double scalarMs = scalarStage.totalMs;
+
+        BenchmarkStage& batchStage = report.BeginStage("noise-perlin2d-batch");
+        Compute2dPerlinNoiseBatch(m_posX.data(), m_posY.data(), batch.data(), count, kScale2d, kOctaves2d, 0.5f, 2.f, true, m_options.seed);
+        FinishStage(report, batchStage, count, scalarMs, CountMismatches(scalar, batch));
+    }
+
+    void NoiseBenchmark::RunPerlin2dGrid(BenchmarkReport& report)
+    {
+        // Whole chunks of columns along a row of chunks, as BenchmarkTerrainGenerator samples them
+        const size_t       columnsPerChunk = static_cast<size_t>(kColumnsX) * kColumnsY;
+        const size_t       chunkCount      = (m_options.sampleCount + columnsPerChunk - 1) / columnsPerChunk;
+        const size_t       count           = chunkCount * columnsPerChunk;
+        std::vector<float> scalar(count), batch(count);
+
+        BenchmarkStage& scalarStage = report.BeginStage("noise-perlin2d-grid");
+        for (size_t chunk = 0; chunk < chunkCount; ++chunk)
+        {
+            const int baseX = static_cast<int>(chunk) * kColumnsX;
+            for (int y = 0; y < kColumnsY; ++y)
+            {
+                for (int x = 0; x < kColumnsX; ++x)
+                {
+                    scalar[chunk * columnsPerChunk + static_cast<size_t>(y) * kColumnsX + x] =
+                        Compute2dPerlinNoise(static_cast<float>(baseX + x), static_cast<float>(y), kScale2d, kOctaves2d, 0.5f, 2.f, true, m_options.seed);
+                }
+            }
+        }
+        FinishStage(report, scalarStage, count);
+        const double scalarMs = scalarStage.totalMs;
+
+        BenchmarkStage& batchStage = report.BeginStage("noise-perlin2d-grid-batch");
+        for (size_t chunk = 0; chunk < chunkCount; ++chunk)
+        {
+            Compute2dPerlinNoiseGrid(static_cast<float>(static_cast<int>(chunk) * kColumnsX), 0.f, 1.f, 1.f, kColumnsX, kColumnsY, batch.data() + chunk * columnsPerChunk,
+                                     kScale2d, kOctaves2d, 0.5f, 2.f, true, m_options.seed);
+        }
+        FinishStage(report, batchStage, count, scalarMs, CountMismatches(scalar, batch));
+    }
+
+    void NoiseBenchmark::RunPerlin3d(BenchmarkReport& report)
+    {
+        const size_t       count = m_options.sampleCount;
+        std::vector<float> scalar(count), batch(count);
+
+        BenchmarkStage& scalarStage = report.BeginStage("noise-perlin3d");
+        for (size_t i = 0; i < count; ++i)
+        {
+            scalar[i] = Compute3dPerlinNoise(m_posX[i], m_posY[i], m_posZ[i], kScale3d, kOctaves3d, 0.5f, 2.f, true, m_options.seed);
+        }
+        FinishStage(report, scalarStage, count);
+        const double scalarMs = scalarStage.totalMs;
+
+        BenchmarkStage& batchStage = report.BeginStage("noise-perlin3d-batch");
+        Compute3dPerlinNoiseBatch(m_posX.data(), m_posY.data(), m_posZ.data(), batch.data(), count, kScale3d, kOctaves3d, 0.5f, 2.f, true, m_options.seed);
+        FinishStage(report, batchStage, count, scalarMs, CountMismatches(scalar, batch));
+    }
+
+    void NoiseBenchmark::FinishStage(BenchmarkReport& report, BenchmarkStage& stage, size_t samples, double scalarMs, size_t mismatches)
+    {
+        report.EndStage(stage, samples);
+        stage.SetMetric("nsPerSample", samples > 0 ? stage.totalMs * 1.0e6 / static_cast<double>(samples) : 0.0);
+        if (scalarMs > 0.0)
+        {
+            stage.SetMetric("speedup", stage.totalMs > 0.0 ? scalarMs / stage.totalMs : 0.0);
+            stage.SetMetric("mismatches", static_cast<double>(mismatches));
+        }
+    }
+}
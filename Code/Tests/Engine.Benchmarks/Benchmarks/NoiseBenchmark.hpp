@@ -0,0 +1,48 @@
+#pragma once
+
+#include "BenchmarkReport.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace enigma::benchmark
+{
+    struct NoiseBenchmarkOptions
+    {
+        size_t   sampleCount = 1u << 20; // Points per stage
+        uint32_t seed        = 1337;
+    };
+
+    /// Scalar vs batched noise microbenchmarks (Engine/Math/NoiseBatch.hpp), no engine needed
+    ///
+    /// Each pair of stages evaluates the same points: the scalar stage calls the per-point
+    /// function in a loop, the -batch stage makes one batched call. Every stage reports
+    /// nsPerSample; batch stages add speedup over their scalar stage and the number of
+    /// results that differ bitwise from it (mismatches, expected 0).
+    ///   noise-raw3d          - Get3dNoiseUint
+    ///   noise-perlin2d       - Compute2dPerlinNoise, 4 octaves, scattered points
+    ///   noise-perlin2d-grid  - same noise over 16x16 chunk column grids (terrain height pass)
+    ///   noise-perlin3d       - Compute3dPerlinNoise, 3 octaves, scattered points
+    class NoiseBenchmark
+    {
+    public:
+        explicit NoiseBenchmark(const NoiseBenchmarkOptions& options);
+
+        void Run(BenchmarkReport& report);
+
+    private:
+        void RunRaw3d(BenchmarkReport& report);
+        void RunPerlin2d(BenchmarkReport& report);
+        void RunPerlin2dGrid(BenchmarkReport& report);
+        void RunPerlin3d(BenchmarkReport& report);
+
+        /// End the stage and set nsPerSample; pass the scalar stage's time to add comparison metrics
+        void FinishStage(BenchmarkReport& report, BenchmarkStage& stage, size_t samples, double scalarMs = 0.0, size_t mismatches = 0);
+
+        NoiseBenchmarkOptions m_options;
+        std::vector<float>    m_posX;
+        std::vector<float>    m_posY;
+        std::vector<float>    m_posZ;
+    };
+}
@@ -0,0 +1,100 @@
+#include "ObjParserBenchmark.hpp"
+
+#include "Engine/Resource/Loader/ModelLoader/ObjParser.hpp"
+
+#include <cstdio>
+
+namespace enigma::benchmark
+{
+    namespace
+    {
+        /// Grid of (cells+1)^2 vertices with two triangles per cell, one shared normal
+        std::string MakeGridObj(int cells)
+        {
+            const int   side = cells + 1;
+            std::string text;
+            text.reserve(static_cast<size_t>(side) * side * 90 + static_cast<size_t>(cells) * cells * 80);
+            text += "# synthetic grid\n";
+
+            char line[128];
+            for (int y = 0; y < side; ++y)
+            {
+                for (int x = 0; x < side; ++x)
+                {
+                    std::snprintf(line, sizeof(line), "v %.4f %.4f 0.0\nvt %.4f %.4f\n", x * 0.25f, y * 0.25f,
+                                  static_cast<float>(x) / cells, static_cast<float>(y) / cells);
+                    text += line;
+                }
+            }
+            text += "vn 0 0 1\n";
+
+            for (int y = 0; y < cells; ++y)
+            {
+                for (int x = 0; x < cells; ++x)
+                {
+                    const int a = y * side + x + 1;
+                    const int b = a + 1;
+                    const int c = a + side;
+                    const int d = c + 1;
+                    std::snprintf(line, sizeof(line), "f %d/%d/1 %d/%d/1 %d/%d/1\nf %d/%d/1 %d/%d/1 %d/%d/1\n",
+                                  a, a, b, b, d, d, a, a, d, d, c, c);
+                    text += line;
+                }
+            }
+            return text;
+        }
+
+        size_t CountMismatches(const ObjParseResult& expected, const ObjParseResult& actual)
+        {
+            if (expected.corners.size() != actual.corners.size())
+            {
+                return expected.corners.size() > actual.corners.size() ? expected.corners.size() : actual.corners.size();
+            }
+            size_t mismatches = 0;
+            for (size_t i = 0; i < expected.corners.size(); ++i)
+            {
+                const ObjCorner& lhs = expected.corners[i];
+                const ObjCorner& rhs = actual.corners[i];
+                mismatches += lhs.posIndex != rhs.posIndex || lhs.uvIndex != rhs.uvIndex || lhs.normalIndex != rhs.normalIndex ? 1 : 0;
+            }
+            return mismatches;
+        }
+
+        void SetParseMetrics(BenchmarkStage& stage, const ObjParseResult& result)
+        {
+            stage.SetMetric("megabytes", static_cast<double>(result.stats.bytes) / (1024.0 * 1024.0));
+            stage.SetMetric("mbPerSecond", result.stats.GetThroughputMBps());
+            stage.SetMetric("chunks", static_cast<double>(result.stats.chunks));
+        }
+    }
+
+    ObjParserBenchmark::ObjParserBenchmark(const ObjParserBenchmarkOptions& options)
+        : m_options(options)
+    {
+        if (m_options.gridCells > 0)
+        {
+            m_text = MakeGridObj(m_options.gridCells);
+        }
+    }
+
+    void ObjParserBenchmark::Run(BenchmarkReport& report)
+    {
+        if (m_text.empty())
+        {
+            return;
+        }
+
+        BenchmarkStage&      serialStage = report.BeginStage("obj-parse");
+        const ObjParseResult serial      = ObjParser::Parse(m_text.data(), m_text.size(), 1);
+        report.EndStage(serialStage, serial.stats.triangles);
+        SetParseMetrics(serialStage, serial);
+        const double serialMs = serialStage.totalMs;
+
+        BenchmarkStage&      chunkedStage = report.BeginStage("obj-parse-chunked");
+        const ObjParseResult chunked      = ObjParser::Parse(m_text.data(), m_text.size(), m_options.threadCount);
+        report.EndStage(chunkedStage, chunked.stats.triangles);
+        SetParseMetrics(chunkedStage, chunked);
+        chunkedStage.SetMetric("speedup", chunkedStage.totalMs > 0.0 ? serialMs / chunkedStage.totalMs : 0.0);
+        chunkedStage.SetMetric("mismatches", static_cast<double>(CountMismatches(serial, chunked)));
+    }
+}
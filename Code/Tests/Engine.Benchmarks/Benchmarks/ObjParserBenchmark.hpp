@@ -0,0 +1,33 @@
+#pragma once
+
+#include "BenchmarkReport.hpp"
+
+#include <string>
+
+namespace enigma::benchmark
+{
+    struct ObjParserBenchmarkOptions
+    {
+        int          gridCells   = 710; // Grid edge in quads; 710 gives ~1M triangles and ~66 MB of OBJ text
+        unsigned int threadCount = 0;   // Chunked stage threads, 0 uses every hardware thread
+    };
+
+    /// ObjParser throughput on a synthetic triangle grid held in memory, no engine needed
+    ///
+    /// Both stages parse the same text. Each reports megabytes, mbPerSecond and the chunk count;
+    /// the chunked stage adds speedup over the single-threaded stage and the number of corners
+    /// whose indices differ from it (mismatches, expected 0).
+    ///   obj-parse          - ObjParser::Parse on one thread
+    ///   obj-parse-chunked  - ObjParser::Parse split into chunks on the parser's worker pool
+    class ObjParserBenchmark
+    {
+    public:
+        explicit ObjParserBenchmark(const ObjParserBenchmarkOptions& options);
+
+        void Run(BenchmarkReport& report);
+
+    private:
+        ObjParserBenchmarkOptions m_options;
+        std::string               m_text;
+    };
+}
@@ -0,0 +1,120 @@
+#include "SubsystemStartupBenchmark.hpp"
+
+#include "Engine/Core/SubsystemManager.hpp"
+
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <thread>
+
+using namespace enigma::core;
+
+namespace enigma::benchmark
+{
+    namespace
+    {
+        /// Subsystem whose Startup() only sleeps, standing in for file scans and loader setup
+        class DelayedSubsystem : public EngineSubsystem
+        {
+        public:
+            DelayedSubsystem(std::string name, int priority, bool offMainThread, std::chrono::milliseconds delay)
+                : m_name(std::move(name))
+                  , m_priority(priority)
+                  , m_offMainThread(offMainThread)
+                  , m_delay(delay)
+            {
+            }
+
+            void Startup() override { std::this_thread::sleep_for(m_delay); }
+
+            void Shutdown() override
+            {
+            }
+
+            const char* GetSubsystemName() const override { return m_name.c_str(); }
+            int         GetPriority() const override { return m_priority; }
+            bool        CanStartOffMainThread() const override { return m_offMainThread; }
+
+        private:
+            std::string               m_name;
+            int                       m_priority;
+            bool                      m_offMainThread;
+            std::chrono::milliseconds m_delay;
+        };
+
+        void WriteFile(const std::filesystem::path& path, const std::string& contents)
+        {
+            std::ofstream file(path, std::ios::trunc);
+            file << contents;
+        }
+
+        /// models depends on assets, ui on models; everything else is ordered by priority
+        void LoadDependencyGraph(SubsystemManager& manager)
+        {
+            const std::filesystem::path directory  = std::filesystem::temp_directory_path();
+            const std::filesystem::path configPath = directory / "enigma_benchmark_startup_config.yml";
+            const std::filesystem::path modulePath = directory / "enigma_benchmark_startup_module.yml";
+            WriteFile(configPath, "engine:\n  modules:\n    - benchmark\n");
+            WriteFile(modulePath,
+                      "moduleConfig:\n"
+                      "  models:\n"
+                      "    dependencies:\n"
+                      "      - assets\n"
+                      "  ui:\n"
+                      "    dependencies:\n"
+                      "      - models\n");
+            manager.LoadConfiguration(configPath.string(), modulePath.string());
+            std::filesystem::remove(configPath);
+            std::filesystem::remove(modulePath);
+        }
+
+        void RegisterDelayedSubsystems(SubsystemManager& manager, std::chrono::milliseconds delay)
+        {
+            manager.RegisterSubsystem(std::make_unique<DelayedSubsystem>("core", 10, false, delay));
+            manager.RegisterSubsystem(std::make_unique<DelayedSubsystem>("assets", 100, true, delay));
+            manager.RegisterSubsystem(std::make_unique<DelayedSubsystem>("sounds", 100, true, delay));
+            manager.RegisterSubsystem(std::make_unique<DelayedSubsystem>("shaders", 100, true, delay));
+            manager.RegisterSubsystem(std::make_unique<DelayedSubsystem>("models", 100, true, delay));
+            manager.RegisterSubsystem(std::make_unique<DelayedSubsystem>("ui", 200, false, delay));
+        }
+
+        /// One timed StartupAllSubsystems call on a fresh manager
+        BenchmarkStage& RunStartupStage(BenchmarkReport& report, const char* stageName, bool parallel, std::chrono::milliseconds delay)
+        {
+            SubsystemManager manager;
+            LoadDependencyGraph(manager);
+            RegisterDelayedSubsystems(manager, delay);
+            manager.SetParallelStartupEnabled(parallel);
+            manager.InitializeAllSubsystems();
+
+            BenchmarkStage& stage = report.BeginStage(stageName);
+            manager.StartupAllSubsystems();
+            const SubsystemStartupReport& startup = manager.GetStartupReport();
+            report.EndStage(stage, startup.subsystems.size());
+            stage.SetMetric("summedMs", startup.summedMs);
+            stage.SetMetric("workerThreads", static_cast<double>(startup.workerThreads));
+            return stage;
+        }
+    }
+
+    SubsystemStartupBenchmark::SubsystemStartupBenchmark(const SubsystemStartupBenchmarkOptions& options)
+        : m_options(options)
+    {
+    }
+
+    void SubsystemStartupBenchmark::Run(BenchmarkReport& report)
+    {
+        if (m_options.delayMs <= 0)
+        {
+            return;
+        }
+
+        const std::chrono::milliseconds delay(m_options.delayMs);
+        const double                    serialMs = RunStartupStage(report, "subsystem-startup-serial", false, delay).totalMs;
+
+        BenchmarkStage& parallelStage = RunStartupStage(report, "subsystem-startup-parallel", true, delay);
+        parallelStage.SetMetric("speedup", parallelStage.totalMs > 0.0 ? serialMs / parallelStage.totalMs : 0.0);
+    }
+}
@@ -0,0 +1,31 @@
+#pragma once
+
+#include "BenchmarkReport.hpp"
+
+namespace enigma::benchmark
+{
+    struct SubsystemStartupBenchmarkOptions
+    {
+        int delayMs = 30; // Sleep in each stand-in subsystem's Startup(), 0 skips the benchmark
+    };
+
+    /// SubsystemManager cold start, serial vs parallel, on six stand-in subsystems whose Startup()
+    /// only sleeps; the managers are standalone, so no engine subsystem is touched
+    ///
+    /// Graph: core (main) -> {assets, sounds, shaders} (workers) -> models (worker) -> ui (main),
+    /// six delays serially and four deep in parallel. Both stages time StartupAllSubsystems and
+    /// report summedMs (sum of Startup() durations) and workerThreads; the parallel stage adds
+    /// speedup over the serial stage.
+    ///   subsystem-startup-serial    - SetParallelStartupEnabled(false)
+    ///   subsystem-startup-parallel  - default parallel startup
+    class SubsystemStartupBenchmark
+    {
+    public:
+        explicit SubsystemStartupBenchmark(const SubsystemStartupBenchmarkOptions& options);
+
+        void Run(BenchmarkReport& report);
+
+    private:
+        SubsystemStartupBenchmarkOptions m_options;
+    };
+}
@@ -0,0 +1,631 @@
+#include "WorldBenchmark.hpp"
+
+#include "Engine/Core/EngineCommon.hpp"
+#include "Engine/Core/MappedFile.hpp"
+#include "Engine/Core/Schedule/ScheduleSubsystem.hpp"
+#include "Engine/Math/Vec3.hpp"
+#include "Engine/Registry/Block/Block.hpp"
+#include "Engine/Registry/Block/BlockRegistry.hpp"
+#include "Engine/Voxel/Chunk/Chunk.hpp"
+#include "Engine/Voxel/Chunk/ChunkHelper.hpp"
+#include "Engine/Voxel/Chunk/ChunkMeshBuilder.hpp"
+#include "Engine/Voxel/Chunk/ESFSChunkSerializer.hpp"
+#include "Engine/Voxel/Chunk/ESFSFile.hpp"
+#include "Engine/Voxel/Chunk/GenerateChunkJob.hpp"
+#include "Engine/Voxel/Chunk/MeshBuild/BlockStateQuadTable.hpp"
+#include "Engine/Voxel/Chunk/MeshBuild/ChunkMeshBuildInputFactory.hpp"
+#include "Engine/Voxel/Chunk/MeshBuild/ChunkMeshingMaterializer.hpp"
+#include "Engine/Voxel/Light/VoxelLightEngine.hpp"
+#include "Engine/Voxel/World/ChunkWriteBehindQueue.hpp"
+#include "Engine/Voxel/World/ESFSWorldStorage.hpp"
+#include "Engine/Voxel/World/World.hpp"
+
+#include <chrono>
+#include <filesystem>
+#include <random>
+#include <thread>
+#include <unordered_set>
+
+namespace enigma::benchmark
+{
+    using namespace enigma::voxel;
+
+    namespace
+    {
+        using Clock = std::chrono::steady_clock;
+
+        double MicrosecondsSince(Clock::time_point start)
+        {
+            return std::chrono::duration<double, std::micro>(Clock::now() - start).count();
+        }
+
+        std::vector<IntVec2> SquareAround(int radius)
+        {
+            std::vector<IntVec2> coords;
+            coords.reserve(static_cast<size_t>((2 * radius + 1) * (2 * radius + 1)));
+            for (int y = -radius; y <= radius; ++y)
+            {
+                for (int x = -radius; x <= radius; ++x)
+                {
+                    coords.emplace_back(x, y);
+                }
+            }
+            return coords;
+        }
+
+        uint64_t DirectorySizeBytes(const std::filesystem::path& directory)
+        {
+            std::error_code ec;
+            uint64_t        total = 0;
+            for (auto it = std::filesystem::recursive_directory_iterator(directory, ec); !ec && it != std::filesystem::recursive_directory_iterator(); it.increment(ec))
+            {
+                if (it->is_regular_file(ec))
+                {
+                    total += it->file_size(ec);
+                }
+            }
+            return total;
+        }
+    }
+
+    WorldBenchmark::WorldBenchmark(const WorldBenchmarkOptions& options)
+        : m_options(options)
+    {
+        // Default World: no storage, no atlas lookup, no generator. The benchmark only uses
+        // it as the chunk container, light engine and ChunkPool owner.
+        m_world     = std::make_unique<World>();
+        m_generator = std::make_unique<BenchmarkTerrainGenerator>(options.blockNamespace);
+        m_generator->Initialize(options.seed);
+
+        // ChunkMeshBuilder resolves air from the same namespace
+        auto airBlock = registry::block::BlockRegistry::GetBlock(options.blockNamespace, "air");
+        m_air         = airBlock ? airBlock->GetDefaultState() : nullptr;
+    }
+
+    WorldBenchmark::~WorldBenchmark() = default;
+
+    bool WorldBenchmark::Run(BenchmarkReport& report)
+    {
+        if (!m_air || !m_generator->ResolveBlocks())
+        {
+            std::fprintf(stderr, "Namespace '%s' must register at least 'air' and 'stone'\n", m_options.blockNamespace.c_str());
+            return false;
+        }
+
+        if (!RunGenerate(report))
+        {
+            return false;
+        }
+        RunLight(report);
+        RunMesh(report);
+        const bool storageOk = RunSaveLoad(report);
+        RunEdits(report);
+        RunBulkEdits(report);
+        RunFly(report);
+        return storageOk;
+    }
+
+    //-------------------------------------------------------------------------------------------
+    // Stages
+    //-------------------------------------------------------------------------------------------
+
+    bool WorldBenchmark::RunGenerate(BenchmarkReport& report)
+    {
+        const std::vector<IntVec2> coords = SquareAround(m_options.radius);
+
+        BenchmarkStage& stage     = report.BeginStage("generate");
+        const size_t    generated = GenerateChunks(coords);
+        report.EndStage(stage, generated);
+
+        stage.SetMetric("chunks", static_cast<double>(coords.size()));
+        stage.SetMetric("chunksPerSecond", stage.totalMs > 0.0 ? static_cast<double>(generated) * 1000.0 / stage.totalMs : 0.0);
+        stage.SetMetric("poolHits", static_cast<double>(m_world->GetChunkPool().GetStats().hitCount));
+        return generated == coords.size();
+    }
+
+    void WorldBenchmark::RunLight(BenchmarkReport& report)
+    {
+        const std::vector<IntVec2> coords = SquareAround(m_options.radius);
+
+        BenchmarkStage& stage = report.BeginStage("light");
+        ActivateChunks(coords);
+        report.EndStage(stage, coords.size());
+    }
+
+    void WorldBenchmark::RunMesh(BenchmarkReport& report)
+    {
+        const MeshPassTotals baked = RunMeshPass(report, "mesh", nullptr);
+
+        // Baseline second, so a warm buffer pool and cache favor it rather than the baked path
+        const std::shared_ptr<const BlockStateQuadTable> quadTable = BlockStateQuadTable::GetCurrent();
+        if (quadTable)
+        {
+            BlockStateQuadTable::Publish(nullptr);
+            RunMeshPass(report, "mesh-per-face", &baked);
+            BlockStateQuadTable::Publish(quadTable);
+        }
+    }
+
+    WorldBenchmark::MeshPassTotals WorldBenchmark::RunMeshPass(BenchmarkReport& report, const std::string& stageName, const MeshPassTotals* baseline)
+    {
+        m_world->GetChunkMeshBufferPool().ResetStats();
+        const std::shared_ptr<const BlockStateQuadTable> quadTable = BlockStateQuadTable::GetCurrent();
+        BenchmarkStage&                                  stage     = report.BeginStage(stageName);
+
+        uint64_t meshed        = 0;
+        uint64_t skipped       = 0;
+        uint64_t totalVertices = 0;
+        double   materializeUs = 0.0;
+        double   buildUs       = 0.0;
+        for (auto& [packed, chunk] : m_world->GetLoadedChunks())
+        {
+            UNUSED(packed)
+            uint64_t vertexCount  = 0;
+            double   snapshotTime = 0.0;
+            double   buildTime    = 0.0;
+            if (MeshChunk(chunk.get(), vertexCount, &snapshotTime, &buildTime))
+            {
+                ++meshed;
+                totalVertices += vertexCount;
+                materializeUs += snapshotTime;
+                buildUs += buildTime;
+                stage.AddSample(snapshotTime + buildTime);
+            }
+            else
+            {
+                ++skipped; // Border chunks without all horizontal neighbors
+            }
+        }
+        report.EndStage(stage, meshed);
+
+        stage.SetMetric("skipped", static_cast<double>(skipped));
+        stage.SetMetric("vertices", static_cast<double>(totalVertices));
+        stage.SetMetric("materializeMs", materializeUs / 1000.0);
+        stage.SetMetric("buildMs", buildUs / 1000.0);
+
+        const ChunkMeshBufferPoolStats meshPoolStats = m_world->GetChunkMeshBufferPool().GetStats();
+        stage.SetMetric("meshAllocations", static_cast<double>(meshPoolStats.allocationCount));
+        stage.SetMetric("meshPoolHitRate", meshPoolStats.GetHitRate());
+        stage.SetMetric("meshBuildP99Us", static_cast<double>(meshPoolStats.buildP99Us));
+        stage.SetMetric("chunksPerSecond", buildUs > 0.0 ? static_cast<double>(meshed) * 1e6 / buildUs : 0.0);
+        if (quadTable)
+        {
+            stage.SetMetric("quadTableStates", static_cast<double>(quadTable->GetStateCount()));
+            stage.SetMetric("quadTableBytes", static_cast<double>(quadTable->GetMemoryBytes()));
+        }
+        if (baseline)
+        {
+            // Both paths must produce the same geometry; buildMs ratio is the baked-table speedup
+            stage.SetMetric("bakedSpeedup", baseline->buildMs > 0.0 ? (buildUs / 1000.0) / baseline->buildMs : 0.0);
+            stage.SetMetric("verticesMatchBaked", totalVertices == baseline->vertices ? 1.0 : 0.0);
+        }
+
+        MeshPassTotals totals;
+        totals.vertices = totalVertices;
+        totals.buildMs  = buildUs / 1000.0;
+        return totals;
+    }
+
+    bool WorldBenchmark::RunSaveLoad(BenchmarkReport& report)
+    {
+        std::error_code ec;
+        std::filesystem::remove_all(m_options.saveDirectory, ec);
+        std::filesystem::create_directories(m_options.saveDirectory, ec);
+
+        ChunkStorageConfig config;
+        config.saveStrategy = ChunkSaveStrategy::All;
+        ESFSChunkSerializer serializer;
+        ESFSChunkStorage    storage(m_options.saveDirectory, config, &serializer);
+
+        const std::vector<IntVec2> coords = SquareAround(m_options.radius);
+
+        BenchmarkStage& saveStage = report.BeginStage("save");
+        uint64_t        saved     = 0;
+        for (const IntVec2& coord : coords)
+        {
+            const Clock::time_point start = Clock::now();
+            if (storage.SaveChunk(coord.x, coord.y, m_world->GetChunk(coord.x, coord.y)))
+            {
+                ++saved;
+            }
+            saveStage.AddSample(MicrosecondsSince(start));
+        }
+        storage.Flush();
+        report.EndStage(saveStage, saved);
+        saveStage.SetMetric("bytesOnDisk", static_cast<double>(DirectorySizeBytes(m_options.saveDirectory)));
+        saveStage.SetMetric("savesPerSecond", saveStage.totalMs > 0.0 ? static_cast<double>(saved) * 1000.0 / saveStage.totalMs : 0.0);
+
+        // Write-behind: every chunk is unloaded (saved) several times, repeats coalesce in memory and
+        // the survivors are written in one sorted flush with atomic temp-file commits
+        constexpr int         WRITE_BEHIND_SAVE_ROUNDS = 4;
+        ChunkWriteBehindQueue writeBehind;
+        BenchmarkStage&       writeBehindStage = report.BeginStage("save-write-behind");
+        uint64_t              saveRequests     = 0;
+        for (int round = 0; round < WRITE_BEHIND_SAVE_ROUNDS; ++round)
+        {
+            for (const IntVec2& coord : coords)
+            {
+                const Clock::time_point start = Clock::now();
+                std::vector<uint8_t>    payload;
+                if (serializer.SerializeChunk(m_world->GetChunk(coord.x, coord.y), payload))
+                {
+                    writeBehind.Enqueue(coord, std::move(payload), false, 0.0);
+                    ++saveRequests;
+                }
+                writeBehindStage.AddSample(MicrosecondsSince(start));
+            }
+        }
+        const bool flushed = writeBehind.FlushAll([&storage](IntVec2 coord, const std::vector<uint8_t>& payload)
+        {
+            return storage.WriteSerializedChunk(coord.x, coord.y, payload);
+        });
+        report.EndStage(writeBehindStage, saveRequests);
+
+        const ChunkWriteBehindStats writeBehindStats = writeBehind.GetStats();
+        writeBehindStage.SetMetric("savesPerSecond", writeBehindStage.totalMs > 0.0 ? static_cast<double>(saveRequests) * 1000.0 / writeBehindStage.totalMs : 0.0);
+        writeBehindStage.SetMetric("diskWrites", static_cast<double>(writeBehindStats.written));
+        writeBehindStage.SetMetric("avoidedWrites", static_cast<double>(writeBehindStats.GetAvoidedWrites()));
+        writeBehindStage.SetMetric("diskWritesPerSecond", writeBehindStats.GetWritesPerSecond());
+        writeBehindStage.SetMetric("peakPendingBytes", static_cast<double>(writeBehindStats.peakPendingBytes));
+
+        // Verify every loaded block against the generated chunk
+        auto loadAll = [&](ESFSChunkStorage& loadStorage, const char* stageName, uint64_t evictedFiles) -> bool
+        {
+            BenchmarkStage& loadStage  = report.BeginStage(stageName);
+            uint64_t        loaded     = 0;
+            uint64_t        mismatches = 0;
+            for (const IntVec2& coord : coords)
+            {
+                // Load into a pooled chunk that is never inserted into the world
+                std::unique_ptr<Chunk> scratch = m_world->GetChunkPool().Acquire(coord, m_air);
+
+                const Clock::time_point start = Clock::now();
+                const bool              ok    = loadStorage.LoadChunk(coord.x, coord.y, scratch.get());
+                loadStage.AddSample(MicrosecondsSince(start));
+
+                const Chunk* original = m_world->GetChunk(coord.x, coord.y);
+                if (ok && original)
+                {
+                    ++loaded;
+                    for (int32_t z = 0; z < Chunk::CHUNK_SIZE_Z && mismatches == 0; ++z)
+                    {
+                        for (int32_t y = 0; y < Chunk::CHUNK_SIZE_Y; ++y)
+                        {
+                            for (int32_t x = 0; x < Chunk::CHUNK_SIZE_X; ++x)
+                            {
+                                if (scratch->GetBlock(x, y, z) != original->GetBlock(x, y, z))
+                                {
+                                    ++mismatches;
+                                }
+                            }
+                        }
+                    }
+                }
+                m_world->GetChunkPool().Release(std::move(scratch));
+            }
+            report.EndStage(loadStage, loaded);
+            loadStage.SetMetric("mismatchedChunks", static_cast<double>(mismatches));
+            loadStage.SetMetric("evictedFiles", static_cast<double>(evictedFiles));
+            return loaded == coords.size() && mismatches == 0;
+        };
+
+        // Cold: the saved files are dropped from the page cache first (best effort, see evictedFiles)
+        uint64_t evicted = 0;
+        for (const IntVec2& coord : coords)
+        {
+            if (core::MappedFile::EvictFromPageCache(ESFSFile::GetChunkFilePath(m_options.saveDirectory, coord.x, coord.y)))
+            {
+                ++evicted;
+            }
+        }
+        bool loadedAll = loadAll(storage, "load-cold", evicted);
+
+        // Warm: the cold pass left every file in the page cache
+        loadedAll = loadAll(storage, "load-warm", 0) && loadedAll;
+
+        // Buffered: the pre-mapping read-into-vector path on the same warm cache, for comparison
+        ChunkStorageConfig bufferedConfig = config;
+        bufferedConfig.memoryMappedLoad   = false;
+        ESFSChunkStorage bufferedStorage(m_options.saveDirectory, bufferedConfig, &serializer);
+        loadedAll = loadAll(bufferedStorage, "load-buffered", 0) && loadedAll;
+
+        storage.Close();
+        std::filesystem::remove_all(m_options.saveDirectory, ec);
+        return saved == coords.size() && flushed && loadedAll;
+    }
+
+    void WorldBenchmark::RunEdits(BenchmarkReport& report)
+    {
+        // Stay one chunk inside the generated square so every edit is meshable
+        const int interior = (std::max)(m_options.radius - 1, 0);
+
+        std::mt19937                       rng(m_options.seed);
+        std::uniform_int_distribution<int> chunkDist(-interior, interior);
+        std::uniform_int_distribution<int> localDist(0, Chunk::CHUNK_SIZE_X - 1);
+        std::uniform_int_distribution<int> depthDist(-3, 3);
+
+        BenchmarkStage& stage          = report.BeginStage("edit");
+        uint64_t        lightProcessed = 0;
+        uint64_t        applied        = 0;
+        for (int i = 0; i < m_options.editCount; ++i)
+        {
+            const IntVec2 chunkCoords(chunkDist(rng), chunkDist(rng));
+            Chunk*        chunk = m_world->GetChunk(chunkCoords.x, chunkCoords.y);
+            if (!chunk)
+            {
+                continue;
+            }
+
+            const int32_t x       = localDist(rng);
+            const int32_t y       = localDist(rng);
+            const int32_t groundZ = m_generator->GetGroundHeightAt(Chunk::ChunkCoordsToWorld(chunkCoords.x) + x, Chunk::ChunkCoordsToWorld(chunkCoords.y) + y);
+            const int32_t z       = std::clamp(groundZ + depthDist(rng), 1, Chunk::CHUNK_MAX_Z - 1);
+
+            // Alternate digging and placing; every eighth placement is emissive
+            BlockState* current     = chunk->GetBlock(x, y, z);
+            BlockState* replacement = current == m_air ? ((i & 7) == 0 ? m_generator->GetEmissive() : m_generator->GetStone()) : m_air;
+
+            const Clock::time_point start = Clock::now();
+            chunk->SetBlockByPlayer(x, y, z, replacement);
+            lightProcessed += static_cast<uint64_t>(m_world->GetVoxelLightEngine().RunLightUpdates());
+            uint64_t vertexCount = 0;
+            MeshChunk(chunk, vertexCount);
+            stage.AddSample(MicrosecondsSince(start));
+            ++applied;
+        }
+        report.EndStage(stage, applied);
+        stage.SetMetric("lightBlocksProcessed", static_cast<double>(lightProcessed));
+    }
+
+    void WorldBenchmark::RunBulkEdits(BenchmarkReport& report)
+    {
+        // Two boxes side by side at ground level, inside the chunks every edit can remesh
+        const int32_t size = (std::min)(m_options.bulkEditSize, (std::max)(m_options.radius - 1, 0) * Chunk::CHUNK_SIZE_X);
+        if (size <= 0)
+        {
+            return;
+        }
+
+        const int32_t minZ    = std::clamp(m_generator->GetGroundHeightAt(0, 0) - size / 2, 1, Chunk::CHUNK_MAX_Z - size);
+        const int32_t minY    = -size / 2;
+        BlockState*   stone   = m_generator->GetStone();
+        const auto&   patches = m_world->GetChunkMeshPatchDiagnostics();
+
+        const uint64_t  requestsBefore = patches.requested;
+        BlockPos        position;
+        BenchmarkStage& perBlockStage  = report.BeginStage("edit-box");
+        for (position.z = minZ; position.z < minZ + size; ++position.z)
+        {
+            for (position.y = minY; position.y < minY + size; ++position.y)
+            {
+                for (position.x = -size; position.x < 0; ++position.x)
+                {
+                    m_world->SetBlockState(position, stone);
+                }
+            }
+        }
+        const uint64_t perBlockLight = static_cast<uint64_t>(m_world->GetVoxelLightEngine().RunLightUpdates());
+        const uint64_t blockCount    = static_cast<uint64_t>(size) * size * size;
+        report.EndStage(perBlockStage, blockCount);
+        perBlockStage.SetMetric("blocksPerSecond", perBlockStage.totalMs > 0.0 ? static_cast<double>(blockCount) * 1000.0 / perBlockStage.totalMs : 0.0);
+        perBlockStage.SetMetric("lightBlocksProcessed", static_cast<double>(perBlockLight));
+        perBlockStage.SetMetric("meshUpdateRequests", static_cast<double>(patches.requested - requestsBefore));
+        const double perBlockMs = perBlockStage.totalMs;
+
+        BenchmarkStage& bulkStage = report.BeginStage("edit-bulk");
+        m_world->BeginBulkEdit();
+        m_world->SetBlocks(BlockPos(0, minY, minZ), BlockPos(size - 1, minY + size - 1, minZ + size - 1), stone);
+        const BulkBlockEditStats stats = m_world->CommitBulkEdit();
+        report.EndStage(bulkStage, stats.blocksWritten);
+        bulkStage.SetMetric("blocksPerSecond", bulkStage.totalMs > 0.0 ? static_cast<double>(stats.blocksWritten) * 1000.0 / bulkStage.totalMs : 0.0);
+        bulkStage.SetMetric("lightBlocksProcessed", static_cast<double>(stats.lightBlocksProcessed));
+        bulkStage.SetMetric("lightResolvedDirect", static_cast<double>(stats.lightResolvedDirect));
+        bulkStage.SetMetric("meshUpdateRequests", static_cast<double>(stats.meshUpdatesRequested + stats.neighborMeshUpdates));
+        bulkStage.SetMetric("chunksTouched", static_cast<double>(stats.chunksTouched));
+        bulkStage.SetMetric("speedup", bulkStage.totalMs > 0.0 ? perBlockMs / bulkStage.totalMs : 0.0);
+    }
+
+    void WorldBenchmark::RunFly(BenchmarkReport& report)
+    {
+        m_world->SetChunkActivationRange(m_options.flyRange);
+
+        BenchmarkStage& stage     = report.BeginStage("fly");
+        uint64_t        generated = 0;
+        uint64_t        released  = 0;
+        uint64_t        meshed    = 0;
+        Vec3            position(8.f, 8.f, 120.f);
+        for (int step = 0; step < m_options.flySteps; ++step)
+        {
+            const Clock::time_point start = Clock::now();
+
+            // Diagonal path so both axes stream new chunk rows
+            position.x += m_options.flySpeed;
+            position.y += m_options.flySpeed * 0.5f;
+            m_world->SetPlayerPosition(position);
+
+            std::vector<IntVec2>        missing;
+            std::unordered_set<int64_t> needed;
+            for (const auto& [chunkX, chunkY] : m_world->CalculateNeededChunks())
+            {
+                needed.insert(ChunkHelper::PackCoordinates(chunkX, chunkY));
+                if (!m_world->GetChunk(chunkX, chunkY))
+                {
+                    missing.emplace_back(chunkX, chunkY);
+                }
+            }
+
+            std::vector<IntVec2> distant;
+            for (const auto& [packed, chunk] : m_world->GetLoadedChunks())
+            {
+                if (needed.find(packed) == needed.end())
+                {
+                    distant.push_back(chunk->GetChunkCoords());
+                }
+            }
+            for (const IntVec2& coords : distant)
+            {
+                ReleaseChunk(coords);
+            }
+            released += distant.size();
+
+            if (!missing.empty())
+            {
+                generated += GenerateChunks(missing);
+                ActivateChunks(missing);
+
+                // New chunks complete their neighbors too, so remesh the new ring and whatever borders it
+                std::unordered_set<int64_t> remesh;
+                for (const IntVec2& coords : missing)
+                {
+                    for (int dy = -1; dy <= 1; ++dy)
+                    {
+                        for (int dx = -1; dx <= 1; ++dx)
+                        {
+                            if (dx != 0 && dy != 0)
+                            {
+                                continue;
+                            }
+                            remesh.insert(ChunkHelper::PackCoordinates(coords.x + dx, coords.y + dy));
+                        }
+                    }
+                }
+                for (int64_t packed : remesh)
+                {
+                    auto it = m_world->GetLoadedChunks().find(packed);
+                    if (it == m_world->GetLoadedChunks().end())
+                    {
+                        continue;
+                    }
+                    uint64_t vertexCount = 0;
+                    if (MeshChunk(it->second.get(), vertexCount))
+                    {
+                        ++meshed;
+                    }
+                }
+            }
+            stage.AddSample(MicrosecondsSince(start));
+        }
+        report.EndStage(stage, static_cast<uint64_t>(m_options.flySteps));
+
+        stage.SetMetric("chunksGenerated", static_cast<double>(generated));
+        stage.SetMetric("chunksReleased", static_cast<double>(released));
+        stage.SetMetric("chunksMeshed", static_cast<double>(meshed));
+        stage.SetMetric("poolHits", static_cast<double>(m_world->GetChunkPool().GetStats().hitCount));
+        stage.SetMetric("loadedChunks", static_cast<double>(m_world->GetLoadedChunks().size()));
+    }
+
+    //-------------------------------------------------------------------------------------------
+    // Helpers
+    //-------------------------------------------------------------------------------------------
+
+    size_t WorldBenchmark::GenerateChunks(const std::vector<IntVec2>& coords)
+    {
+        // Insert every chunk before submitting: workers look chunks up through World::GetChunk
+        // and the map must not rehash while they run
+        auto& loadedChunks = m_world->GetLoadedChunks();
+        for (const IntVec2& coord : coords)
+        {
+            std::unique_ptr<Chunk> chunk = m_world->GetChunkPool().Acquire(coord, m_air);
+            chunk->SetWorld(m_world.get());
+            chunk->SetState(ChunkState::Generating);
+            loadedChunks[ChunkHelper::PackCoordinates(coord.x, coord.y)] = std::move(chunk);
+        }
+
+        for (const IntVec2& coord : coords)
+        {
+            g_theSchedule->SubmitTask(new GenerateChunkJob(coord, m_world.get(), m_generator.get(), m_options.seed));
+        }
+
+        size_t finished  = 0;
+        size_t completed = 0;
+        while (finished < coords.size())
+        {
+            TaskResultDrainView drainView = g_theSchedule->DrainCompletedTaskRecords();
+            if (drainView.IsEmpty())
+            {
+                std::this_thread::yield();
+                continue;
+            }
+            for (TaskCompletionRecord& record : drainView.records)
+            {
+                if (dynamic_cast<GenerateChunkJob*>(record.task) != nullptr)
+                {
+                    ++finished;
+                    completed += record.finalState == core::TaskState::Completed ? 1 : 0;
+                }
+                delete record.task;
+            }
+        }
+        return completed;
+    }
+
+    void WorldBenchmark::ActivateChunks(const std::vector<IntVec2>& coords)
+    {
+        for (const IntVec2& coord : coords)
+        {
+            Chunk* chunk = m_world->GetChunk(coord.x, coord.y);
+            if (!chunk)
+            {
+                continue;
+            }
+            chunk->InitializeLighting(m_world.get());
+            // CAS instead of SetState: no World::Update runs, so skip the mesh-readiness notification
+            chunk->TrySetState(ChunkState::Generating, ChunkState::Active);
+            chunk->SetGenerated(true);
+        }
+        m_world->GetVoxelLightEngine().RunLightUpdates();
+    }
+
+    void WorldBenchmark::ReleaseChunk(IntVec2 coords)
+    {
+        auto& loadedChunks = m_world->GetLoadedChunks();
+        auto  it           = loadedChunks.find(ChunkHelper::PackCoordinates(coords.x, coords.y));
+        if (it == loadedChunks.end())
+        {
+            return;
+        }
+        Chunk* chunk = it->second.get();
+        m_world->UndirtyAllBlocksInChunk(chunk);
+        chunk->TrySetState(chunk->GetState(), ChunkState::Inactive);
+        m_world->GetChunkPool().Release(std::move(it->second));
+        loadedChunks.erase(it);
+    }
+
+    bool WorldBenchmark::MeshChunk(Chunk* chunk, uint64_t& outVertexCount, double* outMaterializeUs, double* outBuildUs)
+    {
+        ChunkMeshBuildInput input;
+        if (!chunk || !ChunkMeshBuildInputFactory::TryCreate(*chunk, ++m_meshVersion, true, input))
+        {
+            return false;
+        }
+
+        const Clock::time_point snapshotStart = Clock::now();
+        auto                    scratch       = std::make_shared<ChunkMeshingScratch>();
+        auto                    snapshot      = std::make_shared<ChunkMeshingSnapshot>(scratch);
+        if (!ChunkMeshingMaterializer::TryMaterialize(*chunk, input.dispatchContext, *scratch, *snapshot).Succeeded())
+        {
+            return false;
+        }
+        input.snapshot = snapshot;
+        if (outMaterializeUs)
+        {
+            *outMaterializeUs = MicrosecondsSince(snapshotStart);
+        }
+
+        const Clock::time_point buildStart = Clock::now();
+        ChunkMeshBufferPool&    meshPool   = m_world->GetChunkMeshBufferPool();
+        ChunkMeshBuildResult    result     = ChunkMeshBuilder(&meshPool).Build(input);
+        if (outBuildUs)
+        {
+            *outBuildUs = MicrosecondsSince(buildStart);
+        }
+        if (result.status != ChunkMeshBuildResultStatus::Built)
+        {
+            return false;
+        }
+
+        outVertexCount = result.metrics.opaqueVertexCount + result.metrics.cutoutVertexCount + result.metrics.translucentVertexCount;
+        meshPool.Release(std::move(result.mesh)); // Meshes are not kept; the next build reuses the buffers
+        return true;
+    }
+}
@@ -0,0 +1,89 @@
+#pragma once
+
+#include "BenchmarkReport.hpp"
+#include "BenchmarkTerrainGenerator.hpp"
+
+#include "Engine/Math/IntVec2.hpp"
+
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace enigma::voxel
+{
+    class World;
+    class Chunk;
+}
+
+namespace enigma::benchmark
+{
+    struct WorldBenchmarkOptions
+    {
+        int         radius         = 8; // Square of (2r+1)^2 chunks around the origin
+        int         flySteps       = 240;
+        float       flySpeed       = 2.f; // Blocks per step
+        int         flyRange       = 8; // Chunk activation range while flying
+        int         editCount      = 2000;
+        int         bulkEditSize   = 64; // Edge of the filled boxes in the edit-box/edit-bulk stages, 0 skips them
+        uint32_t    seed           = 1337;
+        std::string blockNamespace = "simpleminer";
+        std::string saveDirectory  = ".enigma/saves/_benchmark";
+    };
+
+    /// Scripted CPU-side world scenarios with one report stage each
+    ///
+    /// World::Update is not used because region rebuilds allocate D3D12 buffers. Each stage
+    /// instead drives the same jobs and helpers the update loop would call:
+    ///   generate - GenerateChunkJob on the ChunkGen workers, chunks from World's ChunkPool
+    ///   light    - Chunk::InitializeLighting + VoxelLightEngine::RunLightUpdates
+    ///   mesh     - ChunkMeshingMaterializer snapshot + ChunkMeshBuilder::Build; mesh-per-face
+    ///              repeats it with the BlockStateQuadTable unpublished, as the baseline
+    ///   save/load- ESFSChunkStorage round trip with block-by-block verification; loads run
+    ///              mapped with a cold then warm page cache, then through the buffered path;
+    ///              save-write-behind repeats the saves through ChunkWriteBehindQueue
+    ///   edit     - random SetBlockByPlayer, light update and remesh of the touched chunk
+    ///   edit-box - fill a box block by block through World::SetBlockState, then one light update;
+    ///              edit-bulk fills a same-size box with BeginBulkEdit/SetBlocks/CommitBulkEdit
+    ///   fly      - moving player; generate/light/mesh missing chunks, recycle far ones
+    class WorldBenchmark
+    {
+    public:
+        explicit WorldBenchmark(const WorldBenchmarkOptions& options);
+        ~WorldBenchmark();
+
+        /// Run every stage in order; false if a stage could not run (report keeps partial results)
+        bool Run(BenchmarkReport& report);
+
+    private:
+        bool RunGenerate(BenchmarkReport& report);
+        void RunLight(BenchmarkReport& report);
+        void RunMesh(BenchmarkReport& report);
+        bool RunSaveLoad(BenchmarkReport& report);
+        void RunEdits(BenchmarkReport& report);
+        void RunBulkEdits(BenchmarkReport& report);
+        void RunFly(BenchmarkReport& report);
+
+        /// Insert empty chunks and generate them on the worker pool; returns chunks generated
+        size_t GenerateChunks(const std::vector<IntVec2>& coords);
+        void   ActivateChunks(const std::vector<IntVec2>& coords);
+        void   ReleaseChunk(IntVec2 coords);
+
+        struct MeshPassTotals
+        {
+            uint64_t vertices = 0;
+            double   buildMs  = 0.0;
+        };
+
+        /// Mesh every loaded chunk into one stage; baseline adds comparison metrics
+        MeshPassTotals RunMeshPass(BenchmarkReport& report, const std::string& stageName, const MeshPassTotals* baseline);
+
+        /// Snapshot + build one chunk; false when the chunk is not meshable yet (missing neighbors)
+        bool MeshChunk(voxel::Chunk* chunk, uint64_t& outVertexCount, double* outMaterializeUs = nullptr, double* outBuildUs = nullptr);
+
+        WorldBenchmarkOptions                      m_options;
+        std::unique_ptr<voxel::World>              m_world;
+        std::unique_ptr<BenchmarkTerrainGenerator> m_generator;
+        voxel::BlockState*                         m_air         = nullptr;
+        uint64_t                                   m_meshVersion = 0;
+    };
+}
@@ -0,0 +1,135 @@
+// Headless world benchmark
+//
+// Run from the engine root so the .enigma/ config, data and asset paths resolve:
+//   Engine.Benchmarks.exe --radius 8 --edits 2000 --out .enigma/logs/benchmark.json
+//
+// Prints one [ BENCH    ] line per stage to stderr and the full JSON report to stdout.
+
+#include "Benchmarks/BenchmarkReport.hpp"
+#include "Benchmarks/HeadlessEngine.hpp"
+#include "Benchmarks/NoiseBenchmark.hpp"
+#include "Benchmarks/ObjParserBenchmark.hpp"
+#include "Benchmarks/SubsystemStartupBenchmark.hpp"
+#include "Benchmarks/WorldBenchmark.hpp"
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+
+using namespace enigma::benchmark;
+
+namespace
+{
+    void PrintUsage()
+    {
+        std::fprintf(stderr,
+                     "Usage: Engine.Benchmarks [options]\n"
+                     "  --radius N        generated square radius in chunks (default 8)\n"
+                     "  --fly-steps N     fly path steps (default 240)\n"
+                     "  --fly-speed F     blocks per fly step (default 2)\n"
+                     "  --fly-range N     activation range while flying (default 8)\n"
+                     "  --edits N         random block edits (default 2000)\n"
+                     "  --bulk-size N     edge of the edit-box/edit-bulk boxes, 0 skips them (default 64)\n"
+                     "  --seed N          world seed (default 1337)\n"
+                     "  --noise-samples N points per noise microbenchmark stage, 0 skips them (default 1048576)\n"
+                     "  --obj-cells N     OBJ parse benchmark grid edge in quads, 0 skips it (default 710)\n"
+                     "  --startup-delay-ms N Startup() sleep per stand-in subsystem, 0 skips the startup benchmark (default 30)\n"
+                     "  --data PATH       block data root (default .enigma/data)\n"
+                     "  --namespace NAME  block namespace (default simpleminer)\n"
+                     "  --save-dir PATH   scratch ESFS directory (default .enigma/saves/_benchmark)\n"
+                     "  --out FILE        also write the JSON report to FILE\n");
+    }
+
+    bool ParseArguments(int argc, char** argv, HeadlessEngineOptions& engineOptions, WorldBenchmarkOptions& worldOptions, NoiseBenchmarkOptions& noiseOptions,
+                        ObjParserBenchmarkOptions& objOptions, SubsystemStartupBenchmarkOptions& startupOptions, std::string& outPath)
+    {
+        for (int i = 1; i < argc; ++i)
+        {
+            const char* arg   = argv[i];
+            const char* value = i + 1 < argc ? argv[i + 1] : nullptr;
+            if (std::strcmp(arg, "--help") == 0 || std::strcmp(arg, "-h") == 0)
+            {
+                return false;
+            }
+            if (!value)
+            {
+                std::fprintf(stderr, "Missing value for %s\n", arg);
+                return false;
+            }
+
+            if (std::strcmp(arg, "--radius") == 0) worldOptions.radius = std::atoi(value);
+            else if (std::strcmp(arg, "--fly-steps") == 0) worldOptions.flySteps = std::atoi(value);
+            else if (std::strcmp(arg, "--fly-speed") == 0) worldOptions.flySpeed = static_cast<float>(std::atof(value));
+            else if (std::strcmp(arg, "--fly-range") == 0) worldOptions.flyRange = std::atoi(value);
+            else if (std::strcmp(arg, "--edits") == 0) worldOptions.editCount = std::atoi(value);
+            else if (std::strcmp(arg, "--bulk-size") == 0) worldOptions.bulkEditSize = std::atoi(value);
+            else if (std::strcmp(arg, "--seed") == 0) worldOptions.seed = noiseOptions.seed = static_cast<uint32_t>(std::strtoul(value, nullptr, 10));
+            else if (std::strcmp(arg, "--noise-samples") == 0) noiseOptions.sampleCount = static_cast<size_t>(std::strtoull(value, nullptr, 10));
+            else if (std::strcmp(arg, "--obj-cells") == 0) objOptions.gridCells = std::atoi(value);
+            else if (std::strcmp(arg, "--startup-delay-ms") == 0) startupOptions.delayMs = std::atoi(value);
+            else if (std::strcmp(arg, "--data") == 0) engineOptions.blockDataPath = value;
+            else if (std::strcmp(arg, "--namespace") == 0) engineOptions.blockNamespace = worldOptions.blockNamespace = value;
+            else if (std::strcmp(arg, "--save-dir") == 0) worldOptions.saveDirectory = value;
+            else if (std::strcmp(arg, "--out") == 0) outPath = value;
+            else
+            {
+                std::fprintf(stderr, "Unknown option %s\n", arg);
+                return false;
+            }
+            ++i;
+        }
+        return worldOptions.radius >= 1;
+    }
+}
+
+int main(int argc, char** argv)
+{
+    HeadlessEngineOptions            engineOptions;
+    WorldBenchmarkOptions            worldOptions;
+    NoiseBenchmarkOptions            noiseOptions;
+    ObjParserBenchmarkOptions        objOptions;
+    SubsystemStartupBenchmarkOptions startupOptions;
+    std::string                      outPath;
+    if (!ParseArguments(argc, argv, engineOptions, worldOptions, noiseOptions, objOptions, startupOptions, outPath))
+    {
+        PrintUsage();
+        return 2;
+    }
+
+    HeadlessEngine engine;
+    if (!engine.Startup(engineOptions))
+    {
+        return 1;
+    }
+
+    BenchmarkReport report("world", worldOptions.seed);
+    bool            succeeded = false;
+    {
+        NoiseBenchmark noiseBenchmark(noiseOptions);
+        noiseBenchmark.Run(report);
+    }
+    {
+        ObjParserBenchmark objBenchmark(objOptions);
+        objBenchmark.Run(report);
+    }
+    {
+        SubsystemStartupBenchmark startupBenchmark(startupOptions);
+        startupBenchmark.Run(report);
+    }
+    {
+        // World and its chunks must be gone before the subsystems shut down
+        WorldBenchmark benchmark(worldOptions);
+        succeeded = benchmark.Run(report);
+    }
+    engine.Shutdown();
+
+    report.PrintSummary(stderr);
+    report.WriteJson(stdout);
+    if (!outPath.empty() && !report.WriteJsonFile(outPath))
+    {
+        std::fprintf(stderr, "Failed to write %s\n", outPath.c_str());
+        return 1;
+    }
+    return succeeded ? 0 : 1;
+}
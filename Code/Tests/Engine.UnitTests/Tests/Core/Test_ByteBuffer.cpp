@@ -3,9 +3,15 @@
 #include "Engine/Core/Buffer/ByteBuffer.hpp"
 #include "Engine/Core/Buffer/BufferSerializable.hpp"
 #include "Engine/Core/Buffer/BufferExceptions.hpp"
+#include "Engine/Core/Buffer/BitStream.hpp"
+#include "Engine/Core/Buffer/ByteBufferView.hpp"
 
+#include <chrono>
 #include <cmath>
+#include <cstdio>
 #include <limits>
+#include <numeric>
+#include <vector>
 
 using namespace enigma::core;
 
@@ -408,3 +414,318 @@ TEST(OverwriteAtTests, OverwriteInt)
     EXPECT_EQ(buf.ReadInt(), 999);
     EXPECT_EQ(buf.ReadInt(), 300);
 }
+
+//=============================================================================
+// VarInt
+//=============================================================================
+
+TEST(VarIntTests, UnsignedBoundariesRoundTrip)
+{
+    const uint64_t values[] = {0, 1, 127, 128, 16383, 16384, 0xFFFFFFFFull, 0x7FFFFFFFFFFFFFFFull, 0xFFFFFFFFFFFFFFFFull};
+    ByteBuffer     buf;
+    for (uint64_t value : values)
+        buf.WriteVarUnsignedLong(value);
+    buf.WriteVarUnsignedInt(0xFFFFFFFFu);
+
+    buf.Rewind();
+    for (uint64_t value : values)
+        EXPECT_EQ(buf.ReadVarUnsignedLong(), value);
+    EXPECT_EQ(buf.ReadVarUnsignedInt(), 0xFFFFFFFFu);
+    EXPECT_FALSE(buf.HasRemaining());
+}
+
+TEST(VarIntTests, EncodedLengths)
+{
+    ByteBuffer buf;
+    buf.WriteVarUnsignedInt(127);
+    EXPECT_EQ(buf.WrittenBytes(), 1u);
+    buf.WriteVarUnsignedInt(128);
+    EXPECT_EQ(buf.WrittenBytes(), 3u);
+    buf.WriteVarUnsignedLong(0xFFFFFFFFFFFFFFFFull);
+    EXPECT_EQ(buf.WrittenBytes(), 3u + kMaxVarInt64Bytes);
+}
+
+TEST(VarIntTests, ZigZagKeepsSmallNegativesShort)
+{
+    ByteBuffer buf;
+    buf.WriteVarInt(-1);
+    EXPECT_EQ(buf.WrittenBytes(), 1u);
+    buf.WriteVarInt(std::numeric_limits<int32_t>::min());
+    buf.WriteVarInt(std::numeric_limits<int32_t>::max());
+    buf.WriteVarLong(-64);
+    buf.WriteVarLong(std::numeric_limits<int64_t>::min());
+
+    buf.Rewind();
+    EXPECT_EQ(buf.ReadVarInt(), -1);
+    EXPECT_EQ(buf.ReadVarInt(), std::numeric_limits<int32_t>::min());
+    EXPECT_EQ(buf.ReadVarInt(), std::numeric_limits<int32_t>::max());
+    EXPECT_EQ(buf.ReadVarLong(), -64);
+    EXPECT_EQ(buf.ReadVarLong(), std::numeric_limits<int64_t>::min());
+}
+
+TEST(VarIntTests, TruncatedAndOverlongInputThrow)
+{
+    ByteBuffer truncated;
+    truncated.WriteByte(0x80);
+    EXPECT_THROW(truncated.ReadVarUnsignedInt(), BufferUnderflowException);
+
+    // Six continuation bytes cannot be a 32-bit varint
+    ByteBuffer overlong;
+    for (int i = 0; i < 5; ++i)
+        overlong.WriteByte(0xFF);
+    overlong.WriteByte(0x01);
+    EXPECT_THROW(overlong.ReadVarUnsignedInt(), BufferFormatException);
+
+    // Five bytes whose value exceeds 32 bits
+    ByteBuffer outOfRange;
+    for (int i = 0; i < 4; ++i)
+        outOfRange.WriteByte(0xFF);
+    outOfRange.WriteByte(0x1F);
+    EXPECT_THROW(outOfRange.ReadVarUnsignedInt(), BufferFormatException);
+}
+
+//=============================================================================
+// BitStream
+//=============================================================================
+
+TEST(BitStreamTests, MixedWidthFieldsRoundTrip)
+{
+    ByteBuffer buf;
+    buf.WriteByte(0xAB); // Leading byte proves the reader starts at the cursor
+    {
+        BitWriter writer(buf);
+        for (uint32_t i = 0; i < 100; ++i)
+        {
+            writer.WriteBits(i, 7);
+            writer.WriteBool((i & 1) != 0);
+            writer.WriteBits(0xFFFFFFFFFFFFFFFFull - i, 64);
+            writer.WriteBits(i * 3, 13);
+        }
+        EXPECT_EQ(writer.GetBitsWritten(), 100u * (7 + 1 + 64 + 13));
+    }
+    EXPECT_EQ(buf.WrittenBytes(), 1u + (100u * 85 + 7) / 8);
+
+    EXPECT_EQ(buf.ReadByte(), 0xAB);
+    BitReader reader(buf.AsView());
+    for (uint32_t i = 0; i < 100; ++i)
+    {
+        ASSERT_EQ(reader.ReadBits(7), i);
+        ASSERT_EQ(reader.ReadBool(), (i & 1) != 0);
+        ASSERT_EQ(reader.ReadBits(64), 0xFFFFFFFFFFFFFFFFull - i);
+        ASSERT_EQ(reader.ReadBits(13), i * 3);
+    }
+    buf.Skip(reader.GetConsumedBytes());
+    EXPECT_FALSE(buf.HasRemaining());
+}
+
+TEST(BitStreamTests, WriterMasksUpperBitsAndReaderChecksBounds)
+{
+    ByteBuffer buf;
+    BitWriter  writer(buf);
+    writer.WriteBits(0xFF, 4);
+    writer.WriteBits(0, 4);
+    writer.Flush();
+    ASSERT_EQ(buf.WrittenBytes(), 1u);
+    EXPECT_EQ(buf.Data()[0], 0x0F);
+
+    BitReader reader(buf.Data(), buf.WrittenBytes());
+    EXPECT_EQ(reader.ReadBits(3), 7u);
+    reader.AlignToByte();
+    EXPECT_EQ(reader.GetRemainingBits(), 0u);
+    EXPECT_THROW(reader.ReadBits(1), BufferUnderflowException);
+}
+
+//=============================================================================
+// BulkArray
+//=============================================================================
+
+TEST(BulkArrayTests, BigEndianArrayMatchesScalarWrites)
+{
+    std::vector<int32_t> ints(37);
+    std::iota(ints.begin(), ints.end(), -5);
+    std::vector<double>  doubles = {0.5, -1.25, 3.0e10, 7.0, 1.0 / 3.0};
+    std::vector<int16_t> shorts  = {1, -2, 0x1234, -0x7FFF, 9, 10, 11, 12, 13};
+
+    ByteBuffer bulk(ByteOrder::Big);
+    bulk.WriteArray(ints.data(), ints.size());
+    bulk.WriteArray(doubles.data(), doubles.size());
+    bulk.WriteArray(shorts.data(), shorts.size());
+
+    ByteBuffer scalar(ByteOrder::Big);
+    for (int32_t v : ints) scalar.WriteInt(v);
+    for (double v : doubles) scalar.WriteDouble(v);
+    for (int16_t v : shorts) scalar.WriteShort(v);
+    EXPECT_EQ(bulk.GetBuffer(), scalar.GetBuffer());
+
+    std::vector<int32_t> intsOut(ints.size());
+    std::vector<double>  doublesOut(doubles.size());
+    std::vector<int16_t> shortsOut(shorts.size());
+    bulk.ReadArrayInto(intsOut.data(), intsOut.size());
+    bulk.ReadArrayInto(doublesOut.data(), doublesOut.size());
+    bulk.ReadArrayInto(shortsOut.data(), shortsOut.size());
+    EXPECT_EQ(intsOut, ints);
+    EXPECT_EQ(doublesOut, doubles);
+    EXPECT_EQ(shortsOut, shorts);
+}
+
+TEST(BulkArrayTests, NativeOrderIsPlainCopyAndReadChecksBounds)
+{
+    std::vector<uint32_t> values = {1, 2, 3, 4, 5};
+    ByteBuffer            buf(ByteOrder::Native);
+    buf.WriteArray(values.data(), values.size());
+    EXPECT_EQ(std::memcmp(buf.Data(), values.data(), values.size() * sizeof(uint32_t)), 0);
+
+    std::vector<uint32_t> tooMany(6);
+    EXPECT_THROW(buf.ReadArrayInto(tooMany.data(), tooMany.size()), BufferUnderflowException);
+    EXPECT_THROW(buf.ReadArrayInto(tooMany.data(), std::numeric_limits<size_t>::max() / 2), BufferUnderflowException);
+    EXPECT_EQ(buf.GetReadCursor(), 0u);
+}
+
+//=============================================================================
+// ReserveAndGetWritePtr
+//=============================================================================
+
+TEST(ReserveTests, CommitTrimsUnusedReservation)
+{
+    ByteBuffer buf;
+    buf.WriteByte(0x11);
+    byte_t* out = buf.ReserveAndGetWritePtr(kMaxVarInt64Bytes);
+    size_t  used = detail::EncodeVarUInt(300, out);
+    buf.CommitReservedWrite(used);
+    buf.WriteByte(0x22);
+
+    EXPECT_EQ(buf.WrittenBytes(), 1u + used + 1u);
+    EXPECT_EQ(buf.ReadByte(), 0x11);
+    EXPECT_EQ(buf.ReadVarUnsignedInt(), 300u);
+    EXPECT_EQ(buf.ReadByte(), 0x22);
+}
+
+//=============================================================================
+// ByteBufferView
+//=============================================================================
+
+TEST(ByteBufferViewTests, ReadsWithoutCopying)
+{
+    ByteBuffer buf(ByteOrder::Little);
+    buf.WriteInt(42);
+    buf.WriteVarLong(-300);
+    buf.WriteString("chunk");
+    buf.WriteNullTerminatedString("light");
+    buf.WriteFloat(2.5f);
+
+    buf.Skip(sizeof(int32_t));
+    ByteBufferView view = buf.AsView();
+    EXPECT_EQ(view.Data(), buf.Data());
+    EXPECT_EQ(view.GetReadCursor(), sizeof(int32_t));
+    EXPECT_EQ(view.ReadVarLong(), -300);
+
+    std::string_view name = view.ReadStringView();
+    EXPECT_EQ(name, "chunk");
+    EXPECT_GE(reinterpret_cast<const byte_t*>(name.data()), buf.Data());
+    EXPECT_LT(reinterpret_cast<const byte_t*>(name.data()), buf.Data() + buf.WrittenBytes());
+
+    EXPECT_EQ(view.ReadNullTerminatedString(), "light");
+    EXPECT_FLOAT_EQ(view.ReadFloat(), 2.5f);
+    EXPECT_FALSE(view.HasRemaining());
+    EXPECT_THROW(view.ReadByte(), BufferUnderflowException);
+    EXPECT_EQ(buf.GetReadCursor(), sizeof(int32_t)); // The owning buffer's cursor is untouched
+}
+
+TEST(ByteBufferViewTests, SliceIsBoundedSubView)
+{
+    const byte_t   raw[] = {0x00, 0x01, 0x02, 0x03, 0x04, 0x05};
+    ByteBufferView view(raw, sizeof(raw), ByteOrder::Big);
+    view.Skip(1);
+    ByteBufferView slice = view.ReadSlice(2);
+    EXPECT_EQ(slice.ReadUnsignedShort(), 0x0102);
+    EXPECT_THROW(slice.ReadByte(), BufferUnderflowException);
+    EXPECT_EQ(view.ReadByte(), 0x03);
+    EXPECT_EQ(view.Peek<uint16_t>().value(), 0x0405);
+}
+
+//=============================================================================
+// Throughput (informational)
+//=============================================================================
+
+namespace
+{
+    template <typename Fn>
+    double MeasureGigabytesPerSecond(size_t bytesPerRun, int runs, Fn&& fn)
+    {
+        auto start = std::chrono::steady_clock::now();
+        for (int run = 0; run < runs; ++run)
+            fn();
+        double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        return static_cast<double>(bytesPerRun) * runs / seconds / 1.0e9;
+    }
+}
+
+TEST(ByteBufferBenchmark, BulkArrayVersusScalarWrites)
+{
+    constexpr size_t      kCount = 1 << 18;
+    std::vector<uint32_t> values(kCount);
+    std::iota(values.begin(), values.end(), 0u);
+    std::vector<uint32_t> readBack(kCount);
+    const size_t          bytes = kCount * sizeof(uint32_t);
+
+    for (ByteOrder order : {ByteOrder::Big, ByteOrder::Native})
+    {
+        ByteBuffer buf(order, bytes);
+        double     scalar = MeasureGigabytesPerSecond(bytes, 20, [&]()
+        {
+            buf.Clear();
+            for (uint32_t v : values) buf.WriteUnsignedInt(v);
+        });
+        double bulkWrite = MeasureGigabytesPerSecond(bytes, 20, [&]()
+        {
+            buf.Clear();
+            buf.WriteArray(values.data(), values.size());
+        });
+        double bulkRead = MeasureGigabytesPerSecond(bytes, 20, [&]()
+        {
+            buf.Rewind();
+            buf.ReadArrayInto(readBack.data(), readBack.size());
+        });
+        EXPECT_EQ(readBack, values);
+        std::printf("[ BENCH    ] %s uint32 x%zu: scalar write %.2f GB/s, WriteArray %.2f GB/s, ReadArrayInto %.2f GB/s\n",
+                    order == ByteOrder::Big ? "big-endian" : "native", kCount, scalar, bulkWrite, bulkRead);
+    }
+}
+
+TEST(ByteBufferBenchmark, VarIntAndBitStreamThroughput)
+{
+    constexpr size_t      kCount = 1 << 18;
+    std::vector<uint32_t> values(kCount);
+    for (size_t i = 0; i < kCount; ++i)
+        values[i] = static_cast<uint32_t>((i * 2654435761u) >> (i % 25));
+
+    ByteBuffer varints(ByteOrder::Big, kCount * kMaxVarInt32Bytes);
+    double     varWrite = MeasureGigabytesPerSecond(kCount * sizeof(uint32_t), 10, [&]()
+    {
+        varints.Clear();
+        for (uint32_t v : values) varints.WriteVarUnsignedInt(v);
+    });
+    uint64_t checksum = 0;
+    double   varRead  = MeasureGigabytesPerSecond(kCount * sizeof(uint32_t), 10, [&]()
+    {
+        ByteBufferView view = varints.AsView();
+        for (size_t i = 0; i < kCount; ++i) checksum += view.ReadVarUnsignedInt();
+    });
+
+    ByteBuffer bits(ByteOrder::Big, kCount * 2);
+    double     bitWrite = MeasureGigabytesPerSecond(kCount * sizeof(uint32_t), 10, [&]()
+    {
+        bits.Clear();
+        BitWriter writer(bits);
+        for (uint32_t v : values) writer.WriteBits(v, 12);
+    });
+    double bitRead = MeasureGigabytesPerSecond(kCount * sizeof(uint32_t), 10, [&]()
+    {
+        BitReader reader(bits.Data(), bits.WrittenBytes());
+        for (size_t i = 0; i < kCount; ++i) checksum += reader.ReadBits(12);
+    });
+
+    EXPECT_NE(checksum, 0u);
+    std::printf("[ BENCH    ] varint: write %.2f GB/s, read %.2f GB/s (%.2f bytes/value); 12-bit fields: write %.2f GB/s, read %.2f GB/s\n",
+                varWrite, varRead, static_cast<double>(varints.WrittenBytes()) / kCount, bitWrite, bitRead);
+}
@@ -0,0 +1,389 @@
+#include <gtest/gtest.h>
+
+#include "Engine/Core/Event/EventBus.hpp"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <functional>
+#include <memory>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+using namespace enigma::event;
+
+namespace
+{
+    struct CounterEvent : public EventBase<CounterEvent>
+    {
+        int value = 0;
+
+        explicit CounterEvent(int v = 0)
+            : value(v)
+        {
+        }
+
+        const char* GetEventName() const override { return "CounterEvent"; }
+    };
+
+    struct CancellableTestEvent : public CancellableEventBase<CancellableTestEvent>
+    {
+        const char* GetEventName() const override { return "CancellableTestEvent"; }
+    };
+
+    struct ProducerEvent : public EventBase<ProducerEvent>
+    {
+        int         producer = 0;
+        int         sequence = 0;
+        std::string payload;
+
+        const char* GetEventName() const override { return "ProducerEvent"; }
+    };
+
+    struct MemberListener
+    {
+        int total = 0;
+
+        void OnCounter(CounterEvent& event) { total += event.value; }
+    };
+
+    /// Replica of the previous dispatch path (std::function + hashed type lookup + re-sort on add)
+    class LegacyEventBus
+    {
+    public:
+        template <typename TEvent, typename F>
+        void AddListener(F&& callback, EventPriority priority = EventPriority::Normal)
+        {
+            auto& listeners = m_listeners[EventTypeIdGenerator::GetId<TEvent>()];
+            listeners.push_back({[cb = std::forward<F>(callback)](Event& e) { cb(static_cast<TEvent&>(e)); }, priority});
+            std::stable_sort(listeners.begin(), listeners.end(), [](const Wrapper& a, const Wrapper& b)
+            {
+                return static_cast<uint8_t>(a.priority) < static_cast<uint8_t>(b.priority);
+            });
+        }
+
+        template <typename TEvent>
+        void Post(TEvent& event)
+        {
+            auto it = m_listeners.find(EventTypeIdGenerator::GetId<TEvent>());
+            if (it == m_listeners.end())
+                return;
+            for (const auto& wrapper : it->second)
+                wrapper.callback(event);
+        }
+
+    private:
+        struct Wrapper
+        {
+            std::function<void(Event&)> callback;
+            EventPriority               priority;
+        };
+
+        std::unordered_map<size_t, std::vector<Wrapper>> m_listeners;
+    };
+}
+
+//=============================================================================
+// InlineDelegate
+//=============================================================================
+
+TEST(InlineDelegateTests, SmallCallablesStayInline)
+{
+    int  hits    = 0;
+    auto lambda  = [&hits](int amount) { hits += amount; };
+    using Small  = InlineDelegate<void(int)>;
+    static_assert(Small::FitsInline<decltype(lambda)>, "Pointer-capturing lambda must fit inline");
+
+    Small delegate(lambda);
+    Small copy = delegate;
+    delegate(2);
+    copy(3);
+    EXPECT_EQ(hits, 5);
+
+    Small moved = std::move(copy);
+    EXPECT_FALSE(copy.IsBound());
+    moved(1);
+    EXPECT_EQ(hits, 6);
+}
+
+TEST(InlineDelegateTests, LargeCallablesFallBackToHeap)
+{
+    std::array<int, 32> table{};
+    table[7] = 11;
+    auto lambda = [table](int index) { return table[index]; };
+    using Delegate32 = InlineDelegate<int(int)>;
+    static_assert(!Delegate32::FitsInline<decltype(lambda)>, "Large capture must use the heap path");
+
+    Delegate32 delegate(lambda);
+    Delegate32 copy(delegate);
+    delegate.Unbind();
+    EXPECT_EQ(copy(7), 11);
+}
+
+//=============================================================================
+// Dispatch
+//=============================================================================
+
+TEST(EventBusTests, DispatchesByPriorityThenRegistrationOrder)
+{
+    EventBus         bus;
+    std::vector<int> order;
+    bus.AddListener<CounterEvent>([&](CounterEvent&) { order.push_back(3); }, EventPriority::Low);
+    bus.AddListener<CounterEvent>([&](CounterEvent&) { order.push_back(1); }, EventPriority::Highest);
+    bus.AddListener<CounterEvent>([&](CounterEvent&) { order.push_back(2); }, EventPriority::Normal);
+    bus.AddListener<CounterEvent>([&](CounterEvent&) { order.push_back(4); }, EventPriority::Low);
+
+    MemberListener member;
+    bus.AddListener<CounterEvent>(&member, &MemberListener::OnCounter, EventPriority::Lowest);
+
+    bus.Post(CounterEvent(5));
+    EXPECT_EQ(order, (std::vector<int>{1, 2, 3, 4}));
+    EXPECT_EQ(member.total, 5);
+}
+
+TEST(EventBusTests, CancelledEventsSkipListenersThatOptOut)
+{
+    EventBus bus;
+    int      receivedCancelled = 0;
+    int      skipped           = 0;
+    bus.AddListener<CancellableTestEvent>([](CancellableTestEvent& e) { e.SetCancelled(); }, EventPriority::High);
+    bus.AddListener<CancellableTestEvent>([&](CancellableTestEvent&) { ++skipped; });
+    bus.AddListener<CancellableTestEvent>([&](CancellableTestEvent&) { ++receivedCancelled; }, EventPriority::Normal, true);
+
+    CancellableTestEvent event;
+    EXPECT_TRUE(bus.Post(event));
+    EXPECT_EQ(skipped, 0);
+    EXPECT_EQ(receivedCancelled, 1);
+}
+
+TEST(EventBusTests, RemoveAndClearListeners)
+{
+    EventBus       bus;
+    int            total  = 0;
+    ListenerHandle first  = bus.AddListener<CounterEvent>([&](CounterEvent& e) { total += e.value; });
+    ListenerHandle second = bus.AddListener<CounterEvent>([&](CounterEvent& e) { total += 10 * e.value; });
+
+    EXPECT_TRUE(bus.RemoveListener(first));
+    EXPECT_FALSE(bus.RemoveListener(first));
+    bus.Post(CounterEvent(1));
+    EXPECT_EQ(total, 10);
+
+    bus.ClearListeners<CounterEvent>();
+    EXPECT_FALSE(bus.RemoveListener(second));
+    bus.Post(CounterEvent(1));
+    EXPECT_EQ(total, 10);
+
+    bus.Shutdown();
+    EXPECT_EQ(bus.AddListener<CounterEvent>([](CounterEvent&) {}), INVALID_LISTENER_HANDLE);
+    EXPECT_FALSE(bus.Enqueue(CounterEvent(1)));
+}
+
+TEST(EventBusTests, ListenersAddedDuringDispatchApplyToNextPost)
+{
+    EventBus bus;
+    int      lateCalls = 0;
+    bus.AddListener<CounterEvent>([&](CounterEvent&)
+    {
+        bus.AddListener<CounterEvent>([&](CounterEvent&) { ++lateCalls; });
+    });
+
+    bus.Post(CounterEvent());
+    EXPECT_EQ(lateCalls, 0);
+    bus.Post(CounterEvent());
+    EXPECT_EQ(lateCalls, 1);
+}
+
+TEST(EventBusTests, ConcurrentRegistrationDoesNotBlockDispatch)
+{
+    EventBus          bus;
+    std::atomic<int>  calls{0};
+    std::atomic<bool> done{false};
+    bus.AddListener<CounterEvent>([&](CounterEvent&) { calls.fetch_add(1, std::memory_order_relaxed); });
+
+    std::thread registrar([&]()
+    {
+        std::vector<ListenerHandle> handles;
+        for (int i = 0; i < 500; ++i)
+        {
+            handles.push_back(bus.AddListener<CounterEvent>([](CounterEvent&) {}));
+            if (i % 2 == 1)
+            {
+                bus.RemoveListener(handles[i - 1]);
+            }
+        }
+        done.store(true);
+    });
+
+    int posts = 0;
+    while (!done.load() || posts < 1000)
+    {
+        bus.Post(CounterEvent());
+        ++posts;
+    }
+    registrar.join();
+    EXPECT_EQ(calls.load(), posts);
+}
+
+//=============================================================================
+// Deferred Queue
+//=============================================================================
+
+TEST(EventBusDeferredTests, WorkerEventsDrainOnOwnerThreadInProducerOrder)
+{
+    EventBus                      bus;
+    constexpr int                 kProducers = 4;
+    constexpr int                 kPerThread = 5000;
+    std::vector<int>              lastSequence(kProducers, -1);
+    int                           outOfOrder = 0;
+    const std::thread::id         owner      = std::this_thread::get_id();
+    bool                          offThread  = false;
+
+    bus.AddListener<ProducerEvent>([&](ProducerEvent& e)
+    {
+        offThread |= std::this_thread::get_id() != owner;
+        if (e.sequence != lastSequence[e.producer] + 1)
+            ++outOfOrder;
+        lastSequence[e.producer] = e.sequence;
+    });
+
+    std::vector<std::thread> producers;
+    for (int p = 0; p < kProducers; ++p)
+    {
+        producers.emplace_back([&bus, p]()
+        {
+            for (int i = 0; i < kPerThread; ++i)
+            {
+                ProducerEvent event;
+                event.producer = p;
+                event.sequence = i;
+                event.payload  = "chunk";
+                bus.Enqueue(std::move(event));
+            }
+        });
+    }
+
+    size_t delivered = 0;
+    while (delivered < static_cast<size_t>(kProducers * kPerThread))
+    {
+        delivered += bus.DispatchDeferred();
+    }
+    for (auto& producer : producers)
+    {
+        producer.join();
+    }
+
+    EXPECT_EQ(bus.DispatchDeferred(), 0u);
+    EXPECT_EQ(bus.GetDeferredCount(), 0u);
+    EXPECT_EQ(outOfOrder, 0);
+    EXPECT_FALSE(offThread);
+    for (int p = 0; p < kProducers; ++p)
+    {
+        EXPECT_EQ(lastSequence[p], kPerThread - 1);
+    }
+}
+
+TEST(EventBusDeferredTests, BudgetedDrainKeepsRemainderQueued)
+{
+    EventBus         bus;
+    std::vector<int> seen;
+    bus.AddListener<CounterEvent>([&](CounterEvent& e)
+    {
+        seen.push_back(e.value);
+        if (e.value == 0)
+        {
+            bus.Enqueue(CounterEvent(100)); // Re-entrant enqueue waits for the next drain
+        }
+    });
+
+    for (int i = 0; i < 10; ++i)
+    {
+        bus.Enqueue(CounterEvent(i));
+    }
+    EXPECT_EQ(bus.GetDeferredCount(), 10u);
+
+    EXPECT_EQ(bus.DispatchDeferred(4), 4u);
+    EXPECT_EQ(bus.DispatchDeferred(), 7u);
+    EXPECT_EQ(bus.DispatchDeferred(), 0u);
+    EXPECT_EQ(seen, (std::vector<int>{0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 100}));
+}
+
+TEST(EventBusDeferredTests, UndeliveredEventsAreReleasedOnDestruction)
+{
+    auto payload = std::make_shared<int>(0);
+    {
+        struct HoldingEvent : public EventBase<HoldingEvent>
+        {
+            std::shared_ptr<int> held;
+            const char*          GetEventName() const override { return "HoldingEvent"; }
+        };
+
+        EventBus     bus;
+        HoldingEvent event;
+        event.held = payload;
+        bus.Enqueue(std::move(event));
+        EXPECT_EQ(payload.use_count(), 2);
+    }
+    EXPECT_EQ(payload.use_count(), 1);
+}
+
+//=============================================================================
+// Throughput (informational)
+//=============================================================================
+
+TEST(EventBusBenchmark, DispatchVersusLegacyBus)
+{
+    constexpr int kPosts = 1000000;
+
+    for (int listenerCount : {1, 8})
+    {
+        EventBus       bus;
+        LegacyEventBus legacy;
+        int64_t        sumNew    = 0;
+        int64_t        sumLegacy = 0;
+        for (int i = 0; i < listenerCount; ++i)
+        {
+            bus.AddListener<CounterEvent>([&sumNew, i](CounterEvent& e) { sumNew += e.value + i; });
+            legacy.AddListener<CounterEvent>([&sumLegacy, i](CounterEvent& e) { sumLegacy += e.value + i; });
+        }
+
+        auto measure = [](auto&& postAll)
+        {
+            auto start = std::chrono::steady_clock::now();
+            postAll();
+            return std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count() / kPosts;
+        };
+
+        double legacyNs = measure([&]()
+        {
+            for (int i = 0; i < kPosts; ++i)
+            {
+                CounterEvent event(i);
+                legacy.Post(event);
+            }
+        });
+        double busNs = measure([&]()
+        {
+            for (int i = 0; i < kPosts; ++i)
+            {
+                CounterEvent event(i);
+                bus.Post(event);
+            }
+        });
+        double deferredNs = measure([&]()
+        {
+            for (int i = 0; i < kPosts; ++i)
+            {
+                bus.Enqueue(CounterEvent(i));
+            }
+            bus.DispatchDeferred();
+        });
+
+        EXPECT_EQ(sumNew, 2 * sumLegacy);
+        std::printf("[ BENCH    ] %d listener(s): legacy Post %.1f ns, EventBus Post %.1f ns, Enqueue+DispatchDeferred %.1f ns per event\n",
+                    listenerCount, legacyNs, busNs, deferredNs);
+    }
+}
@@ -0,0 +1,63 @@
+#include <gtest/gtest.h>
+
+#include "Engine/Core/MappedFile.hpp"
+
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <utility>
+
+using namespace enigma::core;
+
+namespace
+{
+    std::filesystem::path WriteTempFile(const char* name, const std::string& contents)
+    {
+        const std::filesystem::path path = std::filesystem::temp_directory_path() / name;
+        std::ofstream               file(path, std::ios::binary | std::ios::trunc);
+        file.write(contents.data(), static_cast<std::streamsize>(contents.size()));
+        return path;
+    }
+}
+
+TEST(MappedFileTests, MapsWholeFileReadOnly)
+{
+    const std::string           contents = "ESFS mapped file contents";
+    const std::filesystem::path path     = WriteTempFile("enigma_mapped_file_test.bin", contents);
+
+    MappedFile file;
+    ASSERT_TRUE(file.Open(path));
+    EXPECT_TRUE(file.IsOpen());
+    ASSERT_EQ(file.GetSize(), contents.size());
+    EXPECT_EQ(std::memcmp(file.GetData(), contents.data(), contents.size()), 0);
+
+    file.Prefetch();
+    EXPECT_TRUE(MappedFile::PrefetchFile(path));
+
+    // Moving transfers the mapping
+    MappedFile moved(std::move(file));
+    EXPECT_FALSE(file.IsOpen());
+    ASSERT_TRUE(moved.IsOpen());
+    EXPECT_EQ(moved.GetData()[0], 'E');
+
+    moved.Close();
+    EXPECT_FALSE(moved.IsOpen());
+    EXPECT_EQ(moved.GetSize(), 0u);
+
+    std::filesystem::remove(path);
+}
+
+TEST(MappedFileTests, MissingAndEmptyFilesFailToOpen)
+{
+    const std::filesystem::path missing = std::filesystem::temp_directory_path() / "enigma_mapped_file_missing.bin";
+    std::filesystem::remove(missing);
+
+    MappedFile file;
+    EXPECT_FALSE(file.Open(missing));
+    EXPECT_FALSE(MappedFile::PrefetchFile(missing));
+
+    const std::filesystem::path empty = WriteTempFile("enigma_mapped_file_empty.bin", "");
+    EXPECT_FALSE(file.Open(empty));
+    EXPECT_FALSE(file.IsOpen());
+    std::filesystem::remove(empty);
+}
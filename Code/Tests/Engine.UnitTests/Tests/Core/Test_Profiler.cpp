@@ -0,0 +1,146 @@
+#include <gtest/gtest.h>
+
+#include "Engine/Core/Profiler/Profiler.hpp"
+
+#include <chrono>
+#include <cstdio>
+#include <string>
+#include <thread>
+
+using namespace enigma::core;
+
+namespace
+{
+    size_t CountOccurrences(const std::string& text, const std::string& needle)
+    {
+        size_t count = 0;
+        for (size_t pos = text.find(needle); pos != std::string::npos; pos = text.find(needle, pos + needle.size()))
+        {
+            ++count;
+        }
+        return count;
+    }
+
+    /// Starts every test from an empty, recording profiler and stops it afterwards
+    class ProfilerTests : public ::testing::Test
+    {
+    protected:
+        void SetUp() override
+        {
+            Profiler::Clear();
+            Profiler::SetRecording(true);
+        }
+
+        void TearDown() override
+        {
+            Profiler::SetRecording(false);
+            Profiler::Clear();
+            Profiler::SetThreadCapacity(Profiler::DEFAULT_THREAD_CAPACITY);
+        }
+    };
+
+    void RecordNestedZones()
+    {
+        ENGINE_PROFILE_SCOPE("Test::Outer");
+        {
+            ENGINE_PROFILE_SCOPE("Test::Inner");
+        }
+    }
+}
+
+TEST_F(ProfilerTests, ScopesCountersFramesAndFlowsExportAsChromeTrace)
+{
+    ENGINE_PROFILE_FRAME();
+    RecordNestedZones();
+    ENGINE_PROFILE_COUNTER("Test::Counter", 42);
+
+    {
+        ENGINE_PROFILE_SCOPE("Test::Submit");
+        ENGINE_PROFILE_FLOW_BEGIN("Test::Flow", 7);
+    }
+    std::thread worker([]
+    {
+        ENGINE_PROFILE_THREAD_NAME("Test \"Worker\"");
+        ENGINE_PROFILE_SCOPE("Test::Execute");
+        ENGINE_PROFILE_FLOW_END("Test::Flow", 7);
+    });
+    worker.join();
+
+    const std::string trace = Profiler::BuildChromeTrace();
+    EXPECT_EQ(trace.find("{\"displayTimeUnit\":\"ms\",\"traceEvents\":["), 0u);
+    EXPECT_EQ(CountOccurrences(trace, "\"name\":\"Test::Outer\",\"cat\":\"engine\",\"ph\":\"X\""), 1u);
+    EXPECT_EQ(CountOccurrences(trace, "\"name\":\"Test::Inner\",\"cat\":\"engine\",\"ph\":\"X\""), 1u);
+    EXPECT_EQ(CountOccurrences(trace, "\"name\":\"Test::Counter\",\"ph\":\"C\",\"args\":{\"value\":42}"), 1u);
+    EXPECT_EQ(CountOccurrences(trace, "\"ph\":\"i\",\"s\":\"g\""), 1u);
+    EXPECT_EQ(CountOccurrences(trace, "\"name\":\"Test::Flow\",\"cat\":\"flow\",\"id\":7,\"ph\":\"s\""), 1u);
+    EXPECT_EQ(CountOccurrences(trace, "\"name\":\"Test::Flow\",\"cat\":\"flow\",\"id\":7,\"ph\":\"f\",\"bp\":\"e\""), 1u);
+    EXPECT_NE(trace.find("\"args\":{\"name\":\"Test \\\"Worker\\\"\"}"), std::string::npos);
+
+    ProfilerStats stats = Profiler::GetStats();
+    EXPECT_GE(stats.threadCount, 2u);
+    EXPECT_EQ(stats.recordedEvents, 8u);
+    EXPECT_EQ(stats.droppedEvents, 0u);
+}
+
+TEST_F(ProfilerTests, NamesAreInternedOnce)
+{
+    const uint32_t first = Profiler::InternName("Test::Interned");
+    EXPECT_EQ(Profiler::InternName(std::string("Test::Interned")), first);
+    EXPECT_NE(Profiler::InternName("Test::Other"), first);
+}
+
+TEST_F(ProfilerTests, NothingIsRecordedWhileStopped)
+{
+    Profiler::SetRecording(false);
+    for (int i = 0; i < 100; ++i)
+    {
+        RecordNestedZones();
+        ENGINE_PROFILE_COUNTER("Test::Counter", i);
+    }
+    EXPECT_EQ(Profiler::GetStats().recordedEvents, 0u);
+    EXPECT_EQ(Profiler::BuildChromeTrace().find("Test::Outer"), std::string::npos);
+}
+
+TEST_F(ProfilerTests, FullRingKeepsNewestEvents)
+{
+    Profiler::SetThreadCapacity(64); // Applies to threads whose buffer is created after this call
+
+    std::thread worker([]
+    {
+        for (int i = 0; i < 100; ++i)
+        {
+            ENGINE_PROFILE_COUNTER("Test::RingCounter", i);
+        }
+    });
+    worker.join();
+
+    const std::string trace = Profiler::BuildChromeTrace();
+    EXPECT_EQ(CountOccurrences(trace, "\"name\":\"Test::RingCounter\""), 64u);
+    EXPECT_EQ(trace.find("\"args\":{\"value\":35}"), std::string::npos);
+    EXPECT_NE(trace.find("\"args\":{\"value\":36}"), std::string::npos);
+    EXPECT_NE(trace.find("\"args\":{\"value\":99}"), std::string::npos);
+    EXPECT_EQ(Profiler::GetStats().droppedEvents, 36u);
+}
+
+TEST_F(ProfilerTests, ScopeCostStoppedAndRecording)
+{
+    constexpr int kIterations = 1 << 15; // Fits the default ring so no event is overwritten
+
+    auto measureNs = [&]
+    {
+        auto start = std::chrono::steady_clock::now();
+        for (int i = 0; i < kIterations; ++i)
+        {
+            ENGINE_PROFILE_SCOPE("Test::Bench");
+        }
+        return std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count() / kIterations;
+    };
+
+    Profiler::SetRecording(false);
+    const double stoppedNs = measureNs();
+    Profiler::SetRecording(true);
+    const double recordingNs = measureNs();
+
+    EXPECT_EQ(Profiler::GetStats().recordedEvents, static_cast<uint64_t>(kIterations));
+    std::printf("[ BENCH    ] profile scope: stopped %.2f ns, recording %.2f ns per zone\n", stoppedNs, recordingNs);
+}
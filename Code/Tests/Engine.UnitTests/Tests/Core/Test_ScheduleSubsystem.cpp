@@ -0,0 +1,140 @@
+#include <gtest/gtest.h>
+
+#include "Engine/Core/Schedule/ScheduleSubsystem.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+using namespace enigma::core;
+
+namespace
+{
+    /// Records the thread it ran on; optionally spins until released
+    class ProbeTask : public RunnableTask
+    {
+    public:
+        ProbeTask(std::atomic<bool>* release, std::thread::id* ranOn)
+            : RunnableTask("Generic")
+              , m_release(release)
+              , m_ranOn(ranOn)
+        {
+        }
+
+        void Execute() override
+        {
+            if (m_ranOn)
+            {
+                *m_ranOn = std::this_thread::get_id();
+            }
+            while (m_release && !m_release->load())
+            {
+                std::this_thread::sleep_for(std::chrono::microseconds(100));
+            }
+        }
+
+    private:
+        std::atomic<bool>* m_release = nullptr;
+        std::thread::id*   m_ranOn   = nullptr;
+    };
+
+    /// One Generic worker, so a blocked task pins the only worker
+    class ScheduleSubsystemTests : public ::testing::Test
+    {
+    protected:
+        void SetUp() override
+        {
+            m_config.task_types.push_back(TaskTypeDefinition("Generic", 1));
+            m_schedule = std::make_unique<ScheduleSubsystem>(m_config);
+            m_schedule->Startup();
+        }
+
+        void TearDown() override
+        {
+            m_schedule->Shutdown();
+            m_schedule.reset();
+        }
+
+        void WaitUntilExecuting(const TaskHandle& handle)
+        {
+            while (m_schedule->GetTaskState(handle) == TaskState::Queued)
+            {
+                std::this_thread::yield();
+            }
+        }
+
+        ScheduleConfig                     m_config;
+        std::unique_ptr<ScheduleSubsystem> m_schedule;
+    };
+}
+
+TEST_F(ScheduleSubsystemTests, WaitOrExecuteRunsQueuedTaskInline)
+{
+    std::atomic<bool> releaseBlocker{false};
+    const TaskHandle  blocker = m_schedule->SubmitTask(new ProbeTask(&releaseBlocker, nullptr));
+    WaitUntilExecuting(blocker);
+
+    std::thread::id  ranOn;
+    const TaskHandle target = m_schedule->SubmitTask(new ProbeTask(nullptr, &ranOn));
+
+    const TaskWaitResult result = m_schedule->WaitOrExecute(target, std::chrono::seconds(5));
+    EXPECT_TRUE(result.completed);
+    EXPECT_TRUE(result.executedInline);
+    EXPECT_EQ(result.finalState, TaskState::Completed);
+    EXPECT_EQ(ranOn, std::this_thread::get_id());
+
+    releaseBlocker = true;
+    EXPECT_TRUE(m_schedule->WaitOrExecute(blocker, std::chrono::seconds(5)).completed);
+    EXPECT_EQ(m_schedule->DrainCompletedTaskRecords().GetRecordCount(), 2u);
+}
+
+TEST_F(ScheduleSubsystemTests, WaitOrExecuteAssistsSameTypeWorkWhileExecuting)
+{
+    std::atomic<bool> releaseBlocker{false};
+    const TaskHandle  blocker = m_schedule->SubmitTask(new ProbeTask(&releaseBlocker, nullptr));
+    WaitUntilExecuting(blocker);
+
+    std::thread::id firstRanOn;
+    std::thread::id secondRanOn;
+    m_schedule->SubmitTask(new ProbeTask(nullptr, &firstRanOn));
+    m_schedule->SubmitTask(new ProbeTask(nullptr, &secondRanOn));
+
+    // Release from a side thread once both queued tasks were taken by the waiting caller
+    std::thread releaser([this, &releaseBlocker]()
+    {
+        while (m_schedule->GetPendingTaskCount("Generic") > 0)
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+        releaseBlocker = true;
+    });
+
+    const TaskWaitResult result = m_schedule->WaitOrExecute(blocker, std::chrono::seconds(5));
+    releaser.join();
+
+    EXPECT_TRUE(result.completed);
+    EXPECT_FALSE(result.executedInline);
+    EXPECT_EQ(result.assistedTasks, 2u);
+    EXPECT_EQ(firstRanOn, std::this_thread::get_id());
+    EXPECT_EQ(secondRanOn, std::this_thread::get_id());
+    EXPECT_EQ(m_schedule->DrainCompletedTaskRecords().GetRecordCount(), 3u);
+}
+
+TEST_F(ScheduleSubsystemTests, WaitOrExecuteReturnsWhenBudgetExpires)
+{
+    std::atomic<bool> releaseBlocker{false};
+    const TaskHandle  blocker = m_schedule->SubmitTask(new ProbeTask(&releaseBlocker, nullptr));
+    WaitUntilExecuting(blocker);
+
+    const auto           start   = std::chrono::steady_clock::now();
+    const TaskWaitResult result  = m_schedule->WaitOrExecute(blocker, std::chrono::milliseconds(5));
+    const auto           elapsed = std::chrono::steady_clock::now() - start;
+
+    EXPECT_FALSE(result.completed);
+    EXPECT_EQ(result.finalState, TaskState::Executing);
+    EXPECT_GE(elapsed, std::chrono::milliseconds(5));
+    EXPECT_LT(elapsed, std::chrono::seconds(1));
+
+    releaseBlocker = true;
+    EXPECT_TRUE(m_schedule->WaitOrExecute(blocker, std::chrono::seconds(5)).completed);
+}
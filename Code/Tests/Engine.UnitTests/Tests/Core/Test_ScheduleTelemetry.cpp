@@ -0,0 +1,134 @@
+#include <gtest/gtest.h>
+
+#include "Engine/Core/Schedule/ScheduleTelemetry.hpp"
+
+#include <cmath>
+#include <cstdint>
+
+using namespace enigma::core;
+
+TEST(LatencyHistogramTests, SmallValuesHaveExactBuckets)
+{
+    for (uint64_t value = 0; value < LatencyHistogram::SUB_BUCKET_COUNT; ++value)
+    {
+        const uint32_t bucket = LatencyHistogram::GetBucketIndex(value);
+        EXPECT_EQ(bucket, value);
+        EXPECT_EQ(LatencyHistogram::GetBucketLowerBound(bucket), value);
+        EXPECT_EQ(LatencyHistogram::GetBucketWidth(bucket), 1u);
+    }
+}
+
+TEST(LatencyHistogramTests, BucketRangeContainsValue)
+{
+    for (uint64_t value = 1; value < (1ULL << 36); value = value * 3 + 7)
+    {
+        const uint32_t bucket = LatencyHistogram::GetBucketIndex(value);
+        ASSERT_LT(bucket, LatencyHistogram::BUCKET_COUNT);
+
+        const uint64_t lower = LatencyHistogram::GetBucketLowerBound(bucket);
+        const uint64_t width = LatencyHistogram::GetBucketWidth(bucket);
+        EXPECT_LE(lower, value) << "value " << value;
+        EXPECT_LT(value, lower + width) << "value " << value;
+        EXPECT_LE(static_cast<double>(width), static_cast<double>(lower) / LatencyHistogram::SUB_BUCKET_COUNT + 1.0);
+    }
+}
+
+TEST(LatencyHistogramTests, OverflowLandsInLastBucket)
+{
+    EXPECT_EQ(LatencyHistogram::GetBucketIndex(UINT64_MAX), LatencyHistogram::BUCKET_COUNT - 1);
+}
+
+TEST(LatencyHistogramTests, PercentilesWithinBucketPrecision)
+{
+    LatencyHistogram histogram;
+    for (uint64_t value = 1; value <= 10000; ++value)
+    {
+        histogram.Record(value);
+    }
+
+    EXPECT_EQ(histogram.GetCount(), 10000u);
+    EXPECT_EQ(histogram.GetMax(), 10000u);
+    EXPECT_NEAR(histogram.GetMean(), 5000.5, 1e-9);
+
+    for (double percentile : {50.0, 90.0, 99.0})
+    {
+        const double expected = percentile * 100.0;
+        const double actual   = static_cast<double>(histogram.GetValueAtPercentile(percentile));
+        EXPECT_NEAR(actual, expected, expected / LatencyHistogram::SUB_BUCKET_COUNT) << "p" << percentile;
+    }
+    EXPECT_EQ(histogram.GetValueAtPercentile(100.0), 10000u);
+}
+
+TEST(LatencyHistogramTests, MergeAndReset)
+{
+    LatencyHistogram a;
+    LatencyHistogram b;
+    a.Record(10);
+    b.Record(1000);
+    b.Record(2000);
+
+    a.Merge(b);
+    EXPECT_EQ(a.GetCount(), 3u);
+    EXPECT_EQ(a.GetSum(), 3010u);
+    EXPECT_EQ(a.GetMax(), 2000u);
+
+    a.Reset();
+    EXPECT_EQ(a.GetCount(), 0u);
+    EXPECT_EQ(a.GetValueAtPercentile(50.0), 0u);
+}
+
+TEST(ScheduleTelemetryTests, TracksQueueLifecycle)
+{
+    ScheduleTelemetry telemetry;
+    telemetry.Reset(0);
+
+    ScheduleQueueTelemetry* queue = telemetry.GetQueue("ChunkGen", TaskPriority::High);
+    ASSERT_NE(queue, nullptr);
+    EXPECT_EQ(queue, telemetry.GetQueue("ChunkGen", TaskPriority::High));
+
+    telemetry.RecordSubmit(queue, 1);
+    telemetry.RecordSubmit(queue, 2);
+    telemetry.RecordSubmit(queue, 3);
+    telemetry.RecordStart(queue, 5000000, 2);
+    telemetry.RecordFinish(queue, 2000000, TaskState::Completed);
+    telemetry.RecordStart(queue, 6000000, 1);
+    telemetry.RecordFinish(queue, 1000000, TaskState::Failed);
+    telemetry.RecordCancelledWhileQueued(queue, 0);
+
+    ScheduleTelemetrySnapshot snapshot;
+    telemetry.FillQueueSnapshots(snapshot, 2000000000ULL);
+    ASSERT_EQ(snapshot.queues.size(), 1u);
+
+    const ScheduleQueueSnapshot& entry = snapshot.queues[0];
+    EXPECT_EQ(entry.taskType, "ChunkGen");
+    EXPECT_EQ(entry.priority, TaskPriority::High);
+    EXPECT_EQ(entry.submitted, 3u);
+    EXPECT_EQ(entry.completed, 1u);
+    EXPECT_EQ(entry.failed, 1u);
+    EXPECT_EQ(entry.cancelled, 1u);
+    EXPECT_EQ(entry.queueDepth, 0u);
+    EXPECT_EQ(entry.maxQueueDepth, 3u);
+    EXPECT_NEAR(snapshot.windowSeconds, 2.0, 1e-9);
+    EXPECT_NEAR(entry.throughputPerSecond, 0.5, 1e-9);
+    EXPECT_EQ(entry.queueWait.count, 2u);
+    EXPECT_EQ(entry.queueWait.maxUs, 6000u);
+    EXPECT_EQ(entry.runTime.maxUs, 2000u);
+    EXPECT_FALSE(snapshot.ToString().empty());
+}
+
+TEST(ScheduleTelemetryTests, DisabledIgnoresRecords)
+{
+    ScheduleTelemetry telemetry;
+    telemetry.SetEnabled(false);
+
+    ScheduleQueueTelemetry* queue = telemetry.GetQueue("Generic", TaskPriority::Normal);
+    telemetry.RecordSubmit(queue, 1);
+    telemetry.RecordStart(queue, 1000, 0);
+    telemetry.RecordFinish(queue, 1000, TaskState::Completed);
+    telemetry.RecordSubmit(nullptr, 1);
+
+    ScheduleTelemetrySnapshot snapshot;
+    telemetry.FillQueueSnapshots(snapshot, 0);
+    EXPECT_FALSE(snapshot.enabled);
+    EXPECT_TRUE(snapshot.queues.empty());
+}
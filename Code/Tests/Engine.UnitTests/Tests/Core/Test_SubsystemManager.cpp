@@ -0,0 +1,179 @@
+#include <gtest/gtest.h>
+
+#include "Engine/Core/SubsystemManager.hpp"
+
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <thread>
+
+using namespace enigma::core;
+
+namespace
+{
+    /// Headless subsystem whose Startup() only sleeps, standing in for file scans and loader setup
+    class DelayedSubsystem : public EngineSubsystem
+    {
+    public:
+        DelayedSubsystem(std::string name, int priority, bool offMainThread, std::chrono::milliseconds delay)
+            : m_name(std::move(name))
+              , m_priority(priority)
+              , m_offMainThread(offMainThread)
+              , m_delay(delay)
+        {
+        }
+
+        void Startup() override
+        {
+            m_startThread = std::this_thread::get_id();
+            std::this_thread::sleep_for(m_delay);
+        }
+
+        void Shutdown() override
+        {
+        }
+
+        const char* GetSubsystemName() const override { return m_name.c_str(); }
+        int         GetPriority() const override { return m_priority; }
+        bool        CanStartOffMainThread() const override { return m_offMainThread; }
+
+        std::thread::id m_startThread;
+
+    private:
+        std::string               m_name;
+        int                       m_priority;
+        bool                      m_offMainThread;
+        std::chrono::milliseconds m_delay;
+    };
+
+    void WriteFile(const std::filesystem::path& path, const std::string& contents)
+    {
+        std::ofstream file(path, std::ios::trunc);
+        file << contents;
+    }
+
+    /// Configures a manager with the given moduleConfig dependency block
+    void LoadModuleConfig(SubsystemManager& manager, const char* testName, const std::string& moduleYaml)
+    {
+        const std::filesystem::path directory  = std::filesystem::temp_directory_path();
+        const std::filesystem::path configPath = directory / (std::string(testName) + "_config.yml");
+        const std::filesystem::path modulePath = directory / (std::string(testName) + "_module.yml");
+        WriteFile(configPath, "engine:\n  modules:\n    - test\n");
+        WriteFile(modulePath, moduleYaml);
+        manager.LoadConfiguration(configPath.string(), modulePath.string());
+        std::filesystem::remove(configPath);
+        std::filesystem::remove(modulePath);
+    }
+
+    const SubsystemStartupTiming* FindTiming(const SubsystemStartupReport& report, const char* name)
+    {
+        for (const SubsystemStartupTiming& timing : report.subsystems)
+        {
+            if (timing.name == name)
+            {
+                return &timing;
+            }
+        }
+        return nullptr;
+    }
+
+    const char* const kDependencyGraph =
+        "moduleConfig:\n"
+        "  models:\n"
+        "    dependencies:\n"
+        "      - assets\n"
+        "  ui:\n"
+        "    dependencies:\n"
+        "      - models\n";
+
+    /// core (main) -> {assets, sounds, shaders} (workers) -> models (worker) -> ui (main)
+    void RegisterDelayedSubsystems(SubsystemManager& manager, std::chrono::milliseconds delay)
+    {
+        manager.RegisterSubsystem(std::make_unique<DelayedSubsystem>("core", 10, false, delay));
+        manager.RegisterSubsystem(std::make_unique<DelayedSubsystem>("assets", 100, true, delay));
+        manager.RegisterSubsystem(std::make_unique<DelayedSubsystem>("sounds", 100, true, delay));
+        manager.RegisterSubsystem(std::make_unique<DelayedSubsystem>("shaders", 100, true, delay));
+        manager.RegisterSubsystem(std::make_unique<DelayedSubsystem>("models", 100, true, delay));
+        manager.RegisterSubsystem(std::make_unique<DelayedSubsystem>("ui", 200, false, delay));
+    }
+}
+
+TEST(SubsystemManagerTests, DependenciesOverridePriorityOrder)
+{
+    SubsystemManager manager;
+    LoadModuleConfig(manager, "enigma_subsystem_order", "moduleConfig:\n  audio:\n    dependencies:\n      - resource\n");
+    manager.RegisterSubsystem(std::make_unique<DelayedSubsystem>("audio", 50, false, std::chrono::milliseconds(0)));
+    manager.RegisterSubsystem(std::make_unique<DelayedSubsystem>("resource", 100, false, std::chrono::milliseconds(0)));
+    manager.RegisterSubsystem(std::make_unique<DelayedSubsystem>("event", 10, false, std::chrono::milliseconds(0)));
+
+    manager.SetParallelStartupEnabled(false);
+    manager.InitializeAllSubsystems();
+    manager.StartupAllSubsystems();
+
+    const SubsystemStartupReport& report = manager.GetStartupReport();
+    ASSERT_EQ(report.subsystems.size(), 3u);
+    EXPECT_EQ(report.subsystems[0].name, "event");
+    EXPECT_EQ(report.subsystems[1].name, "resource");
+    EXPECT_EQ(report.subsystems[2].name, "audio");
+    EXPECT_EQ(report.workerThreads, 0u);
+}
+
+TEST(SubsystemManagerTests, DependencyCycleIsReported)
+{
+    SubsystemManager manager;
+    LoadModuleConfig(manager, "enigma_subsystem_cycle",
+                     "moduleConfig:\n"
+                     "  a:\n    dependencies:\n      - b\n"
+                     "  b:\n    dependencies:\n      - c\n"
+                     "  c:\n    dependencies:\n      - a\n");
+    for (const char* name : {"a", "b", "c", "d"})
+    {
+        manager.RegisterSubsystem(std::make_unique<DelayedSubsystem>(name, 0, false, std::chrono::milliseconds(0)));
+    }
+
+    EXPECT_EQ(manager.FindDependencyCycle(), "a -> b -> c -> a");
+}
+
+TEST(SubsystemManagerTests, ParallelStartupRespectsDependenciesAndThreads)
+{
+    // Non-zero so every Startup() spans a measurable interval for the ordering checks
+    constexpr std::chrono::milliseconds delay(5);
+
+    SubsystemManager parallel;
+    LoadModuleConfig(parallel, "enigma_subsystem_parallel", kDependencyGraph);
+    RegisterDelayedSubsystems(parallel, delay);
+    parallel.InitializeAllSubsystems();
+    parallel.StartupAllSubsystems();
+
+    const SubsystemStartupReport& report = parallel.GetStartupReport();
+    ASSERT_EQ(report.subsystems.size(), 6u);
+    EXPECT_GT(report.workerThreads, 0u);
+
+    auto endOf = [&report](const char* name)
+    {
+        const SubsystemStartupTiming* timing = FindTiming(report, name);
+        return timing ? timing->startMs + timing->durationMs : 1.0e9;
+    };
+    auto startOf = [&report](const char* name)
+    {
+        const SubsystemStartupTiming* timing = FindTiming(report, name);
+        return timing ? timing->startMs : -1.0;
+    };
+
+    // Off-thread subsystems wait for earlier main-thread ones, everyone waits for declared dependencies
+    EXPECT_GE(startOf("assets"), endOf("core"));
+    EXPECT_GE(startOf("sounds"), endOf("core"));
+    EXPECT_GE(startOf("models"), endOf("assets"));
+    EXPECT_GE(startOf("ui"), endOf("models"));
+    EXPECT_TRUE(FindTiming(report, "assets")->offMainThread);
+    EXPECT_FALSE(FindTiming(report, "ui")->offMainThread);
+
+    auto* core   = static_cast<DelayedSubsystem*>(parallel.GetSubsystem("core"));
+    auto* assets = static_cast<DelayedSubsystem*>(parallel.GetSubsystem("assets"));
+    auto* ui     = static_cast<DelayedSubsystem*>(parallel.GetSubsystem("ui"));
+    EXPECT_EQ(core->m_startThread, std::this_thread::get_id());
+    EXPECT_NE(assets->m_startThread, std::this_thread::get_id());
+    EXPECT_EQ(ui->m_startThread, std::this_thread::get_id());
+}
@@ -0,0 +1,168 @@
+#include <gtest/gtest.h>
+
+#include "Engine/Graphic/Font/Font.hpp"
+
+#include <algorithm>
+#include <filesystem>
+#include <string>
+
+using namespace enigma::graphic;
+
+namespace
+{
+    std::filesystem::path GetRobotoFixturePath()
+    {
+        return "F:/p4/Personal/SD/Engine/Code/ThirdParty/imgui/misc/fonts/Roboto-Medium.ttf";
+    }
+
+    GlyphCacheSettings MakeCacheSettings(int rasterThreadCount)
+    {
+        GlyphCacheSettings settings;
+        settings.pixelHeight       = 32.0f;
+        settings.padding           = 1;
+        settings.pageSize          = IntVec2(256, 256);
+        settings.memoryBudgetBytes = 2u * 256u * 256u;
+        settings.rasterThreadCount = rasterThreadCount;
+        return settings;
+    }
+
+    TrueTypeFont LoadFixtureFont()
+    {
+        const std::filesystem::path fontPath = GetRobotoFixturePath();
+        EXPECT_TRUE(std::filesystem::exists(fontPath));
+        return TrueTypeFont::LoadFromFile(fontPath);
+    }
+} // namespace
+
+TEST(FontGlyphCacheTests, CountsHitsAndMisses)
+{
+    TrueTypeFont font = LoadFixtureFont();
+    GlyphCache   cache(font, MakeCacheSettings(0));
+
+    const GlyphCacheLookup first  = cache.Request(static_cast<uint32_t>('A'));
+    const GlyphCacheLookup second = cache.Request(static_cast<uint32_t>('A'));
+
+    ASSERT_NE(first.entry, nullptr);
+    EXPECT_FALSE(first.pending);
+    EXPECT_EQ(first.page, 0);
+    EXPECT_EQ(first.entry, second.entry);
+    EXPECT_TRUE(first.entry->hasVisiblePixels);
+    EXPECT_GE(first.entry->uvBounds.m_mins.x, 0.0f);
+    EXPECT_LE(first.entry->uvBounds.m_maxs.y, 1.0f);
+
+    const GlyphCacheStats stats = cache.GetStats();
+    EXPECT_EQ(stats.misses, 1u);
+    EXPECT_EQ(stats.hits, 1u);
+    EXPECT_EQ(stats.rasterized, 1u);
+    EXPECT_EQ(stats.residentGlyphs, 1u);
+    EXPECT_EQ(stats.pageCount, 1u);
+
+    const std::vector<uint8_t>& pixels = cache.GetPages()[0].pixels;
+    EXPECT_TRUE(std::any_of(pixels.begin(), pixels.end(), [](uint8_t value) { return value != 0; }));
+}
+
+TEST(FontGlyphCacheTests, RasterizesOnWorkersAndResolvesPendingGlyphs)
+{
+    TrueTypeFont font = LoadFixtureFont();
+    GlyphCache   cache(font, MakeCacheSettings(2));
+
+    const std::string text = "Hello, glyph cache";
+    for (char character : text)
+    {
+        const GlyphCacheLookup lookup = cache.Request(static_cast<uint32_t>(character));
+        ASSERT_NE(lookup.entry, nullptr);
+        EXPECT_GT(lookup.entry->metrics.advanceX, 0.0f);
+    }
+    EXPECT_GT(cache.GetPendingGlyphCount(), 0u);
+
+    cache.WaitForPendingGlyphs();
+    EXPECT_EQ(cache.GetPendingGlyphCount(), 0u);
+
+    const GlyphCacheLookup resolved = cache.Request(static_cast<uint32_t>('H'));
+    EXPECT_FALSE(resolved.pending);
+    EXPECT_EQ(resolved.page, 0);
+    EXPECT_TRUE(resolved.entry->hasVisiblePixels);
+}
+
+TEST(FontGlyphCacheTests, EvictsLeastRecentlyUsedPageWithinBudget)
+{
+    TrueTypeFont       font     = LoadFixtureFont();
+    GlyphCacheSettings settings = MakeCacheSettings(0);
+    settings.pageSize           = IntVec2(64, 64);
+    settings.memoryBudgetBytes  = 2u * 64u * 64u;
+    GlyphCache cache(font, settings);
+
+    // Both pages fill up in one frame; the overflow waits for the next frame
+    for (char character : std::string("ABCDEFGHIJKLMNOP"))
+    {
+        cache.Request(static_cast<uint32_t>(character));
+    }
+    ASSERT_EQ(cache.GetStats().pageCount, 2u);
+    ASSERT_GT(cache.GetPendingGlyphCount(), 0u);
+
+    cache.BeginFrame();
+
+    const GlyphCacheStats stats = cache.GetStats();
+    EXPECT_EQ(stats.pageCount, 2u);
+    EXPECT_LE(stats.pageBytes, settings.memoryBudgetBytes);
+    EXPECT_GE(stats.evictedPages, 1u);
+    EXPECT_GE(stats.evictedGlyphs, 2u);
+
+    // Evicted glyphs rasterize again on their next request
+    const uint64_t missesBefore = stats.misses;
+    cache.BeginFrame();
+    const GlyphCacheLookup again = cache.Request(static_cast<uint32_t>('A'));
+    EXPECT_EQ(cache.GetStats().misses, missesBefore + 1u);
+    EXPECT_FALSE(again.pending);
+}
+
+TEST(FontGlyphCacheTests, DefersGlyphsWhenEveryPageIsInUseThisFrame)
+{
+    TrueTypeFont       font     = LoadFixtureFont();
+    GlyphCacheSettings settings = MakeCacheSettings(0);
+    settings.pageSize           = IntVec2(64, 64);
+    settings.memoryBudgetBytes  = 64u * 64u;
+    GlyphCache cache(font, settings);
+
+    for (char character : std::string("ABCDEFGHIJKLMNOP"))
+    {
+        cache.Request(static_cast<uint32_t>(character));
+    }
+
+    EXPECT_GT(cache.GetPendingGlyphCount(), 0u);
+    EXPECT_GT(cache.GetStats().deferredGlyphs, 0u);
+    EXPECT_EQ(cache.GetStats().evictedPages, 0u);
+}
+
+TEST(FontGlyphCacheTests, LayoutAdvancesPendingGlyphs)
+{
+    TrueTypeFont font  = LoadFixtureFont();
+    GlyphCache   cache(font, MakeCacheSettings(1));
+    GlyphAtlasBuildSettings atlasSettings;
+    atlasSettings.pixelHeight = 32.0f;
+    GlyphAtlas atlas          = GlyphAtlas::BuildFromUtf8Text(font, "Cache me", atlasSettings);
+
+    const TextLayoutResult pending = TextLayout::Build("Cache me", cache);
+    EXPECT_GT(pending.pendingGlyphCount, 0u);
+    EXPECT_GE(pending.pendingGlyphCount, cache.GetPendingGlyphCount()); // Repeated letters share one pending glyph
+    EXPECT_FLOAT_EQ(pending.advanceWidth, TextLayout::Build("Cache me", atlas).advanceWidth);
+
+    cache.WaitForPendingGlyphs();
+
+    const TextLayoutResult resident = TextLayout::Build("Cache me", cache);
+    ASSERT_EQ(resident.glyphs.size(), 8u);
+    EXPECT_EQ(resident.pendingGlyphCount, 0u);
+    EXPECT_TRUE(resident.glyphs[0].hasVisiblePixels);
+    EXPECT_FALSE(resident.glyphs[0].isPending);
+    EXPECT_FLOAT_EQ(resident.advanceWidth, pending.advanceWidth);
+}
+
+TEST(FontGlyphCacheTests, StrictPolicyRejectsMissingGlyphs)
+{
+    TrueTypeFont       font     = LoadFixtureFont();
+    GlyphCacheSettings settings = MakeCacheSettings(0);
+    settings.missingPolicy      = GlyphMissingPolicy::Strict;
+    GlyphCache cache(font, settings);
+
+    EXPECT_THROW(cache.Request(0x10FFFDu), AtlasBuildException);
+}
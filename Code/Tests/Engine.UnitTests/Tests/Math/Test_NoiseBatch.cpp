@@ -0,0 +1,128 @@
+#include <gtest/gtest.h>
+
+#include "Engine/Math/NoiseBatch.hpp"
+#include "Engine/Math/RawNoise.hpp"
+#include "Engine/Math/SmoothNoise.hpp"
+
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+namespace
+{
+    uint32_t Bits(float value)
+    {
+        uint32_t bits = 0;
+        std::memcpy(&bits, &value, sizeof(bits));
+        return bits;
+    }
+
+    /// Deterministic positions spread over negative and positive cells, including exact integers
+    std::vector<float> MakePositions(size_t count, unsigned int salt, float range)
+    {
+        std::vector<float> positions(count);
+        for (size_t i = 0; i < count; ++i)
+        {
+            const unsigned int noise = Get1dNoiseUint(static_cast<int>(i), salt);
+            positions[i]             = (i % 7 == 0) ? static_cast<float>(static_cast<int>(noise % 512) - 256) : (static_cast<float>(noise) / 4294967295.f * 2.f - 1.f) * range;
+        }
+        return positions;
+    }
+
+    struct OctaveCase
+    {
+        float        scale;
+        unsigned int numOctaves;
+        float        persistence;
+        float        octaveScale;
+        bool         renormalize;
+        unsigned int seed;
+    };
+
+    const OctaveCase kCases[] = {
+        {1.f, 1, 0.5f, 2.f, true, 0},
+        {96.f, 4, 0.5f, 2.f, true, 1337},
+        {37.5f, 6, 0.6f, 1.9f, false, 0xdeadbeefu},
+        {8.f, 0, 0.5f, 2.f, true, 7},
+    };
+}
+
+TEST(NoiseBatch, RawNoiseMatchesScalar)
+{
+    constexpr size_t count = 1003; // Not a multiple of any lane width
+    std::vector<int> x(count), y(count), z(count);
+    for (size_t i = 0; i < count; ++i)
+    {
+        x[i] = static_cast<int>(i) * 7919 - 4000000;
+        y[i] = -static_cast<int>(i) * 104729;
+        z[i] = static_cast<int>(Get1dNoiseUint(static_cast<int>(i), 3));
+    }
+
+    std::vector<unsigned int> out1(count), out2(count), out3(count);
+    Get1dNoiseUintBatch(x.data(), out1.data(), count, 42);
+    Get2dNoiseUintBatch(x.data(), y.data(), out2.data(), count, 42);
+    Get3dNoiseUintBatch(x.data(), y.data(), z.data(), out3.data(), count, 42);
+    for (size_t i = 0; i < count; ++i)
+    {
+        ASSERT_EQ(out1[i], Get1dNoiseUint(x[i], 42)) << i;
+        ASSERT_EQ(out2[i], Get2dNoiseUint(x[i], y[i], 42)) << i;
+        ASSERT_EQ(out3[i], Get3dNoiseUint(x[i], y[i], z[i], 42)) << i;
+    }
+}
+
+TEST(NoiseBatch, PerlinBatchIsBitIdentical)
+{
+    constexpr size_t         count = 4099;
+    const std::vector<float> posX  = MakePositions(count, 1, 3000.f);
+    const std::vector<float> posY  = MakePositions(count, 2, 3000.f);
+    const std::vector<float> posZ  = MakePositions(count, 3, 300.f);
+    std::vector<float>       out(count);
+
+    for (const OctaveCase& c : kCases)
+    {
+        Compute2dPerlinNoiseBatch(posX.data(), posY.data(), out.data(), count, c.scale, c.numOctaves, c.persistence, c.octaveScale, c.renormalize, c.seed);
+        for (size_t i = 0; i < count; ++i)
+        {
+            const float expected = Compute2dPerlinNoise(posX[i], posY[i], c.scale, c.numOctaves, c.persistence, c.octaveScale, c.renormalize, c.seed);
+            ASSERT_EQ(Bits(out[i]), Bits(expected)) << "2d octaves=" << c.numOctaves << " i=" << i;
+        }
+
+        Compute3dPerlinNoiseBatch(posX.data(), posY.data(), posZ.data(), out.data(), count, c.scale, c.numOctaves, c.persistence, c.octaveScale, c.renormalize, c.seed);
+        for (size_t i = 0; i < count; ++i)
+        {
+            const float expected = Compute3dPerlinNoise(posX[i], posY[i], posZ[i], c.scale, c.numOctaves, c.persistence, c.octaveScale, c.renormalize, c.seed);
+            ASSERT_EQ(Bits(out[i]), Bits(expected)) << "3d octaves=" << c.numOctaves << " i=" << i;
+        }
+    }
+}
+
+TEST(NoiseBatch, PerlinGridMatchesPointByPoint)
+{
+    // One chunk's worth of columns at a negative origin, plus a ragged slab
+    constexpr int      countX = 16, countY = 16;
+    std::vector<float> columns(countX * countY);
+    Compute2dPerlinNoiseGrid(-48.f, 32.f, 1.f, 1.f, countX, countY, columns.data(), 96.f, 4, 0.5f, 2.f, true, 1337);
+    for (int y = 0; y < countY; ++y)
+    {
+        for (int x = 0; x < countX; ++x)
+        {
+            const float expected = Compute2dPerlinNoise(static_cast<float>(-48 + x), static_cast<float>(32 + y), 96.f, 4, 0.5f, 2.f, true, 1337);
+            ASSERT_EQ(Bits(columns[y * countX + x]), Bits(expected)) << x << "," << y;
+        }
+    }
+
+    constexpr int      slabX = 13, slabY = 5, slabZ = 9;
+    std::vector<float> slab(slabX * slabY * slabZ);
+    Compute3dPerlinNoiseGrid(100.f, -7.f, 60.f, 0.5f, 2.f, 4.f, slabX, slabY, slabZ, slab.data(), 24.f, 3, 0.5f, 2.f, false, 9);
+    for (int z = 0; z < slabZ; ++z)
+    {
+        for (int y = 0; y < slabY; ++y)
+        {
+            for (int x = 0; x < slabX; ++x)
+            {
+                const float expected = Compute3dPerlinNoise(100.f + static_cast<float>(x) * 0.5f, -7.f + static_cast<float>(y) * 2.f, 60.f + static_cast<float>(z) * 4.f, 24.f, 3, 0.5f, 2.f, false, 9);
+                ASSERT_EQ(Bits(slab[(z * slabY + y) * slabX + x]), Bits(expected)) << x << "," << y << "," << z;
+            }
+        }
+    }
+}
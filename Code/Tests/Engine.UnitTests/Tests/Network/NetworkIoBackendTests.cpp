@@ -0,0 +1,346 @@
+#include <gtest/gtest.h>
+
+#include "Engine/Network/NetworkIoBackend.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <thread>
+
+using namespace enigma::network;
+
+namespace
+{
+    using Clock = std::chrono::steady_clock;
+
+    template <typename Predicate>
+    bool WaitUntil(Predicate predicate, int timeoutMs = 5000)
+    {
+        auto deadline = Clock::now() + std::chrono::milliseconds(timeoutMs);
+        while (Clock::now() < deadline)
+        {
+            if (predicate())
+            {
+                return true;
+            }
+            std::this_thread::sleep_for(std::chrono::microseconds(200));
+        }
+        return predicate();
+    }
+
+    struct LoopbackPair
+    {
+        NetworkIoBackend server;
+        NetworkIoBackend client;
+        uint16_t         port = 0;
+
+        explicit LoopbackPair(const NetworkIoBackendConfig& config = NetworkIoBackendConfig())
+            : server(config)
+              , client(config)
+        {
+        }
+
+        bool Start()
+        {
+            if (!server.Start() || !client.Start())
+            {
+                return false;
+            }
+            port = server.Listen(0, "127.0.0.1");
+            return port != 0;
+        }
+
+        // Connects count clients and returns (client id, server id) pairs once all are accepted
+        std::vector<std::pair<ConnectionId, ConnectionId>> ConnectClients(size_t count)
+        {
+            std::vector<ConnectionId> clientIds;
+            for (size_t index = 0; index < count; ++index)
+            {
+                clientIds.push_back(client.Connect("127.0.0.1", port));
+            }
+
+            std::vector<ConnectionId>           serverIds;
+            std::vector<NetworkConnectionEvent> events;
+            size_t                              clientConnected = 0;
+            WaitUntil([&]()
+            {
+                events.clear();
+                server.PollConnectionEvents(events);
+                for (const NetworkConnectionEvent& event : events)
+                {
+                    if (event.type == NetworkConnectionEventType::Connected) serverIds.push_back(event.connectionId);
+                }
+                events.clear();
+                client.PollConnectionEvents(events);
+                for (const NetworkConnectionEvent& event : events)
+                {
+                    if (event.type == NetworkConnectionEventType::Connected) ++clientConnected;
+                }
+                return serverIds.size() == count && clientConnected == count;
+            }, 20000);
+
+            std::vector<std::pair<ConnectionId, ConnectionId>> result;
+            for (size_t index = 0; index < (std::min)(clientIds.size(), serverIds.size()); ++index)
+            {
+                result.emplace_back(clientIds[index], serverIds[index]);
+            }
+            return result;
+        }
+    };
+}
+
+//=============================================================================
+// NetworkRingBuffer
+//=============================================================================
+
+TEST(NetworkRingBufferTests, WriteAndPeekAcrossWrapBoundary)
+{
+    NetworkRingBuffer ring(64);
+    ASSERT_EQ(ring.Capacity(), 64u);
+
+    uint8_t filler[48] = {};
+    ASSERT_TRUE(ring.Write(filler, sizeof(filler)));
+    ring.CommitRead(sizeof(filler));
+
+    uint8_t payload[32];
+    for (uint8_t index = 0; index < sizeof(payload); ++index) payload[index] = index;
+    ASSERT_TRUE(ring.Write(payload, sizeof(payload)));
+
+    SocketIoSpan spans[2];
+    EXPECT_EQ(ring.GetReadableSpans(spans), 2u);
+    EXPECT_EQ(spans[0].size + spans[1].size, sizeof(payload));
+    EXPECT_EQ(ring.TryGetContiguous(0, sizeof(payload)), nullptr);
+
+    uint8_t copy[32];
+    ASSERT_TRUE(ring.Peek(copy, sizeof(copy)));
+    EXPECT_EQ(std::memcmp(copy, payload, sizeof(payload)), 0);
+}
+
+TEST(NetworkRingBufferTests, WriteIsAllOrNothing)
+{
+    NetworkRingBuffer ring(64);
+    uint8_t           data[60] = {};
+    ASSERT_TRUE(ring.Write(data, sizeof(data)));
+    EXPECT_FALSE(ring.Write(data, 8));
+    EXPECT_EQ(ring.ReadableBytes(), sizeof(data));
+}
+
+//=============================================================================
+// NetworkIoBackend
+//=============================================================================
+
+TEST(NetworkIoBackendTests, DeliversLengthPrefixedFramesInOrder)
+{
+    LoopbackPair pair;
+    ASSERT_TRUE(pair.Start());
+    auto connections = pair.ConnectClients(1);
+    ASSERT_EQ(connections.size(), 1u);
+    auto [clientId, serverId] = connections[0];
+
+    for (uint32_t index = 0; index < 100; ++index)
+    {
+        std::vector<uint8_t> payload(index + 1, static_cast<uint8_t>(index));
+        ASSERT_EQ(pair.client.SendFrame(clientId, payload.data(), payload.size()), NetworkSendResult::Ok);
+    }
+
+    uint32_t received = 0;
+    ASSERT_TRUE(WaitUntil([&]()
+    {
+        NetworkFrameView frame;
+        while (pair.server.AcquireFrame(serverId, frame))
+        {
+            EXPECT_EQ(frame.size, received + 1);
+            EXPECT_EQ(frame.data[0], static_cast<uint8_t>(received));
+            pair.server.ReleaseFrame(serverId);
+            ++received;
+        }
+        return received == 100;
+    }));
+}
+
+TEST(NetworkIoBackendTests, RejectsOversizedFramesAndAppliesSendBackpressure)
+{
+    NetworkIoBackendConfig config;
+    config.maxFrameBytes = 1024;
+    config.sendRingBytes = 4096;
+    config.recvRingBytes = 4096;
+
+    LoopbackPair pair(config);
+    ASSERT_TRUE(pair.Start());
+    auto connections = pair.ConnectClients(1);
+    ASSERT_EQ(connections.size(), 1u);
+    auto [clientId, serverId] = connections[0];
+
+    std::vector<uint8_t> large(2048);
+    EXPECT_EQ(pair.client.SendFrame(clientId, large.data(), large.size()), NetworkSendResult::FrameTooLarge);
+
+    // The server never consumes, so both receive and send rings eventually fill up
+    std::vector<uint8_t> payload(1000);
+    bool                 sawBackpressure = WaitUntil([&]()
+    {
+        NetworkSendResult result = NetworkSendResult::Ok;
+        while (result == NetworkSendResult::Ok)
+        {
+            result = pair.client.SendFrame(clientId, payload.data(), payload.size());
+        }
+        return result == NetworkSendResult::Backpressure && pair.server.GetStats().receivePauseCount > 0;
+    });
+    EXPECT_TRUE(sawBackpressure);
+    EXPECT_GT(pair.client.GetStats().sendBackpressureCount, 0u);
+
+    // Draining the server resumes the flow
+    size_t drained = 0;
+    EXPECT_TRUE(WaitUntil([&]()
+    {
+        NetworkFrameView frame;
+        while (pair.server.AcquireFrame(serverId, frame))
+        {
+            pair.server.ReleaseFrame(serverId);
+            ++drained;
+        }
+        return pair.client.GetPendingSendBytes(clientId) == 0 && drained > 4;
+    }));
+}
+
+TEST(NetworkIoBackendTests, ReportsDisconnectWhenPeerCloses)
+{
+    LoopbackPair pair;
+    ASSERT_TRUE(pair.Start());
+    auto connections = pair.ConnectClients(1);
+    ASSERT_EQ(connections.size(), 1u);
+
+    pair.client.Disconnect(connections[0].first);
+
+    std::vector<NetworkConnectionEvent> events;
+    EXPECT_TRUE(WaitUntil([&]()
+    {
+        pair.server.PollConnectionEvents(events);
+        return std::any_of(events.begin(), events.end(), [](const NetworkConnectionEvent& event)
+        {
+            return event.type == NetworkConnectionEventType::Disconnected;
+        });
+    }));
+    EXPECT_FALSE(pair.server.IsConnected(connections[0].second));
+}
+
+TEST(NetworkIoBackendTests, DeliversBufferedFramesAfterPeerCloses)
+{
+    LoopbackPair pair;
+    ASSERT_TRUE(pair.Start());
+    auto connections = pair.ConnectClients(1);
+    ASSERT_EQ(connections.size(), 1u);
+    auto [clientId, serverId] = connections[0];
+
+    constexpr uint32_t kFrameCount = 200;
+    for (uint32_t index = 0; index < kFrameCount; ++index)
+    {
+        std::vector<uint8_t> payload(index % 97 + 1, static_cast<uint8_t>(index));
+        ASSERT_EQ(pair.client.SendFrame(clientId, payload.data(), payload.size()), NetworkSendResult::Ok);
+    }
+    pair.client.Disconnect(clientId);
+
+    // The server sees the close before consuming anything; the frames must still be readable
+    ASSERT_TRUE(WaitUntil([&]() { return !pair.server.IsConnected(serverId); }));
+    EXPECT_EQ(pair.server.SendFrame(serverId, "x", 1), NetworkSendResult::NotConnected);
+
+    std::vector<NetworkConnectionEvent> events;
+    pair.server.PollConnectionEvents(events);
+    EXPECT_TRUE(events.empty()) << "Disconnected must wait until the receive ring is drained";
+
+    uint32_t received = 0;
+    NetworkFrameView frame;
+    while (pair.server.AcquireFrame(serverId, frame))
+    {
+        EXPECT_EQ(frame.size, received % 97 + 1);
+        EXPECT_EQ(frame.data[0], static_cast<uint8_t>(received));
+        pair.server.ReleaseFrame(serverId);
+        ++received;
+    }
+    EXPECT_EQ(received, kFrameCount);
+
+    pair.server.PollConnectionEvents(events);
+    ASSERT_EQ(events.size(), 1u);
+    EXPECT_EQ(events[0].type, NetworkConnectionEventType::Disconnected);
+    EXPECT_EQ(events[0].connectionId, serverId);
+    EXPECT_EQ(pair.server.GetStats().activeConnections, 0u);
+}
+
+TEST(NetworkIoBackendTests, LoopbackEchoStress)
+{
+    // Full sweep up to 500 clients needs ~1000 descriptors; opt in via environment variable
+    std::vector<size_t> clientCounts = {1, 10, 100};
+    if (std::getenv("ENIGMA_NETWORK_STRESS_FULL") != nullptr)
+    {
+        clientCounts.push_back(500);
+    }
+
+    for (size_t clientCount : clientCounts)
+    {
+        LoopbackPair pair;
+        ASSERT_TRUE(pair.Start());
+        auto connections = pair.ConnectClients(clientCount);
+        ASSERT_EQ(connections.size(), clientCount);
+
+        const size_t messagesPerClient = (std::max)(static_cast<size_t>(20), static_cast<size_t>(2000) / clientCount);
+        const size_t totalMessages     = messagesPerClient * clientCount;
+
+        std::vector<size_t>   sentPerClient(clientCount, 0);
+        std::vector<size_t>   receivedPerClient(clientCount, 0);
+        std::vector<double>   latenciesUs;
+        latenciesUs.reserve(totalMessages);
+
+        auto start = Clock::now();
+        bool done  = WaitUntil([&]()
+        {
+            // Clients: keep a small window of timestamped pings in flight
+            for (size_t index = 0; index < clientCount; ++index)
+            {
+                ConnectionId clientId = connections[index].first;
+                while (sentPerClient[index] < messagesPerClient && sentPerClient[index] - receivedPerClient[index] < 8)
+                {
+                    int64_t stamp = Clock::now().time_since_epoch().count();
+                    if (pair.client.SendFrame(clientId, &stamp, sizeof(stamp)) != NetworkSendResult::Ok) break;
+                    ++sentPerClient[index];
+                }
+            }
+
+            // Server: echo every frame straight out of the receive ring
+            for (const auto& [clientId, serverId] : connections)
+            {
+                NetworkFrameView frame;
+                while (pair.server.AcquireFrame(serverId, frame))
+                {
+                    if (pair.server.SendFrame(serverId, frame.data, frame.size) != NetworkSendResult::Ok) break;
+                    pair.server.ReleaseFrame(serverId);
+                }
+            }
+
+            // Clients: collect echoes and record round-trip latency
+            for (size_t index = 0; index < clientCount; ++index)
+            {
+                ConnectionId     clientId = connections[index].first;
+                NetworkFrameView frame;
+                while (pair.client.AcquireFrame(clientId, frame))
+                {
+                    int64_t stamp = 0;
+                    std::memcpy(&stamp, frame.data, sizeof(stamp));
+                    pair.client.ReleaseFrame(clientId);
+                    latenciesUs.push_back(static_cast<double>(Clock::now().time_since_epoch().count() - stamp) / 1000.0);
+                    ++receivedPerClient[index];
+                }
+            }
+            return latenciesUs.size() == totalMessages;
+        }, 60000);
+        double seconds = std::chrono::duration<double>(Clock::now() - start).count();
+
+        ASSERT_TRUE(done) << clientCount << " clients received " << latenciesUs.size() << "/" << totalMessages;
+
+        std::sort(latenciesUs.begin(), latenciesUs.end());
+        double p50 = latenciesUs[latenciesUs.size() / 2];
+        double p99 = latenciesUs[(std::min)(latenciesUs.size() - 1, latenciesUs.size() * 99 / 100)];
+        std::printf("[ BENCH    ] %s, %zu clients: %.0f msg/s round trips, p50 %.1f us, p99 %.1f us\n",
+                    pair.server.GetPollerName(), clientCount, static_cast<double>(totalMessages) / seconds, p50, p99);
+    }
+}
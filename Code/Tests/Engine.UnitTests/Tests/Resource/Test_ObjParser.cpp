@@ -0,0 +1,132 @@
+#include <gtest/gtest.h>
+
+#include "Engine/Resource/Loader/ModelLoader/ObjParser.hpp"
+
+#include <cstdio>
+#include <string>
+
+namespace
+{
+    /// Grid of (cells+1)^2 vertices with two triangles per cell; positions are referenced with relative indices when asked
+    std::string MakeGridObj(int cells, bool relativeIndices)
+    {
+        const int   side = cells + 1;
+        std::string text;
+        text.reserve(static_cast<size_t>(side) * side * 90 + static_cast<size_t>(cells) * cells * 80);
+        text += "# synthetic grid\n";
+
+        char line[128];
+        for (int y = 0; y < side; ++y)
+        {
+            for (int x = 0; x < side; ++x)
+            {
+                std::snprintf(line, sizeof(line), "v %.4f %.4f 0.0\nvt %.4f %.4f\n", x * 0.25f, y * 0.25f,
+                              static_cast<float>(x) / cells, static_cast<float>(y) / cells);
+                text += line;
+            }
+        }
+        text += "vn 0 0 1\n";
+
+        const int vertexCount = side * side;
+        for (int y = 0; y < cells; ++y)
+        {
+            for (int x = 0; x < cells; ++x)
+            {
+                int a = y * side + x + 1;
+                int b = a + 1;
+                int c = a + side;
+                int d = c + 1;
+                if (relativeIndices)
+                {
+                    a -= vertexCount + 1;
+                    b -= vertexCount + 1;
+                    c -= vertexCount + 1;
+                    d -= vertexCount + 1;
+                }
+                std::snprintf(line, sizeof(line), "f %d/%d/1 %d/%d/1 %d/%d/1\nf %d/%d/1 %d/%d/1 %d/%d/1\n",
+                              a, a, b, b, d, d, a, a, d, d, c, c);
+                text += line;
+            }
+        }
+        return text;
+    }
+
+    void ExpectSameCorners(const ObjParseResult& lhs, const ObjParseResult& rhs)
+    {
+        ASSERT_EQ(lhs.corners.size(), rhs.corners.size());
+        ASSERT_EQ(lhs.positions.size(), rhs.positions.size());
+        for (size_t i = 0; i < lhs.corners.size(); ++i)
+        {
+            ASSERT_EQ(lhs.corners[i].posIndex, rhs.corners[i].posIndex) << "corner " << i;
+            ASSERT_EQ(lhs.corners[i].uvIndex, rhs.corners[i].uvIndex) << "corner " << i;
+            ASSERT_EQ(lhs.corners[i].normalIndex, rhs.corners[i].normalIndex) << "corner " << i;
+        }
+    }
+}
+
+TEST(ObjParserTest, ParsesElementsAndTriangulatesPolygons)
+{
+    const std::string obj =
+        "# comment\r\n"
+        "o Quad\r\n"
+        "v 0 0 0\r\n"
+        "v 1.5e0 0 0\r\n"
+        "v +1 1 -0.25\r\n"
+        "v 0 1 0\r\n"
+        "vt 0 0\n"
+        "vt 1 0\n"
+        "vn 0 0 1\n"
+        "usemtl Default\n"
+        "f 1/1/1 2/2/1 3/1/1 4/2/1\n"
+        "f 1//1 2//1 3//1\n"
+        "f 4 3 2\n"
+        "f -4/-2 -3/-1 -2/-2\n";
+
+    const ObjParseResult result = ObjParser::Parse(obj.data(), obj.size());
+
+    ASSERT_EQ(result.positions.size(), 4u);
+    EXPECT_FLOAT_EQ(result.positions[1].x, 1.5f);
+    EXPECT_FLOAT_EQ(result.positions[2].x, 1.0f);
+    EXPECT_FLOAT_EQ(result.positions[2].z, -0.25f);
+    EXPECT_EQ(result.texCoords.size(), 2u);
+    EXPECT_EQ(result.normals.size(), 1u);
+
+    // Quad fans into two triangles, then three single triangles
+    ASSERT_EQ(result.stats.triangles, 5u);
+    ASSERT_EQ(result.corners.size(), 15u);
+    EXPECT_EQ(result.corners[3].posIndex, 0);
+    EXPECT_EQ(result.corners[4].posIndex, 2);
+    EXPECT_EQ(result.corners[5].posIndex, 3);
+    EXPECT_EQ(result.corners[5].uvIndex, 1);
+    EXPECT_EQ(result.corners[6].uvIndex, -1);
+    EXPECT_EQ(result.corners[6].normalIndex, 0);
+    EXPECT_EQ(result.corners[9].normalIndex, -1);
+
+    // Relative indices count back from the elements defined so far
+    EXPECT_EQ(result.corners[12].posIndex, 0);
+    EXPECT_EQ(result.corners[12].uvIndex, 0);
+    EXPECT_EQ(result.corners[14].posIndex, 2);
+    EXPECT_EQ(result.corners[14].uvIndex, 0);
+}
+
+TEST(ObjParserTest, ChunkedParseMatchesSingleThreaded)
+{
+    // Relative indices reaching back across chunk boundaries must be rebased by the merge
+    const std::string obj = MakeGridObj(200, true);
+    ASSERT_GT(obj.size(), 3 * ObjParser::kMinChunkBytes);
+
+    const ObjParseResult serial  = ObjParser::Parse(obj.data(), obj.size(), 1);
+    const ObjParseResult chunked = ObjParser::Parse(obj.data(), obj.size(), 4);
+
+    EXPECT_EQ(serial.stats.chunks, 1u);
+    EXPECT_GT(chunked.stats.chunks, 1u);
+    EXPECT_EQ(serial.stats.triangles, 200u * 200u * 2u);
+    ExpectSameCorners(serial, chunked);
+
+    EXPECT_EQ(chunked.corners.back().posIndex, 201 * 201 - 2);
+    for (const ObjCorner& corner : chunked.corners)
+    {
+        ASSERT_GE(corner.posIndex, 0);
+        ASSERT_LT(corner.posIndex, static_cast<int>(chunked.positions.size()));
+    }
+}
@@ -0,0 +1,208 @@
+#include <gtest/gtest.h>
+
+#include "Engine/Resource/ResourceCatalog.hpp"
+#include "Engine/Resource/ResourceGlob.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <regex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+using namespace enigma::resource;
+
+namespace
+{
+    /// The per-call regex matcher ResourceSubsystem used before globs were compiled
+    bool RegexMatchesPattern(const std::string& str, const std::string& pattern)
+    {
+        std::string regexPattern = pattern;
+        regexPattern             = std::regex_replace(regexPattern, std::regex("\\."), "\\.");
+        regexPattern             = std::regex_replace(regexPattern, std::regex("\\+"), "\\+");
+        regexPattern             = std::regex_replace(regexPattern, std::regex("\\*"), ".*");
+        regexPattern             = std::regex_replace(regexPattern, std::regex("\\?"), ".");
+        return std::regex_match(str, std::regex(regexPattern));
+    }
+
+    /// 8 namespaces x 5 folders, 100k textures and sounds in total
+    std::unordered_map<ResourceLocation, ResourceMetadata> MakeSyntheticIndex(size_t count)
+    {
+        static const char* namespaces[] = {"minecraft", "engine", "simpleminer", "testmod", "modpack", "ui", "worldgen", "audio"};
+        static const char* folders[]    = {"textures/block/", "textures/item/", "textures/entity/", "models/block/", "sounds/ambient/"};
+
+        std::unordered_map<ResourceLocation, ResourceMetadata> index;
+        index.reserve(count);
+        for (size_t i = 0; i < count; ++i)
+        {
+            const char*       folder = folders[(i / 8) % 5];
+            const std::string path   = std::string(folder) + "asset_" + std::to_string(i) + (folder[0] == 's' ? ".ogg" : ".png");
+
+            ResourceMetadata metadata;
+            metadata.location = ResourceLocation(namespaces[i % 8], path);
+            metadata.type     = folder[0] == 't' ? ResourceType::TEXTURE : folder[0] == 'm' ? ResourceType::MODEL : ResourceType::SOUND;
+            index.emplace(metadata.location, metadata);
+        }
+        return index;
+    }
+}
+
+TEST(ResourceGlobTests, StarStaysInsideOneSegment)
+{
+    const ResourceGlob glob("minecraft:textures/block/*");
+
+    EXPECT_EQ(glob.GetLiteralPrefix(), "minecraft:textures/block/");
+    EXPECT_TRUE(glob.Matches("minecraft:textures/block/stone.png"));
+    EXPECT_TRUE(glob.Matches("minecraft:textures/block/"));
+    EXPECT_FALSE(glob.Matches("minecraft:textures/block/ore/iron.png"));
+    EXPECT_FALSE(glob.Matches("minecraft:textures/item/stick.png"));
+
+    const ResourceGlob suffix("textures/*.png");
+    EXPECT_TRUE(suffix.Matches("textures/grass.png"));
+    EXPECT_FALSE(suffix.Matches("textures/grass.ogg"));
+    EXPECT_FALSE(suffix.Matches("textures/block/grass.png"));
+}
+
+TEST(ResourceGlobTests, DoubleStarCrossesSegments)
+{
+    const ResourceGlob tree("textures/**");
+    EXPECT_TRUE(tree.Matches("textures/block/ore/iron.png"));
+    EXPECT_TRUE(tree.Matches("textures/"));
+    EXPECT_FALSE(tree.Matches("models/block/stone.json"));
+
+    // A whole "**" segment can also stand for no directory at all
+    const ResourceGlob anyDepth("textures/**/stone.png");
+    EXPECT_TRUE(anyDepth.Matches("textures/stone.png"));
+    EXPECT_TRUE(anyDepth.Matches("textures/block/stone.png"));
+    EXPECT_TRUE(anyDepth.Matches("textures/block/old/stone.png"));
+    EXPECT_FALSE(anyDepth.Matches("textures/block/cobblestone.png"));
+
+    const ResourceGlob anyPng("**.png");
+    EXPECT_TRUE(anyPng.Matches("a/b/c.png"));
+    EXPECT_FALSE(anyPng.Matches("a/b/c.ogg"));
+    EXPECT_TRUE(ResourceGlob("**").MatchesEverything());
+}
+
+TEST(ResourceGlobTests, QuestionMarkAndLiterals)
+{
+    const ResourceGlob glob("block/stone_?.png");
+    EXPECT_TRUE(glob.Matches("block/stone_1.png"));
+    EXPECT_FALSE(glob.Matches("block/stone_12.png"));
+    EXPECT_FALSE(glob.Matches("block/stone_/.png"));
+
+    const ResourceGlob literal("engine:textures/ui/button.png");
+    EXPECT_TRUE(literal.IsLiteral());
+    EXPECT_TRUE(literal.Matches("engine:textures/ui/button.png"));
+    EXPECT_FALSE(literal.Matches("engine:textures/ui/button.png.bak"));
+
+    // Regex metacharacters are plain text
+    EXPECT_TRUE(ResourceGlob("a+b(c).png").Matches("a+b(c).png"));
+    EXPECT_FALSE(ResourceGlob("a.png").Matches("axpng"));
+    EXPECT_TRUE(ResourceGlob("*a*a*a*b").Matches("aaaaaaaaaaaab"));
+    EXPECT_FALSE(ResourceGlob("*a*a*a*b").Matches("aaaaaaaaaaaaa"));
+}
+
+TEST(ResourceGlobTests, PathologicalPatternsDoNotBacktrackExponentially)
+{
+    // Recursive backtracking needs ~C(200, 16) attempts for each of these; the iterative matcher is linear per wildcard
+    const std::string text(200, 'a');
+    std::string       globStars;
+    std::string       stars;
+    for (int i = 0; i < 16; ++i)
+    {
+        globStars += "**a";
+        stars += "*a";
+    }
+    EXPECT_FALSE(ResourceGlob(globStars + "b").Matches(text));
+    EXPECT_FALSE(ResourceGlob(stars + "b").Matches(text));
+    EXPECT_TRUE(ResourceGlob(globStars).Matches(text));
+
+    std::string segments;
+    for (int i = 0; i < 40; ++i)
+    {
+        segments += "a/";
+    }
+    EXPECT_FALSE(ResourceGlob("**/a/**/a/**/a/**/a/**/a/**/a/**/b").Matches(segments + "c"));
+    EXPECT_TRUE(ResourceGlob("**/a/**/a/**/a/**/a/**/a/**/a/**/c").Matches(segments + "c"));
+}
+
+TEST(ResourceGlobTests, CatalogVisitsOnlyThePrefixRange)
+{
+    const auto      index = MakeSyntheticIndex(4000);
+    ResourceCatalog catalog;
+    catalog.Rebuild(index);
+    ASSERT_EQ(catalog.GetSize(), index.size());
+
+    std::vector<ResourceLocation> results;
+    const size_t                  visited = catalog.Search(ResourceGlob("minecraft:textures/block/*"), ResourceType::UNKNOWN, results);
+
+    size_t expected = 0;
+    for (const auto& [location, metadata] : index)
+    {
+        expected += location.GetNamespace() == "minecraft" && location.GetPath().rfind("textures/block/", 0) == 0 ? 1 : 0;
+    }
+    EXPECT_EQ(results.size(), expected);
+    EXPECT_EQ(visited, expected);
+    EXPECT_TRUE(std::is_sorted(results.begin(), results.end()));
+
+    // Wildcard namespaces fall back to a full scan but still match per key
+    results.clear();
+    EXPECT_EQ(catalog.Search(ResourceGlob("*:sounds/**"), ResourceType::SOUND, results), index.size());
+    EXPECT_EQ(results.size(), index.size() / 5);
+
+    results.clear();
+    catalog.ListNamespace("engine", ResourceType::TEXTURE, results);
+    EXPECT_EQ(results.size(), 300u);
+    for (const ResourceLocation& location : results)
+    {
+        EXPECT_EQ(location.GetNamespace(), "engine");
+    }
+}
+
+TEST(ResourceGlobTests, CatalogSearchAgainstRegexScan)
+{
+    const auto      index = MakeSyntheticIndex(100000);
+    ResourceCatalog catalog;
+    catalog.Rebuild(index);
+
+    const std::string pattern = "minecraft:textures/block/*";
+    using Clock               = std::chrono::steady_clock;
+
+    // Old path: one regex per (resource, pattern) over the whole index
+    const auto                    regexStart = Clock::now();
+    std::vector<ResourceLocation> regexResults;
+    for (const auto& [location, metadata] : index)
+    {
+        if (RegexMatchesPattern(location.ToString(), pattern))
+        {
+            regexResults.push_back(location);
+        }
+    }
+    const double regexMs = std::chrono::duration<double, std::milli>(Clock::now() - regexStart).count();
+
+    const auto                    globStart = Clock::now();
+    std::vector<ResourceLocation> globResults;
+    const ResourceGlob            glob(pattern);
+    const size_t                  visited = catalog.Search(glob, ResourceType::UNKNOWN, globResults);
+    const double                  globMs  = std::chrono::duration<double, std::milli>(Clock::now() - globStart).count();
+
+    // The flat layout has no nested folders, so regex '*' and glob '*' agree here
+    std::sort(regexResults.begin(), regexResults.end());
+    EXPECT_EQ(globResults, regexResults);
+
+    // Full scan with the compiled matcher, no prefix range
+    const auto         scanStart = Clock::now();
+    size_t             scanHits  = 0;
+    const ResourceGlob anyNamespace("*:textures/block/*");
+    for (const auto& [location, metadata] : index)
+    {
+        scanHits += anyNamespace.Matches(location.ToString()) ? 1 : 0;
+    }
+    const double scanMs = std::chrono::duration<double, std::milli>(Clock::now() - scanStart).count();
+
+    std::printf("[ BENCH    ] %zu locations, \"%s\": regex scan %.1f ms, compiled glob full scan %.2f ms (%zu hits), catalog range %.3f ms (%zu visited, %zu hits)\n",
+                index.size(), pattern.c_str(), regexMs, scanMs, scanHits, globMs, visited, globResults.size());
+    EXPECT_EQ(visited, globResults.size());
+    EXPECT_LT(globMs, regexMs);
+}
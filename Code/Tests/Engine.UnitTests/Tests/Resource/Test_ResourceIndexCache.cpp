@@ -0,0 +1,200 @@
+#include <gtest/gtest.h>
+
+#include "Engine/Resource/Provider/ResourceProvider.hpp"
+#include "Engine/Resource/ResourceIndexCache.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+
+using namespace enigma::resource;
+
+namespace
+{
+    class ResourceIndexCacheTest : public ::testing::Test
+    {
+    protected:
+        void SetUp() override
+        {
+            m_root = std::filesystem::temp_directory_path() / "enigma_resource_index_cache_test";
+            std::filesystem::remove_all(m_root);
+            m_assets    = m_root / "assets" / "testmod";
+            m_cacheFile = m_root / "cache" / "resource_index.bin";
+            std::filesystem::create_directories(m_assets);
+        }
+
+        void TearDown() override
+        {
+            std::filesystem::remove_all(m_root);
+        }
+
+        void WriteFile(const std::filesystem::path& relative, const std::string& contents = "x")
+        {
+            const std::filesystem::path path = m_assets / relative;
+            std::filesystem::create_directories(path.parent_path());
+            std::ofstream(path, std::ios::binary) << contents;
+        }
+
+        /// Fresh directories fall inside the racy-mtime window; age them so the cache trusts them
+        void AgeDirectories()
+        {
+            const auto past = std::filesystem::file_time_type::clock::now() - std::chrono::hours(1);
+            std::filesystem::last_write_time(m_assets, past);
+            for (const auto& entry : std::filesystem::recursive_directory_iterator(m_assets))
+            {
+                if (entry.is_directory())
+                {
+                    std::filesystem::last_write_time(entry.path(), past);
+                }
+            }
+        }
+
+        std::vector<std::string> Index(ResourceIndexCache* cache) const
+        {
+            FileSystemResourceProvider provider(m_root / "assets", "test");
+            provider.SetNamespaceMapping("testmod", m_assets);
+
+            std::vector<std::string> keys;
+            for (const ResourceMetadata& metadata : provider.BuildIndex(cache))
+            {
+                keys.push_back(metadata.location.ToString() + "|" + metadata.filePath.filename().string());
+            }
+            std::sort(keys.begin(), keys.end());
+            return keys;
+        }
+
+        std::filesystem::path m_root;
+        std::filesystem::path m_assets;
+        std::filesystem::path m_cacheFile;
+    };
+}
+
+TEST_F(ResourceIndexCacheTest, WarmScanReusesUnchangedDirectories)
+{
+    WriteFile("textures/block/stone.png");
+    WriteFile("textures/block/dirt.png");
+    WriteFile("textures/item/stick.png");
+    WriteFile("models/block/stone.json");
+    AgeDirectories();
+
+    ResourceIndexCache cold;
+    const auto         coldKeys = Index(&cold);
+    EXPECT_EQ(coldKeys.size(), 4u);
+    EXPECT_EQ(cold.GetStats().directoriesReused, 0u);
+    ASSERT_TRUE(cold.Save(m_cacheFile));
+
+    ResourceIndexCache warm;
+    ASSERT_TRUE(warm.Load(m_cacheFile));
+    EXPECT_EQ(Index(&warm), coldKeys);
+    EXPECT_EQ(warm.GetStats().directoriesScanned, 0u);
+    EXPECT_EQ(warm.GetStats().directoriesReused, 6u); // root, textures, textures/block, textures/item, models, models/block
+    EXPECT_FALSE(warm.IsDirty());
+
+    // A new file only bumps the mtime of its own directory
+    WriteFile("textures/item/apple.png");
+    warm.ResetStats();
+    const auto updatedKeys = Index(&warm);
+    EXPECT_EQ(updatedKeys.size(), 5u);
+    EXPECT_TRUE(std::find(updatedKeys.begin(), updatedKeys.end(), "testmod:textures/item/apple|apple.png") != updatedKeys.end());
+    EXPECT_EQ(warm.GetStats().directoriesScanned, 1u);
+    EXPECT_TRUE(warm.IsDirty());
+
+    // Removing a directory rescans its parent and drops everything below it; textures/item was
+    // just modified, so it stays in the racy window and is listed again as well
+    std::filesystem::remove_all(m_assets / "models");
+    warm.ResetStats();
+    EXPECT_EQ(Index(&warm).size(), 4u);
+    EXPECT_EQ(warm.GetStats().directoriesScanned, 2u);
+}
+
+TEST_F(ResourceIndexCacheTest, ResolvesExtensionsLikeGetMetadata)
+{
+    WriteFile("textures/block/stone.png");
+    WriteFile("textures/block/stone.jpg");  // ".png" comes first in the search order
+    WriteFile("textures/block/notes.mcmeta"); // Unknown extension: GetMetadata() cannot resolve it
+    AgeDirectories();
+
+    FileSystemResourceProvider provider(m_root / "assets", "test");
+    provider.SetNamespaceMapping("testmod", m_assets);
+
+    const auto indexed = provider.BuildIndex(nullptr);
+    ASSERT_EQ(indexed.size(), 1u);
+    EXPECT_EQ(indexed[0].location.ToString(), "testmod:textures/block/stone");
+    EXPECT_EQ(indexed[0].filePath.filename().string(), "stone.png");
+    EXPECT_EQ(indexed[0].type, ResourceType::TEXTURE);
+
+    auto legacy = provider.GetMetadata(indexed[0].location);
+    ASSERT_TRUE(legacy.has_value());
+    EXPECT_EQ(legacy->filePath, indexed[0].filePath);
+    EXPECT_EQ(legacy->fileSize, indexed[0].fileSize);
+}
+
+TEST_F(ResourceIndexCacheTest, InvalidCacheFallsBackToFullScan)
+{
+    WriteFile("textures/block/stone.png");
+    WriteFile("sounds/ambient/wind.ogg");
+    AgeDirectories();
+
+    ResourceIndexCache cache;
+    const auto         keys = Index(&cache);
+    ASSERT_TRUE(cache.Save(m_cacheFile));
+
+    // Cut the file short: Load() rejects it and the scan lists every directory again
+    const auto size = std::filesystem::file_size(m_cacheFile);
+    std::filesystem::resize_file(m_cacheFile, size - 3);
+
+    ResourceIndexCache truncated;
+    EXPECT_FALSE(truncated.Load(m_cacheFile));
+    EXPECT_TRUE(truncated.IsEmpty());
+    EXPECT_EQ(Index(&truncated), keys);
+    EXPECT_EQ(truncated.GetStats().directoriesReused, 0u);
+    EXPECT_GT(truncated.GetStats().directoriesScanned, 0u);
+
+    ResourceIndexCache missing;
+    EXPECT_FALSE(missing.Load(m_root / "cache" / "does_not_exist.bin"));
+}
+
+TEST_F(ResourceIndexCacheTest, ColdVersusWarmStartupScan)
+{
+    // 50k textures in 100 folders of 500, the shape of a large resource pack
+    constexpr int folderCount    = 100;
+    constexpr int filesPerFolder = 500;
+    for (int folder = 0; folder < folderCount; ++folder)
+    {
+        const std::filesystem::path directory = m_assets / "textures" / ("set_" + std::to_string(folder));
+        std::filesystem::create_directories(directory);
+        for (int file = 0; file < filesPerFolder; ++file)
+        {
+            std::ofstream(directory / ("tile_" + std::to_string(file) + ".png"), std::ios::binary) << "png";
+        }
+    }
+    AgeDirectories();
+
+    using Clock = std::chrono::steady_clock;
+
+    const auto         coldStart = Clock::now();
+    ResourceIndexCache cold;
+    cold.Load(m_cacheFile); // No file yet: full walk
+    const size_t coldCount = Index(&cold).size();
+    cold.Save(m_cacheFile);
+    const double coldMs = std::chrono::duration<double, std::milli>(Clock::now() - coldStart).count();
+
+    const auto         warmStart = Clock::now();
+    ResourceIndexCache warm;
+    ASSERT_TRUE(warm.Load(m_cacheFile));
+    const size_t warmCount = Index(&warm).size();
+    const double warmMs    = std::chrono::duration<double, std::milli>(Clock::now() - warmStart).count();
+
+    std::printf("[ BENCH    ] resource index of %d files: cold cache %.1f ms, warm cache %.1f ms (%zu directories reused, cache file %ju KB)\n",
+                folderCount * filesPerFolder, coldMs, warmMs, warm.GetStats().directoriesReused,
+                static_cast<uintmax_t>(std::filesystem::file_size(m_cacheFile) / 1024));
+
+    EXPECT_EQ(coldCount, static_cast<size_t>(folderCount * filesPerFolder));
+    EXPECT_EQ(warmCount, coldCount);
+    EXPECT_EQ(warm.GetStats().directoriesScanned, 0u);
+    EXPECT_LT(warmMs, coldMs);
+}
@@ -0,0 +1,210 @@
+#include <gtest/gtest.h>
+
+#include "Engine/Resource/Atlas/AtlasPacker.hpp"
+#include "Engine/Resource/Atlas/TextureAtlas.hpp"
+
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <memory>
+#include <string>
+#include <vector>
+
+using namespace enigma::resource;
+
+namespace
+{
+    bool Overlaps(IntVec2 posA, IntVec2 sizeA, IntVec2 posB, IntVec2 sizeB)
+    {
+        return posA.x < posB.x + sizeB.x && posB.x < posA.x + sizeA.x &&
+            posA.y < posB.y + sizeB.y && posB.y < posA.y + sizeA.y;
+    }
+
+    /// Solid-colour image whose texels encode the sprite index, so copies can be checked
+    std::shared_ptr<ImageResource> MakeImage(const std::string& path, IntVec2 size, int index)
+    {
+        ResourceMetadata metadata(ResourceLocation("test", path), std::filesystem::path("textures") / (path + ".png"));
+        metadata.fileSize     = static_cast<std::uintmax_t>(size.x * size.y);
+        metadata.lastModified = std::filesystem::file_time_type(std::filesystem::file_time_type::duration(1000 + index));
+
+        const Rgba8 color(static_cast<unsigned char>(index & 0xFF), static_cast<unsigned char>((index >> 8) & 0xFF), 200, 255);
+        return std::make_shared<ImageResource>(metadata, std::make_unique<Image>(size, color));
+    }
+
+    AtlasConfig MakeConfig(int padding, bool autoScale)
+    {
+        AtlasConfig config("test_atlas");
+        config.AddDirectorySource("textures/");
+        config.SetResolutionMode(16, autoScale);
+        config.padding       = padding;
+        config.exportPNG     = false;
+        config.useBakedCache = false;
+        return config;
+    }
+
+    void ExpectNoOverlaps(const TextureAtlas& atlas, int padding)
+    {
+        const std::vector<AtlasSprite>& sprites = atlas.GetAllSprites();
+        const IntVec2                   pad(padding, padding);
+        for (size_t i = 0; i < sprites.size(); ++i)
+        {
+            const IntVec2 cellA = sprites[i].atlasPosition - pad;
+            EXPECT_GE(cellA.x, 0);
+            EXPECT_GE(cellA.y, 0);
+            EXPECT_LE(sprites[i].atlasPosition.x + sprites[i].size.x + padding, atlas.GetAtlasDimensions().x);
+            EXPECT_LE(sprites[i].atlasPosition.y + sprites[i].size.y + padding, atlas.GetAtlasDimensions().y);
+            for (size_t j = i + 1; j < sprites.size(); ++j)
+            {
+                ASSERT_FALSE(Overlaps(cellA, sprites[i].size + pad + pad, sprites[j].atlasPosition - pad, sprites[j].size + pad + pad))
+                    << sprites[i].location.ToString() << " overlaps " << sprites[j].location.ToString();
+            }
+        }
+    }
+}
+
+TEST(AtlasPackerTest, UniformCellsFillTheBinExactly)
+{
+    AtlasPacker packer(IntVec2(64, 64));
+
+    std::vector<IntVec2> positions;
+    for (int i = 0; i < 16; ++i)
+    {
+        IntVec2 position;
+        ASSERT_TRUE(packer.Insert(IntVec2(16, 16), position)) << "cell " << i;
+        for (const IntVec2& other : positions)
+        {
+            EXPECT_FALSE(Overlaps(position, IntVec2(16, 16), other, IntVec2(16, 16)));
+        }
+        positions.push_back(position);
+    }
+
+    IntVec2 position;
+    EXPECT_FALSE(packer.Insert(IntVec2(16, 16), position));
+    EXPECT_FLOAT_EQ(packer.GetOccupancy(), 1.0f);
+}
+
+TEST(AtlasPackerTest, MixedCellsDoNotOverlap)
+{
+    AtlasPacker packer(IntVec2(128, 128));
+
+    const IntVec2        sizes[] = {IntVec2(64, 32), IntVec2(32, 32), IntVec2(18, 18), IntVec2(48, 16), IntVec2(16, 64), IntVec2(18, 18)};
+    std::vector<IntVec2> placedPositions;
+    std::vector<IntVec2> placedSizes;
+    for (const IntVec2& size : sizes)
+    {
+        IntVec2 position;
+        ASSERT_TRUE(packer.Insert(size, position));
+        EXPECT_LE(position.x + size.x, 128);
+        EXPECT_LE(position.y + size.y, 128);
+        for (size_t i = 0; i < placedPositions.size(); ++i)
+        {
+            EXPECT_FALSE(Overlaps(position, size, placedPositions[i], placedSizes[i]));
+        }
+        placedPositions.push_back(position);
+        placedSizes.push_back(size);
+    }
+
+    IntVec2 position;
+    EXPECT_FALSE(packer.Insert(IntVec2(129, 1), position));
+}
+
+TEST(TextureAtlasPackingTest, PaddedSpritesPackTightlyAndKeepTheirPixels)
+{
+    // 300 16px sprites with 1px padding: the old grid packer needed 512x512 for this set
+    std::vector<std::shared_ptr<ImageResource>> images;
+    for (int i = 0; i < 300; ++i)
+    {
+        images.push_back(MakeImage("block/sprite_" + std::to_string(i), IntVec2(16, 16), i));
+    }
+
+    TextureAtlas atlas(MakeConfig(1, true));
+    ASSERT_TRUE(atlas.BuildAtlas(images));
+
+    const AtlasStats& stats = atlas.GetStats();
+    EXPECT_EQ(stats.totalSprites, 300);
+    EXPECT_EQ(stats.droppedSprites, 0);
+    EXPECT_EQ(atlas.GetAtlasDimensions(), IntVec2(512, 256));
+    ExpectNoOverlaps(atlas, 1);
+
+    for (int i = 0; i < 300; i += 37)
+    {
+        const AtlasSprite* sprite = atlas.FindSprite(ResourceLocation("test", "block/sprite_" + std::to_string(i)));
+        ASSERT_NE(sprite, nullptr);
+        const Rgba8 texel = atlas.GetAtlasImage()->GetTexelColor(sprite->atlasPosition + IntVec2(15, 15));
+        EXPECT_EQ(texel.r, static_cast<unsigned char>(i & 0xFF));
+        EXPECT_EQ(texel.g, static_cast<unsigned char>((i >> 8) & 0xFF));
+
+        // Clamp-to-edge extrusion fills the padding ring with the edge colour
+        const Rgba8 border = atlas.GetAtlasImage()->GetTexelColor(sprite->atlasPosition - IntVec2(1, 0));
+        EXPECT_EQ(border.r, texel.r);
+    }
+
+    std::printf("[ BENCH    ] 300 padded 16px sprites: %dx%d, %.1f%% packing efficiency, built in %.3f ms\n",
+                stats.atlasWidth, stats.atlasHeight, stats.packingEfficiency, stats.buildMs);
+}
+
+TEST(TextureAtlasPackingTest, MismatchedSpritesKeepNativeSizeWithoutAutoScale)
+{
+    std::vector<std::shared_ptr<ImageResource>> images;
+    images.push_back(MakeImage("item/small", IntVec2(16, 16), 1));
+    images.push_back(MakeImage("item/large", IntVec2(64, 64), 2));
+    images.push_back(MakeImage("item/wide", IntVec2(32, 16), 3));
+
+    TextureAtlas atlas(MakeConfig(2, false));
+    ASSERT_TRUE(atlas.BuildAtlas(images));
+
+    const AtlasSprite* large = atlas.FindSprite(ResourceLocation("test", "item/large"));
+    ASSERT_NE(large, nullptr);
+    EXPECT_EQ(large->size, IntVec2(64, 64));
+    ExpectNoOverlaps(atlas, 2);
+    EXPECT_GT(atlas.GetStats().packingEfficiency, 0.0f);
+}
+
+TEST(TextureAtlasPackingTest, BakedAtlasRoundTripsAndRejectsChangedInputs)
+{
+    const std::filesystem::path bakedFile = std::filesystem::temp_directory_path() / "enigma_texture_atlas_test" / "test_atlas.atlas";
+    std::filesystem::remove_all(bakedFile.parent_path());
+
+    std::vector<std::shared_ptr<ImageResource>> images;
+    for (int i = 0; i < 1024; ++i)
+    {
+        images.push_back(MakeImage("block/sprite_" + std::to_string(i), IntVec2(16, 16), i));
+    }
+
+    const AtlasConfig config = MakeConfig(1, true);
+    const uint64_t    key    = TextureAtlas::ComputeBakeKey(config, images);
+
+    TextureAtlas built(config);
+    ASSERT_TRUE(built.BuildAtlas(images));
+    ASSERT_TRUE(built.SaveBaked(bakedFile, key));
+
+    TextureAtlas warm(config);
+    ASSERT_TRUE(warm.LoadBaked(bakedFile, key));
+    EXPECT_TRUE(warm.GetStats().loadedFromBaked);
+    EXPECT_EQ(warm.GetAtlasDimensions(), built.GetAtlasDimensions());
+    ASSERT_EQ(warm.GetAllSprites().size(), built.GetAllSprites().size());
+    for (const AtlasSprite& sprite : built.GetAllSprites())
+    {
+        const AtlasSprite* loaded = warm.FindSprite(sprite.location);
+        ASSERT_NE(loaded, nullptr);
+        EXPECT_EQ(loaded->atlasPosition, sprite.atlasPosition);
+        EXPECT_EQ(loaded->size, sprite.size);
+        EXPECT_EQ(loaded->uvMax.x, sprite.uvMax.x);
+    }
+    EXPECT_EQ(std::memcmp(warm.GetRawData(), built.GetRawData(), built.GetRawDataSize()), 0);
+
+    std::printf("[ BENCH    ] 1024-sprite atlas: packed in %.3f ms, warm start from baked file in %.3f ms (%.1f%% efficiency)\n",
+                built.GetStats().buildMs, warm.GetStats().buildMs, warm.GetStats().packingEfficiency);
+
+    // A touched input file changes the key, and a stale bake is refused
+    images[7] = MakeImage("block/sprite_7", IntVec2(16, 16), 99999);
+    const uint64_t changedKey = TextureAtlas::ComputeBakeKey(config, images);
+    EXPECT_NE(changedKey, key);
+
+    TextureAtlas stale(config);
+    EXPECT_FALSE(stale.LoadBaked(bakedFile, changedKey));
+    EXPECT_FALSE(stale.IsLoaded());
+
+    std::filesystem::remove_all(bakedFile.parent_path());
+}
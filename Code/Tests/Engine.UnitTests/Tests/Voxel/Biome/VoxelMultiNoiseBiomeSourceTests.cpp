@@ -0,0 +1,186 @@
+#include <gtest/gtest.h>
+
+#include "Engine/Voxel/Biome/MultiNoiseBiomeSource.hpp"
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <random>
+#include <string>
+
+using namespace enigma::voxel;
+
+namespace
+{
+    constexpr int kBiomeCount = 64;
+
+    Climate::TargetPoint RandomPoint(std::mt19937& rng)
+    {
+        std::uniform_real_distribution<float> dist(-1.0f, 1.0f);
+        float                                 t = dist(rng);
+        float                                 h = dist(rng);
+        float                                 c = dist(rng);
+        float                                 e = dist(rng);
+        float                                 w = dist(rng);
+        return Climate::TargetPoint(t, h, c, e, w);
+    }
+
+    std::unique_ptr<MultiNoiseBiomeSource> CreateSource(int biomeCount, uint32_t seed)
+    {
+        auto         source = std::make_unique<MultiNoiseBiomeSource>(nullptr);
+        std::mt19937 rng(seed);
+        for (int index = 0; index < biomeCount; ++index)
+        {
+            source->RegisterBiome(RandomPoint(rng), std::make_shared<Biome>("biome_" + std::to_string(index), Biome::ClimateSettings(), Biome::SurfaceRules()));
+        }
+        return source;
+    }
+}
+
+TEST(VoxelMultiNoiseBiomeSourceTests, SearchTreeMatchesLinearScan)
+{
+    auto source = CreateSource(kBiomeCount, 1337u);
+
+    std::mt19937 rng(42u);
+    for (int index = 0; index < 20000; ++index)
+    {
+        Climate::TargetPoint target = RandomPoint(rng);
+        ASSERT_EQ(source->FindNearestBiome(target), source->FindNearestBiomeLinear(target));
+    }
+}
+
+TEST(VoxelMultiNoiseBiomeSourceTests, TiesResolveToFirstRegisteredBiome)
+{
+    MultiNoiseBiomeSource source(nullptr);
+    auto                  first  = std::make_shared<Biome>();
+    auto                  second = std::make_shared<Biome>();
+    auto                  third  = std::make_shared<Biome>();
+
+    // second and third are equidistant from the origin; first is farther away
+    source.RegisterBiome(Climate::TargetPoint(0.9f, 0.9f, 0.9f, 0.9f, 0.9f), first);
+    source.RegisterBiome(Climate::TargetPoint(0.5f, 0.0f, 0.0f, 0.0f, 0.0f), second);
+    source.RegisterBiome(Climate::TargetPoint(-0.5f, 0.0f, 0.0f, 0.0f, 0.0f), third);
+
+    Climate::TargetPoint origin;
+    EXPECT_EQ(source.FindNearestBiomeLinear(origin), second);
+    EXPECT_EQ(source.FindNearestBiome(origin), second);
+}
+
+TEST(VoxelMultiNoiseBiomeSourceTests, RegisterInvalidatesSearchTree)
+{
+    auto source = CreateSource(kBiomeCount, 7u);
+    source->BuildSearchTree();
+
+    Climate::TargetPoint target(0.25f, -0.25f, 0.5f, -0.5f, 0.0f);
+    auto                 exact = std::make_shared<Biome>();
+    source->RegisterBiome(target, exact);
+
+    EXPECT_EQ(source->FindNearestBiome(target), exact);
+}
+
+TEST(VoxelMultiNoiseBiomeSourceTests, GetBiomesMatchesPerQuartQueries)
+{
+    auto source = CreateSource(kBiomeCount, 99u);
+
+    MultiNoiseBiomeSource::QuartArea area;
+    area.minQuartX = -2;
+    area.minQuartY = 0;
+    area.minQuartZ = 3;
+    area.sizeX     = 4;
+    area.sizeY     = 2;
+    area.sizeZ     = 4;
+
+    std::vector<std::shared_ptr<Biome>> biomes;
+    source->GetBiomes(area, biomes);
+    ASSERT_EQ(biomes.size(), area.GetCount());
+
+    size_t index = 0;
+    for (int y = 0; y < area.sizeY; ++y)
+    {
+        for (int z = 0; z < area.sizeZ; ++z)
+        {
+            for (int x = 0; x < area.sizeX; ++x)
+            {
+                auto expected = source->GetBiome((area.minQuartX + x) * 4, (area.minQuartY + y) * 4, (area.minQuartZ + z) * 4);
+                EXPECT_EQ(biomes[index++], expected);
+            }
+        }
+    }
+}
+
+TEST(VoxelMultiNoiseBiomeSourceTests, GetBiomeSharesQuartCache)
+{
+    auto source = CreateSource(kBiomeCount, 5u);
+
+    // blocks -1..-4 live in quart -1, blocks 0..3 in quart 0
+    EXPECT_EQ(source->GetBiome(-1, 0, 0), source->GetBiomeAtQuart(-1, 0, 0));
+    EXPECT_EQ(source->GetBiome(-4, 3, 3), source->GetBiomeAtQuart(-1, 0, 0));
+    EXPECT_EQ(source->GetBiome(3, 3, 3), source->GetBiomeAtQuart(0, 0, 0));
+    EXPECT_EQ(source->GetQuartCacheSize(), 2u);
+}
+
+TEST(VoxelMultiNoiseBiomeSourceTests, QuartCacheKeepsFarCoordinatesDistinct)
+{
+    auto source = CreateSource(kBiomeCount, 11u);
+
+    // These differ only above bit 20 and collided under the old packed 21-bit key
+    source->GetBiomeAtQuart(0, 0, 0);
+    source->GetBiomeAtQuart(1 << 21, 0, 0);
+    source->GetBiomeAtQuart(0, 0, -(1 << 21));
+    source->GetBiomeAtQuart(INT32_MAX, INT32_MIN, INT32_MAX);
+    EXPECT_EQ(source->GetQuartCacheSize(), 4u);
+}
+
+TEST(VoxelMultiNoiseBiomeSourceTests, QuartCacheEvictsInsteadOfClearing)
+{
+    auto         source   = CreateSource(kBiomeCount, 13u);
+    const size_t capacity = MultiNoiseBiomeSource::kQuartCacheCapacity;
+
+    for (size_t index = 0; index < capacity + 1000; ++index)
+    {
+        source->GetBiomeAtQuart(static_cast<int>(index), 0, 0);
+        ASSERT_LE(source->GetQuartCacheSize(), capacity);
+    }
+    EXPECT_EQ(source->GetQuartCacheSize(), capacity);
+}
+
+TEST(VoxelMultiNoiseBiomeSourceTests, BenchmarkSearchTreeAgainstLinearScan)
+{
+    using Clock = std::chrono::steady_clock;
+
+    std::mt19937                      rng(5u);
+    std::vector<Climate::TargetPoint> targets;
+    targets.reserve(100000);
+    for (int index = 0; index < 100000; ++index)
+    {
+        targets.push_back(RandomPoint(rng));
+    }
+
+    for (int biomeCount : {kBiomeCount, kBiomeCount * 4, kBiomeCount * 16})
+    {
+        auto source = CreateSource(biomeCount, 2024u);
+        source->BuildSearchTree();
+
+        size_t checksumLinear = 0;
+        auto   linearStart    = Clock::now();
+        for (const Climate::TargetPoint& target : targets)
+        {
+            checksumLinear += reinterpret_cast<size_t>(source->FindNearestBiomeLinear(target).get());
+        }
+        auto linearEnd = Clock::now();
+
+        size_t checksumTree = 0;
+        auto   treeStart    = Clock::now();
+        for (const Climate::TargetPoint& target : targets)
+        {
+            checksumTree += reinterpret_cast<size_t>(source->FindNearestBiome(target).get());
+        }
+        auto treeEnd = Clock::now();
+
+        EXPECT_EQ(checksumLinear, checksumTree);
+
+        double linearNs = std::chrono::duration<double, std::nano>(linearEnd - linearStart).count() / static_cast<double>(targets.size());
+        double treeNs   = std::chrono::duration<double, std::nano>(treeEnd - treeStart).count() / static_cast<double>(targets.size());
+        std::printf("[ BENCH    ] %d biomes: linear %.1f ns/query, kd-tree %.1f ns/query\n", biomeCount, linearNs, treeNs);
+    }
+}
@@ -0,0 +1,258 @@
+#include <gtest/gtest.h>
+
+#include "Engine/Registry/Block/Block.hpp"
+#include "Engine/Voxel/Chunk/Chunk.hpp"
+#include "Engine/Voxel/Chunk/ChunkBatchRegionBuilder.hpp"
+#include "Engine/Voxel/Chunk/ChunkMesh.hpp"
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <memory>
+#include <vector>
+
+using namespace enigma::voxel;
+
+namespace
+{
+    // Free-standing block: chunk storage only stores BlockState pointers, no registry needed
+    struct TestBlocks
+    {
+        enigma::registry::block::Block air{"air", "test"};
+
+        TestBlocks()
+        {
+            air.GenerateBlockStates();
+        }
+
+        BlockState* Air() const { return air.GetDefaultState(); }
+    };
+
+    std::array<enigma::graphic::TerrainVertex, 4> MakeQuad(float tag)
+    {
+        std::array<enigma::graphic::TerrainVertex, 4> quad;
+        for (size_t i = 0; i < quad.size(); ++i)
+        {
+            // TerrainVertex leaves the integer fields uninitialized; outputs are compared bytewise
+            quad[i].m_position = Vec3(tag, static_cast<float>(i), static_cast<float>(i & 1));
+            quad[i].m_entityId = static_cast<uint16_t>(i);
+            quad[i].m_padding  = 0;
+        }
+        return quad;
+    }
+
+    /// Mesh with a per-chunk mix of layers; an empty layer exercises the skipped-slice path
+    std::unique_ptr<ChunkMesh> MakeMesh(uint32_t opaqueQuads, uint32_t cutoutQuads, uint32_t translucentQuads, float variant)
+    {
+        auto mesh = std::make_unique<ChunkMesh>();
+        for (uint32_t i = 0; i < opaqueQuads; ++i)
+        {
+            mesh->AddOpaqueTerrainQuad(MakeQuad(variant + static_cast<float>(i)), (i & 1) != 0);
+        }
+        for (uint32_t i = 0; i < cutoutQuads; ++i)
+        {
+            mesh->AddCutoutTerrainQuad(MakeQuad(variant + 0.25f + static_cast<float>(i)), false);
+        }
+        for (uint32_t i = 0; i < translucentQuads; ++i)
+        {
+            mesh->AddTranslucentTerrainQuad(MakeQuad(variant + 0.5f + static_cast<float>(i)), true);
+        }
+        return mesh;
+    }
+
+    struct TestRegion
+    {
+        std::vector<std::unique_ptr<Chunk>> chunks;
+
+        ChunkBatchRegionBuildInput MakeInput(const ChunkBatchRegionId& regionId) const
+        {
+            ChunkBatchRegionBuildInput input{regionId, {}};
+            for (const std::unique_ptr<Chunk>& chunk : chunks)
+            {
+                input.chunks.push_back(chunk.get());
+            }
+            return input;
+        }
+    };
+
+    Chunk& AddChunk(TestRegion& region, const TestBlocks& blocks, IntVec2 coords, std::unique_ptr<ChunkMesh> mesh, bool active = true)
+    {
+        auto chunk = std::make_unique<Chunk>(coords, blocks.Air());
+        chunk->SetMesh(std::move(mesh));
+        if (active)
+        {
+            chunk->TrySetState(chunk->GetState(), ChunkState::Active);
+        }
+        region.chunks.push_back(std::move(chunk));
+        return *region.chunks.back();
+    }
+
+    /// Every chunk slot of the region filled, with uneven layer mixes
+    TestRegion MakeFullRegion(const TestBlocks& blocks, const ChunkBatchRegionId& regionId, uint32_t quadScale)
+    {
+        TestRegion    region;
+        const IntVec2 minCoords = GetChunkBatchRegionMinChunkCoords(regionId);
+        for (int32_t y = CHUNK_BATCH_REGION_SIZE_Y - 1; y >= 0; --y) // Reverse order: the builder sorts
+        {
+            for (int32_t x = 0; x < CHUNK_BATCH_REGION_SIZE_X; ++x)
+            {
+                const uint32_t seed = static_cast<uint32_t>(y * CHUNK_BATCH_REGION_SIZE_X + x);
+                AddChunk(region, blocks, minCoords + IntVec2(x, y),
+                         MakeMesh(quadScale * (3 + seed % 5), quadScale * (seed % 3), (seed % 4 == 0) ? 0 : quadScale * (1 + seed % 2),
+                                  static_cast<float>(seed) * 1000.f));
+            }
+        }
+        return region;
+    }
+
+    template <typename T>
+    bool SameBytes(const std::vector<T>& lhs, const std::vector<T>& rhs)
+    {
+        return lhs.size() == rhs.size() && (lhs.empty() || std::memcmp(lhs.data(), rhs.data(), lhs.size() * sizeof(T)) == 0);
+    }
+
+    void ExpectSameSlice(const ChunkBatchChunkLayerSlice& actual, const ChunkBatchChunkLayerSlice& expected)
+    {
+        EXPECT_EQ(actual.startIndex, expected.startIndex);
+        EXPECT_EQ(actual.indexCount, expected.indexCount);
+        EXPECT_EQ(actual.reservedIndexCount, expected.reservedIndexCount);
+    }
+
+    void ExpectSameSubDraws(const std::vector<ChunkBatchSubDraw>& actual, const std::vector<ChunkBatchSubDraw>& expected)
+    {
+        ASSERT_EQ(actual.size(), expected.size());
+        for (size_t i = 0; i < actual.size(); ++i)
+        {
+            EXPECT_EQ(actual[i].startIndex, expected[i].startIndex) << "sub-draw " << i;
+            EXPECT_EQ(actual[i].indexCount, expected[i].indexCount) << "sub-draw " << i;
+        }
+    }
+
+    void ExpectSameOutput(const ChunkBatchRegionBuildOutput& actual, const ChunkBatchRegionBuildOutput& expected)
+    {
+        EXPECT_EQ(actual.totalVertexCapacity, expected.totalVertexCapacity);
+        EXPECT_EQ(actual.totalIndexCapacity, expected.totalIndexCapacity);
+        EXPECT_TRUE(SameBytes(actual.vertices, expected.vertices));
+        EXPECT_TRUE(SameBytes(actual.indices, expected.indices));
+
+        EXPECT_EQ(actual.geometry.worldBounds.m_mins, expected.geometry.worldBounds.m_mins);
+        EXPECT_EQ(actual.geometry.worldBounds.m_maxs, expected.geometry.worldBounds.m_maxs);
+        EXPECT_EQ(actual.geometry.opaque.startIndex, expected.geometry.opaque.startIndex);
+        EXPECT_EQ(actual.geometry.opaque.indexCount, expected.geometry.opaque.indexCount);
+        EXPECT_EQ(actual.geometry.cutout.indexCount, expected.geometry.cutout.indexCount);
+        EXPECT_EQ(actual.geometry.translucent.indexCount, expected.geometry.translucent.indexCount);
+        ExpectSameSubDraws(actual.geometry.opaqueSubDraws, expected.geometry.opaqueSubDraws);
+        ExpectSameSubDraws(actual.geometry.cutoutSubDraws, expected.geometry.cutoutSubDraws);
+        ExpectSameSubDraws(actual.geometry.translucentSubDraws, expected.geometry.translucentSubDraws);
+
+        ASSERT_EQ(actual.chunkOutputs.size(), expected.chunkOutputs.size());
+        for (size_t i = 0; i < actual.chunkOutputs.size(); ++i)
+        {
+            const ChunkBatchChunkBuildOutput& a = actual.chunkOutputs[i];
+            const ChunkBatchChunkBuildOutput& e = expected.chunkOutputs[i];
+            EXPECT_EQ(a.chunkCoords, e.chunkCoords) << "chunk " << i;
+            EXPECT_EQ(a.vertexAllocation.startElement, e.vertexAllocation.startElement) << "chunk " << i;
+            EXPECT_EQ(a.vertexAllocation.elementCount, e.vertexAllocation.elementCount) << "chunk " << i;
+            ExpectSameSlice(a.opaque, e.opaque);
+            ExpectSameSlice(a.cutout, e.cutout);
+            ExpectSameSlice(a.translucent, e.translucent);
+            EXPECT_EQ(a.worldBounds.m_mins, e.worldBounds.m_mins) << "chunk " << i;
+            EXPECT_EQ(a.hasWorldBounds, e.hasWorldBounds) << "chunk " << i;
+        }
+    }
+
+    template <typename Fn>
+    double MedianMicroseconds(int runs, Fn&& fn)
+    {
+        std::vector<double> samples;
+        for (int run = 0; run < runs; ++run)
+        {
+            const auto start = std::chrono::steady_clock::now();
+            fn();
+            samples.push_back(std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count());
+        }
+        std::sort(samples.begin(), samples.end());
+        return samples[samples.size() / 2];
+    }
+}
+
+//=============================================================================
+// Correctness
+//=============================================================================
+
+TEST(VoxelChunkBatchRegionBuildTests, SnapshotBuildMatchesLiveBuild)
+{
+    TestBlocks               blocks;
+    const ChunkBatchRegionId regionId{IntVec2(-1, 2)};
+    TestRegion               region = MakeFullRegion(blocks, regionId, 1);
+
+    // Ineligible inputs both paths must skip: outside the region, inactive, empty mesh, duplicate
+    AddChunk(region, blocks, GetChunkBatchRegionMaxChunkCoords(regionId) + IntVec2(1, 0), MakeMesh(4, 0, 0, 7.f));
+    AddChunk(region, blocks, GetChunkBatchRegionMinChunkCoords(regionId), MakeMesh(4, 0, 0, 9.f), false);
+    region.chunks[1]->SetMesh(std::make_unique<ChunkMesh>());
+    ChunkBatchRegionBuildInput input = region.MakeInput(regionId);
+    input.chunks.push_back(region.chunks[0].get());
+
+    const ChunkBatchRegionBuildOutput   live     = ChunkBatchRegionBuilder::BuildRegionGeometry(input);
+    const ChunkBatchRegionBuildSnapshot snapshot = ChunkBatchRegionBuilder::CaptureRegionSnapshot(input, 42);
+    EXPECT_EQ(snapshot.generation, 42u);
+    EXPECT_EQ(snapshot.chunks.size(), static_cast<size_t>(CHUNK_BATCH_REGION_SIZE_X * CHUNK_BATCH_REGION_SIZE_Y - 1));
+    ASSERT_TRUE(live.HasCpuGeometry());
+
+    ExpectSameOutput(ChunkBatchRegionBuilder::BuildRegionGeometry(snapshot), live);
+}
+
+TEST(VoxelChunkBatchRegionBuildTests, SnapshotIsIndependentOfLiveMeshes)
+{
+    TestBlocks                        blocks;
+    const ChunkBatchRegionId          regionId{IntVec2(0, 0)};
+    TestRegion                        region   = MakeFullRegion(blocks, regionId, 2);
+    const ChunkBatchRegionBuildInput  input    = region.MakeInput(regionId);
+    const ChunkBatchRegionBuildOutput before   = ChunkBatchRegionBuilder::BuildRegionGeometry(input);
+    ChunkBatchRegionBuildSnapshot     snapshot = ChunkBatchRegionBuilder::CaptureRegionSnapshot(input);
+
+    // What the main thread does while a worker holds the snapshot: meshes replaced, patched, unloaded
+    const ChunkMesh* sharedMesh = region.chunks[1]->GetChunkMesh();
+    region.chunks[0]->SetMesh(MakeMesh(1, 1, 1, -5.f));
+    region.chunks[1]->GetMutableChunkMesh()->Clear();
+    region.chunks[2]->SetMesh(nullptr);
+    EXPECT_NE(region.chunks[1]->GetChunkMesh(), sharedMesh); // Copied on write, the snapshot keeps the original
+
+    ExpectSameOutput(ChunkBatchRegionBuilder::BuildRegionGeometry(snapshot), before);
+
+    // Once the snapshot lets go, writes land in the chunk's mesh in place
+    snapshot.chunks.clear();
+    const ChunkMesh* unsharedMesh = region.chunks[3]->GetChunkMesh();
+    EXPECT_EQ(region.chunks[3]->GetMutableChunkMesh(), unsharedMesh);
+}
+
+//=============================================================================
+// Main-thread cost per dirty region
+//=============================================================================
+
+TEST(VoxelChunkBatchRegionBuildTests, MainThreadCostPerDirtyRegion)
+{
+    // Terrain-like region: 16 chunks at a few thousand quads each
+    TestBlocks                       blocks;
+    const ChunkBatchRegionId         regionId{IntVec2(3, -2)};
+    TestRegion                       region = MakeFullRegion(blocks, regionId, 400);
+    const ChunkBatchRegionBuildInput input  = region.MakeInput(regionId);
+
+    constexpr int                 kRuns = 7;
+    ChunkBatchRegionBuildSnapshot snapshot;
+    ChunkBatchRegionBuildOutput   output;
+    const double syncUs = MedianMicroseconds(kRuns, [&]() { output = ChunkBatchRegionBuilder::BuildRegionGeometry(input); });
+    const double snapshotUs = MedianMicroseconds(kRuns, [&]() { snapshot = ChunkBatchRegionBuilder::CaptureRegionSnapshot(input); });
+    const double workerUs = MedianMicroseconds(kRuns, [&]() { output = ChunkBatchRegionBuilder::BuildRegionGeometry(snapshot); });
+
+    std::printf("[ BENCH    ] dirty region (%zu vertices): main thread %.0f us sync build, %.0f us snapshot (%.1fx); worker assembly %.0f us\n",
+                output.vertices.size(), syncUs, snapshotUs, snapshotUs > 0.0 ? syncUs / snapshotUs : 0.0, workerUs);
+    RecordProperty("syncBuildUs", static_cast<int>(syncUs));
+    RecordProperty("snapshotUs", static_cast<int>(snapshotUs));
+    RecordProperty("workerAssemblyUs", static_cast<int>(workerUs));
+
+    // Snapshot is plain vector copies; assembly re-translates, re-bases and lays out every vertex and index
+    EXPECT_LT(snapshotUs, syncUs);
+}
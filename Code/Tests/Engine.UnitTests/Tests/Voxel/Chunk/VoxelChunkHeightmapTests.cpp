@@ -0,0 +1,321 @@
+#include <gtest/gtest.h>
+
+#include "Engine/Registry/Block/Block.hpp"
+#include "Engine/Voxel/Chunk/Chunk.hpp"
+#include "Engine/Voxel/Chunk/ChunkHeightmap.hpp"
+
+#include <array>
+#include <chrono>
+#include <cstdio>
+#include <random>
+
+using namespace enigma::voxel;
+
+namespace
+{
+    // Free-standing blocks with the flags BlockRegistry would load from YAML
+    struct TestBlocks
+    {
+        enigma::registry::block::Block air{"air", "test"};
+        enigma::registry::block::Block stone{"stone", "test"};
+        enigma::registry::block::Block glass{"glass", "test"}; // Blocks motion, lets light through
+        enigma::registry::block::Block flower{"flower", "test"}; // Surface only: no collision, transparent
+
+        TestBlocks()
+        {
+            air.SetVisible(false);
+            air.SetCanOcclude(false);
+            air.SetFullBlock(false);
+            glass.SetCanOcclude(false);
+            flower.SetCanOcclude(false);
+            flower.SetFullBlock(false);
+
+            for (auto* block : {&air, &stone, &glass, &flower})
+            {
+                block->GenerateBlockStates();
+            }
+        }
+
+        BlockState* Air() const { return air.GetDefaultState(); }
+        BlockState* Stone() const { return stone.GetDefaultState(); }
+        BlockState* Glass() const { return glass.GetDefaultState(); }
+        BlockState* Flower() const { return flower.GetDefaultState(); }
+    };
+
+    // Terrain-like column layout: stone up to a varying height, occasional glass/flower on top
+    void GenerateTerrain(Chunk& chunk, const TestBlocks& blocks)
+    {
+        for (int32_t y = 0; y < Chunk::CHUNK_SIZE_Y; ++y)
+        {
+            for (int32_t x = 0; x < Chunk::CHUNK_SIZE_X; ++x)
+            {
+                int32_t ground = 60 + ((x * 7 + y * 13) % 20);
+                for (int32_t z = 0; z <= ground; ++z)
+                {
+                    chunk.SetBlock(x, y, z, blocks.Stone());
+                }
+                if ((x + y) % 3 == 0) chunk.SetBlock(x, y, ground + 1, blocks.Flower());
+                if ((x + y) % 5 == 0) chunk.SetBlock(x, y, ground + 4, blocks.Glass());
+            }
+        }
+    }
+
+    // Pre-heightmap GetTopBlockZ: linear scan down from z
+    int LegacyTopBlockZ(const Chunk& chunk, BlockState* air, int32_t x, int32_t y, int32_t z)
+    {
+        for (; z >= 0; --z)
+        {
+            BlockState* block = chunk.GetBlock(x, y, z);
+            if (block && block != air)
+            {
+                return z;
+            }
+        }
+        return -1;
+    }
+
+    std::array<ChunkHeightmap, HEIGHTMAP_TYPE_COUNT> Snapshot(const Chunk& chunk)
+    {
+        std::array<ChunkHeightmap, HEIGHTMAP_TYPE_COUNT> heightmaps;
+        for (size_t t = 0; t < HEIGHTMAP_TYPE_COUNT; ++t)
+        {
+            heightmaps[t] = chunk.GetHeightmap(static_cast<HeightmapType>(t));
+        }
+        return heightmaps;
+    }
+}
+
+//=============================================================================
+// Correctness
+//=============================================================================
+
+TEST(VoxelChunkHeightmapTests, FillStateInitializesHeights)
+{
+    TestBlocks blocks;
+    Chunk      empty(IntVec2(0, 0), blocks.Air());
+    Chunk      solid(IntVec2(1, 0), blocks.Stone());
+
+    for (size_t t = 0; t < HEIGHTMAP_TYPE_COUNT; ++t)
+    {
+        HeightmapType type = static_cast<HeightmapType>(t);
+        EXPECT_EQ(empty.GetHeight(type, 3, 4), ChunkHeightmap::NO_BLOCK);
+        EXPECT_EQ(solid.GetHeight(type, 3, 4), Chunk::CHUNK_MAX_Z);
+    }
+
+    solid.ResetForReuse(IntVec2(2, 0), blocks.Air());
+    EXPECT_EQ(solid.GetHeight(HeightmapType::WorldSurface, 15, 15), ChunkHeightmap::NO_BLOCK);
+}
+
+TEST(VoxelChunkHeightmapTests, TypesTrackTheirOwnPredicate)
+{
+    TestBlocks blocks;
+    Chunk      chunk(IntVec2(0, 0), blocks.Air());
+
+    chunk.SetBlock(2, 2, 10, blocks.Stone());
+    chunk.SetBlock(2, 2, 11, blocks.Glass());
+    chunk.SetBlock(2, 2, 12, blocks.Flower());
+
+    EXPECT_EQ(chunk.GetHeight(HeightmapType::WorldSurface, 2, 2), 12);
+    EXPECT_EQ(chunk.GetHeight(HeightmapType::MotionBlocking, 2, 2), 11);
+    EXPECT_EQ(chunk.GetHeight(HeightmapType::LightBlocking, 2, 2), 10);
+
+    // Removing the top of each column rescans down to the next match
+    chunk.SetBlockByPlayer(2, 2, 12, blocks.Air());
+    chunk.SetBlockByPlayer(2, 2, 11, blocks.Air());
+    EXPECT_EQ(chunk.GetHeight(HeightmapType::WorldSurface, 2, 2), 10);
+    EXPECT_EQ(chunk.GetHeight(HeightmapType::MotionBlocking, 2, 2), 10);
+
+    chunk.SetBlockByPlayer(2, 2, 10, blocks.Air());
+    EXPECT_EQ(chunk.GetHeight(HeightmapType::LightBlocking, 2, 2), ChunkHeightmap::NO_BLOCK);
+}
+
+TEST(VoxelChunkHeightmapTests, IncrementalUpdatesMatchFullRecompute)
+{
+    TestBlocks blocks;
+    Chunk      chunk(IntVec2(0, 0), blocks.Air());
+    GenerateTerrain(chunk, blocks);
+
+    std::mt19937                       rng(1234);
+    std::uniform_int_distribution<int> column(0, Chunk::CHUNK_MAX_X);
+    std::uniform_int_distribution<int> height(40, 110);
+    std::uniform_int_distribution<int> pick(0, 3);
+    BlockState*                        palette[] = {blocks.Air(), blocks.Stone(), blocks.Glass(), blocks.Flower()};
+
+    for (int i = 0; i < 20000; ++i)
+    {
+        chunk.SetBlockByPlayer(column(rng), column(rng), height(rng), palette[pick(rng)]);
+    }
+
+    auto incremental = Snapshot(chunk);
+    chunk.RecomputeHeightmaps();
+    auto recomputed = Snapshot(chunk);
+    for (size_t t = 0; t < HEIGHTMAP_TYPE_COUNT; ++t)
+    {
+        EXPECT_EQ(incremental[t], recomputed[t]) << "heightmap type " << t;
+    }
+}
+
+TEST(VoxelChunkHeightmapTests, BulkEditColumnRecomputeMatchesPerBlockWrites)
+{
+    TestBlocks blocks;
+    Chunk      perBlock(IntVec2(0, 0), blocks.Air());
+    Chunk      bulk(IntVec2(0, 0), blocks.Air());
+    GenerateTerrain(perBlock, blocks);
+    GenerateTerrain(bulk, blocks);
+    bulk.ClearMeshSectionsDirty();
+
+    // Carve a cave through the terrain and cap part of it with glass, as a structure paste would
+    for (int32_t z = 50; z <= 90; ++z)
+    {
+        for (int32_t y = 4; y <= 11; ++y)
+        {
+            for (int32_t x = 2; x <= 9; ++x)
+            {
+                BlockState* state = z >= 88 && x < 6 ? blocks.Glass() : blocks.Air();
+                perBlock.SetBlockByPlayer(x, y, z, state);
+                bulk.SetBlockForBulkEdit(x, y, z, state);
+            }
+        }
+    }
+
+    // Bulk writes leave heightmaps and mesh dirtiness for the commit
+    EXPECT_EQ(bulk.GetDirtyMeshSectionMask(), 0u);
+    for (int32_t y = 4; y <= 11; ++y)
+    {
+        for (int32_t x = 2; x <= 9; ++x)
+        {
+            bulk.RecomputeColumnHeightmaps(x, y);
+        }
+    }
+    bulk.MarkMeshSectionsDirty(50, 90);
+
+    auto expected = Snapshot(perBlock);
+    auto actual   = Snapshot(bulk);
+    for (size_t t = 0; t < HEIGHTMAP_TYPE_COUNT; ++t)
+    {
+        EXPECT_EQ(expected[t], actual[t]) << "heightmap type " << t;
+    }
+    EXPECT_EQ(bulk.GetDirtyMeshSectionMask(), (1u << 3) | (1u << 4) | (1u << 5)); // z 49..91 with the one-block margin
+    EXPECT_TRUE(bulk.IsPlayerModified());
+    EXPECT_TRUE(bulk.NeedsMeshRebuild());
+}
+
+TEST(VoxelChunkHeightmapTests, TopBlockQueriesUseSurfaceAndScanBelowIt)
+{
+    TestBlocks blocks;
+    Chunk      chunk(IntVec2(-1, 2), blocks.Air());
+    BlockPos   origin = chunk.GetWorldPos();
+
+    for (int32_t z = 0; z <= 50; ++z)
+    {
+        chunk.SetBlock(5, 6, z, blocks.Stone());
+    }
+    chunk.SetBlock(5, 6, 40, blocks.Air()); // Cave pocket below the surface
+    chunk.SetBlock(5, 6, 41, blocks.Air());
+
+    BlockPos column(origin.x + 5, origin.y + 6, Chunk::CHUNK_MAX_Z);
+    EXPECT_EQ(chunk.GetTopBlockZ(column), 50);
+    EXPECT_EQ(chunk.GetTopBlock(column), blocks.Stone());
+
+    BlockPos inCave(origin.x + 5, origin.y + 6, 41);
+    EXPECT_EQ(chunk.GetTopBlockZ(inCave), 39);
+
+    BlockPos emptyColumn(origin.x + 1, origin.y + 1, Chunk::CHUNK_MAX_Z);
+    EXPECT_EQ(chunk.GetTopBlockZ(emptyColumn), -1);
+    EXPECT_EQ(chunk.GetTopBlock(emptyColumn), nullptr);
+}
+
+TEST(VoxelChunkHeightmapTests, SkyColumnsMatchOpacityScan)
+{
+    TestBlocks blocks;
+    Chunk      chunk(IntVec2(0, 0), blocks.Air());
+    GenerateTerrain(chunk, blocks);
+
+    for (int32_t y = 0; y < Chunk::CHUNK_SIZE_Y; ++y)
+    {
+        for (int32_t x = 0; x < Chunk::CHUNK_SIZE_X; ++x)
+        {
+            int32_t scanned = -1;
+            for (int32_t z = Chunk::CHUNK_MAX_Z; z >= 0; --z)
+            {
+                BlockState* state = chunk.GetBlock(x, y, z);
+                if (state->GetBlock()->IsOpaque(state))
+                {
+                    scanned = z;
+                    break;
+                }
+            }
+            ASSERT_EQ(chunk.GetHeight(HeightmapType::LightBlocking, x, y), scanned) << "column " << x << "," << y;
+        }
+    }
+}
+
+//=============================================================================
+// Benchmarks
+//=============================================================================
+
+TEST(VoxelChunkHeightmapTests, TopBlockQueryThroughput)
+{
+    TestBlocks blocks;
+    Chunk      chunk(IntVec2(0, 0), blocks.Air());
+    GenerateTerrain(chunk, blocks);
+
+    constexpr int kRounds = 2000;
+    volatile int  sink    = 0;
+
+    auto start = std::chrono::steady_clock::now();
+    for (int r = 0; r < kRounds; ++r)
+        for (int32_t y = 0; y < Chunk::CHUNK_SIZE_Y; ++y)
+            for (int32_t x = 0; x < Chunk::CHUNK_SIZE_X; ++x)
+                sink = sink + LegacyTopBlockZ(chunk, blocks.Air(), x, y, Chunk::CHUNK_MAX_Z);
+    double scanNs = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+
+    start = std::chrono::steady_clock::now();
+    for (int r = 0; r < kRounds; ++r)
+        for (int32_t y = 0; y < Chunk::CHUNK_SIZE_Y; ++y)
+            for (int32_t x = 0; x < Chunk::CHUNK_SIZE_X; ++x)
+                sink = sink + chunk.GetHeight(HeightmapType::WorldSurface, x, y);
+    double heightmapNs = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+
+    const double queries = static_cast<double>(kRounds) * ChunkHeightmap::COLUMN_COUNT;
+    std::printf("[ BENCH    ] top-block query: column scan %.1f ns, heightmap %.2f ns (%.0fx)\n",
+                scanNs / queries, heightmapNs / queries, scanNs / heightmapNs);
+}
+
+TEST(VoxelChunkHeightmapTests, SkyLightInitialFill)
+{
+    TestBlocks blocks;
+    Chunk      chunk(IntVec2(0, 0), blocks.Air());
+    GenerateTerrain(chunk, blocks);
+
+    constexpr int kRounds = 50;
+
+    // Pre-heightmap InitializeLighting step 3: per-block opacity test down every column
+    auto start = std::chrono::steady_clock::now();
+    for (int r = 0; r < kRounds; ++r)
+        for (int32_t x = 0; x < Chunk::CHUNK_SIZE_X; ++x)
+            for (int32_t y = 0; y < Chunk::CHUNK_SIZE_Y; ++y)
+                for (int32_t z = Chunk::CHUNK_MAX_Z; z >= 0; --z)
+                {
+                    BlockState* state = chunk.GetBlock(x, y, z);
+                    if (state->GetBlock()->IsOpaque(state))
+                        break;
+                    chunk.SetIsSky(x, y, z, true);
+                    chunk.SetSkyLight(x, y, z, 15);
+                }
+    double scanUs = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+
+    start = std::chrono::steady_clock::now();
+    for (int r = 0; r < kRounds; ++r)
+        for (int32_t x = 0; x < Chunk::CHUNK_SIZE_X; ++x)
+            for (int32_t y = 0; y < Chunk::CHUNK_SIZE_Y; ++y)
+                for (int32_t z = Chunk::CHUNK_MAX_Z; z > chunk.GetHeight(HeightmapType::LightBlocking, x, y); --z)
+                {
+                    chunk.SetIsSky(x, y, z, true);
+                    chunk.SetSkyLight(x, y, z, 15);
+                }
+    double heightmapUs = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+
+    std::printf("[ BENCH    ] sky-light initial fill per chunk: opacity scan %.1f us, heightmap %.1f us\n",
+                scanUs / kRounds, heightmapUs / kRounds);
+}
@@ -0,0 +1,173 @@
+#include <gtest/gtest.h>
+
+#include "Engine/Voxel/Chunk/ChunkMesh.hpp"
+#include "Engine/Voxel/Chunk/ChunkMeshBufferPool.hpp"
+
+#include <array>
+#include <chrono>
+#include <cstdio>
+#include <memory>
+
+using namespace enigma::voxel;
+
+namespace
+{
+    ChunkMeshCapacityHint MakeHint(uint32_t opaque, uint32_t cutout = 0, uint32_t translucent = 0)
+    {
+        ChunkMeshCapacityHint hint;
+        hint.opaqueQuads      = opaque;
+        hint.cutoutQuads      = cutout;
+        hint.translucentQuads = translucent;
+        hint.fromHistory      = true;
+        return hint;
+    }
+}
+
+TEST(VoxelChunkMeshBufferPoolTests, SizeClassesArePowersOfTwo)
+{
+    EXPECT_EQ(ChunkMeshBufferPool::GetSizeClass(0), 0u);
+    EXPECT_EQ(ChunkMeshBufferPool::GetSizeClass(511), 0u);
+    EXPECT_EQ(ChunkMeshBufferPool::GetSizeClass(512), 1u);
+    EXPECT_EQ(ChunkMeshBufferPool::GetSizeClass(1023), 1u);
+    EXPECT_EQ(ChunkMeshBufferPool::GetSizeClass(1024), 2u);
+    EXPECT_EQ(ChunkMeshBufferPool::GetSizeClass(size_t{1} << 30), ChunkMeshBufferPool::CLASS_COUNT - 1);
+}
+
+TEST(VoxelChunkMeshBufferPoolTests, ReleasedMeshIsReusedWithCapacity)
+{
+    ChunkMeshBufferPool pool;
+
+    std::unique_ptr<ChunkMesh> mesh = pool.Acquire(MakeHint(2000, 100, 50));
+    ASSERT_NE(mesh, nullptr);
+    EXPECT_GE(mesh->GetQuadCapacity(), 2150u);
+    EXPECT_EQ(pool.GetStats().allocationCount, 1u);
+
+    const ChunkMesh* storage  = mesh.get();
+    const size_t     capacity = mesh->GetCapacityBytes();
+    pool.Release(std::move(mesh));
+
+    ChunkMeshBufferPoolStats stats = pool.GetStats();
+    EXPECT_EQ(stats.pooledMeshes, 1u);
+    EXPECT_EQ(stats.retainedBytes, capacity);
+
+    // A smaller request is served by the pooled mesh without shrinking it
+    mesh = pool.Acquire(MakeHint(1500, 100, 50));
+    EXPECT_EQ(mesh.get(), storage);
+    EXPECT_TRUE(mesh->IsEmpty());
+    EXPECT_EQ(mesh->GetCapacityBytes(), capacity);
+
+    stats = pool.GetStats();
+    EXPECT_EQ(stats.acquireCount, 2u);
+    EXPECT_EQ(stats.hitCount, 1u);
+    EXPECT_EQ(stats.allocationCount, 1u);
+    EXPECT_EQ(stats.pooledMeshes, 0u);
+    EXPECT_EQ(stats.retainedBytes, 0u);
+    EXPECT_DOUBLE_EQ(stats.GetHitRate(), 0.5);
+}
+
+TEST(VoxelChunkMeshBufferPoolTests, AcquireSkipsMeshesThatAreTooSmall)
+{
+    ChunkMeshBufferPool pool;
+    pool.Release(pool.Acquire(MakeHint(300)));
+
+    std::unique_ptr<ChunkMesh> mesh = pool.Acquire(MakeHint(5000));
+    EXPECT_GE(mesh->GetQuadCapacity(), 5000u);
+
+    const ChunkMeshBufferPoolStats stats = pool.GetStats();
+    EXPECT_EQ(stats.hitCount, 0u);
+    EXPECT_EQ(stats.allocationCount, 2u);
+    EXPECT_EQ(stats.pooledMeshes, 1u); // The small mesh stays pooled for a small chunk
+}
+
+TEST(VoxelChunkMeshBufferPoolTests, CapsDiscardAndTrim)
+{
+    ChunkMeshBufferPoolConfig config;
+    config.maxMeshesPerClass = 2;
+    ChunkMeshBufferPool pool(config);
+
+    for (int i = 0; i < 3; ++i)
+    {
+        pool.Release(std::make_unique<ChunkMesh>());
+    }
+    EXPECT_EQ(pool.GetStats().discardCount, 3u); // Meshes without capacity are never kept
+
+    std::unique_ptr<ChunkMesh> meshes[3];
+    for (std::unique_ptr<ChunkMesh>& mesh : meshes)
+    {
+        mesh = pool.Acquire(MakeHint(600));
+    }
+    for (std::unique_ptr<ChunkMesh>& mesh : meshes)
+    {
+        pool.Release(std::move(mesh));
+    }
+
+    ChunkMeshBufferPoolStats stats = pool.GetStats();
+    EXPECT_EQ(stats.pooledMeshes, 2u);
+    EXPECT_EQ(stats.discardCount, 4u);
+
+    pool.Trim();
+    stats = pool.GetStats();
+    EXPECT_EQ(stats.pooledMeshes, 0u);
+    EXPECT_EQ(stats.retainedBytes, 0u);
+    EXPECT_EQ(stats.trimmedCount, 2u);
+}
+
+TEST(VoxelChunkMeshBufferPoolTests, RecordsBuildTimes)
+{
+    ChunkMeshBufferPool pool;
+    for (uint64_t us = 1; us <= 100; ++us)
+    {
+        pool.RecordBuild(us, us % 10 == 0);
+    }
+
+    ChunkMeshBufferPoolStats stats = pool.GetStats();
+    EXPECT_EQ(stats.buildCount, 100u);
+    EXPECT_EQ(stats.growCount, 10u);
+    EXPECT_EQ(stats.buildMaxUs, 100u);
+    EXPECT_NEAR(stats.buildMeanUs, 50.5, 1e-9);
+    EXPECT_LE(stats.buildP50Us, stats.buildP99Us);
+
+    pool.ResetStats();
+    stats = pool.GetStats();
+    EXPECT_EQ(stats.buildCount, 0u);
+    EXPECT_EQ(stats.growCount, 0u);
+}
+
+TEST(VoxelChunkMeshBufferPoolTests, Benchmark_PooledAcquireVsFreshAllocation)
+{
+    constexpr int      ITERATIONS = 200;
+    constexpr uint32_t QUADS      = 12000;
+
+    auto fill = [](ChunkMesh& mesh)
+    {
+        std::array<enigma::graphic::TerrainVertex, 4> quad;
+        for (uint32_t i = 0; i < QUADS; ++i)
+        {
+            mesh.AddOpaqueTerrainQuad(quad, false);
+        }
+    };
+
+    const auto freshStart = std::chrono::steady_clock::now();
+    for (int i = 0; i < ITERATIONS; ++i)
+    {
+        ChunkMesh mesh;
+        fill(mesh);
+    }
+    const double freshMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - freshStart).count();
+
+    ChunkMeshBufferPool pool;
+    const auto          pooledStart = std::chrono::steady_clock::now();
+    for (int i = 0; i < ITERATIONS; ++i)
+    {
+        std::unique_ptr<ChunkMesh> mesh = pool.Acquire(MakeHint(QUADS));
+        fill(*mesh);
+        pool.Release(std::move(mesh));
+    }
+    const double pooledMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - pooledStart).count();
+
+    const ChunkMeshBufferPoolStats stats = pool.GetStats();
+    std::printf("[ BENCH    ] %d meshes x %u quads: fresh %.2f ms, pooled %.2f ms (hit rate %.1f%%, %llu allocations)\n",
+                ITERATIONS, QUADS, freshMs, pooledMs, stats.GetHitRate() * 100.0,
+                static_cast<unsigned long long>(stats.allocationCount));
+    EXPECT_EQ(stats.allocationCount, 1u);
+}
@@ -0,0 +1,172 @@
+#include <gtest/gtest.h>
+
+#include "Engine/Voxel/Chunk/ChunkMesh.hpp"
+
+#include <array>
+#include <vector>
+
+using namespace enigma::voxel;
+
+namespace
+{
+    struct SectionQuads
+    {
+        uint32_t opaque      = 0;
+        uint32_t cutout      = 0;
+        uint32_t translucent = 0;
+    };
+
+    std::array<enigma::graphic::TerrainVertex, 4> MakeQuad(float tag)
+    {
+        std::array<enigma::graphic::TerrainVertex, 4> quad;
+        for (size_t i = 0; i < quad.size(); ++i)
+        {
+            quad[i].m_position = Vec3(tag, static_cast<float>(i), 0.f);
+        }
+        return quad;
+    }
+
+    /// Emits sections the way ChunkMeshBuilder does; quad tags encode (section, layer, index, variant)
+    void EmitSections(ChunkMesh& mesh, const std::vector<SectionQuads>& layout, uint32_t firstSection, uint32_t endSection, float variant)
+    {
+        for (uint32_t section = firstSection; section < endSection; ++section)
+        {
+            mesh.BeginSection(section);
+            const SectionQuads& quads = layout[section];
+            for (uint32_t i = 0; i < quads.opaque; ++i)
+            {
+                mesh.AddOpaqueTerrainQuad(MakeQuad(section * 1000.f + i + variant), (i & 1) != 0);
+            }
+            for (uint32_t i = 0; i < quads.cutout; ++i)
+            {
+                mesh.AddCutoutTerrainQuad(MakeQuad(section * 1000.f + 300.f + i + variant), false);
+            }
+            for (uint32_t i = 0; i < quads.translucent; ++i)
+            {
+                mesh.AddTranslucentTerrainQuad(MakeQuad(section * 1000.f + 600.f + i + variant), true);
+            }
+        }
+        mesh.EndSections();
+    }
+
+    void ExpectSameGeometry(const ChunkMesh& actual, const ChunkMesh& expected)
+    {
+        auto expectLayer = [](const std::vector<enigma::graphic::TerrainVertex>& actualVertices, const std::vector<uint32_t>& actualIndices,
+                              const std::vector<enigma::graphic::TerrainVertex>& expectedVertices, const std::vector<uint32_t>& expectedIndices)
+        {
+            ASSERT_EQ(actualVertices.size(), expectedVertices.size());
+            for (size_t i = 0; i < actualVertices.size(); ++i)
+            {
+                EXPECT_EQ(actualVertices[i].m_position.x, expectedVertices[i].m_position.x) << "vertex " << i;
+            }
+            EXPECT_EQ(actualIndices, expectedIndices);
+        };
+
+        expectLayer(actual.GetOpaqueTerrainVertices(), actual.GetOpaqueIndices(), expected.GetOpaqueTerrainVertices(), expected.GetOpaqueIndices());
+        expectLayer(actual.GetCutoutTerrainVertices(), actual.GetCutoutIndices(), expected.GetCutoutTerrainVertices(), expected.GetCutoutIndices());
+        expectLayer(actual.GetTranslucentTerrainVertices(), actual.GetTranslucentIndices(),
+                    expected.GetTranslucentTerrainVertices(), expected.GetTranslucentIndices());
+
+        for (uint32_t layer = 0; layer < ChunkMesh::LAYER_COUNT; ++layer)
+        {
+            for (uint32_t section = 0; section <= ChunkMesh::MESH_SECTION_COUNT; ++section)
+            {
+                EXPECT_EQ(actual.GetSectionQuadStart(layer, section), expected.GetSectionQuadStart(layer, section))
+                    << "layer " << layer << " section " << section;
+            }
+        }
+    }
+
+    std::vector<SectionQuads> MakeLayout()
+    {
+        std::vector<SectionQuads> layout(ChunkMesh::MESH_SECTION_COUNT);
+        for (uint32_t section = 0; section < ChunkMesh::MESH_SECTION_COUNT; ++section)
+        {
+            layout[section] = SectionQuads{(section * 7) % 11, section % 3, (section == 4 || section == 5) ? 2u : 0u};
+        }
+        return layout;
+    }
+}
+
+TEST(VoxelChunkMeshSectionTests, EndSectionsRecordsContiguousRanges)
+{
+    const std::vector<SectionQuads> layout = MakeLayout();
+    ChunkMesh                       mesh;
+    EmitSections(mesh, layout, 0, ChunkMesh::MESH_SECTION_COUNT, 0.f);
+
+    ASSERT_TRUE(mesh.HasSectionRanges());
+    uint32_t opaqueStart = 0;
+    for (uint32_t section = 0; section < ChunkMesh::MESH_SECTION_COUNT; ++section)
+    {
+        EXPECT_EQ(mesh.GetSectionQuadStart(0, section), opaqueStart);
+        opaqueStart += layout[section].opaque;
+    }
+    EXPECT_EQ(mesh.GetSectionQuadStart(0, ChunkMesh::MESH_SECTION_COUNT), mesh.GetLayerQuadCount(0));
+
+    mesh.Clear();
+    EXPECT_FALSE(mesh.HasSectionRanges());
+}
+
+TEST(VoxelChunkMeshSectionTests, ReplaceSectionsMatchesFullRebuild)
+{
+    const std::vector<SectionQuads> layout = MakeLayout();
+
+    // Grow opaque, shrink cutout to zero and add translucent in sections 4..6
+    std::vector<SectionQuads> edited = layout;
+    edited[4]                        = SectionQuads{layout[4].opaque + 3, 0, 1};
+    edited[5]                        = SectionQuads{layout[5].opaque, 0, 4};
+    edited[6]                        = SectionQuads{0, layout[6].cutout, 1};
+
+    ChunkMesh mesh;
+    EmitSections(mesh, layout, 0, ChunkMesh::MESH_SECTION_COUNT, 0.f);
+
+    ChunkMesh sectionMesh;
+    EmitSections(sectionMesh, edited, 4, 7, 0.5f);
+
+    ChunkMeshSectionPatch patch;
+    ASSERT_TRUE(mesh.ReplaceSections(4, 7, sectionMesh, patch));
+
+    // Reference: the whole mesh built from the edited layout, with the re-meshed sections tagged alike
+    ChunkMesh expected;
+    for (uint32_t section = 0; section < ChunkMesh::MESH_SECTION_COUNT; ++section)
+    {
+        const float variant = (section >= 4 && section < 7) ? 0.5f : 0.f;
+        expected.BeginSection(section);
+        const SectionQuads& quads = edited[section];
+        for (uint32_t i = 0; i < quads.opaque; ++i)
+        {
+            expected.AddOpaqueTerrainQuad(MakeQuad(section * 1000.f + i + variant), (i & 1) != 0);
+        }
+        for (uint32_t i = 0; i < quads.cutout; ++i)
+        {
+            expected.AddCutoutTerrainQuad(MakeQuad(section * 1000.f + 300.f + i + variant), false);
+        }
+        for (uint32_t i = 0; i < quads.translucent; ++i)
+        {
+            expected.AddTranslucentTerrainQuad(MakeQuad(section * 1000.f + 600.f + i + variant), true);
+        }
+    }
+    expected.EndSections();
+
+    ExpectSameGeometry(mesh, expected);
+
+    const ChunkMeshLayerPatch& opaquePatch = patch.layers[0];
+    EXPECT_EQ(opaquePatch.firstQuad, expected.GetSectionQuadStart(0, 4));
+    EXPECT_EQ(opaquePatch.newEndQuad, expected.GetSectionQuadStart(0, 7));
+    EXPECT_EQ(opaquePatch.newQuadCount, expected.GetLayerQuadCount(0));
+    EXPECT_EQ(opaquePatch.oldQuadCount + 3 - layout[6].opaque, opaquePatch.newQuadCount);
+}
+
+TEST(VoxelChunkMeshSectionTests, ReplaceSectionsRequiresSectionRanges)
+{
+    ChunkMesh mesh;
+    mesh.AddOpaqueTerrainQuad(MakeQuad(1.f), false);
+
+    ChunkMesh sectionMesh;
+    sectionMesh.BeginSection(0);
+    sectionMesh.EndSections();
+
+    ChunkMeshSectionPatch patch;
+    EXPECT_FALSE(mesh.ReplaceSections(0, 1, sectionMesh, patch));
+    EXPECT_EQ(mesh.GetOpaqueVertexCount(), 4u);
+}
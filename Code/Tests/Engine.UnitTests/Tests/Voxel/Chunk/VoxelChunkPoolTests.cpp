@@ -0,0 +1,156 @@
+#include <gtest/gtest.h>
+
+#include "Engine/Registry/Block/Block.hpp"
+#include "Engine/Voxel/Chunk/Chunk.hpp"
+#include "Engine/Voxel/Chunk/ChunkPool.hpp"
+
+#include <chrono>
+#include <cstdio>
+#include <vector>
+
+using namespace enigma::voxel;
+
+namespace
+{
+    // Free-standing blocks: chunk storage only stores BlockState pointers, no registry needed
+    struct TestBlocks
+    {
+        enigma::registry::block::Block air{"air", "test"};
+        enigma::registry::block::Block stone{"stone", "test"};
+
+        TestBlocks()
+        {
+            air.GenerateBlockStates();
+            stone.GenerateBlockStates();
+        }
+
+        BlockState* Air() const { return air.GetDefaultState(); }
+        BlockState* Stone() const { return stone.GetDefaultState(); }
+    };
+
+    bool IsUniform(const Chunk& chunk, BlockState* expected)
+    {
+        for (int32_t z = 0; z < Chunk::CHUNK_SIZE_Z; ++z)
+            for (int32_t y = 0; y < Chunk::CHUNK_SIZE_Y; ++y)
+                for (int32_t x = 0; x < Chunk::CHUNK_SIZE_X; ++x)
+                    if (chunk.GetBlock(x, y, z) != expected || chunk.GetSkyLight(x, y, z) != 0 || chunk.GetIsSky(x, y, z))
+                        return false;
+        return true;
+    }
+}
+
+TEST(VoxelChunkPoolTests, RecycledChunkIsResetInPlace)
+{
+    TestBlocks blocks;
+    ChunkPool  pool;
+
+    std::unique_ptr<Chunk> chunk = pool.Acquire(IntVec2(3, -2), blocks.Air());
+    ASSERT_TRUE(IsUniform(*chunk, blocks.Air()));
+
+    chunk->SetBlock(1, 2, 3, blocks.Stone());
+    chunk->SetSkyLight(4, 5, 6, 15);
+    chunk->SetIsSky(7, 8, 9, true);
+    chunk->MarkModified();
+    chunk->MarkPlayerModified();
+    ASSERT_TRUE(chunk->TrySetState(ChunkState::Inactive, ChunkState::Generating));
+
+    const Chunk*   storage       = chunk.get();
+    const uint64_t oldInstanceId = chunk->GetInstanceId();
+    pool.Release(std::move(chunk));
+    EXPECT_EQ(pool.GetStats().pooledChunks, 1u);
+
+    std::unique_ptr<Chunk> reused = pool.Acquire(IntVec2(10, 11), blocks.Air());
+    EXPECT_EQ(reused.get(), storage);
+    EXPECT_NE(reused->GetInstanceId(), oldInstanceId);
+    EXPECT_EQ(reused->GetChunkCoords(), IntVec2(10, 11));
+    EXPECT_EQ(reused->GetState(), ChunkState::Inactive);
+    EXPECT_FALSE(reused->IsModified());
+    EXPECT_FALSE(reused->IsPlayerModified());
+    EXPECT_TRUE(reused->NeedsMeshRebuild());
+    EXPECT_EQ(reused->GetMesh(), nullptr);
+    EXPECT_EQ(reused->GetWorld(), nullptr);
+    EXPECT_TRUE(IsUniform(*reused, blocks.Air()));
+
+    ChunkPoolStats stats = pool.GetStats();
+    EXPECT_EQ(stats.acquireCount, 2u);
+    EXPECT_EQ(stats.hitCount, 1u);
+    EXPECT_DOUBLE_EQ(stats.GetHitRate(), 0.5);
+    EXPECT_EQ(stats.pooledChunks, 0u);
+}
+
+TEST(VoxelChunkPoolTests, RetainedMemoryIsCapped)
+{
+    TestBlocks      blocks;
+    ChunkPoolConfig config;
+    config.maxPooledChunks  = 8;
+    config.maxRetainedBytes = 2 * Chunk::GetStorageBytes() + 1; // Byte cap is the tighter limit
+    ChunkPool pool(config);
+
+    std::vector<std::unique_ptr<Chunk>> chunks;
+    for (int32_t i = 0; i < 3; ++i)
+    {
+        chunks.push_back(pool.Acquire(IntVec2(i, 0), blocks.Air()));
+    }
+    for (auto& chunk : chunks)
+    {
+        pool.Release(std::move(chunk));
+    }
+
+    ChunkPoolStats stats = pool.GetStats();
+    EXPECT_EQ(stats.releaseCount, 3u);
+    EXPECT_EQ(stats.discardCount, 1u);
+    EXPECT_EQ(stats.pooledChunks, 2u);
+    EXPECT_EQ(stats.retainedBytes, 2 * Chunk::GetStorageBytes());
+
+    pool.Trim(1);
+    EXPECT_EQ(pool.GetStats().pooledChunks, 1u);
+    pool.Trim();
+    EXPECT_EQ(pool.GetStats().retainedBytes, 0u);
+}
+
+TEST(VoxelChunkPoolTests, ActivationCostWithAndWithoutPool)
+{
+    TestBlocks    blocks;
+    constexpr int kWaves      = 8;
+    constexpr int kChunksWave = 64; // Chunks entering and leaving view per wave while flying
+
+    auto runWaves = [&](auto&& acquire, auto&& release)
+    {
+        std::vector<std::unique_ptr<Chunk>> resident;
+        auto                                start = std::chrono::steady_clock::now();
+        for (int wave = 0; wave < kWaves; ++wave)
+        {
+            for (int i = 0; i < kChunksWave; ++i)
+            {
+                resident.push_back(acquire(IntVec2(wave * kChunksWave + i, 0)));
+            }
+            for (auto& chunk : resident)
+            {
+                release(std::move(chunk));
+            }
+            resident.clear();
+        }
+        return std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count() / (kWaves * kChunksWave);
+    };
+
+    double freshUs = runWaves([&](IntVec2 coords) { return std::make_unique<Chunk>(coords, blocks.Air()); },
+                              [](std::unique_ptr<Chunk> chunk) { chunk.reset(); });
+
+    ChunkPoolConfig config;
+    config.maxPooledChunks = kChunksWave;
+    ChunkPool pool(config);
+    double    pooledUs = runWaves([&](IntVec2 coords) { return pool.Acquire(coords, blocks.Air()); },
+                                  [&](std::unique_ptr<Chunk> chunk) { pool.Release(std::move(chunk)); });
+
+    ChunkPoolStats stats = pool.GetStats();
+    EXPECT_EQ(stats.acquireCount, static_cast<uint64_t>(kWaves * kChunksWave));
+    EXPECT_EQ(stats.hitCount, static_cast<uint64_t>((kWaves - 1) * kChunksWave));
+
+    // Every miss allocates the block, light and flag arrays
+    const uint64_t freshAllocations  = 3ull * kWaves * kChunksWave;
+    const uint64_t pooledAllocations = 3ull * (stats.acquireCount - stats.hitCount);
+    std::printf("[ BENCH    ] chunk activation: fresh %.1f us (%llu storage allocations), pooled %.1f us (%llu storage allocations), hit rate %.0f%%, retained %.1f MB\n",
+                freshUs, static_cast<unsigned long long>(freshAllocations),
+                pooledUs, static_cast<unsigned long long>(pooledAllocations),
+                stats.GetHitRate() * 100.0, static_cast<double>(stats.retainedBytes) / (1024.0 * 1024.0));
+}
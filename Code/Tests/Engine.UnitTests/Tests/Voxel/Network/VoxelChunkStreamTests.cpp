@@ -0,0 +1,341 @@
+#include <gtest/gtest.h>
+
+#include "Engine/Voxel/Network/ChunkStreamClient.hpp"
+#include "Engine/Voxel/Network/ChunkStreamServer.hpp"
+
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <thread>
+#include <unordered_map>
+
+using namespace enigma::voxel;
+using namespace enigma::network;
+
+namespace
+{
+    using Clock = std::chrono::steady_clock;
+
+    constexpr uint32_t kStone = 1u << 16;
+    constexpr uint32_t kDirt  = 2u << 16;
+    constexpr uint32_t kGrass = 3u << 16;
+    constexpr uint32_t kOre   = (4u << 16) | 1u;
+    constexpr uint32_t kGlass = 5u << 16;
+
+    // Headless server world: procedural terrain plus an overlay of edited blocks and light
+    class SyntheticWorld : public IChunkReplicationSource
+    {
+    public:
+        bool IsChunkReady(IntVec2 chunkCoords) const override
+        {
+            return std::abs(chunkCoords.x) < 64 && std::abs(chunkCoords.y) < 64;
+        }
+
+        void CaptureSection(IntVec2 chunkCoords, int32_t sectionY, uint32_t* outBlocks, uint8_t* outLight) const override
+        {
+            for (int32_t sectionIndex = 0; sectionIndex < kBlocksPerChunkSection; ++sectionIndex)
+            {
+                int32_t chunkIndex     = (sectionY << 12) | sectionIndex;
+                outBlocks[sectionIndex] = GetStateId(chunkCoords, chunkIndex);
+                outLight[sectionIndex]  = GetLight(chunkCoords, chunkIndex);
+            }
+        }
+
+        uint32_t GetStateId(IntVec2 chunkCoords, int32_t chunkIndex) const
+        {
+            auto edited = m_blockEdits.find(Key(chunkCoords, chunkIndex));
+            if (edited != m_blockEdits.end())
+            {
+                return edited->second;
+            }
+            int32_t x      = chunkCoords.x * 16 + (chunkIndex & 15);
+            int32_t y      = chunkCoords.y * 16 + ((chunkIndex >> 4) & 15);
+            int32_t z      = chunkIndex >> 8;
+            int32_t height = GetHeight(x, y);
+            if (z > height) return kAirNetworkStateId;
+            if (z == height) return kGrass;
+            if (z > height - 4) return kDirt;
+            return ((x * 73856093) ^ (y * 19349663) ^ (z * 83492791)) % 61 == 0 ? kOre : kStone;
+        }
+
+        uint8_t GetLight(IntVec2 chunkCoords, int32_t chunkIndex) const
+        {
+            auto edited = m_lightEdits.find(Key(chunkCoords, chunkIndex));
+            if (edited != m_lightEdits.end())
+            {
+                return edited->second;
+            }
+            int32_t x = chunkCoords.x * 16 + (chunkIndex & 15);
+            int32_t y = chunkCoords.y * 16 + ((chunkIndex >> 4) & 15);
+            return (chunkIndex >> 8) > GetHeight(x, y) ? 0xF0 : 0x00;
+        }
+
+        void SetBlock(IntVec2 chunkCoords, int32_t chunkIndex, uint32_t stateId) { m_blockEdits[Key(chunkCoords, chunkIndex)] = stateId; }
+        void SetLight(IntVec2 chunkCoords, int32_t chunkIndex, uint8_t light) { m_lightEdits[Key(chunkCoords, chunkIndex)] = light; }
+
+    private:
+        static int32_t GetHeight(int32_t x, int32_t y)
+        {
+            return 64 + static_cast<int32_t>(10.0 * std::sin(x * 0.07) + 6.0 * std::cos(y * 0.05));
+        }
+
+        static int64_t Key(IntVec2 chunkCoords, int32_t chunkIndex)
+        {
+            return (PackNetworkChunkCoords(chunkCoords) << 16) ^ chunkIndex;
+        }
+
+        std::unordered_map<int64_t, uint32_t> m_blockEdits;
+        std::unordered_map<int64_t, uint8_t>  m_lightEdits;
+    };
+
+    bool MirrorMatches(const SyntheticWorld& world, const ChunkStreamClient& client, IntVec2 chunkCoords)
+    {
+        const ChunkSnapshot* snapshot = client.FindChunk(chunkCoords);
+        if (!snapshot || !snapshot->complete)
+        {
+            return false;
+        }
+        for (int32_t chunkIndex = 0; chunkIndex < kBlocksPerNetworkChunk; ++chunkIndex)
+        {
+            if (snapshot->GetStateId(chunkIndex) != world.GetStateId(chunkCoords, chunkIndex) ||
+                snapshot->GetLight(chunkIndex) != world.GetLight(chunkCoords, chunkIndex))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    struct StreamLoopback
+    {
+        NetworkIoBackend                   server;
+        NetworkIoBackend                   client;
+        ConnectionId                       serverSide = kInvalidConnectionId;
+        ConnectionId                       clientSide = kInvalidConnectionId;
+        SyntheticWorld                     world;
+        std::unique_ptr<ChunkStreamServer> streamServer;
+        std::unique_ptr<ChunkStreamClient> streamClient;
+
+        bool Start(const ChunkStreamConfig& config)
+        {
+            uint16_t port = 0;
+            if (!server.Start() || !client.Start() || (port = server.Listen(0, "127.0.0.1")) == 0)
+            {
+                return false;
+            }
+            clientSide = client.Connect("127.0.0.1", port);
+
+            std::vector<NetworkConnectionEvent> events;
+            auto                                deadline = Clock::now() + std::chrono::seconds(5);
+            while (serverSide == kInvalidConnectionId && Clock::now() < deadline)
+            {
+                server.PollConnectionEvents(events);
+                for (const NetworkConnectionEvent& event : events)
+                {
+                    if (event.type == NetworkConnectionEventType::Connected) serverSide = event.connectionId;
+                }
+                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            }
+            if (serverSide == kInvalidConnectionId || !WaitForClientConnected(deadline))
+            {
+                return false;
+            }
+
+            streamServer = std::make_unique<ChunkStreamServer>(server, world, config);
+            streamServer->AddConnection(serverSide);
+            streamClient = std::make_unique<ChunkStreamClient>(client, clientSide);
+            return true;
+        }
+
+        bool WaitForClientConnected(Clock::time_point deadline)
+        {
+            std::vector<NetworkConnectionEvent> events;
+            while (Clock::now() < deadline)
+            {
+                client.PollConnectionEvents(events);
+                for (const NetworkConnectionEvent& event : events)
+                {
+                    if (event.type == NetworkConnectionEventType::Connected) return true;
+                }
+                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            }
+            return false;
+        }
+
+        // Ticks both ends until the predicate holds; returns the number of server ticks, or -1 on timeout
+        template <typename Predicate>
+        int TickUntil(Predicate predicate, int timeoutMs = 10000)
+        {
+            auto deadline = Clock::now() + std::chrono::milliseconds(timeoutMs);
+            int  ticks    = 0;
+            while (Clock::now() < deadline)
+            {
+                streamServer->Tick();
+                ++ticks;
+                std::this_thread::sleep_for(std::chrono::microseconds(200));
+                streamClient->Tick();
+                if (predicate())
+                {
+                    return ticks;
+                }
+            }
+            return -1;
+        }
+    };
+
+    size_t CountChunksInRadius(int32_t radius)
+    {
+        size_t count = 0;
+        for (int32_t dy = -radius; dy <= radius; ++dy)
+        {
+            for (int32_t dx = -radius; dx <= radius; ++dx)
+            {
+                count += dx * dx + dy * dy <= radius * radius ? 1 : 0;
+            }
+        }
+        return count;
+    }
+}
+
+//=============================================================================
+// ChunkPacketCodec
+//=============================================================================
+
+TEST(VoxelChunkPacketCodecTests, BlockSectionRoundTripsForEveryPaletteWidth)
+{
+    for (uint32_t distinct : {1u, 2u, 3u, 17u, 300u, 4096u})
+    {
+        std::vector<uint32_t> blocks(kBlocksPerChunkSection);
+        for (int32_t index = 0; index < kBlocksPerChunkSection; ++index)
+        {
+            blocks[index] = (static_cast<uint32_t>(index * 7919) % distinct) * 65537u;
+        }
+
+        enigma::core::ByteBuffer buffer;
+        ChunkPacketCodec::WriteBlockSection(buffer, blocks.data());
+
+        std::vector<uint32_t> decoded(kBlocksPerChunkSection);
+        ASSERT_TRUE(ChunkPacketCodec::ReadBlockSection(buffer, decoded.data())) << distinct;
+        EXPECT_EQ(decoded, blocks) << distinct;
+        EXPECT_FALSE(buffer.HasRemaining());
+        if (distinct == 1)
+        {
+            EXPECT_EQ(buffer.WrittenBytes(), 5u); // bits + single value
+        }
+    }
+}
+
+TEST(VoxelChunkPacketCodecTests, LightSectionRoundTripsAndRejectsBadPalette)
+{
+    std::vector<uint8_t> light(kBlocksPerChunkSection);
+    for (int32_t index = 0; index < kBlocksPerChunkSection; ++index)
+    {
+        light[index] = static_cast<uint8_t>(((index >> 8) << 4) | (index & 0x0F));
+    }
+
+    enigma::core::ByteBuffer buffer;
+    ChunkPacketCodec::WriteLightSection(buffer, light.data());
+    std::vector<uint8_t> decoded(kBlocksPerChunkSection);
+    ASSERT_TRUE(ChunkPacketCodec::ReadLightSection(buffer, decoded.data()));
+    EXPECT_EQ(decoded, light);
+
+    enigma::core::ByteBuffer malformed;
+    malformed.WriteByte(13); // wider than any 4096-entry palette needs
+    EXPECT_FALSE(ChunkPacketCodec::ReadLightSection(malformed, decoded.data()));
+}
+
+//=============================================================================
+// ChunkStreamServer / ChunkStreamClient over loopback
+//=============================================================================
+
+TEST(VoxelChunkStreamTests, ClientMirrorCatchesUpAndReceivesDeltas)
+{
+    ChunkStreamConfig config;
+    config.viewRadius = 6;
+
+    StreamLoopback loopback;
+    ASSERT_TRUE(loopback.Start(config));
+    ASSERT_TRUE(loopback.streamClient->SendViewCenter(Vec3(8.0f, 8.0f, 80.0f)));
+
+    const size_t expectedChunks = CountChunksInRadius(config.viewRadius);
+    auto         start          = Clock::now();
+    int          ticks          = loopback.TickUntil([&]()
+    {
+        return loopback.streamClient->GetCompleteChunkCount() == expectedChunks;
+    });
+    double catchUpMs = std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+    ASSERT_GE(ticks, 0) << loopback.streamClient->GetCompleteChunkCount() << "/" << expectedChunks;
+
+    const ChunkStreamStats& stats = loopback.streamServer->GetStats();
+    EXPECT_EQ(stats.chunksSent, expectedChunks);
+    std::printf("[ BENCH    ] %zu chunks: %.0f bytes/chunk (raw %d), catch-up %.1f ms in %d ticks\n",
+                expectedChunks, static_cast<double>(stats.chunkBytes) / static_cast<double>(stats.chunksSent),
+                kBlocksPerNetworkChunk * 5, catchUpMs, ticks);
+
+    EXPECT_TRUE(MirrorMatches(loopback.world, *loopback.streamClient, IntVec2(0, 0)));
+    EXPECT_TRUE(MirrorMatches(loopback.world, *loopback.streamClient, IntVec2(-6, 0)));
+
+    // A handful of edits travel as one sparse delta; the light under the glass changes too
+    IntVec2 target(1, -1);
+    for (int32_t chunkIndex : {100 << 8, (100 << 8) + 1, (100 << 8) + 17})
+    {
+        loopback.world.SetBlock(target, chunkIndex, kGlass);
+        loopback.world.SetLight(target, chunkIndex, 0x3A);
+        loopback.streamServer->OnBlockChanged(target, chunkIndex);
+    }
+    // Filling a whole section resends it instead of listing every block
+    for (int32_t chunkIndex = 2 << 12; chunkIndex < 3 << 12; ++chunkIndex)
+    {
+        loopback.world.SetBlock(IntVec2(0, 0), chunkIndex, kGlass);
+        loopback.streamServer->OnBlockChanged(IntVec2(0, 0), chunkIndex);
+    }
+    // Light marked dirty without an actual change is not resent
+    loopback.streamServer->OnLightChanged(IntVec2(2, 2), 15);
+
+    ASSERT_GE(loopback.TickUntil([&]()
+    {
+        return loopback.streamClient->GetStats().blockChangesApplied >= 3 + kBlocksPerChunkSection &&
+            MirrorMatches(loopback.world, *loopback.streamClient, target) &&
+            MirrorMatches(loopback.world, *loopback.streamClient, IntVec2(0, 0));
+    }), 0);
+    EXPECT_EQ(stats.deltaPackets, 2u);
+    EXPECT_LT(stats.deltaBytes, 200u);
+    EXPECT_EQ(stats.lightPackets, 1u);
+    EXPECT_GE(stats.suppressedLightSend, 1u);
+    EXPECT_EQ(loopback.streamClient->GetStats().malformedPackets, 0u);
+}
+
+TEST(VoxelChunkStreamTests, RespectsByteBudgetAndUnloadsOutOfRangeChunks)
+{
+    ChunkStreamConfig config;
+    config.viewRadius         = 3;
+    config.bytesPerTickBudget = 8 * 1024;
+    config.maxPacketBytes     = 4 * 1024; // forces chunks to span several ChunkData packets
+
+    StreamLoopback loopback;
+    ASSERT_TRUE(loopback.Start(config));
+    ASSERT_TRUE(loopback.streamClient->SendViewCenter(Vec3(0.0f, 0.0f, 80.0f)));
+
+    const size_t expectedChunks = CountChunksInRadius(config.viewRadius);
+    int          ticks          = loopback.TickUntil([&]()
+    {
+        return loopback.streamClient->GetCompleteChunkCount() == expectedChunks;
+    });
+    ASSERT_GE(ticks, 0);
+
+    const ChunkStreamStats& stats = loopback.streamServer->GetStats();
+    EXPECT_GT(stats.budgetDeferrals, 0u);
+    EXPECT_GE(static_cast<uint64_t>(ticks) * (config.bytesPerTickBudget + config.maxPacketBytes), stats.chunkBytes);
+    EXPECT_TRUE(MirrorMatches(loopback.world, *loopback.streamClient, IntVec2(-3, 0)));
+
+    // Moving ten chunks east drops the western chunks and streams the new ring, nearest first
+    ASSERT_TRUE(loopback.streamClient->SendViewCenter(Vec3(160.0f, 0.0f, 80.0f)));
+    ASSERT_GE(loopback.TickUntil([&]()
+    {
+        return loopback.streamClient->FindChunk(IntVec2(0, 0)) == nullptr &&
+            loopback.streamClient->GetCompleteChunkCount() == expectedChunks;
+    }), 0);
+    EXPECT_EQ(loopback.streamClient->GetStats().chunksUnloaded, expectedChunks);
+    EXPECT_TRUE(MirrorMatches(loopback.world, *loopback.streamClient, IntVec2(10, 0)));
+    EXPECT_EQ(loopback.streamServer->GetSentChunkCount(loopback.serverSide), expectedChunks);
+}
@@ -0,0 +1,325 @@
+#include <gtest/gtest.h>
+
+#include "Engine/Core/Engine.hpp"
+#include "Engine/Registry/Block/Block.hpp"
+#include "Engine/Registry/Block/BlockRegistry.hpp"
+#include "Engine/Registry/Core/RegisterSubsystem.hpp"
+#include "Engine/Voxel/Chunk/Chunk.hpp"
+#include "Engine/Voxel/Chunk/ChunkHelper.hpp"
+#include "Engine/Voxel/Network/ChunkStreamClient.hpp"
+#include "Engine/Voxel/Network/WorldChunkReplicationSource.hpp"
+#include "Engine/Voxel/Property/PropertyTypes.hpp"
+#include "Engine/Voxel/World/World.hpp"
+
+#include <chrono>
+#include <memory>
+#include <thread>
+#include <vector>
+
+using namespace enigma::voxel;
+using namespace enigma::network;
+using enigma::registry::block::Block;
+using enigma::registry::block::BlockRegistry;
+
+namespace
+{
+    using Clock = std::chrono::steady_clock;
+
+    /// Headless engine with only the RegisterSubsystem, so blocks get the numeric ids the network state ids are built from
+    class VoxelWorldChunkReplicationTests : public ::testing::Test
+    {
+    protected:
+        void SetUp() override
+        {
+            enigma::core::Engine::CreateInstance();
+            GEngine->RegisterSubsystem(std::make_unique<enigma::core::RegisterSubsystem>());
+            GEngine->Startup();
+
+            // Registered with the flags BlockRegistry would load from YAML
+            m_air = std::make_shared<Block>("air", "simpleminer");
+            m_air->SetVisible(false);
+            m_air->SetCanOcclude(false);
+            m_air->SetFullBlock(false);
+            m_stone = std::make_shared<Block>("stone", "test");
+            m_glass = std::make_shared<Block>("glass", "test");
+            m_glass->SetCanOcclude(false);
+            m_lamp = std::make_shared<Block>("lamp", "test");
+            m_lamp->AddProperty(std::make_shared<BooleanProperty>("lit", true));
+            m_lamp->SetBlockLightEmission(14);
+
+            BlockRegistry::RegisterBlock("simpleminer", "air", m_air);
+            BlockRegistry::RegisterBlock("test", "stone", m_stone);
+            BlockRegistry::RegisterBlock("test", "glass", m_glass);
+            BlockRegistry::RegisterBlock("test", "lamp", m_lamp);
+        }
+
+        void TearDown() override
+        {
+            GEngine->Shutdown();
+            enigma::core::Engine::DestroyInstance();
+        }
+
+        BlockState* Air() const { return m_air->GetDefaultState(); }
+        BlockState* Stone() const { return m_stone->GetDefaultState(); }
+        BlockState* Glass() const { return m_glass->GetDefaultState(); }
+        BlockState* Lamp() const { return m_lamp->GetDefaultState(); }
+
+        // Active, lit chunks in a square of the given radius around chunk (0, 0)
+        void PopulateWorld(World& world, int radius) const
+        {
+            for (int32_t chunkY = -radius; chunkY <= radius; ++chunkY)
+            {
+                for (int32_t chunkX = -radius; chunkX <= radius; ++chunkX)
+                {
+                    auto chunk = std::make_unique<Chunk>(IntVec2(chunkX, chunkY), Air());
+                    for (int32_t y = 0; y < Chunk::CHUNK_SIZE_Y; ++y)
+                    {
+                        for (int32_t x = 0; x < Chunk::CHUNK_SIZE_X; ++x)
+                        {
+                            const int32_t ground = 60 + ((x * 7 + y * 13 + chunkX * 3) % 20);
+                            for (int32_t z = 0; z <= ground; ++z)
+                            {
+                                chunk->SetBlock(x, y, z, Stone());
+                            }
+                        }
+                    }
+                    chunk->SetWorld(&world);
+                    chunk->TrySetState(chunk->GetState(), ChunkState::Active);
+                    world.GetLoadedChunks()[ChunkHelper::PackCoordinates(chunkX, chunkY)] = std::move(chunk);
+                }
+            }
+
+            for (auto& [key, chunk] : world.GetLoadedChunks())
+            {
+                chunk->InitializeLighting(&world);
+            }
+            world.GetVoxelLightEngine().RunLightUpdates();
+        }
+
+        std::shared_ptr<Block> m_air;
+        std::shared_ptr<Block> m_stone;
+        std::shared_ptr<Block> m_glass;
+        std::shared_ptr<Block> m_lamp;
+    };
+
+    ChunkSnapshot CaptureChunk(const WorldChunkReplicationSource& source, IntVec2 chunkCoords)
+    {
+        ChunkSnapshot snapshot;
+        snapshot.chunkCoords = chunkCoords;
+        for (int32_t sectionY = 0; sectionY < kChunkSectionCount; ++sectionY)
+        {
+            snapshot.sectionBlocks[sectionY].resize(kBlocksPerChunkSection);
+            snapshot.sectionLight[sectionY].resize(kBlocksPerChunkSection);
+            source.CaptureSection(chunkCoords, sectionY, snapshot.sectionBlocks[sectionY].data(), snapshot.sectionLight[sectionY].data());
+        }
+        snapshot.receivedSectionCount = kChunkSectionCount;
+        snapshot.complete             = true;
+        return snapshot;
+    }
+
+    /// Number of blocks whose state id or packed light differs between the client mirror and the World
+    size_t CountMirrorMismatches(const World& world, const ChunkStreamClient& client, IntVec2 chunkCoords)
+    {
+        const ChunkSnapshot* snapshot = client.FindChunk(chunkCoords);
+        const Chunk*         chunk    = world.GetChunk(chunkCoords.x, chunkCoords.y);
+        if (!snapshot || !snapshot->complete || !chunk)
+        {
+            return kBlocksPerNetworkChunk;
+        }
+
+        size_t  mismatches = 0;
+        int32_t chunkIndex = 0;
+        for (int32_t z = 0; z < Chunk::CHUNK_SIZE_Z; ++z)
+        {
+            for (int32_t y = 0; y < Chunk::CHUNK_SIZE_Y; ++y)
+            {
+                for (int32_t x = 0; x < Chunk::CHUNK_SIZE_X; ++x, ++chunkIndex)
+                {
+                    const uint8_t light = static_cast<uint8_t>((chunk->GetSkyLight(x, y, z) << 4) | chunk->GetBlockLight(x, y, z));
+                    mismatches += snapshot->GetStateId(chunkIndex) != WorldChunkReplicationSource::ToNetworkStateId(chunk->GetBlock(x, y, z)) ||
+                                  snapshot->GetLight(chunkIndex) != light
+                                      ? 1
+                                      : 0;
+                }
+            }
+        }
+        return mismatches;
+    }
+}
+
+TEST_F(VoxelWorldChunkReplicationTests, NetworkStateIdsRoundTripAndFallBackToAir)
+{
+    ASSERT_EQ(m_lamp->GetStateCount(), 2u);
+    for (BlockState* state : {Air(), Stone(), Glass(), m_lamp->GetStateByIndex(0), m_lamp->GetStateByIndex(1)})
+    {
+        EXPECT_EQ(WorldChunkReplicationSource::FromNetworkStateId(WorldChunkReplicationSource::ToNetworkStateId(state)), state);
+    }
+    EXPECT_NE(WorldChunkReplicationSource::ToNetworkStateId(m_lamp->GetStateByIndex(0)),
+              WorldChunkReplicationSource::ToNetworkStateId(m_lamp->GetStateByIndex(1)));
+    EXPECT_EQ(WorldChunkReplicationSource::ToNetworkStateId(nullptr), kAirNetworkStateId);
+
+    // An id the registry does not know resolves to air, a state index past the end to the block's default state
+    EXPECT_EQ(WorldChunkReplicationSource::FromNetworkStateId(0x7FFFu << 16), Air());
+    const uint32_t lampId = WorldChunkReplicationSource::ToNetworkStateId(Lamp()) & 0xFFFF0000u;
+    EXPECT_EQ(WorldChunkReplicationSource::FromNetworkStateId(lampId | 0xFFFFu), Lamp());
+}
+
+TEST_F(VoxelWorldChunkReplicationTests, CapturedSectionsApplyBackOntoAnEmptyChunk)
+{
+    World world;
+    PopulateWorld(world, 1);
+    world.SetBlockState(BlockPos(5, 6, 40), Lamp()); // Lights the air pocket next to it
+    world.SetBlockState(BlockPos(6, 6, 40), Air());
+    world.SetBlockState(BlockPos(5, 6, 41), Glass());
+    world.GetVoxelLightEngine().RunLightUpdates();
+
+    WorldChunkReplicationSource source(&world);
+    EXPECT_TRUE(source.IsChunkReady(IntVec2(0, 0)));
+    EXPECT_FALSE(source.IsChunkReady(IntVec2(4, 4)));
+
+    const ChunkSnapshot snapshot = CaptureChunk(source, IntVec2(0, 0));
+    const Chunk*        chunk    = world.GetChunk(0, 0);
+    ASSERT_GT(static_cast<int>(chunk->GetBlockLight(6, 6, 40)), 0);
+
+    // Section layout matches Chunk::CoordsToIndex, light packs sky light into the high nibble
+    const int32_t lampIndex = static_cast<int32_t>(Chunk::CoordsToIndex(5, 6, 40));
+    const int32_t litIndex  = static_cast<int32_t>(Chunk::CoordsToIndex(6, 6, 40));
+    EXPECT_EQ(snapshot.GetStateId(lampIndex), WorldChunkReplicationSource::ToNetworkStateId(Lamp()));
+    EXPECT_EQ(snapshot.GetLight(litIndex), static_cast<uint8_t>((chunk->GetSkyLight(6, 6, 40) << 4) | chunk->GetBlockLight(6, 6, 40)));
+    EXPECT_EQ(snapshot.GetLight(static_cast<int32_t>(Chunk::CoordsToIndex(0, 0, Chunk::CHUNK_MAX_Z))), 0xF0);
+
+    size_t solidBlocks = 0;
+    for (int32_t chunkIndex = 0; chunkIndex < kBlocksPerNetworkChunk; ++chunkIndex)
+    {
+        solidBlocks += snapshot.GetStateId(chunkIndex) != WorldChunkReplicationSource::ToNetworkStateId(Air()) ? 1 : 0;
+    }
+
+    Chunk mirror(IntVec2(0, 0), Air());
+    EXPECT_EQ(WorldChunkReplicationSource::ApplySnapshot(snapshot, &mirror), solidBlocks);
+    size_t blockMismatches = 0, lightMismatches = 0;
+    for (int32_t z = 0; z < Chunk::CHUNK_SIZE_Z; ++z)
+    {
+        for (int32_t y = 0; y < Chunk::CHUNK_SIZE_Y; ++y)
+        {
+            for (int32_t x = 0; x < Chunk::CHUNK_SIZE_X; ++x)
+            {
+                blockMismatches += mirror.GetBlock(x, y, z) != chunk->GetBlock(x, y, z) ? 1 : 0;
+                lightMismatches += mirror.GetSkyLight(x, y, z) != chunk->GetSkyLight(x, y, z) || mirror.GetBlockLight(x, y, z) != chunk->GetBlockLight(x, y, z) ? 1 : 0;
+            }
+        }
+    }
+    EXPECT_EQ(blockMismatches, 0u);
+    EXPECT_EQ(lightMismatches, 0u);
+    EXPECT_EQ(WorldChunkReplicationSource::ApplySnapshot(snapshot, &mirror), 0u);
+
+    // Chunks that are not loaded read as unlit air
+    std::vector<uint32_t> blocks(kBlocksPerChunkSection, 1u);
+    std::vector<uint8_t>  light(kBlocksPerChunkSection, 0xFF);
+    source.CaptureSection(IntVec2(4, 4), 3, blocks.data(), light.data());
+    EXPECT_EQ(blocks, std::vector<uint32_t>(kBlocksPerChunkSection, kAirNetworkStateId));
+    EXPECT_EQ(light, std::vector<uint8_t>(kBlocksPerChunkSection, 0));
+}
+
+TEST_F(VoxelWorldChunkReplicationTests, WorldEditsAndRelightingReachConnectedClients)
+{
+    World world;
+    PopulateWorld(world, 1);
+    WorldChunkReplicationSource source(&world);
+
+    NetworkIoBackend server;
+    NetworkIoBackend client;
+    uint16_t         port = 0;
+    ASSERT_TRUE(server.Start() && client.Start() && (port = server.Listen(0, "127.0.0.1")) != 0);
+    const ConnectionId clientSide = client.Connect("127.0.0.1", port);
+
+    ConnectionId                        serverSide = kInvalidConnectionId;
+    bool                                connected  = false;
+    std::vector<NetworkConnectionEvent> events;
+    for (auto deadline = Clock::now() + std::chrono::seconds(5); (serverSide == kInvalidConnectionId || !connected) && Clock::now() < deadline;)
+    {
+        server.PollConnectionEvents(events);
+        for (const NetworkConnectionEvent& event : events)
+        {
+            serverSide = event.type == NetworkConnectionEventType::Connected ? event.connectionId : serverSide;
+        }
+        client.PollConnectionEvents(events);
+        for (const NetworkConnectionEvent& event : events)
+        {
+            connected = connected || event.type == NetworkConnectionEventType::Connected;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    ASSERT_NE(serverSide, kInvalidConnectionId);
+    ASSERT_TRUE(connected);
+
+    ChunkStreamConfig config;
+    config.viewRadius = 1;
+    ChunkStreamServer streamServer(server, source, config);
+    ChunkStreamClient streamClient(client, clientSide);
+    streamServer.AddConnection(serverSide);
+    world.SetChunkStreamServer(&streamServer);
+
+    const std::vector<IntVec2> visible = {IntVec2(0, 0), IntVec2(-1, 0), IntVec2(1, 0), IntVec2(0, -1), IntVec2(0, 1)};
+    auto tickUntilMirrored = [&]()
+    {
+        for (auto deadline = Clock::now() + std::chrono::seconds(10); Clock::now() < deadline;)
+        {
+            streamServer.Tick();
+            std::this_thread::sleep_for(std::chrono::microseconds(200));
+            streamClient.Tick();
+
+            size_t mismatches = 0;
+            for (IntVec2 chunkCoords : visible)
+            {
+                mismatches += CountMirrorMismatches(world, streamClient, chunkCoords);
+            }
+            if (mismatches == 0)
+            {
+                return true;
+            }
+        }
+        return false;
+    };
+
+    ASSERT_TRUE(streamClient.SendViewCenter(Vec3(8.0f, 8.0f, 80.0f)));
+    ASSERT_TRUE(tickUntilMirrored());
+    const ChunkStreamStats& stats = streamServer.GetStats();
+    EXPECT_EQ(stats.deltaPackets, 0u);
+
+    // Player edits: a sealed shaft, then opening it relights the column below the dug block, three sections down
+    Chunk* chunk = world.GetChunk(0, 0);
+    for (int32_t z = 20; z < 60; ++z)
+    {
+        world.SetBlockState(BlockPos(5, 5, z), Air());
+    }
+    world.SetBlockState(BlockPos(16, 8, 30), Air());
+    world.GetVoxelLightEngine().RunLightUpdates();
+    EXPECT_TRUE(tickUntilMirrored());
+    EXPECT_GT(stats.deltaPackets, 0u);
+
+    world.SetBlockState(BlockPos(5, 5, 60), Air());
+    world.GetVoxelLightEngine().RunLightUpdates();
+    ASSERT_EQ(static_cast<int>(chunk->GetSkyLight(5, 5, 20)), 15);
+    EXPECT_TRUE(tickUntilMirrored());
+    EXPECT_GT(stats.lightPackets, 0u);
+
+    // A lamp across the border: chunk (1, 0) only sees its light change, through the light engine
+    const uint64_t lightPacketsBefore = stats.lightPackets;
+    world.SetBlockState(BlockPos(15, 8, 30), Lamp());
+    world.GetVoxelLightEngine().RunLightUpdates();
+    ASSERT_GT(static_cast<int>(world.GetBlockLight(16, 8, 30)), 0);
+    EXPECT_TRUE(tickUntilMirrored());
+    EXPECT_GE(stats.lightPackets, lightPacketsBefore + 2);
+
+    // Bulk edit across the x = 0 border
+    const uint64_t deltaPacketsBefore = stats.deltaPackets;
+    world.BeginBulkEdit();
+    world.SetBlocks(BlockPos(-3, 2, 50), BlockPos(3, 4, 70), Air());
+    world.SetBlocks(BlockPos(-3, 2, 71), BlockPos(3, 4, 71), Glass());
+    world.CommitBulkEdit();
+    EXPECT_TRUE(tickUntilMirrored());
+    EXPECT_GE(stats.deltaPackets, deltaPacketsBefore + 2);
+    EXPECT_EQ(streamClient.GetStats().malformedPackets, 0u);
+
+    world.SetChunkStreamServer(nullptr);
+}
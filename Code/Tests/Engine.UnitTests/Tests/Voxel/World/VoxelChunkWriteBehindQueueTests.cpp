@@ -0,0 +1,194 @@
+#include <gtest/gtest.h>
+
+#include "Engine/Voxel/World/ChunkWriteBehindQueue.hpp"
+
+#include <map>
+#include <vector>
+
+using namespace enigma::voxel;
+
+namespace
+{
+    std::vector<uint8_t> MakePayload(uint8_t value, size_t size = 16)
+    {
+        return std::vector<uint8_t>(size, value);
+    }
+
+    // Records writes in call order; coordinates listed in failCoords fail once
+    struct RecordingWriter
+    {
+        std::vector<IntVec2>               order;
+        std::map<std::pair<int, int>, int> lastValue;
+        std::vector<IntVec2>               failCoords;
+
+        ChunkWriteBehindQueue::WriteFunction Function()
+        {
+            return [this](IntVec2 coords, const std::vector<uint8_t>& payload)
+            {
+                for (auto it = failCoords.begin(); it != failCoords.end(); ++it)
+                {
+                    if (*it == coords)
+                    {
+                        failCoords.erase(it);
+                        return false;
+                    }
+                }
+                order.push_back(coords);
+                lastValue[{coords.x, coords.y}] = payload.empty() ? -1 : payload[0];
+                return true;
+            };
+        }
+    };
+}
+
+TEST(ChunkWriteBehindQueueTests, RepeatedSavesCoalesceIntoOneWrite)
+{
+    ChunkWriteBehindQueue queue;
+    queue.Enqueue(IntVec2(1, 2), MakePayload(1), false, 0.0);
+    queue.Enqueue(IntVec2(1, 2), MakePayload(2), true, 1.0);
+    queue.Enqueue(IntVec2(1, 2), MakePayload(3), false, 2.0);
+
+    ChunkWriteBehindHit hit;
+    ASSERT_TRUE(queue.Find(IntVec2(1, 2), hit));
+    EXPECT_EQ((*hit.payload)[0], 3);
+    EXPECT_TRUE(hit.playerModified); // Sticky across coalesced saves
+
+    RecordingWriter writer;
+    EXPECT_TRUE(queue.FlushAll(writer.Function()));
+    ASSERT_EQ(writer.order.size(), 1u);
+    EXPECT_EQ((writer.lastValue[{1, 2}]), 3);
+
+    const ChunkWriteBehindStats stats = queue.GetStats();
+    EXPECT_EQ(stats.enqueued, 3u);
+    EXPECT_EQ(stats.coalesced, 2u);
+    EXPECT_EQ(stats.written, 1u);
+    EXPECT_EQ(stats.GetAvoidedWrites(), 2u);
+    EXPECT_EQ(stats.pendingBytes, 0u);
+    EXPECT_FALSE(queue.Contains(IntVec2(1, 2)));
+}
+
+TEST(ChunkWriteBehindQueueTests, ReclaimOnlyDropsTheMatchingSave)
+{
+    ChunkWriteBehindQueue queue;
+    queue.Enqueue(IntVec2(0, 0), MakePayload(1), false, 0.0);
+
+    ChunkWriteBehindHit first;
+    ASSERT_TRUE(queue.Find(IntVec2(0, 0), first));
+
+    // A newer save replaced the one the reload was built from
+    queue.Enqueue(IntVec2(0, 0), MakePayload(2), false, 0.0);
+    EXPECT_FALSE(queue.Reclaim(IntVec2(0, 0), first.sequence));
+    EXPECT_TRUE(queue.Contains(IntVec2(0, 0)));
+
+    ChunkWriteBehindHit latest;
+    ASSERT_TRUE(queue.Find(IntVec2(0, 0), latest));
+    EXPECT_TRUE(queue.Reclaim(IntVec2(0, 0), latest.sequence));
+    EXPECT_FALSE(queue.Contains(IntVec2(0, 0)));
+    EXPECT_EQ(queue.GetStats().reclaimed, 1u);
+    EXPECT_EQ(queue.GetStats().pendingBytes, 0u);
+}
+
+TEST(ChunkWriteBehindQueueTests, DueBatchesFollowAgeAndByteBudget)
+{
+    ChunkWriteBehindConfig config;
+    config.maxPendingBytes   = 64;
+    config.maxPendingSeconds = 5.0;
+    config.maxBatchEntries   = 8;
+    ChunkWriteBehindQueue queue(config);
+
+    queue.Enqueue(IntVec2(0, 0), MakePayload(1, 16), false, 0.0);
+    queue.Enqueue(IntVec2(1, 0), MakePayload(2, 16), false, 3.0);
+    EXPECT_TRUE(queue.PopDueBatch(4.0).IsEmpty()); // Young and under budget
+
+    // Only the save older than maxPendingSeconds is due
+    ChunkWriteBatch aged = queue.PopDueBatch(6.0);
+    ASSERT_EQ(aged.entries.size(), 1u);
+    EXPECT_EQ(aged.entries[0].coords, IntVec2(0, 0));
+    EXPECT_TRUE(queue.HasBatchInFlight());
+    EXPECT_TRUE(queue.PopDueBatch(100.0).IsEmpty()); // One batch in flight at a time
+
+    // In-flight saves are still visible to loads
+    EXPECT_TRUE(queue.Contains(IntVec2(0, 0)));
+
+    RecordingWriter writer;
+    queue.WriteBatch(aged, writer.Function());
+    queue.CompleteBatch(std::move(aged));
+    EXPECT_FALSE(queue.HasBatchInFlight());
+    EXPECT_FALSE(queue.Contains(IntVec2(0, 0)));
+
+    // Going over the byte budget makes the oldest saves due immediately
+    for (int32_t x = 2; x < 7; ++x)
+    {
+        queue.Enqueue(IntVec2(x, 0), MakePayload(static_cast<uint8_t>(x), 16), false, 7.0);
+    }
+    ChunkWriteBatch overBudget = queue.PopDueBatch(7.0);
+    EXPECT_EQ(overBudget.entries.size(), 2u); // 96 bytes pending -> write until back at 64
+    EXPECT_EQ(queue.GetStats().pendingBytes, 64u);
+    queue.CompleteBatch(std::move(overBudget));
+}
+
+TEST(ChunkWriteBehindQueueTests, BatchesAreSortedByRegionThenChunk)
+{
+    ChunkWriteBehindQueue queue;
+    const IntVec2 coords[] = {IntVec2(40, 0), IntVec2(1, 0), IntVec2(-1, 0), IntVec2(0, 33), IntVec2(0, 0)};
+    for (const IntVec2& c : coords)
+    {
+        queue.Enqueue(c, MakePayload(0), false, 0.0);
+    }
+
+    RecordingWriter writer;
+    EXPECT_TRUE(queue.FlushAll(writer.Function()));
+    const std::vector<IntVec2> expected = {IntVec2(-1, 0), IntVec2(0, 0), IntVec2(1, 0), IntVec2(40, 0), IntVec2(0, 33)};
+    EXPECT_EQ(writer.order, expected);
+}
+
+TEST(ChunkWriteBehindQueueTests, FailedWritesAreRequeuedUnlessReplaced)
+{
+    ChunkWriteBehindQueue queue;
+    queue.Enqueue(IntVec2(0, 0), MakePayload(1), false, 0.0);
+    queue.Enqueue(IntVec2(5, 5), MakePayload(1), false, 0.0);
+
+    RecordingWriter writer;
+    writer.failCoords = {IntVec2(0, 0), IntVec2(5, 5)};
+
+    ChunkWriteBatch batch = queue.PopDueBatch(1000.0);
+    ASSERT_EQ(batch.entries.size(), 2u);
+    queue.Enqueue(IntVec2(5, 5), MakePayload(9), false, 1000.0); // Newer save while writing
+    queue.WriteBatch(batch, writer.Function());
+    queue.CompleteBatch(std::move(batch));
+
+    ChunkWriteBehindStats stats = queue.GetStats();
+    EXPECT_EQ(stats.failed, 2u);
+    EXPECT_EQ(stats.pendingEntries, 2u);
+
+    ChunkWriteBehindHit hit;
+    ASSERT_TRUE(queue.Find(IntVec2(5, 5), hit));
+    EXPECT_EQ((*hit.payload)[0], 9); // The failed old copy did not replace the newer save
+
+    EXPECT_TRUE(queue.FlushAll(writer.Function()));
+    EXPECT_EQ((writer.lastValue[{0, 0}]), 1);
+    EXPECT_EQ((writer.lastValue[{5, 5}]), 9);
+    EXPECT_EQ(queue.GetStats().pendingEntries, 0u);
+}
+
+TEST(ChunkWriteBehindQueueTests, FlushAllReportsProgress)
+{
+    ChunkWriteBehindQueue queue;
+    for (int32_t i = 0; i < 10; ++i)
+    {
+        queue.Enqueue(IntVec2(i, i), MakePayload(static_cast<uint8_t>(i)), false, 0.0);
+    }
+
+    std::vector<std::pair<size_t, size_t>> progress;
+    RecordingWriter                        writer;
+    EXPECT_TRUE(queue.FlushAll(writer.Function(), [&progress](size_t written, size_t total)
+    {
+        progress.emplace_back(written, total);
+    }));
+
+    ASSERT_EQ(progress.size(), 10u);
+    EXPECT_EQ(progress.front(), std::make_pair(size_t(1), size_t(10)));
+    EXPECT_EQ(progress.back(), std::make_pair(size_t(10), size_t(10)));
+    EXPECT_EQ(queue.GetStats().written, 10u);
+    EXPECT_EQ(queue.GetStats().batches, 1u);
+}
@@ -0,0 +1,259 @@
+#include <gtest/gtest.h>
+
+#include "Engine/Registry/Block/Block.hpp"
+#include "Engine/Voxel/Chunk/Chunk.hpp"
+#include "Engine/Voxel/Chunk/ChunkHelper.hpp"
+#include "Engine/Voxel/World/World.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <vector>
+
+using namespace enigma::voxel;
+
+namespace
+{
+    // Free-standing blocks with the flags BlockRegistry would load from YAML
+    struct TestBlocks
+    {
+        enigma::registry::block::Block air{"air", "test"};
+        enigma::registry::block::Block stone{"stone", "test"};
+        enigma::registry::block::Block glass{"glass", "test"}; // Blocks motion, lets light through
+        enigma::registry::block::Block lamp{"lamp", "test"}; // Opaque light source
+
+        TestBlocks()
+        {
+            air.SetVisible(false);
+            air.SetCanOcclude(false);
+            air.SetFullBlock(false);
+            glass.SetCanOcclude(false);
+            lamp.SetBlockLightEmission(14);
+
+            for (auto* block : {&air, &stone, &glass, &lamp})
+            {
+                block->GenerateBlockStates();
+            }
+        }
+
+        BlockState* Air() const { return air.GetDefaultState(); }
+        BlockState* Stone() const { return stone.GetDefaultState(); }
+        BlockState* Glass() const { return glass.GetDefaultState(); }
+        BlockState* Lamp() const { return lamp.GetDefaultState(); }
+    };
+
+    // One inclusive box of identical blocks
+    struct BoxEdit
+    {
+        BlockPos    minCorner;
+        BlockPos    maxCorner;
+        BlockState* state = nullptr;
+    };
+
+    // Active, lit chunks in a square of the given radius around chunk (0, 0), no mesh sections dirty
+    void PopulateWorld(World& world, const TestBlocks& blocks, int radius)
+    {
+        for (int32_t chunkY = -radius; chunkY <= radius; ++chunkY)
+        {
+            for (int32_t chunkX = -radius; chunkX <= radius; ++chunkX)
+            {
+                auto chunk = std::make_unique<Chunk>(IntVec2(chunkX, chunkY), blocks.Air());
+                for (int32_t y = 0; y < Chunk::CHUNK_SIZE_Y; ++y)
+                {
+                    for (int32_t x = 0; x < Chunk::CHUNK_SIZE_X; ++x)
+                    {
+                        const int32_t ground = 60 + ((x * 7 + y * 13 + chunkX * 3) % 20);
+                        for (int32_t z = 0; z <= ground; ++z)
+                        {
+                            chunk->SetBlock(x, y, z, blocks.Stone());
+                        }
+                    }
+                }
+                chunk->SetWorld(&world);
+                chunk->TrySetState(chunk->GetState(), ChunkState::Active);
+                world.GetLoadedChunks()[ChunkHelper::PackCoordinates(chunkX, chunkY)] = std::move(chunk);
+            }
+        }
+
+        for (auto& [key, chunk] : world.GetLoadedChunks())
+        {
+            chunk->InitializeLighting(&world);
+        }
+        world.GetVoxelLightEngine().RunLightUpdates();
+        for (auto& [key, chunk] : world.GetLoadedChunks())
+        {
+            chunk->ClearMeshSectionsDirty();
+        }
+    }
+
+    void ApplyPerBlock(World& world, const std::vector<BoxEdit>& edits)
+    {
+        for (const BoxEdit& edit : edits)
+        {
+            for (int32_t z = edit.minCorner.z; z <= edit.maxCorner.z; ++z)
+            {
+                for (int32_t y = edit.minCorner.y; y <= edit.maxCorner.y; ++y)
+                {
+                    for (int32_t x = edit.minCorner.x; x <= edit.maxCorner.x; ++x)
+                    {
+                        world.SetBlockState(BlockPos(x, y, z), edit.state);
+                    }
+                }
+            }
+        }
+        world.GetVoxelLightEngine().RunLightUpdates();
+    }
+
+    BulkBlockEditStats ApplyBulk(World& world, const std::vector<BoxEdit>& edits)
+    {
+        world.BeginBulkEdit();
+        for (const BoxEdit& edit : edits)
+        {
+            world.SetBlocks(edit.minCorner, edit.maxCorner, edit.state);
+        }
+        return world.CommitBulkEdit();
+    }
+
+    // Blocks, light, SKY flags, heightmaps and dirty mesh sections of every loaded chunk.
+    // SetBlockState never remeshes the chunk across a border its edit exposes, CommitBulkEdit does:
+    // for those faceNeighbors the bulk sections only have to cover the per-block ones.
+    void ExpectSameWorld(World& expected, World& actual, const std::vector<IntVec2>& faceNeighbors = {})
+    {
+        ASSERT_EQ(expected.GetLoadedChunks().size(), actual.GetLoadedChunks().size());
+        for (auto& [key, expectedChunk] : expected.GetLoadedChunks())
+        {
+            const Chunk* actualChunk = actual.GetLoadedChunks().at(key).get();
+            const IntVec2 coords     = expectedChunk->GetChunkCoords();
+
+            size_t blockMismatches = 0, blockLightMismatches = 0, skyLightMismatches = 0, skyFlagMismatches = 0;
+            for (int32_t z = 0; z < Chunk::CHUNK_SIZE_Z; ++z)
+            {
+                for (int32_t y = 0; y < Chunk::CHUNK_SIZE_Y; ++y)
+                {
+                    for (int32_t x = 0; x < Chunk::CHUNK_SIZE_X; ++x)
+                    {
+                        blockMismatches += expectedChunk->GetBlock(x, y, z) != actualChunk->GetBlock(x, y, z) ? 1 : 0;
+                        blockLightMismatches += expectedChunk->GetBlockLight(x, y, z) != actualChunk->GetBlockLight(x, y, z) ? 1 : 0;
+                        skyLightMismatches += expectedChunk->GetSkyLight(x, y, z) != actualChunk->GetSkyLight(x, y, z) ? 1 : 0;
+                        skyFlagMismatches += expectedChunk->GetIsSky(x, y, z) != actualChunk->GetIsSky(x, y, z) ? 1 : 0;
+                    }
+                }
+            }
+            EXPECT_EQ(blockMismatches, 0u) << "chunk " << coords.x << "," << coords.y;
+            EXPECT_EQ(blockLightMismatches, 0u) << "chunk " << coords.x << "," << coords.y;
+            EXPECT_EQ(skyLightMismatches, 0u) << "chunk " << coords.x << "," << coords.y;
+            EXPECT_EQ(skyFlagMismatches, 0u) << "chunk " << coords.x << "," << coords.y;
+
+            for (size_t t = 0; t < HEIGHTMAP_TYPE_COUNT; ++t)
+            {
+                const HeightmapType type = static_cast<HeightmapType>(t);
+                EXPECT_EQ(expectedChunk->GetHeightmap(type), actualChunk->GetHeightmap(type)) << "chunk " << coords.x << "," << coords.y << " heightmap type " << t;
+            }
+            const uint32_t expectedMask = expectedChunk->GetDirtyMeshSectionMask();
+            const uint32_t actualMask   = actualChunk->GetDirtyMeshSectionMask();
+            if (std::find(faceNeighbors.begin(), faceNeighbors.end(), coords) != faceNeighbors.end())
+            {
+                EXPECT_EQ(expectedMask & ~actualMask, 0u) << "chunk " << coords.x << "," << coords.y;
+                EXPECT_NE(actualMask, 0u) << "chunk " << coords.x << "," << coords.y;
+            }
+            else
+            {
+                EXPECT_EQ(expectedMask, actualMask) << "chunk " << coords.x << "," << coords.y;
+            }
+        }
+    }
+}
+
+TEST(VoxelWorldBulkEditTests, CrossChunkFillMatchesPerBlockEdits)
+{
+    TestBlocks blocks;
+    World      perBlock;
+    World      bulk;
+    PopulateWorld(perBlock, blocks, 2);
+    PopulateWorld(bulk, blocks, 2);
+
+    // A glass-capped cave straddling the x = 0 and y = 0 chunk borders and opening onto the east
+    // edge of chunk (0, *), lit by a lamp on the border
+    const std::vector<BoxEdit> edits = {
+        {BlockPos(-6, -5, 52), BlockPos(15, 10, 74), blocks.Air()},
+        {BlockPos(-6, -5, 75), BlockPos(15, 10, 75), blocks.Glass()},
+        {BlockPos(-1, 0, 52), BlockPos(0, 0, 52), blocks.Lamp()},
+    };
+    ApplyPerBlock(perBlock, edits);
+    const BulkBlockEditStats stats = ApplyBulk(bulk, edits);
+
+    EXPECT_EQ(stats.chunksTouched, 4u);
+    EXPECT_GT(stats.skyFlagsChanged, 0u);
+    EXPECT_GE(stats.neighborMeshUpdates, 2u);
+    ExpectSameWorld(perBlock, bulk, {IntVec2(1, -1), IntVec2(1, 0)});
+}
+
+TEST(VoxelWorldBulkEditTests, WallAcrossChunkBorderRelightsOnlyUnwrittenNeighbors)
+{
+    TestBlocks blocks;
+    World      perBlock;
+    World      bulk;
+    PopulateWorld(perBlock, blocks, 1);
+    PopulateWorld(bulk, blocks, 1);
+
+    // A sealed cave across the x = 0 border, lit from the chunk (-1, 0) side
+    const std::vector<BoxEdit> cave = {
+        {BlockPos(-4, 4, 40), BlockPos(3, 11, 50), blocks.Air()},
+        {BlockPos(-4, 8, 45), BlockPos(-4, 8, 45), blocks.Lamp()},
+    };
+    for (World* world : {&perBlock, &bulk})
+    {
+        ApplyPerBlock(*world, cave);
+        for (auto& [key, chunk] : world->GetLoadedChunks())
+        {
+            chunk->ClearMeshSectionsDirty();
+        }
+    }
+    ASSERT_GT(static_cast<int>(bulk.GetBlockLight(1, 8, 45)), 0);
+
+    // Stone written as "resolved direct" does not notify its neighbors, so the commit seeds them:
+    // across the border the glass is bulk written itself (IsBulkWritten, skipped) while the air
+    // above it is not and has to lose the lamp light that now stops at the stone wall
+    const std::vector<BoxEdit> wall = {
+        {BlockPos(-1, 4, 40), BlockPos(-1, 11, 50), blocks.Stone()},
+        {BlockPos(0, 4, 40), BlockPos(0, 5, 50), blocks.Glass()},
+    };
+    ApplyPerBlock(perBlock, wall);
+    const BulkBlockEditStats stats = ApplyBulk(bulk, wall);
+
+    EXPECT_EQ(stats.chunksTouched, 2u);
+    EXPECT_EQ(stats.blocksWritten, 8u * 11u + 2u * 11u);
+    EXPECT_GT(stats.lightResolvedDirect, 0u);
+    EXPECT_EQ(static_cast<int>(bulk.GetBlockLight(1, 8, 45)), 0);
+    ExpectSameWorld(perBlock, bulk);
+}
+
+TEST(VoxelWorldBulkEditTests, OpeningAndCappingAShaftDirtiesEverySectionItRelights)
+{
+    TestBlocks blocks;
+    World      world;
+    PopulateWorld(world, blocks, 0);
+    Chunk* chunk = world.GetLoadedChunks().begin()->second.get();
+
+    // A sealed one-block shaft from z 20 up to the ground block of column (5, 5)
+    ASSERT_EQ(chunk->GetHeight(HeightmapType::LightBlocking, 5, 5), 60);
+    for (int32_t z = 20; z < 60; ++z)
+    {
+        chunk->SetBlockByPlayer(5, 5, z, blocks.Air());
+    }
+    world.GetVoxelLightEngine().RunLightUpdates();
+    chunk->ClearMeshSectionsDirty();
+
+    // Without a mesh SetBlockState falls back to a full rebuild, so edit the chunk directly:
+    // the SKY descend sets skylight down to z 20 itself, three sections below the edit
+    const uint32_t shaftSections = (1u << 1) | (1u << 2) | (1u << 3);
+    chunk->SetBlockByPlayer(5, 5, 60, blocks.Air());
+    world.GetVoxelLightEngine().RunLightUpdates();
+    EXPECT_EQ(static_cast<int>(chunk->GetSkyLight(5, 5, 20)), 15);
+    EXPECT_EQ(chunk->GetDirtyMeshSectionMask(), shaftSections);
+
+    chunk->ClearMeshSectionsDirty();
+    chunk->SetBlockByPlayer(5, 5, 60, blocks.Stone());
+    world.GetVoxelLightEngine().RunLightUpdates();
+    EXPECT_EQ(static_cast<int>(chunk->GetSkyLight(5, 5, 20)), 0);
+    EXPECT_EQ(chunk->GetDirtyMeshSectionMask(), shaftSections);
+}